@@ -0,0 +1,423 @@
+// AHCI SATA driver, with native command queuing.
+//
+// ahciinit() finds the pci ahci controller and registers the ports with
+// a SATA disk attached as block devices, in port order, see blkdev.c.
+//
+// each port has NSLOT command slots. a disk that supports NCQ takes a
+// command in each at once, up to its queue depth, and completes them in
+// whatever order suits it; one that doesn't gets one command at a time.
+// each port has its own blkqueue and lock, and a slot carries a run of up
+// to AHCIRUN requests for consecutive blocks.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+#include "pci.h"
+#include "blkdev.h"
+
+#define NSLOT       32      // command slots per port
+#define AHCIRUN     8       // most buffers per command
+#define NAHCIDEV    4
+#define SECTOR_SIZE 512
+
+// hba registers
+#define HBA_GHC     0x04
+#define HBA_IS      0x08    // interrupt status, a bit per port
+#define HBA_PI      0x0C    // ports implemented
+#define GHC_IE      0x00000002  // interrupt enable
+#define GHC_AE      0x80000000  // ahci enable
+
+// port registers, at 0x100 + 0x80 * port
+#define PX_CLB      0x00    // command list base
+#define PX_CLBU     0x04
+#define PX_FB       0x08    // received fis base
+#define PX_FBU      0x0C
+#define PX_IS       0x10    // interrupt status
+#define PX_IE       0x14    // interrupt enable
+#define PX_CMD      0x18
+#define PX_TFD      0x20    // task file data: the drive's status
+#define PX_SIG      0x24    // signature of the device attached
+#define PX_SSTS     0x28    // sata status
+#define PX_SERR     0x30
+#define PX_SACT     0x34    // ncq commands not done, a bit per slot
+#define PX_CI       0x38    // commands issued, a bit per slot
+
+#define PXCMD_ST    0x0001  // start processing the command list
+#define PXCMD_FRE   0x0010  // fis receive enable
+#define PXCMD_FR    0x4000  // fis receive running
+#define PXCMD_CR    0x8000  // command list running
+#define PXIS_DHRS   0x00000001  // d2h register fis: a command done
+#define PXIS_PSS    0x00000002  // pio setup fis
+#define PXIS_SDBS   0x00000008  // set device bits fis: ncq commands done
+#define PXIS_TFES   0x40000000  // task file error
+#define TFD_ERR     0x01
+#define TFD_DRQ     0x08
+#define TFD_BSY     0x80
+#define SSTS_DET    0x0F    // device detection
+#define SSTS_UP     0x03    //   device present, phy up
+#define SIG_ATA     0x00000101
+
+#define ATA_IDENTIFY    0xEC
+#define ATA_RDDMAEXT    0x25
+#define ATA_WRDMAEXT    0x35
+#define ATA_RDFPDMA     0x60    // read fpdma queued: ncq
+#define ATA_WRFPDMA     0x61
+#define FIS_H2D         0x27    // register fis, host to device
+
+// command list entry
+struct cmdheader {
+    ushort flags;       // fis length in dwords, CH_WRITE
+    ushort prdtl;       // prd entries
+    volatile uint prdbc;    // bytes transferred
+    uint ctba;          // command table, 128-byte aligned
+    uint ctbau;
+    uint rsv[4];
+};
+
+#define CH_WRITE    0x40
+
+struct ahciprd {
+    uint dba;           // data address
+    uint dbau;
+    uint rsv;
+    uint dbc;           // bytes - 1
+};
+
+struct cmdtable {
+    uchar cfis[64];     // the command, as a register fis
+    uchar acmd[16];
+    uchar rsv[48];
+    struct ahciprd prdt[AHCIRUN];
+};
+
+#define CTPP    (PGSIZE / sizeof(struct cmdtable))
+
+struct ahciport {
+    int port;           // number on the hba
+    uint regs;          // address of the port's registers
+    struct cmdheader *clb;  // command list, NSLOT entries
+    struct cmdtable *ctab[NSLOT];
+    struct buf *slot[NSLOT];    // first buffer of each slot's run
+    uint busy;          // slots in use
+    int depth;          // slots to use: the queue depth, 1 without ncq
+    int ncq;
+    struct blkqueue bq; // its lock protects the rest
+    struct blkdev bd;
+};
+
+static uint hba;        // address of the hba registers
+static struct ahciport ports[NAHCIDEV];
+static int nport;       // ports with a disk
+
+static int ahcipoll(struct blkqueue*);
+
+static uint
+hbaread(uint off)
+{
+    return *(volatile uint*)(hba + off);
+}
+
+static void
+hbawrite(uint off, uint v)
+{
+    *(volatile uint*)(hba + off) = v;
+}
+
+static uint
+pread(struct ahciport *pt, uint off)
+{
+    return *(volatile uint*)(pt->regs + off);
+}
+
+static void
+pwrite(struct ahciport *pt, uint off, uint v)
+{
+    *(volatile uint*)(pt->regs + off) = v;
+}
+
+// fill in slot s to transfer the run starting at b, or, if b is 0, to
+// identify the drive into the page id.
+static void
+ahcifill(struct ahciport *pt, int s, struct buf *b, char *id)
+{
+    struct cmdtable *ct = pt->ctab[s];
+    struct cmdheader *h = &pt->clb[s];
+    struct buf *x;
+    uchar *fis = ct->cfis;
+    uint lba, count;
+    int n, write;
+
+    memset(fis, 0, 20);
+    fis[0] = FIS_H2D;
+    fis[1] = 0x80;      // a command
+    if (b == 0) {
+        fis[2] = ATA_IDENTIFY;
+        ct->prdt[0].dba = V2P(id);
+        ct->prdt[0].dbau = 0;
+        ct->prdt[0].dbc = SECTOR_SIZE - 1;
+        h->flags = 5;
+        h->prdtl = 1;
+        h->prdbc = 0;
+        return;
+    }
+
+    write = (b->flags & B_DIRTY) != 0;
+    for (n = 0, x = b; x; n++, x = x->qnext) {
+        ct->prdt[n].dba = V2P(x->data);
+        ct->prdt[n].dbau = 0;
+        ct->prdt[n].dbc = BSIZE - 1;
+    }
+    count = n * (BSIZE / SECTOR_SIZE);
+    lba = b->blockno * (BSIZE / SECTOR_SIZE);
+    if (pt->ncq) {
+        // the count goes in the features fields, the tag in the count's
+        fis[2] = write ? ATA_WRFPDMA : ATA_RDFPDMA;
+        fis[3] = count & 0xFF;
+        fis[11] = count >> 8;
+        fis[12] = s << 3;
+    } else {
+        fis[2] = write ? ATA_WRDMAEXT : ATA_RDDMAEXT;
+        fis[12] = count & 0xFF;
+        fis[13] = count >> 8;
+    }
+    fis[4] = lba & 0xFF;
+    fis[5] = (lba >> 8) & 0xFF;
+    fis[6] = (lba >> 16) & 0xFF;
+    fis[7] = 0x40;      // lba mode
+    fis[8] = lba >> 24;
+    h->flags = 5 | (write ? CH_WRITE : 0);
+    h->prdtl = n;
+    h->prdbc = 0;
+}
+
+// put the run starting at b in a free slot; blkstart() keeps
+// no more than depth in flight, so there is one.
+// called with pt->bq.lock held
+static void
+ahcistart(struct blkqueue *bq, struct buf *b)
+{
+    struct ahciport *pt = bq->priv;
+    int s;
+
+    for (s = 0; s < pt->depth && (pt->busy & (1U << s)); s++)
+        ;
+    if (s == pt->depth)
+        panic("ahcistart: no slot");
+    ahcifill(pt, s, b, 0);
+    pt->slot[s] = b;
+    pt->busy |= 1U << s;
+    if (pt->ncq)
+        pwrite(pt, PX_SACT, 1U << s);
+    pwrite(pt, PX_CI, 1U << s);
+}
+
+// stop pt processing commands and receiving fises, and its interrupts.
+// returns 0 if it didn't stop.
+static int
+ahciportstop(struct ahciport *pt)
+{
+    int spin;
+
+    pwrite(pt, PX_IE, 0);
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) & ~(PXCMD_ST | PXCMD_FRE));
+    for (spin = 0; pread(pt, PX_CMD) & (PXCMD_CR | PXCMD_FR); spin++)
+        if (spin == 1000000)
+            return 0;
+    return 1;
+}
+
+// stop pt and give back the pages ahciportinit() gave it. if it won't
+// stop, the hba may still write to them, so they stay allocated.
+static void
+ahciportfree(struct ahciport *pt)
+{
+    int i;
+
+    if (!ahciportstop(pt))
+        return;
+    for (i = 0; i < NSLOT; i += CTPP) {
+        if (pt->ctab[i])
+            kfree((char*)pt->ctab[i]);
+        pt->ctab[i] = 0;
+    }
+    kfree((char*)pt->clb);
+    pt->clb = 0;
+}
+
+// set port pt up, and see what its disk can do.
+// returns 0 if there is no usable disk.
+static int
+ahciportinit(struct ahciport *pt)
+{
+    char *p, *id;
+    ushort *w;
+    int i, spin;
+
+    if ((pread(pt, PX_SSTS) & SSTS_DET) != SSTS_UP || pread(pt, PX_SIG) != SIG_ATA)
+        return 0;
+
+    // stop the port while pointing it at its command list
+    if (!ahciportstop(pt))
+        return 0;
+
+    // the command list (1KB) and received fis area (256 bytes) share a
+    // page; the command tables take two more
+    if ((p = kalloc()) == 0)
+        panic("ahciportinit");
+    memset(p, 0, PGSIZE);
+    pt->clb = (struct cmdheader*)p;
+    pwrite(pt, PX_CLB, V2P(p));
+    pwrite(pt, PX_CLBU, 0);
+    pwrite(pt, PX_FB, V2P(p + 1024));
+    pwrite(pt, PX_FBU, 0);
+    for (i = 0; i < NSLOT; i++) {
+        if (i % CTPP == 0) {
+            if ((p = kalloc()) == 0)
+                panic("ahciportinit");
+            memset(p, 0, PGSIZE);
+        }
+        pt->ctab[i] = (struct cmdtable*)p + i % CTPP;
+        pt->clb[i].ctba = V2P(pt->ctab[i]);
+        pt->clb[i].ctbau = 0;
+    }
+
+    pwrite(pt, PX_SERR, 0xFFFFFFFF);
+    pwrite(pt, PX_IS, 0xFFFFFFFF);
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) | PXCMD_FRE);
+    for (spin = 0; pread(pt, PX_TFD) & (TFD_BSY | TFD_DRQ); spin++) {
+        if (spin == 1000000) {
+            ahciportfree(pt);
+            return 0;
+        }
+    }
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) | PXCMD_ST);
+
+    // identify, polling: interrupts are still off
+    if ((id = kalloc()) == 0)
+        panic("ahciportinit");
+    ahcifill(pt, 0, 0, id);
+    pwrite(pt, PX_CI, 1);
+    for (spin = 0; pread(pt, PX_CI) & 1; spin++) {
+        if ((pread(pt, PX_IS) & PXIS_TFES) || spin == 10000000) {
+            kfree(id);
+            ahciportfree(pt);
+            return 0;
+        }
+    }
+    w = (ushort*)id;
+    pt->ncq = (w[76] & 0x100) != 0;     // sata capabilities: ncq
+    pt->depth = pt->ncq ? (w[75] & 0x1F) + 1 : 1;
+    kfree(id);
+
+    pwrite(pt, PX_IS, 0xFFFFFFFF);
+    pwrite(pt, PX_IE, PXIS_DHRS | PXIS_PSS | PXIS_SDBS | PXIS_TFES);
+    blkqinit(&pt->bq, "ahci", &deadlinesched, AHCIRUN, pt->depth, ahcistart, pt);
+    pt->bq.poll = ahcipoll;
+    pt->bd.name = "ahci";
+    pt->bd.nq = 1;
+    pt->bd.qs = &pt->bq;
+    return 1;
+}
+
+void
+ahciinit(void)
+{
+    struct pcidev *d;
+    struct ahciport *pt;
+    uint pi;
+    int i, dev;
+
+    if ((d = pcifindclass(PCI_SATA)) == 0 || d->progif != 0x01)
+        return;
+    // the registers must be in the device space kvm maps, see vm.c
+    if (d->bar[5] & PCI_BAR_IO || PCI_BAR_MEMADDR(d->bar[5]) < DEVSPACE) {
+        cprintf("ahci: registers at %x, not mapped\n", d->bar[5]);
+        return;
+    }
+    pcienable(d, 1);
+    hba = PCI_BAR_MEMADDR(d->bar[5]);
+    hbawrite(HBA_GHC, hbaread(HBA_GHC) | GHC_AE);
+
+    pi = hbaread(HBA_PI);
+    for (i = 0; i < 32 && nport < NAHCIDEV; i++) {
+        if (!(pi & (1U << i)))
+            continue;
+        pt = &ports[nport];
+        pt->port = i;
+        pt->regs = hba + 0x100 + 0x80 * i;
+        if (!ahciportinit(pt))
+            continue;
+        if ((dev = blkalloc(&pt->bd)) < 0) {
+            cprintf("ahci: port %d: no device number\n", i);
+            ahciportfree(pt);
+            continue;
+        }
+        cprintf("ahci: port %d is dev %d, %s, %d slots\n", i, dev, pt->ncq ? "ncq" : "no ncq", pt->depth);
+        nport++;
+    }
+
+    hbawrite(HBA_IS, 0xFFFFFFFF);
+    pcisetintr(d, ahciintr);
+    hbawrite(HBA_GHC, hbaread(HBA_GHC) | GHC_IE);
+}
+
+// finish the commands pt's disk is done with, and start more.
+// returns how many. caller holds pt->bq.lock
+static int
+ahcifinish(struct ahciport *pt)
+{
+    uint pis, done;
+    int s, n;
+
+    pis = pread(pt, PX_IS);
+    pwrite(pt, PX_IS, pis);
+    if (pis & PXIS_TFES)
+        panic("ahciintr: task file error");
+
+    // a slot is done once the disk has cleared both its bits
+    done = pt->busy & ~(pread(pt, PX_SACT) | pread(pt, PX_CI));
+    for (s = n = 0; s < pt->depth; s++) {
+        if (!(done & (1U << s)))
+            continue;
+        pt->busy &= ~(1U << s);
+        blkdone(&pt->bq, pt->slot[s]);
+        pt->slot[s] = 0;
+        n++;
+    }
+    blkstart(&pt->bq);
+    return n;
+}
+
+void
+ahciintr(void)
+{
+    struct ahciport *pt;
+    uint is;
+    int i;
+
+    is = hbaread(HBA_IS);
+    for (i = 0, pt = ports; i < nport; i++, pt++) {
+        if (!(is & (1U << pt->port)))
+            continue;
+        acquire(&pt->bq.lock);
+        ahcifinish(pt);
+        release(&pt->bq.lock);
+    }
+    hbawrite(HBA_IS, is);
+}
+
+// blkrw()'s poll of the port for a read, instead of the interrupt
+static int
+ahcipoll(struct blkqueue *bq)
+{
+    return ahcifinish(bq->priv);
+}
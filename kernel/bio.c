@@ -1,6 +1,6 @@
 // Buffer cache
 //
-// the buffer cache is a linked list of buf structures holding
+// the buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents. caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -15,44 +15,390 @@
 // the implementation uses two state flags internally
 // * B_VALID: the buffer data has been read from the disk
 // * B_DIRTY: the buffer data has been modified and needs to be written to disk
+// and the disk drivers one more
+// * B_QUEUED: a disk request for the buffer is queued or in progress
+//
+// the requests go to the block device b->dev, see blkdev.c.
+//
+// bread_async() and bwrite_async() start a request and return; biowait()
+// waits for it. that lets a caller keep many requests in flight.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "kstat.h"
 
-struct {
+// cached blocks are found through a hash table keyed by (dev, blockno),
+// each bucket with its own lock, so a hit costs one short chain walk and
+// cores reading different blocks rarely take the same lock. the buffers
+// are also on two replacement lists, used to pick a buffer to recycle on
+// a miss; bcache.lrulock protects them and serializes recycling.
+//
+// replacement is 2Q-like, so that one large sequential read can't push out
+// the metadata blocks every path name lookup needs:
+// * a newly read block goes on the probation list, a FIFO that misses
+//   recycle from first.
+// * a probation block referenced again, more than BCORRELATE ticks after
+//   it came in, moves to the protected list, an LRU holding at most
+//   BPROTPCT percent of the buffers; its least recent block drops back to
+//   probation when it's full. references within BCORRELATE ticks, such as
+//   readi() reading a block in several pieces, count as one.
+// a streaming read only ever cycles through probation. 2Q proper promotes
+// on a hit in a ghost list of recently evicted block numbers; the
+// correlation period avoids keeping a second hash table for that.
+// bcache.strictlru switches back to a single lru list, for comparison.
+//
+// lock order: lrulock, then one bucket lock at a time.
+// refcnt changes atomically, since brelse() decrements it without a bucket
+// lock. to recycle a buffer, bget() first claims it by setting BRECYCLE in
+// a zero refcnt, which keeps hits in its old bucket off it.
+//
+// the cache is sized at boot to BCACHEPCT percent of free memory, and
+// grows and shrinks a group of BPP buffers at a time: the buffers whose
+// data share one kalloc() page. kalloc() calls bshrink() when it runs out
+// of pages, which gives back the pages of idle groups; the group's struct
+// bufs are kept on a spare list, for bget() to reuse once memory is free.
+#define BPP         (PGSIZE / BSIZE)    // buffers per data page
+#define BRECYCLE    0x80000000
+#define NODEV       0xFFFFFFFF          // dev of buffers holding no block
+#define NBKTPAGE    256                 // most pages of buckets
+#define BGROWMIN    1024                // free pages needed to regrow after a shrink
+#define BCORRELATE  1                   // ticks within which re-references count as one
+#define BPROTPCT    75                  // most buffers on the protected list, percent
+
+#define BRUN        16                  // most buffers breadahead() submits at once
+
+#define BQ_PROBATION    0
+#define BQ_PROTECTED    1
+
+struct bucket {
     struct spinlock lock;
-    struct buf buf[NBUF];
+    struct buf *head;   // through buf->hnext
+} CACHEALIGNED;
+_Static_assert(__alignof__(struct bucket) == CACHELINE, "hash buckets share cache lines");
+_Static_assert(__alignof__(struct buf) == CACHELINE, "buffer headers share cache lines");
+
+#define BKTPP       (PGSIZE / sizeof(struct bucket))
+
+struct bgroup {
+    struct buf buf[BPP];
+    struct bgroup *next;    // on bcache.spare
+};
 
-    // linked list of all buffers, through prev/next
-    // head.next is mostly recently used.
-    struct buf head;
+struct {
+    struct mcslock lrulock;
+    uint nbuf;              // buffers with data
+    uint target;            // nbuf binit() aimed for
+    uint nbucket;           // a power of two
+    struct bucket *bucket[NBKTPAGE];    // pages of buckets
+    struct bgroup *spare;   // groups without a data page
+    int strictlru;          // plain lru instead of 2Q, for bcachebench()
+
+    // replacement lists, through prev/next;
+    // list[q].next is the most recently added or used.
+    struct buf list[2];
+    uint nlist[2];
 } bcache;
 
+// add b to the front of list q
+static void
+blistadd(struct buf *b, int q)
+{
+    struct buf *head = &bcache.list[q];
+
+    b->queue = q;
+    b->next = head->next;
+    b->prev = head;
+    head->next->prev = b;
+    head->next = b;
+    bcache.nlist[q]++;
+}
+
+static void
+blistdel(struct buf *b)
+{
+    b->next->prev = b->prev;
+    b->prev->next = b->next;
+    bcache.nlist[b->queue]--;
+}
+
+static struct bucket*
+bbucket(uint dev, uint blockno)
+{
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+}
+
+// add b to the bucket for its block
+static void
+bhash(struct buf *b)
+{
+    struct bucket *bk = bbucket(b->dev, b->blockno);
+
+    acquire(&bk->lock);
+    b->hnext = bk->head;
+    bk->head = b;
+    release(&bk->lock);
+}
+
+// remove b from the bucket for its block
+static void
+bunhash(struct buf *b)
+{
+    struct bucket *bk = bbucket(b->dev, b->blockno);
+    struct buf **pp;
+
+    acquire(&bk->lock);
+    for (pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+        ;
+    *pp = b->hnext;
+    release(&bk->lock);
+}
+
+// add a group of idle buffers at the lru end of the list,
+// with a new data page. caller holds lrulock.
+// returns 0 if out of memory.
+static int
+bgrow(void)
+{
+    struct bgroup *g;
+    struct buf *b;
+    char *data, *meta;
+
+    if (bcache.spare == 0) {
+        if ((meta = kalloc()) == 0)
+            return 0;
+        memset(meta, 0, PGSIZE);
+        for (g = (struct bgroup*)meta; (char*)(g + 1) <= meta + PGSIZE; g++) {
+            for (b = g->buf; b < g->buf + BPP; b++) {
+                initsleeplock(&b->lock, "buffer");
+                initwaitq(&b->wq);
+            }
+            g->next = bcache.spare;
+            bcache.spare = g;
+        }
+    }
+    if ((data = kalloc()) == 0)
+        return 0;
+    g = bcache.spare;
+    bcache.spare = g->next;
+
+    for (b = g->buf; b < g->buf + BPP; b++) {
+        b->data = (uchar*)data;
+        data += BSIZE;
+        b->dev = NODEV;
+        b->blockno = (uint)b;   // spreads idle buffers over the buckets
+        b->flags = 0;
+        b->refcnt = 0;
+        bhash(b);
+        // at the far end of probation: recycled first
+        b->queue = BQ_PROBATION;
+        b->next = &bcache.list[BQ_PROBATION];
+        b->prev = bcache.list[BQ_PROBATION].prev;
+        b->prev->next = b;
+        b->next->prev = b;
+        bcache.nlist[BQ_PROBATION]++;
+    }
+    bcache.nbuf += BPP;
+    kstatinc(KS_BCACHEGROW);
+    return 1;
+}
+
+// the group b belongs to
+static struct bgroup*
+bgroupof(struct buf *b)
+{
+    uint pg = PGROUNDDOWN((uint)b);
+
+    return (struct bgroup*)pg + ((uint)b - pg) / sizeof(struct bgroup);
+}
+
+// try to claim all of b's group for bshrink()
+static struct bgroup*
+bclaimgroup(struct buf *b)
+{
+    struct bgroup *g = bgroupof(b);
+    struct buf *x;
+
+    for (x = g->buf; x < g->buf + BPP; x++) {
+        if (!__sync_bool_compare_and_swap(&x->refcnt, 0, BRECYCLE))
+            break;
+        if (x->flags & B_DIRTY) {
+            x->refcnt = 0;
+            break;
+        }
+    }
+    if (x == g->buf + BPP)
+        return g;
+    while (x-- > g->buf)
+        x->refcnt = 0;
+    return 0;
+}
+
+// give back the data pages of up to n idle groups, least recently used
+// first, without going below NBUF buffers. called by kalloc() when it
+// has no free page. returns the number of pages freed.
+int
+bshrink(int n)
+{
+    struct bgroup *g;
+    struct buf *b, *x, *head;
+    struct mcsnode me;
+    char *data;
+    int freed = 0, q;
+
+    // bgrow() calling kalloc() calls us with lrulock held
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+        return 0;
+
+    acquiremcs(&bcache.lrulock, &me);
+again:
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+        head = &bcache.list[q];
+        for (b = head->prev; b != head; b = b->prev) {
+            if (freed == n || bcache.nbuf - BPP < NBUF)
+                goto done;
+            if (b->refcnt != 0 || (g = bclaimgroup(b)) == 0)
+                continue;
+
+            data = (char*)g->buf[0].data;
+            for (x = g->buf; x < g->buf + BPP; x++) {
+                bunhash(x);
+                blistdel(x);
+                x->data = 0;
+            }
+            g->next = bcache.spare;
+            bcache.spare = g;
+            bcache.nbuf -= BPP;
+            kfree(data);
+            kstatinc(KS_BCACHESHRINK);
+            freed++;
+            goto again;     // b was in g
+        }
+    }
+done:
+    releasemcs(&bcache.lrulock, &me);
+    return freed;
+}
+
 void
 binit(void)
+{
+    uint pages, groups, i;
+    char *p;
+    struct mcsnode me;
+
+    initmcslock(&bcache.lrulock, "bcache");
+    for (i = 0; i < 2; i++) {
+        bcache.list[i].prev = &bcache.list[i];
+        bcache.list[i].next = &bcache.list[i];
+    }
+
+    // each group costs its data page and its share of a page of struct bgroups
+    pages = kfreecount() / 100 * BCACHEPCT;
+    groups = pages * PGSIZE / (PGSIZE + sizeof(struct bgroup));
+    if (groups * BPP < NBUF)
+        groups = (NBUF + BPP - 1) / BPP;
+    bcache.target = groups * BPP;
+
+    // about four buffers per bucket
+    for (bcache.nbucket = BKTPP; bcache.nbucket * 4 < bcache.target; bcache.nbucket *= 2)
+        if (bcache.nbucket == NBKTPAGE * BKTPP)
+            break;
+    for (i = 0; i < bcache.nbucket / BKTPP; i++) {
+        if ((p = kalloc()) == 0)
+            panic("binit: buckets");
+        memset(p, 0, PGSIZE);
+        bcache.bucket[i] = (struct bucket*)p;
+    }
+    for (i = 0; i < bcache.nbucket; i++)
+        initlock(&bcache.bucket[i / BKTPP][i % BKTPP].lock, "bcache.bucket");
+
+    acquiremcs(&bcache.lrulock, &me);
+    while (bcache.nbuf < bcache.target)
+        if (!bgrow())
+            break;
+    releasemcs(&bcache.lrulock, &me);
+    if (bcache.nbuf < NBUF)
+        panic("binit: out of memory");
+    cprintf("bcache: %d blocks available in total, %d buckets\n", bcache.nbuf, bcache.nbucket);
+}
+
+// take a reference to b unless bget() is recycling it
+static int
+bgetref(struct buf *b)
+{
+    uint r;
+
+    do {
+        if ((r = b->refcnt) & BRECYCLE)
+            return 0;
+    } while (!__sync_bool_compare_and_swap(&b->refcnt, r, r + 1));
+    return 1;
+}
+
+// look for block blockno on dev in its bucket, taking a reference if found
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
 {
     struct buf *b;
-    int count = 0;
 
-    initlock(&bcache.lock, "bcache");
+    acquire(&bk->lock);
+    for (b = bk->head; b; b = b->hnext) {
+        if (b->dev == dev && b->blockno == blockno && bgetref(b)) {
+            release(&bk->lock);
+            return b;
+        }
+    }
+    release(&bk->lock);
+    return 0;
+}
+
+// lock a buffer found in the cache, noting a re-reference for brelse()
+static struct buf*
+bhit(struct buf *b)
+{
+    kstatinc(KS_BCACHEHIT);
+    acquiresleep(&b->lock);
+    if (b->reref < 0) {
+        // first use of a block read ahead: counts as it coming in
+        b->reref = 0;
+        b->reftick = ticks;
+    } else if (b->queue == BQ_PROBATION && ticks - b->reftick >= BCORRELATE)
+        b->reref = 1;
+    return b;
+}
+
+// claim an unused buffer to recycle: the oldest on probation,
+// else the least recently used protected one. caller holds lrulock.
+static struct buf*
+bvictim(void)
+{
+    struct buf *b, *head;
+    int q;
 
-    // create linked list of buffers
-    bcache.head.prev = &bcache.head;
-    bcache.head.next = &bcache.head;
-    for (b = bcache.buf; b < bcache.buf + NBUF; b++) {
-        b->next = bcache.head.next;
-        b->prev = &bcache.head;
-        initsleeplock(&b->lock, "buffer");
-        bcache.head.next->prev = b;
-        bcache.head.next = b;
-        count++;
+    // envn if refcnt=0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but bot yet committed it.
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+        head = &bcache.list[q];
+        for (b = head->prev; b != head; b = b->prev) {
+            if (b->refcnt != 0 || !__sync_bool_compare_and_swap(&b->refcnt, 0, BRECYCLE))
+                continue;
+            if (b->flags & B_DIRTY) {
+                // in use by the log after all, see above
+                b->refcnt = 0;
+                continue;
+            }
+            return b;
+        }
     }
-    cprintf("bcache: %d blocks available in total\n", count);
+    return 0;
 }
 
 // look through buffer cache for block on device dev
@@ -61,35 +407,50 @@ binit(void)
 static struct buf*
 bget(uint dev, uint blockno)
 {
+    struct bucket *bk = bbucket(dev, blockno);
     struct buf *b;
-
-    acquire(&bcache.lock);
+    struct mcsnode me;
 
     // is the block already cached?
-    for (b = bcache.head.next; b != &bcache.head; b = b->next) {
-        if (b->dev == dev && b->blockno == blockno) {
-            b->refcnt++;
-            release(&bcache.lock);
-            acquiresleep(&b->lock);
-            return b;
-        }
+    if ((b = blookup(bk, dev, blockno)) != 0)
+        return bhit(b);
+
+    acquiremcs(&bcache.lrulock, &me);
+
+    // look again, someone may have read it in between.
+    if ((b = blookup(bk, dev, blockno)) != 0) {
+        releasemcs(&bcache.lrulock, &me);
+        return bhit(b);
     }
 
+    // win back what bshrink() took, once memory is plentiful again
+    if (bcache.nbuf < bcache.target && kfreecount() > BGROWMIN)
+        bgrow();
+
     // not cached; recycle an unused buffer.
-    // envn if refcnt=0, B_DIRTY indicates a buffer is in use
-    // because log.c has modified it but bot yet committed it.
-    for (b = bcache.head.prev; b != &bcache.head; b = b->next) {
-        if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-            b->dev = dev;
-            b->blockno = blockno;
-            b->flags = 0;
-            b->refcnt = 1;
-            release(&bcache.lock);
-            acquiresleep(&b->lock);
-            return b;
-        }
+    while ((b = bvictim()) == 0) {
+        // every buffer is in use; rather than fail, grow past the target.
+        if (!bgrow())
+            panic("bget: no buffers available");
     }
-    panic("bget: no buffers available");
+
+    // move it from its old bucket to the new one
+    // and bring it in on probation
+    bunhash(b);
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->reftick = ticks;
+    b->reref = 0;
+    b->refcnt = 1;
+    bhash(b);
+    blistdel(b);
+    blistadd(b, BQ_PROBATION);
+
+    releasemcs(&bcache.lrulock, &me);
+    kstatinc(KS_BCACHEMISS);
+    acquiresleep(&b->lock);
+    return b;
 }
 
 // return a locked buf with the contents of the indicated block
@@ -101,11 +462,72 @@ bread(uint dev, uint blockno)
 
     b = bget(dev, blockno);
     if ((b->flags & B_VALID) == 0) {
-        iderw(b);
+        blkrw(b);
     }
     return b;
 }
 
+// disk request done callback for breadahead()
+static void
+bdoneahead(struct buf *b)
+{
+    __sync_sub_and_fetch(&b->refcnt, 1);
+}
+
+// start reading the n blocks from blockno into the cache, those that
+// aren't there, without waiting for the disk. the buffers go on probation
+// like any other, and a bread() of one before the disk is done waits for
+// the read.
+void
+breadahead(uint dev, uint blockno, int n)
+{
+    struct buf *b, *run[BRUN];
+    int i, m;
+
+    while (n > 0) {
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+            if ((b = blookup(bbucket(dev, blockno), dev, blockno)) != 0) {
+                // cached already; a reference taken here is not a use
+                __sync_sub_and_fetch(&b->refcnt, 1);
+                continue;
+            }
+            b = bget(dev, blockno);
+            if (b->flags & B_VALID) {
+                brelse(b);
+                continue;
+            }
+            b->reref = -1;
+            run[m++] = b;
+            kstatinc(KS_READAHEAD);
+        }
+        // the request holds a reference on each buffer, which keeps it
+        // from being recycled until bdoneahead() drops it once the data
+        // is in. that can be before blksubmitv() returns, so ours, from
+        // bget(), goes only once the buffer is unlocked.
+        for (i = 0; i < m; i++)
+            __sync_add_and_fetch(&run[i]->refcnt, 1);
+        blksubmitv(run, m, bdoneahead);
+        for (i = 0; i < m; i++) {
+            releasesleep(&run[i]->lock);
+            __sync_sub_and_fetch(&run[i]->refcnt, 1);
+        }
+    }
+}
+
+// read n consecutive blocks into b[0..n), locked as by bread(),
+// those not cached in as few disk commands as possible.
+void
+bread_range(uint dev, uint blockno, int n, struct buf **b)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        b[i] = bget(dev, blockno + i);
+    blksubmitv(b, n, 0);
+    for (i = 0; i < n; i++)
+        blkiowait(b[i]);
+}
+
 // write b's contents to disk, must be locked
 void
 bwrite(struct buf *b)
@@ -113,31 +535,176 @@ bwrite(struct buf *b)
     if (!holdingsleep(&b->lock))
         panic("bwrite");
     b->flags |= B_DIRTY;
-    iderw(b);
+    blkrw(b);
+}
+
+// like bread(), but don't wait for the disk:
+// call biowait() before using the data.
+struct buf*
+bread_async(uint dev, uint blockno)
+{
+    struct buf *b;
+
+    b = bget(dev, blockno);
+    if ((b->flags & B_VALID) == 0)
+        blksubmit(b, 0);
+    return b;
+}
+
+// like bwrite(), but don't wait for the disk:
+// call biowait() before changing the data again or releasing b.
+void
+bwrite_async(struct buf *b)
+{
+    if (!holdingsleep(&b->lock))
+        panic("bwrite_async");
+    b->flags |= B_DIRTY;
+    blksubmit(b, 0);
+}
+
+// start writing n locked buffers, sorted by block number, like
+// bwrite_async(). the disk writes runs of them at consecutive
+// blocks in one command.
+void
+bwritev(struct buf **b, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (!holdingsleep(&b[i]->lock))
+            panic("bwritev");
+        b[i]->flags |= B_DIRTY;
+    }
+    blksubmitv(b, n, 0);
+}
+
+// write n locked buffers for consecutive blocks, like bwrite()
+void
+bwrite_range(struct buf **b, int n)
+{
+    int i;
+
+    bwritev(b, n);
+    for (i = 0; i < n; i++)
+        blkiowait(b[i]);
+}
+
+// wait for the disk request started on b, which must be locked
+void
+biowait(struct buf *b)
+{
+    if (!holdingsleep(&b->lock))
+        panic("biowait");
+    blkiowait(b);
+}
+
+// hit ratio and size, for tuning BCACHEPCT
+void
+bcachedump(void)
+{
+    uint hit, miss;
+
+    hit = kstatread(KS_BCACHEHIT);
+    miss = kstatread(KS_BCACHEMISS);
+    cprintf("bcache: %d buffers (%d KB), %d hits, %d misses", bcache.nbuf, bcache.nbuf / (1024 / BSIZE), hit, miss);
+    // keep hit * 100 in 32 bits
+    while (hit + miss > 0x1000000) {
+        hit >>= 1;
+        miss >>= 1;
+    }
+    if (hit + miss)
+        cprintf(", hit ratio %d%%", hit * 100 / (hit + miss));
+    cprintf("\n");
 }
 
 // release a locked buffer
-// move to the head of MRU list
+// once unused, move it according to the replacement policy, see above
 void
 brelse(struct buf *b)
 {
+    struct buf *x;
+    struct mcsnode me;
+    int reref;
+
     if (!holdingsleep(&b->lock))
         panic("brelse: must hold bcache sleeplock");
 
+    reref = b->reref;
     releasesleep(&b->lock);
 
-    acquire(&bcache.lock);
-    b->refcnt--;
-    if (b->refcnt == 0) {
-        // no one is waiting for it
-        // put it to the front of linked list (LRU)
-        b->next->prev = b->prev;
-        b->prev->next = b->next;
-        b->next = bcache.head.next;
-        b->prev = &bcache.head;
-        bcache.head.next->prev = b;
-        bcache.head.next = b;
-    }
-
-    release(&bcache.lock);
-}
\ No newline at end of file
+    if (__sync_sub_and_fetch(&b->refcnt, 1) == 0) {
+        acquiremcs(&bcache.lrulock, &me);
+        if (bcache.strictlru) {
+            blistdel(b);
+            blistadd(b, BQ_PROBATION);
+        } else if (b->queue == BQ_PROTECTED || reref) {
+            blistdel(b);
+            blistadd(b, BQ_PROTECTED);
+            b->reref = 0;
+            if (bcache.nlist[BQ_PROTECTED] > bcache.nbuf * BPROTPCT / 100) {
+                // make room: the least recently used goes back on probation
+                x = bcache.list[BQ_PROTECTED].prev;
+                blistdel(x);
+                x->reftick = ticks;
+                x->reref = 0;
+                blistadd(x, BQ_PROBATION);
+            }
+        }
+        // probation is a fifo; a release doesn't move the buffer
+        releasemcs(&bcache.lrulock, &me);
+    }
+}
+
+// replacement policy benchmark, run from a process once the file system is up.
+//
+// reads BENCHSCAN data blocks in a sequential scan, several times the size
+// of the cache, which is shrunk to NBUF buffers for the run, and does a
+// path name lookup every BENCHSTRIDE blocks. prints the hits and misses of
+// the lookups and of the whole run, with 2Q and then with strict lru.
+#define BENCHSCAN   4096
+#define BENCHSTRIDE 64
+
+void
+bcachebench(void)
+{
+    extern struct superblock sb;
+    static char *names[2] = { "2q", "lru" };
+    uint target, first, i, h, m, h0, m0, lh, lm;
+    struct inode *ip;
+    int lru;
+
+    if (sb.size == 0) {
+        cprintf("bcachebench: no file system\n");
+        return;
+    }
+
+    // shrink to the minimum, and keep bget() from growing back
+    target = bcache.target;
+    bshrink(bcache.nbuf);
+    bcache.target = bcache.nbuf;
+
+    first = sb.bmapstart + 1;   // data blocks follow the bitmap
+    for (lru = 0; lru < 2; lru++) {
+        bcache.strictlru = lru;
+        h = kstatread(KS_BCACHEHIT);
+        m = kstatread(KS_BCACHEMISS);
+        lh = lm = 0;
+        for (i = 0; i < BENCHSCAN; i++) {
+            brelse(bread(ROOTDEV, first + i % (sb.size - first)));
+            if (i % BENCHSTRIDE == 0) {
+                h0 = kstatread(KS_BCACHEHIT);
+                m0 = kstatread(KS_BCACHEMISS);
+                begin_op();
+                if ((ip = namei("/.")) != 0)
+                    iput(ip);
+                end_op();
+                lh += kstatread(KS_BCACHEHIT) - h0;
+                lm += kstatread(KS_BCACHEMISS) - m0;
+            }
+        }
+        cprintf("bcachebench: %s, %d buffers: lookups %d hits %d misses, all %d hits %d misses\n",
+                names[lru], bcache.nbuf, lh, lm, kstatread(KS_BCACHEHIT) - h, kstatread(KS_BCACHEMISS) - m);
+    }
+    bcache.strictlru = 0;
+    bcache.target = target;
+}
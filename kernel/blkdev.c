@@ -0,0 +1,347 @@
+// block devices: what bio.c sends disk requests to.
+//
+// drivers blkregister() a struct blkdev for each disk, under the device
+// number bio.c uses for it, and the requests for dev go to blkdevs[dev].
+// drivers that don't care which number a disk gets take the first free
+// one with blkalloc(), so disks are numbered in the order main() probes
+// for them: ide, ahci, virtio. memdisk.c takes ROOTDEV from whoever had it.
+//
+// a device's requests wait in one of its blkqueues, ordered by the
+// queue's scheduler, see iosched.c. blkstart() hands them to the driver
+// as the device has room, and the driver calls blkdone() from its
+// interrupt when one is over, then blkstart() for the next. a buffer
+// with a request queued or at the device has B_QUEUED set, and b->bq
+// says which queue, for blkiowait().
+//
+// for a short synchronous read, the interrupt, wakeup and trip through
+// the scheduler can take longer than the disk. so blkrw() first polls a
+// device that can be, spinning for up to POLLUS microseconds, and only
+// then sleeps. the latency of those reads goes in a histogram by how they
+// were seen to finish, printed by ctrl-T; blkpollbench() compares them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+#include "blkdev.h"
+
+#define POLLUS      30      // most microseconds a read polls for
+#define NLATBIN     16      // histogram bins: under 1us, then powers of 2
+#define POLLBENCH   1000    // reads per mode in blkpollbench()
+
+// how a read was seen to finish
+enum {
+    LAT_INTR,       // the interrupt, with polling off or not possible
+    LAT_POLL,       // a poll, or done before there was anything to wait for
+    LAT_POLLINTR,   // the interrupt, during or after polling
+    NLAT
+};
+
+static char *latnames[NLAT] = {
+        [LAT_INTR]      "interrupt",
+        [LAT_POLL]      "polled",
+        [LAT_POLLINTR]  "poll missed",
+};
+
+_Static_assert(__alignof__(struct blkqueue) == CACHELINE, "device queues share cache lines");
+
+static struct blkdev *blkdevs[NBLKDEV];
+static uint blklat[NLAT][NLATBIN];
+int blkpolling = 1;     // whether blkrw() polls
+
+void
+blkqinit(struct blkqueue *bq, char *name, struct iosched *sched, int maxrun, int depth,
+         void (*issue)(struct blkqueue*, struct buf*), void *priv)
+{
+    initlock(&bq->lock, name);
+    ioqinit(&bq->q, sched);
+    bq->maxrun = maxrun;
+    bq->depth = depth;
+    bq->inflight = 0;
+    bq->issue = issue;
+    bq->kick = 0;
+    bq->poll = 0;
+    bq->priv = priv;
+}
+
+// make bd device dev, in place of any it was
+void
+blkregister(uint dev, struct blkdev *bd)
+{
+    if (dev >= NBLKDEV)
+        panic("blkregister");
+    blkdevs[dev] = bd;
+}
+
+// register bd as the first free device number, which is returned;
+// -1 if there is none
+int
+blkalloc(struct blkdev *bd)
+{
+    uint dev;
+
+    for (dev = 0; dev < NBLKDEV; dev++) {
+        if (blkdevs[dev] == 0) {
+            blkdevs[dev] = bd;
+            return dev;
+        }
+    }
+    return -1;
+}
+
+static struct blkqueue*
+blkqueue(uint dev)
+{
+    struct blkdev *bd;
+    struct blkqueue *bq;
+
+    if (dev >= NBLKDEV || (bd = blkdevs[dev]) == 0)
+        panic("blkqueue: no such device");
+    if (bd->nq == 1)
+        return bd->qs;
+    pushcli();
+    bq = &bd->qs[cpuid() % bd->nq];
+    popcli();
+    return bq;
+}
+
+// hand the device requests until it has depth of them or q is empty.
+// caller holds bq->lock
+void
+blkstart(struct blkqueue *bq)
+{
+    struct buf *b;
+    int n;
+
+    for (n = 0; bq->inflight < bq->depth && (b = ioqtake(&bq->q, bq->maxrun)) != 0; n++) {
+        bq->inflight++;
+        bq->issue(bq, b);
+    }
+    if (n > 0 && bq->kick)
+        bq->kick(bq);
+}
+
+// the request for the run starting at b is over: wake its waiters and
+// call the iodone callbacks. caller holds bq->lock
+void
+blkdone(struct blkqueue *bq, struct buf *b)
+{
+    struct buf *next;
+    void (*fn)(struct buf*);
+
+    bq->inflight--;
+    for (; b; b = next) {
+        next = b->qnext;
+        b->qnext = 0;
+        // wake the process waiting for this buf,
+        // the only one, since it holds b->lock.
+        b->flags |= B_VALID;
+        b->flags &= ~(B_DIRTY | B_QUEUED);
+        wake_one(&b->wq);
+        if ((fn = b->iodone) != 0) {
+            b->iodone = 0;
+            fn(b);
+        }
+    }
+}
+
+// queue b unless there is nothing to do or a request
+// for b is on its way already. returns 1 if queued.
+// caller holds bq->lock
+static int
+blkqueueadd(struct blkqueue *bq, struct buf *b, void (*done)(struct buf*))
+{
+    if ((b->flags & B_QUEUED) || (b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+        return 0;
+    b->flags |= B_QUEUED;
+    b->iodone = done;
+    b->bq = bq;
+    ioqadd(&bq->q, b);
+    return 1;
+}
+
+// start syncing b with disk, like blkrw(), without waiting for it.
+// if done isn't 0, the driver calls it with b once the request is over,
+// at interrupt time with the queue's lock held: it must not sleep.
+// returns 0, and doesn't call done, if there is nothing to do or a
+// request for b is already on its way; blkiowait() waits for that one.
+int
+blksubmit(struct buf *b, void (*done)(struct buf*))
+{
+    struct blkqueue *bq = blkqueue(b->dev);
+    int r;
+
+    acquire(&bq->lock);
+    if ((r = blkqueueadd(bq, b, done)) != 0)
+        blkstart(bq);
+    release(&bq->lock);
+    return r;
+}
+
+// blksubmit() n buffers for one device at once, into one queue, so that
+// the first request can cover as many as follow each other on the disk.
+// done, if not 0, is called for every buffer: right away for those with
+// nothing to do or a request on its way already.
+void
+blksubmitv(struct buf **b, int n, void (*done)(struct buf*))
+{
+    struct blkqueue *bq;
+    int i;
+
+    if (n == 0)
+        return;
+    bq = blkqueue(b[0]->dev);
+    acquire(&bq->lock);
+    for (i = 0; i < n; i++)
+        if (!blkqueueadd(bq, b[i], done) && done)
+            done(b[i]);
+    blkstart(bq);
+    release(&bq->lock);
+}
+
+// wait for the request for b, if any, to finish.
+// b->bq is only looked at while b is queued, and b
+// can't be queued again while its owner waits here.
+void
+blkiowait(struct buf *b)
+{
+    struct blkqueue *bq;
+
+    if (!(b->flags & B_QUEUED))
+        return;
+    bq = b->bq;
+    acquire(&bq->lock);
+    while (b->flags & B_QUEUED)
+        waitsleep(&b->wq, &bq->lock, 1);
+    release(&bq->lock);
+}
+
+// wait for the read request for b, polling b's device for up to POLLUS
+// microseconds first if polling is on and the device can be polled.
+// returns how the request was seen to finish, a LAT_ value.
+static int
+blkpollwait(struct buf *b)
+{
+    struct blkqueue *bq;
+    uint khz, t0;
+    int queued;
+
+    if (!(b->flags & B_QUEUED))
+        return LAT_POLL;
+    bq = b->bq;
+    if (!blkpolling || bq->poll == 0 || (khz = tsckhz()) == 0) {
+        blkiowait(b);
+        return LAT_INTR;
+    }
+    t0 = (uint)rdtsc();
+    do {
+        acquire(&bq->lock);
+        if (!(b->flags & B_QUEUED)) {
+            release(&bq->lock);
+            return LAT_POLLINTR;
+        }
+        bq->poll(bq);
+        queued = b->flags & B_QUEUED;
+        release(&bq->lock);
+        if (!queued)
+            return LAT_POLL;
+        pause();
+    } while ((uint)rdtsc() - t0 < POLLUS * (khz / 1000));
+    blkiowait(b);
+    return LAT_POLLINTR;
+}
+
+// count a read that took cycles tsc cycles in blklat[how]
+static void
+blklatadd(int how, uint cycles)
+{
+    uint mhz, us;
+    int bin;
+
+    if ((mhz = tsckhz() / 1000) == 0)
+        return;
+    us = cycles / mhz;
+    for (bin = 0; us > 0 && bin < NLATBIN - 1; bin++)
+        us >>= 1;
+    __sync_fetch_and_add(&blklat[how][bin], 1);
+}
+
+// sync buf with disk
+// if B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID
+// else if B_VALID is not set, read buf from disk, set B_VALID
+void
+blkrw(struct buf *b)
+{
+    uint t0;
+    int how;
+
+    if ((b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+        panic("blkrw: nothing to do");
+
+    if (b->flags & B_DIRTY) {
+        blksubmit(b, 0);
+        blkiowait(b);
+        return;
+    }
+    t0 = (uint)rdtsc();
+    // a readahead of b may be on its way already;
+    // if so, this waits for that one
+    blksubmit(b, 0);
+    how = blkpollwait(b);
+    blklatadd(how, (uint)rdtsc() - t0);
+}
+
+// the read latency histograms
+void
+blkstatdump(void)
+{
+    int i, j;
+
+    cprintf("read latency, us: <1");
+    for (j = 1; j < NLATBIN; j++)
+        cprintf(" %d", 1 << (j - 1));
+    cprintf("+\n");
+    for (i = 0; i < NLAT; i++) {
+        cprintf("%s:", latnames[i]);
+        for (j = 0; j < NLATBIN; j++)
+            cprintf(" %d", blklat[i][j]);
+        cprintf("\n");
+    }
+}
+
+// ROOTDEV's read latency with polling off, then on, bypassing the
+// buffer cache. must be called from a process.
+void
+blkpollbench(void)
+{
+    static struct buf b;
+    static uchar data[BSIZE] __attribute__((__aligned__(BSIZE)));  // dma may not cross 64KB
+    int i, mode, polling;
+
+    initsleeplock(&b.lock, "pollbench");
+    b.dev = ROOTDEV;
+    b.data = data;
+    acquiresleep(&b.lock);
+    polling = blkpolling;
+    for (mode = 0; mode < 2; mode++) {
+        blkpolling = mode;
+        memset(blklat, 0, sizeof(blklat));
+        for (i = 0; i < POLLBENCH; i++) {
+            // strided, so no run of them is a sequential read
+            b.blockno = i * 37 % FSSIZE;
+            b.flags = 0;
+            blkrw(&b);
+        }
+        cprintf("polling %s:\n", mode ? "on" : "off");
+        blkstatdump();
+    }
+    blkpolling = polling;
+    releasesleep(&b.lock);
+}
@@ -0,0 +1,37 @@
+#ifndef AOS_BLKDEV_H
+#define AOS_BLKDEV_H
+
+#define NBLKDEV 8   // block devices, numbered 0 to NBLKDEV-1
+
+// one of a device's hardware queues, see blkdev.c.
+// a request is a run of up to maxrun buffers for consecutive blocks,
+// linked through qnext, as the scheduler of q hands them out; the
+// device works on up to depth of them at once.
+struct blkqueue {
+    struct spinlock lock;   // protects q and the driver state behind it
+    struct ioqueue q;       // requests the device hasn't taken yet
+    int maxrun;
+    int depth;
+    int inflight;           // requests the device is working on
+    // give the run starting at b to the device, lock held.
+    // blkstart() calls it only while inflight < depth.
+    void (*issue)(struct blkqueue*, struct buf *b);
+    // if not 0, called once after a batch of issue()s, lock held:
+    // for devices that are told of new requests separately
+    void (*kick)(struct blkqueue*);
+    // if not 0, finish the requests the device is done with, as its
+    // interrupt would, lock held; returns how many. see blkrw()
+    int (*poll)(struct blkqueue*);
+    void *priv;             // the driver's
+} CACHEALIGNED;
+
+// a disk, as blkregister()ed by its driver. a submitter uses the queue
+// qs[cpu % nq]; disks on one channel, which can't work in parallel,
+// share theirs.
+struct blkdev {
+    char *name;
+    int nq;
+    struct blkqueue *qs;
+};
+
+#endif //AOS_BLKDEV_H
@@ -1,19 +1,36 @@
 #ifndef AOS_BUF_H
 #define AOS_BUF_H
 
+#define NQLEVEL 8   // levels of the disk queue's skip list, see iosched.c
+
+// the metadata, which every bget() scans, is kept apart from the block data
+// it points to, so a scan touches one or two cache lines per buffer
+// rather than pulling in data.
 struct buf {
     int flags;
     uint dev;
     uint blockno;
     struct sleeplock lock;
     uint refcnt;
-    struct buf *prev;   // LRU cache list
+    struct buf *prev;   // replacement list, see bio.c
     struct buf *next;
-    struct buf *qnext;  // disk queue
-    uchar data[BSIZE];
-};
+    int queue;          // which replacement list: BQ_PROBATION or BQ_PROTECTED
+    uint reftick;       // ticks when last brought in or demoted to probation
+    int reref;          // re-referenced since, after the correlation period;
+                        // -1 if read ahead and not used yet
+    struct buf *hnext;  // hash bucket chain
+    struct buf *qnext;  // disk queue, in arrival order; then the command in progress
+    struct buf *qprev;
+    struct buf *qsorted[NQLEVEL];   // disk queue, in block order
+    uint qdeadline;     // ticks by which the request should have gone to disk
+    struct waitq wq;    // process waiting for the disk request, see blkrw()
+    void (*iodone)(struct buf*);    // called by the disk interrupt when the request is over
+    struct blkqueue *bq;    // device queue the request went to
+    uchar *data;        // BSIZE bytes
+} CACHEALIGNED;
 
 #define B_VALID 0x2 // buffer has been read from disk
 #define B_DIRTY 004 // buffer needs to be written to disk
+#define B_QUEUED 0x8    // on the disk queue
 
 #endif //AOS_BUF_H
@@ -85,7 +85,7 @@ struct {
 void
 consoleintr(int (*getc)(void))
 {
-    int c, doprocdump = 0;
+    int c, doprocdump = 0, dolockstat = 0, dokstat = 0;
 
     acquire(&cons.lock);
     while ((c = getc()) >= 0) {
@@ -95,6 +95,15 @@ consoleintr(int (*getc)(void))
                 // procdump() locks cons.lock indirectly; invoke later
                 doprocdump = 1;
                 break;
+            // lock contention statistics
+            case C('L'):
+                // lockstatdump() prints, which takes cons.lock; invoke later
+                dolockstat = 1;
+                break;
+            // per-cpu event counters
+            case C('T'):
+                dokstat = 1;
+                break;
             // kill line
             case C('U'):
                 while (input.buf[(input.e - 1) % INPUT_BUF] != '\n') {
@@ -126,6 +135,10 @@ consoleintr(int (*getc)(void))
     if(doprocdump) {
 //        procdump();  // now call procdump() wo. cons.lock held
     }
+    if (dolockstat)
+        lockstatdump();
+    if (dokstat)
+        kstatdump();
 }
 
 void
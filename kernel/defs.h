@@ -1,27 +1,68 @@
 #ifndef AOS_DEFS_H
 #define AOS_DEFS_H
 
+struct blkdev;
+struct blkqueue;
 struct buf;
 struct context;
 struct file;
 struct inode;
+struct ioqueue;
+struct iosched;
+struct pcidev;
 struct pipe;
 struct proc;
+struct rcuhead;
 struct rtcdate;
+struct lockstat;
 struct spinlock;
+struct mcslock;
+struct mcsnode;
+struct rwlock;
+struct seqlock;
 struct sleeplock;
+struct waitq;
 struct stat;
 struct superblock;
+struct trapframe;
 struct file;
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
 
+// ahci.c
+void            ahciinit(void);
+void            ahciintr(void);
+
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
+int             bshrink(int);
+void            bcachedump(void);
+void            bcachebench(void);
 void            bwrite(struct buf*);
+void            breadahead(uint, uint, int);
+void            bread_range(uint, uint, int, struct buf**);
+void            bwrite_range(struct buf**, int);
+struct buf*     bread_async(uint, uint);
+void            bwrite_async(struct buf*);
+void            bwritev(struct buf**, int);
+void            biowait(struct buf*);
+
+// blkdev.c
+void            blkqinit(struct blkqueue*, char*, struct iosched*, int, int,
+                         void (*)(struct blkqueue*, struct buf*), void*);
+void            blkregister(uint, struct blkdev*);
+int             blkalloc(struct blkdev*);
+void            blkstart(struct blkqueue*);
+void            blkdone(struct blkqueue*, struct buf*);
+int             blksubmit(struct buf*, void (*)(struct buf*));
+void            blksubmitv(struct buf**, int, void (*)(struct buf*));
+void            blkiowait(struct buf*);
+void            blkrw(struct buf*);
+void            blkstatdump(void);
+void            blkpollbench(void);
 
 // cga.c
 void            cgainit();
@@ -61,20 +102,38 @@ int             writei(struct inode*, char*, uint, uint);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 
+// fpu.c
+void            fpuinit(void);
+void            fpuinitstate(struct proc*);
+void            fpuenter(struct proc*);
+void            fpuleave(struct proc*);
+void            fputrap(struct trapframe*);
+int             kernel_fpu_begin(void);
+void            kernel_fpu_end(void);
+void*           ssememmove(void*, const void*, uint);
+void            pagezero(void*);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
-void            iderw(struct buf*);
 void            idetest(void);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+void            ioapicenablelevel(int irq, int cpu);
 extern uchar    ioapicid;
+extern uint     ioapiclow;
 void            ioapicinit(void);
 
+// iosched.c
+void            ioqinit(struct ioqueue*, struct iosched*);
+void            ioqadd(struct ioqueue*, struct buf*);
+struct buf*     ioqtake(struct ioqueue*, int);
+
 // kalloc.c
 pde_t*          setupkvm(void);
 char*           kalloc(void);
+uint            kfreecount(void);
 void            kfree(char *);
 void            kinit1(void *, void *);
 void            kinit2(void *, void *);
@@ -91,17 +150,43 @@ void            lapicinit(void);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
+// kstat.c
+void            kstatinc(int);
+uint            kstatread(int);
+void            kstatdump(void);
+
+// lockstat.c
+struct lockstat* lockstatget(char*, uint);
+void            lockstatacquired(struct lockstat*, int, uint64);
+void            lockstatreleased(struct lockstat*, uint64);
+void            lockstatdump(void);
+
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            logflushsoon(void);
+void            logflusher(void) __attribute__((noreturn));
+
+// memdisk.c
+void            memdiskinit(void);
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
 
+// pci.c
+void            pciinit(void);
+uint            pciread(struct pcidev*, uint);
+void            pciwrite(struct pcidev*, uint, uint);
+void            pcienable(struct pcidev*, int);
+struct pcidev*  pcifindclass(uint);
+struct pcidev*  pcifindid(ushort, ushort);
+void            pcisetintr(struct pcidev*, void (*)(void));
+int             pciintr(int);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
@@ -116,6 +201,7 @@ void            sched(void);
 void            yield(void);
 void            sleep(void*, struct spinlock*);
 void            wakeup(void*);
+void            wakeproc(struct proc*, void*);
 int             kill(int pid);
 
 void            userinit(void);
@@ -124,6 +210,8 @@ void            setproc(struct proc*);
 void            exit(void);
 int             growproc(int);
 void            procdump(void);
+void            runinit(char*, uint);
+struct proc*    kthread(char*, void (*)(void));
 
 
 // string.c
@@ -146,24 +234,72 @@ void            acquire(struct spinlock*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+void            initmcslock(struct mcslock*, char*);
+void            acquiremcs(struct mcslock*, struct mcsnode*);
+void            releasemcs(struct mcslock*, struct mcsnode*);
+int             holdingmcs(struct mcslock*);
+void            lockbench(void);
+
+// rcu.c
+void            rcuinit(void);
+void            rcureadlock(void);
+void            rcureadunlock(void);
+void            rcuquiesce(void);
+void            rcuoffline(void);
+void            callrcu(struct rcuhead*, void (*)(struct rcuhead*));
+void            rcusync(void);
+
+// rwlock.c
+void            initrwlock(struct rwlock*, char*);
+void            acquireread(struct rwlock*);
+void            releaseread(struct rwlock*);
+void            acquirewrite(struct rwlock*);
+void            releasewrite(struct rwlock*);
+int             holdingwrite(struct rwlock*);
+
+// seqlock.c
+void            initseqlock(struct seqlock*, char*);
+void            acquireseq(struct seqlock*);
+void            releaseseq(struct seqlock*);
+uint            readseqbegin(struct seqlock*);
+int             readseqretry(struct seqlock*, uint);
 
 // sleeplock.c
+void            initwaitq(struct waitq*);
+void            waitsleep(struct waitq*, struct spinlock*, int);
+int             wake_n(struct waitq*, int);
+int             wake_one(struct waitq*);
+int             wake_all(struct waitq*);
 void            initsleeplock(struct sleeplock*, char*);
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
 
+// syscall.c
+void            syscall(void);
+void            syscallbench(void);
+
 // trap.c
 void            idtinit(void);
 extern uint     ticks;
 void            tvinit(void);
-extern struct spinlock ticklock;
+extern struct spinlock tickslock;
 
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// vdso.c
+void            vdsoinit(void);
+uint            tsckhz(void);
+void            vdsotick(uint);
+void            vdsosetproc(struct proc*);
+
+// virtio.c
+void            virtioinit(void);
+void            virtiointr(void);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -25,7 +25,11 @@ struct inode {
     short nlink;
     uint size;
     uint addrs[NDIRECT + 1];
-};
+
+    uint ranext;        // readahead: block a sequential reader reads next
+    uint raend;         // first block not read ahead yet
+    uint rawin;         // blocks to keep read ahead, 0 if not sequential
+} CACHEALIGNED;             // lockless iget()s change ref atomically
 
 // table mapping major device number to device function
 struct devsw {
@@ -0,0 +1,201 @@
+// Lazy fpu/sse context switching.
+//
+// the fpu registers are not part of struct context. instead each cpu
+// remembers whose state its fpu registers hold (cpu->fpuowner), and the
+// scheduler sets CR0_TS whenever the process it switches to is not that
+// owner. the first fpu/sse instruction the process then executes traps
+// with T_DEVICE, and fputrap() loads the process's saved state. processes
+// that never touch the fpu never pay for saving or restoring it.
+//
+// when a process that may have changed the registers is switched out,
+// fpuleave() saves them to p->fpu but leaves them loaded, so if the
+// process comes back to the same cpu (p->fpucpu) with nobody else having
+// used the fpu there, no trap is needed at all. saving on switch-out
+// rather than on the next owner's trap keeps a process's newest state in
+// memory, so it can move to another cpu.
+//
+// kernel code may use fpu/sse instructions only between kernel_fpu_begin()
+// and kernel_fpu_end(), which save any live process state first and keep
+// interrupts off in between.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+
+static int havefxsr;    // cpus support fxsave/fxrstor and sse
+static int havesse2;
+
+// set up this cpu's fpu. each cpu runs once.
+void
+fpuinit(void)
+{
+    uint edx;
+
+    cpuinfo(1, 0, 0, 0, &edx);
+    havefxsr = (edx & CPUID_FXSR) != 0;
+    havesse2 = havefxsr && (edx & CPUID_SSE2) != 0;
+    if (!havefxsr)
+        return;
+
+    lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE);
+    lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+    asm volatile("fninit");
+    mycpu()->fpuowner = 0;
+    lcr0(rcr0() | CR0_TS);
+}
+
+// initial fpu state for a new process: what fninit would load,
+// with all sse exceptions masked.
+void
+fpuinitstate(struct proc *p)
+{
+    memset(&p->fpu, 0, sizeof(p->fpu));
+    *(ushort*)&p->fpu.fxsave[0] = 0x37F;    // fcw
+    *(uint*)&p->fpu.fxsave[24] = 0x1F80;    // mxcsr
+    p->fpucpu = 0;
+}
+
+// about to run p on this cpu; called by the scheduler with interrupts off.
+void
+fpuenter(struct proc *p)
+{
+    struct cpu *c = mycpu();
+
+    if (!havefxsr)
+        return;
+    if (c->fpuowner == p && p->fpucpu == c)
+        clts();     // the registers still hold p's state
+    else
+        lcr0(rcr0() | CR0_TS);
+}
+
+// p has stopped running on this cpu; called by the scheduler with interrupts off.
+void
+fpuleave(struct proc *p)
+{
+    struct cpu *c = mycpu();
+
+    if (!havefxsr)
+        return;
+    // with CR0_TS clear p was able to change the registers
+    if (c->fpuowner == p && (rcr0() & CR0_TS) == 0) {
+        fxsave(&p->fpu);
+        p->fpucpu = c;
+    }
+    lcr0(rcr0() | CR0_TS);
+}
+
+// T_DEVICE: a process executed an fpu/sse instruction with CR0_TS set.
+void
+fputrap(struct trapframe *tf)
+{
+    struct cpu *c;
+    struct proc *p;
+
+    if ((tf->cs & 3) != DPL_USER)
+        panic("fputrap: fpu used in kernel outside kernel_fpu_begin");
+
+    pushcli();
+    c = mycpu();
+    p = c->proc;
+    clts();
+    if (c->fpuowner != p || p->fpucpu != c) {
+        fxrstor(&p->fpu);
+        c->fpuowner = p;
+        p->fpucpu = c;
+    }
+    popcli();
+}
+
+// allow kernel code to use fpu/sse registers until kernel_fpu_end().
+// returns 0, with nothing to undo, if the cpu has no sse2.
+int
+kernel_fpu_begin(void)
+{
+    struct cpu *c;
+
+    if (!havesse2)
+        return 0;
+
+    pushcli();
+    c = mycpu();
+    if (c->kfpu)
+        panic("kernel_fpu_begin: nested");
+    c->kfpu = 1;
+    if (c->fpuowner && (rcr0() & CR0_TS) == 0) {
+        // the owner is running and may have changed the registers
+        clts();
+        fxsave(&c->fpuowner->fpu);
+    }
+    c->fpuowner = 0;    // about to be clobbered
+    clts();
+    return 1;
+}
+
+void
+kernel_fpu_end(void)
+{
+    struct cpu *c = mycpu();
+
+    if (!c->kfpu)
+        panic("kernel_fpu_end");
+    c->kfpu = 0;
+    lcr0(rcr0() | CR0_TS);
+    popcli();
+}
+
+// copy n bytes, 64 at a time through the sse registers where that pays off.
+// the regions must not overlap.
+void*
+ssememmove(void *dst, const void *src, uint n)
+{
+    char *d = dst;
+    const char *s = src;
+
+    if (n < 256 || !kernel_fpu_begin())
+        return memmove(dst, src, n);
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+        asm volatile(
+                "movdqu 0(%1), %%xmm0\n"
+                "movdqu 16(%1), %%xmm1\n"
+                "movdqu 32(%1), %%xmm2\n"
+                "movdqu 48(%1), %%xmm3\n"
+                "movdqu %%xmm0, 0(%0)\n"
+                "movdqu %%xmm1, 16(%0)\n"
+                "movdqu %%xmm2, 32(%0)\n"
+                "movdqu %%xmm3, 48(%0)\n"
+                : : "r" (d), "r" (s) : "memory");
+    }
+    kernel_fpu_end();
+    if (n > 0)
+        memmove(d, s, n);
+    return dst;
+}
+
+// zero a page with non-temporal stores, which keep
+// a page nobody has touched yet out of the cache.
+void
+pagezero(void *pg)
+{
+    char *p = pg, *e = p + PGSIZE;
+
+    if (!kernel_fpu_begin()) {
+        memset(pg, 0, PGSIZE);
+        return;
+    }
+    asm volatile("pxor %%xmm0, %%xmm0" : : );
+    for (; p < e; p += 64) {
+        asm volatile(
+                "movntdq %%xmm0, 0(%0)\n"
+                "movntdq %%xmm0, 16(%0)\n"
+                "movntdq %%xmm0, 32(%0)\n"
+                "movntdq %%xmm0, 48(%0)\n"
+                : : "r" (p) : "memory");
+    }
+    asm volatile("sfence" ::: "memory");
+    kernel_fpu_end();
+}
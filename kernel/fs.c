@@ -6,6 +6,7 @@
 #include "proc.h"
 #include "spinlock.h"
 #include "sleeplock.h"
+#include "rcu.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
@@ -133,14 +134,22 @@ bfree(int dev, uint b)
 // is free, and ip->dev and ip->num indicate which i-node an entry holds, one must hold icahce.lock while using
 // any of those fields
 //
+// most iget() calls find the inode already cached, so iget() first looks without icache.lock, inside an rcu
+// read section. entries are recycled in place, never freed, so a lockless lookup can't see a stale pointer,
+// only an entry changing identity under it: it takes a reference with an atomic increment that fails at
+// ref 0, then checks dev and inum again. icache.lock is still needed to recycle an entry, which happens only
+// at ref 0 and publishes ref last, and ref is only ever changed atomically.
+//
 // an i[->lock sleep-lock protects all ip-> fields other than ref, dev, and inum. one must hold ip->lock in order
 // to read or write that inode's ip->valid, ip->size, ip->type, &c.
 */
 
 struct {
-    struct spinlock lock;
+    struct spinlock lock CACHEALIGNED;
     struct inode inode[NINODE];
 } icache;
+_Static_assert(APARTLINES(__typeof__(icache), lock, inode), "icache.inode shares the lock's line");
+_Static_assert(__alignof__(struct inode) == CACHELINE, "inodes share cache lines");
 
 void
 iinit(int dev)
@@ -197,13 +206,31 @@ iupdate(struct inode *ip)
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     dip->type = ip->type;
     dip->major = ip->major;
-    dip->minor = ip->nlink;
+    dip->minor = ip->minor;
+    dip->nlink = ip->nlink;
     dip->size = ip->size;
     memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
     log_write(bp);
     brelse(bp);
 }
 
+// take a reference to ip if it already has one and still holds inode inum on dev.
+static int
+igetref(struct inode *ip, uint dev, uint inum)
+{
+    int r;
+
+    do {
+        if ((r = ip->ref) == 0)
+            return 0;
+    } while (!__sync_bool_compare_and_swap(&ip->ref, r, r + 1));
+    if (ip->dev == dev && ip->inum == inum)
+        return 1;
+    // recycled between the lookup and the increment
+    __sync_fetch_and_sub(&ip->ref, 1);
+    return 0;
+}
+
 // find the inode with number inum on device dev and return the in-memory copy.
 // does not lock the inode and does not read it from disk.
 static struct inode*
@@ -211,13 +238,23 @@ iget(uint dev, uint inum)
 {
     struct inode *ip, *empty;
 
-    acquire(&icache.lock);
+    // is the inode already cached?
+    rcureadlock();
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+        if (ip->dev == dev && ip->inum == inum && igetref(ip, dev, inum)) {
+            rcureadunlock();
+            return ip;
+        }
+    }
+    rcureadunlock();
 
-    // is the lock already cached?
+    // look again with the lock held,
+    // someone may have cached it in between.
+    acquire(&icache.lock);
     empty = 0;
     for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
         if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
-            ip->ref++;
+            __sync_fetch_and_add(&ip->ref, 1);
             release(&icache.lock);
             return ip;
         }
@@ -232,8 +269,9 @@ iget(uint dev, uint inum)
     ip = empty;
     ip->dev = dev;
     ip->inum = inum;
-    ip->ref = 1;
     ip->valid = 0;
+    __sync_synchronize();
+    ip->ref = 1;    // lockless lookups may take references from here on
     release(&icache.lock);
 
     return ip;
@@ -244,9 +282,7 @@ iget(uint dev, uint inum)
 struct inode*
 idup(struct inode *ip)
 {
-    acquire(&icache.lock);
-    ip->ref++;
-    release(&icache.lock);
+    __sync_fetch_and_add(&ip->ref, 1);
     return ip;
 }
 
@@ -265,11 +301,14 @@ ilock(struct inode *ip)
 
     if (ip->valid == 0) {
         bp = bread(ip->dev, IBLOCK(ip->inum, sb));
-        dip = (struct dinode*)bp->data + ip->inum*IPB;
+        dip = (struct dinode*)bp->data + ip->inum%IPB;
         ip->type = dip->type;
         ip->major = dip->major;
         ip->minor = dip->minor;
-        ip->nlink = dip->size;
+        ip->nlink = dip->nlink;
+        ip->size = dip->size;
+        ip->ranext = 0;
+        ip->rawin = 0;
         memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
         brelse(bp);
         ip->valid = 1;
@@ -358,6 +397,68 @@ bmap(struct inode *ip, uint bn)
     panic("bmap: out of range");
 }
 
+// like bmap, but never allocates: returns 0 for a block not on disk.
+static uint
+bmapnoalloc(struct inode *ip, uint bn)
+{
+    uint addr;
+    struct buf *bp;
+
+    if (bn < NDIRECT)
+        return ip->addrs[bn];
+    bn -= NDIRECT;
+    if (bn >= NINDIRECT || (addr = ip->addrs[NDIRECT]) == 0)
+        return 0;
+    bp = bread(ip->dev, addr);
+    addr = ((uint*)bp->data)[bn];
+    brelse(bp);
+    return addr;
+}
+
+// sequential readahead.
+// readi() calls readahead() for each block it has read. a read of block
+// ip->ranext, the one after the last read, continues a sequential stream;
+// the stream keeps the next ip->rawin blocks on their way from the disk.
+// once the reader is half a window from ip->raend, the window doubles, up
+// to RAMAX blocks, and the blocks up to the new end are started. any other
+// read ends the stream. the first read of a file starts one.
+#define RAMIN   4       // blocks, on starting a stream
+#define RAMAX   64
+
+static void
+readahead(struct inode *ip, uint bn)
+{
+    uint end, addr, n;
+
+    if (bn != ip->ranext) {
+        ip->rawin = 0;
+        ip->ranext = bn + 1;
+        return;
+    }
+    ip->ranext = bn + 1;
+    if (ip->rawin == 0) {
+        ip->rawin = RAMIN;
+        ip->raend = bn + 1;
+    } else if (ip->raend > bn + ip->rawin / 2) {
+        return;     // still well ahead of the reader
+    } else if (ip->rawin < RAMAX) {
+        ip->rawin *= 2;
+    }
+
+    end = (ip->size + BSIZE - 1) / BSIZE;
+    if (bn + 1 + ip->rawin < end)
+        end = bn + 1 + ip->rawin;
+    // a run of blocks that are consecutive on disk goes in one request
+    for (; ip->raend < end; ip->raend += n) {
+        addr = bmapnoalloc(ip, ip->raend);
+        for (n = 1; addr && ip->raend + n < end; n++)
+            if (bmapnoalloc(ip, ip->raend + n) != addr + n)
+                break;
+        if (addr)
+            breadahead(ip->dev, addr, n);
+    }
+}
+
 // truncate inode (discard contents)
 // only called when the inode has no links to it (no directory entries referring to it)
 // and ahs no in-memory reference to it (is not an open file or current directory)
@@ -419,12 +520,17 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 
     if (off > ip->size || off + n < off)
         return -1;
+    if (off + n > ip->size)
+        n = ip->size - off;
 
     for (tot = 0; tot < n; tot += m, off += m, dst += m) {
         bp = bread(ip->dev, bmap(ip, off/BSIZE));
         m = min(n - tot, BSIZE - off%BSIZE);
         memmove(dst, bp->data + off%BSIZE, m);
         brelse(bp);
+        // a block is done with once read to its end
+        if ((off + m) % BSIZE == 0)
+            readahead(ip, off/BSIZE);
     }
     return n;
 }
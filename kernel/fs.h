@@ -31,7 +31,7 @@ struct dinode {
     short minor;    // minor device number (T_DEV only)
     short nlink;    // number of links to inode in file system
     uint size;      // size of file (bytes)
-    uint addrs[NINDIRECT + 1];  // data block addresses
+    uint addrs[NDIRECT + 1];    // data block addresses
 };
 
 // Inodes per block.
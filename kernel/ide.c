@@ -10,39 +10,74 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iosched.h"
+#include "pci.h"
+#include "blkdev.h"
 
 #define SECTOR_SIZE 512
 #define IDE_BUSY    0x80
 #define IDE_DRDY    0x40
 #define IDE_DF      0x20
+#define IDE_DRQ     0x08
 #define IDE_ERR     0x01
 
 #define IDE_CMD_READ    0x20
 #define IDE_CMD_WRITE   0x30
 #define IDE_CMD_RDMUL   0xC4
 #define IDE_CMD_WRMUL   0xC5
+#define IDE_CMD_SETMUL  0xC6
+#define IDE_CMD_RDDMA   0xC8
+#define IDE_CMD_WRDMA   0xCA
 
-// idequeue point to the buf from now being read/write to the disk
-// idequeue->qnext points to the next buf to be processed.
-// you must hold idelock while manipulating queue
+#define IDEMULT     16      // most sectors per read/write multiple command
+#define IDEDMAMAX   32      // most buffers per dma command, at least IDEMULT
 
-static struct spinlock idelock;
+// bus master ide registers, primary channel, from pci bar 4
+#define BM_CMD      0x0
+#define BM_STATUS   0x2
+#define BM_PRDT     0x4     // physical address of the prd table
+#define BM_START    0x01    // BM_CMD: start the transfer
+#define BM_READ     0x08    // BM_CMD: disk to memory
+#define BM_ERR      0x02    // BM_STATUS: transfer failed, write 1 to clear
+#define BM_INTR     0x04    // BM_STATUS: drive interrupted, write 1 to clear
+#define PRD_EOT     0x8000  // last entry of the table
+
+// physical region descriptor: one piece of memory for the dma transfer
+struct prd {
+    uint addr;
+    ushort n;           // bytes
+    ushort flags;
+};
+
+// disks 0 and 1 share the channel, so they share the one queue.
+// idequeue points to the bufs being read/written by the disk now,
+// linked through qnext; ideq.lock protects it.
+
+static struct blkqueue ideq;
+static struct blkdev idedisk[2];
 static struct buf *idequeue;
 
 static int havedisk1;
-static void idestart(struct buf *);
+static int idemult = 1;     // sectors per interrupt, see idesetmult()
+static int iderun;          // buffers in the command in progress
+static ushort idebm;        // bus master registers, 0 to use pio
+
+// the table may not cross a 64KB boundary: aligned to its size, it can't
+static struct prd prdt[IDEDMAMAX] __attribute__((__aligned__(IDEDMAMAX * sizeof(struct prd))));
+static void idestart(struct blkqueue*, struct buf*);
+static int idepoll(struct blkqueue*);
 static struct buf b;
+static uchar bdata[BSIZE] __attribute__((__aligned__(BSIZE)));    // for dma, as bcache pages
 
 void
 idetest()
 {
     b.dev = 1;
+    b.data = bdata;
     initsleeplock(&(b.lock), "ide test");
-    acquire(&idelock);
     acquiresleep(&(b.lock));
-    iderw(&b);
+    blkrw(&b);
     releasesleep(&(b.lock));
-    release(&idelock);
 }
 
 // wait for IDE disk to become ready
@@ -58,12 +93,30 @@ idewait(int checkerr)
     return 0;
 }
 
+// have drive transfer IDEMULT sectors per interrupt in read/write
+// multiple commands. returns the number it will, 1 if it refused.
+static int
+idesetmult(int drive)
+{
+    outb(0x3F6, 2);     // no interrupt
+    outb(0x1F6, 0xE0 | (drive << 4));
+    idewait(0);
+    outb(0x1F2, IDEMULT);
+    outb(0x1F7, IDE_CMD_SETMUL);
+    return idewait(1) < 0 ? 1 : IDEMULT;
+}
+
 void
 ideinit(void)
 {
+    struct pcidev *d;
     int i;
 
-    initlock(&idelock, "ide");
+    // no legacy ide controller, as on qemu's q35: reads of a missing port give all ones
+    if (inb(0x1F7) == 0xFF) {
+        cprintf("ide: no controller\n");
+        return;
+    }
     ioapicenable(IRQ_IDE, ncpu - 1);
     idewait(0);
 
@@ -76,105 +129,164 @@ ideinit(void)
         }
     }
 
+    // runs of blocks go in one command of up to the
+    // number of sectors both disks transfer per interrupt
+    idemult = idesetmult(0);
+    if (havedisk1 && idesetmult(1) < idemult)
+        idemult = 1;
+
     // switch back to disk:0
     outb(0x1F6, 0xE0 | (0 << 4));
 
-    cprintf("disk:1 %sexistence\n", havedisk1 ? "" : "non-");
+    // a pci ide controller with bus mastering, as qemu's piix, lets the
+    // disk move the data itself, rather than the cpu with insl/outsl
+    if ((d = pcifindclass(PCI_IDE)) != 0 && (d->progif & 0x80) && (d->bar[4] & PCI_BAR_IO)) {
+        pcienable(d, 1);
+        idebm = PCI_BAR_IOADDR(d->bar[4]);
+        outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+    }
+
+    // one command at a time, of up to IDEDMAMAX buffers with dma
+    // or what the disks transfer per interrupt without
+    blkqinit(&ideq, "ide", &deadlinesched, idebm ? IDEDMAMAX : idemult / (BSIZE / SECTOR_SIZE), 1, idestart, 0);
+    ideq.poll = idepoll;
+    for (i = 0; i < (havedisk1 ? 2 : 1); i++) {
+        idedisk[i].name = "ide";
+        idedisk[i].nq = 1;
+        idedisk[i].qs = &ideq;
+        blkregister(i, &idedisk[i]);
+    }
+
+    cprintf("disk:1 %sexistence, %s, %s scheduler\n",
+            havedisk1 ? "" : "non-", idebm ? "dma" : "pio", ideq.q.sched->name);
 }
 
-// start the request for b. caller must hold idelock
+// start the run of requests starting at b, the one the scheduler
+// picked and those for the blocks that follow its, going the same way,
+// so that one command and one interrupt do them all.
+// called by blkstart() with ideq.lock held, the disk idle
 static void
-idestart(struct buf *b)
+idestart(struct blkqueue *bq, struct buf *b)
 {
-    if (b == 0)
-        panic("idestart: buf should provide\n");
-    if (b->blockno >= FSSIZE)
-        panic("idestart:incorrect blockno");
-    int sector_per_block = BSIZE/SECTOR_SIZE;
-    int sector = b->blockno * sector_per_block;
-    int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
-    int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+    struct buf *x;
+    int n;
 
+    int sector_per_block = BSIZE/SECTOR_SIZE;
     if (sector_per_block > 7)
         panic("indestart:");
 
+    idequeue = b;
+    int sector = b->blockno * sector_per_block;
+
+    for (n = 0, x = b; x; n++, x = x->qnext)
+        if (x->blockno >= FSSIZE)
+            panic("idestart:incorrect blockno");
+    iderun = n;
+
+    int read_cmd = (n * sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
+    int write_cmd = (n * sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+    if (idebm) {
+        // one prd per buffer. buffer data is BSIZE-aligned, in a bcache
+        // page or a static buffer aligned to match, so it never crosses 64KB
+        for (n = 0, x = b; x; n++, x = x->qnext) {
+            prdt[n].addr = V2P(x->data);
+            prdt[n].n = BSIZE;
+            prdt[n].flags = 0;
+        }
+        prdt[n - 1].flags = PRD_EOT;
+        outl(idebm + BM_PRDT, V2P(prdt));
+        outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+        outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+        read_cmd = IDE_CMD_RDDMA;
+        write_cmd = IDE_CMD_WRDMA;
+    }
+
     idewait(0);
     outb(0x3F6, 0); // generate interrupt
-    outb(0x1F2, sector_per_block);  // number of sectors
+    outb(0x1F2, n * sector_per_block);  // number of sectors
     outb(0x1F3, sector & 0xFF);
     outb(0x1F4, (sector >> 8) & 0xFF);
     outb(0x1F5, (sector >> 16) & 0xFF);
     outb(0x1F6, 0xE0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
-    if(b->flags & B_DIRTY){
+    if (idebm) {
+        outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+        outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+    } else if(b->flags & B_DIRTY){
         outb(0x1f7, write_cmd);
-        outsl(0x1f0, b->data, BSIZE/4);
+        // all n blocks are one drq block
+        while ((inb(0x1F7) & (IDE_BUSY | IDE_DRQ)) != IDE_DRQ)
+            ;
+        for (x = b; n-- > 0; x = x->qnext)
+            outsl(0x1f0, x->data, BSIZE/4);
     } else {
         outb(0x1f7, read_cmd);
     }
 }
 
-// interrupt handler
-void
-ideintr(void)
+// finish the command in progress if the disk is done with it, and start
+// the next. returns 1 if it was done. with polling, the interrupt for a
+// command can come after the next has started, so don't assume it's done.
+// caller holds ideq.lock
+static int
+idefinish(void)
 {
     struct buf *b;
+    int i, r;
 
-    // first queued buffer is the active request.
-    acquire(&idelock);
+    // first queued buffers are the active request.
+    if ((b = idequeue) == 0)
+        return 0;
 
-    if ((b = idequeue) == 0) {
-        release(&idelock);
-        return ;
+    if (idebm) {
+        // the data is in place already; stop the engine
+        if ((inb(idebm + BM_STATUS) & BM_INTR) == 0)
+            return 0;   // not done, or not ours
+        // the buffers can't be marked valid with the data unread,
+        // and there is no way to tell their owners it failed
+        outb(idebm + BM_CMD, 0);
+        // reading the status acks the drive's interrupt
+        if ((inb(idebm + BM_STATUS) & BM_ERR) || idewait(1) < 0)
+            panic("idefinish: dma error");
+        outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+    } else {
+        // a late interrupt, or a poll, can come before the drive has gone
+        // busy with a command just started: a read is done only once its
+        // data is waiting
+        r = inb(0x1F7);
+        if (r & IDE_BUSY)
+            return 0;
+        if (!(b->flags & B_DIRTY)) {
+            if (r & (IDE_DF | IDE_ERR))
+                panic("idefinish: read error");
+            if (!(r & IDE_DRQ))
+                return 0;
+            for (i = 0; i < iderun; i++, b = b->qnext)
+                insl(0x1F0, b->data, BSIZE / 4);
+        }
     }
-    idequeue = b->qnext;
-
-    // read data if need
-    if (!(b->flags & B_DIRTY) && idewait(1) >= 0)
-        insl(0x1F0, b->data, BSIZE / 4);
 
-    // wake process waiting for this buf.
-    b->flags |= B_VALID;
-    b->flags &= !B_DIRTY;
-    wakeup(b);
+    b = idequeue;
+    idequeue = 0;
+    blkdone(&ideq, b);
 
-    // start disk on next buf in queue
-    if (idequeue != 0)
-        idestart(idequeue);
-
-    release(&idelock);
+    // start disk on next request
+    blkstart(&ideq);
+    return 1;
 }
 
-// sync buf with disk
-// if B_DIRTY is set, write buf to disk, clear B_DIRTY, st B_VALID
-// else if B_VALID is not set, read buf from dsk, set B_VALID
+// interrupt handler
 void
-iderw(struct buf *b)
+ideintr(void)
 {
-    struct buf **pp;
-
-//    if (!holdingsleep(&b->lock))
-//        panic("iderw: buf not locked");
-    if ((b->flags & (B_VALID | B_DIRTY)) == B_VALID)
-        panic("iderw: nothing to do");
-    if (b->dev != 0 && !havedisk1)
-        panic("iderw: ide disk:1 not present");
-    acquire(&idelock);
-
-    // append b to idequeue
-    b->qnext = 0;
-
-    for (pp = &idequeue; *pp; pp = &(*pp)->qnext)
-        ;
-    *pp = b;
-
-    // start disk if necessary
-    if (idequeue == b)
-        idestart(b);
-
-    // wait for request to finish
-    while ((b->flags & (B_VALID | B_DIRTY)) != B_DIRTY) {
-        sleep(b, &idelock);
-    }
+    acquire(&ideq.lock);
+    idefinish();
+    release(&ideq.lock);
+}
 
-    release(&idelock);
-}
\ No newline at end of file
+// blkrw()'s poll of the status for a read, instead of the interrupt
+static int
+idepoll(struct blkqueue *bq)
+{
+    return idefinish();
+}
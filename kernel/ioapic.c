@@ -66,4 +66,17 @@ ioapicenable(int irq, int cpunum)
     // which happens to be that cpu's APIC ID.
     ioapicwrite(REG_TABLE + 2 * irq, T_IRQ0 + irq);
     ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
-}
\ No newline at end of file
+}
+
+// the same for a shared, level-triggered line, as a pci device's.
+// the line stays asserted until every device on it has been acked,
+// so its handlers must ack before lapiceoi(), or it fires again.
+void
+ioapicenablelevel(int irq, int cpunum)
+{
+    uint pol;
+
+    pol = (irq < 32 && (ioapiclow & (1U << irq))) ? INT_ACTIVELOW : 0;
+    ioapicwrite(REG_TABLE + 2 * irq, INT_LEVEL | pol | (T_IRQ0 + irq));
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+}
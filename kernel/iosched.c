@@ -0,0 +1,234 @@
+// disk request schedulers.
+//
+// fifosched serves requests in arrival order.
+//
+// deadlinesched serves them in C-LOOK order: in increasing block order
+// from where the last request ended, then around again from the lowest
+// block. that keeps the head sweeping one way over the disk instead of
+// seeking back and forth. a request that has waited past its deadline,
+// IOREADEXPIRE ticks for a read and IOWRITEEXPIRE for a write, goes
+// next instead, and the sweep carries on from it, so that requests at
+// one end of the disk can't starve.
+//
+// both take along the requests queued for the blocks that follow the
+// first one's, in the same direction, so that one disk command can do
+// them all. the block order is kept in a skip list: a request goes in
+// and out in O(log n) expected time, and the one after it is a pointer
+// away.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+
+#define IOREADEXPIRE    50      // ticks a read may wait
+#define IOWRITEEXPIRE   500     // ticks a write may wait
+
+void
+ioqinit(struct ioqueue *q, struct iosched *sched)
+{
+    memset(q, 0, sizeof(*q));
+    q->sched = sched;
+    q->seed = 2463534242;
+}
+
+void
+ioqadd(struct ioqueue *q, struct buf *b)
+{
+    q->sched->add(q, b);
+    q->n++;
+}
+
+// remove and return the next run of up to max requests, linked through qnext
+struct buf*
+ioqtake(struct ioqueue *q, int max)
+{
+    struct buf *b, *x;
+
+    if ((b = q->sched->take(q, max)) != 0)
+        for (x = b; x; x = x->qnext)
+            q->n--;
+    return b;
+}
+
+// whether b may go in the same disk command as a, just after it
+static int
+ioqadjacent(struct buf *a, struct buf *b)
+{
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+           (b->flags & B_DIRTY) == (a->flags & B_DIRTY);
+}
+
+static void
+fifoadd(struct ioqueue *q, struct buf *b)
+{
+    b->qnext = 0;
+    b->qprev = q->tail;
+    if (q->tail)
+        q->tail->qnext = b;
+    else
+        q->head = b;
+    q->tail = b;
+}
+
+static void
+fifodel(struct ioqueue *q, struct buf *b)
+{
+    if (b->qprev)
+        b->qprev->qnext = b->qnext;
+    else
+        q->head = b->qnext;
+    if (b->qnext)
+        b->qnext->qprev = b->qprev;
+    else
+        q->tail = b->qprev;
+}
+
+static struct buf*
+fifotake(struct ioqueue *q, int max)
+{
+    struct buf *b, *x;
+    int n;
+
+    if ((b = q->head) == 0)
+        return 0;
+    for (n = 1, x = b; n < max && x->qnext && ioqadjacent(x, x->qnext); n++)
+        x = x->qnext;
+    q->head = x->qnext;
+    if (q->head)
+        q->head->qprev = 0;
+    else
+        q->tail = 0;
+    x->qnext = 0;
+    return b;
+}
+
+struct iosched fifosched = {
+    .name = "fifo",
+    .add = fifoadd,
+    .take = fifotake,
+};
+
+// skip list order: by device, block, then address,
+// which makes every request's place unique.
+static int
+sortbefore(struct buf *a, struct buf *b)
+{
+    if (a->dev != b->dev)
+        return a->dev < b->dev;
+    if (a->blockno != b->blockno)
+        return a->blockno < b->blockno;
+    return (uint)a < (uint)b;
+}
+
+// a random level in [1, NQLEVEL], each one half as likely as the one below
+static int
+sortlevel(struct ioqueue *q)
+{
+    uint x = q->seed;
+    int lvl;
+
+    // xorshift
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    q->seed = x;
+    for (lvl = 1; lvl < NQLEVEL && (x & 1); lvl++)
+        x >>= 1;
+    return lvl;
+}
+
+static void
+sortadd(struct ioqueue *q, struct buf *b)
+{
+    struct buf **fwd, **update[NQLEVEL];
+    int i, lvl;
+
+    fwd = q->sorted;
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+        while (fwd[i] && sortbefore(fwd[i], b))
+            fwd = fwd[i]->qsorted;
+        update[i] = &fwd[i];
+    }
+    lvl = sortlevel(q);
+    for (i = 0; i < lvl; i++) {
+        b->qsorted[i] = *update[i];
+        *update[i] = b;
+    }
+}
+
+// remove b from the skip list. b->qsorted[0] stays valid.
+static void
+sortdel(struct ioqueue *q, struct buf *b)
+{
+    struct buf **fwd;
+    int i;
+
+    fwd = q->sorted;
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+        while (fwd[i] && sortbefore(fwd[i], b))
+            fwd = fwd[i]->qsorted;
+        if (fwd[i] == b)
+            fwd[i] = b->qsorted[i];
+    }
+}
+
+// the first request at or after the queue's position
+static struct buf*
+sortfind(struct ioqueue *q)
+{
+    struct buf **fwd;
+    int i;
+
+    fwd = q->sorted;
+    for (i = NQLEVEL - 1; i >= 0; i--)
+        while (fwd[i] && (fwd[i]->dev < q->posdev ||
+                          (fwd[i]->dev == q->posdev && fwd[i]->blockno < q->posblock)))
+            fwd = fwd[i]->qsorted;
+    return fwd[0];
+}
+
+static void
+deadlineadd(struct ioqueue *q, struct buf *b)
+{
+    b->qdeadline = ticks + ((b->flags & B_DIRTY) ? IOWRITEEXPIRE : IOREADEXPIRE);
+    fifoadd(q, b);
+    sortadd(q, b);
+}
+
+static struct buf*
+deadlinetake(struct ioqueue *q, int max)
+{
+    struct buf *b, *x, *next;
+    int n;
+
+    if ((b = q->head) == 0)
+        return 0;
+    // the oldest request if it's late, else on with the sweep
+    if ((int)(ticks - b->qdeadline) < 0 && (b = sortfind(q)) == 0)
+        b = q->sorted[0];
+
+    for (n = 1, x = b; ; n++) {
+        next = x->qsorted[0];
+        sortdel(q, x);
+        fifodel(q, x);
+        if (n == max || next == 0 || !ioqadjacent(x, next))
+            break;
+        x->qnext = next;
+        x = next;
+    }
+    x->qnext = 0;
+    q->posdev = x->dev;
+    q->posblock = x->blockno + 1;
+    return b;
+}
+
+struct iosched deadlinesched = {
+    .name = "deadline",
+    .add = deadlineadd,
+    .take = deadlinetake,
+};
@@ -0,0 +1,29 @@
+#ifndef AOS_IOSCHED_H
+#define AOS_IOSCHED_H
+
+// a queue of requests waiting for a disk, see iosched.c.
+// the lock of the blkqueue it is in protects it, see blkdev.h.
+struct ioqueue {
+    struct iosched *sched;
+    int n;                  // requests queued
+    struct buf *head;       // in arrival order, through qnext/qprev
+    struct buf *tail;
+    struct buf *sorted[NQLEVEL];    // skip list in block order, through qsorted[]
+    uint posdev;            // just past the last request taken
+    uint posblock;
+    uint seed;              // for skip list levels
+};
+
+// a request scheduler: the order a queue's requests go to the disk in
+struct iosched {
+    char *name;
+    void (*add)(struct ioqueue*, struct buf*);
+    // remove and return the next run of up to max requests for
+    // consecutive blocks, linked through qnext; 0 if none.
+    struct buf *(*take)(struct ioqueue*, int max);
+};
+
+extern struct iosched fifosched;
+extern struct iosched deadlinesched;
+
+#endif //AOS_IOSCHED_H
@@ -4,6 +4,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "kstat.h"
 
 void freerange(void *vstart, void *vend);
 
@@ -15,11 +16,16 @@ struct run {
     struct run *next;
 };
 
+#define BSHRINK     16  // buffer cache pages to reclaim when out of memory
+
 struct {
-    struct spinlock lock;
-    int use_lock;
+    struct mcslock lock CACHEALIGNED;
+    int use_lock CACHEALIGNED;
     struct run *freelist;
+    uint nfree;         // pages on freelist
 } kmem;
+_Static_assert(APARTLINES(__typeof__(kmem), lock, use_lock), "kmem.use_lock shares the lock's line");
+_Static_assert(APARTLINES(__typeof__(kmem), lock, freelist), "kmem.freelist shares the lock's line");
 
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just he pages mapped by entrypgdir on free list.
@@ -27,7 +33,7 @@ struct {
 void
 kinit1(void* vstart, void *vend)
 {
-    initlock(&kmem.lock, "kmem");
+    initmcslock(&kmem.lock, "kmem");
     kmem.use_lock = 0;
     freerange(vstart, vend);
 }
@@ -55,6 +61,7 @@ void
 kfree(char *v)
 {
     struct run *r;
+    struct mcsnode me;
 
     // v should be the start address f a page
     if ((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
@@ -63,14 +70,18 @@ kfree(char *v)
     memset(v, 5, PGSIZE);   // fill with junk
 
     if(kmem.use_lock)
-        acquire(&kmem.lock);
+        acquiremcs(&kmem.lock, &me);
 
     r = (struct run*)v;
     r->next = kmem.freelist;
     kmem.freelist = r;
+    kmem.nfree++;
 
-    if(kmem.use_lock)
-        release(&kmem.lock);
+    // not counted before kinit2(): mpinit() hasn't run, so cpuid() can't work yet.
+    if(kmem.use_lock) {
+        releasemcs(&kmem.lock, &me);
+        kstatinc(KS_KFREE);
+    }
 }
 
 // allocate one page of physical memory
@@ -78,15 +89,36 @@ char *
 kalloc(void)
 {
     struct run *r;
+    struct mcsnode me;
 
+again:
     if(kmem.use_lock)
-        acquire(&kmem.lock);
+        acquiremcs(&kmem.lock, &me);
 
     r = kmem.freelist;
-    if (r)
+    if (r) {
         kmem.freelist = r->next;
+        kmem.nfree--;
+    }
 
-    if (kmem.use_lock)
-        release(&kmem.lock);
+    if (kmem.use_lock) {
+        releasemcs(&kmem.lock, &me);
+        if (r) {
+            kstatinc(KS_KALLOC);
+        } else {
+            // out of memory: take pages back from the buffer cache, and
+            // have the blocks pinned there awaiting install written, for later
+            logflushsoon();
+            if (bshrink(BSHRINK))
+                goto again;
+        }
+    }
     return (char*)r;
+}
+
+// number of free pages, for sizing caches; may be stale by the time it returns
+uint
+kfreecount(void)
+{
+    return kmem.nfree;
 }
\ No newline at end of file
@@ -0,0 +1,22437 @@
+
+kernelmemfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 90 e9 1c 80       	mov    $0x801ce990,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 40 ab 10 80       	mov    $0x8010ab40,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80100040:	55                   	push   %ebp
+80100041:	89 e5                	mov    %esp,%ebp
+80100043:	57                   	push   %edi
+80100044:	8b 55 08             	mov    0x8(%ebp),%edx
+80100047:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    if ((int)dst%4 == 0 && n%4 == 0){
+8010004a:	89 d0                	mov    %edx,%eax
+8010004c:	09 c8                	or     %ecx,%eax
+8010004e:	a8 03                	test   $0x3,%al
+80100050:	75 1e                	jne    80100070 <memset+0x30>
+        c &= 0xFF;
+80100052:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+        stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80100056:	c1 e9 02             	shr    $0x2,%ecx
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+    asm volatile("cld; rep stosl" :
+80100059:	89 d7                	mov    %edx,%edi
+8010005b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80100061:	fc                   	cld
+80100062:	f3 ab                	rep stos %eax,%es:(%edi)
+    } else
+        stosb(dst, c, n);
+    return dst;
+}
+80100064:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80100067:	89 d0                	mov    %edx,%eax
+80100069:	c9                   	leave
+8010006a:	c3                   	ret
+8010006b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010006f:	90                   	nop
+    asm volatile("cld; rep stosb" :
+80100070:	8b 45 0c             	mov    0xc(%ebp),%eax
+80100073:	89 d7                	mov    %edx,%edi
+80100075:	fc                   	cld
+80100076:	f3 aa                	rep stos %al,%es:(%edi)
+80100078:	8b 7d fc             	mov    -0x4(%ebp),%edi
+8010007b:	89 d0                	mov    %edx,%eax
+8010007d:	c9                   	leave
+8010007e:	c3                   	ret
+8010007f:	90                   	nop
+
+80100080 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80100080:	55                   	push   %ebp
+80100081:	89 e5                	mov    %esp,%ebp
+80100083:	56                   	push   %esi
+80100084:	53                   	push   %ebx
+80100085:	8b 75 10             	mov    0x10(%ebp),%esi
+80100088:	8b 55 08             	mov    0x8(%ebp),%edx
+8010008b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    const uchar *s1, *s2;
+
+    s1 = v1;
+    s2 = v2;
+
+    while (n-- > 0) {
+8010008e:	85 f6                	test   %esi,%esi
+80100090:	74 2e                	je     801000c0 <memcmp+0x40>
+80100092:	01 c6                	add    %eax,%esi
+80100094:	eb 14                	jmp    801000aa <memcmp+0x2a>
+80100096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010009d:	8d 76 00             	lea    0x0(%esi),%esi
+        if (*s1 != *s2)
+            return *s1 - *s2;
+        s1++;
+        s2++;
+801000a0:	83 c0 01             	add    $0x1,%eax
+        s1++;
+801000a3:	83 c2 01             	add    $0x1,%edx
+    while (n-- > 0) {
+801000a6:	39 f0                	cmp    %esi,%eax
+801000a8:	74 16                	je     801000c0 <memcmp+0x40>
+        if (*s1 != *s2)
+801000aa:	0f b6 0a             	movzbl (%edx),%ecx
+801000ad:	0f b6 18             	movzbl (%eax),%ebx
+801000b0:	38 d9                	cmp    %bl,%cl
+801000b2:	74 ec                	je     801000a0 <memcmp+0x20>
+            return *s1 - *s2;
+801000b4:	0f b6 c1             	movzbl %cl,%eax
+801000b7:	29 d8                	sub    %ebx,%eax
+    }
+
+    return 0;
+}
+801000b9:	5b                   	pop    %ebx
+801000ba:	5e                   	pop    %esi
+801000bb:	5d                   	pop    %ebp
+801000bc:	c3                   	ret
+801000bd:	8d 76 00             	lea    0x0(%esi),%esi
+801000c0:	5b                   	pop    %ebx
+    return 0;
+801000c1:	31 c0                	xor    %eax,%eax
+}
+801000c3:	5e                   	pop    %esi
+801000c4:	5d                   	pop    %ebp
+801000c5:	c3                   	ret
+801000c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801000cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801000d0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, uint n)
+{
+801000d0:	55                   	push   %ebp
+801000d1:	89 e5                	mov    %esp,%ebp
+801000d3:	57                   	push   %edi
+801000d4:	56                   	push   %esi
+801000d5:	8b 55 08             	mov    0x8(%ebp),%edx
+801000d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+801000db:	8b 45 10             	mov    0x10(%ebp),%eax
+    const char *s;
+    char *d;
+
+    s = src;
+    d = dst;
+    if(s < d && s + n > d){
+801000de:	39 d6                	cmp    %edx,%esi
+801000e0:	73 26                	jae    80100108 <memmove+0x38>
+801000e2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+801000e5:	39 ca                	cmp    %ecx,%edx
+801000e7:	73 1f                	jae    80100108 <memmove+0x38>
+        s += n;
+        d += n;
+        while(n-- > 0)
+801000e9:	85 c0                	test   %eax,%eax
+801000eb:	74 0f                	je     801000fc <memmove+0x2c>
+801000ed:	83 e8 01             	sub    $0x1,%eax
+            *--d = *--s;
+801000f0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+801000f4:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+        while(n-- > 0)
+801000f7:	83 e8 01             	sub    $0x1,%eax
+801000fa:	73 f4                	jae    801000f0 <memmove+0x20>
+    } else
+        while(n-- > 0)
+            *d++ = *s++;
+
+    return dst;
+}
+801000fc:	5e                   	pop    %esi
+801000fd:	89 d0                	mov    %edx,%eax
+801000ff:	5f                   	pop    %edi
+80100100:	5d                   	pop    %ebp
+80100101:	c3                   	ret
+80100102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        while(n-- > 0)
+80100108:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+8010010b:	89 d7                	mov    %edx,%edi
+8010010d:	85 c0                	test   %eax,%eax
+8010010f:	74 eb                	je     801000fc <memmove+0x2c>
+80100111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            *d++ = *s++;
+80100118:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+        while(n-- > 0)
+80100119:	39 ce                	cmp    %ecx,%esi
+8010011b:	75 fb                	jne    80100118 <memmove+0x48>
+}
+8010011d:	5e                   	pop    %esi
+8010011e:	89 d0                	mov    %edx,%eax
+80100120:	5f                   	pop    %edi
+80100121:	5d                   	pop    %ebp
+80100122:	c3                   	ret
+80100123:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010012a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100130 <memcpy>:
+
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+    return memmove(dst, src, n);
+80100130:	eb 9e                	jmp    801000d0 <memmove>
+80100132:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100140 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80100140:	55                   	push   %ebp
+80100141:	89 e5                	mov    %esp,%ebp
+80100143:	53                   	push   %ebx
+80100144:	8b 55 10             	mov    0x10(%ebp),%edx
+80100147:	8b 45 08             	mov    0x8(%ebp),%eax
+8010014a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    while(n > 0 && *p && *p == *q)
+8010014d:	85 d2                	test   %edx,%edx
+8010014f:	75 16                	jne    80100167 <strncmp+0x27>
+80100151:	eb 2d                	jmp    80100180 <strncmp+0x40>
+80100153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100157:	90                   	nop
+80100158:	3a 19                	cmp    (%ecx),%bl
+8010015a:	75 12                	jne    8010016e <strncmp+0x2e>
+        n--, p++, q++;
+8010015c:	83 c0 01             	add    $0x1,%eax
+8010015f:	83 c1 01             	add    $0x1,%ecx
+    while(n > 0 && *p && *p == *q)
+80100162:	83 ea 01             	sub    $0x1,%edx
+80100165:	74 19                	je     80100180 <strncmp+0x40>
+80100167:	0f b6 18             	movzbl (%eax),%ebx
+8010016a:	84 db                	test   %bl,%bl
+8010016c:	75 ea                	jne    80100158 <strncmp+0x18>
+    if(n == 0)
+        return 0;
+    return (uchar)*p - (uchar)*q;
+8010016e:	0f b6 00             	movzbl (%eax),%eax
+80100171:	0f b6 11             	movzbl (%ecx),%edx
+}
+80100174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100177:	c9                   	leave
+    return (uchar)*p - (uchar)*q;
+80100178:	29 d0                	sub    %edx,%eax
+}
+8010017a:	c3                   	ret
+8010017b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010017f:	90                   	nop
+80100180:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        return 0;
+80100183:	31 c0                	xor    %eax,%eax
+}
+80100185:	c9                   	leave
+80100186:	c3                   	ret
+80100187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010018e:	66 90                	xchg   %ax,%ax
+
+80100190 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80100190:	55                   	push   %ebp
+80100191:	89 e5                	mov    %esp,%ebp
+80100193:	57                   	push   %edi
+80100194:	56                   	push   %esi
+80100195:	53                   	push   %ebx
+80100196:	8b 75 08             	mov    0x8(%ebp),%esi
+80100199:	8b 55 10             	mov    0x10(%ebp),%edx
+    char *os;
+
+    os = s;
+    while(n-- > 0 && (*s++ = *t++) != 0)
+8010019c:	89 f0                	mov    %esi,%eax
+8010019e:	eb 15                	jmp    801001b5 <strncpy+0x25>
+801001a0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+801001a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801001a7:	83 c0 01             	add    $0x1,%eax
+801001aa:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+801001ae:	88 48 ff             	mov    %cl,-0x1(%eax)
+801001b1:	84 c9                	test   %cl,%cl
+801001b3:	74 13                	je     801001c8 <strncpy+0x38>
+801001b5:	89 d3                	mov    %edx,%ebx
+801001b7:	83 ea 01             	sub    $0x1,%edx
+801001ba:	85 db                	test   %ebx,%ebx
+801001bc:	7f e2                	jg     801001a0 <strncpy+0x10>
+        ;
+    while(n-- > 0)
+        *s++ = 0;
+    return os;
+}
+801001be:	5b                   	pop    %ebx
+801001bf:	89 f0                	mov    %esi,%eax
+801001c1:	5e                   	pop    %esi
+801001c2:	5f                   	pop    %edi
+801001c3:	5d                   	pop    %ebp
+801001c4:	c3                   	ret
+801001c5:	8d 76 00             	lea    0x0(%esi),%esi
+    while(n-- > 0)
+801001c8:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+801001cb:	83 e9 01             	sub    $0x1,%ecx
+801001ce:	85 d2                	test   %edx,%edx
+801001d0:	74 ec                	je     801001be <strncpy+0x2e>
+801001d2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        *s++ = 0;
+801001d8:	83 c0 01             	add    $0x1,%eax
+801001db:	89 ca                	mov    %ecx,%edx
+801001dd:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+    while(n-- > 0)
+801001e1:	29 c2                	sub    %eax,%edx
+801001e3:	85 d2                	test   %edx,%edx
+801001e5:	7f f1                	jg     801001d8 <strncpy+0x48>
+}
+801001e7:	5b                   	pop    %ebx
+801001e8:	89 f0                	mov    %esi,%eax
+801001ea:	5e                   	pop    %esi
+801001eb:	5f                   	pop    %edi
+801001ec:	5d                   	pop    %ebp
+801001ed:	c3                   	ret
+801001ee:	66 90                	xchg   %ax,%ax
+
+801001f0 <safestrcpy>:
+
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801001f0:	55                   	push   %ebp
+801001f1:	89 e5                	mov    %esp,%ebp
+801001f3:	56                   	push   %esi
+801001f4:	53                   	push   %ebx
+801001f5:	8b 55 10             	mov    0x10(%ebp),%edx
+801001f8:	8b 75 08             	mov    0x8(%ebp),%esi
+801001fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+    char *os;
+
+    os = s;
+    if(n <= 0)
+801001fe:	85 d2                	test   %edx,%edx
+80100200:	7e 25                	jle    80100227 <safestrcpy+0x37>
+80100202:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80100206:	89 f2                	mov    %esi,%edx
+80100208:	eb 16                	jmp    80100220 <safestrcpy+0x30>
+8010020a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        return os;
+    while(--n > 0 && (*s++ = *t++) != 0)
+80100210:	0f b6 08             	movzbl (%eax),%ecx
+80100213:	83 c0 01             	add    $0x1,%eax
+80100216:	83 c2 01             	add    $0x1,%edx
+80100219:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010021c:	84 c9                	test   %cl,%cl
+8010021e:	74 04                	je     80100224 <safestrcpy+0x34>
+80100220:	39 d8                	cmp    %ebx,%eax
+80100222:	75 ec                	jne    80100210 <safestrcpy+0x20>
+        ;
+    *s = 0;
+80100224:	c6 02 00             	movb   $0x0,(%edx)
+    return os;
+}
+80100227:	89 f0                	mov    %esi,%eax
+80100229:	5b                   	pop    %ebx
+8010022a:	5e                   	pop    %esi
+8010022b:	5d                   	pop    %ebp
+8010022c:	c3                   	ret
+8010022d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100230 <strlen>:
+
+int
+strlen(const char *s)
+{
+80100230:	55                   	push   %ebp
+    int n;
+
+    for(n = 0; s[n]; n++)
+80100231:	31 c0                	xor    %eax,%eax
+{
+80100233:	89 e5                	mov    %esp,%ebp
+80100235:	8b 55 08             	mov    0x8(%ebp),%edx
+    for(n = 0; s[n]; n++)
+80100238:	80 3a 00             	cmpb   $0x0,(%edx)
+8010023b:	74 0c                	je     80100249 <strlen+0x19>
+8010023d:	8d 76 00             	lea    0x0(%esi),%esi
+80100240:	83 c0 01             	add    $0x1,%eax
+80100243:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80100247:	75 f7                	jne    80100240 <strlen+0x10>
+        ;
+    return n;
+80100249:	5d                   	pop    %ebp
+8010024a:	c3                   	ret
+8010024b:	66 90                	xchg   %ax,%ax
+8010024d:	66 90                	xchg   %ax,%ax
+8010024f:	90                   	nop
+
+80100250 <cgainit>:
+
+uint pos;
+
+void cgainit(void)
+{
+    pos = 0;
+80100250:	c7 05 00 c0 18 80 00 	movl   $0x0,0x8018c000
+80100257:	00 00 00 
+}
+8010025a:	c3                   	ret
+8010025b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010025f:	90                   	nop
+
+80100260 <cgaputc>:
+
+void
+cgaputc(int c)
+{
+80100260:	55                   	push   %ebp
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100261:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100266:	89 e5                	mov    %esp,%ebp
+80100268:	57                   	push   %edi
+80100269:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010026e:	56                   	push   %esi
+8010026f:	89 fa                	mov    %edi,%edx
+80100271:	53                   	push   %ebx
+80100272:	83 ec 0c             	sub    $0xc,%esp
+80100275:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80100278:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100279:	be d5 03 00 00       	mov    $0x3d5,%esi
+8010027e:	89 f2                	mov    %esi,%edx
+80100280:	ec                   	in     (%dx),%al
+80100281:	0f b6 c8             	movzbl %al,%ecx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100284:	89 fa                	mov    %edi,%edx
+80100286:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010028b:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010028c:	89 f2                	mov    %esi,%edx
+8010028e:	ec                   	in     (%dx),%al
+    // Cursor position: col + 80*row.
+    outb(CRTPORT, 14);
+    pos = inb(CRTPORT+1) << 8;
+8010028f:	c1 e1 08             	shl    $0x8,%ecx
+    outb(CRTPORT, 15);
+    pos |= inb(CRTPORT+1);
+80100292:	0f b6 c0             	movzbl %al,%eax
+80100295:	09 c1                	or     %eax,%ecx
+
+    if(c == '\n')
+80100297:	83 fb 0a             	cmp    $0xa,%ebx
+8010029a:	0f 84 e0 00 00 00    	je     80100380 <cgaputc+0x120>
+        pos += CGA_WIDTH - pos % CGA_WIDTH;
+    else if(c == BACKSPACE){
+801002a0:	81 fb 00 01 00 00    	cmp    $0x100,%ebx
+801002a6:	0f 84 bc 00 00 00    	je     80100368 <cgaputc+0x108>
+        if(pos > 0) --pos;
+    } else
+        crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801002ac:	0f b6 db             	movzbl %bl,%ebx
+801002af:	8d 41 01             	lea    0x1(%ecx),%eax
+801002b2:	80 cf 07             	or     $0x7,%bh
+801002b5:	a3 00 c0 18 80       	mov    %eax,0x8018c000
+801002ba:	66 89 9c 09 00 80 0b 	mov    %bx,-0x7ff48000(%ecx,%ecx,1)
+801002c1:	80 
+
+    if(pos < 0 || pos > CGA_HEIGHT * CGA_WIDTH)
+801002c2:	8b 0d 00 c0 18 80    	mov    0x8018c000,%ecx
+801002c8:	81 f9 d0 07 00 00    	cmp    $0x7d0,%ecx
+801002ce:	0f 87 db 00 00 00    	ja     801003af <cgaputc+0x14f>
+        panic("pos under/overflow");
+
+    if((pos/80) >= CGA_HEIGHT - 1){  // Scroll up.
+801002d4:	81 f9 7f 07 00 00    	cmp    $0x77f,%ecx
+801002da:	76 49                	jbe    80100325 <cgaputc+0xc5>
+        memmove(crt, crt + CGA_WIDTH, sizeof(crt[0]) * (CGA_HEIGHT - 2) * CGA_WIDTH);
+801002dc:	83 ec 04             	sub    $0x4,%esp
+801002df:	68 60 0e 00 00       	push   $0xe60
+801002e4:	68 a0 80 0b 80       	push   $0x800b80a0
+801002e9:	68 00 80 0b 80       	push   $0x800b8000
+801002ee:	e8 dd fd ff ff       	call   801000d0 <memmove>
+        pos -= CGA_WIDTH;
+801002f3:	a1 00 c0 18 80       	mov    0x8018c000,%eax
+        memset(crt+pos, 0, sizeof(crt[0])*((CGA_HEIGHT - 1) * CGA_WIDTH - pos));
+801002f8:	ba 80 07 00 00       	mov    $0x780,%edx
+801002fd:	83 c4 0c             	add    $0xc,%esp
+        pos -= CGA_WIDTH;
+80100300:	83 e8 50             	sub    $0x50,%eax
+        memset(crt+pos, 0, sizeof(crt[0])*((CGA_HEIGHT - 1) * CGA_WIDTH - pos));
+80100303:	29 c2                	sub    %eax,%edx
+        pos -= CGA_WIDTH;
+80100305:	a3 00 c0 18 80       	mov    %eax,0x8018c000
+        memset(crt+pos, 0, sizeof(crt[0])*((CGA_HEIGHT - 1) * CGA_WIDTH - pos));
+8010030a:	8d 84 00 00 80 0b 80 	lea    -0x7ff48000(%eax,%eax,1),%eax
+80100311:	01 d2                	add    %edx,%edx
+80100313:	52                   	push   %edx
+80100314:	6a 00                	push   $0x0
+80100316:	50                   	push   %eax
+80100317:	e8 24 fd ff ff       	call   80100040 <memset>
+    }
+
+    outb(CRTPORT, 14);
+    outb(CRTPORT+1, pos>>8);
+8010031c:	8b 0d 00 c0 18 80    	mov    0x8018c000,%ecx
+80100322:	83 c4 10             	add    $0x10,%esp
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100325:	be d4 03 00 00       	mov    $0x3d4,%esi
+8010032a:	b8 0e 00 00 00       	mov    $0xe,%eax
+8010032f:	89 f2                	mov    %esi,%edx
+80100331:	ee                   	out    %al,(%dx)
+80100332:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100337:	89 c8                	mov    %ecx,%eax
+80100339:	c1 e8 08             	shr    $0x8,%eax
+8010033c:	89 da                	mov    %ebx,%edx
+8010033e:	ee                   	out    %al,(%dx)
+8010033f:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100344:	89 f2                	mov    %esi,%edx
+80100346:	ee                   	out    %al,(%dx)
+80100347:	89 c8                	mov    %ecx,%eax
+80100349:	89 da                	mov    %ebx,%edx
+8010034b:	ee                   	out    %al,(%dx)
+    outb(CRTPORT, 15);
+    outb(CRTPORT+1, pos);
+    crt[pos] = ' ' | 0x0700;
+8010034c:	b8 20 07 00 00       	mov    $0x720,%eax
+80100351:	66 89 84 09 00 80 0b 	mov    %ax,-0x7ff48000(%ecx,%ecx,1)
+80100358:	80 
+80100359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010035c:	5b                   	pop    %ebx
+8010035d:	5e                   	pop    %esi
+8010035e:	5f                   	pop    %edi
+8010035f:	5d                   	pop    %ebp
+80100360:	c3                   	ret
+80100361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if(pos > 0) --pos;
+80100368:	85 c9                	test   %ecx,%ecx
+8010036a:	74 34                	je     801003a0 <cgaputc+0x140>
+8010036c:	83 e9 01             	sub    $0x1,%ecx
+8010036f:	89 0d 00 c0 18 80    	mov    %ecx,0x8018c000
+80100375:	e9 4e ff ff ff       	jmp    801002c8 <cgaputc+0x68>
+8010037a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        pos += CGA_WIDTH - pos % CGA_WIDTH;
+80100380:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+80100385:	f7 e1                	mul    %ecx
+80100387:	c1 ea 06             	shr    $0x6,%edx
+8010038a:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+8010038d:	c1 e1 04             	shl    $0x4,%ecx
+80100390:	83 c1 50             	add    $0x50,%ecx
+80100393:	89 0d 00 c0 18 80    	mov    %ecx,0x8018c000
+80100399:	e9 2a ff ff ff       	jmp    801002c8 <cgaputc+0x68>
+8010039e:	66 90                	xchg   %ax,%ax
+    pos |= inb(CRTPORT+1);
+801003a0:	c7 05 00 c0 18 80 00 	movl   $0x0,0x8018c000
+801003a7:	00 00 00 
+801003aa:	e9 76 ff ff ff       	jmp    80100325 <cgaputc+0xc5>
+        panic("pos under/overflow");
+801003af:	83 ec 0c             	sub    $0xc,%esp
+801003b2:	68 c0 ac 10 80       	push   $0x8010acc0
+801003b7:	e8 84 99 00 00       	call   80109d40 <panic>
+801003bc:	66 90                	xchg   %ax,%ax
+801003be:	66 90                	xchg   %ax,%ax
+
+801003c0 <lapicinit>:
+}
+
+void
+lapicinit(void)
+{
+    if (!lapic)
+801003c0:	a1 04 c0 18 80       	mov    0x8018c004,%eax
+801003c5:	85 c0                	test   %eax,%eax
+801003c7:	0f 84 cb 00 00 00    	je     80100498 <lapicinit+0xd8>
+    lapic[index] = value;
+801003cd:	c7 80 f0 00 00 00 3f 	movl   $0x13f,0xf0(%eax)
+801003d4:	01 00 00 
+    lapic[ID];
+801003d7:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+801003da:	c7 80 e0 03 00 00 0b 	movl   $0xb,0x3e0(%eax)
+801003e1:	00 00 00 
+    lapic[ID];
+801003e4:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+801003e7:	c7 80 20 03 00 00 20 	movl   $0x20020,0x320(%eax)
+801003ee:	00 02 00 
+    lapic[ID];
+801003f1:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+801003f4:	c7 80 80 03 00 00 80 	movl   $0x989680,0x380(%eax)
+801003fb:	96 98 00 
+    lapic[ID];
+801003fe:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+80100401:	c7 80 50 03 00 00 00 	movl   $0x10000,0x350(%eax)
+80100408:	00 01 00 
+    lapic[ID];
+8010040b:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+8010040e:	c7 80 60 03 00 00 00 	movl   $0x10000,0x360(%eax)
+80100415:	00 01 00 
+    lapic[ID];
+80100418:	8b 50 20             	mov    0x20(%eax),%edx
+    lapicw(LINT0, MASKED);
+    lapicw(LINT1, MASKED);
+
+    // disable performance counter overflow interrupts on machines that provide that interrupt entry
+    // on machines that provide that interrupt entry
+    if (((lapic[VER] >> 16) & 0xFF) >= 4)
+8010041b:	8b 50 30             	mov    0x30(%eax),%edx
+8010041e:	c1 ea 10             	shr    $0x10,%edx
+80100421:	81 e2 fc 00 00 00    	and    $0xfc,%edx
+80100427:	75 77                	jne    801004a0 <lapicinit+0xe0>
+    lapic[index] = value;
+80100429:	c7 80 70 03 00 00 33 	movl   $0x33,0x370(%eax)
+80100430:	00 00 00 
+    lapic[ID];
+80100433:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+80100436:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010043d:	00 00 00 
+    lapic[ID];
+80100440:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+80100443:	c7 80 80 02 00 00 00 	movl   $0x0,0x280(%eax)
+8010044a:	00 00 00 
+    lapic[ID];
+8010044d:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+80100450:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80100457:	00 00 00 
+    lapic[ID];
+8010045a:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+8010045d:	c7 80 10 03 00 00 00 	movl   $0x0,0x310(%eax)
+80100464:	00 00 00 
+    lapic[ID];
+80100467:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+8010046a:	c7 80 00 03 00 00 00 	movl   $0x88500,0x300(%eax)
+80100471:	85 08 00 
+    lapic[ID];
+80100474:	8b 50 20             	mov    0x20(%eax),%edx
+80100477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010047e:	66 90                	xchg   %ax,%ax
+    lapicw(EOI, 0);
+
+    // send an init level de-assert to synchronise arbitration ID's
+    lapicw(ICRHI, 0);
+    lapicw(ICRLO, BCAST | INIT | LEVEL);
+    while (lapic[ICRLO] & DELIVS)
+80100480:	8b 90 00 03 00 00    	mov    0x300(%eax),%edx
+80100486:	80 e6 10             	and    $0x10,%dh
+80100489:	75 f5                	jne    80100480 <lapicinit+0xc0>
+    lapic[index] = value;
+8010048b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80100492:	00 00 00 
+    lapic[ID];
+80100495:	8b 40 20             	mov    0x20(%eax),%eax
+        ;
+
+    lapicw(TPR, 0);
+}
+80100498:	c3                   	ret
+80100499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    lapic[index] = value;
+801004a0:	c7 80 40 03 00 00 00 	movl   $0x10000,0x340(%eax)
+801004a7:	00 01 00 
+    lapic[ID];
+801004aa:	8b 50 20             	mov    0x20(%eax),%edx
+}
+801004ad:	e9 77 ff ff ff       	jmp    80100429 <lapicinit+0x69>
+801004b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801004c0 <lapicid>:
+
+int
+lapicid(void)
+{
+    if (!lapic)
+801004c0:	a1 04 c0 18 80       	mov    0x8018c004,%eax
+801004c5:	85 c0                	test   %eax,%eax
+801004c7:	74 07                	je     801004d0 <lapicid+0x10>
+        return 0;
+    return lapic[ID] >> 24;
+801004c9:	8b 40 20             	mov    0x20(%eax),%eax
+801004cc:	c1 e8 18             	shr    $0x18,%eax
+801004cf:	c3                   	ret
+        return 0;
+801004d0:	31 c0                	xor    %eax,%eax
+}
+801004d2:	c3                   	ret
+801004d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801004e0 <lapiceoi>:
+
+// acknowledge interrupt
+void
+lapiceoi(void)
+{
+    if (lapic)
+801004e0:	a1 04 c0 18 80       	mov    0x8018c004,%eax
+801004e5:	85 c0                	test   %eax,%eax
+801004e7:	74 0d                	je     801004f6 <lapiceoi+0x16>
+    lapic[index] = value;
+801004e9:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+801004f0:	00 00 00 
+    lapic[ID];
+801004f3:	8b 40 20             	mov    0x20(%eax),%eax
+        lapicw(EOI, 0);
+}
+801004f6:	c3                   	ret
+801004f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004fe:	66 90                	xchg   %ax,%ax
+
+80100500 <microdelay>:
+// on real hardware would want to tune this dynamically
+void
+microdelay(int us)
+{
+    // ???
+}
+80100500:	c3                   	ret
+80100501:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010050f:	90                   	nop
+
+80100510 <lapicstartap>:
+
+// start additional processor running entry code at addr
+// see appendix B of MultiProcessor Specification
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80100510:	55                   	push   %ebp
+80100511:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100516:	ba 70 00 00 00       	mov    $0x70,%edx
+8010051b:	89 e5                	mov    %esp,%ebp
+8010051d:	53                   	push   %ebx
+8010051e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80100521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80100524:	ee                   	out    %al,(%dx)
+80100525:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010052a:	ba 71 00 00 00       	mov    $0x71,%edx
+8010052f:	ee                   	out    %al,(%dx)
+    // and the warm rest vector (DWORD based at 40:67) to point at
+    // the AP startup code prior to the [universal startup algorithm]
+    outb(CMOS_PORT + 0, 0xF);
+    outb(CMOS_PORT + 1, 0x0A);
+    wrv = (ushort*)P2V((0x40 << 4 | 0x67)); // warm reset vector
+    wrv[0] = 0;
+80100530:	31 c0                	xor    %eax,%eax
+    lapic[index] = value;
+80100532:	c1 e3 18             	shl    $0x18,%ebx
+    wrv[0] = 0;
+80100535:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+    wrv[1] = addr >> 4;
+8010053b:	89 c8                	mov    %ecx,%eax
+    // regular hardware is supposed to only accept a STARTUP
+    // when it is in the halted state due to an INIT, So the second
+    // should be ignored, but it is part of the official Intel algorithm
+    for (i = 0; i < 2; i ++) {
+        lapicw(ICRHI, apicid << 24);
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+8010053d:	c1 e9 0c             	shr    $0xc,%ecx
+    lapic[index] = value;
+80100540:	89 da                	mov    %ebx,%edx
+    wrv[1] = addr >> 4;
+80100542:	c1 e8 04             	shr    $0x4,%eax
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+80100545:	80 cd 06             	or     $0x6,%ch
+    wrv[1] = addr >> 4;
+80100548:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+    lapic[index] = value;
+8010054e:	a1 04 c0 18 80       	mov    0x8018c004,%eax
+80100553:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+    lapic[ID];
+80100559:	8b 58 20             	mov    0x20(%eax),%ebx
+    lapic[index] = value;
+8010055c:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+80100563:	c5 00 00 
+    lapic[ID];
+80100566:	8b 58 20             	mov    0x20(%eax),%ebx
+    lapic[index] = value;
+80100569:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+80100570:	85 00 00 
+    lapic[ID];
+80100573:	8b 58 20             	mov    0x20(%eax),%ebx
+    lapic[index] = value;
+80100576:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+    lapic[ID];
+8010057c:	8b 58 20             	mov    0x20(%eax),%ebx
+    lapic[index] = value;
+8010057f:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+    lapic[ID];
+80100585:	8b 58 20             	mov    0x20(%eax),%ebx
+    lapic[index] = value;
+80100588:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+    lapic[ID];
+8010058e:	8b 50 20             	mov    0x20(%eax),%edx
+    lapic[index] = value;
+80100591:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+    lapic[ID];
+80100597:	8b 40 20             	mov    0x20(%eax),%eax
+        microdelay(200);
+    }
+}
+8010059a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010059d:	c9                   	leave
+8010059e:	c3                   	ret
+8010059f:	90                   	nop
+
+801005a0 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate * r)
+{
+801005a0:	55                   	push   %ebp
+801005a1:	31 c0                	xor    %eax,%eax
+801005a3:	ba 70 00 00 00       	mov    $0x70,%edx
+801005a8:	89 e5                	mov    %esp,%ebp
+801005aa:	57                   	push   %edi
+801005ab:	56                   	push   %esi
+801005ac:	53                   	push   %ebx
+801005ad:	83 ec 4c             	sub    $0x4c,%esp
+801005b0:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801005b1:	ba 71 00 00 00       	mov    $0x71,%edx
+801005b6:	ec                   	in     (%dx),%al
+    struct rtcdate t1, t2;
+    int sb, bcd;
+
+    sb = cmos_read((CMOS_STATA) & CMOS_UIP);
+    bcd = (sb & (1 << 2)) == 0;
+801005b7:	83 e0 04             	and    $0x4,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801005ba:	bf 70 00 00 00       	mov    $0x70,%edi
+801005bf:	88 45 b3             	mov    %al,-0x4d(%ebp)
+801005c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801005c8:	31 c0                	xor    %eax,%eax
+801005ca:	89 fa                	mov    %edi,%edx
+801005cc:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801005cd:	b9 71 00 00 00       	mov    $0x71,%ecx
+801005d2:	89 ca                	mov    %ecx,%edx
+801005d4:	ec                   	in     (%dx),%al
+801005d5:	88 45 b7             	mov    %al,-0x49(%ebp)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801005d8:	89 fa                	mov    %edi,%edx
+801005da:	b8 02 00 00 00       	mov    $0x2,%eax
+801005df:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801005e0:	89 ca                	mov    %ecx,%edx
+801005e2:	ec                   	in     (%dx),%al
+801005e3:	88 45 b6             	mov    %al,-0x4a(%ebp)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801005e6:	89 fa                	mov    %edi,%edx
+801005e8:	b8 04 00 00 00       	mov    $0x4,%eax
+801005ed:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801005ee:	89 ca                	mov    %ecx,%edx
+801005f0:	ec                   	in     (%dx),%al
+801005f1:	88 45 b5             	mov    %al,-0x4b(%ebp)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801005f4:	89 fa                	mov    %edi,%edx
+801005f6:	b8 07 00 00 00       	mov    $0x7,%eax
+801005fb:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801005fc:	89 ca                	mov    %ecx,%edx
+801005fe:	ec                   	in     (%dx),%al
+801005ff:	88 45 b4             	mov    %al,-0x4c(%ebp)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100602:	89 fa                	mov    %edi,%edx
+80100604:	b8 08 00 00 00       	mov    $0x8,%eax
+80100609:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010060a:	89 ca                	mov    %ecx,%edx
+8010060c:	ec                   	in     (%dx),%al
+8010060d:	89 c6                	mov    %eax,%esi
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010060f:	89 fa                	mov    %edi,%edx
+80100611:	b8 09 00 00 00       	mov    $0x9,%eax
+80100616:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100617:	89 ca                	mov    %ecx,%edx
+80100619:	ec                   	in     (%dx),%al
+8010061a:	0f b6 d8             	movzbl %al,%ebx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010061d:	89 fa                	mov    %edi,%edx
+8010061f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100624:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100625:	89 ca                	mov    %ecx,%edx
+80100627:	ec                   	in     (%dx),%al
+
+    // make sure CMOS doesn't modify time while we read it
+    for (;;) {
+        fill_rtcdata(&t1);
+        if (cmos_read(CMOS_STATA) & CMOS_UIP)
+80100628:	84 c0                	test   %al,%al
+8010062a:	78 9c                	js     801005c8 <cmostime+0x28>
+    return inb(CMOS_RETURN);
+8010062c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+80100630:	89 f2                	mov    %esi,%edx
+80100632:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+80100635:	0f b6 f2             	movzbl %dl,%esi
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100638:	89 fa                	mov    %edi,%edx
+8010063a:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010063d:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+80100641:	89 75 c8             	mov    %esi,-0x38(%ebp)
+80100644:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80100647:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+8010064b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+8010064e:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+80100652:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+80100655:	31 c0                	xor    %eax,%eax
+80100657:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100658:	89 ca                	mov    %ecx,%edx
+8010065a:	ec                   	in     (%dx),%al
+8010065b:	0f b6 c0             	movzbl %al,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010065e:	89 fa                	mov    %edi,%edx
+80100660:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80100663:	b8 02 00 00 00       	mov    $0x2,%eax
+80100668:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100669:	89 ca                	mov    %ecx,%edx
+8010066b:	ec                   	in     (%dx),%al
+8010066c:	0f b6 c0             	movzbl %al,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010066f:	89 fa                	mov    %edi,%edx
+80100671:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80100674:	b8 04 00 00 00       	mov    $0x4,%eax
+80100679:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010067a:	89 ca                	mov    %ecx,%edx
+8010067c:	ec                   	in     (%dx),%al
+8010067d:	0f b6 c0             	movzbl %al,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100680:	89 fa                	mov    %edi,%edx
+80100682:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80100685:	b8 07 00 00 00       	mov    $0x7,%eax
+8010068a:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010068b:	89 ca                	mov    %ecx,%edx
+8010068d:	ec                   	in     (%dx),%al
+8010068e:	0f b6 c0             	movzbl %al,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100691:	89 fa                	mov    %edi,%edx
+80100693:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80100696:	b8 08 00 00 00       	mov    $0x8,%eax
+8010069b:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010069c:	89 ca                	mov    %ecx,%edx
+8010069e:	ec                   	in     (%dx),%al
+8010069f:	0f b6 c0             	movzbl %al,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801006a2:	89 fa                	mov    %edi,%edx
+801006a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801006a7:	b8 09 00 00 00       	mov    $0x9,%eax
+801006ac:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801006ad:	89 ca                	mov    %ecx,%edx
+801006af:	ec                   	in     (%dx),%al
+801006b0:	0f b6 c0             	movzbl %al,%eax
+            continue;
+        fill_rtcdata(&t2);
+        if (memcmp(&t1, &t2, sizeof t1) == 0)
+801006b3:	83 ec 04             	sub    $0x4,%esp
+    return inb(CMOS_RETURN);
+801006b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if (memcmp(&t1, &t2, sizeof t1) == 0)
+801006b9:	8d 45 d0             	lea    -0x30(%ebp),%eax
+801006bc:	6a 18                	push   $0x18
+801006be:	50                   	push   %eax
+801006bf:	8d 45 b8             	lea    -0x48(%ebp),%eax
+801006c2:	50                   	push   %eax
+801006c3:	e8 b8 f9 ff ff       	call   80100080 <memcmp>
+801006c8:	83 c4 10             	add    $0x10,%esp
+801006cb:	85 c0                	test   %eax,%eax
+801006cd:	0f 85 f5 fe ff ff    	jne    801005c8 <cmostime+0x28>
+            break;
+    }
+
+    // convert
+    if (bcd) {
+801006d3:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+801006d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801006da:	89 f0                	mov    %esi,%eax
+801006dc:	84 c0                	test   %al,%al
+801006de:	75 64                	jne    80100744 <cmostime+0x1a4>
+#define CONV(x) (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xF))
+        CONV(second);
+801006e0:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801006e3:	89 c2                	mov    %eax,%edx
+801006e5:	83 e0 0f             	and    $0xf,%eax
+801006e8:	c1 ea 04             	shr    $0x4,%edx
+801006eb:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801006ee:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801006f1:	89 45 b8             	mov    %eax,-0x48(%ebp)
+        CONV(minute);
+801006f4:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801006f7:	89 c2                	mov    %eax,%edx
+801006f9:	83 e0 0f             	and    $0xf,%eax
+801006fc:	c1 ea 04             	shr    $0x4,%edx
+801006ff:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80100702:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80100705:	89 45 bc             	mov    %eax,-0x44(%ebp)
+        CONV(hour);
+80100708:	8b 45 c0             	mov    -0x40(%ebp),%eax
+8010070b:	89 c2                	mov    %eax,%edx
+8010070d:	83 e0 0f             	and    $0xf,%eax
+80100710:	c1 ea 04             	shr    $0x4,%edx
+80100713:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80100716:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80100719:	89 45 c0             	mov    %eax,-0x40(%ebp)
+        CONV(month);
+8010071c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+8010071f:	89 c2                	mov    %eax,%edx
+80100721:	83 e0 0f             	and    $0xf,%eax
+80100724:	c1 ea 04             	shr    $0x4,%edx
+80100727:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010072a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010072d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+        CONV(year);
+80100730:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80100733:	89 c2                	mov    %eax,%edx
+80100735:	83 e0 0f             	and    $0xf,%eax
+80100738:	c1 ea 04             	shr    $0x4,%edx
+8010073b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010073e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80100741:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef CONV
+    }
+
+    *r = t1;
+80100744:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80100747:	89 03                	mov    %eax,(%ebx)
+80100749:	8b 45 bc             	mov    -0x44(%ebp),%eax
+8010074c:	89 43 04             	mov    %eax,0x4(%ebx)
+8010074f:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80100752:	89 43 08             	mov    %eax,0x8(%ebx)
+80100755:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80100758:	89 43 0c             	mov    %eax,0xc(%ebx)
+8010075b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+8010075e:	89 43 10             	mov    %eax,0x10(%ebx)
+80100761:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80100764:	89 43 14             	mov    %eax,0x14(%ebx)
+    r->year += 2000;
+80100767:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+8010076e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100771:	5b                   	pop    %ebx
+80100772:	5e                   	pop    %esi
+80100773:	5f                   	pop    %edi
+80100774:	5d                   	pop    %ebp
+80100775:	c3                   	ret
+80100776:	66 90                	xchg   %ax,%ax
+80100778:	66 90                	xchg   %ax,%ax
+8010077a:	66 90                	xchg   %ax,%ax
+8010077c:	66 90                	xchg   %ax,%ax
+8010077e:	66 90                	xchg   %ax,%ax
+
+80100780 <ioapicinit>:
+    ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80100780:	55                   	push   %ebp
+80100781:	89 e5                	mov    %esp,%ebp
+80100783:	56                   	push   %esi
+80100784:	53                   	push   %ebx
+    int i, id, maxintr;
+
+    ioapic = (volatile struct ioapic*)IOAPIC;
+80100785:	c7 05 08 c0 18 80 00 	movl   $0xfec00000,0x8018c008
+8010078c:	00 c0 fe 
+    ioapic->reg = reg;
+8010078f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80100796:	00 00 00 
+    return ioapic->data;
+80100799:	8b 15 08 c0 18 80    	mov    0x8018c008,%edx
+8010079f:	8b 72 10             	mov    0x10(%edx),%esi
+    ioapic->reg = reg;
+801007a2:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+    return ioapic->data;
+801007a8:	8b 1d 08 c0 18 80    	mov    0x8018c008,%ebx
+    maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+    id = ioapicread(REG_ID) >> 24;
+    if (id != ioapicid)
+801007ae:	0f b6 15 44 c6 18 80 	movzbl 0x8018c644,%edx
+    maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+801007b5:	c1 ee 10             	shr    $0x10,%esi
+801007b8:	89 f0                	mov    %esi,%eax
+801007ba:	0f b6 f0             	movzbl %al,%esi
+    return ioapic->data;
+801007bd:	8b 43 10             	mov    0x10(%ebx),%eax
+    id = ioapicread(REG_ID) >> 24;
+801007c0:	c1 e8 18             	shr    $0x18,%eax
+    if (id != ioapicid)
+801007c3:	39 c2                	cmp    %eax,%edx
+801007c5:	74 16                	je     801007dd <ioapicinit+0x5d>
+        cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+801007c7:	83 ec 0c             	sub    $0xc,%esp
+801007ca:	68 d4 ac 10 80       	push   $0x8010acd4
+801007cf:	e8 ec 95 00 00       	call   80109dc0 <cprintf>
+    ioapic->reg = reg;
+801007d4:	8b 1d 08 c0 18 80    	mov    0x8018c008,%ebx
+801007da:	83 c4 10             	add    $0x10,%esp
+{
+801007dd:	ba 10 00 00 00       	mov    $0x10,%edx
+801007e2:	31 c0                	xor    %eax,%eax
+801007e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ioapic->reg = reg;
+801007e8:	89 13                	mov    %edx,(%ebx)
+801007ea:	8d 48 20             	lea    0x20(%eax),%ecx
+    ioapic->data = data;
+801007ed:	8b 1d 08 c0 18 80    	mov    0x8018c008,%ebx
+
+    // Mark all interrupts edge-triggered, active high, disable, and not routed to any CPUs
+    for (i = 0; i <= maxintr; i++) {
+801007f3:	83 c0 01             	add    $0x1,%eax
+801007f6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+    ioapic->data = data;
+801007fc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+    ioapic->reg = reg;
+801007ff:	8d 4a 01             	lea    0x1(%edx),%ecx
+    for (i = 0; i <= maxintr; i++) {
+80100802:	83 c2 02             	add    $0x2,%edx
+    ioapic->reg = reg;
+80100805:	89 0b                	mov    %ecx,(%ebx)
+    ioapic->data = data;
+80100807:	8b 1d 08 c0 18 80    	mov    0x8018c008,%ebx
+8010080d:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+    for (i = 0; i <= maxintr; i++) {
+80100814:	39 c6                	cmp    %eax,%esi
+80100816:	7d d0                	jge    801007e8 <ioapicinit+0x68>
+        ioapicwrite(REG_TABLE + 2 * i, INT_DISABLED | (T_IRQ0 + i));
+        ioapicwrite(REG_TABLE + 2 * i + 1, 0);
+    }
+}
+80100818:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010081b:	5b                   	pop    %ebx
+8010081c:	5e                   	pop    %esi
+8010081d:	5d                   	pop    %ebp
+8010081e:	c3                   	ret
+8010081f:	90                   	nop
+
+80100820 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80100820:	55                   	push   %ebp
+    ioapic->reg = reg;
+80100821:	8b 0d 08 c0 18 80    	mov    0x8018c008,%ecx
+{
+80100827:	89 e5                	mov    %esp,%ebp
+80100829:	8b 45 08             	mov    0x8(%ebp),%eax
+    // mark interrupt edge-triggered, active high, enabled and routed to the given cpunum,
+    // which happens to be that cpu's APIC ID.
+    ioapicwrite(REG_TABLE + 2 * irq, T_IRQ0 + irq);
+8010082c:	8d 50 20             	lea    0x20(%eax),%edx
+8010082f:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+    ioapic->reg = reg;
+80100833:	89 01                	mov    %eax,(%ecx)
+    ioapic->data = data;
+80100835:	8b 0d 08 c0 18 80    	mov    0x8018c008,%ecx
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+8010083b:	83 c0 01             	add    $0x1,%eax
+    ioapic->data = data;
+8010083e:	89 51 10             	mov    %edx,0x10(%ecx)
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+80100841:	8b 55 0c             	mov    0xc(%ebp),%edx
+    ioapic->reg = reg;
+80100844:	89 01                	mov    %eax,(%ecx)
+    ioapic->data = data;
+80100846:	a1 08 c0 18 80       	mov    0x8018c008,%eax
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+8010084b:	c1 e2 18             	shl    $0x18,%edx
+    ioapic->data = data;
+8010084e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80100851:	5d                   	pop    %ebp
+80100852:	c3                   	ret
+80100853:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010085a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80100860 <ioapicenablelevel>:
+// the same for a shared, level-triggered line, as a pci device's.
+// the line stays asserted until every device on it has been acked,
+// so its handlers must ack before lapiceoi(), or it fires again.
+void
+ioapicenablelevel(int irq, int cpunum)
+{
+80100860:	55                   	push   %ebp
+80100861:	31 d2                	xor    %edx,%edx
+80100863:	89 e5                	mov    %esp,%ebp
+80100865:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    uint pol;
+
+    pol = (irq < 32 && (ioapiclow & (1U << irq))) ? INT_ACTIVELOW : 0;
+80100868:	83 f9 1f             	cmp    $0x1f,%ecx
+8010086b:	7f 15                	jg     80100882 <ioapicenablelevel+0x22>
+8010086d:	b8 01 00 00 00       	mov    $0x1,%eax
+80100872:	31 d2                	xor    %edx,%edx
+80100874:	d3 e0                	shl    %cl,%eax
+80100876:	23 05 40 c6 18 80    	and    0x8018c640,%eax
+8010087c:	0f 95 c2             	setne  %dl
+8010087f:	c1 e2 0d             	shl    $0xd,%edx
+    ioapicwrite(REG_TABLE + 2 * irq, INT_LEVEL | pol | (T_IRQ0 + irq));
+80100882:	8d 41 20             	lea    0x20(%ecx),%eax
+80100885:	09 d0                	or     %edx,%eax
+80100887:	8d 54 09 10          	lea    0x10(%ecx,%ecx,1),%edx
+    ioapic->reg = reg;
+8010088b:	8b 0d 08 c0 18 80    	mov    0x8018c008,%ecx
+    ioapicwrite(REG_TABLE + 2 * irq, INT_LEVEL | pol | (T_IRQ0 + irq));
+80100891:	80 cc 80             	or     $0x80,%ah
+    ioapic->reg = reg;
+80100894:	89 11                	mov    %edx,(%ecx)
+    ioapic->data = data;
+80100896:	8b 0d 08 c0 18 80    	mov    0x8018c008,%ecx
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+8010089c:	83 c2 01             	add    $0x1,%edx
+    ioapic->data = data;
+8010089f:	89 41 10             	mov    %eax,0x10(%ecx)
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+801008a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    ioapic->reg = reg;
+801008a5:	89 11                	mov    %edx,(%ecx)
+    ioapic->data = data;
+801008a7:	8b 15 08 c0 18 80    	mov    0x8018c008,%edx
+    ioapicwrite(REG_TABLE + 2 * irq + 1, cpunum << 24);
+801008ad:	c1 e0 18             	shl    $0x18,%eax
+    ioapic->data = data;
+801008b0:	89 42 10             	mov    %eax,0x10(%edx)
+}
+801008b3:	5d                   	pop    %ebp
+801008b4:	c3                   	ret
+801008b5:	66 90                	xchg   %ax,%ax
+801008b7:	66 90                	xchg   %ax,%ax
+801008b9:	66 90                	xchg   %ax,%ax
+801008bb:	66 90                	xchg   %ax,%ax
+801008bd:	66 90                	xchg   %ax,%ax
+801008bf:	90                   	nop
+
+801008c0 <pciread>:
+    outl(PCI_DATA, v);
+}
+
+uint
+pciread(struct pcidev *d, uint off)
+{
+801008c0:	55                   	push   %ebp
+801008c1:	89 e5                	mov    %esp,%ebp
+801008c3:	8b 55 08             	mov    0x8(%ebp),%edx
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+801008c6:	8b 02                	mov    (%edx),%eax
+801008c8:	8b 4a 08             	mov    0x8(%edx),%ecx
+801008cb:	8b 52 04             	mov    0x4(%edx),%edx
+801008ce:	c1 e1 08             	shl    $0x8,%ecx
+801008d1:	c1 e0 10             	shl    $0x10,%eax
+801008d4:	09 c8                	or     %ecx,%eax
+801008d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801008d9:	c1 e2 0b             	shl    $0xb,%edx
+801008dc:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+801008e2:	09 c8                	or     %ecx,%eax
+801008e4:	09 d0                	or     %edx,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801008e6:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+801008eb:	0d 00 00 00 80       	or     $0x80000000,%eax
+801008f0:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801008f1:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+801008f6:	ed                   	in     (%dx),%eax
+    return pciconfread(d->bus, d->dev, d->func, off);
+}
+801008f7:	5d                   	pop    %ebp
+801008f8:	c3                   	ret
+801008f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80100900 <pciwrite>:
+
+void
+pciwrite(struct pcidev *d, uint off, uint v)
+{
+80100900:	55                   	push   %ebp
+80100901:	89 e5                	mov    %esp,%ebp
+80100903:	8b 55 08             	mov    0x8(%ebp),%edx
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100906:	8b 02                	mov    (%edx),%eax
+80100908:	8b 4a 08             	mov    0x8(%edx),%ecx
+8010090b:	8b 52 04             	mov    0x4(%edx),%edx
+8010090e:	c1 e1 08             	shl    $0x8,%ecx
+80100911:	c1 e0 10             	shl    $0x10,%eax
+80100914:	09 c8                	or     %ecx,%eax
+80100916:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80100919:	c1 e2 0b             	shl    $0xb,%edx
+8010091c:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+80100922:	09 c8                	or     %ecx,%eax
+80100924:	09 d0                	or     %edx,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100926:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+8010092b:	0d 00 00 00 80       	or     $0x80000000,%eax
+80100930:	ef                   	out    %eax,(%dx)
+80100931:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80100936:	8b 45 10             	mov    0x10(%ebp),%eax
+80100939:	ef                   	out    %eax,(%dx)
+    pciconfwrite(d->bus, d->dev, d->func, off, v);
+}
+8010093a:	5d                   	pop    %ebp
+8010093b:	c3                   	ret
+8010093c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100940 <pcienable>:
+
+// let d decode its i/o and memory bars and, if bm, master the bus
+void
+pcienable(struct pcidev *d, int bm)
+{
+80100940:	55                   	push   %ebp
+80100941:	89 e5                	mov    %esp,%ebp
+80100943:	57                   	push   %edi
+80100944:	56                   	push   %esi
+80100945:	be f8 0c 00 00       	mov    $0xcf8,%esi
+8010094a:	53                   	push   %ebx
+8010094b:	8b 45 08             	mov    0x8(%ebp),%eax
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+8010094e:	8b 08                	mov    (%eax),%ecx
+80100950:	8b 50 08             	mov    0x8(%eax),%edx
+80100953:	8b 40 04             	mov    0x4(%eax),%eax
+80100956:	c1 e2 08             	shl    $0x8,%edx
+80100959:	c1 e1 10             	shl    $0x10,%ecx
+8010095c:	09 d1                	or     %edx,%ecx
+8010095e:	c1 e0 0b             	shl    $0xb,%eax
+80100961:	89 f2                	mov    %esi,%edx
+80100963:	09 c1                	or     %eax,%ecx
+80100965:	81 c9 04 00 00 80    	or     $0x80000004,%ecx
+8010096b:	89 c8                	mov    %ecx,%eax
+8010096d:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010096e:	bb fc 0c 00 00       	mov    $0xcfc,%ebx
+80100973:	89 da                	mov    %ebx,%edx
+80100975:	ed                   	in     (%dx),%eax
+    uint cmd;
+
+    cmd = pciread(d, PCI_CMD) & 0xFFFF;
+80100976:	0f b7 c0             	movzwl %ax,%eax
+    cmd |= PCI_CMD_IO | PCI_CMD_MEM;
+80100979:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010097c:	89 c2                	mov    %eax,%edx
+8010097e:	83 c8 07             	or     $0x7,%eax
+80100981:	83 ca 03             	or     $0x3,%edx
+80100984:	85 ff                	test   %edi,%edi
+80100986:	89 d7                	mov    %edx,%edi
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100988:	89 f2                	mov    %esi,%edx
+8010098a:	0f 45 f8             	cmovne %eax,%edi
+8010098d:	89 c8                	mov    %ecx,%eax
+8010098f:	ef                   	out    %eax,(%dx)
+80100990:	89 f8                	mov    %edi,%eax
+80100992:	89 da                	mov    %ebx,%edx
+80100994:	ef                   	out    %eax,(%dx)
+    if (bm)
+        cmd |= PCI_CMD_BM;
+    pciwrite(d, PCI_CMD, cmd);
+}
+80100995:	5b                   	pop    %ebx
+80100996:	5e                   	pop    %esi
+80100997:	5f                   	pop    %edi
+80100998:	5d                   	pop    %ebp
+80100999:	c3                   	ret
+8010099a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801009a0 <pciinit>:
+            bus, dev, func, d->vendor, d->device, d->class, d->subclass, d->irq);
+}
+
+void
+pciinit(void)
+{
+801009a0:	55                   	push   %ebp
+801009a1:	89 e5                	mov    %esp,%ebp
+801009a3:	57                   	push   %edi
+801009a4:	56                   	push   %esi
+801009a5:	53                   	push   %ebx
+801009a6:	83 ec 3c             	sub    $0x3c,%esp
+    uint dev, func, nfunc, id;
+
+    for (dev = 0; dev < 32; dev++) {
+801009a9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+        nfunc = 1;
+        for (func = 0; func < nfunc; func++) {
+801009b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+        nfunc = 1;
+801009b3:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%ebp)
+        for (func = 0; func < nfunc; func++) {
+801009ba:	31 ff                	xor    %edi,%edi
+801009bc:	c1 e0 0b             	shl    $0xb,%eax
+801009bf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+801009c2:	0d 0c 00 00 80       	or     $0x8000000c,%eax
+801009c7:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+801009ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801009d0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801009d3:	89 fb                	mov    %edi,%ebx
+801009d5:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+801009da:	c1 e3 08             	shl    $0x8,%ebx
+801009dd:	09 c3                	or     %eax,%ebx
+801009df:	89 d8                	mov    %ebx,%eax
+801009e1:	0d 00 00 00 80       	or     $0x80000000,%eax
+801009e6:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801009e7:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+801009ec:	ed                   	in     (%dx),%eax
+801009ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            if ((id = pciconfread(0, dev, func, PCI_ID)) == 0xFFFFFFFF)
+801009f0:	83 f8 ff             	cmp    $0xffffffff,%eax
+801009f3:	0f 84 0a 01 00 00    	je     80100b03 <pciinit+0x163>
+                continue;
+            if (func == 0 && (pciconfread(0, dev, 0, PCI_HDR) & 0x800000))
+801009f9:	85 ff                	test   %edi,%edi
+801009fb:	0f 85 2f 01 00 00    	jne    80100b30 <pciinit+0x190>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100a01:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80100a04:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80100a09:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a0a:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80100a0f:	ed                   	in     (%dx),%eax
+80100a10:	a9 00 00 80 00       	test   $0x800000,%eax
+80100a15:	0f 84 15 01 00 00    	je     80100b30 <pciinit+0x190>
+    if (npcidev == NPCIDEV) {
+80100a1b:	8b 35 80 c0 18 80    	mov    0x8018c080,%esi
+                nfunc = 8;      // multi-function device
+80100a21:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%ebp)
+    if (npcidev == NPCIDEV) {
+80100a28:	83 fe 20             	cmp    $0x20,%esi
+80100a2b:	0f 84 20 01 00 00    	je     80100b51 <pciinit+0x1b1>
+    d = &pcidevs[npcidev++];
+80100a31:	8d 46 01             	lea    0x1(%esi),%eax
+    d->bus = bus;
+80100a34:	6b f6 2c             	imul   $0x2c,%esi,%esi
+    d = &pcidevs[npcidev++];
+80100a37:	a3 80 c0 18 80       	mov    %eax,0x8018c080
+    d->dev = dev;
+80100a3c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    d->bus = bus;
+80100a3f:	c7 86 a0 c0 18 80 00 	movl   $0x0,-0x7fe73f60(%esi)
+80100a46:	00 00 00 
+80100a49:	8d 8e a0 c0 18 80    	lea    -0x7fe73f60(%esi),%ecx
+    d->dev = dev;
+80100a4f:	89 41 04             	mov    %eax,0x4(%ecx)
+    d->device = id >> 16;
+80100a52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    d->func = func;
+80100a55:	89 79 08             	mov    %edi,0x8(%ecx)
+    d->device = id >> 16;
+80100a58:	89 c2                	mov    %eax,%edx
+    d->vendor = id & 0xFFFF;
+80100a5a:	89 41 0c             	mov    %eax,0xc(%ecx)
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100a5d:	89 d8                	mov    %ebx,%eax
+    d->device = id >> 16;
+80100a5f:	c1 ea 10             	shr    $0x10,%edx
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100a62:	0d 08 00 00 80       	or     $0x80000008,%eax
+    d->device = id >> 16;
+80100a67:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100a6a:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80100a6f:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a70:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80100a75:	ed                   	in     (%dx),%eax
+    d->class = class >> 24;
+80100a76:	89 c2                	mov    %eax,%edx
+    d->progif = class >> 8;
+80100a78:	88 61 12             	mov    %ah,0x12(%ecx)
+    d->class = class >> 24;
+80100a7b:	c1 ea 18             	shr    $0x18,%edx
+80100a7e:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80100a81:	88 51 10             	mov    %dl,0x10(%ecx)
+    d->subclass = class >> 16;
+80100a84:	89 c2                	mov    %eax,%edx
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100a86:	89 d8                	mov    %ebx,%eax
+    d->subclass = class >> 16;
+80100a88:	c1 ea 10             	shr    $0x10,%edx
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100a8b:	0d 3c 00 00 80       	or     $0x8000003c,%eax
+    d->subclass = class >> 16;
+80100a90:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80100a93:	88 51 11             	mov    %dl,0x11(%ecx)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100a96:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80100a9b:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a9c:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80100aa1:	ed                   	in     (%dx),%eax
+    d->irq = pciconfread(bus, dev, func, PCI_IRQ);
+80100aa2:	88 41 13             	mov    %al,0x13(%ecx)
+80100aa5:	b9 10 00 00 00       	mov    $0x10,%ecx
+80100aaa:	89 7d d0             	mov    %edi,-0x30(%ebp)
+80100aad:	89 c7                	mov    %eax,%edi
+80100aaf:	90                   	nop
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+80100ab0:	89 c8                	mov    %ecx,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100ab2:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+80100ab7:	09 d8                	or     %ebx,%eax
+80100ab9:	0d 00 00 00 80       	or     $0x80000000,%eax
+80100abe:	ef                   	out    %eax,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100abf:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+80100ac4:	ed                   	in     (%dx),%eax
+        d->bar[i] = pciconfread(bus, dev, func, PCI_BAR0 + 4 * i);
+80100ac5:	89 84 0e a4 c0 18 80 	mov    %eax,-0x7fe73f5c(%esi,%ecx,1)
+    for (i = 0; i < 6; i++)
+80100acc:	83 c1 04             	add    $0x4,%ecx
+80100acf:	83 f9 28             	cmp    $0x28,%ecx
+80100ad2:	75 dc                	jne    80100ab0 <pciinit+0x110>
+    cprintf("pci: %d.%d.%d %x:%x class %x.%x irq %d\n",
+80100ad4:	89 fa                	mov    %edi,%edx
+80100ad6:	83 ec 0c             	sub    $0xc,%esp
+80100ad9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80100adc:	0f b6 d2             	movzbl %dl,%edx
+80100adf:	52                   	push   %edx
+80100ae0:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+80100ae4:	50                   	push   %eax
+80100ae5:	ff 75 d8             	push   -0x28(%ebp)
+80100ae8:	ff 75 dc             	push   -0x24(%ebp)
+80100aeb:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+80100aef:	50                   	push   %eax
+80100af0:	57                   	push   %edi
+80100af1:	ff 75 e0             	push   -0x20(%ebp)
+80100af4:	6a 00                	push   $0x0
+80100af6:	68 2c ad 10 80       	push   $0x8010ad2c
+80100afb:	e8 c0 92 00 00       	call   80109dc0 <cprintf>
+80100b00:	83 c4 30             	add    $0x30,%esp
+        for (func = 0; func < nfunc; func++) {
+80100b03:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80100b06:	83 c7 01             	add    $0x1,%edi
+80100b09:	39 c7                	cmp    %eax,%edi
+80100b0b:	0f 82 bf fe ff ff    	jb     801009d0 <pciinit+0x30>
+    for (dev = 0; dev < 32; dev++) {
+80100b11:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+80100b15:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100b18:	83 f8 20             	cmp    $0x20,%eax
+80100b1b:	0f 85 8f fe ff ff    	jne    801009b0 <pciinit+0x10>
+            pciadd(0, dev, func, id);
+        }
+    }
+}
+80100b21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100b24:	5b                   	pop    %ebx
+80100b25:	5e                   	pop    %esi
+80100b26:	5f                   	pop    %edi
+80100b27:	5d                   	pop    %ebp
+80100b28:	c3                   	ret
+80100b29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (npcidev == NPCIDEV) {
+80100b30:	8b 35 80 c0 18 80    	mov    0x8018c080,%esi
+80100b36:	83 fe 20             	cmp    $0x20,%esi
+80100b39:	0f 85 f2 fe ff ff    	jne    80100a31 <pciinit+0x91>
+        cprintf("pci: too many functions\n");
+80100b3f:	83 ec 0c             	sub    $0xc,%esp
+80100b42:	68 06 ad 10 80       	push   $0x8010ad06
+80100b47:	e8 74 92 00 00       	call   80109dc0 <cprintf>
+        return;
+80100b4c:	83 c4 10             	add    $0x10,%esp
+80100b4f:	eb b2                	jmp    80100b03 <pciinit+0x163>
+        cprintf("pci: too many functions\n");
+80100b51:	83 ec 0c             	sub    $0xc,%esp
+        for (func = 0; func < nfunc; func++) {
+80100b54:	bf 01 00 00 00       	mov    $0x1,%edi
+        cprintf("pci: too many functions\n");
+80100b59:	68 06 ad 10 80       	push   $0x8010ad06
+80100b5e:	e8 5d 92 00 00       	call   80109dc0 <cprintf>
+80100b63:	83 c4 10             	add    $0x10,%esp
+80100b66:	e9 65 fe ff ff       	jmp    801009d0 <pciinit+0x30>
+80100b6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100b6f:	90                   	nop
+
+80100b70 <pcifindclass>:
+
+// the first function of class, as PCI_IDE etc.
+struct pcidev*
+pcifindclass(uint class)
+{
+80100b70:	55                   	push   %ebp
+80100b71:	89 e5                	mov    %esp,%ebp
+80100b73:	53                   	push   %ebx
+    struct pcidev *d;
+
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+80100b74:	6b 0d 80 c0 18 80 2c 	imul   $0x2c,0x8018c080,%ecx
+{
+80100b7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+80100b7e:	81 c1 a0 c0 18 80    	add    $0x8018c0a0,%ecx
+80100b84:	81 f9 a0 c0 18 80    	cmp    $0x8018c0a0,%ecx
+80100b8a:	76 24                	jbe    80100bb0 <pcifindclass+0x40>
+80100b8c:	b8 a0 c0 18 80       	mov    $0x8018c0a0,%eax
+80100b91:	eb 0c                	jmp    80100b9f <pcifindclass+0x2f>
+80100b93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100b97:	90                   	nop
+80100b98:	83 c0 2c             	add    $0x2c,%eax
+80100b9b:	39 c8                	cmp    %ecx,%eax
+80100b9d:	73 11                	jae    80100bb0 <pcifindclass+0x40>
+        if ((d->subclass << 8 | d->class) == class)
+80100b9f:	0f b7 50 10          	movzwl 0x10(%eax),%edx
+80100ba3:	39 da                	cmp    %ebx,%edx
+80100ba5:	75 f1                	jne    80100b98 <pcifindclass+0x28>
+            return d;
+    return 0;
+}
+80100ba7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100baa:	c9                   	leave
+80100bab:	c3                   	ret
+80100bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100bb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80100bb3:	31 c0                	xor    %eax,%eax
+}
+80100bb5:	c9                   	leave
+80100bb6:	c3                   	ret
+80100bb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100bbe:	66 90                	xchg   %ax,%ax
+
+80100bc0 <pcifindid>:
+
+// the first function with the given vendor and device ids
+struct pcidev*
+pcifindid(ushort vendor, ushort device)
+{
+80100bc0:	55                   	push   %ebp
+80100bc1:	89 e5                	mov    %esp,%ebp
+80100bc3:	53                   	push   %ebx
+    struct pcidev *d;
+
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+80100bc4:	6b 15 80 c0 18 80 2c 	imul   $0x2c,0x8018c080,%edx
+{
+80100bcb:	0f b7 4d 08          	movzwl 0x8(%ebp),%ecx
+80100bcf:	0f b7 5d 0c          	movzwl 0xc(%ebp),%ebx
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+80100bd3:	81 c2 a0 c0 18 80    	add    $0x8018c0a0,%edx
+80100bd9:	81 fa a0 c0 18 80    	cmp    $0x8018c0a0,%edx
+80100bdf:	76 2f                	jbe    80100c10 <pcifindid+0x50>
+80100be1:	b8 a0 c0 18 80       	mov    $0x8018c0a0,%eax
+80100be6:	eb 0f                	jmp    80100bf7 <pcifindid+0x37>
+80100be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100bef:	90                   	nop
+80100bf0:	83 c0 2c             	add    $0x2c,%eax
+80100bf3:	39 d0                	cmp    %edx,%eax
+80100bf5:	73 19                	jae    80100c10 <pcifindid+0x50>
+        if (d->vendor == vendor && d->device == device)
+80100bf7:	66 39 48 0c          	cmp    %cx,0xc(%eax)
+80100bfb:	75 f3                	jne    80100bf0 <pcifindid+0x30>
+80100bfd:	66 39 58 0e          	cmp    %bx,0xe(%eax)
+80100c01:	75 ed                	jne    80100bf0 <pcifindid+0x30>
+            return d;
+    return 0;
+}
+80100c03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100c06:	c9                   	leave
+80100c07:	c3                   	ret
+80100c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100c0f:	90                   	nop
+80100c10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80100c13:	31 c0                	xor    %eax,%eax
+}
+80100c15:	c9                   	leave
+80100c16:	c3                   	ret
+80100c17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100c1e:	66 90                	xchg   %ax,%ax
+
+80100c20 <pcisetintr>:
+
+// have trap() call fn for d's interrupts
+void
+pcisetintr(struct pcidev *d, void (*fn)(void))
+{
+80100c20:	55                   	push   %ebp
+80100c21:	89 e5                	mov    %esp,%ebp
+80100c23:	53                   	push   %ebx
+80100c24:	83 ec 04             	sub    $0x4,%esp
+    int i;
+
+    if (npciintr == NPCIINTR)
+80100c27:	8b 15 20 c0 18 80    	mov    0x8018c020,%edx
+{
+80100c2d:	8b 45 08             	mov    0x8(%ebp),%eax
+80100c30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    if (npciintr == NPCIINTR)
+80100c33:	83 fa 08             	cmp    $0x8,%edx
+80100c36:	74 76                	je     80100cae <pcisetintr+0x8e>
+        panic("pcisetintr");
+    for (i = 0; i < npciintr; i++)
+        if (pciintrs[i].irq == d->irq)
+            break;
+    pciintrs[npciintr].irq = d->irq;
+80100c38:	0f b6 48 13          	movzbl 0x13(%eax),%ecx
+    for (i = 0; i < npciintr; i++)
+80100c3c:	31 c0                	xor    %eax,%eax
+80100c3e:	85 d2                	test   %edx,%edx
+80100c40:	7f 0d                	jg     80100c4f <pcisetintr+0x2f>
+80100c42:	eb 14                	jmp    80100c58 <pcisetintr+0x38>
+80100c44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100c48:	83 c0 01             	add    $0x1,%eax
+80100c4b:	39 c2                	cmp    %eax,%edx
+80100c4d:	74 31                	je     80100c80 <pcisetintr+0x60>
+        if (pciintrs[i].irq == d->irq)
+80100c4f:	39 0c c5 40 c0 18 80 	cmp    %ecx,-0x7fe73fc0(,%eax,8)
+80100c56:	75 f0                	jne    80100c48 <pcisetintr+0x28>
+    pciintrs[npciintr].fn = fn;
+80100c58:	89 1c d5 44 c0 18 80 	mov    %ebx,-0x7fe73fbc(,%edx,8)
+    npciintr++;
+80100c5f:	8d 5a 01             	lea    0x1(%edx),%ebx
+    pciintrs[npciintr].irq = d->irq;
+80100c62:	89 0c d5 40 c0 18 80 	mov    %ecx,-0x7fe73fc0(,%edx,8)
+    npciintr++;
+80100c69:	89 1d 20 c0 18 80    	mov    %ebx,0x8018c020
+    if (i == npciintr - 1)  // first handler on the line
+80100c6f:	39 c2                	cmp    %eax,%edx
+80100c71:	74 24                	je     80100c97 <pcisetintr+0x77>
+        ioapicenablelevel(d->irq, ncpu - 1);
+}
+80100c73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100c76:	c9                   	leave
+80100c77:	c3                   	ret
+80100c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100c7f:	90                   	nop
+    pciintrs[npciintr].irq = d->irq;
+80100c80:	89 0c d5 40 c0 18 80 	mov    %ecx,-0x7fe73fc0(,%edx,8)
+    pciintrs[npciintr].fn = fn;
+80100c87:	89 1c d5 44 c0 18 80 	mov    %ebx,-0x7fe73fbc(,%edx,8)
+    npciintr++;
+80100c8e:	83 c2 01             	add    $0x1,%edx
+80100c91:	89 15 20 c0 18 80    	mov    %edx,0x8018c020
+        ioapicenablelevel(d->irq, ncpu - 1);
+80100c97:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+}
+80100c9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        ioapicenablelevel(d->irq, ncpu - 1);
+80100c9f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+80100ca2:	83 e8 01             	sub    $0x1,%eax
+80100ca5:	89 45 0c             	mov    %eax,0xc(%ebp)
+}
+80100ca8:	c9                   	leave
+        ioapicenablelevel(d->irq, ncpu - 1);
+80100ca9:	e9 b2 fb ff ff       	jmp    80100860 <ioapicenablelevel>
+        panic("pcisetintr");
+80100cae:	83 ec 0c             	sub    $0xc,%esp
+80100cb1:	68 1f ad 10 80       	push   $0x8010ad1f
+80100cb6:	e8 85 90 00 00       	call   80109d40 <panic>
+80100cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100cbf:	90                   	nop
+
+80100cc0 <pciintr>:
+
+// run the handlers for irq. returns 0 if there are none.
+int
+pciintr(int irq)
+{
+80100cc0:	55                   	push   %ebp
+80100cc1:	89 e5                	mov    %esp,%ebp
+80100cc3:	57                   	push   %edi
+    int i, n;
+
+    for (i = n = 0; i < npciintr; i++) {
+80100cc4:	31 ff                	xor    %edi,%edi
+{
+80100cc6:	56                   	push   %esi
+80100cc7:	53                   	push   %ebx
+80100cc8:	83 ec 0c             	sub    $0xc,%esp
+    for (i = n = 0; i < npciintr; i++) {
+80100ccb:	a1 20 c0 18 80       	mov    0x8018c020,%eax
+{
+80100cd0:	8b 75 08             	mov    0x8(%ebp),%esi
+    for (i = n = 0; i < npciintr; i++) {
+80100cd3:	85 c0                	test   %eax,%eax
+80100cd5:	7e 27                	jle    80100cfe <pciintr+0x3e>
+80100cd7:	31 db                	xor    %ebx,%ebx
+80100cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if (pciintrs[i].irq == irq) {
+80100ce0:	39 34 dd 40 c0 18 80 	cmp    %esi,-0x7fe73fc0(,%ebx,8)
+80100ce7:	75 0a                	jne    80100cf3 <pciintr+0x33>
+            pciintrs[i].fn();
+80100ce9:	ff 14 dd 44 c0 18 80 	call   *-0x7fe73fbc(,%ebx,8)
+            n++;
+80100cf0:	83 c7 01             	add    $0x1,%edi
+    for (i = n = 0; i < npciintr; i++) {
+80100cf3:	83 c3 01             	add    $0x1,%ebx
+80100cf6:	39 1d 20 c0 18 80    	cmp    %ebx,0x8018c020
+80100cfc:	7f e2                	jg     80100ce0 <pciintr+0x20>
+        }
+    }
+    return n;
+}
+80100cfe:	83 c4 0c             	add    $0xc,%esp
+80100d01:	89 f8                	mov    %edi,%eax
+80100d03:	5b                   	pop    %ebx
+80100d04:	5e                   	pop    %esi
+80100d05:	5f                   	pop    %edi
+80100d06:	5d                   	pop    %ebp
+80100d07:	c3                   	ret
+80100d08:	66 90                	xchg   %ax,%ax
+80100d0a:	66 90                	xchg   %ax,%ax
+80100d0c:	66 90                	xchg   %ax,%ax
+80100d0e:	66 90                	xchg   %ax,%ax
+
+80100d10 <picinit>:
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100d10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80100d15:	ba 20 00 00 00       	mov    $0x20,%edx
+80100d1a:	ee                   	out    %al,(%dx)
+80100d1b:	ba a0 00 00 00       	mov    $0xa0,%edx
+80100d20:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+    // mask all interrupts
+    outb(IO_PIC1, 0xFF);
+    outb(IO_PIC2, 0xFF);
+80100d21:	c3                   	ret
+80100d22:	66 90                	xchg   %ax,%ax
+80100d24:	66 90                	xchg   %ax,%ax
+80100d26:	66 90                	xchg   %ax,%ax
+80100d28:	66 90                	xchg   %ax,%ax
+80100d2a:	66 90                	xchg   %ax,%ax
+80100d2c:	66 90                	xchg   %ax,%ax
+80100d2e:	66 90                	xchg   %ax,%ax
+
+80100d30 <mpsearch1>:
+}
+
+// look for an MP structure in the len bytes ad addr
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80100d30:	55                   	push   %ebp
+80100d31:	89 e5                	mov    %esp,%ebp
+80100d33:	57                   	push   %edi
+80100d34:	56                   	push   %esi
+    uchar *e, *p, *addr;
+
+    addr = P2V(a);
+80100d35:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80100d3b:	53                   	push   %ebx
+    e = addr + len;
+80100d3c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80100d3f:	83 ec 0c             	sub    $0xc,%esp
+    for (p = addr; p < e; p += sizeof(struct mp))
+80100d42:	39 de                	cmp    %ebx,%esi
+80100d44:	72 10                	jb     80100d56 <mpsearch1+0x26>
+80100d46:	eb 50                	jmp    80100d98 <mpsearch1+0x68>
+80100d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100d4f:	90                   	nop
+80100d50:	89 fe                	mov    %edi,%esi
+80100d52:	39 df                	cmp    %ebx,%edi
+80100d54:	73 42                	jae    80100d98 <mpsearch1+0x68>
+        if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80100d56:	83 ec 04             	sub    $0x4,%esp
+80100d59:	8d 7e 10             	lea    0x10(%esi),%edi
+80100d5c:	6a 04                	push   $0x4
+80100d5e:	68 54 ad 10 80       	push   $0x8010ad54
+80100d63:	56                   	push   %esi
+80100d64:	e8 17 f3 ff ff       	call   80100080 <memcmp>
+80100d69:	83 c4 10             	add    $0x10,%esp
+80100d6c:	85 c0                	test   %eax,%eax
+80100d6e:	75 e0                	jne    80100d50 <mpsearch1+0x20>
+80100d70:	89 f2                	mov    %esi,%edx
+80100d72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        sum += addr[i];
+80100d78:	0f b6 0a             	movzbl (%edx),%ecx
+    for (i = 0; i < len; i++) {
+80100d7b:	83 c2 01             	add    $0x1,%edx
+        sum += addr[i];
+80100d7e:	01 c8                	add    %ecx,%eax
+    for (i = 0; i < len; i++) {
+80100d80:	39 fa                	cmp    %edi,%edx
+80100d82:	75 f4                	jne    80100d78 <mpsearch1+0x48>
+        if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80100d84:	84 c0                	test   %al,%al
+80100d86:	75 c8                	jne    80100d50 <mpsearch1+0x20>
+            return (struct mp *) p;
+    return 0;
+};
+80100d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100d8b:	89 f0                	mov    %esi,%eax
+80100d8d:	5b                   	pop    %ebx
+80100d8e:	5e                   	pop    %esi
+80100d8f:	5f                   	pop    %edi
+80100d90:	5d                   	pop    %ebp
+80100d91:	c3                   	ret
+80100d92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80100d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80100d9b:	31 f6                	xor    %esi,%esi
+};
+80100d9d:	5b                   	pop    %ebx
+80100d9e:	89 f0                	mov    %esi,%eax
+80100da0:	5e                   	pop    %esi
+80100da1:	5f                   	pop    %edi
+80100da2:	5d                   	pop    %ebp
+80100da3:	c3                   	ret
+80100da4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100daf:	90                   	nop
+
+80100db0 <mpinit>:
+    return conf;
+}
+
+void
+mpinit(void)
+{
+80100db0:	55                   	push   %ebp
+80100db1:	89 e5                	mov    %esp,%ebp
+80100db3:	57                   	push   %edi
+80100db4:	56                   	push   %esi
+80100db5:	53                   	push   %ebx
+80100db6:	83 ec 1c             	sub    $0x1c,%esp
+    if ((p = (bda[0x0F] << 8) | bda[0x0E]) << 4) {
+80100db9:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80100dc0:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80100dc7:	c1 e0 08             	shl    $0x8,%eax
+80100dca:	09 d0                	or     %edx,%eax
+80100dcc:	75 1b                	jne    80100de9 <mpinit+0x39>
+        p = ((bda[0x14] << 8) | bda[0x13]) * 1024;
+80100dce:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80100dd5:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80100ddc:	c1 e0 08             	shl    $0x8,%eax
+80100ddf:	09 d0                	or     %edx,%eax
+80100de1:	c1 e0 0a             	shl    $0xa,%eax
+        if ((mp = mpsearch1(p - 1024, 1024)))
+80100de4:	2d 00 04 00 00       	sub    $0x400,%eax
+        if ((mp = mpsearch1(p, 1024)))
+80100de9:	ba 00 04 00 00       	mov    $0x400,%edx
+80100dee:	e8 3d ff ff ff       	call   80100d30 <mpsearch1>
+80100df3:	89 c6                	mov    %eax,%esi
+80100df5:	85 c0                	test   %eax,%eax
+80100df7:	0f 84 e0 01 00 00    	je     80100fdd <mpinit+0x22d>
+    if ((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80100dfd:	8b 5e 04             	mov    0x4(%esi),%ebx
+80100e00:	85 db                	test   %ebx,%ebx
+80100e02:	0f 84 c8 01 00 00    	je     80100fd0 <mpinit+0x220>
+    if (memcmp(conf, "PCMP", 4) != 0)
+80100e08:	83 ec 04             	sub    $0x4,%esp
+    conf = (struct mpconf*)P2V((uint)mp->physaddr);
+80100e0b:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80100e11:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if (memcmp(conf, "PCMP", 4) != 0)
+80100e14:	6a 04                	push   $0x4
+80100e16:	68 59 ad 10 80       	push   $0x8010ad59
+80100e1b:	50                   	push   %eax
+80100e1c:	e8 5f f2 ff ff       	call   80100080 <memcmp>
+80100e21:	83 c4 10             	add    $0x10,%esp
+80100e24:	85 c0                	test   %eax,%eax
+80100e26:	0f 85 a4 01 00 00    	jne    80100fd0 <mpinit+0x220>
+    if (conf->version != 1 && conf->version != 4)
+80100e2c:	0f b6 83 06 00 00 80 	movzbl -0x7ffffffa(%ebx),%eax
+80100e33:	3c 01                	cmp    $0x1,%al
+80100e35:	74 08                	je     80100e3f <mpinit+0x8f>
+80100e37:	3c 04                	cmp    $0x4,%al
+80100e39:	0f 85 91 01 00 00    	jne    80100fd0 <mpinit+0x220>
+    if (sum((uchar *)conf, conf->length) != 0)
+80100e3f:	0f b7 93 04 00 00 80 	movzwl -0x7ffffffc(%ebx),%edx
+    for (i = 0; i < len; i++) {
+80100e46:	66 85 d2             	test   %dx,%dx
+80100e49:	74 25                	je     80100e70 <mpinit+0xc0>
+80100e4b:	8d 3c 1a             	lea    (%edx,%ebx,1),%edi
+80100e4e:	89 d8                	mov    %ebx,%eax
+    sum = 0;
+80100e50:	31 d2                	xor    %edx,%edx
+80100e52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        sum += addr[i];
+80100e58:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+    for (i = 0; i < len; i++) {
+80100e5f:	83 c0 01             	add    $0x1,%eax
+        sum += addr[i];
+80100e62:	01 ca                	add    %ecx,%edx
+    for (i = 0; i < len; i++) {
+80100e64:	39 f8                	cmp    %edi,%eax
+80100e66:	75 f0                	jne    80100e58 <mpinit+0xa8>
+    if (sum((uchar *)conf, conf->length) != 0)
+80100e68:	84 d2                	test   %dl,%dl
+80100e6a:	0f 85 60 01 00 00    	jne    80100fd0 <mpinit+0x220>
+
+    if ((conf = mpconfig(&mp)) == 0)
+        panic("mpinit: expect ro run on a SMP");
+    ismp = 1;
+    pcibus = 0;
+    lapic = (uint*)conf->lapicaddr;
+80100e70:	8b 83 24 00 00 80    	mov    -0x7fffffdc(%ebx),%eax
+    for (p = (uchar *)(conf + 1), e = (uchar *)conf + conf->length; p < e; ) {
+80100e76:	8d bb 2c 00 00 80    	lea    -0x7fffffd4(%ebx),%edi
+    ismp = 1;
+80100e7c:	c7 45 e0 01 00 00 00 	movl   $0x1,-0x20(%ebp)
+80100e83:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    lapic = (uint*)conf->lapicaddr;
+80100e86:	a3 04 c0 18 80       	mov    %eax,0x8018c004
+    for (p = (uchar *)(conf + 1), e = (uchar *)conf + conf->length; p < e; ) {
+80100e8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100e8e:	0f b7 9b 04 00 00 80 	movzwl -0x7ffffffc(%ebx),%ebx
+    pcibus = 0;
+80100e95:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for (p = (uchar *)(conf + 1), e = (uchar *)conf + conf->length; p < e; ) {
+80100e9c:	01 d8                	add    %ebx,%eax
+80100e9e:	89 c3                	mov    %eax,%ebx
+80100ea0:	39 df                	cmp    %ebx,%edi
+80100ea2:	73 64                	jae    80100f08 <mpinit+0x158>
+        switch (*p) {
+80100ea4:	80 3f 04             	cmpb   $0x4,(%edi)
+80100ea7:	0f 87 85 01 00 00    	ja     80101032 <mpinit.cold>
+80100ead:	0f b6 07             	movzbl (%edi),%eax
+80100eb0:	ff 24 85 ac ad 10 80 	jmp    *-0x7fef5254(,%eax,4)
+80100eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100ebe:	66 90                	xchg   %ax,%ax
+            case MPIOINTR:
+                // bus entries come first, so pcibus is complete.
+                // a pci line conforming to its bus is active low
+                intr = (struct mpiointr*)p;
+                pol = intr->flags & MPPOLARITY;
+                if (intr->intin < 32 && (pol == MPPOL_LOW ||
+80100ec0:	0f b6 4f 07          	movzbl 0x7(%edi),%ecx
+80100ec4:	80 f9 1f             	cmp    $0x1f,%cl
+80100ec7:	77 34                	ja     80100efd <mpinit+0x14d>
+80100ec9:	0f b7 47 02          	movzwl 0x2(%edi),%eax
+80100ecd:	83 e0 03             	and    $0x3,%eax
+80100ed0:	66 83 f8 03          	cmp    $0x3,%ax
+80100ed4:	74 1a                	je     80100ef0 <mpinit+0x140>
+80100ed6:	66 85 c0             	test   %ax,%ax
+80100ed9:	75 22                	jne    80100efd <mpinit+0x14d>
+                    (pol == MPPOL_BUS && intr->busno < 32 && (pcibus & (1U << intr->busno)))))
+80100edb:	0f b6 47 04          	movzbl 0x4(%edi),%eax
+80100edf:	3c 1f                	cmp    $0x1f,%al
+80100ee1:	77 1a                	ja     80100efd <mpinit+0x14d>
+80100ee3:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80100ee6:	0f a3 c6             	bt     %eax,%esi
+80100ee9:	73 12                	jae    80100efd <mpinit+0x14d>
+80100eeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100eef:	90                   	nop
+                    ioapiclow |= 1U << intr->intin;
+80100ef0:	b8 01 00 00 00       	mov    $0x1,%eax
+80100ef5:	d3 e0                	shl    %cl,%eax
+80100ef7:	09 05 40 c6 18 80    	or     %eax,0x8018c640
+                p += sizeof(struct mpiointr);
+80100efd:	83 c7 08             	add    $0x8,%edi
+    for (p = (uchar *)(conf + 1), e = (uchar *)conf + conf->length; p < e; ) {
+80100f00:	39 df                	cmp    %ebx,%edi
+80100f02:	72 a0                	jb     80100ea4 <mpinit+0xf4>
+80100f04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            default:
+                ismp = 0;
+                break;
+        }
+    }
+    if (!ismp)
+80100f08:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80100f0b:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80100f0e:	85 c0                	test   %eax,%eax
+80100f10:	0f 84 0f 01 00 00    	je     80101025 <mpinit+0x275>
+        panic("mpinit: didn't find a suitable machine");
+
+    if (mp->imcrp) {
+80100f16:	80 7e 0c 00          	cmpb   $0x0,0xc(%esi)
+80100f1a:	74 15                	je     80100f31 <mpinit+0x181>
+80100f1c:	b8 70 00 00 00       	mov    $0x70,%eax
+80100f21:	ba 22 00 00 00       	mov    $0x22,%edx
+80100f26:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100f27:	ba 23 00 00 00       	mov    $0x23,%edx
+80100f2c:	ec                   	in     (%dx),%al
+        // bochs doesn't support IMCR, so this doesn't run on boch.
+        // but it would on real hardware
+        outb(0x22, 0x70);
+        outb(0x23, inb(0x23) | 1);  // Mash external interrupts
+80100f2d:	83 c8 01             	or     $0x1,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100f30:	ee                   	out    %al,(%dx)
+    }
+80100f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f34:	5b                   	pop    %ebx
+80100f35:	5e                   	pop    %esi
+80100f36:	5f                   	pop    %edi
+80100f37:	5d                   	pop    %ebp
+80100f38:	c3                   	ret
+80100f39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                ioapicid = ioapic->apicno;
+80100f40:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+                p += sizeof(struct mpioapic);
+80100f44:	83 c7 08             	add    $0x8,%edi
+                ioapicid = ioapic->apicno;
+80100f47:	a2 44 c6 18 80       	mov    %al,0x8018c644
+                continue;;
+80100f4c:	e9 4f ff ff ff       	jmp    80100ea0 <mpinit+0xf0>
+80100f51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                if (memcmp(bus->bustype, "PCI", 3) == 0 && bus->busno < 32)
+80100f58:	83 ec 04             	sub    $0x4,%esp
+80100f5b:	8d 47 02             	lea    0x2(%edi),%eax
+80100f5e:	6a 03                	push   $0x3
+80100f60:	68 5e ad 10 80       	push   $0x8010ad5e
+80100f65:	50                   	push   %eax
+80100f66:	e8 15 f1 ff ff       	call   80100080 <memcmp>
+80100f6b:	83 c4 10             	add    $0x10,%esp
+80100f6e:	85 c0                	test   %eax,%eax
+80100f70:	75 1b                	jne    80100f8d <mpinit+0x1dd>
+80100f72:	0f b6 4f 01          	movzbl 0x1(%edi),%ecx
+                    pcibus |= 1U << bus->busno;
+80100f76:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80100f79:	ba 01 00 00 00       	mov    $0x1,%edx
+80100f7e:	d3 e2                	shl    %cl,%edx
+80100f80:	89 f0                	mov    %esi,%eax
+80100f82:	09 d6                	or     %edx,%esi
+80100f84:	80 f9 20             	cmp    $0x20,%cl
+80100f87:	0f 42 c6             	cmovb  %esi,%eax
+80100f8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+                p += sizeof(struct mpbus);
+80100f8d:	83 c7 08             	add    $0x8,%edi
+                continue;
+80100f90:	e9 0b ff ff ff       	jmp    80100ea0 <mpinit+0xf0>
+80100f95:	8d 76 00             	lea    0x0(%esi),%esi
+                if (ncpu < NCPU) {
+80100f98:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80100f9d:	83 f8 0b             	cmp    $0xb,%eax
+80100fa0:	7f 18                	jg     80100fba <mpinit+0x20a>
+                    cpus[ncpu].apicid = proc->apicid;   // apicid may differ from ncpu
+80100fa2:	0f b6 57 01          	movzbl 0x1(%edi),%edx
+80100fa6:	8d 0c 40             	lea    (%eax,%eax,2),%ecx
+                    ncpu++;
+80100fa9:	83 c0 01             	add    $0x1,%eax
+                    cpus[ncpu].apicid = proc->apicid;   // apicid may differ from ncpu
+80100fac:	c1 e1 06             	shl    $0x6,%ecx
+                    ncpu++;
+80100faf:	a3 48 c6 18 80       	mov    %eax,0x8018c648
+                    cpus[ncpu].apicid = proc->apicid;   // apicid may differ from ncpu
+80100fb4:	88 91 80 c6 18 80    	mov    %dl,-0x7fe73980(%ecx)
+                p += sizeof(struct mpproc);
+80100fba:	83 c7 14             	add    $0x14,%edi
+                continue;
+80100fbd:	e9 de fe ff ff       	jmp    80100ea0 <mpinit+0xf0>
+80100fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+                p += 8;
+80100fc8:	83 c7 08             	add    $0x8,%edi
+                continue;
+80100fcb:	e9 d0 fe ff ff       	jmp    80100ea0 <mpinit+0xf0>
+        panic("mpinit: expect ro run on a SMP");
+80100fd0:	83 ec 0c             	sub    $0xc,%esp
+80100fd3:	68 64 ad 10 80       	push   $0x8010ad64
+80100fd8:	e8 63 8d 00 00       	call   80109d40 <panic>
+{
+80100fdd:	be 00 00 0f 80       	mov    $0x800f0000,%esi
+80100fe2:	eb 0e                	jmp    80100ff2 <mpinit+0x242>
+80100fe4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    for (p = addr; p < e; p += sizeof(struct mp))
+80100fe8:	89 de                	mov    %ebx,%esi
+80100fea:	81 fb 00 00 10 80    	cmp    $0x80100000,%ebx
+80100ff0:	74 de                	je     80100fd0 <mpinit+0x220>
+        if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80100ff2:	83 ec 04             	sub    $0x4,%esp
+80100ff5:	8d 5e 10             	lea    0x10(%esi),%ebx
+80100ff8:	6a 04                	push   $0x4
+80100ffa:	68 54 ad 10 80       	push   $0x8010ad54
+80100fff:	56                   	push   %esi
+80101000:	e8 7b f0 ff ff       	call   80100080 <memcmp>
+80101005:	83 c4 10             	add    $0x10,%esp
+80101008:	85 c0                	test   %eax,%eax
+8010100a:	75 dc                	jne    80100fe8 <mpinit+0x238>
+8010100c:	89 f2                	mov    %esi,%edx
+8010100e:	66 90                	xchg   %ax,%ax
+        sum += addr[i];
+80101010:	0f b6 0a             	movzbl (%edx),%ecx
+    for (i = 0; i < len; i++) {
+80101013:	83 c2 01             	add    $0x1,%edx
+        sum += addr[i];
+80101016:	01 c8                	add    %ecx,%eax
+    for (i = 0; i < len; i++) {
+80101018:	39 d3                	cmp    %edx,%ebx
+8010101a:	75 f4                	jne    80101010 <mpinit+0x260>
+        if (memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+8010101c:	84 c0                	test   %al,%al
+8010101e:	75 c8                	jne    80100fe8 <mpinit+0x238>
+80101020:	e9 d8 fd ff ff       	jmp    80100dfd <mpinit+0x4d>
+        panic("mpinit: didn't find a suitable machine");
+80101025:	83 ec 0c             	sub    $0xc,%esp
+80101028:	68 84 ad 10 80       	push   $0x8010ad84
+8010102d:	e8 0e 8d 00 00       	call   80109d40 <panic>
+
+80101032 <mpinit.cold>:
+        switch (*p) {
+80101032:	31 d2                	xor    %edx,%edx
+80101034:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80101037:	e9 64 fe ff ff       	jmp    80100ea0 <mpinit+0xf0>
+8010103c:	66 90                	xchg   %ax,%ax
+8010103e:	66 90                	xchg   %ax,%ax
+
+80101040 <initlock>:
+_Static_assert(sizeof(struct mcslock) <= CACHELINE, "struct mcslock spans cache lines");
+#endif
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80101040:	55                   	push   %ebp
+80101041:	89 e5                	mov    %esp,%ebp
+80101043:	8b 45 08             	mov    0x8(%ebp),%eax
+    lk->name = name;
+80101046:	8b 55 0c             	mov    0xc(%ebp),%edx
+    lk->next = 0;
+80101049:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lk->name = name;
+8010104f:	89 50 08             	mov    %edx,0x8(%eax)
+    lk->owner = 0;
+80101052:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    lk->cpu = 0;
+80101059:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+80101060:	5d                   	pop    %ebp
+80101061:	c3                   	ret
+80101062:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101069:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101070 <initmcslock>:
+    popcli();
+}
+
+void
+initmcslock(struct mcslock *lk, char *name)
+{
+80101070:	55                   	push   %ebp
+80101071:	89 e5                	mov    %esp,%ebp
+80101073:	8b 45 08             	mov    0x8(%ebp),%eax
+    lk->name = name;
+80101076:	8b 55 0c             	mov    0xc(%ebp),%edx
+    lk->tail = 0;
+80101079:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lk->name = name;
+8010107f:	89 50 04             	mov    %edx,0x4(%eax)
+    lk->cpu = 0;
+80101082:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80101089:	5d                   	pop    %ebp
+8010108a:	c3                   	ret
+8010108b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010108f:	90                   	nop
+
+80101090 <getcallerpcs>:
+// record the current call stack in pcs[] by following the %ebp chain
+// still don't know how does it operate
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80101090:	55                   	push   %ebp
+80101091:	89 e5                	mov    %esp,%ebp
+80101093:	53                   	push   %ebx
+80101094:	8b 45 08             	mov    0x8(%ebp),%eax
+80101097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    uint *ebp;
+    int i;
+
+    ebp = (uint*)v - 2;
+8010109a:	8d 50 f8             	lea    -0x8(%eax),%edx
+    for(i = 0; i < 10; i++){
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010109d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+801010a2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+    for(i = 0; i < 10; i++){
+801010a7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801010ac:	76 10                	jbe    801010be <getcallerpcs+0x2e>
+801010ae:	eb 28                	jmp    801010d8 <getcallerpcs+0x48>
+801010b0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801010b6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801010bc:	77 1a                	ja     801010d8 <getcallerpcs+0x48>
+            break;
+        pcs[i] = ebp[1];     // saved %eip
+801010be:	8b 5a 04             	mov    0x4(%edx),%ebx
+801010c1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+    for(i = 0; i < 10; i++){
+801010c4:	83 c0 01             	add    $0x1,%eax
+        ebp = (uint*)ebp[0]; // saved %ebp
+801010c7:	8b 12                	mov    (%edx),%edx
+    for(i = 0; i < 10; i++){
+801010c9:	83 f8 0a             	cmp    $0xa,%eax
+801010cc:	75 e2                	jne    801010b0 <getcallerpcs+0x20>
+    }
+    for(; i < 10; i++)
+        pcs[i] = 0;
+}
+801010ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801010d1:	c9                   	leave
+801010d2:	c3                   	ret
+801010d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801010d7:	90                   	nop
+801010d8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801010db:	8d 51 28             	lea    0x28(%ecx),%edx
+801010de:	66 90                	xchg   %ax,%ax
+        pcs[i] = 0;
+801010e0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    for(; i < 10; i++)
+801010e6:	83 c0 04             	add    $0x4,%eax
+801010e9:	39 d0                	cmp    %edx,%eax
+801010eb:	75 f3                	jne    801010e0 <getcallerpcs+0x50>
+}
+801010ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801010f0:	c9                   	leave
+801010f1:	c3                   	ret
+801010f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801010f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101100 <pushcli>:
+// pushcli/popcli are lick cli/sti except that they are matched:
+// it takes two popcli to undo two pushchi. also, if interrupts
+// are off, then pushcli, popcli leaves them off
+void
+pushcli(void)
+{
+80101100:	55                   	push   %ebp
+80101101:	89 e5                	mov    %esp,%ebp
+80101103:	53                   	push   %ebx
+80101104:	83 ec 04             	sub    $0x4,%esp
+
+static inline uint
+readeflags(void)
+{
+    uint eflags;
+    asm volatile("pushfl; popl %0" : "=r" (eflags));
+80101107:	9c                   	pushf
+80101108:	5b                   	pop    %ebx
+}
+
+static inline void
+cli(void)
+{
+    asm volatile("cli");
+80101109:	fa                   	cli
+    int eflags;
+
+    eflags = readeflags();
+    cli();
+    if (mycpu()->ncli == 0)
+8010110a:	e8 d1 72 00 00       	call   801083e0 <mycpu>
+8010110f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80101115:	85 c0                	test   %eax,%eax
+80101117:	74 17                	je     80101130 <pushcli+0x30>
+        mycpu()->intena = eflags & FL_IF;
+    mycpu()->ncli += 1;
+80101119:	e8 c2 72 00 00       	call   801083e0 <mycpu>
+8010111e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80101125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101128:	c9                   	leave
+80101129:	c3                   	ret
+8010112a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        mycpu()->intena = eflags & FL_IF;
+80101130:	e8 ab 72 00 00       	call   801083e0 <mycpu>
+80101135:	81 e3 00 02 00 00    	and    $0x200,%ebx
+8010113b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80101141:	eb d6                	jmp    80101119 <pushcli+0x19>
+80101143:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010114a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101150 <popcli>:
+
+void
+popcli(void)
+{
+80101150:	55                   	push   %ebp
+80101151:	89 e5                	mov    %esp,%ebp
+80101153:	83 ec 08             	sub    $0x8,%esp
+    asm volatile("pushfl; popl %0" : "=r" (eflags));
+80101156:	9c                   	pushf
+80101157:	58                   	pop    %eax
+    if (readeflags() & FL_IF)
+80101158:	f6 c4 02             	test   $0x2,%ah
+8010115b:	75 35                	jne    80101192 <popcli+0x42>
+        panic("popcli: interrupt is enabled\n");
+    if (--mycpu()->ncli < 0)
+8010115d:	e8 7e 72 00 00       	call   801083e0 <mycpu>
+80101162:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80101169:	78 34                	js     8010119f <popcli+0x4f>
+        panic("popcli: pushcli operation not matched");
+    if (mycpu()->ncli == 0 && mycpu()->intena)
+8010116b:	e8 70 72 00 00       	call   801083e0 <mycpu>
+80101170:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80101176:	85 d2                	test   %edx,%edx
+80101178:	74 06                	je     80101180 <popcli+0x30>
+        sti();
+}
+8010117a:	c9                   	leave
+8010117b:	c3                   	ret
+8010117c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if (mycpu()->ncli == 0 && mycpu()->intena)
+80101180:	e8 5b 72 00 00       	call   801083e0 <mycpu>
+80101185:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+8010118b:	85 c0                	test   %eax,%eax
+8010118d:	74 eb                	je     8010117a <popcli+0x2a>
+}
+
+static inline void
+sti(void)
+{
+    asm volatile("sti");
+8010118f:	fb                   	sti
+}
+80101190:	c9                   	leave
+80101191:	c3                   	ret
+        panic("popcli: interrupt is enabled\n");
+80101192:	83 ec 0c             	sub    $0xc,%esp
+80101195:	68 c0 ad 10 80       	push   $0x8010adc0
+8010119a:	e8 a1 8b 00 00       	call   80109d40 <panic>
+        panic("popcli: pushcli operation not matched");
+8010119f:	83 ec 0c             	sub    $0xc,%esp
+801011a2:	68 18 ae 10 80       	push   $0x8010ae18
+801011a7:	e8 94 8b 00 00       	call   80109d40 <panic>
+801011ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801011b0 <holdingmcs>:
+{
+801011b0:	55                   	push   %ebp
+801011b1:	89 e5                	mov    %esp,%ebp
+801011b3:	56                   	push   %esi
+801011b4:	53                   	push   %ebx
+801011b5:	8b 75 08             	mov    0x8(%ebp),%esi
+801011b8:	31 db                	xor    %ebx,%ebx
+    pushcli();
+801011ba:	e8 41 ff ff ff       	call   80101100 <pushcli>
+    r = lk->tail != 0 && lk->cpu == mycpu();
+801011bf:	8b 06                	mov    (%esi),%eax
+801011c1:	85 c0                	test   %eax,%eax
+801011c3:	74 10                	je     801011d5 <holdingmcs+0x25>
+801011c5:	8b 5e 08             	mov    0x8(%esi),%ebx
+801011c8:	e8 13 72 00 00       	call   801083e0 <mycpu>
+801011cd:	39 c3                	cmp    %eax,%ebx
+801011cf:	0f 94 c3             	sete   %bl
+801011d2:	0f b6 db             	movzbl %bl,%ebx
+    popcli();
+801011d5:	e8 76 ff ff ff       	call   80101150 <popcli>
+}
+801011da:	89 d8                	mov    %ebx,%eax
+801011dc:	5b                   	pop    %ebx
+801011dd:	5e                   	pop    %esi
+801011de:	5d                   	pop    %ebp
+801011df:	c3                   	ret
+
+801011e0 <holding>:
+{
+801011e0:	55                   	push   %ebp
+801011e1:	89 e5                	mov    %esp,%ebp
+801011e3:	56                   	push   %esi
+801011e4:	31 f6                	xor    %esi,%esi
+801011e6:	53                   	push   %ebx
+801011e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();
+801011ea:	e8 11 ff ff ff       	call   80101100 <pushcli>
+    r = lock->next != lock->owner && lock->cpu == mycpu();
+801011ef:	8b 13                	mov    (%ebx),%edx
+801011f1:	8b 43 04             	mov    0x4(%ebx),%eax
+801011f4:	39 c2                	cmp    %eax,%edx
+801011f6:	74 12                	je     8010120a <holding+0x2a>
+801011f8:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+801011fb:	e8 e0 71 00 00       	call   801083e0 <mycpu>
+80101200:	39 c3                	cmp    %eax,%ebx
+80101202:	0f 94 c0             	sete   %al
+80101205:	0f b6 c0             	movzbl %al,%eax
+80101208:	89 c6                	mov    %eax,%esi
+    popcli();
+8010120a:	e8 41 ff ff ff       	call   80101150 <popcli>
+}
+8010120f:	89 f0                	mov    %esi,%eax
+80101211:	5b                   	pop    %ebx
+80101212:	5e                   	pop    %esi
+80101213:	5d                   	pop    %ebp
+80101214:	c3                   	ret
+80101215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010121c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101220 <releasemcs>:
+{
+80101220:	55                   	push   %ebp
+80101221:	89 e5                	mov    %esp,%ebp
+80101223:	57                   	push   %edi
+80101224:	56                   	push   %esi
+80101225:	53                   	push   %ebx
+80101226:	83 ec 0c             	sub    $0xc,%esp
+80101229:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010122c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    pushcli();
+8010122f:	e8 cc fe ff ff       	call   80101100 <pushcli>
+    r = lk->tail != 0 && lk->cpu == mycpu();
+80101234:	8b 03                	mov    (%ebx),%eax
+80101236:	85 c0                	test   %eax,%eax
+80101238:	74 0c                	je     80101246 <releasemcs+0x26>
+8010123a:	8b 7b 08             	mov    0x8(%ebx),%edi
+8010123d:	e8 9e 71 00 00       	call   801083e0 <mycpu>
+80101242:	39 c7                	cmp    %eax,%edi
+80101244:	74 1a                	je     80101260 <releasemcs+0x40>
+    popcli();
+80101246:	e8 05 ff ff ff       	call   80101150 <popcli>
+        panic("releasemcs: didn't hold the lock\n");
+8010124b:	83 ec 0c             	sub    $0xc,%esp
+8010124e:	68 40 ae 10 80       	push   $0x8010ae40
+80101253:	e8 e8 8a 00 00       	call   80109d40 <panic>
+80101258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010125f:	90                   	nop
+    popcli();
+80101260:	e8 eb fe ff ff       	call   80101150 <popcli>
+    lockstatreleased(lk->stat, lk->tsc);
+80101265:	83 ec 04             	sub    $0x4,%esp
+80101268:	ff 73 3c             	push   0x3c(%ebx)
+8010126b:	ff 73 38             	push   0x38(%ebx)
+8010126e:	ff 73 34             	push   0x34(%ebx)
+80101271:	e8 ea 4f 00 00       	call   80106260 <lockstatreleased>
+    lk->pcs[0] = 0;
+80101276:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    if (me->next == 0) {
+8010127d:	83 c4 10             	add    $0x10,%esp
+    lk->cpu = 0;
+80101280:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    __sync_synchronize();
+80101287:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    if (me->next == 0) {
+8010128c:	8b 16                	mov    (%esi),%edx
+8010128e:	85 d2                	test   %edx,%edx
+80101290:	74 1e                	je     801012b0 <releasemcs+0x90>
+    me->next->wait = 0;
+80101292:	8b 06                	mov    (%esi),%eax
+80101294:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+8010129b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010129e:	5b                   	pop    %ebx
+8010129f:	5e                   	pop    %esi
+801012a0:	5f                   	pop    %edi
+801012a1:	5d                   	pop    %ebp
+    popcli();
+801012a2:	e9 a9 fe ff ff       	jmp    80101150 <popcli>
+801012a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012ae:	66 90                	xchg   %ax,%ax
+        if (__sync_bool_compare_and_swap(&lk->tail, me, 0)) {
+801012b0:	89 f0                	mov    %esi,%eax
+801012b2:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+801012b6:	75 0e                	jne    801012c6 <releasemcs+0xa6>
+}
+801012b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801012bb:	5b                   	pop    %ebx
+801012bc:	5e                   	pop    %esi
+801012bd:	5f                   	pop    %edi
+801012be:	5d                   	pop    %ebp
+    popcli();
+801012bf:	e9 8c fe ff ff       	jmp    80101150 <popcli>
+// spin-wait hint: saves power and avoids the memory order
+// mis-speculation penalty when the loop exits
+static inline void
+pause(void)
+{
+    asm volatile("pause" ::: "memory");
+801012c4:	f3 90                	pause
+        while (me->next == 0)
+801012c6:	8b 06                	mov    (%esi),%eax
+801012c8:	85 c0                	test   %eax,%eax
+801012ca:	74 f8                	je     801012c4 <releasemcs+0xa4>
+801012cc:	eb c4                	jmp    80101292 <releasemcs+0x72>
+801012ce:	66 90                	xchg   %ax,%ax
+
+801012d0 <release>:
+{
+801012d0:	55                   	push   %ebp
+801012d1:	89 e5                	mov    %esp,%ebp
+801012d3:	56                   	push   %esi
+801012d4:	53                   	push   %ebx
+801012d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();
+801012d8:	e8 23 fe ff ff       	call   80101100 <pushcli>
+    r = lock->next != lock->owner && lock->cpu == mycpu();
+801012dd:	8b 13                	mov    (%ebx),%edx
+801012df:	8b 43 04             	mov    0x4(%ebx),%eax
+801012e2:	39 c2                	cmp    %eax,%edx
+801012e4:	75 1a                	jne    80101300 <release+0x30>
+    popcli();
+801012e6:	e8 65 fe ff ff       	call   80101150 <popcli>
+        panic("release: didn't hold the lock\n");
+801012eb:	83 ec 0c             	sub    $0xc,%esp
+801012ee:	68 64 ae 10 80       	push   $0x8010ae64
+801012f3:	e8 48 8a 00 00       	call   80109d40 <panic>
+801012f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801012ff:	90                   	nop
+    r = lock->next != lock->owner && lock->cpu == mycpu();
+80101300:	8b 73 0c             	mov    0xc(%ebx),%esi
+80101303:	e8 d8 70 00 00       	call   801083e0 <mycpu>
+80101308:	39 c6                	cmp    %eax,%esi
+8010130a:	75 da                	jne    801012e6 <release+0x16>
+    popcli();
+8010130c:	e8 3f fe ff ff       	call   80101150 <popcli>
+    lockstatreleased(lk->stat, lk->tsc);
+80101311:	83 ec 04             	sub    $0x4,%esp
+80101314:	ff 73 40             	push   0x40(%ebx)
+80101317:	ff 73 3c             	push   0x3c(%ebx)
+8010131a:	ff 73 38             	push   0x38(%ebx)
+8010131d:	e8 3e 4f 00 00       	call   80106260 <lockstatreleased>
+    lk->pcs[0] = 0;
+80101322:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+    lk->cpu = 0;
+80101329:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    __sync_synchronize();
+80101330:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    asm volatile("movl %1, %0" : "+m" (lk->owner) : "r" (lk->owner + 1));
+80101335:	8b 43 04             	mov    0x4(%ebx),%eax
+80101338:	83 c0 01             	add    $0x1,%eax
+8010133b:	89 43 04             	mov    %eax,0x4(%ebx)
+    popcli();
+8010133e:	83 c4 10             	add    $0x10,%esp
+}
+80101341:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101344:	5b                   	pop    %ebx
+80101345:	5e                   	pop    %esi
+80101346:	5d                   	pop    %ebp
+    popcli();
+80101347:	e9 04 fe ff ff       	jmp    80101150 <popcli>
+8010134c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101350 <acquiremcs>:
+{
+80101350:	55                   	push   %ebp
+80101351:	89 e5                	mov    %esp,%ebp
+80101353:	57                   	push   %edi
+80101354:	56                   	push   %esi
+80101355:	53                   	push   %ebx
+80101356:	83 ec 1c             	sub    $0x1c,%esp
+80101359:	8b 75 0c             	mov    0xc(%ebp),%esi
+static inline uint64
+rdtsc(void)
+{
+    uint64 tsc;
+
+    asm volatile("rdtsc" : "=A" (tsc));
+8010135c:	0f 31                	rdtsc
+8010135e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101361:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    pushcli();  // disable interrupt to avoid deadlock
+80101364:	e8 97 fd ff ff       	call   80101100 <pushcli>
+    if (holdingmcs(lk))
+80101369:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();
+8010136c:	e8 8f fd ff ff       	call   80101100 <pushcli>
+    r = lk->tail != 0 && lk->cpu == mycpu();
+80101371:	8b 03                	mov    (%ebx),%eax
+80101373:	85 c0                	test   %eax,%eax
+80101375:	74 10                	je     80101387 <acquiremcs+0x37>
+80101377:	8b 5b 08             	mov    0x8(%ebx),%ebx
+8010137a:	e8 61 70 00 00       	call   801083e0 <mycpu>
+8010137f:	39 c3                	cmp    %eax,%ebx
+80101381:	0f 84 09 01 00 00    	je     80101490 <acquiremcs+0x140>
+    popcli();
+80101387:	e8 c4 fd ff ff       	call   80101150 <popcli>
+    me->next = 0;
+8010138c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    prev = (struct mcsnode*)xchg((volatile uint*)&lk->tail, (uint)me);
+80101392:	8b 55 08             	mov    0x8(%ebp),%edx
+    asm volatile("lock; xchgl %0, %1" :
+80101395:	89 f0                	mov    %esi,%eax
+    me->wait = 1;
+80101397:	c7 46 04 01 00 00 00 	movl   $0x1,0x4(%esi)
+8010139e:	f0 87 02             	lock xchg %eax,(%edx)
+801013a1:	89 c3                	mov    %eax,%ebx
+    if (prev) {
+801013a3:	85 c0                	test   %eax,%eax
+801013a5:	0f 85 c5 00 00 00    	jne    80101470 <acquiremcs+0x120>
+    __sync_synchronize();
+801013ab:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    lk->cpu = mycpu();
+801013b0:	8b 75 08             	mov    0x8(%ebp),%esi
+801013b3:	e8 28 70 00 00       	call   801083e0 <mycpu>
+    getcallerpcs(&lk, lk->pcs);
+801013b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    for(i = 0; i < 10; i++){
+801013bb:	31 d2                	xor    %edx,%edx
+    lk->cpu = mycpu();
+801013bd:	89 46 08             	mov    %eax,0x8(%esi)
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801013c0:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+801013c6:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+801013cb:	0f 87 7f 00 00 00    	ja     80101450 <acquiremcs+0x100>
+    ebp = (uint*)v - 2;
+801013d1:	89 e8                	mov    %ebp,%eax
+801013d3:	eb 11                	jmp    801013e6 <acquiremcs+0x96>
+801013d5:	8d 76 00             	lea    0x0(%esi),%esi
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801013d8:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+801013de:	81 fe fe ff ff 7f    	cmp    $0x7ffffffe,%esi
+801013e4:	77 6a                	ja     80101450 <acquiremcs+0x100>
+        pcs[i] = ebp[1];     // saved %eip
+801013e6:	8b 70 04             	mov    0x4(%eax),%esi
+801013e9:	89 74 91 0c          	mov    %esi,0xc(%ecx,%edx,4)
+    for(i = 0; i < 10; i++){
+801013ed:	83 c2 01             	add    $0x1,%edx
+        ebp = (uint*)ebp[0]; // saved %ebp
+801013f0:	8b 00                	mov    (%eax),%eax
+    for(i = 0; i < 10; i++){
+801013f2:	83 fa 0a             	cmp    $0xa,%edx
+801013f5:	75 e1                	jne    801013d8 <acquiremcs+0x88>
+    asm volatile("rdtsc" : "=A" (tsc));
+801013f7:	0f 31                	rdtsc
+801013f9:	89 d7                	mov    %edx,%edi
+    lk->stat = lockstatget(lk->name, lk->pcs[0]);
+801013fb:	8b 55 08             	mov    0x8(%ebp),%edx
+801013fe:	83 ec 08             	sub    $0x8,%esp
+80101401:	89 c6                	mov    %eax,%esi
+80101403:	ff 72 0c             	push   0xc(%edx)
+80101406:	ff 72 04             	push   0x4(%edx)
+80101409:	89 55 dc             	mov    %edx,-0x24(%ebp)
+8010140c:	e8 7f 4d 00 00       	call   80106190 <lockstatget>
+80101411:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80101414:	89 42 34             	mov    %eax,0x34(%edx)
+    lockstatacquired(lk->stat, prev != 0, now - t0);
+80101417:	89 f0                	mov    %esi,%eax
+80101419:	89 fa                	mov    %edi,%edx
+8010141b:	2b 45 e0             	sub    -0x20(%ebp),%eax
+8010141e:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+80101421:	52                   	push   %edx
+80101422:	50                   	push   %eax
+80101423:	31 c0                	xor    %eax,%eax
+80101425:	85 db                	test   %ebx,%ebx
+80101427:	0f 95 c0             	setne  %al
+8010142a:	50                   	push   %eax
+8010142b:	8b 45 08             	mov    0x8(%ebp),%eax
+8010142e:	ff 70 34             	push   0x34(%eax)
+80101431:	e8 ea 4d 00 00       	call   80106220 <lockstatacquired>
+    lk->tsc = now;
+80101436:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80101439:	83 c4 20             	add    $0x20,%esp
+    lk->tsc = now;
+8010143c:	89 70 38             	mov    %esi,0x38(%eax)
+8010143f:	89 78 3c             	mov    %edi,0x3c(%eax)
+}
+80101442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101445:	5b                   	pop    %ebx
+80101446:	5e                   	pop    %esi
+80101447:	5f                   	pop    %edi
+80101448:	5d                   	pop    %ebp
+80101449:	c3                   	ret
+8010144a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101450:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80101454:	83 c1 34             	add    $0x34,%ecx
+80101457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010145e:	66 90                	xchg   %ax,%ax
+        pcs[i] = 0;
+80101460:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    for(; i < 10; i++)
+80101466:	83 c0 04             	add    $0x4,%eax
+80101469:	39 c1                	cmp    %eax,%ecx
+8010146b:	75 f3                	jne    80101460 <acquiremcs+0x110>
+8010146d:	eb 88                	jmp    801013f7 <acquiremcs+0xa7>
+8010146f:	90                   	nop
+        prev->next = me;
+80101470:	89 30                	mov    %esi,(%eax)
+        while (me->wait)
+80101472:	8b 46 04             	mov    0x4(%esi),%eax
+80101475:	85 c0                	test   %eax,%eax
+80101477:	0f 84 2e ff ff ff    	je     801013ab <acquiremcs+0x5b>
+8010147d:	8d 76 00             	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+80101480:	f3 90                	pause
+80101482:	8b 46 04             	mov    0x4(%esi),%eax
+80101485:	85 c0                	test   %eax,%eax
+80101487:	75 f7                	jne    80101480 <acquiremcs+0x130>
+80101489:	e9 1d ff ff ff       	jmp    801013ab <acquiremcs+0x5b>
+8010148e:	66 90                	xchg   %ax,%ax
+    popcli();
+80101490:	e8 bb fc ff ff       	call   80101150 <popcli>
+        panic("acquiremcs");
+80101495:	83 ec 0c             	sub    $0xc,%esp
+80101498:	68 de ad 10 80       	push   $0x8010adde
+8010149d:	e8 9e 88 00 00       	call   80109d40 <panic>
+801014a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801014b0 <acquire>:
+{
+801014b0:	55                   	push   %ebp
+801014b1:	89 e5                	mov    %esp,%ebp
+801014b3:	57                   	push   %edi
+801014b4:	56                   	push   %esi
+801014b5:	53                   	push   %ebx
+801014b6:	83 ec 1c             	sub    $0x1c,%esp
+    asm volatile("rdtsc" : "=A" (tsc));
+801014b9:	0f 31                	rdtsc
+801014bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801014be:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    pushcli();  // disable interrupt to avoid deadlock
+801014c1:	e8 3a fc ff ff       	call   80101100 <pushcli>
+    if (holding(lk))
+801014c6:	8b 75 08             	mov    0x8(%ebp),%esi
+    pushcli();
+801014c9:	e8 32 fc ff ff       	call   80101100 <pushcli>
+    r = lock->next != lock->owner && lock->cpu == mycpu();
+801014ce:	8b 16                	mov    (%esi),%edx
+801014d0:	8b 46 04             	mov    0x4(%esi),%eax
+801014d3:	39 c2                	cmp    %eax,%edx
+801014d5:	0f 85 d5 00 00 00    	jne    801015b0 <acquire+0x100>
+    popcli();
+801014db:	e8 70 fc ff ff       	call   80101150 <popcli>
+    asm volatile("lock; xaddl %0, %1" :
+801014e0:	ba 01 00 00 00       	mov    $0x1,%edx
+801014e5:	f0 0f c1 16          	lock xadd %edx,(%esi)
+    contended = lk->owner != ticket;
+801014e9:	8b 45 08             	mov    0x8(%ebp),%eax
+801014ec:	31 db                	xor    %ebx,%ebx
+801014ee:	8b 48 04             	mov    0x4(%eax),%ecx
+801014f1:	39 d1                	cmp    %edx,%ecx
+801014f3:	0f 95 c3             	setne  %bl
+801014f6:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    while (lk->owner != ticket)
+801014f9:	8b 40 04             	mov    0x4(%eax),%eax
+801014fc:	39 d0                	cmp    %edx,%eax
+801014fe:	74 0c                	je     8010150c <acquire+0x5c>
+    asm volatile("pause" ::: "memory");
+80101500:	f3 90                	pause
+80101502:	8b 45 08             	mov    0x8(%ebp),%eax
+80101505:	8b 40 04             	mov    0x4(%eax),%eax
+80101508:	39 d0                	cmp    %edx,%eax
+8010150a:	75 f4                	jne    80101500 <acquire+0x50>
+    __sync_synchronize();
+8010150c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    lk->cpu = mycpu();
+80101511:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80101514:	e8 c7 6e 00 00       	call   801083e0 <mycpu>
+    for(i = 0; i < 10; i++){
+80101519:	31 d2                	xor    %edx,%edx
+    lk->cpu = mycpu();
+8010151b:	89 43 0c             	mov    %eax,0xc(%ebx)
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010151e:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80101524:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80101529:	77 65                	ja     80101590 <acquire+0xe0>
+    ebp = (uint*)v - 2;
+8010152b:	89 e8                	mov    %ebp,%eax
+8010152d:	eb 0f                	jmp    8010153e <acquire+0x8e>
+8010152f:	90                   	nop
+        if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80101530:	8d 88 00 00 00 80    	lea    -0x80000000(%eax),%ecx
+80101536:	81 f9 fe ff ff 7f    	cmp    $0x7ffffffe,%ecx
+8010153c:	77 52                	ja     80101590 <acquire+0xe0>
+        pcs[i] = ebp[1];     // saved %eip
+8010153e:	8b 48 04             	mov    0x4(%eax),%ecx
+80101541:	89 4c 93 10          	mov    %ecx,0x10(%ebx,%edx,4)
+    for(i = 0; i < 10; i++){
+80101545:	83 c2 01             	add    $0x1,%edx
+        ebp = (uint*)ebp[0]; // saved %ebp
+80101548:	8b 00                	mov    (%eax),%eax
+    for(i = 0; i < 10; i++){
+8010154a:	83 fa 0a             	cmp    $0xa,%edx
+8010154d:	75 e1                	jne    80101530 <acquire+0x80>
+    asm volatile("rdtsc" : "=A" (tsc));
+8010154f:	0f 31                	rdtsc
+    lk->stat = lockstatget(lk->name, lk->pcs[0]);
+80101551:	83 ec 08             	sub    $0x8,%esp
+80101554:	ff 73 10             	push   0x10(%ebx)
+80101557:	89 c6                	mov    %eax,%esi
+80101559:	89 d7                	mov    %edx,%edi
+8010155b:	ff 73 08             	push   0x8(%ebx)
+8010155e:	e8 2d 4c 00 00       	call   80106190 <lockstatget>
+    lockstatacquired(lk->stat, contended, now - t0);
+80101563:	89 fa                	mov    %edi,%edx
+    lk->stat = lockstatget(lk->name, lk->pcs[0]);
+80101565:	89 43 38             	mov    %eax,0x38(%ebx)
+80101568:	89 c1                	mov    %eax,%ecx
+    lockstatacquired(lk->stat, contended, now - t0);
+8010156a:	89 f0                	mov    %esi,%eax
+8010156c:	2b 45 d8             	sub    -0x28(%ebp),%eax
+8010156f:	1b 55 dc             	sbb    -0x24(%ebp),%edx
+80101572:	52                   	push   %edx
+80101573:	50                   	push   %eax
+80101574:	ff 75 e4             	push   -0x1c(%ebp)
+80101577:	51                   	push   %ecx
+80101578:	e8 a3 4c 00 00       	call   80106220 <lockstatacquired>
+    lk->tsc = now;
+8010157d:	89 73 3c             	mov    %esi,0x3c(%ebx)
+}
+80101580:	83 c4 20             	add    $0x20,%esp
+    lk->tsc = now;
+80101583:	89 7b 40             	mov    %edi,0x40(%ebx)
+}
+80101586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101589:	5b                   	pop    %ebx
+8010158a:	5e                   	pop    %esi
+8010158b:	5f                   	pop    %edi
+8010158c:	5d                   	pop    %ebp
+8010158d:	c3                   	ret
+8010158e:	66 90                	xchg   %ax,%ax
+80101590:	8d 44 93 10          	lea    0x10(%ebx,%edx,4),%eax
+80101594:	8d 53 38             	lea    0x38(%ebx),%edx
+80101597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010159e:	66 90                	xchg   %ax,%ax
+        pcs[i] = 0;
+801015a0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    for(; i < 10; i++)
+801015a6:	83 c0 04             	add    $0x4,%eax
+801015a9:	39 d0                	cmp    %edx,%eax
+801015ab:	75 f3                	jne    801015a0 <acquire+0xf0>
+801015ad:	eb a0                	jmp    8010154f <acquire+0x9f>
+801015af:	90                   	nop
+    r = lock->next != lock->owner && lock->cpu == mycpu();
+801015b0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+801015b3:	e8 28 6e 00 00       	call   801083e0 <mycpu>
+801015b8:	39 c3                	cmp    %eax,%ebx
+801015ba:	0f 85 1b ff ff ff    	jne    801014db <acquire+0x2b>
+    popcli();
+801015c0:	e8 8b fb ff ff       	call   80101150 <popcli>
+        panic("acquire");
+801015c5:	83 ec 0c             	sub    $0xc,%esp
+801015c8:	68 e9 ad 10 80       	push   $0x8010ade9
+801015cd:	e8 6e 87 00 00       	call   80109d40 <panic>
+801015d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801015d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801015e0 <lockbench>:
+    return (uint)(rdtsc() - t0);
+}
+
+void
+lockbench(void)
+{
+801015e0:	55                   	push   %ebp
+801015e1:	89 e5                	mov    %esp,%ebp
+801015e3:	57                   	push   %edi
+801015e4:	56                   	push   %esi
+801015e5:	53                   	push   %ebx
+801015e6:	83 ec 1c             	sub    $0x1c,%esp
+    static char *names[3] = { "packed", "padded", "shared" };
+    int id, r, c;
+    uint sum;
+
+    pushcli();
+801015e9:	e8 12 fb ff ff       	call   80101100 <pushcli>
+    id = cpuid();
+801015ee:	e8 4d 6e 00 00       	call   80108440 <cpuid>
+801015f3:	89 c7                	mov    %eax,%edi
+801015f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    popcli();
+801015f8:	e8 53 fb ff ff       	call   80101150 <popcli>
+    lk->name = name;
+801015fd:	8d 14 fd 00 00 00 00 	lea    0x0(,%edi,8),%edx
+80101604:	89 f9                	mov    %edi,%ecx
+80101606:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+80101609:	c1 e1 07             	shl    $0x7,%ecx
+8010160c:	c7 81 c8 d0 18 80 fe 	movl   $0x8010adfe,-0x7fe72f38(%ecx)
+80101613:	ad 10 80 
+80101616:	c1 e0 03             	shl    $0x3,%eax
+    lk->next = 0;
+80101619:	c7 80 c0 d6 18 80 00 	movl   $0x0,-0x7fe72940(%eax)
+80101620:	00 00 00 
+    lk->name = name;
+80101623:	c7 80 c8 d6 18 80 f1 	movl   $0x8010adf1,-0x7fe72938(%eax)
+8010162a:	ad 10 80 
+    lk->owner = 0;
+8010162d:	c7 80 c4 d6 18 80 00 	movl   $0x0,-0x7fe7293c(%eax)
+80101634:	00 00 00 
+    lk->cpu = 0;
+80101637:	c7 80 cc d6 18 80 00 	movl   $0x0,-0x7fe72934(%eax)
+8010163e:	00 00 00 
+    lk->next = 0;
+80101641:	c7 81 c0 d0 18 80 00 	movl   $0x0,-0x7fe72f40(%ecx)
+80101648:	00 00 00 
+    lk->cpu = 0;
+8010164b:	c7 81 cc d0 18 80 00 	movl   $0x0,-0x7fe72f34(%ecx)
+80101652:	00 00 00 
+    lk->owner = 0;
+80101655:	c7 81 c4 d0 18 80 00 	movl   $0x0,-0x7fe72f3c(%ecx)
+8010165c:	00 00 00 
+
+    initlock(&packed[id].lk, "bench packed");
+    initlock(&padded[id].b.lk, "bench padded");
+    if (id == 0)
+8010165f:	85 ff                	test   %edi,%edi
+80101661:	75 28                	jne    8010168b <lockbench+0xab>
+    lk->next = 0;
+80101663:	c7 05 40 d0 18 80 00 	movl   $0x0,0x8018d040
+8010166a:	00 00 00 
+    lk->name = name;
+8010166d:	c7 05 48 d0 18 80 0b 	movl   $0x8010ae0b,0x8018d048
+80101674:	ae 10 80 
+    lk->owner = 0;
+80101677:	c7 05 44 d0 18 80 00 	movl   $0x0,0x8018d044
+8010167e:	00 00 00 
+    lk->cpu = 0;
+80101681:	c7 05 4c d0 18 80 00 	movl   $0x0,0x8018d04c
+80101688:	00 00 00 
+    asm volatile("lock; xaddl %0, %1" :
+8010168b:	b8 01 00 00 00       	mov    $0x1,%eax
+80101690:	f0 0f c1 05 10 d0 18 	lock xadd %eax,0x8018d010
+80101697:	80 
+    while (benchdone < n * ncpu)
+80101698:	a1 10 d0 18 80       	mov    0x8018d010,%eax
+8010169d:	3b 05 48 c6 18 80    	cmp    0x8018c648,%eax
+801016a3:	73 12                	jae    801016b7 <lockbench+0xd7>
+801016a5:	8d 76 00             	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+801016a8:	f3 90                	pause
+801016aa:	a1 10 d0 18 80       	mov    0x8018d010,%eax
+801016af:	3b 05 48 c6 18 80    	cmp    0x8018c648,%eax
+801016b5:	72 f1                	jb     801016a8 <lockbench+0xc8>
+        initlock(&shared.lk, "bench shared");
+
+    benchbarrier(1);
+    benchcycles[0][id] = benchround(&packed[id]);
+801016b7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801016ba:	01 c2                	add    %eax,%edx
+801016bc:	8d 1c d5 c0 d6 18 80 	lea    -0x7fe72940(,%edx,8),%ebx
+    asm volatile("rdtsc" : "=A" (tsc));
+801016c3:	0f 31                	rdtsc
+801016c5:	be a0 86 01 00       	mov    $0x186a0,%esi
+801016ca:	89 c7                	mov    %eax,%edi
+    for (i = 0; i < NLOCKBENCH; i++) {
+801016cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        acquire(&b->lk);
+801016d0:	83 ec 0c             	sub    $0xc,%esp
+801016d3:	53                   	push   %ebx
+801016d4:	e8 d7 fd ff ff       	call   801014b0 <acquire>
+        b->n++;
+801016d9:	83 43 44 01          	addl   $0x1,0x44(%ebx)
+        release(&b->lk);
+801016dd:	89 1c 24             	mov    %ebx,(%esp)
+801016e0:	e8 eb fb ff ff       	call   801012d0 <release>
+    for (i = 0; i < NLOCKBENCH; i++) {
+801016e5:	83 c4 10             	add    $0x10,%esp
+801016e8:	83 ee 01             	sub    $0x1,%esi
+801016eb:	75 e3                	jne    801016d0 <lockbench+0xf0>
+801016ed:	0f 31                	rdtsc
+    return (uint)(rdtsc() - t0);
+801016ef:	29 f8                	sub    %edi,%eax
+801016f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801016f4:	89 04 bd 80 cf 18 80 	mov    %eax,-0x7fe73080(,%edi,4)
+    asm volatile("lock; xaddl %0, %1" :
+801016fb:	b8 01 00 00 00       	mov    $0x1,%eax
+80101700:	f0 0f c1 05 10 d0 18 	lock xadd %eax,0x8018d010
+80101707:	80 
+80101708:	eb 08                	jmp    80101712 <lockbench+0x132>
+8010170a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+80101710:	f3 90                	pause
+    while (benchdone < n * ncpu)
+80101712:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80101717:	8b 15 10 d0 18 80    	mov    0x8018d010,%edx
+8010171d:	01 c0                	add    %eax,%eax
+8010171f:	39 c2                	cmp    %eax,%edx
+80101721:	72 ed                	jb     80101710 <lockbench+0x130>
+    benchbarrier(2);
+    benchcycles[1][id] = benchround(&padded[id].b);
+80101723:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101726:	c1 e3 07             	shl    $0x7,%ebx
+80101729:	81 c3 c0 d0 18 80    	add    $0x8018d0c0,%ebx
+    asm volatile("rdtsc" : "=A" (tsc));
+8010172f:	0f 31                	rdtsc
+80101731:	be a0 86 01 00       	mov    $0x186a0,%esi
+80101736:	89 c7                	mov    %eax,%edi
+    for (i = 0; i < NLOCKBENCH; i++) {
+80101738:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010173f:	90                   	nop
+        acquire(&b->lk);
+80101740:	83 ec 0c             	sub    $0xc,%esp
+80101743:	53                   	push   %ebx
+80101744:	e8 67 fd ff ff       	call   801014b0 <acquire>
+        b->n++;
+80101749:	83 43 44 01          	addl   $0x1,0x44(%ebx)
+        release(&b->lk);
+8010174d:	89 1c 24             	mov    %ebx,(%esp)
+80101750:	e8 7b fb ff ff       	call   801012d0 <release>
+    for (i = 0; i < NLOCKBENCH; i++) {
+80101755:	83 c4 10             	add    $0x10,%esp
+80101758:	83 ee 01             	sub    $0x1,%esi
+8010175b:	75 e3                	jne    80101740 <lockbench+0x160>
+8010175d:	0f 31                	rdtsc
+    return (uint)(rdtsc() - t0);
+8010175f:	29 f8                	sub    %edi,%eax
+80101761:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80101764:	89 04 bd b0 cf 18 80 	mov    %eax,-0x7fe73050(,%edi,4)
+    asm volatile("lock; xaddl %0, %1" :
+8010176b:	b8 01 00 00 00       	mov    $0x1,%eax
+80101770:	f0 0f c1 05 10 d0 18 	lock xadd %eax,0x8018d010
+80101777:	80 
+80101778:	eb 08                	jmp    80101782 <lockbench+0x1a2>
+8010177a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+80101780:	f3 90                	pause
+    while (benchdone < n * ncpu)
+80101782:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80101787:	8b 15 10 d0 18 80    	mov    0x8018d010,%edx
+8010178d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80101790:	39 c2                	cmp    %eax,%edx
+80101792:	72 ec                	jb     80101780 <lockbench+0x1a0>
+    asm volatile("rdtsc" : "=A" (tsc));
+80101794:	0f 31                	rdtsc
+80101796:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+8010179b:	89 c6                	mov    %eax,%esi
+    for (i = 0; i < NLOCKBENCH; i++) {
+8010179d:	8d 76 00             	lea    0x0(%esi),%esi
+        acquire(&b->lk);
+801017a0:	83 ec 0c             	sub    $0xc,%esp
+801017a3:	68 40 d0 18 80       	push   $0x8018d040
+801017a8:	e8 03 fd ff ff       	call   801014b0 <acquire>
+        b->n++;
+801017ad:	83 05 84 d0 18 80 01 	addl   $0x1,0x8018d084
+        release(&b->lk);
+801017b4:	c7 04 24 40 d0 18 80 	movl   $0x8018d040,(%esp)
+801017bb:	e8 10 fb ff ff       	call   801012d0 <release>
+    for (i = 0; i < NLOCKBENCH; i++) {
+801017c0:	83 c4 10             	add    $0x10,%esp
+801017c3:	83 eb 01             	sub    $0x1,%ebx
+801017c6:	75 d8                	jne    801017a0 <lockbench+0x1c0>
+801017c8:	0f 31                	rdtsc
+    return (uint)(rdtsc() - t0);
+801017ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801017cd:	29 f0                	sub    %esi,%eax
+801017cf:	89 04 bd e0 cf 18 80 	mov    %eax,-0x7fe73020(,%edi,4)
+    asm volatile("lock; xaddl %0, %1" :
+801017d6:	b8 01 00 00 00       	mov    $0x1,%eax
+801017db:	f0 0f c1 05 10 d0 18 	lock xadd %eax,0x8018d010
+801017e2:	80 
+801017e3:	eb 05                	jmp    801017ea <lockbench+0x20a>
+801017e5:	8d 76 00             	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+801017e8:	f3 90                	pause
+    while (benchdone < n * ncpu)
+801017ea:	8b 3d 48 c6 18 80    	mov    0x8018c648,%edi
+801017f0:	8b 15 10 d0 18 80    	mov    0x8018d010,%edx
+801017f6:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+801017fd:	39 c2                	cmp    %eax,%edx
+801017ff:	72 e7                	jb     801017e8 <lockbench+0x208>
+    benchbarrier(3);
+    benchcycles[2][id] = benchround(&shared);
+    benchbarrier(4);
+
+    if (id != 0)
+80101801:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101804:	85 c0                	test   %eax,%eax
+80101806:	75 7e                	jne    80101886 <lockbench+0x2a6>
+80101808:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010180b:	89 c7                	mov    %eax,%edi
+        return;
+    for (r = 0; r < 3; r++) {
+        sum = 0;
+        for (c = 0; c < ncpu; c++)
+8010180d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    if (id != 0)
+80101810:	c7 45 e0 80 cf 18 80 	movl   $0x8018cf80,-0x20(%ebp)
+        for (c = 0; c < ncpu; c++)
+80101817:	85 c0                	test   %eax,%eax
+80101819:	7e 67                	jle    80101882 <lockbench+0x2a2>
+8010181b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010181e:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+        sum = 0;
+80101821:	31 db                	xor    %ebx,%ebx
+80101823:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+        for (c = 0; c < ncpu; c++)
+80101826:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80101829:	8d 34 85 80 cf 18 80 	lea    -0x7fe73080(,%eax,4),%esi
+            sum += benchcycles[r][c] / NLOCKBENCH;
+80101830:	8b 11                	mov    (%ecx),%edx
+80101832:	b8 c5 5a 7c 0a       	mov    $0xa7c5ac5,%eax
+        for (c = 0; c < ncpu; c++)
+80101837:	83 c1 04             	add    $0x4,%ecx
+            sum += benchcycles[r][c] / NLOCKBENCH;
+8010183a:	c1 ea 05             	shr    $0x5,%edx
+8010183d:	f7 e2                	mul    %edx
+8010183f:	c1 ea 07             	shr    $0x7,%edx
+80101842:	01 d3                	add    %edx,%ebx
+        for (c = 0; c < ncpu; c++)
+80101844:	39 ce                	cmp    %ecx,%esi
+80101846:	75 e8                	jne    80101830 <lockbench+0x250>
+        cprintf("lockbench: %s %d cycles/acquire, %d cpus\n", names[r], sum / ncpu, ncpu);
+80101848:	89 d8                	mov    %ebx,%eax
+8010184a:	31 d2                	xor    %edx,%edx
+8010184c:	f7 75 e4             	divl   -0x1c(%ebp)
+8010184f:	ff 75 e4             	push   -0x1c(%ebp)
+80101852:	50                   	push   %eax
+80101853:	ff 34 bd b0 ae 10 80 	push   -0x7fef5150(,%edi,4)
+8010185a:	68 84 ae 10 80       	push   $0x8010ae84
+8010185f:	e8 5c 85 00 00       	call   80109dc0 <cprintf>
+    for (r = 0; r < 3; r++) {
+80101864:	83 c7 01             	add    $0x1,%edi
+80101867:	83 45 e0 30          	addl   $0x30,-0x20(%ebp)
+8010186b:	83 c4 10             	add    $0x10,%esp
+8010186e:	83 ff 03             	cmp    $0x3,%edi
+80101871:	74 13                	je     80101886 <lockbench+0x2a6>
+80101873:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80101878:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        for (c = 0; c < ncpu; c++)
+8010187b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010187e:	85 c0                	test   %eax,%eax
+80101880:	7f 99                	jg     8010181b <lockbench+0x23b>
+80101882:	31 c0                	xor    %eax,%eax
+80101884:	eb c9                	jmp    8010184f <lockbench+0x26f>
+    }
+}
+80101886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101889:	5b                   	pop    %ebx
+8010188a:	5e                   	pop    %esi
+8010188b:	5f                   	pop    %edi
+8010188c:	5d                   	pop    %ebp
+8010188d:	c3                   	ret
+8010188e:	66 90                	xchg   %ax,%ax
+
+80101890 <initwaitq>:
+// the caller of each function below holds the spinlock that guards both
+// the queue and the condition waited for, as it would for sleep().
+
+void
+initwaitq(struct waitq *wq)
+{
+80101890:	55                   	push   %ebp
+80101891:	89 e5                	mov    %esp,%ebp
+80101893:	8b 45 08             	mov    0x8(%ebp),%eax
+    wq->head = 0;
+80101896:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    wq->tail = 0;
+8010189c:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+801018a3:	5d                   	pop    %ebp
+801018a4:	c3                   	ret
+801018a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801018b0 <waitsleep>:
+// an exclusive waiter is woken by wake_one()/wake_n() only when its turn comes;
+// a non-exclusive one whenever any waiter is. like sleep(), returns with lk
+// held, and the caller should recheck its condition.
+void
+waitsleep(struct waitq *wq, struct spinlock *lk, int excl)
+{
+801018b0:	55                   	push   %ebp
+801018b1:	89 e5                	mov    %esp,%ebp
+801018b3:	57                   	push   %edi
+801018b4:	56                   	push   %esi
+801018b5:	53                   	push   %ebx
+801018b6:	83 ec 0c             	sub    $0xc,%esp
+801018b9:	8b 75 08             	mov    0x8(%ebp),%esi
+801018bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+    struct proc *p = myproc();
+801018bf:	e8 9c 6b 00 00       	call   80108460 <myproc>
+
+    p->wq = wq;
+801018c4:	89 b0 44 02 00 00    	mov    %esi,0x244(%eax)
+    struct proc *p = myproc();
+801018ca:	89 c3                	mov    %eax,%ebx
+    p->wqexcl = excl;
+801018cc:	89 b8 4c 02 00 00    	mov    %edi,0x24c(%eax)
+    if (excl) {
+801018d2:	85 ff                	test   %edi,%edi
+801018d4:	74 52                	je     80101928 <waitsleep+0x78>
+        p->wqnext = 0;
+801018d6:	c7 80 48 02 00 00 00 	movl   $0x0,0x248(%eax)
+801018dd:	00 00 00 
+        if (wq->tail)
+801018e0:	8b 46 04             	mov    0x4(%esi),%eax
+801018e3:	85 c0                	test   %eax,%eax
+801018e5:	0f 84 a5 00 00 00    	je     80101990 <waitsleep+0xe0>
+            wq->tail->wqnext = p;
+801018eb:	89 98 48 02 00 00    	mov    %ebx,0x248(%eax)
+        wq->tail = p;
+    } else {
+        p->wqnext = wq->head;
+        wq->head = p;
+        if (wq->tail == 0)
+            wq->tail = p;
+801018f1:	89 5e 04             	mov    %ebx,0x4(%esi)
+    }
+
+    sleep(wq, lk);
+801018f4:	83 ec 08             	sub    $0x8,%esp
+801018f7:	ff 75 0c             	push   0xc(%ebp)
+801018fa:	56                   	push   %esi
+801018fb:	e8 10 70 00 00       	call   80108910 <sleep>
+
+    // woken by someone else, e.g. kill()
+    if (p->wq)
+80101900:	8b 83 44 02 00 00    	mov    0x244(%ebx),%eax
+80101906:	83 c4 10             	add    $0x10,%esp
+80101909:	85 c0                	test   %eax,%eax
+8010190b:	74 57                	je     80101964 <waitsleep+0xb4>
+    for (q = wq->head; q; prev = q, q = q->wqnext) {
+8010190d:	8b 06                	mov    (%esi),%eax
+8010190f:	85 c0                	test   %eax,%eax
+80101911:	74 3d                	je     80101950 <waitsleep+0xa0>
+        if (q == p) {
+80101913:	39 c3                	cmp    %eax,%ebx
+80101915:	75 2d                	jne    80101944 <waitsleep+0x94>
+                wq->head = p->wqnext;
+80101917:	8b 83 48 02 00 00    	mov    0x248(%ebx),%eax
+8010191d:	31 d2                	xor    %edx,%edx
+8010191f:	89 06                	mov    %eax,(%esi)
+80101921:	eb 59                	jmp    8010197c <waitsleep+0xcc>
+80101923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101927:	90                   	nop
+        p->wqnext = wq->head;
+80101928:	8b 06                	mov    (%esi),%eax
+8010192a:	89 83 48 02 00 00    	mov    %eax,0x248(%ebx)
+        if (wq->tail == 0)
+80101930:	8b 56 04             	mov    0x4(%esi),%edx
+        wq->head = p;
+80101933:	89 1e                	mov    %ebx,(%esi)
+        if (wq->tail == 0)
+80101935:	85 d2                	test   %edx,%edx
+80101937:	75 bb                	jne    801018f4 <waitsleep+0x44>
+            wq->tail = p;
+80101939:	89 5e 04             	mov    %ebx,0x4(%esi)
+8010193c:	eb b6                	jmp    801018f4 <waitsleep+0x44>
+8010193e:	66 90                	xchg   %ax,%ax
+        if (q == p) {
+80101940:	39 c3                	cmp    %eax,%ebx
+80101942:	74 2c                	je     80101970 <waitsleep+0xc0>
+    for (q = wq->head; q; prev = q, q = q->wqnext) {
+80101944:	89 c2                	mov    %eax,%edx
+80101946:	8b 80 48 02 00 00    	mov    0x248(%eax),%eax
+8010194c:	85 c0                	test   %eax,%eax
+8010194e:	75 f0                	jne    80101940 <waitsleep+0x90>
+    p->wqnext = 0;
+80101950:	c7 83 48 02 00 00 00 	movl   $0x0,0x248(%ebx)
+80101957:	00 00 00 
+    p->wq = 0;
+8010195a:	c7 83 44 02 00 00 00 	movl   $0x0,0x244(%ebx)
+80101961:	00 00 00 
+        waitqremove(wq, p);
+}
+80101964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101967:	5b                   	pop    %ebx
+80101968:	5e                   	pop    %esi
+80101969:	5f                   	pop    %edi
+8010196a:	5d                   	pop    %ebp
+8010196b:	c3                   	ret
+8010196c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+                prev->wqnext = p->wqnext;
+80101970:	8b 83 48 02 00 00    	mov    0x248(%ebx),%eax
+80101976:	89 82 48 02 00 00    	mov    %eax,0x248(%edx)
+            if (wq->tail == p)
+8010197c:	3b 5e 04             	cmp    0x4(%esi),%ebx
+8010197f:	75 cf                	jne    80101950 <waitsleep+0xa0>
+                wq->tail = prev;
+80101981:	89 56 04             	mov    %edx,0x4(%esi)
+80101984:	eb ca                	jmp    80101950 <waitsleep+0xa0>
+80101986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010198d:	8d 76 00             	lea    0x0(%esi),%esi
+            wq->head = p;
+80101990:	89 1e                	mov    %ebx,(%esi)
+            wq->tail = p;
+80101992:	89 5e 04             	mov    %ebx,0x4(%esi)
+80101995:	e9 5a ff ff ff       	jmp    801018f4 <waitsleep+0x44>
+8010199a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801019a0 <wake_n>:
+
+// wake the non-exclusive waiters in wq and the first n exclusive ones.
+// returns the number of processes woken.
+int
+wake_n(struct waitq *wq, int n)
+{
+801019a0:	55                   	push   %ebp
+801019a1:	89 e5                	mov    %esp,%ebp
+801019a3:	57                   	push   %edi
+801019a4:	56                   	push   %esi
+    struct proc *p;
+    int woken = 0;
+801019a5:	31 f6                	xor    %esi,%esi
+{
+801019a7:	53                   	push   %ebx
+801019a8:	83 ec 0c             	sub    $0xc,%esp
+801019ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801019ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+
+    while ((p = wq->head) != 0 && (!p->wqexcl || n > 0)) {
+801019b1:	8b 03                	mov    (%ebx),%eax
+801019b3:	85 c0                	test   %eax,%eax
+801019b5:	75 3d                	jne    801019f4 <wake_n+0x54>
+801019b7:	eb 67                	jmp    80101a20 <wake_n+0x80>
+801019b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wq->head = p->wqnext;
+        if (wq->head == 0)
+            wq->tail = 0;
+        if (p->wqexcl)
+            n--;
+801019c0:	83 b8 4c 02 00 00 01 	cmpl   $0x1,0x24c(%eax)
+        p->wqnext = 0;
+801019c7:	c7 80 48 02 00 00 00 	movl   $0x0,0x248(%eax)
+801019ce:	00 00 00 
+        p->wq = 0;
+801019d1:	c7 80 44 02 00 00 00 	movl   $0x0,0x244(%eax)
+801019d8:	00 00 00 
+            n--;
+801019db:	83 d7 ff             	adc    $0xffffffff,%edi
+        wakeproc(p, wq);
+801019de:	83 ec 08             	sub    $0x8,%esp
+        woken++;
+801019e1:	83 c6 01             	add    $0x1,%esi
+        wakeproc(p, wq);
+801019e4:	53                   	push   %ebx
+801019e5:	50                   	push   %eax
+801019e6:	e8 e5 6f 00 00       	call   801089d0 <wakeproc>
+    while ((p = wq->head) != 0 && (!p->wqexcl || n > 0)) {
+801019eb:	8b 03                	mov    (%ebx),%eax
+801019ed:	83 c4 10             	add    $0x10,%esp
+801019f0:	85 c0                	test   %eax,%eax
+801019f2:	74 2c                	je     80101a20 <wake_n+0x80>
+801019f4:	8b 90 4c 02 00 00    	mov    0x24c(%eax),%edx
+801019fa:	85 d2                	test   %edx,%edx
+801019fc:	74 04                	je     80101a02 <wake_n+0x62>
+801019fe:	85 ff                	test   %edi,%edi
+80101a00:	7e 1e                	jle    80101a20 <wake_n+0x80>
+        wq->head = p->wqnext;
+80101a02:	8b 90 48 02 00 00    	mov    0x248(%eax),%edx
+80101a08:	89 13                	mov    %edx,(%ebx)
+        if (wq->head == 0)
+80101a0a:	85 d2                	test   %edx,%edx
+80101a0c:	75 b2                	jne    801019c0 <wake_n+0x20>
+            wq->tail = 0;
+80101a0e:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+80101a15:	eb a9                	jmp    801019c0 <wake_n+0x20>
+80101a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a1e:	66 90                	xchg   %ax,%ax
+    }
+    return woken;
+}
+80101a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a23:	89 f0                	mov    %esi,%eax
+80101a25:	5b                   	pop    %ebx
+80101a26:	5e                   	pop    %esi
+80101a27:	5f                   	pop    %edi
+80101a28:	5d                   	pop    %ebp
+80101a29:	c3                   	ret
+80101a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101a30 <wake_one>:
+
+int
+wake_one(struct waitq *wq)
+{
+80101a30:	55                   	push   %ebp
+80101a31:	89 e5                	mov    %esp,%ebp
+80101a33:	83 ec 10             	sub    $0x10,%esp
+    return wake_n(wq, 1);
+80101a36:	6a 01                	push   $0x1
+80101a38:	ff 75 08             	push   0x8(%ebp)
+80101a3b:	e8 60 ff ff ff       	call   801019a0 <wake_n>
+}
+80101a40:	c9                   	leave
+80101a41:	c3                   	ret
+80101a42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101a50 <wake_all>:
+
+int
+wake_all(struct waitq *wq)
+{
+80101a50:	55                   	push   %ebp
+80101a51:	89 e5                	mov    %esp,%ebp
+80101a53:	83 ec 10             	sub    $0x10,%esp
+    return wake_n(wq, NPROC);
+80101a56:	6a 40                	push   $0x40
+80101a58:	ff 75 08             	push   0x8(%ebp)
+80101a5b:	e8 40 ff ff ff       	call   801019a0 <wake_n>
+}
+80101a60:	c9                   	leave
+80101a61:	c3                   	ret
+80101a62:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101a70 <initsleeplock>:
+
+#define SPINMAX     1000    // pause()s to wait for a running holder before sleeping
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+80101a70:	55                   	push   %ebp
+80101a71:	89 e5                	mov    %esp,%ebp
+80101a73:	53                   	push   %ebx
+80101a74:	83 ec 0c             	sub    $0xc,%esp
+80101a77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    initlock(&lk->lk, "sleep lock");
+80101a7a:	68 bc ae 10 80       	push   $0x8010aebc
+80101a7f:	8d 43 04             	lea    0x4(%ebx),%eax
+80101a82:	50                   	push   %eax
+80101a83:	e8 b8 f5 ff ff       	call   80101040 <initlock>
+    lk->name = name;
+80101a88:	8b 45 0c             	mov    0xc(%ebp),%eax
+    lk->locked = 0;
+    lk->owner = 0;
+    initwaitq(&lk->wq);
+    lk->pid = 0;
+}
+80101a8b:	83 c4 10             	add    $0x10,%esp
+    lk->locked = 0;
+80101a8e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    lk->owner = 0;
+80101a94:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+    lk->name = name;
+80101a9b:	89 43 54             	mov    %eax,0x54(%ebx)
+    wq->head = 0;
+80101a9e:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+    wq->tail = 0;
+80101aa5:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+    lk->pid = 0;
+80101aac:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+}
+80101ab3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101ab6:	c9                   	leave
+80101ab7:	c3                   	ret
+80101ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101abf:	90                   	nop
+
+80101ac0 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80101ac0:	55                   	push   %ebp
+80101ac1:	89 e5                	mov    %esp,%ebp
+80101ac3:	57                   	push   %edi
+80101ac4:	56                   	push   %esi
+80101ac5:	53                   	push   %ebx
+80101ac6:	83 ec 4c             	sub    $0x4c,%esp
+    struct proc *p = myproc();
+80101ac9:	e8 92 69 00 00       	call   80108460 <myproc>
+80101ace:	89 c6                	mov    %eax,%esi
+    asm volatile("rdtsc" : "=A" (tsc));
+80101ad0:	0f 31                	rdtsc
+80101ad2:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80101ad7:	89 45 b0             	mov    %eax,-0x50(%ebp)
+80101ada:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+#endif
+
+    // a holder running on another cpu will likely release soon;
+    // waiting for it is cheaper than sleeping and being woken.
+    // a holder that is not running could take arbitrarily long.
+    for (n = 0; n < SPINMAX && lk->locked; n++) {
+80101add:	eb 19                	jmp    80101af8 <acquiresleep+0x38>
+80101adf:	90                   	nop
+        owner = lk->owner;
+80101ae0:	8b 50 48             	mov    0x48(%eax),%edx
+        if (owner == 0 || owner->state != RUNNING)
+80101ae3:	85 d2                	test   %edx,%edx
+80101ae5:	74 1a                	je     80101b01 <acquiresleep+0x41>
+80101ae7:	83 7a 0c 04          	cmpl   $0x4,0xc(%edx)
+80101aeb:	75 14                	jne    80101b01 <acquiresleep+0x41>
+    asm volatile("pause" ::: "memory");
+80101aed:	f3 90                	pause
+    for (n = 0; n < SPINMAX && lk->locked; n++) {
+80101aef:	83 e9 01             	sub    $0x1,%ecx
+80101af2:	0f 84 bc 00 00 00    	je     80101bb4 <acquiresleep+0xf4>
+80101af8:	8b 45 08             	mov    0x8(%ebp),%eax
+80101afb:	8b 18                	mov    (%eax),%ebx
+80101afd:	85 db                	test   %ebx,%ebx
+80101aff:	75 df                	jne    80101ae0 <acquiresleep+0x20>
+            break;
+        pause();
+    }
+
+    acquire(&lk->lk);
+80101b01:	83 ec 0c             	sub    $0xc,%esp
+80101b04:	83 c0 04             	add    $0x4,%eax
+80101b07:	50                   	push   %eax
+80101b08:	e8 a3 f9 ff ff       	call   801014b0 <acquire>
+#ifdef LOCKSTAT
+    contended = lk->locked;
+80101b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+#endif
+    if (lk->locked) {
+80101b10:	83 c4 10             	add    $0x10,%esp
+    contended = lk->locked;
+80101b13:	8b 18                	mov    (%eax),%ebx
+    if (lk->locked) {
+80101b15:	85 db                	test   %ebx,%ebx
+80101b17:	0f 84 83 00 00 00    	je     80101ba0 <acquiresleep+0xe0>
+        // wait in line; releasesleep() makes us the owner before waking us.
+        while (lk->owner != p)
+80101b1d:	3b 70 48             	cmp    0x48(%eax),%esi
+80101b20:	74 23                	je     80101b45 <acquiresleep+0x85>
+80101b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            waitsleep(&lk->wq, &lk->lk, 1);
+80101b28:	83 ec 04             	sub    $0x4,%esp
+80101b2b:	8d 50 04             	lea    0x4(%eax),%edx
+80101b2e:	83 c0 4c             	add    $0x4c,%eax
+80101b31:	6a 01                	push   $0x1
+80101b33:	52                   	push   %edx
+80101b34:	50                   	push   %eax
+80101b35:	e8 76 fd ff ff       	call   801018b0 <waitsleep>
+        while (lk->owner != p)
+80101b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+80101b3d:	83 c4 10             	add    $0x10,%esp
+80101b40:	39 70 48             	cmp    %esi,0x48(%eax)
+80101b43:	75 e3                	jne    80101b28 <acquiresleep+0x68>
+        lk->locked = 1;
+        lk->owner = p;
+        lk->pid = p->pid;
+    }
+#ifdef LOCKSTAT
+    getcallerpcs(&lk, pcs);
+80101b45:	83 ec 08             	sub    $0x8,%esp
+80101b48:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80101b4b:	50                   	push   %eax
+80101b4c:	8d 45 08             	lea    0x8(%ebp),%eax
+80101b4f:	50                   	push   %eax
+80101b50:	e8 3b f5 ff ff       	call   80101090 <getcallerpcs>
+    lk->pc = pcs[0];
+80101b55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80101b58:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80101b5b:	89 41 5c             	mov    %eax,0x5c(%ecx)
+    asm volatile("rdtsc" : "=A" (tsc));
+80101b5e:	0f 31                	rdtsc
+    lk->tsc = rdtsc();
+80101b60:	89 41 60             	mov    %eax,0x60(%ecx)
+    lockstatacquired(lockstatget(lk->name, lk->pc), contended, lk->tsc - t0);
+80101b63:	2b 45 b0             	sub    -0x50(%ebp),%eax
+    lk->tsc = rdtsc();
+80101b66:	89 51 64             	mov    %edx,0x64(%ecx)
+    lockstatacquired(lockstatget(lk->name, lk->pc), contended, lk->tsc - t0);
+80101b69:	1b 55 b4             	sbb    -0x4c(%ebp),%edx
+80101b6c:	89 c6                	mov    %eax,%esi
+80101b6e:	89 d7                	mov    %edx,%edi
+80101b70:	58                   	pop    %eax
+80101b71:	5a                   	pop    %edx
+80101b72:	ff 75 c0             	push   -0x40(%ebp)
+80101b75:	ff 71 54             	push   0x54(%ecx)
+80101b78:	e8 13 46 00 00       	call   80106190 <lockstatget>
+80101b7d:	57                   	push   %edi
+80101b7e:	56                   	push   %esi
+80101b7f:	53                   	push   %ebx
+80101b80:	50                   	push   %eax
+80101b81:	e8 9a 46 00 00       	call   80106220 <lockstatacquired>
+#endif
+    release(&lk->lk);
+80101b86:	8b 45 08             	mov    0x8(%ebp),%eax
+80101b89:	83 c4 14             	add    $0x14,%esp
+80101b8c:	83 c0 04             	add    $0x4,%eax
+80101b8f:	50                   	push   %eax
+80101b90:	e8 3b f7 ff ff       	call   801012d0 <release>
+}
+80101b95:	83 c4 10             	add    $0x10,%esp
+80101b98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101b9b:	5b                   	pop    %ebx
+80101b9c:	5e                   	pop    %esi
+80101b9d:	5f                   	pop    %edi
+80101b9e:	5d                   	pop    %ebp
+80101b9f:	c3                   	ret
+        lk->locked = 1;
+80101ba0:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+        lk->owner = p;
+80101ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+80101ba9:	89 70 48             	mov    %esi,0x48(%eax)
+        lk->pid = p->pid;
+80101bac:	8b 56 10             	mov    0x10(%esi),%edx
+80101baf:	89 50 58             	mov    %edx,0x58(%eax)
+80101bb2:	eb 91                	jmp    80101b45 <acquiresleep+0x85>
+    acquire(&lk->lk);
+80101bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+80101bb7:	e9 45 ff ff ff       	jmp    80101b01 <acquiresleep+0x41>
+80101bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101bc0 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80101bc0:	55                   	push   %ebp
+80101bc1:	89 e5                	mov    %esp,%ebp
+80101bc3:	57                   	push   %edi
+80101bc4:	56                   	push   %esi
+80101bc5:	53                   	push   %ebx
+80101bc6:	83 ec 28             	sub    $0x28,%esp
+80101bc9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    struct proc *p;
+
+    acquire(&lk->lk);
+80101bcc:	8d 43 04             	lea    0x4(%ebx),%eax
+80101bcf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80101bd2:	50                   	push   %eax
+80101bd3:	e8 d8 f8 ff ff       	call   801014b0 <acquire>
+#ifdef LOCKSTAT
+    lockstatreleased(lockstatget(lk->name, lk->pc), lk->tsc);
+80101bd8:	58                   	pop    %eax
+80101bd9:	8b 73 60             	mov    0x60(%ebx),%esi
+80101bdc:	5a                   	pop    %edx
+80101bdd:	8b 7b 64             	mov    0x64(%ebx),%edi
+80101be0:	ff 73 5c             	push   0x5c(%ebx)
+80101be3:	ff 73 54             	push   0x54(%ebx)
+80101be6:	e8 a5 45 00 00       	call   80106190 <lockstatget>
+80101beb:	83 c4 0c             	add    $0xc,%esp
+80101bee:	57                   	push   %edi
+80101bef:	56                   	push   %esi
+80101bf0:	50                   	push   %eax
+80101bf1:	e8 6a 46 00 00       	call   80106260 <lockstatreleased>
+#endif
+    if ((p = lk->wq.head) != 0) {
+80101bf6:	8b 43 4c             	mov    0x4c(%ebx),%eax
+80101bf9:	83 c4 10             	add    $0x10,%esp
+80101bfc:	85 c0                	test   %eax,%eax
+80101bfe:	74 30                	je     80101c30 <releasesleep+0x70>
+        // hand the lock to the first waiter, which keeps it locked
+        // and lets nobody else slip in before the waiter runs.
+        lk->owner = p;
+80101c00:	89 43 48             	mov    %eax,0x48(%ebx)
+        lk->pid = p->pid;
+80101c03:	8b 40 10             	mov    0x10(%eax),%eax
+    return wake_n(wq, 1);
+80101c06:	83 ec 08             	sub    $0x8,%esp
+        wake_one(&lk->wq);
+80101c09:	8d 53 4c             	lea    0x4c(%ebx),%edx
+        lk->pid = p->pid;
+80101c0c:	89 43 58             	mov    %eax,0x58(%ebx)
+    return wake_n(wq, 1);
+80101c0f:	6a 01                	push   $0x1
+80101c11:	52                   	push   %edx
+80101c12:	e8 89 fd ff ff       	call   801019a0 <wake_n>
+80101c17:	83 c4 10             	add    $0x10,%esp
+    } else {
+        lk->locked = 0;
+        lk->owner = 0;
+        lk->pid = 0;
+    }
+    release(&lk->lk);
+80101c1a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101c1d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101c20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c23:	5b                   	pop    %ebx
+80101c24:	5e                   	pop    %esi
+80101c25:	5f                   	pop    %edi
+80101c26:	5d                   	pop    %ebp
+    release(&lk->lk);
+80101c27:	e9 a4 f6 ff ff       	jmp    801012d0 <release>
+80101c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        lk->locked = 0;
+80101c30:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+        lk->owner = 0;
+80101c36:	c7 43 48 00 00 00 00 	movl   $0x0,0x48(%ebx)
+        lk->pid = 0;
+80101c3d:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+80101c44:	eb d4                	jmp    80101c1a <releasesleep+0x5a>
+80101c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101c50 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80101c50:	55                   	push   %ebp
+80101c51:	89 e5                	mov    %esp,%ebp
+80101c53:	57                   	push   %edi
+80101c54:	31 ff                	xor    %edi,%edi
+80101c56:	56                   	push   %esi
+80101c57:	53                   	push   %ebx
+80101c58:	83 ec 18             	sub    $0x18,%esp
+80101c5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    int r;
+
+    acquire(&lk->lk);
+80101c5e:	8d 73 04             	lea    0x4(%ebx),%esi
+80101c61:	56                   	push   %esi
+80101c62:	e8 49 f8 ff ff       	call   801014b0 <acquire>
+    r = lk->locked && lk->owner == myproc();
+80101c67:	8b 03                	mov    (%ebx),%eax
+80101c69:	83 c4 10             	add    $0x10,%esp
+80101c6c:	85 c0                	test   %eax,%eax
+80101c6e:	75 18                	jne    80101c88 <holdingsleep+0x38>
+    release(&lk->lk);
+80101c70:	83 ec 0c             	sub    $0xc,%esp
+80101c73:	56                   	push   %esi
+80101c74:	e8 57 f6 ff ff       	call   801012d0 <release>
+    return r;
+}
+80101c79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c7c:	89 f8                	mov    %edi,%eax
+80101c7e:	5b                   	pop    %ebx
+80101c7f:	5e                   	pop    %esi
+80101c80:	5f                   	pop    %edi
+80101c81:	5d                   	pop    %ebp
+80101c82:	c3                   	ret
+80101c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101c87:	90                   	nop
+    r = lk->locked && lk->owner == myproc();
+80101c88:	8b 5b 48             	mov    0x48(%ebx),%ebx
+80101c8b:	e8 d0 67 00 00       	call   80108460 <myproc>
+80101c90:	39 c3                	cmp    %eax,%ebx
+80101c92:	0f 94 c0             	sete   %al
+80101c95:	0f b6 c0             	movzbl %al,%eax
+80101c98:	89 c7                	mov    %eax,%edi
+80101c9a:	eb d4                	jmp    80101c70 <holdingsleep+0x20>
+80101c9c:	66 90                	xchg   %ax,%ax
+80101c9e:	66 90                	xchg   %ax,%ax
+
+80101ca0 <rcuadvance>:
+}
+
+// advance the epoch if every started, online cpu has seen the current one
+static void
+rcuadvance(uint e)
+{
+80101ca0:	55                   	push   %ebp
+80101ca1:	89 e5                	mov    %esp,%ebp
+80101ca3:	53                   	push   %ebx
+    struct cpu *c;
+
+    for (c = cpus; c < cpus + ncpu; c++)
+80101ca4:	8b 15 48 c6 18 80    	mov    0x8018c648,%edx
+80101caa:	8d 1c 52             	lea    (%edx,%edx,2),%ebx
+80101cad:	c1 e3 06             	shl    $0x6,%ebx
+80101cb0:	81 c3 80 c6 18 80    	add    $0x8018c680,%ebx
+80101cb6:	81 fb 80 c6 18 80    	cmp    $0x8018c680,%ebx
+80101cbc:	76 32                	jbe    80101cf0 <rcuadvance+0x50>
+80101cbe:	ba 80 c6 18 80       	mov    $0x8018c680,%edx
+80101cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101cc7:	90                   	nop
+        if (c->started && !c->rcuoff && c->rcuepoch != e)
+80101cc8:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+80101cce:	85 c9                	test   %ecx,%ecx
+80101cd0:	74 14                	je     80101ce6 <rcuadvance+0x46>
+80101cd2:	8b 8a bc 00 00 00    	mov    0xbc(%edx),%ecx
+80101cd8:	85 c9                	test   %ecx,%ecx
+80101cda:	75 0a                	jne    80101ce6 <rcuadvance+0x46>
+80101cdc:	8b 8a b8 00 00 00    	mov    0xb8(%edx),%ecx
+80101ce2:	39 c1                	cmp    %eax,%ecx
+80101ce4:	75 15                	jne    80101cfb <rcuadvance+0x5b>
+    for (c = cpus; c < cpus + ncpu; c++)
+80101ce6:	81 c2 c0 00 00 00    	add    $0xc0,%edx
+80101cec:	39 da                	cmp    %ebx,%edx
+80101cee:	72 d8                	jb     80101cc8 <rcuadvance+0x28>
+            return;
+    __sync_bool_compare_and_swap(&rcu.epoch, e, e + 1);
+80101cf0:	8d 50 01             	lea    0x1(%eax),%edx
+80101cf3:	f0 0f b1 15 64 da 18 	lock cmpxchg %edx,0x8018da64
+80101cfa:	80 
+}
+80101cfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101cfe:	c9                   	leave
+80101cff:	c3                   	ret
+
+80101d00 <rcuinit>:
+{
+80101d00:	55                   	push   %ebp
+80101d01:	89 e5                	mov    %esp,%ebp
+80101d03:	83 ec 10             	sub    $0x10,%esp
+    initlock(&rcu.lock, "rcu");
+80101d06:	68 c7 ae 10 80       	push   $0x8010aec7
+80101d0b:	68 20 da 18 80       	push   $0x8018da20
+80101d10:	e8 2b f3 ff ff       	call   80101040 <initlock>
+}
+80101d15:	83 c4 10             	add    $0x10,%esp
+    rcu.epoch = 0;
+80101d18:	c7 05 64 da 18 80 00 	movl   $0x0,0x8018da64
+80101d1f:	00 00 00 
+    rcu.head = 0;
+80101d22:	c7 05 68 da 18 80 00 	movl   $0x0,0x8018da68
+80101d29:	00 00 00 
+    rcu.tail = &rcu.head;
+80101d2c:	c7 05 6c da 18 80 68 	movl   $0x8018da68,0x8018da6c
+80101d33:	da 18 80 
+}
+80101d36:	c9                   	leave
+80101d37:	c3                   	ret
+80101d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d3f:	90                   	nop
+
+80101d40 <rcureadlock>:
+    pushcli();
+80101d40:	e9 bb f3 ff ff       	jmp    80101100 <pushcli>
+80101d45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101d50 <rcureadunlock>:
+    popcli();
+80101d50:	e9 fb f3 ff ff       	jmp    80101150 <popcli>
+80101d55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101d60 <rcuquiesce>:
+
+// the calling cpu holds no rcu references.
+// called from scheduler(), with no locks held.
+void
+rcuquiesce(void)
+{
+80101d60:	55                   	push   %ebp
+80101d61:	89 e5                	mov    %esp,%ebp
+80101d63:	56                   	push   %esi
+80101d64:	53                   	push   %ebx
+    struct rcuhead *done, *r;
+    uint e;
+
+    pushcli();
+80101d65:	e8 96 f3 ff ff       	call   80101100 <pushcli>
+    e = rcu.epoch;
+80101d6a:	8b 1d 64 da 18 80    	mov    0x8018da64,%ebx
+    mycpu()->rcuepoch = e;
+80101d70:	e8 6b 66 00 00       	call   801083e0 <mycpu>
+80101d75:	89 98 b8 00 00 00    	mov    %ebx,0xb8(%eax)
+    mycpu()->rcuoff = 0;
+80101d7b:	e8 60 66 00 00       	call   801083e0 <mycpu>
+80101d80:	c7 80 bc 00 00 00 00 	movl   $0x0,0xbc(%eax)
+80101d87:	00 00 00 
+    rcuadvance(e);
+80101d8a:	89 d8                	mov    %ebx,%eax
+80101d8c:	e8 0f ff ff ff       	call   80101ca0 <rcuadvance>
+    popcli();
+80101d91:	e8 ba f3 ff ff       	call   80101150 <popcli>
+
+    if (rcu.head == 0)
+80101d96:	8b 15 68 da 18 80    	mov    0x8018da68,%edx
+80101d9c:	85 d2                	test   %edx,%edx
+80101d9e:	0f 84 7e 00 00 00    	je     80101e22 <rcuquiesce+0xc2>
+        return;
+
+    // take the callbacks whose grace period has ended
+    acquire(&rcu.lock);
+80101da4:	83 ec 0c             	sub    $0xc,%esp
+80101da7:	68 20 da 18 80       	push   $0x8018da20
+80101dac:	e8 ff f6 ff ff       	call   801014b0 <acquire>
+    e = rcu.epoch;
+    done = rcu.head;
+80101db1:	8b 1d 68 da 18 80    	mov    0x8018da68,%ebx
+    e = rcu.epoch;
+80101db7:	8b 35 64 da 18 80    	mov    0x8018da64,%esi
+    for (r = 0; rcu.head && e - rcu.head->epoch >= 2; rcu.head = rcu.head->next)
+80101dbd:	31 c9                	xor    %ecx,%ecx
+80101dbf:	83 c4 10             	add    $0x10,%esp
+80101dc2:	89 d8                	mov    %ebx,%eax
+80101dc4:	85 db                	test   %ebx,%ebx
+80101dc6:	75 18                	jne    80101de0 <rcuquiesce+0x80>
+80101dc8:	eb 76                	jmp    80101e40 <rcuquiesce+0xe0>
+80101dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101dd0:	8b 10                	mov    (%eax),%edx
+80101dd2:	89 c1                	mov    %eax,%ecx
+80101dd4:	89 15 68 da 18 80    	mov    %edx,0x8018da68
+80101dda:	85 d2                	test   %edx,%edx
+80101ddc:	74 12                	je     80101df0 <rcuquiesce+0x90>
+80101dde:	89 d0                	mov    %edx,%eax
+80101de0:	89 f2                	mov    %esi,%edx
+80101de2:	2b 50 08             	sub    0x8(%eax),%edx
+80101de5:	83 fa 01             	cmp    $0x1,%edx
+80101de8:	77 e6                	ja     80101dd0 <rcuquiesce+0x70>
+        r = rcu.head;
+    if (r == 0) {
+80101dea:	85 c9                	test   %ecx,%ecx
+80101dec:	74 52                	je     80101e40 <rcuquiesce+0xe0>
+80101dee:	89 c8                	mov    %ecx,%eax
+        release(&rcu.lock);
+        return;
+    }
+    r->next = 0;
+80101df0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    if (rcu.head == 0)
+80101df6:	a1 68 da 18 80       	mov    0x8018da68,%eax
+80101dfb:	85 c0                	test   %eax,%eax
+80101dfd:	74 31                	je     80101e30 <rcuquiesce+0xd0>
+        rcu.tail = &rcu.head;
+    release(&rcu.lock);
+80101dff:	83 ec 0c             	sub    $0xc,%esp
+80101e02:	68 20 da 18 80       	push   $0x8018da20
+80101e07:	e8 c4 f4 ff ff       	call   801012d0 <release>
+80101e0c:	83 c4 10             	add    $0x10,%esp
+80101e0f:	90                   	nop
+
+    while (done) {
+        r = done;
+        done = done->next;
+80101e10:	89 d8                	mov    %ebx,%eax
+        r->func(r);
+80101e12:	83 ec 0c             	sub    $0xc,%esp
+        done = done->next;
+80101e15:	8b 1b                	mov    (%ebx),%ebx
+        r->func(r);
+80101e17:	50                   	push   %eax
+80101e18:	ff 50 04             	call   *0x4(%eax)
+    while (done) {
+80101e1b:	83 c4 10             	add    $0x10,%esp
+80101e1e:	85 db                	test   %ebx,%ebx
+80101e20:	75 ee                	jne    80101e10 <rcuquiesce+0xb0>
+    }
+}
+80101e22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101e25:	5b                   	pop    %ebx
+80101e26:	5e                   	pop    %esi
+80101e27:	5d                   	pop    %ebp
+80101e28:	c3                   	ret
+80101e29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        rcu.tail = &rcu.head;
+80101e30:	c7 05 6c da 18 80 68 	movl   $0x8018da68,0x8018da6c
+80101e37:	da 18 80 
+80101e3a:	eb c3                	jmp    80101dff <rcuquiesce+0x9f>
+80101e3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        release(&rcu.lock);
+80101e40:	83 ec 0c             	sub    $0xc,%esp
+80101e43:	68 20 da 18 80       	push   $0x8018da20
+80101e48:	e8 83 f4 ff ff       	call   801012d0 <release>
+        return;
+80101e4d:	83 c4 10             	add    $0x10,%esp
+80101e50:	eb d0                	jmp    80101e22 <rcuquiesce+0xc2>
+80101e52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101e59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101e60 <rcuoffline>:
+
+// the calling cpu won't read again until its next rcuquiesce():
+// stop waiting for it, or the epoch could never advance.
+void
+rcuoffline(void)
+{
+80101e60:	55                   	push   %ebp
+80101e61:	89 e5                	mov    %esp,%ebp
+80101e63:	83 ec 08             	sub    $0x8,%esp
+    pushcli();
+80101e66:	e8 95 f2 ff ff       	call   80101100 <pushcli>
+    mycpu()->rcuoff = 1;
+80101e6b:	e8 70 65 00 00       	call   801083e0 <mycpu>
+80101e70:	c7 80 bc 00 00 00 01 	movl   $0x1,0xbc(%eax)
+80101e77:	00 00 00 
+    rcuadvance(rcu.epoch);
+80101e7a:	a1 64 da 18 80       	mov    0x8018da64,%eax
+80101e7f:	e8 1c fe ff ff       	call   80101ca0 <rcuadvance>
+    popcli();
+}
+80101e84:	c9                   	leave
+    popcli();
+80101e85:	e9 c6 f2 ff ff       	jmp    80101150 <popcli>
+80101e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101e90 <callrcu>:
+// call func(r) once every reader that might hold a reference
+// to the object r belongs to has left its read section.
+// the caller must already have unlinked the object.
+void
+callrcu(struct rcuhead *r, void (*func)(struct rcuhead*))
+{
+80101e90:	55                   	push   %ebp
+80101e91:	89 e5                	mov    %esp,%ebp
+80101e93:	53                   	push   %ebx
+80101e94:	83 ec 10             	sub    $0x10,%esp
+80101e97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    r->func = func;
+80101e9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    r->next = 0;
+80101e9d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    r->func = func;
+80101ea3:	89 43 04             	mov    %eax,0x4(%ebx)
+    acquire(&rcu.lock);
+80101ea6:	68 20 da 18 80       	push   $0x8018da20
+80101eab:	e8 00 f6 ff ff       	call   801014b0 <acquire>
+    r->epoch = rcu.epoch;
+80101eb0:	a1 64 da 18 80       	mov    0x8018da64,%eax
+    *rcu.tail = r;
+    rcu.tail = &r->next;
+    release(&rcu.lock);
+80101eb5:	83 c4 10             	add    $0x10,%esp
+    r->epoch = rcu.epoch;
+80101eb8:	89 43 08             	mov    %eax,0x8(%ebx)
+    *rcu.tail = r;
+80101ebb:	a1 6c da 18 80       	mov    0x8018da6c,%eax
+80101ec0:	89 18                	mov    %ebx,(%eax)
+    rcu.tail = &r->next;
+80101ec2:	89 1d 6c da 18 80    	mov    %ebx,0x8018da6c
+}
+80101ec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    release(&rcu.lock);
+80101ecb:	c7 45 08 20 da 18 80 	movl   $0x8018da20,0x8(%ebp)
+}
+80101ed2:	c9                   	leave
+    release(&rcu.lock);
+80101ed3:	e9 f8 f3 ff ff       	jmp    801012d0 <release>
+80101ed8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101edf:	90                   	nop
+
+80101ee0 <rcusync>:
+
+// wait for a full grace period. must not be called
+// from a read section or with locks held.
+void
+rcusync(void)
+{
+80101ee0:	55                   	push   %ebp
+80101ee1:	89 e5                	mov    %esp,%ebp
+80101ee3:	53                   	push   %ebx
+80101ee4:	83 ec 04             	sub    $0x4,%esp
+    uint e = rcu.epoch;
+80101ee7:	8b 1d 64 da 18 80    	mov    0x8018da64,%ebx
+
+    while (rcu.epoch - e < 2) {
+80101eed:	a1 64 da 18 80       	mov    0x8018da64,%eax
+80101ef2:	29 d8                	sub    %ebx,%eax
+80101ef4:	83 f8 01             	cmp    $0x1,%eax
+80101ef7:	77 1a                	ja     80101f13 <rcusync+0x33>
+80101ef9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        rcuquiesce();
+80101f00:	e8 5b fe ff ff       	call   80101d60 <rcuquiesce>
+    asm volatile("pause" ::: "memory");
+80101f05:	f3 90                	pause
+    while (rcu.epoch - e < 2) {
+80101f07:	a1 64 da 18 80       	mov    0x8018da64,%eax
+80101f0c:	29 d8                	sub    %ebx,%eax
+80101f0e:	83 f8 01             	cmp    $0x1,%eax
+80101f11:	76 ed                	jbe    80101f00 <rcusync+0x20>
+        pause();
+    }
+}
+80101f13:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101f16:	c9                   	leave
+80101f17:	c3                   	ret
+80101f18:	66 90                	xchg   %ax,%ax
+80101f1a:	66 90                	xchg   %ax,%ax
+80101f1c:	66 90                	xchg   %ax,%ax
+80101f1e:	66 90                	xchg   %ax,%ax
+
+80101f20 <initrwlock>:
+#include "proc.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+80101f20:	55                   	push   %ebp
+80101f21:	89 e5                	mov    %esp,%ebp
+80101f23:	8b 45 08             	mov    0x8(%ebp),%eax
+    lk->name = name;
+80101f26:	8b 55 0c             	mov    0xc(%ebp),%edx
+    lk->cnt = 0;
+80101f29:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    lk->name = name;
+80101f2f:	89 50 04             	mov    %edx,0x4(%eax)
+    lk->cpu = 0;
+80101f32:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80101f39:	5d                   	pop    %ebp
+80101f3a:	c3                   	ret
+80101f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101f3f:	90                   	nop
+
+80101f40 <acquireread>:
+
+void
+acquireread(struct rwlock *lk)
+{
+80101f40:	55                   	push   %ebp
+80101f41:	89 e5                	mov    %esp,%ebp
+80101f43:	56                   	push   %esi
+80101f44:	53                   	push   %ebx
+80101f45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    uint c;
+
+    pushcli();  // disable interrupt to avoid deadlock
+80101f48:	e8 b3 f1 ff ff       	call   80101100 <pushcli>
+int
+holdingwrite(struct rwlock *lk)
+{
+    int r;
+
+    pushcli();
+80101f4d:	e8 ae f1 ff ff       	call   80101100 <pushcli>
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+80101f52:	8b 03                	mov    (%ebx),%eax
+80101f54:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80101f59:	74 2d                	je     80101f88 <acquireread+0x48>
+    popcli();
+80101f5b:	e8 f0 f1 ff ff       	call   80101150 <popcli>
+        c = lk->cnt;
+80101f60:	8b 03                	mov    (%ebx),%eax
+        if ((c & RW_WRITER) == 0 && __sync_bool_compare_and_swap(&lk->cnt, c, c + 1))
+80101f62:	85 c0                	test   %eax,%eax
+80101f64:	78 1a                	js     80101f80 <acquireread+0x40>
+80101f66:	8d 50 01             	lea    0x1(%eax),%edx
+80101f69:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+80101f6d:	75 11                	jne    80101f80 <acquireread+0x40>
+}
+80101f6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101f72:	5b                   	pop    %ebx
+80101f73:	5e                   	pop    %esi
+80101f74:	5d                   	pop    %ebp
+80101f75:	c3                   	ret
+80101f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101f7d:	8d 76 00             	lea    0x0(%esi),%esi
+80101f80:	f3 90                	pause
+}
+80101f82:	eb dc                	jmp    80101f60 <acquireread+0x20>
+80101f84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+80101f88:	8b 73 08             	mov    0x8(%ebx),%esi
+80101f8b:	e8 50 64 00 00       	call   801083e0 <mycpu>
+80101f90:	39 c6                	cmp    %eax,%esi
+80101f92:	75 c7                	jne    80101f5b <acquireread+0x1b>
+    popcli();
+80101f94:	e8 b7 f1 ff ff       	call   80101150 <popcli>
+        panic("acquireread");
+80101f99:	83 ec 0c             	sub    $0xc,%esp
+80101f9c:	68 cb ae 10 80       	push   $0x8010aecb
+80101fa1:	e8 9a 7d 00 00       	call   80109d40 <panic>
+80101fa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101fb0 <releaseread>:
+{
+80101fb0:	55                   	push   %ebp
+80101fb1:	89 e5                	mov    %esp,%ebp
+80101fb3:	83 ec 08             	sub    $0x8,%esp
+80101fb6:	8b 45 08             	mov    0x8(%ebp),%eax
+    if ((lk->cnt & ~RW_WRITER) == 0)
+80101fb9:	8b 10                	mov    (%eax),%edx
+80101fbb:	81 e2 ff ff ff 7f    	and    $0x7fffffff,%edx
+80101fc1:	74 0a                	je     80101fcd <releaseread+0x1d>
+    __sync_fetch_and_sub(&lk->cnt, 1);
+80101fc3:	f0 83 28 01          	lock subl $0x1,(%eax)
+}
+80101fc7:	c9                   	leave
+    popcli();
+80101fc8:	e9 83 f1 ff ff       	jmp    80101150 <popcli>
+        panic("releaseread");
+80101fcd:	83 ec 0c             	sub    $0xc,%esp
+80101fd0:	68 d7 ae 10 80       	push   $0x8010aed7
+80101fd5:	e8 66 7d 00 00       	call   80109d40 <panic>
+80101fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101fe0 <acquirewrite>:
+{
+80101fe0:	55                   	push   %ebp
+80101fe1:	89 e5                	mov    %esp,%ebp
+80101fe3:	56                   	push   %esi
+80101fe4:	53                   	push   %ebx
+80101fe5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();  // disable interrupt to avoid deadlock
+80101fe8:	e8 13 f1 ff ff       	call   80101100 <pushcli>
+    pushcli();
+80101fed:	e8 0e f1 ff ff       	call   80101100 <pushcli>
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+80101ff2:	8b 03                	mov    (%ebx),%eax
+80101ff4:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80101ff9:	74 4d                	je     80102048 <acquirewrite+0x68>
+    popcli();
+80101ffb:	e8 50 f1 ff ff       	call   80101150 <popcli>
+        c = lk->cnt;
+80102000:	8b 03                	mov    (%ebx),%eax
+        if ((c & RW_WRITER) == 0 && __sync_bool_compare_and_swap(&lk->cnt, c, c | RW_WRITER))
+80102002:	85 c0                	test   %eax,%eax
+80102004:	78 3a                	js     80102040 <acquirewrite+0x60>
+80102006:	89 c2                	mov    %eax,%edx
+80102008:	81 ca 00 00 00 80    	or     $0x80000000,%edx
+8010200e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+80102012:	74 0e                	je     80102022 <acquirewrite+0x42>
+80102014:	eb 2a                	jmp    80102040 <acquirewrite+0x60>
+80102016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010201d:	8d 76 00             	lea    0x0(%esi),%esi
+    asm volatile("pause" ::: "memory");
+80102020:	f3 90                	pause
+    while (lk->cnt != RW_WRITER)
+80102022:	8b 03                	mov    (%ebx),%eax
+80102024:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80102029:	75 f5                	jne    80102020 <acquirewrite+0x40>
+    __sync_synchronize();
+8010202b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    lk->cpu = mycpu();
+80102030:	e8 ab 63 00 00       	call   801083e0 <mycpu>
+80102035:	89 43 08             	mov    %eax,0x8(%ebx)
+}
+80102038:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010203b:	5b                   	pop    %ebx
+8010203c:	5e                   	pop    %esi
+8010203d:	5d                   	pop    %ebp
+8010203e:	c3                   	ret
+8010203f:	90                   	nop
+80102040:	f3 90                	pause
+}
+80102042:	eb bc                	jmp    80102000 <acquirewrite+0x20>
+80102044:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+80102048:	8b 73 08             	mov    0x8(%ebx),%esi
+8010204b:	e8 90 63 00 00       	call   801083e0 <mycpu>
+80102050:	39 c6                	cmp    %eax,%esi
+80102052:	75 a7                	jne    80101ffb <acquirewrite+0x1b>
+    popcli();
+80102054:	e8 f7 f0 ff ff       	call   80101150 <popcli>
+        panic("acquirewrite");
+80102059:	83 ec 0c             	sub    $0xc,%esp
+8010205c:	68 e3 ae 10 80       	push   $0x8010aee3
+80102061:	e8 da 7c 00 00       	call   80109d40 <panic>
+80102066:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010206d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102070 <releasewrite>:
+{
+80102070:	55                   	push   %ebp
+80102071:	89 e5                	mov    %esp,%ebp
+80102073:	56                   	push   %esi
+80102074:	53                   	push   %ebx
+80102075:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();
+80102078:	e8 83 f0 ff ff       	call   80101100 <pushcli>
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+8010207d:	8b 03                	mov    (%ebx),%eax
+8010207f:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+80102084:	74 1a                	je     801020a0 <releasewrite+0x30>
+    popcli();
+80102086:	e8 c5 f0 ff ff       	call   80101150 <popcli>
+        panic("releasewrite");
+8010208b:	83 ec 0c             	sub    $0xc,%esp
+8010208e:	68 f0 ae 10 80       	push   $0x8010aef0
+80102093:	e8 a8 7c 00 00       	call   80109d40 <panic>
+80102098:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010209f:	90                   	nop
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+801020a0:	8b 73 08             	mov    0x8(%ebx),%esi
+801020a3:	e8 38 63 00 00       	call   801083e0 <mycpu>
+801020a8:	39 c6                	cmp    %eax,%esi
+801020aa:	75 da                	jne    80102086 <releasewrite+0x16>
+    popcli();
+801020ac:	e8 9f f0 ff ff       	call   80101150 <popcli>
+    lk->cpu = 0;
+801020b1:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    __sync_synchronize();
+801020b8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    asm volatile("movl $0, %0" : "+m" (lk->cnt) : );
+801020bd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+801020c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801020c6:	5b                   	pop    %ebx
+801020c7:	5e                   	pop    %esi
+801020c8:	5d                   	pop    %ebp
+    popcli();
+801020c9:	e9 82 f0 ff ff       	jmp    80101150 <popcli>
+801020ce:	66 90                	xchg   %ax,%ax
+
+801020d0 <holdingwrite>:
+{
+801020d0:	55                   	push   %ebp
+801020d1:	89 e5                	mov    %esp,%ebp
+801020d3:	56                   	push   %esi
+801020d4:	53                   	push   %ebx
+801020d5:	8b 75 08             	mov    0x8(%ebp),%esi
+801020d8:	31 db                	xor    %ebx,%ebx
+    pushcli();
+801020da:	e8 21 f0 ff ff       	call   80101100 <pushcli>
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+801020df:	8b 06                	mov    (%esi),%eax
+801020e1:	3d 00 00 00 80       	cmp    $0x80000000,%eax
+801020e6:	74 10                	je     801020f8 <holdingwrite+0x28>
+    popcli();
+801020e8:	e8 63 f0 ff ff       	call   80101150 <popcli>
+    return r;
+}
+801020ed:	89 d8                	mov    %ebx,%eax
+801020ef:	5b                   	pop    %ebx
+801020f0:	5e                   	pop    %esi
+801020f1:	5d                   	pop    %ebp
+801020f2:	c3                   	ret
+801020f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801020f7:	90                   	nop
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+801020f8:	8b 5e 08             	mov    0x8(%esi),%ebx
+801020fb:	e8 e0 62 00 00       	call   801083e0 <mycpu>
+80102100:	39 c3                	cmp    %eax,%ebx
+80102102:	0f 94 c3             	sete   %bl
+    popcli();
+80102105:	e8 46 f0 ff ff       	call   80101150 <popcli>
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+8010210a:	0f b6 db             	movzbl %bl,%ebx
+}
+8010210d:	89 d8                	mov    %ebx,%eax
+8010210f:	5b                   	pop    %ebx
+80102110:	5e                   	pop    %esi
+80102111:	5d                   	pop    %ebp
+80102112:	c3                   	ret
+80102113:	66 90                	xchg   %ax,%ax
+80102115:	66 90                	xchg   %ax,%ax
+80102117:	66 90                	xchg   %ax,%ax
+80102119:	66 90                	xchg   %ax,%ax
+8010211b:	66 90                	xchg   %ax,%ax
+8010211d:	66 90                	xchg   %ax,%ax
+8010211f:	90                   	nop
+
+80102120 <initseqlock>:
+#include "spinlock.h"
+#include "seqlock.h"
+
+void
+initseqlock(struct seqlock *sl, char *name)
+{
+80102120:	55                   	push   %ebp
+80102121:	89 e5                	mov    %esp,%ebp
+80102123:	53                   	push   %ebx
+80102124:	83 ec 0c             	sub    $0xc,%esp
+80102127:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    initlock(&sl->lk, name);
+8010212a:	ff 75 0c             	push   0xc(%ebp)
+8010212d:	8d 43 04             	lea    0x4(%ebx),%eax
+80102130:	50                   	push   %eax
+80102131:	e8 0a ef ff ff       	call   80101040 <initlock>
+    sl->seq = 0;
+80102136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+8010213c:	83 c4 10             	add    $0x10,%esp
+8010213f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102142:	c9                   	leave
+80102143:	c3                   	ret
+80102144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010214b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010214f:	90                   	nop
+
+80102150 <acquireseq>:
+
+void
+acquireseq(struct seqlock *sl)
+{
+80102150:	55                   	push   %ebp
+80102151:	89 e5                	mov    %esp,%ebp
+80102153:	53                   	push   %ebx
+80102154:	83 ec 10             	sub    $0x10,%esp
+80102157:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    acquire(&sl->lk);
+8010215a:	8d 43 04             	lea    0x4(%ebx),%eax
+8010215d:	50                   	push   %eax
+8010215e:	e8 4d f3 ff ff       	call   801014b0 <acquire>
+    sl->seq++;
+80102163:	8b 03                	mov    (%ebx),%eax
+    __sync_synchronize();
+}
+80102165:	83 c4 10             	add    $0x10,%esp
+    sl->seq++;
+80102168:	83 c0 01             	add    $0x1,%eax
+8010216b:	89 03                	mov    %eax,(%ebx)
+    __sync_synchronize();
+8010216d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+80102172:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102175:	c9                   	leave
+80102176:	c3                   	ret
+80102177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010217e:	66 90                	xchg   %ax,%ax
+
+80102180 <releaseseq>:
+
+void
+releaseseq(struct seqlock *sl)
+{
+80102180:	55                   	push   %ebp
+80102181:	89 e5                	mov    %esp,%ebp
+80102183:	8b 45 08             	mov    0x8(%ebp),%eax
+    __sync_synchronize();
+80102186:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    sl->seq++;
+    release(&sl->lk);
+8010218b:	83 c0 04             	add    $0x4,%eax
+    sl->seq++;
+8010218e:	8b 50 fc             	mov    -0x4(%eax),%edx
+80102191:	83 c2 01             	add    $0x1,%edx
+80102194:	89 50 fc             	mov    %edx,-0x4(%eax)
+    release(&sl->lk);
+80102197:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+8010219a:	5d                   	pop    %ebp
+    release(&sl->lk);
+8010219b:	e9 30 f1 ff ff       	jmp    801012d0 <release>
+
+801021a0 <readseqbegin>:
+
+// start a read; waits out a write in progress
+uint
+readseqbegin(struct seqlock *sl)
+{
+801021a0:	55                   	push   %ebp
+801021a1:	89 e5                	mov    %esp,%ebp
+801021a3:	8b 55 08             	mov    0x8(%ebp),%edx
+    uint s;
+
+    while ((s = sl->seq) & 1)
+801021a6:	8b 02                	mov    (%edx),%eax
+801021a8:	a8 01                	test   $0x1,%al
+801021aa:	74 0c                	je     801021b8 <readseqbegin+0x18>
+801021ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    asm volatile("pause" ::: "memory");
+801021b0:	f3 90                	pause
+801021b2:	8b 02                	mov    (%edx),%eax
+801021b4:	a8 01                	test   $0x1,%al
+801021b6:	75 f8                	jne    801021b0 <readseqbegin+0x10>
+        pause();
+    __sync_synchronize();
+801021b8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    return s;
+}
+801021bd:	5d                   	pop    %ebp
+801021be:	c3                   	ret
+801021bf:	90                   	nop
+
+801021c0 <readseqretry>:
+
+// did a write happen since readseqbegin() returned s?
+int
+readseqretry(struct seqlock *sl, uint s)
+{
+801021c0:	55                   	push   %ebp
+    __sync_synchronize();
+801021c1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+{
+801021c6:	89 e5                	mov    %esp,%ebp
+    return sl->seq != s;
+801021c8:	8b 45 08             	mov    0x8(%ebp),%eax
+801021cb:	8b 00                	mov    (%eax),%eax
+801021cd:	3b 45 0c             	cmp    0xc(%ebp),%eax
+801021d0:	0f 95 c0             	setne  %al
+}
+801021d3:	5d                   	pop    %ebp
+    return sl->seq != s;
+801021d4:	0f b6 c0             	movzbl %al,%eax
+}
+801021d7:	c3                   	ret
+801021d8:	66 90                	xchg   %ax,%ax
+801021da:	66 90                	xchg   %ax,%ax
+801021dc:	66 90                	xchg   %ax,%ax
+801021de:	66 90                	xchg   %ax,%ax
+
+801021e0 <blkqueue>:
+    return -1;
+}
+
+static struct blkqueue*
+blkqueue(uint dev)
+{
+801021e0:	55                   	push   %ebp
+801021e1:	89 e5                	mov    %esp,%ebp
+801021e3:	56                   	push   %esi
+801021e4:	53                   	push   %ebx
+    struct blkdev *bd;
+    struct blkqueue *bq;
+
+    if (dev >= NBLKDEV || (bd = blkdevs[dev]) == 0)
+801021e5:	83 f8 07             	cmp    $0x7,%eax
+801021e8:	77 4a                	ja     80102234 <blkqueue+0x54>
+801021ea:	8b 1c 85 c0 df 18 80 	mov    -0x7fe72040(,%eax,4),%ebx
+801021f1:	85 db                	test   %ebx,%ebx
+801021f3:	74 3f                	je     80102234 <blkqueue+0x54>
+        panic("blkqueue: no such device");
+    if (bd->nq == 1)
+801021f5:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+801021f9:	74 2d                	je     80102228 <blkqueue+0x48>
+        return bd->qs;
+    pushcli();
+801021fb:	e8 00 ef ff ff       	call   80101100 <pushcli>
+    bq = &bd->qs[cpuid() % bd->nq];
+80102200:	8b 73 08             	mov    0x8(%ebx),%esi
+80102203:	e8 38 62 00 00       	call   80108440 <cpuid>
+80102208:	99                   	cltd
+80102209:	f7 7b 04             	idivl  0x4(%ebx)
+8010220c:	8d 04 52             	lea    (%edx,%edx,2),%eax
+8010220f:	c1 e0 06             	shl    $0x6,%eax
+80102212:	01 c6                	add    %eax,%esi
+    popcli();
+80102214:	e8 37 ef ff ff       	call   80101150 <popcli>
+    return bq;
+}
+80102219:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010221c:	89 f0                	mov    %esi,%eax
+8010221e:	5b                   	pop    %ebx
+8010221f:	5e                   	pop    %esi
+80102220:	5d                   	pop    %ebp
+80102221:	c3                   	ret
+80102222:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        return bd->qs;
+80102228:	8b 73 08             	mov    0x8(%ebx),%esi
+}
+8010222b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010222e:	5b                   	pop    %ebx
+8010222f:	89 f0                	mov    %esi,%eax
+80102231:	5e                   	pop    %esi
+80102232:	5d                   	pop    %ebp
+80102233:	c3                   	ret
+        panic("blkqueue: no such device");
+80102234:	83 ec 0c             	sub    $0xc,%esp
+80102237:	68 fd ae 10 80       	push   $0x8010aefd
+8010223c:	e8 ff 7a 00 00       	call   80109d40 <panic>
+80102241:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102248:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010224f:	90                   	nop
+
+80102250 <blkpollwait>:
+{
+    struct blkqueue *bq;
+    uint khz, t0;
+    int queued;
+
+    if (!(b->flags & B_QUEUED))
+80102250:	f6 00 08             	testb  $0x8,(%eax)
+80102253:	0f 84 27 01 00 00    	je     80102380 <blkpollwait+0x130>
+{
+80102259:	55                   	push   %ebp
+8010225a:	89 e5                	mov    %esp,%ebp
+8010225c:	57                   	push   %edi
+8010225d:	56                   	push   %esi
+8010225e:	89 c6                	mov    %eax,%esi
+80102260:	53                   	push   %ebx
+80102261:	83 ec 1c             	sub    $0x1c,%esp
+        return LAT_POLL;
+    bq = b->bq;
+    if (!blkpolling || bq->poll == 0 || (khz = tsckhz()) == 0) {
+80102264:	8b 15 00 c0 10 80    	mov    0x8010c000,%edx
+    bq = b->bq;
+8010226a:	8b 98 c8 00 00 00    	mov    0xc8(%eax),%ebx
+    if (!blkpolling || bq->poll == 0 || (khz = tsckhz()) == 0) {
+80102270:	85 d2                	test   %edx,%edx
+80102272:	0f 84 a8 00 00 00    	je     80102320 <blkpollwait+0xd0>
+80102278:	8b 83 94 00 00 00    	mov    0x94(%ebx),%eax
+8010227e:	85 c0                	test   %eax,%eax
+80102280:	0f 84 9a 00 00 00    	je     80102320 <blkpollwait+0xd0>
+80102286:	e8 35 6f 00 00       	call   801091c0 <tsckhz>
+8010228b:	89 c1                	mov    %eax,%ecx
+8010228d:	85 c0                	test   %eax,%eax
+8010228f:	74 7f                	je     80102310 <blkpollwait+0xc0>
+    asm volatile("rdtsc" : "=A" (tsc));
+80102291:	0f 31                	rdtsc
+        blkiowait(b);
+        return LAT_INTR;
+    }
+    t0 = (uint)rdtsc();
+80102293:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        queued = b->flags & B_QUEUED;
+        release(&bq->lock);
+        if (!queued)
+            return LAT_POLL;
+        pause();
+    } while ((uint)rdtsc() - t0 < POLLUS * (khz / 1000));
+80102296:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+8010229b:	f7 e1                	mul    %ecx
+8010229d:	c1 ea 06             	shr    $0x6,%edx
+801022a0:	6b c2 1e             	imul   $0x1e,%edx,%eax
+801022a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801022a6:	eb 3e                	jmp    801022e6 <blkpollwait+0x96>
+801022a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022af:	90                   	nop
+        bq->poll(bq);
+801022b0:	83 ec 0c             	sub    $0xc,%esp
+801022b3:	53                   	push   %ebx
+801022b4:	ff 93 94 00 00 00    	call   *0x94(%ebx)
+        queued = b->flags & B_QUEUED;
+801022ba:	8b 3e                	mov    (%esi),%edi
+        release(&bq->lock);
+801022bc:	89 1c 24             	mov    %ebx,(%esp)
+        queued = b->flags & B_QUEUED;
+801022bf:	83 e7 08             	and    $0x8,%edi
+        release(&bq->lock);
+801022c2:	e8 09 f0 ff ff       	call   801012d0 <release>
+        if (!queued)
+801022c7:	83 c4 10             	add    $0x10,%esp
+801022ca:	85 ff                	test   %edi,%edi
+801022cc:	0f 84 9e 00 00 00    	je     80102370 <blkpollwait+0x120>
+    asm volatile("pause" ::: "memory");
+801022d2:	f3 90                	pause
+    asm volatile("rdtsc" : "=A" (tsc));
+801022d4:	0f 31                	rdtsc
+    } while ((uint)rdtsc() - t0 < POLLUS * (khz / 1000));
+801022d6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801022d9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801022dc:	29 c8                	sub    %ecx,%eax
+801022de:	39 d0                	cmp    %edx,%eax
+801022e0:	0f 83 aa 00 00 00    	jae    80102390 <blkpollwait+0x140>
+        acquire(&bq->lock);
+801022e6:	83 ec 0c             	sub    $0xc,%esp
+801022e9:	53                   	push   %ebx
+801022ea:	e8 c1 f1 ff ff       	call   801014b0 <acquire>
+        if (!(b->flags & B_QUEUED)) {
+801022ef:	83 c4 10             	add    $0x10,%esp
+801022f2:	f6 06 08             	testb  $0x8,(%esi)
+801022f5:	75 b9                	jne    801022b0 <blkpollwait+0x60>
+    release(&bq->lock);
+801022f7:	83 ec 0c             	sub    $0xc,%esp
+801022fa:	53                   	push   %ebx
+801022fb:	e8 d0 ef ff ff       	call   801012d0 <release>
+80102300:	83 c4 10             	add    $0x10,%esp
+            return LAT_POLLINTR;
+80102303:	b8 02 00 00 00       	mov    $0x2,%eax
+80102308:	eb 58                	jmp    80102362 <blkpollwait+0x112>
+8010230a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (!(b->flags & B_QUEUED))
+80102310:	f6 06 08             	testb  $0x8,(%esi)
+80102313:	74 4b                	je     80102360 <blkpollwait+0x110>
+    bq = b->bq;
+80102315:	8b 9e c8 00 00 00    	mov    0xc8(%esi),%ebx
+8010231b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010231f:	90                   	nop
+    acquire(&bq->lock);
+80102320:	83 ec 0c             	sub    $0xc,%esp
+        waitsleep(&b->wq, &bq->lock, 1);
+80102323:	8d be bc 00 00 00    	lea    0xbc(%esi),%edi
+    acquire(&bq->lock);
+80102329:	53                   	push   %ebx
+8010232a:	e8 81 f1 ff ff       	call   801014b0 <acquire>
+    while (b->flags & B_QUEUED)
+8010232f:	83 c4 10             	add    $0x10,%esp
+80102332:	f6 06 08             	testb  $0x8,(%esi)
+80102335:	74 1d                	je     80102354 <blkpollwait+0x104>
+80102337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010233e:	66 90                	xchg   %ax,%ax
+        waitsleep(&b->wq, &bq->lock, 1);
+80102340:	83 ec 04             	sub    $0x4,%esp
+80102343:	6a 01                	push   $0x1
+80102345:	53                   	push   %ebx
+80102346:	57                   	push   %edi
+80102347:	e8 64 f5 ff ff       	call   801018b0 <waitsleep>
+    while (b->flags & B_QUEUED)
+8010234c:	83 c4 10             	add    $0x10,%esp
+8010234f:	f6 06 08             	testb  $0x8,(%esi)
+80102352:	75 ec                	jne    80102340 <blkpollwait+0xf0>
+    release(&bq->lock);
+80102354:	83 ec 0c             	sub    $0xc,%esp
+80102357:	53                   	push   %ebx
+80102358:	e8 73 ef ff ff       	call   801012d0 <release>
+8010235d:	83 c4 10             	add    $0x10,%esp
+        return LAT_INTR;
+80102360:	31 c0                	xor    %eax,%eax
+    blkiowait(b);
+    return LAT_POLLINTR;
+}
+80102362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102365:	5b                   	pop    %ebx
+80102366:	5e                   	pop    %esi
+80102367:	5f                   	pop    %edi
+80102368:	5d                   	pop    %ebp
+80102369:	c3                   	ret
+8010236a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return LAT_POLL;
+80102373:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80102378:	5b                   	pop    %ebx
+80102379:	5e                   	pop    %esi
+8010237a:	5f                   	pop    %edi
+8010237b:	5d                   	pop    %ebp
+8010237c:	c3                   	ret
+8010237d:	8d 76 00             	lea    0x0(%esi),%esi
+        return LAT_POLL;
+80102380:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80102385:	c3                   	ret
+80102386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010238d:	8d 76 00             	lea    0x0(%esi),%esi
+    if (!(b->flags & B_QUEUED))
+80102390:	f6 06 08             	testb  $0x8,(%esi)
+80102393:	0f 84 6a ff ff ff    	je     80102303 <blkpollwait+0xb3>
+    acquire(&bq->lock);
+80102399:	8b 9e c8 00 00 00    	mov    0xc8(%esi),%ebx
+8010239f:	83 ec 0c             	sub    $0xc,%esp
+        waitsleep(&b->wq, &bq->lock, 1);
+801023a2:	8d be bc 00 00 00    	lea    0xbc(%esi),%edi
+    acquire(&bq->lock);
+801023a8:	53                   	push   %ebx
+801023a9:	e8 02 f1 ff ff       	call   801014b0 <acquire>
+    while (b->flags & B_QUEUED)
+801023ae:	83 c4 10             	add    $0x10,%esp
+801023b1:	f6 06 08             	testb  $0x8,(%esi)
+801023b4:	0f 84 3d ff ff ff    	je     801022f7 <blkpollwait+0xa7>
+801023ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        waitsleep(&b->wq, &bq->lock, 1);
+801023c0:	83 ec 04             	sub    $0x4,%esp
+801023c3:	6a 01                	push   $0x1
+801023c5:	53                   	push   %ebx
+801023c6:	57                   	push   %edi
+801023c7:	e8 e4 f4 ff ff       	call   801018b0 <waitsleep>
+    while (b->flags & B_QUEUED)
+801023cc:	83 c4 10             	add    $0x10,%esp
+801023cf:	f6 06 08             	testb  $0x8,(%esi)
+801023d2:	75 ec                	jne    801023c0 <blkpollwait+0x170>
+801023d4:	e9 1e ff ff ff       	jmp    801022f7 <blkpollwait+0xa7>
+801023d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801023e0 <blkqinit>:
+{
+801023e0:	55                   	push   %ebp
+801023e1:	89 e5                	mov    %esp,%ebp
+801023e3:	53                   	push   %ebx
+801023e4:	83 ec 0c             	sub    $0xc,%esp
+801023e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    initlock(&bq->lock, name);
+801023ea:	ff 75 0c             	push   0xc(%ebp)
+801023ed:	53                   	push   %ebx
+801023ee:	e8 4d ec ff ff       	call   80101040 <initlock>
+    ioqinit(&bq->q, sched);
+801023f3:	58                   	pop    %eax
+801023f4:	8d 43 44             	lea    0x44(%ebx),%eax
+801023f7:	5a                   	pop    %edx
+801023f8:	ff 75 10             	push   0x10(%ebp)
+801023fb:	50                   	push   %eax
+801023fc:	e8 df 22 00 00       	call   801046e0 <ioqinit>
+    bq->maxrun = maxrun;
+80102401:	8b 45 14             	mov    0x14(%ebp),%eax
+}
+80102404:	83 c4 10             	add    $0x10,%esp
+    bq->inflight = 0;
+80102407:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+8010240e:	00 00 00 
+    bq->kick = 0;
+80102411:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80102418:	00 00 00 
+    bq->maxrun = maxrun;
+8010241b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+    bq->depth = depth;
+80102421:	8b 45 18             	mov    0x18(%ebp),%eax
+    bq->poll = 0;
+80102424:	c7 83 94 00 00 00 00 	movl   $0x0,0x94(%ebx)
+8010242b:	00 00 00 
+    bq->depth = depth;
+8010242e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+    bq->issue = issue;
+80102434:	8b 45 1c             	mov    0x1c(%ebp),%eax
+80102437:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+    bq->priv = priv;
+8010243d:	8b 45 20             	mov    0x20(%ebp),%eax
+80102440:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+}
+80102446:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102449:	c9                   	leave
+8010244a:	c3                   	ret
+8010244b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010244f:	90                   	nop
+
+80102450 <blkregister>:
+{
+80102450:	55                   	push   %ebp
+80102451:	89 e5                	mov    %esp,%ebp
+80102453:	83 ec 08             	sub    $0x8,%esp
+80102456:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (dev >= NBLKDEV)
+80102459:	83 f8 07             	cmp    $0x7,%eax
+8010245c:	77 0c                	ja     8010246a <blkregister+0x1a>
+    blkdevs[dev] = bd;
+8010245e:	8b 55 0c             	mov    0xc(%ebp),%edx
+80102461:	89 14 85 c0 df 18 80 	mov    %edx,-0x7fe72040(,%eax,4)
+}
+80102468:	c9                   	leave
+80102469:	c3                   	ret
+        panic("blkregister");
+8010246a:	83 ec 0c             	sub    $0xc,%esp
+8010246d:	68 16 af 10 80       	push   $0x8010af16
+80102472:	e8 c9 78 00 00       	call   80109d40 <panic>
+80102477:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010247e:	66 90                	xchg   %ax,%ax
+
+80102480 <blkalloc>:
+    for (dev = 0; dev < NBLKDEV; dev++) {
+80102480:	31 c0                	xor    %eax,%eax
+80102482:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if (blkdevs[dev] == 0) {
+80102488:	8b 14 85 c0 df 18 80 	mov    -0x7fe72040(,%eax,4),%edx
+8010248f:	85 d2                	test   %edx,%edx
+80102491:	74 15                	je     801024a8 <blkalloc+0x28>
+    for (dev = 0; dev < NBLKDEV; dev++) {
+80102493:	83 c0 01             	add    $0x1,%eax
+80102496:	83 f8 08             	cmp    $0x8,%eax
+80102499:	75 ed                	jne    80102488 <blkalloc+0x8>
+    return -1;
+8010249b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801024a0:	c3                   	ret
+801024a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+{
+801024a8:	55                   	push   %ebp
+801024a9:	89 e5                	mov    %esp,%ebp
+            blkdevs[dev] = bd;
+801024ab:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+801024ae:	5d                   	pop    %ebp
+            blkdevs[dev] = bd;
+801024af:	89 14 85 c0 df 18 80 	mov    %edx,-0x7fe72040(,%eax,4)
+}
+801024b6:	c3                   	ret
+801024b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801024be:	66 90                	xchg   %ax,%ax
+
+801024c0 <blkstart>:
+{
+801024c0:	55                   	push   %ebp
+801024c1:	89 e5                	mov    %esp,%ebp
+801024c3:	57                   	push   %edi
+801024c4:	56                   	push   %esi
+801024c5:	31 f6                	xor    %esi,%esi
+801024c7:	53                   	push   %ebx
+801024c8:	83 ec 0c             	sub    $0xc,%esp
+801024cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    for (n = 0; bq->inflight < bq->depth && (b = ioqtake(&bq->q, bq->maxrun)) != 0; n++) {
+801024ce:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+801024d4:	8d 7b 44             	lea    0x44(%ebx),%edi
+801024d7:	39 83 84 00 00 00    	cmp    %eax,0x84(%ebx)
+801024dd:	7f 2f                	jg     8010250e <blkstart+0x4e>
+801024df:	eb 47                	jmp    80102528 <blkstart+0x68>
+801024e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        bq->issue(bq, b);
+801024e8:	83 ec 08             	sub    $0x8,%esp
+        bq->inflight++;
+801024eb:	83 83 88 00 00 00 01 	addl   $0x1,0x88(%ebx)
+    for (n = 0; bq->inflight < bq->depth && (b = ioqtake(&bq->q, bq->maxrun)) != 0; n++) {
+801024f2:	83 c6 01             	add    $0x1,%esi
+        bq->issue(bq, b);
+801024f5:	50                   	push   %eax
+801024f6:	53                   	push   %ebx
+801024f7:	ff 93 8c 00 00 00    	call   *0x8c(%ebx)
+    for (n = 0; bq->inflight < bq->depth && (b = ioqtake(&bq->q, bq->maxrun)) != 0; n++) {
+801024fd:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+80102503:	83 c4 10             	add    $0x10,%esp
+80102506:	39 83 88 00 00 00    	cmp    %eax,0x88(%ebx)
+8010250c:	7d 22                	jge    80102530 <blkstart+0x70>
+8010250e:	83 ec 08             	sub    $0x8,%esp
+80102511:	ff b3 80 00 00 00    	push   0x80(%ebx)
+80102517:	57                   	push   %edi
+80102518:	e8 13 22 00 00       	call   80104730 <ioqtake>
+8010251d:	83 c4 10             	add    $0x10,%esp
+80102520:	85 c0                	test   %eax,%eax
+80102522:	75 c4                	jne    801024e8 <blkstart+0x28>
+    if (n > 0 && bq->kick)
+80102524:	85 f6                	test   %esi,%esi
+80102526:	75 08                	jne    80102530 <blkstart+0x70>
+}
+80102528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010252b:	5b                   	pop    %ebx
+8010252c:	5e                   	pop    %esi
+8010252d:	5f                   	pop    %edi
+8010252e:	5d                   	pop    %ebp
+8010252f:	c3                   	ret
+    if (n > 0 && bq->kick)
+80102530:	8b 83 90 00 00 00    	mov    0x90(%ebx),%eax
+80102536:	85 c0                	test   %eax,%eax
+80102538:	74 ee                	je     80102528 <blkstart+0x68>
+        bq->kick(bq);
+8010253a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010253d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102540:	5b                   	pop    %ebx
+80102541:	5e                   	pop    %esi
+80102542:	5f                   	pop    %edi
+80102543:	5d                   	pop    %ebp
+        bq->kick(bq);
+80102544:	ff e0                	jmp    *%eax
+80102546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010254d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102550 <blkdone>:
+{
+80102550:	55                   	push   %ebp
+80102551:	89 e5                	mov    %esp,%ebp
+80102553:	56                   	push   %esi
+80102554:	53                   	push   %ebx
+80102555:	8b 45 08             	mov    0x8(%ebp),%eax
+80102558:	8b 75 0c             	mov    0xc(%ebp),%esi
+    bq->inflight--;
+8010255b:	83 a8 88 00 00 00 01 	subl   $0x1,0x88(%eax)
+    for (; b; b = next) {
+80102562:	85 f6                	test   %esi,%esi
+80102564:	74 4f                	je     801025b5 <blkdone+0x65>
+        next = b->qnext;
+80102566:	89 f3                	mov    %esi,%ebx
+        wake_one(&b->wq);
+80102568:	83 ec 0c             	sub    $0xc,%esp
+        next = b->qnext;
+8010256b:	8b b6 90 00 00 00    	mov    0x90(%esi),%esi
+        b->qnext = 0;
+80102571:	c7 83 90 00 00 00 00 	movl   $0x0,0x90(%ebx)
+80102578:	00 00 00 
+        b->flags &= ~(B_DIRTY | B_QUEUED);
+8010257b:	8b 03                	mov    (%ebx),%eax
+8010257d:	83 e0 f3             	and    $0xfffffff3,%eax
+80102580:	83 c8 02             	or     $0x2,%eax
+80102583:	89 03                	mov    %eax,(%ebx)
+        wake_one(&b->wq);
+80102585:	8d 83 bc 00 00 00    	lea    0xbc(%ebx),%eax
+8010258b:	50                   	push   %eax
+8010258c:	e8 9f f4 ff ff       	call   80101a30 <wake_one>
+        if ((fn = b->iodone) != 0) {
+80102591:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80102597:	83 c4 10             	add    $0x10,%esp
+8010259a:	85 c0                	test   %eax,%eax
+8010259c:	74 c4                	je     80102562 <blkdone+0x12>
+            b->iodone = 0;
+8010259e:	c7 83 c4 00 00 00 00 	movl   $0x0,0xc4(%ebx)
+801025a5:	00 00 00 
+            fn(b);
+801025a8:	83 ec 0c             	sub    $0xc,%esp
+801025ab:	53                   	push   %ebx
+801025ac:	ff d0                	call   *%eax
+801025ae:	83 c4 10             	add    $0x10,%esp
+    for (; b; b = next) {
+801025b1:	85 f6                	test   %esi,%esi
+801025b3:	75 b1                	jne    80102566 <blkdone+0x16>
+}
+801025b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801025b8:	5b                   	pop    %ebx
+801025b9:	5e                   	pop    %esi
+801025ba:	5d                   	pop    %ebp
+801025bb:	c3                   	ret
+801025bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801025c0 <blksubmit>:
+{
+801025c0:	55                   	push   %ebp
+801025c1:	89 e5                	mov    %esp,%ebp
+801025c3:	57                   	push   %edi
+801025c4:	56                   	push   %esi
+801025c5:	53                   	push   %ebx
+801025c6:	83 ec 0c             	sub    $0xc,%esp
+801025c9:	8b 75 08             	mov    0x8(%ebp),%esi
+    struct blkqueue *bq = blkqueue(b->dev);
+801025cc:	8b 46 04             	mov    0x4(%esi),%eax
+801025cf:	e8 0c fc ff ff       	call   801021e0 <blkqueue>
+    acquire(&bq->lock);
+801025d4:	83 ec 0c             	sub    $0xc,%esp
+801025d7:	50                   	push   %eax
+    struct blkqueue *bq = blkqueue(b->dev);
+801025d8:	89 c3                	mov    %eax,%ebx
+    acquire(&bq->lock);
+801025da:	e8 d1 ee ff ff       	call   801014b0 <acquire>
+    if ((b->flags & B_QUEUED) || (b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+801025df:	8b 06                	mov    (%esi),%eax
+801025e1:	83 c4 10             	add    $0x10,%esp
+801025e4:	89 c7                	mov    %eax,%edi
+801025e6:	83 e7 08             	and    $0x8,%edi
+801025e9:	75 55                	jne    80102640 <blksubmit+0x80>
+801025eb:	89 c2                	mov    %eax,%edx
+801025ed:	83 e2 06             	and    $0x6,%edx
+801025f0:	83 fa 02             	cmp    $0x2,%edx
+801025f3:	74 31                	je     80102626 <blksubmit+0x66>
+    b->flags |= B_QUEUED;
+801025f5:	83 c8 08             	or     $0x8,%eax
+    ioqadd(&bq->q, b);
+801025f8:	83 ec 08             	sub    $0x8,%esp
+    b->bq = bq;
+801025fb:	89 9e c8 00 00 00    	mov    %ebx,0xc8(%esi)
+    return 1;
+80102601:	bf 01 00 00 00       	mov    $0x1,%edi
+    b->flags |= B_QUEUED;
+80102606:	89 06                	mov    %eax,(%esi)
+    b->iodone = done;
+80102608:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010260b:	89 86 c4 00 00 00    	mov    %eax,0xc4(%esi)
+    ioqadd(&bq->q, b);
+80102611:	8d 43 44             	lea    0x44(%ebx),%eax
+80102614:	56                   	push   %esi
+80102615:	50                   	push   %eax
+80102616:	e8 f5 20 00 00       	call   80104710 <ioqadd>
+        blkstart(bq);
+8010261b:	89 1c 24             	mov    %ebx,(%esp)
+8010261e:	e8 9d fe ff ff       	call   801024c0 <blkstart>
+80102623:	83 c4 10             	add    $0x10,%esp
+    release(&bq->lock);
+80102626:	83 ec 0c             	sub    $0xc,%esp
+80102629:	53                   	push   %ebx
+8010262a:	e8 a1 ec ff ff       	call   801012d0 <release>
+}
+8010262f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102632:	89 f8                	mov    %edi,%eax
+80102634:	5b                   	pop    %ebx
+80102635:	5e                   	pop    %esi
+80102636:	5f                   	pop    %edi
+80102637:	5d                   	pop    %ebp
+80102638:	c3                   	ret
+80102639:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        return 0;
+80102640:	31 ff                	xor    %edi,%edi
+80102642:	eb e2                	jmp    80102626 <blksubmit+0x66>
+80102644:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010264b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010264f:	90                   	nop
+
+80102650 <blksubmitv>:
+{
+80102650:	55                   	push   %ebp
+80102651:	89 e5                	mov    %esp,%ebp
+80102653:	57                   	push   %edi
+80102654:	56                   	push   %esi
+80102655:	53                   	push   %ebx
+80102656:	83 ec 1c             	sub    $0x1c,%esp
+80102659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+8010265c:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010265f:	8b 75 10             	mov    0x10(%ebp),%esi
+80102662:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+    if (n == 0)
+80102665:	85 db                	test   %ebx,%ebx
+80102667:	75 0f                	jne    80102678 <blksubmitv+0x28>
+}
+80102669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010266c:	5b                   	pop    %ebx
+8010266d:	5e                   	pop    %esi
+8010266e:	5f                   	pop    %edi
+8010266f:	5d                   	pop    %ebp
+80102670:	c3                   	ret
+80102671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bq = blkqueue(b[0]->dev);
+80102678:	8b 07                	mov    (%edi),%eax
+8010267a:	8b 40 04             	mov    0x4(%eax),%eax
+8010267d:	e8 5e fb ff ff       	call   801021e0 <blkqueue>
+    acquire(&bq->lock);
+80102682:	83 ec 0c             	sub    $0xc,%esp
+80102685:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102688:	50                   	push   %eax
+80102689:	e8 22 ee ff ff       	call   801014b0 <acquire>
+    for (i = 0; i < n; i++)
+8010268e:	83 c4 10             	add    $0x10,%esp
+80102691:	85 db                	test   %ebx,%ebx
+80102693:	7e 67                	jle    801026fc <blksubmitv+0xac>
+    ioqadd(&bq->q, b);
+80102695:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    for (i = 0; i < n; i++)
+80102698:	31 db                	xor    %ebx,%ebx
+    ioqadd(&bq->q, b);
+8010269a:	83 c0 44             	add    $0x44,%eax
+8010269d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801026a0:	eb 3b                	jmp    801026dd <blksubmitv+0x8d>
+801026a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if ((b->flags & B_QUEUED) || (b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+801026a8:	89 d1                	mov    %edx,%ecx
+801026aa:	83 e1 06             	and    $0x6,%ecx
+801026ad:	83 f9 02             	cmp    $0x2,%ecx
+801026b0:	74 35                	je     801026e7 <blksubmitv+0x97>
+    b->bq = bq;
+801026b2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    ioqadd(&bq->q, b);
+801026b5:	83 ec 08             	sub    $0x8,%esp
+    b->flags |= B_QUEUED;
+801026b8:	83 ca 08             	or     $0x8,%edx
+    b->iodone = done;
+801026bb:	89 b0 c4 00 00 00    	mov    %esi,0xc4(%eax)
+    b->flags |= B_QUEUED;
+801026c1:	89 10                	mov    %edx,(%eax)
+    b->bq = bq;
+801026c3:	89 88 c8 00 00 00    	mov    %ecx,0xc8(%eax)
+    ioqadd(&bq->q, b);
+801026c9:	50                   	push   %eax
+801026ca:	ff 75 dc             	push   -0x24(%ebp)
+801026cd:	e8 3e 20 00 00       	call   80104710 <ioqadd>
+801026d2:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < n; i++)
+801026d5:	83 c3 01             	add    $0x1,%ebx
+801026d8:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+801026db:	74 1f                	je     801026fc <blksubmitv+0xac>
+        if (!blkqueueadd(bq, b[i], done) && done)
+801026dd:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+    if ((b->flags & B_QUEUED) || (b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+801026e0:	8b 10                	mov    (%eax),%edx
+801026e2:	f6 c2 08             	test   $0x8,%dl
+801026e5:	74 c1                	je     801026a8 <blksubmitv+0x58>
+        if (!blkqueueadd(bq, b[i], done) && done)
+801026e7:	85 f6                	test   %esi,%esi
+801026e9:	74 ea                	je     801026d5 <blksubmitv+0x85>
+            done(b[i]);
+801026eb:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < n; i++)
+801026ee:	83 c3 01             	add    $0x1,%ebx
+            done(b[i]);
+801026f1:	50                   	push   %eax
+801026f2:	ff d6                	call   *%esi
+801026f4:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < n; i++)
+801026f7:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+801026fa:	75 e1                	jne    801026dd <blksubmitv+0x8d>
+    blkstart(bq);
+801026fc:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801026ff:	83 ec 0c             	sub    $0xc,%esp
+80102702:	57                   	push   %edi
+80102703:	e8 b8 fd ff ff       	call   801024c0 <blkstart>
+    release(&bq->lock);
+80102708:	89 7d 08             	mov    %edi,0x8(%ebp)
+8010270b:	83 c4 10             	add    $0x10,%esp
+}
+8010270e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102711:	5b                   	pop    %ebx
+80102712:	5e                   	pop    %esi
+80102713:	5f                   	pop    %edi
+80102714:	5d                   	pop    %ebp
+    release(&bq->lock);
+80102715:	e9 b6 eb ff ff       	jmp    801012d0 <release>
+8010271a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102720 <blkiowait>:
+{
+80102720:	55                   	push   %ebp
+80102721:	89 e5                	mov    %esp,%ebp
+80102723:	57                   	push   %edi
+80102724:	56                   	push   %esi
+80102725:	53                   	push   %ebx
+80102726:	83 ec 0c             	sub    $0xc,%esp
+80102729:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!(b->flags & B_QUEUED))
+8010272c:	f6 03 08             	testb  $0x8,(%ebx)
+8010272f:	75 0f                	jne    80102740 <blkiowait+0x20>
+}
+80102731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102734:	5b                   	pop    %ebx
+80102735:	5e                   	pop    %esi
+80102736:	5f                   	pop    %edi
+80102737:	5d                   	pop    %ebp
+80102738:	c3                   	ret
+80102739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    acquire(&bq->lock);
+80102740:	8b b3 c8 00 00 00    	mov    0xc8(%ebx),%esi
+80102746:	83 ec 0c             	sub    $0xc,%esp
+        waitsleep(&b->wq, &bq->lock, 1);
+80102749:	8d bb bc 00 00 00    	lea    0xbc(%ebx),%edi
+    acquire(&bq->lock);
+8010274f:	56                   	push   %esi
+80102750:	e8 5b ed ff ff       	call   801014b0 <acquire>
+    while (b->flags & B_QUEUED)
+80102755:	83 c4 10             	add    $0x10,%esp
+80102758:	f6 03 08             	testb  $0x8,(%ebx)
+8010275b:	74 17                	je     80102774 <blkiowait+0x54>
+8010275d:	8d 76 00             	lea    0x0(%esi),%esi
+        waitsleep(&b->wq, &bq->lock, 1);
+80102760:	83 ec 04             	sub    $0x4,%esp
+80102763:	6a 01                	push   $0x1
+80102765:	56                   	push   %esi
+80102766:	57                   	push   %edi
+80102767:	e8 44 f1 ff ff       	call   801018b0 <waitsleep>
+    while (b->flags & B_QUEUED)
+8010276c:	83 c4 10             	add    $0x10,%esp
+8010276f:	f6 03 08             	testb  $0x8,(%ebx)
+80102772:	75 ec                	jne    80102760 <blkiowait+0x40>
+    release(&bq->lock);
+80102774:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010277a:	5b                   	pop    %ebx
+8010277b:	5e                   	pop    %esi
+8010277c:	5f                   	pop    %edi
+8010277d:	5d                   	pop    %ebp
+    release(&bq->lock);
+8010277e:	e9 4d eb ff ff       	jmp    801012d0 <release>
+80102783:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010278a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102790 <blkrw>:
+// sync buf with disk
+// if B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID
+// else if B_VALID is not set, read buf from disk, set B_VALID
+void
+blkrw(struct buf *b)
+{
+80102790:	55                   	push   %ebp
+80102791:	89 e5                	mov    %esp,%ebp
+80102793:	57                   	push   %edi
+80102794:	56                   	push   %esi
+80102795:	53                   	push   %ebx
+80102796:	83 ec 1c             	sub    $0x1c,%esp
+80102799:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    uint t0;
+    int how;
+
+    if ((b->flags & (B_VALID | B_DIRTY)) == B_VALID)
+8010279c:	8b 0b                	mov    (%ebx),%ecx
+8010279e:	89 c8                	mov    %ecx,%eax
+801027a0:	83 e0 06             	and    $0x6,%eax
+801027a3:	83 f8 02             	cmp    $0x2,%eax
+801027a6:	0f 84 e0 00 00 00    	je     8010288c <blkrw+0xfc>
+        panic("blkrw: nothing to do");
+
+    if (b->flags & B_DIRTY) {
+801027ac:	83 e1 04             	and    $0x4,%ecx
+801027af:	75 77                	jne    80102828 <blkrw+0x98>
+801027b1:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801027b4:	0f 31                	rdtsc
+        return;
+    }
+    t0 = (uint)rdtsc();
+    // a readahead of b may be on its way already;
+    // if so, this waits for that one
+    blksubmit(b, 0);
+801027b6:	83 ec 08             	sub    $0x8,%esp
+801027b9:	89 c7                	mov    %eax,%edi
+801027bb:	6a 00                	push   $0x0
+801027bd:	53                   	push   %ebx
+801027be:	e8 fd fd ff ff       	call   801025c0 <blksubmit>
+    how = blkpollwait(b);
+801027c3:	89 d8                	mov    %ebx,%eax
+801027c5:	e8 86 fa ff ff       	call   80102250 <blkpollwait>
+801027ca:	89 c3                	mov    %eax,%ebx
+801027cc:	0f 31                	rdtsc
+801027ce:	89 c6                	mov    %eax,%esi
+    if ((mhz = tsckhz() / 1000) == 0)
+801027d0:	e8 eb 69 00 00       	call   801091c0 <tsckhz>
+801027d5:	83 c4 10             	add    $0x10,%esp
+801027d8:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+801027dd:	76 3b                	jbe    8010281a <blkrw+0x8a>
+801027df:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    blklatadd(how, (uint)rdtsc() - t0);
+801027e4:	29 fe                	sub    %edi,%esi
+    for (bin = 0; us > 0 && bin < NLATBIN - 1; bin++)
+801027e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    if ((mhz = tsckhz() / 1000) == 0)
+801027e9:	f7 e2                	mul    %edx
+    us = cycles / mhz;
+801027eb:	89 f0                	mov    %esi,%eax
+    if ((mhz = tsckhz() / 1000) == 0)
+801027ed:	c1 ea 06             	shr    $0x6,%edx
+801027f0:	89 d7                	mov    %edx,%edi
+    us = cycles / mhz;
+801027f2:	31 d2                	xor    %edx,%edx
+801027f4:	f7 f7                	div    %edi
+    for (bin = 0; us > 0 && bin < NLATBIN - 1; bin++)
+801027f6:	39 fe                	cmp    %edi,%esi
+801027f8:	0f 82 8a 00 00 00    	jb     80102888 <blkrw+0xf8>
+801027fe:	66 90                	xchg   %ax,%ax
+80102800:	83 c1 01             	add    $0x1,%ecx
+80102803:	d1 e8                	shr    %eax
+80102805:	74 05                	je     8010280c <blkrw+0x7c>
+80102807:	83 f9 0e             	cmp    $0xe,%ecx
+8010280a:	7e f4                	jle    80102800 <blkrw+0x70>
+    __sync_fetch_and_add(&blklat[how][bin], 1);
+8010280c:	c1 e3 04             	shl    $0x4,%ebx
+8010280f:	01 cb                	add    %ecx,%ebx
+80102811:	f0 83 04 9d 00 df 18 	lock addl $0x1,-0x7fe72100(,%ebx,4)
+80102818:	80 01 
+}
+8010281a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010281d:	5b                   	pop    %ebx
+8010281e:	5e                   	pop    %esi
+8010281f:	5f                   	pop    %edi
+80102820:	5d                   	pop    %ebp
+80102821:	c3                   	ret
+80102822:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        blksubmit(b, 0);
+80102828:	83 ec 08             	sub    $0x8,%esp
+8010282b:	6a 00                	push   $0x0
+8010282d:	53                   	push   %ebx
+8010282e:	e8 8d fd ff ff       	call   801025c0 <blksubmit>
+    if (!(b->flags & B_QUEUED))
+80102833:	83 c4 10             	add    $0x10,%esp
+80102836:	f6 03 08             	testb  $0x8,(%ebx)
+80102839:	74 df                	je     8010281a <blkrw+0x8a>
+    acquire(&bq->lock);
+8010283b:	8b b3 c8 00 00 00    	mov    0xc8(%ebx),%esi
+80102841:	83 ec 0c             	sub    $0xc,%esp
+        waitsleep(&b->wq, &bq->lock, 1);
+80102844:	8d bb bc 00 00 00    	lea    0xbc(%ebx),%edi
+    acquire(&bq->lock);
+8010284a:	56                   	push   %esi
+8010284b:	e8 60 ec ff ff       	call   801014b0 <acquire>
+    while (b->flags & B_QUEUED)
+80102850:	83 c4 10             	add    $0x10,%esp
+80102853:	f6 03 08             	testb  $0x8,(%ebx)
+80102856:	74 1c                	je     80102874 <blkrw+0xe4>
+80102858:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010285f:	90                   	nop
+        waitsleep(&b->wq, &bq->lock, 1);
+80102860:	83 ec 04             	sub    $0x4,%esp
+80102863:	6a 01                	push   $0x1
+80102865:	56                   	push   %esi
+80102866:	57                   	push   %edi
+80102867:	e8 44 f0 ff ff       	call   801018b0 <waitsleep>
+    while (b->flags & B_QUEUED)
+8010286c:	83 c4 10             	add    $0x10,%esp
+8010286f:	f6 03 08             	testb  $0x8,(%ebx)
+80102872:	75 ec                	jne    80102860 <blkrw+0xd0>
+    release(&bq->lock);
+80102874:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102877:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010287a:	5b                   	pop    %ebx
+8010287b:	5e                   	pop    %esi
+8010287c:	5f                   	pop    %edi
+8010287d:	5d                   	pop    %ebp
+    release(&bq->lock);
+8010287e:	e9 4d ea ff ff       	jmp    801012d0 <release>
+80102883:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102887:	90                   	nop
+    for (bin = 0; us > 0 && bin < NLATBIN - 1; bin++)
+80102888:	31 c9                	xor    %ecx,%ecx
+8010288a:	eb 80                	jmp    8010280c <blkrw+0x7c>
+        panic("blkrw: nothing to do");
+8010288c:	83 ec 0c             	sub    $0xc,%esp
+8010288f:	68 22 af 10 80       	push   $0x8010af22
+80102894:	e8 a7 74 00 00       	call   80109d40 <panic>
+80102899:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801028a0 <blkstatdump>:
+
+// the read latency histograms
+void
+blkstatdump(void)
+{
+801028a0:	55                   	push   %ebp
+801028a1:	89 e5                	mov    %esp,%ebp
+801028a3:	57                   	push   %edi
+801028a4:	56                   	push   %esi
+    int i, j;
+
+    cprintf("read latency, us: <1");
+    for (j = 1; j < NLATBIN; j++)
+        cprintf(" %d", 1 << (j - 1));
+801028a5:	be 01 00 00 00       	mov    $0x1,%esi
+{
+801028aa:	53                   	push   %ebx
+    cprintf("read latency, us: <1");
+801028ab:	31 db                	xor    %ebx,%ebx
+{
+801028ad:	83 ec 18             	sub    $0x18,%esp
+    cprintf("read latency, us: <1");
+801028b0:	68 37 af 10 80       	push   $0x8010af37
+801028b5:	e8 06 75 00 00       	call   80109dc0 <cprintf>
+801028ba:	83 c4 10             	add    $0x10,%esp
+801028bd:	8d 76 00             	lea    0x0(%esi),%esi
+        cprintf(" %d", 1 << (j - 1));
+801028c0:	89 d9                	mov    %ebx,%ecx
+801028c2:	89 f0                	mov    %esi,%eax
+801028c4:	83 ec 08             	sub    $0x8,%esp
+    for (j = 1; j < NLATBIN; j++)
+801028c7:	83 c3 01             	add    $0x1,%ebx
+        cprintf(" %d", 1 << (j - 1));
+801028ca:	d3 e0                	shl    %cl,%eax
+801028cc:	50                   	push   %eax
+801028cd:	68 4c af 10 80       	push   $0x8010af4c
+801028d2:	e8 e9 74 00 00       	call   80109dc0 <cprintf>
+    for (j = 1; j < NLATBIN; j++)
+801028d7:	83 c4 10             	add    $0x10,%esp
+801028da:	83 fb 0f             	cmp    $0xf,%ebx
+801028dd:	75 e1                	jne    801028c0 <blkstatdump+0x20>
+    cprintf("+\n");
+801028df:	83 ec 0c             	sub    $0xc,%esp
+801028e2:	be 40 df 18 80       	mov    $0x8018df40,%esi
+    for (i = 0; i < NLAT; i++) {
+801028e7:	31 ff                	xor    %edi,%edi
+    cprintf("+\n");
+801028e9:	68 50 af 10 80       	push   $0x8010af50
+801028ee:	e8 cd 74 00 00       	call   80109dc0 <cprintf>
+    for (i = 0; i < NLAT; i++) {
+801028f3:	83 c4 10             	add    $0x10,%esp
+        cprintf("%s:", latnames[i]);
+801028f6:	83 ec 08             	sub    $0x8,%esp
+801028f9:	ff 34 bd 94 af 10 80 	push   -0x7fef506c(,%edi,4)
+80102900:	8d 5e c0             	lea    -0x40(%esi),%ebx
+80102903:	68 53 af 10 80       	push   $0x8010af53
+80102908:	e8 b3 74 00 00       	call   80109dc0 <cprintf>
+        for (j = 0; j < NLATBIN; j++)
+8010290d:	83 c4 10             	add    $0x10,%esp
+            cprintf(" %d", blklat[i][j]);
+80102910:	83 ec 08             	sub    $0x8,%esp
+80102913:	ff 33                	push   (%ebx)
+        for (j = 0; j < NLATBIN; j++)
+80102915:	83 c3 04             	add    $0x4,%ebx
+            cprintf(" %d", blklat[i][j]);
+80102918:	68 4c af 10 80       	push   $0x8010af4c
+8010291d:	e8 9e 74 00 00       	call   80109dc0 <cprintf>
+        for (j = 0; j < NLATBIN; j++)
+80102922:	83 c4 10             	add    $0x10,%esp
+80102925:	39 f3                	cmp    %esi,%ebx
+80102927:	75 e7                	jne    80102910 <blkstatdump+0x70>
+        cprintf("\n");
+80102929:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < NLAT; i++) {
+8010292c:	83 c7 01             	add    $0x1,%edi
+8010292f:	8d 73 40             	lea    0x40(%ebx),%esi
+        cprintf("\n");
+80102932:	68 51 af 10 80       	push   $0x8010af51
+80102937:	e8 84 74 00 00       	call   80109dc0 <cprintf>
+    for (i = 0; i < NLAT; i++) {
+8010293c:	83 c4 10             	add    $0x10,%esp
+8010293f:	83 ff 03             	cmp    $0x3,%edi
+80102942:	75 b2                	jne    801028f6 <blkstatdump+0x56>
+    }
+}
+80102944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102947:	5b                   	pop    %ebx
+80102948:	5e                   	pop    %esi
+80102949:	5f                   	pop    %edi
+8010294a:	5d                   	pop    %ebp
+8010294b:	c3                   	ret
+8010294c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102950 <blkpollbench>:
+
+// ROOTDEV's read latency with polling off, then on, bypassing the
+// buffer cache. must be called from a process.
+void
+blkpollbench(void)
+{
+80102950:	55                   	push   %ebp
+80102951:	89 e5                	mov    %esp,%ebp
+80102953:	57                   	push   %edi
+
+    initsleeplock(&b.lock, "pollbench");
+    b.dev = ROOTDEV;
+    b.data = data;
+    acquiresleep(&b.lock);
+    polling = blkpolling;
+80102954:	bf 02 00 00 00       	mov    $0x2,%edi
+{
+80102959:	56                   	push   %esi
+8010295a:	53                   	push   %ebx
+8010295b:	83 ec 24             	sub    $0x24,%esp
+    initsleeplock(&b.lock, "pollbench");
+8010295e:	68 57 af 10 80       	push   $0x8010af57
+80102963:	68 0c de 18 80       	push   $0x8018de0c
+80102968:	e8 03 f1 ff ff       	call   80101a70 <initsleeplock>
+    b.dev = ROOTDEV;
+8010296d:	c7 05 04 de 18 80 01 	movl   $0x1,0x8018de04
+80102974:	00 00 00 
+    b.data = data;
+80102977:	c7 05 cc de 18 80 00 	movl   $0x8018dc00,0x8018decc
+8010297e:	dc 18 80 
+    acquiresleep(&b.lock);
+80102981:	c7 04 24 0c de 18 80 	movl   $0x8018de0c,(%esp)
+80102988:	e8 33 f1 ff ff       	call   80101ac0 <acquiresleep>
+    polling = blkpolling;
+8010298d:	8b 1d 00 c0 10 80    	mov    0x8010c000,%ebx
+80102993:	83 c4 10             	add    $0x10,%esp
+    for (mode = 0; mode < 2; mode++) {
+80102996:	31 c0                	xor    %eax,%eax
+        blkpolling = mode;
+        memset(blklat, 0, sizeof(blklat));
+        for (i = 0; i < POLLBENCH; i++) {
+            // strided, so no run of them is a sequential read
+            b.blockno = i * 37 % FSSIZE;
+80102998:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+8010299b:	89 fb                	mov    %edi,%ebx
+        memset(blklat, 0, sizeof(blklat));
+8010299d:	83 ec 04             	sub    $0x4,%esp
+        blkpolling = mode;
+801029a0:	a3 00 c0 10 80       	mov    %eax,0x8010c000
+        memset(blklat, 0, sizeof(blklat));
+801029a5:	68 c0 00 00 00       	push   $0xc0
+801029aa:	6a 00                	push   $0x0
+801029ac:	68 00 df 18 80       	push   $0x8018df00
+801029b1:	e8 8a d6 ff ff       	call   80100040 <memset>
+801029b6:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+801029b9:	83 c4 10             	add    $0x10,%esp
+801029bc:	31 c9                	xor    %ecx,%ecx
+801029be:	66 90                	xchg   %ax,%ax
+            b.blockno = i * 37 % FSSIZE;
+801029c0:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+801029c5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+            b.flags = 0;
+801029c8:	c7 05 00 de 18 80 00 	movl   $0x0,0x8018de00
+801029cf:	00 00 00 
+            b.blockno = i * 37 % FSSIZE;
+801029d2:	f7 e1                	mul    %ecx
+801029d4:	89 c8                	mov    %ecx,%eax
+801029d6:	c1 ea 06             	shr    $0x6,%edx
+801029d9:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+801029df:	29 d0                	sub    %edx,%eax
+801029e1:	a3 08 de 18 80       	mov    %eax,0x8018de08
+801029e6:	0f 31                	rdtsc
+    blksubmit(b, 0);
+801029e8:	83 ec 08             	sub    $0x8,%esp
+801029eb:	89 c6                	mov    %eax,%esi
+801029ed:	6a 00                	push   $0x0
+801029ef:	68 00 de 18 80       	push   $0x8018de00
+801029f4:	e8 c7 fb ff ff       	call   801025c0 <blksubmit>
+    how = blkpollwait(b);
+801029f9:	b8 00 de 18 80       	mov    $0x8018de00,%eax
+801029fe:	e8 4d f8 ff ff       	call   80102250 <blkpollwait>
+80102a03:	89 c3                	mov    %eax,%ebx
+80102a05:	0f 31                	rdtsc
+80102a07:	89 c7                	mov    %eax,%edi
+    if ((mhz = tsckhz() / 1000) == 0)
+80102a09:	e8 b2 67 00 00       	call   801091c0 <tsckhz>
+80102a0e:	83 c4 10             	add    $0x10,%esp
+80102a11:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102a14:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+80102a19:	76 37                	jbe    80102a52 <blkpollbench+0x102>
+    blklatadd(how, (uint)rdtsc() - t0);
+80102a1b:	29 f7                	sub    %esi,%edi
+    if ((mhz = tsckhz() / 1000) == 0)
+80102a1d:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+80102a22:	f7 e6                	mul    %esi
+    us = cycles / mhz;
+80102a24:	89 f8                	mov    %edi,%eax
+    if ((mhz = tsckhz() / 1000) == 0)
+80102a26:	89 d6                	mov    %edx,%esi
+    us = cycles / mhz;
+80102a28:	31 d2                	xor    %edx,%edx
+    if ((mhz = tsckhz() / 1000) == 0)
+80102a2a:	c1 ee 06             	shr    $0x6,%esi
+    us = cycles / mhz;
+80102a2d:	f7 f6                	div    %esi
+    for (bin = 0; us > 0 && bin < NLATBIN - 1; bin++)
+80102a2f:	31 d2                	xor    %edx,%edx
+80102a31:	39 f7                	cmp    %esi,%edi
+80102a33:	72 0f                	jb     80102a44 <blkpollbench+0xf4>
+80102a35:	8d 76 00             	lea    0x0(%esi),%esi
+80102a38:	83 c2 01             	add    $0x1,%edx
+80102a3b:	d1 e8                	shr    %eax
+80102a3d:	74 05                	je     80102a44 <blkpollbench+0xf4>
+80102a3f:	83 fa 0e             	cmp    $0xe,%edx
+80102a42:	7e f4                	jle    80102a38 <blkpollbench+0xe8>
+    __sync_fetch_and_add(&blklat[how][bin], 1);
+80102a44:	c1 e3 04             	shl    $0x4,%ebx
+80102a47:	01 d3                	add    %edx,%ebx
+80102a49:	f0 83 04 9d 00 df 18 	lock addl $0x1,-0x7fe72100(,%ebx,4)
+80102a50:	80 01 
+        for (i = 0; i < POLLBENCH; i++) {
+80102a52:	83 c1 25             	add    $0x25,%ecx
+80102a55:	81 f9 88 90 00 00    	cmp    $0x9088,%ecx
+80102a5b:	0f 85 5f ff ff ff    	jne    801029c0 <blkpollbench+0x70>
+            blkrw(&b);
+        }
+        cprintf("polling %s:\n", mode ? "on" : "off");
+80102a61:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+80102a64:	83 fb 01             	cmp    $0x1,%ebx
+80102a67:	75 34                	jne    80102a9d <blkpollbench+0x14d>
+80102a69:	83 ec 08             	sub    $0x8,%esp
+80102a6c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102a6f:	68 61 af 10 80       	push   $0x8010af61
+80102a74:	68 64 af 10 80       	push   $0x8010af64
+80102a79:	e8 42 73 00 00       	call   80109dc0 <cprintf>
+        blkstatdump();
+80102a7e:	e8 1d fe ff ff       	call   801028a0 <blkstatdump>
+    }
+    blkpolling = polling;
+80102a83:	89 1d 00 c0 10 80    	mov    %ebx,0x8010c000
+    releasesleep(&b.lock);
+80102a89:	c7 04 24 0c de 18 80 	movl   $0x8018de0c,(%esp)
+80102a90:	e8 2b f1 ff ff       	call   80101bc0 <releasesleep>
+}
+80102a95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102a98:	5b                   	pop    %ebx
+80102a99:	5e                   	pop    %esi
+80102a9a:	5f                   	pop    %edi
+80102a9b:	5d                   	pop    %ebp
+80102a9c:	c3                   	ret
+        cprintf("polling %s:\n", mode ? "on" : "off");
+80102a9d:	83 ec 08             	sub    $0x8,%esp
+        blkstatdump();
+80102aa0:	bb 01 00 00 00       	mov    $0x1,%ebx
+        cprintf("polling %s:\n", mode ? "on" : "off");
+80102aa5:	68 71 af 10 80       	push   $0x8010af71
+80102aaa:	68 64 af 10 80       	push   $0x8010af64
+80102aaf:	e8 0c 73 00 00       	call   80109dc0 <cprintf>
+        blkstatdump();
+80102ab4:	e8 e7 fd ff ff       	call   801028a0 <blkstatdump>
+80102ab9:	83 c4 10             	add    $0x10,%esp
+    for (mode = 0; mode < 2; mode++) {
+80102abc:	b8 01 00 00 00       	mov    $0x1,%eax
+80102ac1:	e9 d7 fe ff ff       	jmp    8010299d <blkpollbench+0x4d>
+80102ac6:	66 90                	xchg   %ax,%ax
+80102ac8:	66 90                	xchg   %ax,%ax
+80102aca:	66 90                	xchg   %ax,%ax
+80102acc:	66 90                	xchg   %ax,%ax
+80102ace:	66 90                	xchg   %ax,%ax
+
+80102ad0 <idestart>:
+// picked and those for the blocks that follow its, going the same way,
+// so that one command and one interrupt do them all.
+// called by blkstart() with ideq.lock held, the disk idle
+static void
+idestart(struct blkqueue *bq, struct buf *b)
+{
+80102ad0:	55                   	push   %ebp
+        panic("indestart:");
+
+    idequeue = b;
+    int sector = b->blockno * sector_per_block;
+
+    for (n = 0, x = b; x; n++, x = x->qnext)
+80102ad1:	31 c9                	xor    %ecx,%ecx
+{
+80102ad3:	89 e5                	mov    %esp,%ebp
+80102ad5:	57                   	push   %edi
+80102ad6:	56                   	push   %esi
+80102ad7:	53                   	push   %ebx
+80102ad8:	83 ec 1c             	sub    $0x1c,%esp
+80102adb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    int sector = b->blockno * sector_per_block;
+80102ade:	8b 5f 08             	mov    0x8(%edi),%ebx
+    idequeue = b;
+80102ae1:	89 3d 0c e4 18 80    	mov    %edi,0x8018e40c
+    int sector = b->blockno * sector_per_block;
+80102ae7:	89 f8                	mov    %edi,%eax
+80102ae9:	89 da                	mov    %ebx,%edx
+80102aeb:	eb 06                	jmp    80102af3 <idestart+0x23>
+80102aed:	8d 76 00             	lea    0x0(%esi),%esi
+        if (x->blockno >= FSSIZE)
+80102af0:	8b 50 08             	mov    0x8(%eax),%edx
+80102af3:	81 fa e7 03 00 00    	cmp    $0x3e7,%edx
+80102af9:	0f 87 d0 01 00 00    	ja     80102ccf <idestart+0x1ff>
+    for (n = 0, x = b; x; n++, x = x->qnext)
+80102aff:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80102b05:	83 c1 01             	add    $0x1,%ecx
+80102b08:	85 c0                	test   %eax,%eax
+80102b0a:	75 e4                	jne    80102af0 <idestart+0x20>
+            panic("idestart:incorrect blockno");
+    iderun = n;
+
+    int read_cmd = (n * sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
+80102b0c:	83 f9 01             	cmp    $0x1,%ecx
+80102b0f:	ba 20 00 00 00       	mov    $0x20,%edx
+80102b14:	b8 c4 00 00 00       	mov    $0xc4,%eax
+    iderun = n;
+80102b19:	89 0d 04 e4 18 80    	mov    %ecx,0x8018e404
+    int read_cmd = (n * sector_per_block == 1) ? IDE_CMD_READ : IDE_CMD_RDMUL;
+80102b1f:	0f 44 c2             	cmove  %edx,%eax
+80102b22:	ba 30 00 00 00       	mov    $0x30,%edx
+80102b27:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102b2a:	b8 c5 00 00 00       	mov    $0xc5,%eax
+80102b2f:	0f 44 c2             	cmove  %edx,%eax
+80102b32:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    int write_cmd = (n * sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+
+    if (idebm) {
+80102b35:	0f b7 05 00 e4 18 80 	movzwl 0x8018e400,%eax
+80102b3c:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+80102b40:	66 85 c0             	test   %ax,%ax
+80102b43:	0f 85 9f 00 00 00    	jne    80102be8 <idestart+0x118>
+    outb(0x1F3, sector & 0xFF);
+    outb(0x1F4, (sector >> 8) & 0xFF);
+    outb(0x1F5, (sector >> 16) & 0xFF);
+    outb(0x1F6, 0xE0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
+    if (idebm) {
+        outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+80102b49:	8b 07                	mov    (%edi),%eax
+80102b4b:	83 e0 04             	and    $0x4,%eax
+80102b4e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102b51:	be f7 01 00 00       	mov    $0x1f7,%esi
+80102b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b5d:	8d 76 00             	lea    0x0(%esi),%esi
+80102b60:	89 f2                	mov    %esi,%edx
+80102b62:	ec                   	in     (%dx),%al
+    while (((r = inb(0x1F7)) & (IDE_BUSY | IDE_DRDY)) != IDE_DRDY)
+80102b63:	83 e0 c0             	and    $0xffffffc0,%eax
+80102b66:	3c 40                	cmp    $0x40,%al
+80102b68:	75 f6                	jne    80102b60 <idestart+0x90>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102b6a:	31 c0                	xor    %eax,%eax
+80102b6c:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102b71:	ee                   	out    %al,(%dx)
+80102b72:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102b77:	89 c8                	mov    %ecx,%eax
+80102b79:	ee                   	out    %al,(%dx)
+80102b7a:	ba f3 01 00 00       	mov    $0x1f3,%edx
+80102b7f:	89 d8                	mov    %ebx,%eax
+80102b81:	ee                   	out    %al,(%dx)
+    outb(0x1F4, (sector >> 8) & 0xFF);
+80102b82:	89 d8                	mov    %ebx,%eax
+80102b84:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80102b89:	c1 f8 08             	sar    $0x8,%eax
+80102b8c:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (sector >> 16) & 0xFF);
+80102b8d:	89 d8                	mov    %ebx,%eax
+80102b8f:	ba f5 01 00 00       	mov    $0x1f5,%edx
+80102b94:	c1 f8 10             	sar    $0x10,%eax
+80102b97:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((b->dev & 1) << 4) | ((sector >> 24) & 0x0f));
+80102b98:	0f b6 47 04          	movzbl 0x4(%edi),%eax
+80102b9c:	c1 fb 18             	sar    $0x18,%ebx
+80102b9f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102ba4:	83 e3 0f             	and    $0xf,%ebx
+80102ba7:	c1 e0 04             	shl    $0x4,%eax
+80102baa:	83 e0 10             	and    $0x10,%eax
+80102bad:	09 d8                	or     %ebx,%eax
+80102baf:	83 c8 e0             	or     $0xffffffe0,%eax
+80102bb2:	ee                   	out    %al,(%dx)
+    if (idebm) {
+80102bb3:	0f b7 5d e6          	movzwl -0x1a(%ebp),%ebx
+80102bb7:	66 85 db             	test   %bx,%bx
+80102bba:	0f 84 b0 00 00 00    	je     80102c70 <idestart+0x1a0>
+        outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+80102bc0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80102bc3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102bc6:	85 d2                	test   %edx,%edx
+80102bc8:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102bcd:	0f 44 45 e0          	cmove  -0x20(%ebp),%eax
+80102bd1:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102bd2:	89 da                	mov    %ebx,%edx
+80102bd4:	ec                   	in     (%dx),%al
+        outb(idebm + BM_CMD, inb(idebm + BM_CMD) | BM_START);
+80102bd5:	83 c8 01             	or     $0x1,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102bd8:	ee                   	out    %al,(%dx)
+        for (x = b; n-- > 0; x = x->qnext)
+            outsl(0x1f0, x->data, BSIZE/4);
+    } else {
+        outb(0x1f7, read_cmd);
+    }
+}
+80102bd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102bdc:	5b                   	pop    %ebx
+80102bdd:	5e                   	pop    %esi
+80102bde:	5f                   	pop    %edi
+80102bdf:	5d                   	pop    %ebp
+80102be0:	c3                   	ret
+80102be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102be8:	89 fa                	mov    %edi,%edx
+        for (n = 0, x = b; x; n++, x = x->qnext) {
+80102bea:	31 c9                	xor    %ecx,%ecx
+80102bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            prdt[n].addr = V2P(x->data);
+80102bf0:	8b 82 cc 00 00 00    	mov    0xcc(%edx),%eax
+80102bf6:	89 ce                	mov    %ecx,%esi
+            prdt[n].n = BSIZE;
+80102bf8:	c7 04 cd 04 e3 18 80 	movl   $0x200,-0x7fe71cfc(,%ecx,8)
+80102bff:	00 02 00 00 
+            prdt[n].addr = V2P(x->data);
+80102c03:	05 00 00 00 80       	add    $0x80000000,%eax
+80102c08:	89 04 cd 00 e3 18 80 	mov    %eax,-0x7fe71d00(,%ecx,8)
+        for (n = 0, x = b; x; n++, x = x->qnext) {
+80102c0f:	8b 92 90 00 00 00    	mov    0x90(%edx),%edx
+80102c15:	83 c1 01             	add    $0x1,%ecx
+80102c18:	85 d2                	test   %edx,%edx
+80102c1a:	75 d4                	jne    80102bf0 <idestart+0x120>
+        prdt[n - 1].flags = PRD_EOT;
+80102c1c:	b8 00 80 ff ff       	mov    $0xffff8000,%eax
+80102c21:	66 89 04 f5 06 e3 18 	mov    %ax,-0x7fe71cfa(,%esi,8)
+80102c28:	80 
+        outl(idebm + BM_PRDT, V2P(prdt));
+80102c29:	0f b7 75 e6          	movzwl -0x1a(%ebp),%esi
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102c2d:	b8 00 e3 18 00       	mov    $0x18e300,%eax
+80102c32:	8d 56 04             	lea    0x4(%esi),%edx
+80102c35:	ef                   	out    %eax,(%dx)
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102c36:	b8 06 00 00 00       	mov    $0x6,%eax
+        outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+80102c3b:	8d 56 02             	lea    0x2(%esi),%edx
+80102c3e:	ee                   	out    %al,(%dx)
+        outb(idebm + BM_CMD, (b->flags & B_DIRTY) ? 0 : BM_READ);
+80102c3f:	8b 07                	mov    (%edi),%eax
+80102c41:	89 f2                	mov    %esi,%edx
+80102c43:	83 e0 04             	and    $0x4,%eax
+80102c46:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80102c49:	0f 94 c0             	sete   %al
+80102c4c:	0f b6 c0             	movzbl %al,%eax
+80102c4f:	c1 e0 03             	shl    $0x3,%eax
+80102c52:	ee                   	out    %al,(%dx)
+        write_cmd = IDE_CMD_WRDMA;
+80102c53:	c7 45 dc ca 00 00 00 	movl   $0xca,-0x24(%ebp)
+        read_cmd = IDE_CMD_RDDMA;
+80102c5a:	c7 45 e0 c8 00 00 00 	movl   $0xc8,-0x20(%ebp)
+80102c61:	e9 eb fe ff ff       	jmp    80102b51 <idestart+0x81>
+80102c66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102c6d:	8d 76 00             	lea    0x0(%esi),%esi
+    } else if(b->flags & B_DIRTY){
+80102c70:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80102c73:	85 c0                	test   %eax,%eax
+80102c75:	74 49                	je     80102cc0 <idestart+0x1f0>
+80102c77:	0f b6 45 dc          	movzbl -0x24(%ebp),%eax
+80102c7b:	89 f2                	mov    %esi,%edx
+80102c7d:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102c7e:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102c87:	90                   	nop
+80102c88:	ec                   	in     (%dx),%al
+        while ((inb(0x1F7) & (IDE_BUSY | IDE_DRQ)) != IDE_DRQ)
+80102c89:	83 e0 88             	and    $0xffffff88,%eax
+80102c8c:	3c 08                	cmp    $0x8,%al
+80102c8e:	75 f8                	jne    80102c88 <idestart+0x1b8>
+        for (x = b; n-- > 0; x = x->qnext)
+80102c90:	8d 41 ff             	lea    -0x1(%ecx),%eax
+    asm volatile("cld; rep outsl" :
+80102c93:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102c98:	bb 80 00 00 00       	mov    $0x80,%ebx
+80102c9d:	8d 76 00             	lea    0x0(%esi),%esi
+80102ca0:	8b b7 cc 00 00 00    	mov    0xcc(%edi),%esi
+80102ca6:	89 d9                	mov    %ebx,%ecx
+80102ca8:	fc                   	cld
+80102ca9:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+80102cab:	8b bf 90 00 00 00    	mov    0x90(%edi),%edi
+80102cb1:	83 e8 01             	sub    $0x1,%eax
+80102cb4:	73 ea                	jae    80102ca0 <idestart+0x1d0>
+}
+80102cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cb9:	5b                   	pop    %ebx
+80102cba:	5e                   	pop    %esi
+80102cbb:	5f                   	pop    %edi
+80102cbc:	5d                   	pop    %ebp
+80102cbd:	c3                   	ret
+80102cbe:	66 90                	xchg   %ax,%ax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102cc0:	0f b6 45 e0          	movzbl -0x20(%ebp),%eax
+80102cc4:	89 f2                	mov    %esi,%edx
+80102cc6:	ee                   	out    %al,(%dx)
+80102cc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cca:	5b                   	pop    %ebx
+80102ccb:	5e                   	pop    %esi
+80102ccc:	5f                   	pop    %edi
+80102ccd:	5d                   	pop    %ebp
+80102cce:	c3                   	ret
+            panic("idestart:incorrect blockno");
+80102ccf:	83 ec 0c             	sub    $0xc,%esp
+80102cd2:	68 a0 af 10 80       	push   $0x8010afa0
+80102cd7:	e8 64 70 00 00       	call   80109d40 <panic>
+80102cdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102ce0 <idefinish>:
+// the next. returns 1 if it was done. with polling, the interrupt for a
+// command can come after the next has started, so don't assume it's done.
+// caller holds ideq.lock
+static int
+idefinish(void)
+{
+80102ce0:	55                   	push   %ebp
+80102ce1:	89 e5                	mov    %esp,%ebp
+80102ce3:	57                   	push   %edi
+80102ce4:	56                   	push   %esi
+80102ce5:	53                   	push   %ebx
+80102ce6:	83 ec 0c             	sub    $0xc,%esp
+    struct buf *b;
+    int i, r;
+
+    // first queued buffers are the active request.
+    if ((b = idequeue) == 0)
+80102ce9:	8b 1d 0c e4 18 80    	mov    0x8018e40c,%ebx
+80102cef:	85 db                	test   %ebx,%ebx
+80102cf1:	0f 84 e9 00 00 00    	je     80102de0 <idefinish+0x100>
+        return 0;
+
+    if (idebm) {
+80102cf7:	0f b7 0d 00 e4 18 80 	movzwl 0x8018e400,%ecx
+80102cfe:	66 85 c9             	test   %cx,%cx
+80102d01:	74 7d                	je     80102d80 <idefinish+0xa0>
+        // the data is in place already; stop the engine
+        if ((inb(idebm + BM_STATUS) & BM_INTR) == 0)
+80102d03:	8d 71 02             	lea    0x2(%ecx),%esi
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102d06:	89 f2                	mov    %esi,%edx
+80102d08:	ec                   	in     (%dx),%al
+80102d09:	a8 04                	test   $0x4,%al
+80102d0b:	0f 84 cf 00 00 00    	je     80102de0 <idefinish+0x100>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102d11:	31 c0                	xor    %eax,%eax
+80102d13:	89 ca                	mov    %ecx,%edx
+80102d15:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102d16:	89 f2                	mov    %esi,%edx
+80102d18:	ec                   	in     (%dx),%al
+            return 0;   // not done, or not ours
+        // the buffers can't be marked valid with the data unread,
+        // and there is no way to tell their owners it failed
+        outb(idebm + BM_CMD, 0);
+        // reading the status acks the drive's interrupt
+        if ((inb(idebm + BM_STATUS) & BM_ERR) || idewait(1) < 0)
+80102d19:	a8 02                	test   $0x2,%al
+80102d1b:	0f 85 c9 00 00 00    	jne    80102dea <idefinish+0x10a>
+80102d21:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102d26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102d2d:	8d 76 00             	lea    0x0(%esi),%esi
+80102d30:	ec                   	in     (%dx),%al
+    while (((r = inb(0x1F7)) & (IDE_BUSY | IDE_DRDY)) != IDE_DRDY)
+80102d31:	89 c1                	mov    %eax,%ecx
+80102d33:	83 e1 c0             	and    $0xffffffc0,%ecx
+80102d36:	80 f9 40             	cmp    $0x40,%cl
+80102d39:	75 f5                	jne    80102d30 <idefinish+0x50>
+    if (checkerr && (r & (IDE_DF | IDE_ERR)) != 0)
+80102d3b:	a8 21                	test   $0x21,%al
+80102d3d:	0f 85 a7 00 00 00    	jne    80102dea <idefinish+0x10a>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102d43:	b8 06 00 00 00       	mov    $0x6,%eax
+80102d48:	89 f2                	mov    %esi,%edx
+80102d4a:	ee                   	out    %al,(%dx)
+                insl(0x1F0, b->data, BSIZE / 4);
+        }
+    }
+
+    b = idequeue;
+    idequeue = 0;
+80102d4b:	c7 05 0c e4 18 80 00 	movl   $0x0,0x8018e40c
+80102d52:	00 00 00 
+    blkdone(&ideq, b);
+80102d55:	83 ec 08             	sub    $0x8,%esp
+80102d58:	53                   	push   %ebx
+80102d59:	68 40 e4 18 80       	push   $0x8018e440
+80102d5e:	e8 ed f7 ff ff       	call   80102550 <blkdone>
+
+    // start disk on next request
+    blkstart(&ideq);
+80102d63:	c7 04 24 40 e4 18 80 	movl   $0x8018e440,(%esp)
+80102d6a:	e8 51 f7 ff ff       	call   801024c0 <blkstart>
+    return 1;
+80102d6f:	83 c4 10             	add    $0x10,%esp
+80102d72:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80102d77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d7a:	5b                   	pop    %ebx
+80102d7b:	5e                   	pop    %esi
+80102d7c:	5f                   	pop    %edi
+80102d7d:	5d                   	pop    %ebp
+80102d7e:	c3                   	ret
+80102d7f:	90                   	nop
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102d80:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102d85:	ec                   	in     (%dx),%al
+80102d86:	89 c2                	mov    %eax,%edx
+        if (r & IDE_BUSY)
+80102d88:	84 c0                	test   %al,%al
+80102d8a:	78 54                	js     80102de0 <idefinish+0x100>
+        if (!(b->flags & B_DIRTY)) {
+80102d8c:	8b 03                	mov    (%ebx),%eax
+80102d8e:	83 e0 04             	and    $0x4,%eax
+80102d91:	75 b8                	jne    80102d4b <idefinish+0x6b>
+            if (r & (IDE_DF | IDE_ERR))
+80102d93:	f6 c2 21             	test   $0x21,%dl
+80102d96:	75 5f                	jne    80102df7 <idefinish+0x117>
+            if (!(r & IDE_DRQ))
+80102d98:	83 e2 08             	and    $0x8,%edx
+80102d9b:	74 da                	je     80102d77 <idefinish+0x97>
+            for (i = 0; i < iderun; i++, b = b->qnext)
+80102d9d:	8b 15 04 e4 18 80    	mov    0x8018e404,%edx
+80102da3:	85 d2                	test   %edx,%edx
+80102da5:	7e a4                	jle    80102d4b <idefinish+0x6b>
+    asm volatile("cld; rep insl" :
+80102da7:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80102dac:	be 80 00 00 00       	mov    $0x80,%esi
+80102db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102db8:	8b bb cc 00 00 00    	mov    0xcc(%ebx),%edi
+80102dbe:	89 f1                	mov    %esi,%ecx
+80102dc0:	fc                   	cld
+80102dc1:	f3 6d                	rep insl (%dx),%es:(%edi)
+80102dc3:	8b 9b 90 00 00 00    	mov    0x90(%ebx),%ebx
+80102dc9:	83 c0 01             	add    $0x1,%eax
+80102dcc:	39 05 04 e4 18 80    	cmp    %eax,0x8018e404
+80102dd2:	7f e4                	jg     80102db8 <idefinish+0xd8>
+    b = idequeue;
+80102dd4:	8b 1d 0c e4 18 80    	mov    0x8018e40c,%ebx
+80102dda:	e9 6c ff ff ff       	jmp    80102d4b <idefinish+0x6b>
+80102ddf:	90                   	nop
+}
+80102de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+80102de3:	31 c0                	xor    %eax,%eax
+}
+80102de5:	5b                   	pop    %ebx
+80102de6:	5e                   	pop    %esi
+80102de7:	5f                   	pop    %edi
+80102de8:	5d                   	pop    %ebp
+80102de9:	c3                   	ret
+            panic("idefinish: dma error");
+80102dea:	83 ec 0c             	sub    $0xc,%esp
+80102ded:	68 bb af 10 80       	push   $0x8010afbb
+80102df2:	e8 49 6f 00 00       	call   80109d40 <panic>
+                panic("idefinish: read error");
+80102df7:	83 ec 0c             	sub    $0xc,%esp
+80102dfa:	68 d0 af 10 80       	push   $0x8010afd0
+80102dff:	e8 3c 6f 00 00       	call   80109d40 <panic>
+80102e04:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102e0f:	90                   	nop
+
+80102e10 <idepoll>:
+
+// blkrw()'s poll of the status for a read, instead of the interrupt
+static int
+idepoll(struct blkqueue *bq)
+{
+    return idefinish();
+80102e10:	e9 cb fe ff ff       	jmp    80102ce0 <idefinish>
+80102e15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102e20 <idetest>:
+{
+80102e20:	55                   	push   %ebp
+80102e21:	89 e5                	mov    %esp,%ebp
+80102e23:	83 ec 10             	sub    $0x10,%esp
+    b.dev = 1;
+80102e26:	c7 05 04 e2 18 80 01 	movl   $0x1,0x8018e204
+80102e2d:	00 00 00 
+    b.data = bdata;
+80102e30:	c7 05 cc e2 18 80 00 	movl   $0x8018e000,0x8018e2cc
+80102e37:	e0 18 80 
+    initsleeplock(&(b.lock), "ide test");
+80102e3a:	68 e6 af 10 80       	push   $0x8010afe6
+80102e3f:	68 0c e2 18 80       	push   $0x8018e20c
+80102e44:	e8 27 ec ff ff       	call   80101a70 <initsleeplock>
+    acquiresleep(&(b.lock));
+80102e49:	c7 04 24 0c e2 18 80 	movl   $0x8018e20c,(%esp)
+80102e50:	e8 6b ec ff ff       	call   80101ac0 <acquiresleep>
+    blkrw(&b);
+80102e55:	c7 04 24 00 e2 18 80 	movl   $0x8018e200,(%esp)
+80102e5c:	e8 2f f9 ff ff       	call   80102790 <blkrw>
+    releasesleep(&(b.lock));
+80102e61:	c7 04 24 0c e2 18 80 	movl   $0x8018e20c,(%esp)
+80102e68:	e8 53 ed ff ff       	call   80101bc0 <releasesleep>
+}
+80102e6d:	83 c4 10             	add    $0x10,%esp
+80102e70:	c9                   	leave
+80102e71:	c3                   	ret
+80102e72:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80102e80 <ideinit>:
+{
+80102e80:	55                   	push   %ebp
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102e81:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102e86:	89 e5                	mov    %esp,%ebp
+80102e88:	56                   	push   %esi
+80102e89:	53                   	push   %ebx
+80102e8a:	83 ec 10             	sub    $0x10,%esp
+80102e8d:	ec                   	in     (%dx),%al
+    if (inb(0x1F7) == 0xFF) {
+80102e8e:	3c ff                	cmp    $0xff,%al
+80102e90:	0f 84 a2 02 00 00    	je     80103138 <ideinit+0x2b8>
+    ioapicenable(IRQ_IDE, ncpu - 1);
+80102e96:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80102e9b:	83 ec 08             	sub    $0x8,%esp
+80102e9e:	83 e8 01             	sub    $0x1,%eax
+80102ea1:	50                   	push   %eax
+80102ea2:	6a 0e                	push   $0xe
+80102ea4:	e8 77 d9 ff ff       	call   80100820 <ioapicenable>
+    while (((r = inb(0x1F7)) & (IDE_BUSY | IDE_DRDY)) != IDE_DRDY)
+80102ea9:	83 c4 10             	add    $0x10,%esp
+80102eac:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80102eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102eb8:	89 ca                	mov    %ecx,%edx
+80102eba:	ec                   	in     (%dx),%al
+80102ebb:	83 e0 c0             	and    $0xffffffc0,%eax
+80102ebe:	3c 40                	cmp    $0x40,%al
+80102ec0:	75 f6                	jne    80102eb8 <ideinit+0x38>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102ec2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+80102ec7:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102ecc:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102ecd:	89 ca                	mov    %ecx,%edx
+80102ecf:	ec                   	in     (%dx),%al
+        if (inb(0x1F7) != 0) {
+80102ed0:	84 c0                	test   %al,%al
+80102ed2:	75 1a                	jne    80102eee <ideinit+0x6e>
+80102ed4:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+80102ed9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102ede:	66 90                	xchg   %ax,%ax
+    for (i = 0; i < 1000; i++) {
+80102ee0:	83 e9 01             	sub    $0x1,%ecx
+80102ee3:	0f 84 66 02 00 00    	je     8010314f <ideinit+0x2cf>
+80102ee9:	ec                   	in     (%dx),%al
+        if (inb(0x1F7) != 0) {
+80102eea:	84 c0                	test   %al,%al
+80102eec:	74 f2                	je     80102ee0 <ideinit+0x60>
+            havedisk1 = 1;
+80102eee:	c7 05 08 e4 18 80 01 	movl   $0x1,0x8018e408
+80102ef5:	00 00 00 
+            break;
+80102ef8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102efd:	b8 02 00 00 00       	mov    $0x2,%eax
+80102f02:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80102f07:	ee                   	out    %al,(%dx)
+80102f08:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102f0d:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102f12:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f13:	bb f7 01 00 00       	mov    $0x1f7,%ebx
+80102f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102f1f:	90                   	nop
+80102f20:	89 da                	mov    %ebx,%edx
+80102f22:	ec                   	in     (%dx),%al
+    while (((r = inb(0x1F7)) & (IDE_BUSY | IDE_DRDY)) != IDE_DRDY)
+80102f23:	83 e0 c0             	and    $0xffffffc0,%eax
+80102f26:	3c 40                	cmp    $0x40,%al
+80102f28:	75 f6                	jne    80102f20 <ideinit+0xa0>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f2a:	b8 10 00 00 00       	mov    $0x10,%eax
+80102f2f:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80102f34:	ee                   	out    %al,(%dx)
+80102f35:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+80102f3a:	89 da                	mov    %ebx,%edx
+80102f3c:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80102f3d:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80102f42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80102f48:	ec                   	in     (%dx),%al
+80102f49:	89 c3                	mov    %eax,%ebx
+80102f4b:	83 e3 c0             	and    $0xffffffc0,%ebx
+80102f4e:	80 fb 40             	cmp    $0x40,%bl
+80102f51:	75 f5                	jne    80102f48 <ideinit+0xc8>
+    if (checkerr && (r & (IDE_DF | IDE_ERR)) != 0)
+80102f53:	83 e0 21             	and    $0x21,%eax
+    return idewait(1) < 0 ? 1 : IDEMULT;
+80102f56:	3c 01                	cmp    $0x1,%al
+80102f58:	19 db                	sbb    %ebx,%ebx
+80102f5a:	83 e3 0f             	and    $0xf,%ebx
+80102f5d:	83 c3 01             	add    $0x1,%ebx
+    idemult = idesetmult(0);
+80102f60:	89 1d 04 c0 10 80    	mov    %ebx,0x8010c004
+    if (havedisk1 && idesetmult(1) < idemult)
+80102f66:	85 c9                	test   %ecx,%ecx
+80102f68:	0f 85 52 01 00 00    	jne    801030c0 <ideinit+0x240>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80102f6e:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80102f73:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80102f78:	ee                   	out    %al,(%dx)
+    if ((d = pcifindclass(PCI_IDE)) != 0 && (d->progif & 0x80) && (d->bar[4] & PCI_BAR_IO)) {
+80102f79:	83 ec 0c             	sub    $0xc,%esp
+80102f7c:	68 01 01 00 00       	push   $0x101
+80102f81:	e8 ea db ff ff       	call   80100b70 <pcifindclass>
+80102f86:	83 c4 10             	add    $0x10,%esp
+80102f89:	85 c0                	test   %eax,%eax
+80102f8b:	74 0a                	je     80102f97 <ideinit+0x117>
+80102f8d:	80 78 12 00          	cmpb   $0x0,0x12(%eax)
+80102f91:	0f 88 e9 00 00 00    	js     80103080 <ideinit+0x200>
+    blkqinit(&ideq, "ide", &deadlinesched, idebm ? IDEDMAMAX : idemult / (BSIZE / SECTOR_SIZE), 1, idestart, 0);
+80102f97:	0f b7 0d 00 e4 18 80 	movzwl 0x8018e400,%ecx
+80102f9e:	66 85 c9             	test   %cx,%cx
+80102fa1:	b8 20 00 00 00       	mov    $0x20,%eax
+80102fa6:	0f 44 05 04 c0 10 80 	cmove  0x8010c004,%eax
+80102fad:	83 ec 04             	sub    $0x4,%esp
+80102fb0:	6a 00                	push   $0x0
+80102fb2:	bb 10 e4 18 80       	mov    $0x8018e410,%ebx
+    ideq.poll = idepoll;
+80102fb7:	31 f6                	xor    %esi,%esi
+    blkqinit(&ideq, "ide", &deadlinesched, idebm ? IDEDMAMAX : idemult / (BSIZE / SECTOR_SIZE), 1, idestart, 0);
+80102fb9:	68 d0 2a 10 80       	push   $0x80102ad0
+80102fbe:	6a 01                	push   $0x1
+80102fc0:	50                   	push   %eax
+80102fc1:	68 08 c0 10 80       	push   $0x8010c008
+80102fc6:	68 10 b0 10 80       	push   $0x8010b010
+80102fcb:	68 40 e4 18 80       	push   $0x8018e440
+80102fd0:	e8 0b f4 ff ff       	call   801023e0 <blkqinit>
+    ideq.poll = idepoll;
+80102fd5:	83 c4 20             	add    $0x20,%esp
+80102fd8:	c7 05 d4 e4 18 80 10 	movl   $0x80102e10,0x8018e4d4
+80102fdf:	2e 10 80 
+        blkregister(i, &idedisk[i]);
+80102fe2:	83 ec 08             	sub    $0x8,%esp
+        idedisk[i].name = "ide";
+80102fe5:	c7 03 10 b0 10 80    	movl   $0x8010b010,(%ebx)
+        idedisk[i].nq = 1;
+80102feb:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+        idedisk[i].qs = &ideq;
+80102ff2:	c7 43 08 40 e4 18 80 	movl   $0x8018e440,0x8(%ebx)
+        blkregister(i, &idedisk[i]);
+80102ff9:	53                   	push   %ebx
+    for (i = 0; i < (havedisk1 ? 2 : 1); i++) {
+80102ffa:	83 c3 0c             	add    $0xc,%ebx
+        blkregister(i, &idedisk[i]);
+80102ffd:	56                   	push   %esi
+80102ffe:	e8 4d f4 ff ff       	call   80102450 <blkregister>
+    for (i = 0; i < (havedisk1 ? 2 : 1); i++) {
+80103003:	a1 08 e4 18 80       	mov    0x8018e408,%eax
+80103008:	83 c4 10             	add    $0x10,%esp
+8010300b:	85 c0                	test   %eax,%eax
+8010300d:	74 31                	je     80103040 <ideinit+0x1c0>
+8010300f:	83 c6 01             	add    $0x1,%esi
+80103012:	83 fe 01             	cmp    $0x1,%esi
+80103015:	74 cb                	je     80102fe2 <ideinit+0x162>
+    cprintf("disk:1 %sexistence, %s, %s scheduler\n",
+80103017:	a1 84 e4 18 80       	mov    0x8018e484,%eax
+8010301c:	ba ef af 10 80       	mov    $0x8010afef,%edx
+80103021:	66 83 3d 00 e4 18 80 	cmpw   $0x0,0x8018e400
+80103028:	00 
+80103029:	8b 08                	mov    (%eax),%ecx
+8010302b:	b8 f3 af 10 80       	mov    $0x8010aff3,%eax
+80103030:	0f 44 c2             	cmove  %edx,%eax
+80103033:	ba 52 af 10 80       	mov    $0x8010af52,%edx
+80103038:	eb 27                	jmp    80103061 <ideinit+0x1e1>
+8010303a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103040:	a1 84 e4 18 80       	mov    0x8018e484,%eax
+80103045:	ba ef af 10 80       	mov    $0x8010afef,%edx
+8010304a:	66 83 3d 00 e4 18 80 	cmpw   $0x0,0x8018e400
+80103051:	00 
+80103052:	8b 08                	mov    (%eax),%ecx
+80103054:	b8 f3 af 10 80       	mov    $0x8010aff3,%eax
+80103059:	0f 44 c2             	cmove  %edx,%eax
+8010305c:	ba f7 af 10 80       	mov    $0x8010aff7,%edx
+80103061:	51                   	push   %ecx
+80103062:	50                   	push   %eax
+80103063:	52                   	push   %edx
+80103064:	68 14 b0 10 80       	push   $0x8010b014
+80103069:	e8 52 6d 00 00       	call   80109dc0 <cprintf>
+8010306e:	83 c4 10             	add    $0x10,%esp
+}
+80103071:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103074:	5b                   	pop    %ebx
+80103075:	5e                   	pop    %esi
+80103076:	5d                   	pop    %ebp
+80103077:	c3                   	ret
+80103078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010307f:	90                   	nop
+    if ((d = pcifindclass(PCI_IDE)) != 0 && (d->progif & 0x80) && (d->bar[4] & PCI_BAR_IO)) {
+80103080:	f6 40 24 01          	testb  $0x1,0x24(%eax)
+80103084:	0f 84 0d ff ff ff    	je     80102f97 <ideinit+0x117>
+        pcienable(d, 1);
+8010308a:	83 ec 08             	sub    $0x8,%esp
+8010308d:	6a 01                	push   $0x1
+8010308f:	50                   	push   %eax
+80103090:	89 45 f4             	mov    %eax,-0xc(%ebp)
+80103093:	e8 a8 d8 ff ff       	call   80100940 <pcienable>
+        idebm = PCI_BAR_IOADDR(d->bar[4]);
+80103098:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010309b:	8b 48 24             	mov    0x24(%eax),%ecx
+8010309e:	b8 06 00 00 00       	mov    $0x6,%eax
+801030a3:	83 e1 fc             	and    $0xfffffffc,%ecx
+801030a6:	66 89 0d 00 e4 18 80 	mov    %cx,0x8018e400
+        outb(idebm + BM_STATUS, BM_ERR | BM_INTR);
+801030ad:	8d 51 02             	lea    0x2(%ecx),%edx
+801030b0:	ee                   	out    %al,(%dx)
+}
+801030b1:	83 c4 10             	add    $0x10,%esp
+801030b4:	e9 e5 fe ff ff       	jmp    80102f9e <ideinit+0x11e>
+801030b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801030c0:	b8 02 00 00 00       	mov    $0x2,%eax
+801030c5:	ba f6 03 00 00       	mov    $0x3f6,%edx
+801030ca:	ee                   	out    %al,(%dx)
+801030cb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801030d0:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801030d5:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801030d6:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801030db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801030df:	90                   	nop
+801030e0:	89 ca                	mov    %ecx,%edx
+801030e2:	ec                   	in     (%dx),%al
+    while (((r = inb(0x1F7)) & (IDE_BUSY | IDE_DRDY)) != IDE_DRDY)
+801030e3:	83 e0 c0             	and    $0xffffffc0,%eax
+801030e6:	3c 40                	cmp    $0x40,%al
+801030e8:	75 f6                	jne    801030e0 <ideinit+0x260>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801030ea:	b8 10 00 00 00       	mov    $0x10,%eax
+801030ef:	ba f2 01 00 00       	mov    $0x1f2,%edx
+801030f4:	ee                   	out    %al,(%dx)
+801030f5:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+801030fa:	89 ca                	mov    %ecx,%edx
+801030fc:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801030fd:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80103102:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103108:	ec                   	in     (%dx),%al
+80103109:	89 c1                	mov    %eax,%ecx
+8010310b:	83 e1 c0             	and    $0xffffffc0,%ecx
+8010310e:	80 f9 40             	cmp    $0x40,%cl
+80103111:	75 f5                	jne    80103108 <ideinit+0x288>
+    if (havedisk1 && idesetmult(1) < idemult)
+80103113:	a8 21                	test   $0x21,%al
+80103115:	0f 84 53 fe ff ff    	je     80102f6e <ideinit+0xee>
+8010311b:	83 fb 01             	cmp    $0x1,%ebx
+8010311e:	0f 84 4a fe ff ff    	je     80102f6e <ideinit+0xee>
+        idemult = 1;
+80103124:	c7 05 04 c0 10 80 01 	movl   $0x1,0x8010c004
+8010312b:	00 00 00 
+8010312e:	e9 3b fe ff ff       	jmp    80102f6e <ideinit+0xee>
+80103133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103137:	90                   	nop
+        cprintf("ide: no controller\n");
+80103138:	83 ec 0c             	sub    $0xc,%esp
+8010313b:	68 fc af 10 80       	push   $0x8010affc
+80103140:	e8 7b 6c 00 00       	call   80109dc0 <cprintf>
+        return;
+80103145:	83 c4 10             	add    $0x10,%esp
+}
+80103148:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010314b:	5b                   	pop    %ebx
+8010314c:	5e                   	pop    %esi
+8010314d:	5d                   	pop    %ebp
+8010314e:	c3                   	ret
+    if (havedisk1 && idesetmult(1) < idemult)
+8010314f:	8b 0d 08 e4 18 80    	mov    0x8018e408,%ecx
+80103155:	e9 a3 fd ff ff       	jmp    80102efd <ideinit+0x7d>
+8010315a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103160 <ideintr>:
+{
+80103160:	55                   	push   %ebp
+80103161:	89 e5                	mov    %esp,%ebp
+80103163:	83 ec 14             	sub    $0x14,%esp
+    acquire(&ideq.lock);
+80103166:	68 40 e4 18 80       	push   $0x8018e440
+8010316b:	e8 40 e3 ff ff       	call   801014b0 <acquire>
+    idefinish();
+80103170:	e8 6b fb ff ff       	call   80102ce0 <idefinish>
+    release(&ideq.lock);
+80103175:	c7 04 24 40 e4 18 80 	movl   $0x8018e440,(%esp)
+8010317c:	e8 4f e1 ff ff       	call   801012d0 <release>
+}
+80103181:	83 c4 10             	add    $0x10,%esp
+80103184:	c9                   	leave
+80103185:	c3                   	ret
+80103186:	66 90                	xchg   %ax,%ax
+80103188:	66 90                	xchg   %ax,%ax
+8010318a:	66 90                	xchg   %ax,%ax
+8010318c:	66 90                	xchg   %ax,%ax
+8010318e:	66 90                	xchg   %ax,%ax
+
+80103190 <ahcistart>:
+// put the run starting at b in a free slot; blkstart() keeps
+// no more than depth in flight, so there is one.
+// called with pt->bq.lock held
+static void
+ahcistart(struct blkqueue *bq, struct buf *b)
+{
+80103190:	55                   	push   %ebp
+80103191:	89 e5                	mov    %esp,%ebp
+80103193:	57                   	push   %edi
+80103194:	56                   	push   %esi
+80103195:	53                   	push   %ebx
+80103196:	83 ec 1c             	sub    $0x1c,%esp
+    struct ahciport *pt = bq->priv;
+80103199:	8b 45 08             	mov    0x8(%ebp),%eax
+8010319c:	8b 98 98 00 00 00    	mov    0x98(%eax),%ebx
+    int s;
+
+    for (s = 0; s < pt->depth && (pt->busy & (1U << s)); s++)
+801031a2:	8b bb 10 01 00 00    	mov    0x110(%ebx),%edi
+801031a8:	85 ff                	test   %edi,%edi
+801031aa:	7e 44                	jle    801031f0 <ahcistart+0x60>
+801031ac:	8b 93 0c 01 00 00    	mov    0x10c(%ebx),%edx
+801031b2:	89 d0                	mov    %edx,%eax
+801031b4:	83 e0 01             	and    $0x1,%eax
+801031b7:	0f 84 ca 01 00 00    	je     80103387 <ahcistart+0x1f7>
+801031bd:	31 c9                	xor    %ecx,%ecx
+801031bf:	be 01 00 00 00       	mov    $0x1,%esi
+801031c4:	eb 12                	jmp    801031d8 <ahcistart+0x48>
+801031c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801031cd:	8d 76 00             	lea    0x0(%esi),%esi
+801031d0:	89 f0                	mov    %esi,%eax
+801031d2:	d3 e0                	shl    %cl,%eax
+801031d4:	85 d0                	test   %edx,%eax
+801031d6:	74 1c                	je     801031f4 <ahcistart+0x64>
+801031d8:	83 c1 01             	add    $0x1,%ecx
+801031db:	39 f9                	cmp    %edi,%ecx
+801031dd:	75 f1                	jne    801031d0 <ahcistart+0x40>
+        ;
+    if (s == pt->depth)
+        panic("ahcistart: no slot");
+801031df:	83 ec 0c             	sub    $0xc,%esp
+801031e2:	68 3a b0 10 80       	push   $0x8010b03a
+801031e7:	e8 54 6b 00 00       	call   80109d40 <panic>
+801031ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if (s == pt->depth)
+801031f0:	74 ed                	je     801031df <ahcistart+0x4f>
+    for (s = 0; s < pt->depth && (pt->busy & (1U << s)); s++)
+801031f2:	31 c9                	xor    %ecx,%ecx
+    ahcifill(pt, s, b, 0);
+    pt->slot[s] = b;
+    pt->busy |= 1U << s;
+801031f4:	b8 01 00 00 00       	mov    $0x1,%eax
+801031f9:	d3 e0                	shl    %cl,%eax
+801031fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    struct cmdheader *h = &pt->clb[s];
+801031fe:	89 c8                	mov    %ecx,%eax
+80103200:	c1 e0 05             	shl    $0x5,%eax
+    struct cmdtable *ct = pt->ctab[s];
+80103203:	8b 74 8b 0c          	mov    0xc(%ebx,%ecx,4),%esi
+    struct cmdheader *h = &pt->clb[s];
+80103207:	03 43 08             	add    0x8(%ebx),%eax
+    memset(fis, 0, 20);
+8010320a:	83 ec 04             	sub    $0x4,%esp
+    struct cmdtable *ct = pt->ctab[s];
+8010320d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    struct cmdheader *h = &pt->clb[s];
+80103210:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    memset(fis, 0, 20);
+80103213:	6a 14                	push   $0x14
+80103215:	6a 00                	push   $0x0
+80103217:	56                   	push   %esi
+80103218:	e8 23 ce ff ff       	call   80100040 <memset>
+    fis[0] = FIS_H2D;
+8010321d:	0f b7 05 f0 b0 10 80 	movzwl 0x8010b0f0,%eax
+    if (b == 0) {
+80103224:	83 c4 10             	add    $0x10,%esp
+80103227:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    fis[0] = FIS_H2D;
+8010322a:	66 89 06             	mov    %ax,(%esi)
+    if (b == 0) {
+8010322d:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103230:	85 c0                	test   %eax,%eax
+80103232:	0f 84 18 01 00 00    	je     80103350 <ahcistart+0x1c0>
+    write = (b->flags & B_DIRTY) != 0;
+80103238:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010323b:	8b 55 0c             	mov    0xc(%ebp),%edx
+    for (n = 0, x = b; x; n++, x = x->qnext) {
+8010323e:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+80103241:	31 ff                	xor    %edi,%edi
+    write = (b->flags & B_DIRTY) != 0;
+80103243:	8b 00                	mov    (%eax),%eax
+80103245:	83 e0 04             	and    $0x4,%eax
+80103248:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for (n = 0, x = b; x; n++, x = x->qnext) {
+8010324b:	8d 86 80 00 00 00    	lea    0x80(%esi),%eax
+80103251:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        ct->prdt[n].dba = V2P(x->data);
+80103258:	8b 9a cc 00 00 00    	mov    0xcc(%edx),%ebx
+        ct->prdt[n].dbau = 0;
+8010325e:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+    for (n = 0, x = b; x; n++, x = x->qnext) {
+80103265:	83 c7 01             	add    $0x1,%edi
+80103268:	83 c0 10             	add    $0x10,%eax
+        ct->prdt[n].dbc = BSIZE - 1;
+8010326b:	c7 40 fc ff 01 00 00 	movl   $0x1ff,-0x4(%eax)
+        ct->prdt[n].dba = V2P(x->data);
+80103272:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+80103278:	89 58 f0             	mov    %ebx,-0x10(%eax)
+    for (n = 0, x = b; x; n++, x = x->qnext) {
+8010327b:	8b 92 90 00 00 00    	mov    0x90(%edx),%edx
+80103281:	85 d2                	test   %edx,%edx
+80103283:	75 d3                	jne    80103258 <ahcistart+0xc8>
+80103285:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103288:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    lba = b->blockno * (BSIZE / SECTOR_SIZE);
+8010328b:	0f b7 40 08          	movzwl 0x8(%eax),%eax
+8010328f:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+80103293:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103296:	8b 50 08             	mov    0x8(%eax),%edx
+    if (pt->ncq) {
+80103299:	8b 83 14 01 00 00    	mov    0x114(%ebx),%eax
+8010329f:	85 c0                	test   %eax,%eax
+801032a1:	0f 85 81 00 00 00    	jne    80103328 <ahcistart+0x198>
+        fis[2] = write ? ATA_WRDMAEXT : ATA_RDDMAEXT;
+801032a7:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+        fis[12] = count & 0xFF;
+801032ab:	66 89 7e 0c          	mov    %di,0xc(%esi)
+        fis[2] = write ? ATA_WRDMAEXT : ATA_RDDMAEXT;
+801032af:	19 c0                	sbb    %eax,%eax
+801032b1:	83 e0 f0             	and    $0xfffffff0,%eax
+801032b4:	83 c0 35             	add    $0x35,%eax
+801032b7:	88 46 02             	mov    %al,0x2(%esi)
+    fis[4] = lba & 0xFF;
+801032ba:	0f b7 45 d8          	movzwl -0x28(%ebp),%eax
+    fis[7] = 0x40;      // lba mode
+801032be:	c6 46 07 40          	movb   $0x40,0x7(%esi)
+    fis[4] = lba & 0xFF;
+801032c2:	66 89 46 04          	mov    %ax,0x4(%esi)
+    fis[6] = (lba >> 16) & 0xFF;
+801032c6:	89 d0                	mov    %edx,%eax
+    fis[8] = lba >> 24;
+801032c8:	c1 ea 18             	shr    $0x18,%edx
+    fis[6] = (lba >> 16) & 0xFF;
+801032cb:	c1 e8 10             	shr    $0x10,%eax
+    h->flags = 5 | (write ? CH_WRITE : 0);
+801032ce:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+    fis[8] = lba >> 24;
+801032d2:	88 56 08             	mov    %dl,0x8(%esi)
+    fis[6] = (lba >> 16) & 0xFF;
+801032d5:	88 46 06             	mov    %al,0x6(%esi)
+    h->flags = 5 | (write ? CH_WRITE : 0);
+801032d8:	19 c0                	sbb    %eax,%eax
+801032da:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801032dd:	83 e0 c0             	and    $0xffffffc0,%eax
+801032e0:	83 c0 45             	add    $0x45,%eax
+    h->prdtl = n;
+801032e3:	66 89 7e 02          	mov    %di,0x2(%esi)
+    h->flags = 5 | (write ? CH_WRITE : 0);
+801032e7:	66 89 06             	mov    %ax,(%esi)
+    h->prdbc = 0;
+801032ea:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+    pt->slot[s] = b;
+801032f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+    pt->busy |= 1U << s;
+801032f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    pt->slot[s] = b;
+801032f7:	89 84 8b 8c 00 00 00 	mov    %eax,0x8c(%ebx,%ecx,4)
+    if (pt->ncq)
+801032fe:	8b 83 14 01 00 00    	mov    0x114(%ebx),%eax
+    pt->busy |= 1U << s;
+80103304:	09 bb 0c 01 00 00    	or     %edi,0x10c(%ebx)
+    if (pt->ncq)
+8010330a:	85 c0                	test   %eax,%eax
+8010330c:	74 06                	je     80103314 <ahcistart+0x184>
+    *(volatile uint*)(pt->regs + off) = v;
+8010330e:	8b 43 04             	mov    0x4(%ebx),%eax
+80103311:	89 78 34             	mov    %edi,0x34(%eax)
+80103314:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103317:	8b 43 04             	mov    0x4(%ebx),%eax
+8010331a:	89 78 38             	mov    %edi,0x38(%eax)
+        pwrite(pt, PX_SACT, 1U << s);
+    pwrite(pt, PX_CI, 1U << s);
+}
+8010331d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103320:	5b                   	pop    %ebx
+80103321:	5e                   	pop    %esi
+80103322:	5f                   	pop    %edi
+80103323:	5d                   	pop    %ebp
+80103324:	c3                   	ret
+80103325:	8d 76 00             	lea    0x0(%esi),%esi
+        fis[2] = write ? ATA_WRFPDMA : ATA_RDFPDMA;
+80103328:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+8010332c:	b8 60 00 00 00       	mov    $0x60,%eax
+80103331:	1c ff                	sbb    $0xff,%al
+80103333:	88 46 02             	mov    %al,0x2(%esi)
+        fis[3] = count & 0xFF;
+80103336:	89 f8                	mov    %edi,%eax
+80103338:	88 46 03             	mov    %al,0x3(%esi)
+        fis[11] = count >> 8;
+8010333b:	89 f8                	mov    %edi,%eax
+8010333d:	88 66 0b             	mov    %ah,0xb(%esi)
+        fis[12] = s << 3;
+80103340:	8d 04 cd 00 00 00 00 	lea    0x0(,%ecx,8),%eax
+80103347:	88 46 0c             	mov    %al,0xc(%esi)
+8010334a:	e9 6b ff ff ff       	jmp    801032ba <ahcistart+0x12a>
+8010334f:	90                   	nop
+        h->flags = 5;
+80103350:	8b 45 dc             	mov    -0x24(%ebp),%eax
+        fis[2] = ATA_IDENTIFY;
+80103353:	c6 46 02 ec          	movb   $0xec,0x2(%esi)
+        ct->prdt[0].dba = V2P(id);
+80103357:	c7 86 80 00 00 00 00 	movl   $0x80000000,0x80(%esi)
+8010335e:	00 00 80 
+        ct->prdt[0].dbau = 0;
+80103361:	c7 86 84 00 00 00 00 	movl   $0x0,0x84(%esi)
+80103368:	00 00 00 
+        ct->prdt[0].dbc = SECTOR_SIZE - 1;
+8010336b:	c7 86 8c 00 00 00 ff 	movl   $0x1ff,0x8c(%esi)
+80103372:	01 00 00 
+        h->flags = 5;
+80103375:	c7 00 05 00 01 00    	movl   $0x10005,(%eax)
+        h->prdbc = 0;
+8010337b:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+        return;
+80103382:	e9 6a ff ff ff       	jmp    801032f1 <ahcistart+0x161>
+    for (s = 0; s < pt->depth && (pt->busy & (1U << s)); s++)
+80103387:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+8010338e:	31 c9                	xor    %ecx,%ecx
+80103390:	e9 6e fe ff ff       	jmp    80103203 <ahcistart+0x73>
+80103395:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010339c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801033a0 <ahcifinish>:
+
+// finish the commands pt's disk is done with, and start more.
+// returns how many. caller holds pt->bq.lock
+static int
+ahcifinish(struct ahciport *pt)
+{
+801033a0:	55                   	push   %ebp
+801033a1:	89 e5                	mov    %esp,%ebp
+801033a3:	57                   	push   %edi
+801033a4:	56                   	push   %esi
+801033a5:	53                   	push   %ebx
+801033a6:	83 ec 1c             	sub    $0x1c,%esp
+    return *(volatile uint*)(pt->regs + off);
+801033a9:	8b 48 04             	mov    0x4(%eax),%ecx
+801033ac:	8b 51 10             	mov    0x10(%ecx),%edx
+    *(volatile uint*)(pt->regs + off) = v;
+801033af:	89 51 10             	mov    %edx,0x10(%ecx)
+    uint pis, done;
+    int s, n;
+
+    pis = pread(pt, PX_IS);
+    pwrite(pt, PX_IS, pis);
+    if (pis & PXIS_TFES)
+801033b2:	81 e2 00 00 00 40    	and    $0x40000000,%edx
+801033b8:	0f 85 8d 00 00 00    	jne    8010344b <ahcifinish+0xab>
+    return *(volatile uint*)(pt->regs + off);
+801033be:	8b 50 04             	mov    0x4(%eax),%edx
+801033c1:	89 c7                	mov    %eax,%edi
+        pt->busy &= ~(1U << s);
+        blkdone(&pt->bq, pt->slot[s]);
+        pt->slot[s] = 0;
+        n++;
+    }
+    blkstart(&pt->bq);
+801033c3:	8d 80 40 01 00 00    	lea    0x140(%eax),%eax
+    for (s = n = 0; s < pt->depth; s++) {
+801033c9:	31 f6                	xor    %esi,%esi
+    return *(volatile uint*)(pt->regs + off);
+801033cb:	8b 5a 34             	mov    0x34(%edx),%ebx
+801033ce:	8b 4a 38             	mov    0x38(%edx),%ecx
+    done = pt->busy & ~(pread(pt, PX_SACT) | pread(pt, PX_CI));
+801033d1:	09 d9                	or     %ebx,%ecx
+801033d3:	f7 d1                	not    %ecx
+801033d5:	23 48 cc             	and    -0x34(%eax),%ecx
+    blkstart(&pt->bq);
+801033d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for (s = n = 0; s < pt->depth; s++) {
+801033db:	8b 87 10 01 00 00    	mov    0x110(%edi),%eax
+801033e1:	85 c0                	test   %eax,%eax
+801033e3:	7e 51                	jle    80103436 <ahcifinish+0x96>
+        if (!(done & (1U << s)))
+801033e5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    for (s = n = 0; s < pt->depth; s++) {
+801033e8:	31 db                	xor    %ebx,%ebx
+801033ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if (!(done & (1U << s)))
+801033f0:	89 d9                	mov    %ebx,%ecx
+801033f2:	b8 01 00 00 00       	mov    $0x1,%eax
+801033f7:	d3 e0                	shl    %cl,%eax
+801033f9:	89 c1                	mov    %eax,%ecx
+801033fb:	85 45 e4             	test   %eax,-0x1c(%ebp)
+801033fe:	74 2b                	je     8010342b <ahcifinish+0x8b>
+        pt->busy &= ~(1U << s);
+80103400:	f7 d1                	not    %ecx
+80103402:	21 8f 0c 01 00 00    	and    %ecx,0x10c(%edi)
+        blkdone(&pt->bq, pt->slot[s]);
+80103408:	83 ec 08             	sub    $0x8,%esp
+        n++;
+8010340b:	83 c6 01             	add    $0x1,%esi
+        blkdone(&pt->bq, pt->slot[s]);
+8010340e:	ff b4 9f 8c 00 00 00 	push   0x8c(%edi,%ebx,4)
+80103415:	ff 75 e0             	push   -0x20(%ebp)
+80103418:	e8 33 f1 ff ff       	call   80102550 <blkdone>
+        n++;
+8010341d:	83 c4 10             	add    $0x10,%esp
+        pt->slot[s] = 0;
+80103420:	c7 84 9f 8c 00 00 00 	movl   $0x0,0x8c(%edi,%ebx,4)
+80103427:	00 00 00 00 
+    for (s = n = 0; s < pt->depth; s++) {
+8010342b:	83 c3 01             	add    $0x1,%ebx
+8010342e:	39 9f 10 01 00 00    	cmp    %ebx,0x110(%edi)
+80103434:	7f ba                	jg     801033f0 <ahcifinish+0x50>
+    blkstart(&pt->bq);
+80103436:	83 ec 0c             	sub    $0xc,%esp
+80103439:	ff 75 e0             	push   -0x20(%ebp)
+8010343c:	e8 7f f0 ff ff       	call   801024c0 <blkstart>
+    return n;
+}
+80103441:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103444:	89 f0                	mov    %esi,%eax
+80103446:	5b                   	pop    %ebx
+80103447:	5e                   	pop    %esi
+80103448:	5f                   	pop    %edi
+80103449:	5d                   	pop    %ebp
+8010344a:	c3                   	ret
+        panic("ahciintr: task file error");
+8010344b:	83 ec 0c             	sub    $0xc,%esp
+8010344e:	68 4d b0 10 80       	push   $0x8010b04d
+80103453:	e8 e8 68 00 00       	call   80109d40 <panic>
+80103458:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010345f:	90                   	nop
+
+80103460 <ahcipoll>:
+}
+
+// blkrw()'s poll of the port for a read, instead of the interrupt
+static int
+ahcipoll(struct blkqueue *bq)
+{
+80103460:	55                   	push   %ebp
+80103461:	89 e5                	mov    %esp,%ebp
+    return ahcifinish(bq->priv);
+80103463:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80103466:	5d                   	pop    %ebp
+    return ahcifinish(bq->priv);
+80103467:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+8010346d:	e9 2e ff ff ff       	jmp    801033a0 <ahcifinish>
+80103472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103480 <ahciintr>:
+{
+80103480:	55                   	push   %ebp
+80103481:	89 e5                	mov    %esp,%ebp
+80103483:	57                   	push   %edi
+80103484:	56                   	push   %esi
+80103485:	53                   	push   %ebx
+80103486:	83 ec 1c             	sub    $0x1c,%esp
+    return *(volatile uint*)(hba + off);
+80103489:	8b 15 40 ee 18 80    	mov    0x8018ee40,%edx
+    for (i = 0, pt = ports; i < nport; i++, pt++) {
+8010348f:	a1 00 e5 18 80       	mov    0x8018e500,%eax
+    return *(volatile uint*)(hba + off);
+80103494:	8b 7a 08             	mov    0x8(%edx),%edi
+    for (i = 0, pt = ports; i < nport; i++, pt++) {
+80103497:	85 c0                	test   %eax,%eax
+80103499:	7e 65                	jle    80103500 <ahciintr+0x80>
+8010349b:	31 f6                	xor    %esi,%esi
+8010349d:	bb 40 e5 18 80       	mov    $0x8018e540,%ebx
+801034a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if (!(is & (1U << pt->port)))
+801034a8:	8b 0b                	mov    (%ebx),%ecx
+801034aa:	b8 01 00 00 00       	mov    $0x1,%eax
+801034af:	d3 e0                	shl    %cl,%eax
+801034b1:	85 f8                	test   %edi,%eax
+801034b3:	74 27                	je     801034dc <ahciintr+0x5c>
+        acquire(&pt->bq.lock);
+801034b5:	83 ec 0c             	sub    $0xc,%esp
+801034b8:	8d 8b 40 01 00 00    	lea    0x140(%ebx),%ecx
+801034be:	51                   	push   %ecx
+801034bf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801034c2:	e8 e9 df ff ff       	call   801014b0 <acquire>
+        ahcifinish(pt);
+801034c7:	89 d8                	mov    %ebx,%eax
+801034c9:	e8 d2 fe ff ff       	call   801033a0 <ahcifinish>
+        release(&pt->bq.lock);
+801034ce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801034d1:	89 0c 24             	mov    %ecx,(%esp)
+801034d4:	e8 f7 dd ff ff       	call   801012d0 <release>
+801034d9:	83 c4 10             	add    $0x10,%esp
+    for (i = 0, pt = ports; i < nport; i++, pt++) {
+801034dc:	83 c6 01             	add    $0x1,%esi
+801034df:	81 c3 40 02 00 00    	add    $0x240,%ebx
+801034e5:	39 35 00 e5 18 80    	cmp    %esi,0x8018e500
+801034eb:	7f bb                	jg     801034a8 <ahciintr+0x28>
+    *(volatile uint*)(hba + off) = v;
+801034ed:	a1 40 ee 18 80       	mov    0x8018ee40,%eax
+801034f2:	89 78 08             	mov    %edi,0x8(%eax)
+}
+801034f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    *(volatile uint*)(hba + off) = v;
+801034f8:	83 c0 08             	add    $0x8,%eax
+}
+801034fb:	5b                   	pop    %ebx
+801034fc:	5e                   	pop    %esi
+801034fd:	5f                   	pop    %edi
+801034fe:	5d                   	pop    %ebp
+801034ff:	c3                   	ret
+    *(volatile uint*)(hba + off) = v;
+80103500:	89 7a 08             	mov    %edi,0x8(%edx)
+}
+80103503:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103506:	8d 42 08             	lea    0x8(%edx),%eax
+80103509:	5b                   	pop    %ebx
+8010350a:	5e                   	pop    %esi
+8010350b:	5f                   	pop    %edi
+8010350c:	5d                   	pop    %ebp
+8010350d:	c3                   	ret
+8010350e:	66 90                	xchg   %ax,%ax
+
+80103510 <ahciportfree>:
+{
+80103510:	55                   	push   %ebp
+80103511:	89 e5                	mov    %esp,%ebp
+80103513:	53                   	push   %ebx
+80103514:	89 c3                	mov    %eax,%ebx
+80103516:	83 ec 04             	sub    $0x4,%esp
+    *(volatile uint*)(pt->regs + off) = v;
+80103519:	8b 40 04             	mov    0x4(%eax),%eax
+8010351c:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+    return *(volatile uint*)(pt->regs + off);
+80103523:	8b 53 04             	mov    0x4(%ebx),%edx
+80103526:	8b 42 18             	mov    0x18(%edx),%eax
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) & ~(PXCMD_ST | PXCMD_FRE));
+80103529:	83 e0 ee             	and    $0xffffffee,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+8010352c:	89 42 18             	mov    %eax,0x18(%edx)
+    return *(volatile uint*)(pt->regs + off);
+8010352f:	8b 43 04             	mov    0x4(%ebx),%eax
+80103532:	8b 50 18             	mov    0x18(%eax),%edx
+80103535:	8d 48 18             	lea    0x18(%eax),%ecx
+80103538:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    for (spin = 0; pread(pt, PX_CMD) & (PXCMD_CR | PXCMD_FR); spin++)
+8010353d:	80 e6 c0             	and    $0xc0,%dh
+80103540:	75 0b                	jne    8010354d <ahciportfree+0x3d>
+80103542:	eb 10                	jmp    80103554 <ahciportfree+0x44>
+80103544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if (spin == 1000000)
+80103548:	83 e8 01             	sub    $0x1,%eax
+8010354b:	74 50                	je     8010359d <ahciportfree+0x8d>
+    return *(volatile uint*)(pt->regs + off);
+8010354d:	8b 11                	mov    (%ecx),%edx
+    for (spin = 0; pread(pt, PX_CMD) & (PXCMD_CR | PXCMD_FR); spin++)
+8010354f:	80 e6 c0             	and    $0xc0,%dh
+80103552:	75 f4                	jne    80103548 <ahciportfree+0x38>
+        if (pt->ctab[i])
+80103554:	8b 43 0c             	mov    0xc(%ebx),%eax
+80103557:	85 c0                	test   %eax,%eax
+80103559:	74 0c                	je     80103567 <ahciportfree+0x57>
+            kfree((char*)pt->ctab[i]);
+8010355b:	83 ec 0c             	sub    $0xc,%esp
+8010355e:	50                   	push   %eax
+8010355f:	e8 ec 49 00 00       	call   80107f50 <kfree>
+80103564:	83 c4 10             	add    $0x10,%esp
+        if (pt->ctab[i])
+80103567:	8b 43 4c             	mov    0x4c(%ebx),%eax
+        pt->ctab[i] = 0;
+8010356a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+        if (pt->ctab[i])
+80103571:	85 c0                	test   %eax,%eax
+80103573:	74 0c                	je     80103581 <ahciportfree+0x71>
+            kfree((char*)pt->ctab[i]);
+80103575:	83 ec 0c             	sub    $0xc,%esp
+80103578:	50                   	push   %eax
+80103579:	e8 d2 49 00 00       	call   80107f50 <kfree>
+8010357e:	83 c4 10             	add    $0x10,%esp
+    kfree((char*)pt->clb);
+80103581:	83 ec 0c             	sub    $0xc,%esp
+        pt->ctab[i] = 0;
+80103584:	c7 43 4c 00 00 00 00 	movl   $0x0,0x4c(%ebx)
+    kfree((char*)pt->clb);
+8010358b:	ff 73 08             	push   0x8(%ebx)
+8010358e:	e8 bd 49 00 00       	call   80107f50 <kfree>
+    pt->clb = 0;
+80103593:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+8010359a:	83 c4 10             	add    $0x10,%esp
+}
+8010359d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801035a0:	c9                   	leave
+801035a1:	c3                   	ret
+801035a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801035b0 <ahciinit>:
+{
+801035b0:	55                   	push   %ebp
+801035b1:	89 e5                	mov    %esp,%ebp
+801035b3:	57                   	push   %edi
+801035b4:	56                   	push   %esi
+801035b5:	53                   	push   %ebx
+801035b6:	83 ec 38             	sub    $0x38,%esp
+    if ((d = pcifindclass(PCI_SATA)) == 0 || d->progif != 0x01)
+801035b9:	68 01 06 00 00       	push   $0x601
+801035be:	e8 ad d5 ff ff       	call   80100b70 <pcifindclass>
+801035c3:	83 c4 10             	add    $0x10,%esp
+801035c6:	85 c0                	test   %eax,%eax
+801035c8:	74 2d                	je     801035f7 <ahciinit+0x47>
+801035ca:	80 78 12 01          	cmpb   $0x1,0x12(%eax)
+801035ce:	89 c6                	mov    %eax,%esi
+801035d0:	75 25                	jne    801035f7 <ahciinit+0x47>
+    if (d->bar[5] & PCI_BAR_IO || PCI_BAR_MEMADDR(d->bar[5]) < DEVSPACE) {
+801035d2:	8b 40 28             	mov    0x28(%eax),%eax
+801035d5:	a8 01                	test   $0x1,%al
+801035d7:	75 0d                	jne    801035e6 <ahciinit+0x36>
+801035d9:	89 c2                	mov    %eax,%edx
+801035db:	83 e2 f0             	and    $0xfffffff0,%edx
+801035de:	81 fa ff ff ff fd    	cmp    $0xfdffffff,%edx
+801035e4:	77 1a                	ja     80103600 <ahciinit+0x50>
+        cprintf("ahci: registers at %x, not mapped\n", d->bar[5]);
+801035e6:	83 ec 08             	sub    $0x8,%esp
+801035e9:	50                   	push   %eax
+801035ea:	68 80 b0 10 80       	push   $0x8010b080
+801035ef:	e8 cc 67 00 00       	call   80109dc0 <cprintf>
+        return;
+801035f4:	83 c4 10             	add    $0x10,%esp
+}
+801035f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801035fa:	5b                   	pop    %ebx
+801035fb:	5e                   	pop    %esi
+801035fc:	5f                   	pop    %edi
+801035fd:	5d                   	pop    %ebp
+801035fe:	c3                   	ret
+801035ff:	90                   	nop
+    pcienable(d, 1);
+80103600:	83 ec 08             	sub    $0x8,%esp
+80103603:	6a 01                	push   $0x1
+80103605:	56                   	push   %esi
+80103606:	e8 35 d3 ff ff       	call   80100940 <pcienable>
+    hba = PCI_BAR_MEMADDR(d->bar[5]);
+8010360b:	8b 5e 28             	mov    0x28(%esi),%ebx
+    for (i = 0; i < 32 && nport < NAHCIDEV; i++) {
+8010360e:	31 c9                	xor    %ecx,%ecx
+80103610:	89 75 cc             	mov    %esi,-0x34(%ebp)
+    return *(volatile uint*)(hba + off);
+80103613:	83 c4 10             	add    $0x10,%esp
+80103616:	89 ce                	mov    %ecx,%esi
+    hba = PCI_BAR_MEMADDR(d->bar[5]);
+80103618:	83 e3 f0             	and    $0xfffffff0,%ebx
+    return *(volatile uint*)(hba + off);
+8010361b:	8b 43 04             	mov    0x4(%ebx),%eax
+    hba = PCI_BAR_MEMADDR(d->bar[5]);
+8010361e:	89 1d 40 ee 18 80    	mov    %ebx,0x8018ee40
+    hbawrite(HBA_GHC, hbaread(HBA_GHC) | GHC_AE);
+80103624:	0d 00 00 00 80       	or     $0x80000000,%eax
+    *(volatile uint*)(hba + off) = v;
+80103629:	89 43 04             	mov    %eax,0x4(%ebx)
+    return *(volatile uint*)(hba + off);
+8010362c:	8b 43 0c             	mov    0xc(%ebx),%eax
+8010362f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for (i = 0; i < 32 && nport < NAHCIDEV; i++) {
+80103632:	eb 10                	jmp    80103644 <ahciinit+0x94>
+80103634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103638:	83 c6 01             	add    $0x1,%esi
+8010363b:	83 fe 20             	cmp    $0x20,%esi
+8010363e:	0f 84 a4 01 00 00    	je     801037e8 <ahciinit+0x238>
+80103644:	a1 00 e5 18 80       	mov    0x8018e500,%eax
+80103649:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010364c:	83 f8 03             	cmp    $0x3,%eax
+8010364f:	0f 8f 93 01 00 00    	jg     801037e8 <ahciinit+0x238>
+        if (!(pi & (1U << i)))
+80103655:	b8 01 00 00 00       	mov    $0x1,%eax
+8010365a:	89 f1                	mov    %esi,%ecx
+8010365c:	d3 e0                	shl    %cl,%eax
+8010365e:	85 45 dc             	test   %eax,-0x24(%ebp)
+80103661:	74 d5                	je     80103638 <ahciinit+0x88>
+        pt->port = i;
+80103663:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103666:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+8010366d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80103670:	01 f8                	add    %edi,%eax
+80103672:	c1 e0 06             	shl    $0x6,%eax
+80103675:	89 b0 40 e5 18 80    	mov    %esi,-0x7fe71ac0(%eax)
+8010367b:	8d 88 40 e5 18 80    	lea    -0x7fe71ac0(%eax),%ecx
+        pt->regs = hba + 0x100 + 0x80 * i;
+80103681:	89 f0                	mov    %esi,%eax
+80103683:	c1 e0 07             	shl    $0x7,%eax
+80103686:	01 d8                	add    %ebx,%eax
+80103688:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+8010368e:	89 51 04             	mov    %edx,0x4(%ecx)
+    return *(volatile uint*)(pt->regs + off);
+80103691:	8b 90 28 01 00 00    	mov    0x128(%eax),%edx
+    if ((pread(pt, PX_SSTS) & SSTS_DET) != SSTS_UP || pread(pt, PX_SIG) != SIG_ATA)
+80103697:	83 e2 0f             	and    $0xf,%edx
+8010369a:	83 fa 03             	cmp    $0x3,%edx
+8010369d:	75 99                	jne    80103638 <ahciinit+0x88>
+    return *(volatile uint*)(pt->regs + off);
+8010369f:	8b 90 24 01 00 00    	mov    0x124(%eax),%edx
+    if ((pread(pt, PX_SSTS) & SSTS_DET) != SSTS_UP || pread(pt, PX_SIG) != SIG_ATA)
+801036a5:	81 fa 01 01 00 00    	cmp    $0x101,%edx
+801036ab:	75 8b                	jne    80103638 <ahciinit+0x88>
+    *(volatile uint*)(pt->regs + off) = v;
+801036ad:	c7 80 14 01 00 00 00 	movl   $0x0,0x114(%eax)
+801036b4:	00 00 00 
+    return *(volatile uint*)(pt->regs + off);
+801036b7:	8b 51 04             	mov    0x4(%ecx),%edx
+801036ba:	8b 42 18             	mov    0x18(%edx),%eax
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) & ~(PXCMD_ST | PXCMD_FRE));
+801036bd:	83 e0 ee             	and    $0xffffffee,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+801036c0:	89 42 18             	mov    %eax,0x18(%edx)
+    return *(volatile uint*)(pt->regs + off);
+801036c3:	8b 41 04             	mov    0x4(%ecx),%eax
+801036c6:	8b 50 18             	mov    0x18(%eax),%edx
+801036c9:	8d 48 18             	lea    0x18(%eax),%ecx
+    for (spin = 0; pread(pt, PX_CMD) & (PXCMD_CR | PXCMD_FR); spin++)
+801036cc:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+801036d1:	80 e6 c0             	and    $0xc0,%dh
+801036d4:	75 13                	jne    801036e9 <ahciinit+0x139>
+801036d6:	eb 18                	jmp    801036f0 <ahciinit+0x140>
+801036d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801036df:	90                   	nop
+        if (spin == 1000000)
+801036e0:	83 e8 01             	sub    $0x1,%eax
+801036e3:	0f 84 4f ff ff ff    	je     80103638 <ahciinit+0x88>
+    return *(volatile uint*)(pt->regs + off);
+801036e9:	8b 11                	mov    (%ecx),%edx
+    for (spin = 0; pread(pt, PX_CMD) & (PXCMD_CR | PXCMD_FR); spin++)
+801036eb:	80 e6 c0             	and    $0xc0,%dh
+801036ee:	75 f0                	jne    801036e0 <ahciinit+0x130>
+    if ((p = kalloc()) == 0)
+801036f0:	e8 4b 4a 00 00       	call   80108140 <kalloc>
+801036f5:	89 c7                	mov    %eax,%edi
+801036f7:	85 c0                	test   %eax,%eax
+801036f9:	0f 84 d3 03 00 00    	je     80103ad2 <ahciinit+0x522>
+    memset(p, 0, PGSIZE);
+801036ff:	83 ec 04             	sub    $0x4,%esp
+    for (i = 0; i < NSLOT; i++) {
+80103702:	31 db                	xor    %ebx,%ebx
+    memset(p, 0, PGSIZE);
+80103704:	68 00 10 00 00       	push   $0x1000
+80103709:	6a 00                	push   $0x0
+8010370b:	50                   	push   %eax
+8010370c:	e8 2f c9 ff ff       	call   80100040 <memset>
+    pt->clb = (struct cmdheader*)p;
+80103711:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80103714:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    for (i = 0; i < NSLOT; i++) {
+80103717:	89 75 c8             	mov    %esi,-0x38(%ebp)
+8010371a:	89 7d e0             	mov    %edi,-0x20(%ebp)
+8010371d:	83 c4 10             	add    $0x10,%esp
+    pt->clb = (struct cmdheader*)p;
+80103720:	01 c8                	add    %ecx,%eax
+    pwrite(pt, PX_CLB, V2P(p));
+80103722:	8d 8f 00 00 00 80    	lea    -0x80000000(%edi),%ecx
+    pt->clb = (struct cmdheader*)p;
+80103728:	c1 e0 06             	shl    $0x6,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+8010372b:	8b 90 44 e5 18 80    	mov    -0x7fe71abc(%eax),%edx
+    pt->clb = (struct cmdheader*)p;
+80103731:	89 b8 48 e5 18 80    	mov    %edi,-0x7fe71ab8(%eax)
+80103737:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    for (i = 0; i < NSLOT; i++) {
+8010373a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    *(volatile uint*)(pt->regs + off) = v;
+8010373d:	89 0a                	mov    %ecx,(%edx)
+8010373f:	8b 90 44 e5 18 80    	mov    -0x7fe71abc(%eax),%edx
+    pwrite(pt, PX_FB, V2P(p + 1024));
+80103745:	8d 8f 00 04 00 80    	lea    -0x7ffffc00(%edi),%ecx
+    *(volatile uint*)(pt->regs + off) = v;
+8010374b:	c7 42 04 00 00 00 00 	movl   $0x0,0x4(%edx)
+80103752:	8b 90 44 e5 18 80    	mov    -0x7fe71abc(%eax),%edx
+    pt->clb = (struct cmdheader*)p;
+80103758:	05 40 e5 18 80       	add    $0x8018e540,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+8010375d:	89 4a 08             	mov    %ecx,0x8(%edx)
+80103760:	8b 40 04             	mov    0x4(%eax),%eax
+80103763:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+    for (i = 0; i < NSLOT; i++) {
+8010376a:	eb 43                	jmp    801037af <ahciinit+0x1ff>
+8010376c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        pt->ctab[i] = (struct cmdtable*)p + i % CTPP;
+80103770:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103773:	c1 e2 08             	shl    $0x8,%edx
+80103776:	89 d9                	mov    %ebx,%ecx
+80103778:	c1 e1 05             	shl    $0x5,%ecx
+8010377b:	01 d0                	add    %edx,%eax
+        pt->clb[i].ctba = V2P(pt->ctab[i]);
+8010377d:	8d 96 40 e5 18 80    	lea    -0x7fe71ac0(%esi),%edx
+        pt->ctab[i] = (struct cmdtable*)p + i % CTPP;
+80103783:	89 84 9e 4c e5 18 80 	mov    %eax,-0x7fe71ab4(%esi,%ebx,4)
+        pt->clb[i].ctba = V2P(pt->ctab[i]);
+8010378a:	8b be 48 e5 18 80    	mov    -0x7fe71ab8(%esi),%edi
+80103790:	05 00 00 00 80       	add    $0x80000000,%eax
+    for (i = 0; i < NSLOT; i++) {
+80103795:	83 c3 01             	add    $0x1,%ebx
+        pt->clb[i].ctba = V2P(pt->ctab[i]);
+80103798:	89 44 0f 08          	mov    %eax,0x8(%edi,%ecx,1)
+        pt->clb[i].ctbau = 0;
+8010379c:	8b 86 48 e5 18 80    	mov    -0x7fe71ab8(%esi),%eax
+801037a2:	c7 44 08 0c 00 00 00 	movl   $0x0,0xc(%eax,%ecx,1)
+801037a9:	00 
+    for (i = 0; i < NSLOT; i++) {
+801037aa:	83 fb 20             	cmp    $0x20,%ebx
+801037ad:	74 71                	je     80103820 <ahciinit+0x270>
+        if (i % CTPP == 0) {
+801037af:	89 da                	mov    %ebx,%edx
+801037b1:	83 e2 0f             	and    $0xf,%edx
+801037b4:	75 ba                	jne    80103770 <ahciinit+0x1c0>
+801037b6:	89 55 d8             	mov    %edx,-0x28(%ebp)
+            if ((p = kalloc()) == 0)
+801037b9:	e8 82 49 00 00       	call   80108140 <kalloc>
+801037be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801037c1:	85 c0                	test   %eax,%eax
+801037c3:	0f 84 09 03 00 00    	je     80103ad2 <ahciinit+0x522>
+            memset(p, 0, PGSIZE);
+801037c9:	83 ec 04             	sub    $0x4,%esp
+801037cc:	68 00 10 00 00       	push   $0x1000
+801037d1:	6a 00                	push   $0x0
+801037d3:	50                   	push   %eax
+801037d4:	e8 67 c8 ff ff       	call   80100040 <memset>
+801037d9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+801037dc:	83 c4 10             	add    $0x10,%esp
+801037df:	eb 8f                	jmp    80103770 <ahciinit+0x1c0>
+801037e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    *(volatile uint*)(hba + off) = v;
+801037e8:	8b 75 cc             	mov    -0x34(%ebp),%esi
+    pcisetintr(d, ahciintr);
+801037eb:	83 ec 08             	sub    $0x8,%esp
+    *(volatile uint*)(hba + off) = v;
+801037ee:	c7 43 08 ff ff ff ff 	movl   $0xffffffff,0x8(%ebx)
+    pcisetintr(d, ahciintr);
+801037f5:	68 80 34 10 80       	push   $0x80103480
+801037fa:	56                   	push   %esi
+801037fb:	e8 20 d4 ff ff       	call   80100c20 <pcisetintr>
+    return *(volatile uint*)(hba + off);
+80103800:	8b 15 40 ee 18 80    	mov    0x8018ee40,%edx
+}
+80103806:	83 c4 10             	add    $0x10,%esp
+    return *(volatile uint*)(hba + off);
+80103809:	8b 42 04             	mov    0x4(%edx),%eax
+    hbawrite(HBA_GHC, hbaread(HBA_GHC) | GHC_IE);
+8010380c:	83 c8 02             	or     $0x2,%eax
+    *(volatile uint*)(hba + off) = v;
+8010380f:	89 42 04             	mov    %eax,0x4(%edx)
+}
+80103812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103815:	5b                   	pop    %ebx
+80103816:	5e                   	pop    %esi
+80103817:	5f                   	pop    %edi
+80103818:	5d                   	pop    %ebp
+80103819:	c3                   	ret
+8010381a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        pt = &ports[nport];
+80103820:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80103823:	8b 75 c8             	mov    -0x38(%ebp),%esi
+80103826:	05 40 e5 18 80       	add    $0x8018e540,%eax
+8010382b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *(volatile uint*)(pt->regs + off) = v;
+8010382e:	8b 42 04             	mov    0x4(%edx),%eax
+80103831:	c7 40 30 ff ff ff ff 	movl   $0xffffffff,0x30(%eax)
+80103838:	8b 42 04             	mov    0x4(%edx),%eax
+8010383b:	c7 40 10 ff ff ff ff 	movl   $0xffffffff,0x10(%eax)
+    return *(volatile uint*)(pt->regs + off);
+80103842:	8b 4a 04             	mov    0x4(%edx),%ecx
+80103845:	8b 41 18             	mov    0x18(%ecx),%eax
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) | PXCMD_FRE);
+80103848:	83 c8 10             	or     $0x10,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+8010384b:	89 41 18             	mov    %eax,0x18(%ecx)
+    return *(volatile uint*)(pt->regs + off);
+8010384e:	8b 5a 04             	mov    0x4(%edx),%ebx
+    for (spin = 0; pread(pt, PX_TFD) & (TFD_BSY | TFD_DRQ); spin++) {
+80103851:	b8 40 42 0f 00       	mov    $0xf4240,%eax
+    return *(volatile uint*)(pt->regs + off);
+80103856:	8b 53 20             	mov    0x20(%ebx),%edx
+80103859:	8d 4b 20             	lea    0x20(%ebx),%ecx
+    for (spin = 0; pread(pt, PX_TFD) & (TFD_BSY | TFD_DRQ); spin++) {
+8010385c:	81 e2 88 00 00 00    	and    $0x88,%edx
+80103862:	75 15                	jne    80103879 <ahciinit+0x2c9>
+80103864:	eb 1d                	jmp    80103883 <ahciinit+0x2d3>
+80103866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010386d:	8d 76 00             	lea    0x0(%esi),%esi
+        if (spin == 1000000) {
+80103870:	83 e8 01             	sub    $0x1,%eax
+80103873:	0f 84 46 02 00 00    	je     80103abf <ahciinit+0x50f>
+    return *(volatile uint*)(pt->regs + off);
+80103879:	8b 11                	mov    (%ecx),%edx
+    for (spin = 0; pread(pt, PX_TFD) & (TFD_BSY | TFD_DRQ); spin++) {
+8010387b:	81 e2 88 00 00 00    	and    $0x88,%edx
+80103881:	75 ed                	jne    80103870 <ahciinit+0x2c0>
+    return *(volatile uint*)(pt->regs + off);
+80103883:	8b 43 18             	mov    0x18(%ebx),%eax
+    pwrite(pt, PX_CMD, pread(pt, PX_CMD) | PXCMD_ST);
+80103886:	83 c8 01             	or     $0x1,%eax
+    *(volatile uint*)(pt->regs + off) = v;
+80103889:	89 43 18             	mov    %eax,0x18(%ebx)
+    if ((id = kalloc()) == 0)
+8010388c:	e8 af 48 00 00       	call   80108140 <kalloc>
+80103891:	85 c0                	test   %eax,%eax
+80103893:	89 45 c8             	mov    %eax,-0x38(%ebp)
+80103896:	0f 84 36 02 00 00    	je     80103ad2 <ahciinit+0x522>
+    struct cmdtable *ct = pt->ctab[s];
+8010389c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010389f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    memset(fis, 0, 20);
+801038a2:	83 ec 04             	sub    $0x4,%esp
+    struct cmdtable *ct = pt->ctab[s];
+801038a5:	8d 1c 38             	lea    (%eax,%edi,1),%ebx
+801038a8:	c1 e3 06             	shl    $0x6,%ebx
+801038ab:	8b 8b 4c e5 18 80    	mov    -0x7fe71ab4(%ebx),%ecx
+    struct cmdheader *h = &pt->clb[s];
+801038b1:	8b bb 48 e5 18 80    	mov    -0x7fe71ab8(%ebx),%edi
+    memset(fis, 0, 20);
+801038b7:	6a 14                	push   $0x14
+801038b9:	6a 00                	push   $0x0
+801038bb:	51                   	push   %ecx
+801038bc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+801038bf:	e8 7c c7 ff ff       	call   80100040 <memset>
+    fis[0] = FIS_H2D;
+801038c4:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+        ct->prdt[0].dba = V2P(id);
+801038c7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    for (spin = 0; pread(pt, PX_CI) & 1; spin++) {
+801038ca:	83 c4 10             	add    $0x10,%esp
+    fis[0] = FIS_H2D;
+801038cd:	0f b7 05 f0 b0 10 80 	movzwl 0x8010b0f0,%eax
+        fis[2] = ATA_IDENTIFY;
+801038d4:	c6 41 02 ec          	movb   $0xec,0x2(%ecx)
+    fis[0] = FIS_H2D;
+801038d8:	66 89 01             	mov    %ax,(%ecx)
+        ct->prdt[0].dba = V2P(id);
+801038db:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+801038e1:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+        ct->prdt[0].dbau = 0;
+801038e7:	c7 81 84 00 00 00 00 	movl   $0x0,0x84(%ecx)
+801038ee:	00 00 00 
+        ct->prdt[0].dbc = SECTOR_SIZE - 1;
+801038f1:	c7 81 8c 00 00 00 ff 	movl   $0x1ff,0x8c(%ecx)
+801038f8:	01 00 00 
+        h->flags = 5;
+801038fb:	c7 07 05 00 01 00    	movl   $0x10005,(%edi)
+        h->prdbc = 0;
+80103901:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+    *(volatile uint*)(pt->regs + off) = v;
+80103908:	8b 83 44 e5 18 80    	mov    -0x7fe71abc(%ebx),%eax
+8010390e:	c7 40 38 01 00 00 00 	movl   $0x1,0x38(%eax)
+    return *(volatile uint*)(pt->regs + off);
+80103915:	8b 83 44 e5 18 80    	mov    -0x7fe71abc(%ebx),%eax
+8010391b:	8b 58 38             	mov    0x38(%eax),%ebx
+8010391e:	8d 48 38             	lea    0x38(%eax),%ecx
+    for (spin = 0; pread(pt, PX_CI) & 1; spin++) {
+80103921:	83 e3 01             	and    $0x1,%ebx
+80103924:	74 3d                	je     80103963 <ahciinit+0x3b3>
+    return *(volatile uint*)(pt->regs + off);
+80103926:	8d 58 10             	lea    0x10(%eax),%ebx
+80103929:	8b 40 10             	mov    0x10(%eax),%eax
+        if ((pread(pt, PX_IS) & PXIS_TFES) || spin == 10000000) {
+8010392c:	a9 00 00 00 40       	test   $0x40000000,%eax
+80103931:	0f 85 69 01 00 00    	jne    80103aa0 <ahciinit+0x4f0>
+    for (spin = 0; pread(pt, PX_CI) & 1; spin++) {
+80103937:	31 c0                	xor    %eax,%eax
+80103939:	eb 1e                	jmp    80103959 <ahciinit+0x3a9>
+8010393b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010393f:	90                   	nop
+    return *(volatile uint*)(pt->regs + off);
+80103940:	8b 3b                	mov    (%ebx),%edi
+        if ((pread(pt, PX_IS) & PXIS_TFES) || spin == 10000000) {
+80103942:	81 e7 00 00 00 40    	and    $0x40000000,%edi
+80103948:	0f 85 52 01 00 00    	jne    80103aa0 <ahciinit+0x4f0>
+8010394e:	3d 80 96 98 00       	cmp    $0x989680,%eax
+80103953:	0f 84 47 01 00 00    	je     80103aa0 <ahciinit+0x4f0>
+    return *(volatile uint*)(pt->regs + off);
+80103959:	8b 39                	mov    (%ecx),%edi
+    for (spin = 0; pread(pt, PX_CI) & 1; spin++) {
+8010395b:	83 c0 01             	add    $0x1,%eax
+8010395e:	83 e7 01             	and    $0x1,%edi
+80103961:	75 dd                	jne    80103940 <ahciinit+0x390>
+    pt->ncq = (w[76] & 0x100) != 0;     // sata capabilities: ncq
+80103963:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80103966:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103969:	31 c9                	xor    %ecx,%ecx
+8010396b:	01 f8                	add    %edi,%eax
+8010396d:	c1 e0 06             	shl    $0x6,%eax
+80103970:	f6 82 99 00 00 00 01 	testb  $0x1,0x99(%edx)
+80103977:	89 c3                	mov    %eax,%ebx
+80103979:	0f 95 c1             	setne  %cl
+    pt->depth = pt->ncq ? (w[75] & 0x1F) + 1 : 1;
+8010397c:	b8 01 00 00 00       	mov    $0x1,%eax
+    pt->ncq = (w[76] & 0x100) != 0;     // sata capabilities: ncq
+80103981:	89 8b 54 e6 18 80    	mov    %ecx,-0x7fe719ac(%ebx)
+    pt->depth = pt->ncq ? (w[75] & 0x1F) + 1 : 1;
+80103987:	74 0d                	je     80103996 <ahciinit+0x3e6>
+80103989:	0f b7 82 96 00 00 00 	movzwl 0x96(%edx),%eax
+80103990:	83 e0 1f             	and    $0x1f,%eax
+80103993:	83 c0 01             	add    $0x1,%eax
+80103996:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103999:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+    kfree(id);
+8010399c:	83 ec 0c             	sub    $0xc,%esp
+    pt->depth = pt->ncq ? (w[75] & 0x1F) + 1 : 1;
+8010399f:	01 fb                	add    %edi,%ebx
+801039a1:	c1 e3 06             	shl    $0x6,%ebx
+801039a4:	81 c3 40 e5 18 80    	add    $0x8018e540,%ebx
+801039aa:	89 83 10 01 00 00    	mov    %eax,0x110(%ebx)
+    kfree(id);
+801039b0:	52                   	push   %edx
+801039b1:	e8 9a 45 00 00       	call   80107f50 <kfree>
+    *(volatile uint*)(pt->regs + off) = v;
+801039b6:	8b 43 04             	mov    0x4(%ebx),%eax
+    blkqinit(&pt->bq, "ahci", &deadlinesched, AHCIRUN, pt->depth, ahcistart, pt);
+801039b9:	83 c4 0c             	add    $0xc,%esp
+    *(volatile uint*)(pt->regs + off) = v;
+801039bc:	c7 40 10 ff ff ff ff 	movl   $0xffffffff,0x10(%eax)
+801039c3:	8b 43 04             	mov    0x4(%ebx),%eax
+801039c6:	c7 40 14 0b 00 00 40 	movl   $0x4000000b,0x14(%eax)
+    blkqinit(&pt->bq, "ahci", &deadlinesched, AHCIRUN, pt->depth, ahcistart, pt);
+801039cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801039d0:	ff 75 e0             	push   -0x20(%ebp)
+801039d3:	8d b8 80 e6 18 80    	lea    -0x7fe71980(%eax),%edi
+801039d9:	68 90 31 10 80       	push   $0x80103190
+801039de:	ff b3 10 01 00 00    	push   0x110(%ebx)
+801039e4:	6a 08                	push   $0x8
+801039e6:	68 08 c0 10 80       	push   $0x8010c008
+801039eb:	68 7b b0 10 80       	push   $0x8010b07b
+801039f0:	57                   	push   %edi
+801039f1:	e8 ea e9 ff ff       	call   801023e0 <blkqinit>
+        if ((dev = blkalloc(&pt->bd)) < 0) {
+801039f6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+801039f9:	83 c4 14             	add    $0x14,%esp
+    pt->bq.poll = ahcipoll;
+801039fc:	c7 83 d4 01 00 00 60 	movl   $0x80103460,0x1d4(%ebx)
+80103a03:	34 10 80 
+    pt->bd.name = "ahci";
+80103a06:	c7 83 00 02 00 00 7b 	movl   $0x8010b07b,0x200(%ebx)
+80103a0d:	b0 10 80 
+        if ((dev = blkalloc(&pt->bd)) < 0) {
+80103a10:	05 40 e7 18 80       	add    $0x8018e740,%eax
+    pt->bd.qs = &pt->bq;
+80103a15:	89 bb 08 02 00 00    	mov    %edi,0x208(%ebx)
+    pt->bd.nq = 1;
+80103a1b:	c7 83 04 02 00 00 01 	movl   $0x1,0x204(%ebx)
+80103a22:	00 00 00 
+        if ((dev = blkalloc(&pt->bd)) < 0) {
+80103a25:	50                   	push   %eax
+80103a26:	e8 55 ea ff ff       	call   80102480 <blkalloc>
+80103a2b:	83 c4 10             	add    $0x10,%esp
+80103a2e:	85 c0                	test   %eax,%eax
+80103a30:	78 46                	js     80103a78 <ahciinit+0x4c8>
+        cprintf("ahci: port %d is dev %d, %s, %d slots\n", i, dev, pt->ncq ? "ncq" : "no ncq", pt->depth);
+80103a32:	8b 93 14 01 00 00    	mov    0x114(%ebx),%edx
+80103a38:	bf 67 b0 10 80       	mov    $0x8010b067,%edi
+80103a3d:	85 d2                	test   %edx,%edx
+80103a3f:	ba 6a b0 10 80       	mov    $0x8010b06a,%edx
+80103a44:	0f 44 d7             	cmove  %edi,%edx
+80103a47:	83 ec 0c             	sub    $0xc,%esp
+80103a4a:	ff b3 10 01 00 00    	push   0x110(%ebx)
+80103a50:	52                   	push   %edx
+80103a51:	50                   	push   %eax
+80103a52:	56                   	push   %esi
+80103a53:	68 c8 b0 10 80       	push   $0x8010b0c8
+80103a58:	e8 63 63 00 00       	call   80109dc0 <cprintf>
+        nport++;
+80103a5d:	83 05 00 e5 18 80 01 	addl   $0x1,0x8018e500
+    *(volatile uint*)(hba + off) = v;
+80103a64:	8b 1d 40 ee 18 80    	mov    0x8018ee40,%ebx
+80103a6a:	83 c4 20             	add    $0x20,%esp
+80103a6d:	e9 c6 fb ff ff       	jmp    80103638 <ahciinit+0x88>
+80103a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            cprintf("ahci: port %d: no device number\n", i);
+80103a78:	83 ec 08             	sub    $0x8,%esp
+80103a7b:	56                   	push   %esi
+80103a7c:	68 a4 b0 10 80       	push   $0x8010b0a4
+80103a81:	e8 3a 63 00 00       	call   80109dc0 <cprintf>
+            ahciportfree(pt);
+80103a86:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103a89:	e8 82 fa ff ff       	call   80103510 <ahciportfree>
+    *(volatile uint*)(hba + off) = v;
+80103a8e:	8b 1d 40 ee 18 80    	mov    0x8018ee40,%ebx
+            continue;
+80103a94:	83 c4 10             	add    $0x10,%esp
+80103a97:	e9 9c fb ff ff       	jmp    80103638 <ahciinit+0x88>
+80103a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            kfree(id);
+80103aa0:	83 ec 0c             	sub    $0xc,%esp
+80103aa3:	52                   	push   %edx
+80103aa4:	e8 a7 44 00 00       	call   80107f50 <kfree>
+            ahciportfree(pt);
+80103aa9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103aac:	e8 5f fa ff ff       	call   80103510 <ahciportfree>
+    *(volatile uint*)(hba + off) = v;
+80103ab1:	8b 1d 40 ee 18 80    	mov    0x8018ee40,%ebx
+80103ab7:	83 c4 10             	add    $0x10,%esp
+80103aba:	e9 79 fb ff ff       	jmp    80103638 <ahciinit+0x88>
+            ahciportfree(pt);
+80103abf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103ac2:	e8 49 fa ff ff       	call   80103510 <ahciportfree>
+    *(volatile uint*)(hba + off) = v;
+80103ac7:	8b 1d 40 ee 18 80    	mov    0x8018ee40,%ebx
+80103acd:	e9 66 fb ff ff       	jmp    80103638 <ahciinit+0x88>
+        panic("ahciportinit");
+80103ad2:	83 ec 0c             	sub    $0xc,%esp
+80103ad5:	68 6e b0 10 80       	push   $0x8010b06e
+80103ada:	e8 61 62 00 00       	call   80109d40 <panic>
+80103adf:	90                   	nop
+
+80103ae0 <virtiokick>:
+}
+
+// tell the device about the requests virtiostart() added
+static void
+virtiokick(struct blkqueue *bq)
+{
+80103ae0:	55                   	push   %ebp
+80103ae1:	89 e5                	mov    %esp,%ebp
+    struct virtq *vq = bq->priv;
+80103ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+80103ae6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+
+    __sync_synchronize();
+80103aec:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    outw(vbase + VIO_QNOTIFY, vq->qn);
+80103af1:	0f b7 0d f8 3a 1b 80 	movzwl 0x801b3af8,%ecx
+80103af8:	8b 00                	mov    (%eax),%eax
+80103afa:	8d 51 10             	lea    0x10(%ecx),%edx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103afd:	66 ef                	out    %ax,(%dx)
+}
+80103aff:	5d                   	pop    %ebp
+80103b00:	c3                   	ret
+80103b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b0f:	90                   	nop
+
+80103b10 <virtiostart>:
+{
+80103b10:	55                   	push   %ebp
+80103b11:	89 e5                	mov    %esp,%ebp
+80103b13:	57                   	push   %edi
+80103b14:	56                   	push   %esi
+80103b15:	53                   	push   %ebx
+80103b16:	83 ec 2c             	sub    $0x2c,%esp
+    struct virtq *vq = bq->priv;
+80103b19:	8b 55 08             	mov    0x8(%ebp),%edx
+{
+80103b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    struct virtq *vq = bq->priv;
+80103b1f:	8b b2 98 00 00 00    	mov    0x98(%edx),%esi
+    for (s = 0; s < vq->nslot && (vq->busy & (1U << s)); s++)
+80103b25:	8b 7e 1c             	mov    0x1c(%esi),%edi
+    struct virtq *vq = bq->priv;
+80103b28:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    for (s = 0; s < vq->nslot && (vq->busy & (1U << s)); s++)
+80103b2b:	85 ff                	test   %edi,%edi
+80103b2d:	7e 41                	jle    80103b70 <virtiostart+0x60>
+80103b2f:	8b 5e 18             	mov    0x18(%esi),%ebx
+80103b32:	89 da                	mov    %ebx,%edx
+80103b34:	83 e2 01             	and    $0x1,%edx
+80103b37:	0f 84 f1 01 00 00    	je     80103d2e <virtiostart+0x21e>
+80103b3d:	31 c9                	xor    %ecx,%ecx
+80103b3f:	be 01 00 00 00       	mov    $0x1,%esi
+80103b44:	eb 12                	jmp    80103b58 <virtiostart+0x48>
+80103b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b4d:	8d 76 00             	lea    0x0(%esi),%esi
+80103b50:	89 f2                	mov    %esi,%edx
+80103b52:	d3 e2                	shl    %cl,%edx
+80103b54:	85 da                	test   %ebx,%edx
+80103b56:	74 1c                	je     80103b74 <virtiostart+0x64>
+80103b58:	83 c1 01             	add    $0x1,%ecx
+80103b5b:	39 f9                	cmp    %edi,%ecx
+80103b5d:	75 f1                	jne    80103b50 <virtiostart+0x40>
+        panic("virtiostart: no slot");
+80103b5f:	83 ec 0c             	sub    $0xc,%esp
+80103b62:	68 f2 b0 10 80       	push   $0x8010b0f2
+80103b67:	e8 d4 61 00 00       	call   80109d40 <panic>
+80103b6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if (s == vq->nslot)
+80103b70:	74 ed                	je     80103b5f <virtiostart+0x4f>
+    for (s = 0; s < vq->nslot && (vq->busy & (1U << s)); s++)
+80103b72:	31 c9                	xor    %ecx,%ecx
+    vq->busy |= 1U << s;
+80103b74:	bb 01 00 00 00       	mov    $0x1,%ebx
+    r = &vq->req[s];
+80103b79:	69 d1 b8 00 00 00    	imul   $0xb8,%ecx,%edx
+    vq->busy |= 1U << s;
+80103b7f:	d3 e3                	shl    %cl,%ebx
+80103b81:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+    r = &vq->req[s];
+80103b84:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    write = (b->flags & B_DIRTY) != 0;
+80103b87:	8b 38                	mov    (%eax),%edi
+    r = &vq->req[s];
+80103b89:	8b 5e 20             	mov    0x20(%esi),%ebx
+    if (indirect) {
+80103b8c:	8b 35 f4 3a 1b 80    	mov    0x801b3af4,%esi
+    r = &vq->req[s];
+80103b92:	01 d3                	add    %edx,%ebx
+    write = (b->flags & B_DIRTY) != 0;
+80103b94:	83 e7 04             	and    $0x4,%edi
+    if (indirect) {
+80103b97:	89 75 dc             	mov    %esi,-0x24(%ebp)
+    write = (b->flags & B_DIRTY) != 0;
+80103b9a:	0f 95 c2             	setne  %dl
+    r->hdr.ioprio = 0;
+80103b9d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    write = (b->flags & B_DIRTY) != 0;
+80103ba4:	0f b6 d2             	movzbl %dl,%edx
+80103ba7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+    r->hdr.type = write ? VBLK_T_OUT : VBLK_T_IN;
+80103baa:	89 13                	mov    %edx,(%ebx)
+    r->hdr.sector = b->blockno * (BSIZE / SECTOR_SIZE);
+80103bac:	8b 50 08             	mov    0x8(%eax),%edx
+    r->hdr.sectorhi = 0;
+80103baf:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    r->hdr.sector = b->blockno * (BSIZE / SECTOR_SIZE);
+80103bb6:	89 53 08             	mov    %edx,0x8(%ebx)
+    t[0].addr = V2P(&r->hdr);
+80103bb9:	8d 93 00 00 00 80    	lea    -0x80000000(%ebx),%edx
+    r->status = 0xFF;
+80103bbf:	c6 83 b4 00 00 00 ff 	movb   $0xff,0xb4(%ebx)
+    r->b = b;
+80103bc6:	89 83 b0 00 00 00    	mov    %eax,0xb0(%ebx)
+    if (indirect) {
+80103bcc:	85 f6                	test   %esi,%esi
+80103bce:	0f 85 3c 01 00 00    	jne    80103d10 <virtiostart+0x200>
+        t = &vq->desc[head];
+80103bd4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+        head = s * (VRUN + 2);
+80103bd7:	8d 34 89             	lea    (%ecx,%ecx,4),%esi
+80103bda:	8d 0c 36             	lea    (%esi,%esi,1),%ecx
+        t = &vq->desc[head];
+80103bdd:	c1 e6 05             	shl    $0x5,%esi
+80103be0:	03 77 08             	add    0x8(%edi),%esi
+    t[0].flags = VD_NEXT;
+80103be3:	bf 01 00 00 00       	mov    $0x1,%edi
+        t = &vq->desc[head];
+80103be8:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    t[0].addr = V2P(&r->hdr);
+80103beb:	89 16                	mov    %edx,(%esi)
+    t[0].len = sizeof(r->hdr);
+80103bed:	c7 46 08 10 00 00 00 	movl   $0x10,0x8(%esi)
+    t[0].flags = VD_NEXT;
+80103bf4:	66 89 7e 0c          	mov    %di,0xc(%esi)
+    for (n = 1, x = b; x; n++, x = x->qnext) {
+80103bf8:	83 7d d4 01          	cmpl   $0x1,-0x2c(%ebp)
+80103bfc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80103bff:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80103c02:	19 ff                	sbb    %edi,%edi
+80103c04:	83 e7 02             	and    $0x2,%edi
+80103c07:	8d 56 10             	lea    0x10(%esi),%edx
+80103c0a:	be 01 00 00 00       	mov    $0x1,%esi
+80103c0f:	83 c7 01             	add    $0x1,%edi
+80103c12:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        t[n].addr = V2P(x->data);
+80103c18:	8b 88 cc 00 00 00    	mov    0xcc(%eax),%ecx
+        t[n].flags = VD_NEXT | (write ? 0 : VD_WRITE);
+80103c1e:	66 89 7a 0c          	mov    %di,0xc(%edx)
+    for (n = 1, x = b; x; n++, x = x->qnext) {
+80103c22:	83 c6 01             	add    $0x1,%esi
+80103c25:	83 c2 10             	add    $0x10,%edx
+        t[n].len = BSIZE;
+80103c28:	c7 42 f8 00 02 00 00 	movl   $0x200,-0x8(%edx)
+        t[n].addr = V2P(x->data);
+80103c2f:	81 c1 00 00 00 80    	add    $0x80000000,%ecx
+80103c35:	89 4a f0             	mov    %ecx,-0x10(%edx)
+    for (n = 1, x = b; x; n++, x = x->qnext) {
+80103c38:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80103c3e:	85 c0                	test   %eax,%eax
+80103c40:	75 d6                	jne    80103c18 <virtiostart+0x108>
+    t[n].addr = V2P(&r->status);
+80103c42:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80103c45:	c1 e6 04             	shl    $0x4,%esi
+80103c48:	81 eb 4c ff ff 7f    	sub    $0x7fffff4c,%ebx
+80103c4e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80103c51:	8d 14 37             	lea    (%edi,%esi,1),%edx
+80103c54:	89 1a                	mov    %ebx,(%edx)
+    t[n].flags = VD_WRITE;
+80103c56:	bb 02 00 00 00       	mov    $0x2,%ebx
+80103c5b:	66 89 5a 0c          	mov    %bx,0xc(%edx)
+80103c5f:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+    t[n].len = 1;
+80103c62:	c7 42 08 01 00 00 00 	movl   $0x1,0x8(%edx)
+    for (n = 0; n < nd; n++) {
+80103c69:	8d 57 04             	lea    0x4(%edi),%edx
+80103c6c:	85 db                	test   %ebx,%ebx
+80103c6e:	8d 5c 37 14          	lea    0x14(%edi,%esi,1),%ebx
+80103c72:	0f 44 c1             	cmove  %ecx,%eax
+80103c75:	83 c0 01             	add    $0x1,%eax
+80103c78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c7f:	90                   	nop
+        t[n].next = (indirect ? 0 : head) + n + 1;
+80103c80:	66 89 42 0a          	mov    %ax,0xa(%edx)
+    for (n = 0; n < nd; n++) {
+80103c84:	83 c2 10             	add    $0x10,%edx
+80103c87:	83 c0 01             	add    $0x1,%eax
+        t[n].addrhi = 0;
+80103c8a:	c7 42 f0 00 00 00 00 	movl   $0x0,-0x10(%edx)
+    for (n = 0; n < nd; n++) {
+80103c91:	39 d3                	cmp    %edx,%ebx
+80103c93:	75 eb                	jne    80103c80 <virtiostart+0x170>
+    if (indirect) {
+80103c95:	8b 7d dc             	mov    -0x24(%ebp),%edi
+80103c98:	85 ff                	test   %edi,%edi
+80103c9a:	74 43                	je     80103cdf <virtiostart+0x1cf>
+        vq->desc[head].addr = V2P(t);
+80103c9c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103c9f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80103ca2:	89 c8                	mov    %ecx,%eax
+        vq->desc[head].len = nd * sizeof(struct vdesc);
+80103ca4:	83 c6 10             	add    $0x10,%esi
+        vq->desc[head].addr = V2P(t);
+80103ca7:	c1 e0 04             	shl    $0x4,%eax
+80103caa:	8b 5f 08             	mov    0x8(%edi),%ebx
+80103cad:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+80103cb3:	89 14 03             	mov    %edx,(%ebx,%eax,1)
+        vq->desc[head].addrhi = 0;
+80103cb6:	8b 57 08             	mov    0x8(%edi),%edx
+        vq->desc[head].flags = VD_INDIRECT;
+80103cb9:	bb 04 00 00 00       	mov    $0x4,%ebx
+        vq->desc[head].addrhi = 0;
+80103cbe:	c7 44 02 04 00 00 00 	movl   $0x0,0x4(%edx,%eax,1)
+80103cc5:	00 
+        vq->desc[head].len = nd * sizeof(struct vdesc);
+80103cc6:	8b 57 08             	mov    0x8(%edi),%edx
+80103cc9:	89 74 02 08          	mov    %esi,0x8(%edx,%eax,1)
+        vq->desc[head].flags = VD_INDIRECT;
+80103ccd:	8b 57 08             	mov    0x8(%edi),%edx
+        vq->desc[head].next = 0;
+80103cd0:	31 f6                	xor    %esi,%esi
+        vq->desc[head].flags = VD_INDIRECT;
+80103cd2:	66 89 5c 02 0c       	mov    %bx,0xc(%edx,%eax,1)
+        vq->desc[head].next = 0;
+80103cd7:	8b 57 08             	mov    0x8(%edi),%edx
+80103cda:	66 89 74 02 0e       	mov    %si,0xe(%edx,%eax,1)
+    vq->busy |= 1U << s;
+80103cdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80103ce2:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    vq->avail->ring[vq->avail->idx % vq->num] = head;
+80103ce5:	31 d2                	xor    %edx,%edx
+    vq->busy |= 1U << s;
+80103ce7:	09 5f 18             	or     %ebx,0x18(%edi)
+    vq->avail->ring[vq->avail->idx % vq->num] = head;
+80103cea:	8b 5f 0c             	mov    0xc(%edi),%ebx
+80103ced:	0f b7 43 02          	movzwl 0x2(%ebx),%eax
+80103cf1:	f7 77 04             	divl   0x4(%edi)
+80103cf4:	66 89 4c 53 04       	mov    %cx,0x4(%ebx,%edx,2)
+    __sync_synchronize();
+80103cf9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    vq->avail->idx++;
+80103cfe:	8b 47 0c             	mov    0xc(%edi),%eax
+80103d01:	66 83 40 02 01       	addw   $0x1,0x2(%eax)
+}
+80103d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103d09:	5b                   	pop    %ebx
+80103d0a:	5e                   	pop    %esi
+80103d0b:	5f                   	pop    %edi
+80103d0c:	5d                   	pop    %ebp
+80103d0d:	c3                   	ret
+80103d0e:	66 90                	xchg   %ax,%ax
+    t[0].addr = V2P(&r->hdr);
+80103d10:	89 53 10             	mov    %edx,0x10(%ebx)
+        t = r->ind;
+80103d13:	8d 73 10             	lea    0x10(%ebx),%esi
+    t[0].flags = VD_NEXT;
+80103d16:	ba 01 00 00 00       	mov    $0x1,%edx
+        t = r->ind;
+80103d1b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    t[0].len = sizeof(r->hdr);
+80103d1e:	c7 43 18 10 00 00 00 	movl   $0x10,0x18(%ebx)
+    t[0].flags = VD_NEXT;
+80103d25:	66 89 53 1c          	mov    %dx,0x1c(%ebx)
+    for (n = 1, x = b; x; n++, x = x->qnext) {
+80103d29:	e9 ca fe ff ff       	jmp    80103bf8 <virtiostart+0xe8>
+    for (s = 0; s < vq->nslot && (vq->busy & (1U << s)); s++)
+80103d2e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+80103d35:	31 c9                	xor    %ecx,%ecx
+80103d37:	e9 48 fe ff ff       	jmp    80103b84 <virtiostart+0x74>
+80103d3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103d40 <virtiofinish>:
+
+// finish the requests the device has put in bq's used ring, and start
+// more. returns how many. caller holds bq->lock
+static int
+virtiofinish(struct blkqueue *bq)
+{
+80103d40:	55                   	push   %ebp
+80103d41:	89 e5                	mov    %esp,%ebp
+80103d43:	57                   	push   %edi
+80103d44:	56                   	push   %esi
+    struct virtq *vq = bq->priv;
+    struct vusedelem *e;
+    struct vreq *r;
+    int s, n;
+
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103d45:	31 f6                	xor    %esi,%esi
+{
+80103d47:	53                   	push   %ebx
+80103d48:	83 ec 1c             	sub    $0x1c,%esp
+    struct virtq *vq = bq->priv;
+80103d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+80103d4e:	8b 98 98 00 00 00    	mov    0x98(%eax),%ebx
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103d54:	8b 43 10             	mov    0x10(%ebx),%eax
+80103d57:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+80103d5b:	66 39 43 14          	cmp    %ax,0x14(%ebx)
+80103d5f:	75 77                	jne    80103dd8 <virtiofinish+0x98>
+80103d61:	e9 aa 00 00 00       	jmp    80103e10 <virtiofinish+0xd0>
+80103d66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d6d:	8d 76 00             	lea    0x0(%esi),%esi
+        __sync_synchronize();
+        e = &vq->used->ring[vq->lastused % vq->num];
+        s = indirect ? e->id : e->id / (VRUN + 2);
+80103d70:	8b 7c d1 04          	mov    0x4(%ecx,%edx,8),%edi
+        r = &vq->req[s];
+80103d74:	69 c7 b8 00 00 00    	imul   $0xb8,%edi,%eax
+80103d7a:	03 43 20             	add    0x20(%ebx),%eax
+        if (r->status != 0)
+80103d7d:	0f b6 90 b4 00 00 00 	movzbl 0xb4(%eax),%edx
+80103d84:	84 d2                	test   %dl,%dl
+80103d86:	0f 85 99 00 00 00    	jne    80103e25 <virtiofinish+0xe5>
+            panic("virtiointr: i/o error");
+        blkdone(bq, r->b);
+80103d8c:	83 ec 08             	sub    $0x8,%esp
+80103d8f:	ff b0 b0 00 00 00    	push   0xb0(%eax)
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103d95:	83 c6 01             	add    $0x1,%esi
+        blkdone(bq, r->b);
+80103d98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103d9b:	ff 75 08             	push   0x8(%ebp)
+80103d9e:	e8 ad e7 ff ff       	call   80102550 <blkdone>
+        r->b = 0;
+80103da3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+        vq->busy &= ~(1U << s);
+80103da6:	89 f9                	mov    %edi,%ecx
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103da8:	83 c4 10             	add    $0x10,%esp
+        r->b = 0;
+80103dab:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80103db2:	00 00 00 
+        vq->busy &= ~(1U << s);
+80103db5:	b8 01 00 00 00       	mov    $0x1,%eax
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103dba:	8b 53 10             	mov    0x10(%ebx),%edx
+        vq->busy &= ~(1U << s);
+80103dbd:	d3 e0                	shl    %cl,%eax
+80103dbf:	f7 d0                	not    %eax
+80103dc1:	21 43 18             	and    %eax,0x18(%ebx)
+        vq->lastused++;
+80103dc4:	0f b7 43 14          	movzwl 0x14(%ebx),%eax
+80103dc8:	83 c0 01             	add    $0x1,%eax
+80103dcb:	66 89 43 14          	mov    %ax,0x14(%ebx)
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+80103dcf:	0f b7 52 02          	movzwl 0x2(%edx),%edx
+80103dd3:	66 39 d0             	cmp    %dx,%ax
+80103dd6:	74 38                	je     80103e10 <virtiofinish+0xd0>
+        __sync_synchronize();
+80103dd8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+        e = &vq->used->ring[vq->lastused % vq->num];
+80103ddd:	31 d2                	xor    %edx,%edx
+80103ddf:	0f b7 43 14          	movzwl 0x14(%ebx),%eax
+80103de3:	8b 4b 10             	mov    0x10(%ebx),%ecx
+80103de6:	f7 73 04             	divl   0x4(%ebx)
+        s = indirect ? e->id : e->id / (VRUN + 2);
+80103de9:	a1 f4 3a 1b 80       	mov    0x801b3af4,%eax
+80103dee:	85 c0                	test   %eax,%eax
+80103df0:	0f 85 7a ff ff ff    	jne    80103d70 <virtiofinish+0x30>
+80103df6:	8b 54 d1 04          	mov    0x4(%ecx,%edx,8),%edx
+80103dfa:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+80103dff:	f7 e2                	mul    %edx
+80103e01:	89 d7                	mov    %edx,%edi
+80103e03:	c1 ef 03             	shr    $0x3,%edi
+80103e06:	e9 69 ff ff ff       	jmp    80103d74 <virtiofinish+0x34>
+80103e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e0f:	90                   	nop
+    }
+    blkstart(bq);
+80103e10:	83 ec 0c             	sub    $0xc,%esp
+80103e13:	ff 75 08             	push   0x8(%ebp)
+80103e16:	e8 a5 e6 ff ff       	call   801024c0 <blkstart>
+    return n;
+}
+80103e1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e1e:	89 f0                	mov    %esi,%eax
+80103e20:	5b                   	pop    %ebx
+80103e21:	5e                   	pop    %esi
+80103e22:	5f                   	pop    %edi
+80103e23:	5d                   	pop    %ebp
+80103e24:	c3                   	ret
+            panic("virtiointr: i/o error");
+80103e25:	83 ec 0c             	sub    $0xc,%esp
+80103e28:	68 07 b1 10 80       	push   $0x8010b107
+80103e2d:	e8 0e 5f 00 00       	call   80109d40 <panic>
+80103e32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103e40 <virtiointr>:
+virtiointr(void)
+{
+    int i;
+
+    // the register is shared by all the queues
+    if (!(inb(vbase + VIO_ISR) & VISR_QUEUE))
+80103e40:	0f b7 05 f8 3a 1b 80 	movzwl 0x801b3af8,%eax
+80103e47:	8d 50 13             	lea    0x13(%eax),%edx
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103e4a:	ec                   	in     (%dx),%al
+80103e4b:	a8 01                	test   $0x1,%al
+80103e4d:	74 51                	je     80103ea0 <virtiointr+0x60>
+        return;
+    for (i = 0; i < nq; i++) {
+80103e4f:	a1 f0 3a 1b 80       	mov    0x801b3af0,%eax
+80103e54:	85 c0                	test   %eax,%eax
+80103e56:	7e 48                	jle    80103ea0 <virtiointr+0x60>
+{
+80103e58:	55                   	push   %ebp
+80103e59:	89 e5                	mov    %esp,%ebp
+80103e5b:	56                   	push   %esi
+    for (i = 0; i < nq; i++) {
+80103e5c:	31 f6                	xor    %esi,%esi
+{
+80103e5e:	53                   	push   %ebx
+80103e5f:	bb 40 30 1b 80       	mov    $0x801b3040,%ebx
+80103e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        acquire(&vbqs[i].lock);
+80103e68:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < nq; i++) {
+80103e6b:	83 c6 01             	add    $0x1,%esi
+        acquire(&vbqs[i].lock);
+80103e6e:	53                   	push   %ebx
+80103e6f:	e8 3c d6 ff ff       	call   801014b0 <acquire>
+        virtiofinish(&vbqs[i]);
+80103e74:	89 1c 24             	mov    %ebx,(%esp)
+80103e77:	e8 c4 fe ff ff       	call   80103d40 <virtiofinish>
+        release(&vbqs[i].lock);
+80103e7c:	89 1c 24             	mov    %ebx,(%esp)
+    for (i = 0; i < nq; i++) {
+80103e7f:	81 c3 c0 00 00 00    	add    $0xc0,%ebx
+        release(&vbqs[i].lock);
+80103e85:	e8 46 d4 ff ff       	call   801012d0 <release>
+    for (i = 0; i < nq; i++) {
+80103e8a:	83 c4 10             	add    $0x10,%esp
+80103e8d:	3b 35 f0 3a 1b 80    	cmp    0x801b3af0,%esi
+80103e93:	7c d3                	jl     80103e68 <virtiointr+0x28>
+    }
+}
+80103e95:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103e98:	5b                   	pop    %ebx
+80103e99:	5e                   	pop    %esi
+80103e9a:	5d                   	pop    %ebp
+80103e9b:	c3                   	ret
+80103e9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103ea0:	c3                   	ret
+80103ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ea8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103eaf:	90                   	nop
+
+80103eb0 <virtioinit>:
+{
+80103eb0:	55                   	push   %ebp
+80103eb1:	89 e5                	mov    %esp,%ebp
+80103eb3:	57                   	push   %edi
+80103eb4:	56                   	push   %esi
+80103eb5:	53                   	push   %ebx
+80103eb6:	83 ec 24             	sub    $0x24,%esp
+    if ((d = pcifindid(VIRTIO_VENDOR, VIRTIO_BLK)) == 0 || !(d->bar[0] & PCI_BAR_IO))
+80103eb9:	68 01 10 00 00       	push   $0x1001
+80103ebe:	68 f4 1a 00 00       	push   $0x1af4
+80103ec3:	e8 f8 cc ff ff       	call   80100bc0 <pcifindid>
+80103ec8:	83 c4 10             	add    $0x10,%esp
+80103ecb:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80103ece:	85 c0                	test   %eax,%eax
+80103ed0:	74 08                	je     80103eda <virtioinit+0x2a>
+80103ed2:	89 c7                	mov    %eax,%edi
+80103ed4:	f6 40 14 01          	testb  $0x1,0x14(%eax)
+80103ed8:	75 0e                	jne    80103ee8 <virtioinit+0x38>
+}
+80103eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103edd:	5b                   	pop    %ebx
+80103ede:	5e                   	pop    %esi
+80103edf:	5f                   	pop    %edi
+80103ee0:	5d                   	pop    %ebp
+80103ee1:	c3                   	ret
+80103ee2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pcienable(d, 1);
+80103ee8:	83 ec 08             	sub    $0x8,%esp
+80103eeb:	6a 01                	push   $0x1
+80103eed:	50                   	push   %eax
+80103eee:	e8 4d ca ff ff       	call   80100940 <pcienable>
+    vbase = PCI_BAR_IOADDR(d->bar[0]);
+80103ef3:	8b 47 14             	mov    0x14(%edi),%eax
+80103ef6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103ef9:	0f b7 5d e4          	movzwl -0x1c(%ebp),%ebx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103efd:	31 c0                	xor    %eax,%eax
+80103eff:	83 e3 fc             	and    $0xfffffffc,%ebx
+80103f02:	66 89 1d f8 3a 1b 80 	mov    %bx,0x801b3af8
+    outb(vbase + VIO_STATUS, 0);    // reset
+80103f09:	8d 53 12             	lea    0x12(%ebx),%edx
+80103f0c:	ee                   	out    %al,(%dx)
+80103f0d:	b8 01 00 00 00       	mov    $0x1,%eax
+80103f12:	ee                   	out    %al,(%dx)
+80103f13:	b8 03 00 00 00       	mov    $0x3,%eax
+80103f18:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f19:	89 da                	mov    %ebx,%edx
+80103f1b:	ed                   	in     (%dx),%eax
+80103f1c:	89 c1                	mov    %eax,%ecx
+    outl(vbase + VIO_DRVFEAT, feat);
+80103f1e:	8d 53 04             	lea    0x4(%ebx),%edx
+    feat = inl(vbase + VIO_DEVFEAT) & (VBLK_F_MQ | VRING_F_INDIRECT);
+80103f21:	25 00 10 00 10       	and    $0x10001000,%eax
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f26:	ef                   	out    %eax,(%dx)
+    nq = 1;
+80103f27:	c7 05 f0 3a 1b 80 01 	movl   $0x1,0x801b3af0
+80103f2e:	00 00 00 
+    indirect = (feat & VRING_F_INDIRECT) != 0;
+80103f31:	89 c8                	mov    %ecx,%eax
+    if (feat & VBLK_F_MQ)
+80103f33:	83 c4 10             	add    $0x10,%esp
+    indirect = (feat & VRING_F_INDIRECT) != 0;
+80103f36:	c1 e8 1c             	shr    $0x1c,%eax
+80103f39:	83 e0 01             	and    $0x1,%eax
+80103f3c:	a3 f4 3a 1b 80       	mov    %eax,0x801b3af4
+    if (feat & VBLK_F_MQ)
+80103f41:	80 e5 10             	and    $0x10,%ch
+80103f44:	0f 84 16 02 00 00    	je     80104160 <virtioinit+0x2b0>
+        nq = inw(vbase + VIO_CONFIG + VBLK_CFG_NUMQ);
+80103f4a:	8d 53 36             	lea    0x36(%ebx),%edx
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f4d:	66 ed                	in     (%dx),%ax
+    if (nq > ncpu)
+80103f4f:	8b 15 48 c6 18 80    	mov    0x8018c648,%edx
+        nq = inw(vbase + VIO_CONFIG + VBLK_CFG_NUMQ);
+80103f55:	0f b7 c0             	movzwl %ax,%eax
+80103f58:	a3 f0 3a 1b 80       	mov    %eax,0x801b3af0
+    if (nq > ncpu)
+80103f5d:	39 d0                	cmp    %edx,%eax
+80103f5f:	7e 08                	jle    80103f69 <virtioinit+0xb9>
+        nq = ncpu;
+80103f61:	89 15 f0 3a 1b 80    	mov    %edx,0x801b3af0
+    if (nq > ncpu)
+80103f67:	89 d0                	mov    %edx,%eax
+    if (nq > NVQ)
+80103f69:	83 f8 0c             	cmp    $0xc,%eax
+80103f6c:	0f 8e 23 02 00 00    	jle    80104195 <virtioinit+0x2e5>
+        nq = NVQ;
+80103f72:	c7 05 f0 3a 1b 80 0c 	movl   $0xc,0x801b3af0
+80103f79:	00 00 00 
+    for (i = 0; i < nq; i++) {
+80103f7c:	c7 45 e4 00 f0 18 80 	movl   $0x8018f000,-0x1c(%ebp)
+80103f83:	be 40 39 1b 80       	mov    $0x801b3940,%esi
+80103f88:	bf 40 30 1b 80       	mov    $0x801b3040,%edi
+    if (nq > ncpu)
+80103f8d:	31 c9                	xor    %ecx,%ecx
+80103f8f:	90                   	nop
+    outw(vbase + VIO_QSEL, qn);
+80103f90:	8d 53 0e             	lea    0xe(%ebx),%edx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f93:	89 c8                	mov    %ecx,%eax
+80103f95:	66 ef                	out    %ax,(%dx)
+    num = inw(vbase + VIO_QSIZE);
+80103f97:	8d 53 0c             	lea    0xc(%ebx),%edx
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f9a:	66 ed                	in     (%dx),%ax
+80103f9c:	0f b7 d8             	movzwl %ax,%ebx
+    if (num == 0 || num > VQMAX)
+80103f9f:	8d 43 ff             	lea    -0x1(%ebx),%eax
+80103fa2:	3d ff 00 00 00       	cmp    $0xff,%eax
+80103fa7:	76 2f                	jbe    80103fd8 <virtioinit+0x128>
+            cprintf("virtio: queue %d too big\n", i);
+80103fa9:	83 ec 08             	sub    $0x8,%esp
+80103fac:	51                   	push   %ecx
+80103fad:	68 26 b1 10 80       	push   $0x8010b126
+80103fb2:	e8 09 5e 00 00       	call   80109dc0 <cprintf>
+            outb(vbase + VIO_STATUS, VS_FAILED);
+80103fb7:	0f b7 05 f8 3a 1b 80 	movzwl 0x801b3af8,%eax
+80103fbe:	8d 50 12             	lea    0x12(%eax),%edx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103fc1:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80103fc6:	ee                   	out    %al,(%dx)
+            return;
+80103fc7:	83 c4 10             	add    $0x10,%esp
+}
+80103fca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103fcd:	5b                   	pop    %ebx
+80103fce:	5e                   	pop    %esi
+80103fcf:	5f                   	pop    %edi
+80103fd0:	5d                   	pop    %ebp
+80103fd1:	c3                   	ret
+80103fd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memset(mem, 0, sizeof(vqmem[qn]));
+80103fd8:	83 ec 04             	sub    $0x4,%esp
+80103fdb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80103fde:	68 00 30 00 00       	push   $0x3000
+80103fe3:	6a 00                	push   $0x0
+80103fe5:	ff 75 e4             	push   -0x1c(%ebp)
+80103fe8:	e8 53 c0 ff ff       	call   80100040 <memset>
+    vq->desc = (struct vdesc*)mem;
+80103fed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    vq->avail = (struct vavail*)(mem + num * sizeof(struct vdesc));
+80103ff0:	89 d8                	mov    %ebx,%eax
+    vq->qn = qn;
+80103ff2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    vq->avail = (struct vavail*)(mem + num * sizeof(struct vdesc));
+80103ff5:	c1 e0 04             	shl    $0x4,%eax
+    vq->num = num;
+80103ff8:	89 5e 04             	mov    %ebx,0x4(%esi)
+    vq->avail = (struct vavail*)(mem + num * sizeof(struct vdesc));
+80103ffb:	01 d0                	add    %edx,%eax
+    vq->desc = (struct vdesc*)mem;
+80103ffd:	89 56 08             	mov    %edx,0x8(%esi)
+    vq->avail = (struct vavail*)(mem + num * sizeof(struct vdesc));
+80104000:	89 46 0c             	mov    %eax,0xc(%esi)
+    vq->used = (struct vused*)(mem + PGROUNDUP(num * sizeof(struct vdesc) + 6 + 2 * num));
+80104003:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+80104006:	8d 84 00 05 10 00 00 	lea    0x1005(%eax,%eax,1),%eax
+    vq->qn = qn;
+8010400d:	89 0e                	mov    %ecx,(%esi)
+    vq->used = (struct vused*)(mem + PGROUNDUP(num * sizeof(struct vdesc) + 6 + 2 * num));
+8010400f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80104014:	01 d0                	add    %edx,%eax
+80104016:	89 46 10             	mov    %eax,0x10(%esi)
+    outl(vbase + VIO_QPFN, V2P(mem) >> PTXSHIFT);
+80104019:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010401f:	0f b7 15 f8 3a 1b 80 	movzwl 0x801b3af8,%edx
+80104026:	c1 e8 0c             	shr    $0xc,%eax
+80104029:	83 c2 08             	add    $0x8,%edx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010402c:	ef                   	out    %eax,(%dx)
+    vq->nslot = indirect ? num : num / (VRUN + 2);
+8010402d:	a1 f4 3a 1b 80       	mov    0x801b3af4,%eax
+80104032:	83 c4 10             	add    $0x10,%esp
+80104035:	85 c0                	test   %eax,%eax
+80104037:	75 0c                	jne    80104045 <virtioinit+0x195>
+80104039:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+8010403e:	f7 e3                	mul    %ebx
+80104040:	89 d3                	mov    %edx,%ebx
+80104042:	c1 eb 03             	shr    $0x3,%ebx
+    if (vq->nslot > NVREQ)
+80104045:	b8 10 00 00 00       	mov    $0x10,%eax
+8010404a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010404d:	39 c3                	cmp    %eax,%ebx
+8010404f:	0f 4f d8             	cmovg  %eax,%ebx
+80104052:	89 5e 1c             	mov    %ebx,0x1c(%esi)
+    if ((vq->req = (struct vreq*)kalloc()) == 0)
+80104055:	e8 e6 40 00 00       	call   80108140 <kalloc>
+8010405a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010405d:	85 c0                	test   %eax,%eax
+8010405f:	89 46 20             	mov    %eax,0x20(%esi)
+80104062:	0f 84 37 01 00 00    	je     8010419f <virtioinit+0x2ef>
+    memset(vq->req, 0, PGSIZE);
+80104068:	83 ec 04             	sub    $0x4,%esp
+8010406b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010406e:	68 00 10 00 00       	push   $0x1000
+80104073:	6a 00                	push   $0x0
+80104075:	50                   	push   %eax
+80104076:	e8 c5 bf ff ff       	call   80100040 <memset>
+    blkqinit(&vbqs[qn], "virtq", &deadlinesched, VRUN, vq->nslot, virtiostart, vq);
+8010407b:	83 c4 0c             	add    $0xc,%esp
+8010407e:	56                   	push   %esi
+    for (i = 0; i < nq; i++) {
+8010407f:	83 c6 24             	add    $0x24,%esi
+    blkqinit(&vbqs[qn], "virtq", &deadlinesched, VRUN, vq->nslot, virtiostart, vq);
+80104082:	68 10 3b 10 80       	push   $0x80103b10
+80104087:	ff 76 f8             	push   -0x8(%esi)
+8010408a:	6a 08                	push   $0x8
+8010408c:	68 08 c0 10 80       	push   $0x8010c008
+80104091:	68 4a b1 10 80       	push   $0x8010b14a
+80104096:	57                   	push   %edi
+    for (i = 0; i < nq; i++) {
+80104097:	81 c7 c0 00 00 00    	add    $0xc0,%edi
+    blkqinit(&vbqs[qn], "virtq", &deadlinesched, VRUN, vq->nslot, virtiostart, vq);
+8010409d:	e8 3e e3 ff ff       	call   801023e0 <blkqinit>
+    for (i = 0; i < nq; i++) {
+801040a2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+801040a5:	83 c4 20             	add    $0x20,%esp
+801040a8:	a1 f0 3a 1b 80       	mov    0x801b3af0,%eax
+    vbqs[qn].kick = virtiokick;
+801040ad:	c7 47 d0 e0 3a 10 80 	movl   $0x80103ae0,-0x30(%edi)
+    for (i = 0; i < nq; i++) {
+801040b4:	83 c1 01             	add    $0x1,%ecx
+    vbqs[qn].poll = virtiofinish;
+801040b7:	c7 47 d4 40 3d 10 80 	movl   $0x80103d40,-0x2c(%edi)
+    for (i = 0; i < nq; i++) {
+801040be:	81 45 e4 00 30 00 00 	addl   $0x3000,-0x1c(%ebp)
+801040c5:	39 c8                	cmp    %ecx,%eax
+801040c7:	7e 0f                	jle    801040d8 <virtioinit+0x228>
+    outw(vbase + VIO_QSEL, qn);
+801040c9:	0f b7 1d f8 3a 1b 80 	movzwl 0x801b3af8,%ebx
+801040d0:	e9 bb fe ff ff       	jmp    80103f90 <virtioinit+0xe0>
+801040d5:	8d 76 00             	lea    0x0(%esi),%esi
+    if ((dev = blkalloc(&vdisk)) < 0) {
+801040d8:	83 ec 0c             	sub    $0xc,%esp
+    vdisk.name = "virtio";
+801040db:	c7 05 00 30 1b 80 50 	movl   $0x8010b150,0x801b3000
+801040e2:	b1 10 80 
+    vdisk.nq = nq;
+801040e5:	a3 04 30 1b 80       	mov    %eax,0x801b3004
+    vdisk.qs = vbqs;
+801040ea:	c7 05 08 30 1b 80 40 	movl   $0x801b3040,0x801b3008
+801040f1:	30 1b 80 
+    if ((dev = blkalloc(&vdisk)) < 0) {
+801040f4:	68 00 30 1b 80       	push   $0x801b3000
+801040f9:	e8 82 e3 ff ff       	call   80102480 <blkalloc>
+801040fe:	83 c4 10             	add    $0x10,%esp
+80104101:	89 c3                	mov    %eax,%ebx
+80104103:	85 c0                	test   %eax,%eax
+80104105:	78 79                	js     80104180 <virtioinit+0x2d0>
+    pcisetintr(d, virtiointr);
+80104107:	83 ec 08             	sub    $0x8,%esp
+8010410a:	68 40 3e 10 80       	push   $0x80103e40
+8010410f:	ff 75 dc             	push   -0x24(%ebp)
+80104112:	e8 09 cb ff ff       	call   80100c20 <pcisetintr>
+    outb(vbase + VIO_STATUS, VS_ACK | VS_DRIVER | VS_DRIVER_OK);
+80104117:	0f b7 05 f8 3a 1b 80 	movzwl 0x801b3af8,%eax
+8010411e:	8d 50 12             	lea    0x12(%eax),%edx
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104121:	b8 07 00 00 00       	mov    $0x7,%eax
+80104126:	ee                   	out    %al,(%dx)
+    cprintf("virtio: dev %d, %d queues, %s descriptors\n", dev, nq, indirect ? "indirect" : "direct");
+80104127:	8b 15 f4 3a 1b 80    	mov    0x801b3af4,%edx
+8010412d:	83 c4 10             	add    $0x10,%esp
+80104130:	b8 1f b1 10 80       	mov    $0x8010b11f,%eax
+80104135:	85 d2                	test   %edx,%edx
+80104137:	ba 1d b1 10 80       	mov    $0x8010b11d,%edx
+8010413c:	0f 45 c2             	cmovne %edx,%eax
+8010413f:	50                   	push   %eax
+80104140:	ff 35 f0 3a 1b 80    	push   0x801b3af0
+80104146:	53                   	push   %ebx
+80104147:	68 58 b1 10 80       	push   $0x8010b158
+8010414c:	e8 6f 5c 00 00       	call   80109dc0 <cprintf>
+80104151:	83 c4 10             	add    $0x10,%esp
+80104154:	e9 81 fd ff ff       	jmp    80103eda <virtioinit+0x2a>
+80104159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if (nq > ncpu)
+80104160:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+80104165:	85 c0                	test   %eax,%eax
+80104167:	0f 8f 0f fe ff ff    	jg     80103f7c <virtioinit+0xcc>
+        nq = 1;
+8010416d:	c7 05 f0 3a 1b 80 01 	movl   $0x1,0x801b3af0
+80104174:	00 00 00 
+    for (i = 0; i < nq; i++) {
+80104177:	e9 00 fe ff ff       	jmp    80103f7c <virtioinit+0xcc>
+8010417c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        outb(vbase + VIO_STATUS, VS_FAILED);
+80104180:	0f b7 05 f8 3a 1b 80 	movzwl 0x801b3af8,%eax
+80104187:	8d 50 12             	lea    0x12(%eax),%edx
+8010418a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010418f:	ee                   	out    %al,(%dx)
+        return;
+80104190:	e9 45 fd ff ff       	jmp    80103eda <virtioinit+0x2a>
+    if (nq < 1)     // a device claiming none still has queue 0
+80104195:	85 c0                	test   %eax,%eax
+80104197:	0f 8f df fd ff ff    	jg     80103f7c <virtioinit+0xcc>
+8010419d:	eb ce                	jmp    8010416d <virtioinit+0x2bd>
+        panic("virtqinit");
+8010419f:	83 ec 0c             	sub    $0xc,%esp
+801041a2:	68 40 b1 10 80       	push   $0x8010b140
+801041a7:	e8 94 5b 00 00       	call   80109d40 <panic>
+801041ac:	66 90                	xchg   %ax,%ax
+801041ae:	66 90                	xchg   %ax,%ax
+
+801041b0 <memdiskstart>:
+static struct blkdev memdev;
+
+// called by blkstart() with memq.lock held
+static void
+memdiskstart(struct blkqueue *bq, struct buf *b)
+{
+801041b0:	55                   	push   %ebp
+801041b1:	89 e5                	mov    %esp,%ebp
+801041b3:	57                   	push   %edi
+801041b4:	56                   	push   %esi
+801041b5:	53                   	push   %ebx
+801041b6:	83 ec 0c             	sub    $0xc,%esp
+801041b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801041bc:	8b 75 08             	mov    0x8(%ebp),%esi
+801041bf:	89 df                	mov    %ebx,%edi
+    struct buf *x;
+    uchar *p;
+
+    for (x = b; x; x = x->qnext) {
+801041c1:	85 db                	test   %ebx,%ebx
+801041c3:	75 27                	jne    801041ec <memdiskstart+0x3c>
+801041c5:	eb 60                	jmp    80104227 <memdiskstart+0x77>
+801041c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801041ce:	66 90                	xchg   %ax,%ax
+        if (x->blockno >= nblock)
+            panic("memdiskstart: block out of range");
+        p = memdisk + x->blockno * BSIZE;
+        if (x->flags & B_DIRTY)
+            memmove(p, x->data, BSIZE);
+801041d0:	83 ec 04             	sub    $0x4,%esp
+801041d3:	68 00 02 00 00       	push   $0x200
+801041d8:	52                   	push   %edx
+801041d9:	50                   	push   %eax
+801041da:	e8 f1 be ff ff       	call   801000d0 <memmove>
+    for (x = b; x; x = x->qnext) {
+801041df:	8b bf 90 00 00 00    	mov    0x90(%edi),%edi
+801041e5:	83 c4 10             	add    $0x10,%esp
+801041e8:	85 ff                	test   %edi,%edi
+801041ea:	74 3b                	je     80104227 <memdiskstart+0x77>
+        if (x->blockno >= nblock)
+801041ec:	8b 47 08             	mov    0x8(%edi),%eax
+801041ef:	3b 05 00 3c 1b 80    	cmp    0x801b3c00,%eax
+801041f5:	73 42                	jae    80104239 <memdiskstart+0x89>
+        p = memdisk + x->blockno * BSIZE;
+801041f7:	c1 e0 09             	shl    $0x9,%eax
+            memmove(p, x->data, BSIZE);
+801041fa:	8b 97 cc 00 00 00    	mov    0xcc(%edi),%edx
+        p = memdisk + x->blockno * BSIZE;
+80104200:	03 05 04 3c 1b 80    	add    0x801b3c04,%eax
+        if (x->flags & B_DIRTY)
+80104206:	f6 07 04             	testb  $0x4,(%edi)
+80104209:	75 c5                	jne    801041d0 <memdiskstart+0x20>
+        else
+            memmove(x->data, p, BSIZE);
+8010420b:	83 ec 04             	sub    $0x4,%esp
+8010420e:	68 00 02 00 00       	push   $0x200
+80104213:	50                   	push   %eax
+80104214:	52                   	push   %edx
+80104215:	e8 b6 be ff ff       	call   801000d0 <memmove>
+    for (x = b; x; x = x->qnext) {
+8010421a:	8b bf 90 00 00 00    	mov    0x90(%edi),%edi
+            memmove(x->data, p, BSIZE);
+80104220:	83 c4 10             	add    $0x10,%esp
+    for (x = b; x; x = x->qnext) {
+80104223:	85 ff                	test   %edi,%edi
+80104225:	75 c5                	jne    801041ec <memdiskstart+0x3c>
+    }
+    blkdone(bq, b);
+80104227:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+8010422a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010422d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104230:	5b                   	pop    %ebx
+80104231:	5e                   	pop    %esi
+80104232:	5f                   	pop    %edi
+80104233:	5d                   	pop    %ebp
+    blkdone(bq, b);
+80104234:	e9 17 e3 ff ff       	jmp    80102550 <blkdone>
+            panic("memdiskstart: block out of range");
+80104239:	83 ec 0c             	sub    $0xc,%esp
+8010423c:	68 84 b1 10 80       	push   $0x8010b184
+80104241:	e8 fa 5a 00 00       	call   80109d40 <panic>
+80104246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010424d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104250 <memdiskinit>:
+
+void
+memdiskinit(void)
+{
+    if (_binary_fs_img_start == 0)
+80104250:	b8 8a e0 10 80       	mov    $0x8010e08a,%eax
+80104255:	85 c0                	test   %eax,%eax
+80104257:	0f 84 83 00 00 00    	je     801042e0 <memdiskinit+0x90>
+{
+8010425d:	55                   	push   %ebp
+8010425e:	89 e5                	mov    %esp,%ebp
+80104260:	83 ec 0c             	sub    $0xc,%esp
+        return;
+    memdisk = _binary_fs_img_start;
+80104263:	a3 04 3c 1b 80       	mov    %eax,0x801b3c04
+    nblock = (uint)_binary_fs_img_size / BSIZE;
+80104268:	b8 00 d0 07 00       	mov    $0x7d000,%eax
+8010426d:	c1 e8 09             	shr    $0x9,%eax
+80104270:	a3 00 3c 1b 80       	mov    %eax,0x801b3c00
+    // in arrival order: with no seeks, sorting buys nothing
+    blkqinit(&memq, "memdisk", &fifosched, MEMRUN, 1, memdiskstart, 0);
+80104275:	6a 00                	push   $0x0
+80104277:	68 b0 41 10 80       	push   $0x801041b0
+8010427c:	6a 01                	push   $0x1
+8010427e:	6a 10                	push   $0x10
+80104280:	68 14 c0 10 80       	push   $0x8010c014
+80104285:	68 a5 b1 10 80       	push   $0x8010b1a5
+8010428a:	68 40 3b 1b 80       	push   $0x801b3b40
+8010428f:	e8 4c e1 ff ff       	call   801023e0 <blkqinit>
+    memdev.name = "memdisk";
+    memdev.nq = 1;
+    memdev.qs = &memq;
+    blkregister(ROOTDEV, &memdev);
+80104294:	83 c4 18             	add    $0x18,%esp
+    memdev.name = "memdisk";
+80104297:	c7 05 00 3b 1b 80 a5 	movl   $0x8010b1a5,0x801b3b00
+8010429e:	b1 10 80 
+    memdev.nq = 1;
+801042a1:	c7 05 04 3b 1b 80 01 	movl   $0x1,0x801b3b04
+801042a8:	00 00 00 
+    memdev.qs = &memq;
+801042ab:	c7 05 08 3b 1b 80 40 	movl   $0x801b3b40,0x801b3b08
+801042b2:	3b 1b 80 
+    blkregister(ROOTDEV, &memdev);
+801042b5:	68 00 3b 1b 80       	push   $0x801b3b00
+801042ba:	6a 01                	push   $0x1
+801042bc:	e8 8f e1 ff ff       	call   80102450 <blkregister>
+    cprintf("memdisk: dev %d, %d blocks\n", ROOTDEV, nblock);
+801042c1:	83 c4 0c             	add    $0xc,%esp
+801042c4:	ff 35 00 3c 1b 80    	push   0x801b3c00
+801042ca:	6a 01                	push   $0x1
+801042cc:	68 ad b1 10 80       	push   $0x8010b1ad
+801042d1:	e8 ea 5a 00 00       	call   80109dc0 <cprintf>
+801042d6:	83 c4 10             	add    $0x10,%esp
+}
+801042d9:	c9                   	leave
+801042da:	c3                   	ret
+801042db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801042df:	90                   	nop
+801042e0:	c3                   	ret
+801042e1:	66 90                	xchg   %ax,%ax
+801042e3:	66 90                	xchg   %ax,%ax
+801042e5:	66 90                	xchg   %ax,%ax
+801042e7:	66 90                	xchg   %ax,%ax
+801042e9:	66 90                	xchg   %ax,%ax
+801042eb:	66 90                	xchg   %ax,%ax
+801042ed:	66 90                	xchg   %ax,%ax
+801042ef:	90                   	nop
+
+801042f0 <fifoadd>:
+           (b->flags & B_DIRTY) == (a->flags & B_DIRTY);
+}
+
+static void
+fifoadd(struct ioqueue *q, struct buf *b)
+{
+801042f0:	55                   	push   %ebp
+801042f1:	89 e5                	mov    %esp,%ebp
+801042f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+801042f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    b->qnext = 0;
+801042f9:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+80104300:	00 00 00 
+    b->qprev = q->tail;
+80104303:	8b 51 0c             	mov    0xc(%ecx),%edx
+80104306:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+    if (q->tail)
+8010430c:	85 d2                	test   %edx,%edx
+8010430e:	74 10                	je     80104320 <fifoadd+0x30>
+        q->tail->qnext = b;
+80104310:	89 82 90 00 00 00    	mov    %eax,0x90(%edx)
+    else
+        q->head = b;
+    q->tail = b;
+80104316:	89 41 0c             	mov    %eax,0xc(%ecx)
+}
+80104319:	5d                   	pop    %ebp
+8010431a:	c3                   	ret
+8010431b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010431f:	90                   	nop
+        q->head = b;
+80104320:	89 41 08             	mov    %eax,0x8(%ecx)
+    q->tail = b;
+80104323:	89 41 0c             	mov    %eax,0xc(%ecx)
+}
+80104326:	5d                   	pop    %ebp
+80104327:	c3                   	ret
+80104328:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010432f:	90                   	nop
+
+80104330 <deadlineadd>:
+    return fwd[0];
+}
+
+static void
+deadlineadd(struct ioqueue *q, struct buf *b)
+{
+80104330:	55                   	push   %ebp
+80104331:	89 e5                	mov    %esp,%ebp
+80104333:	57                   	push   %edi
+80104334:	56                   	push   %esi
+80104335:	53                   	push   %ebx
+80104336:	83 ec 20             	sub    $0x20,%esp
+80104339:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    b->qdeadline = ticks + ((b->flags & B_DIRTY) ? IOWRITEEXPIRE : IOREADEXPIRE);
+8010433c:	8b 0d 20 c0 1c 80    	mov    0x801cc020,%ecx
+{
+80104342:	8b 45 08             	mov    0x8(%ebp),%eax
+    b->qnext = 0;
+80104345:	c7 87 90 00 00 00 00 	movl   $0x0,0x90(%edi)
+8010434c:	00 00 00 
+    b->qdeadline = ticks + ((b->flags & B_DIRTY) ? IOWRITEEXPIRE : IOREADEXPIRE);
+8010434f:	8b 17                	mov    (%edi),%edx
+80104351:	83 e2 04             	and    $0x4,%edx
+80104354:	83 fa 01             	cmp    $0x1,%edx
+80104357:	19 d2                	sbb    %edx,%edx
+80104359:	81 e2 3e fe ff ff    	and    $0xfffffe3e,%edx
+8010435f:	8d 94 0a f4 01 00 00 	lea    0x1f4(%edx,%ecx,1),%edx
+80104366:	89 97 b8 00 00 00    	mov    %edx,0xb8(%edi)
+    b->qprev = q->tail;
+8010436c:	8b 50 0c             	mov    0xc(%eax),%edx
+8010436f:	89 97 94 00 00 00    	mov    %edx,0x94(%edi)
+    if (q->tail)
+80104375:	85 d2                	test   %edx,%edx
+80104377:	0f 84 d9 00 00 00    	je     80104456 <deadlineadd+0x126>
+        q->tail->qnext = b;
+8010437d:	89 ba 90 00 00 00    	mov    %edi,0x90(%edx)
+    q->tail = b;
+80104383:	89 78 0c             	mov    %edi,0xc(%eax)
+    fwd = q->sorted;
+80104386:	8d 48 10             	lea    0x10(%eax),%ecx
+80104389:	be 1c 00 00 00       	mov    $0x1c,%esi
+8010438e:	89 45 08             	mov    %eax,0x8(%ebp)
+80104391:	89 7d 0c             	mov    %edi,0xc(%ebp)
+80104394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        while (fwd[i] && sortbefore(fwd[i], b))
+80104398:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+8010439b:	8b 02                	mov    (%edx),%eax
+8010439d:	85 c0                	test   %eax,%eax
+8010439f:	74 3d                	je     801043de <deadlineadd+0xae>
+    if (a->dev != b->dev)
+801043a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801043a4:	8b 7f 04             	mov    0x4(%edi),%edi
+801043a7:	eb 18                	jmp    801043c1 <deadlineadd+0x91>
+801043a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        while (fwd[i] && sortbefore(fwd[i], b))
+801043b0:	73 2c                	jae    801043de <deadlineadd+0xae>
+            fwd = fwd[i]->qsorted;
+801043b2:	8d 88 98 00 00 00    	lea    0x98(%eax),%ecx
+        while (fwd[i] && sortbefore(fwd[i], b))
+801043b8:	8d 14 31             	lea    (%ecx,%esi,1),%edx
+801043bb:	8b 02                	mov    (%edx),%eax
+801043bd:	85 c0                	test   %eax,%eax
+801043bf:	74 1d                	je     801043de <deadlineadd+0xae>
+    if (a->dev != b->dev)
+801043c1:	39 78 04             	cmp    %edi,0x4(%eax)
+801043c4:	75 ea                	jne    801043b0 <deadlineadd+0x80>
+    if (a->blockno != b->blockno)
+801043c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+801043c9:	8b 5b 08             	mov    0x8(%ebx),%ebx
+801043cc:	39 58 08             	cmp    %ebx,0x8(%eax)
+801043cf:	75 03                	jne    801043d4 <deadlineadd+0xa4>
+    return (uint)a < (uint)b;
+801043d1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+801043d4:	0f 92 c3             	setb   %bl
+801043d7:	0f b6 db             	movzbl %bl,%ebx
+        while (fwd[i] && sortbefore(fwd[i], b))
+801043da:	85 db                	test   %ebx,%ebx
+801043dc:	75 d4                	jne    801043b2 <deadlineadd+0x82>
+        update[i] = &fwd[i];
+801043de:	89 54 35 d4          	mov    %edx,-0x2c(%ebp,%esi,1)
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+801043e2:	83 ee 04             	sub    $0x4,%esi
+801043e5:	83 fe fc             	cmp    $0xfffffffc,%esi
+801043e8:	75 ae                	jne    80104398 <deadlineadd+0x68>
+    uint x = q->seed;
+801043ea:	8b 45 08             	mov    0x8(%ebp),%eax
+801043ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801043f0:	8b 50 38             	mov    0x38(%eax),%edx
+    x ^= x << 13;
+801043f3:	89 d1                	mov    %edx,%ecx
+801043f5:	c1 e1 0d             	shl    $0xd,%ecx
+801043f8:	31 ca                	xor    %ecx,%edx
+    x ^= x >> 17;
+801043fa:	89 d1                	mov    %edx,%ecx
+801043fc:	c1 e9 11             	shr    $0x11,%ecx
+801043ff:	31 ca                	xor    %ecx,%edx
+    x ^= x << 5;
+80104401:	89 d1                	mov    %edx,%ecx
+80104403:	c1 e1 05             	shl    $0x5,%ecx
+80104406:	31 ca                	xor    %ecx,%edx
+    q->seed = x;
+80104408:	89 50 38             	mov    %edx,0x38(%eax)
+    for (lvl = 1; lvl < NQLEVEL && (x & 1); lvl++)
+8010440b:	f6 c2 01             	test   $0x1,%dl
+8010440e:	74 4e                	je     8010445e <deadlineadd+0x12e>
+80104410:	b9 01 00 00 00       	mov    $0x1,%ecx
+80104415:	eb 0e                	jmp    80104425 <deadlineadd+0xf5>
+80104417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010441e:	66 90                	xchg   %ax,%ax
+80104420:	f6 c2 01             	test   $0x1,%dl
+80104423:	74 0a                	je     8010442f <deadlineadd+0xff>
+80104425:	83 c1 01             	add    $0x1,%ecx
+        x >>= 1;
+80104428:	d1 ea                	shr    %edx
+    for (lvl = 1; lvl < NQLEVEL && (x & 1); lvl++)
+8010442a:	83 f9 08             	cmp    $0x8,%ecx
+8010442d:	75 f1                	jne    80104420 <deadlineadd+0xf0>
+    for (i = 0; i < lvl; i++) {
+8010442f:	31 c0                	xor    %eax,%eax
+80104431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        b->qsorted[i] = *update[i];
+80104438:	8b 54 85 d4          	mov    -0x2c(%ebp,%eax,4),%edx
+8010443c:	8b 1a                	mov    (%edx),%ebx
+8010443e:	89 9c 87 98 00 00 00 	mov    %ebx,0x98(%edi,%eax,4)
+    for (i = 0; i < lvl; i++) {
+80104445:	83 c0 01             	add    $0x1,%eax
+        *update[i] = b;
+80104448:	89 3a                	mov    %edi,(%edx)
+    for (i = 0; i < lvl; i++) {
+8010444a:	39 c8                	cmp    %ecx,%eax
+8010444c:	75 ea                	jne    80104438 <deadlineadd+0x108>
+    fifoadd(q, b);
+    sortadd(q, b);
+}
+8010444e:	83 c4 20             	add    $0x20,%esp
+80104451:	5b                   	pop    %ebx
+80104452:	5e                   	pop    %esi
+80104453:	5f                   	pop    %edi
+80104454:	5d                   	pop    %ebp
+80104455:	c3                   	ret
+        q->head = b;
+80104456:	89 78 08             	mov    %edi,0x8(%eax)
+80104459:	e9 25 ff ff ff       	jmp    80104383 <deadlineadd+0x53>
+        b->qsorted[i] = *update[i];
+8010445e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104461:	8b 10                	mov    (%eax),%edx
+80104463:	89 97 98 00 00 00    	mov    %edx,0x98(%edi)
+        *update[i] = b;
+80104469:	89 38                	mov    %edi,(%eax)
+    for (i = 0; i < lvl; i++) {
+8010446b:	eb e1                	jmp    8010444e <deadlineadd+0x11e>
+8010446d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104470 <deadlinetake>:
+
+static struct buf*
+deadlinetake(struct ioqueue *q, int max)
+{
+80104470:	55                   	push   %ebp
+80104471:	89 e5                	mov    %esp,%ebp
+80104473:	57                   	push   %edi
+80104474:	56                   	push   %esi
+80104475:	53                   	push   %ebx
+80104476:	83 ec 14             	sub    $0x14,%esp
+80104479:	8b 55 08             	mov    0x8(%ebp),%edx
+    struct buf *b, *x, *next;
+    int n;
+
+    if ((b = q->head) == 0)
+8010447c:	8b 5a 08             	mov    0x8(%edx),%ebx
+8010447f:	85 db                	test   %ebx,%ebx
+80104481:	0f 84 ef 00 00 00    	je     80104576 <deadlinetake+0x106>
+    fwd = q->sorted;
+80104487:	8d 42 10             	lea    0x10(%edx),%eax
+8010448a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        return 0;
+    // the oldest request if it's late, else on with the sweep
+    if ((int)(ticks - b->qdeadline) < 0 && (b = sortfind(q)) == 0)
+8010448d:	8b 83 b8 00 00 00    	mov    0xb8(%ebx),%eax
+80104493:	39 05 20 c0 1c 80    	cmp    %eax,0x801cc020
+80104499:	0f 88 39 01 00 00    	js     801045d8 <deadlinetake+0x168>
+        b = q->sorted[0];
+
+    for (n = 1, x = b; ; n++) {
+8010449f:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+801044a2:	89 df                	mov    %ebx,%edi
+801044a4:	be 01 00 00 00       	mov    $0x1,%esi
+801044a9:	89 55 08             	mov    %edx,0x8(%ebp)
+801044ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        next = x->qsorted[0];
+801044b0:	8b 87 98 00 00 00    	mov    0x98(%edi),%eax
+    fwd = q->sorted;
+801044b6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801044b9:	89 75 ec             	mov    %esi,-0x14(%ebp)
+        next = x->qsorted[0];
+801044bc:	bb 1c 00 00 00       	mov    $0x1c,%ebx
+801044c1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+801044c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        while (fwd[i] && sortbefore(fwd[i], b))
+801044c8:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+801044cb:	8b 02                	mov    (%edx),%eax
+801044cd:	85 c0                	test   %eax,%eax
+801044cf:	74 36                	je     80104507 <deadlinetake+0x97>
+    if (a->dev != b->dev)
+801044d1:	8b 77 04             	mov    0x4(%edi),%esi
+801044d4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+801044d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801044de:	66 90                	xchg   %ax,%ax
+801044e0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+801044e3:	39 70 04             	cmp    %esi,0x4(%eax)
+801044e6:	75 0a                	jne    801044f2 <deadlinetake+0x82>
+    if (a->blockno != b->blockno)
+801044e8:	8b 77 08             	mov    0x8(%edi),%esi
+801044eb:	39 70 08             	cmp    %esi,0x8(%eax)
+801044ee:	75 02                	jne    801044f2 <deadlinetake+0x82>
+        while (fwd[i] && sortbefore(fwd[i], b))
+801044f0:	39 f8                	cmp    %edi,%eax
+801044f2:	0f 83 88 00 00 00    	jae    80104580 <deadlinetake+0x110>
+            fwd = fwd[i]->qsorted;
+801044f8:	8d 88 98 00 00 00    	lea    0x98(%eax),%ecx
+        while (fwd[i] && sortbefore(fwd[i], b))
+801044fe:	8d 14 19             	lea    (%ecx,%ebx,1),%edx
+80104501:	8b 02                	mov    (%edx),%eax
+80104503:	85 c0                	test   %eax,%eax
+80104505:	75 d9                	jne    801044e0 <deadlinetake+0x70>
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+80104507:	83 eb 04             	sub    $0x4,%ebx
+8010450a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+8010450d:	75 b9                	jne    801044c8 <deadlinetake+0x58>
+    if (b->qprev)
+8010450f:	8b 8f 94 00 00 00    	mov    0x94(%edi),%ecx
+80104515:	8b 75 ec             	mov    -0x14(%ebp),%esi
+80104518:	8b 45 e8             	mov    -0x18(%ebp),%eax
+        b->qprev->qnext = b->qnext;
+8010451b:	8b 9f 90 00 00 00    	mov    0x90(%edi),%ebx
+    if (b->qprev)
+80104521:	85 c9                	test   %ecx,%ecx
+80104523:	0f 84 a4 00 00 00    	je     801045cd <deadlinetake+0x15d>
+        b->qprev->qnext = b->qnext;
+80104529:	89 99 90 00 00 00    	mov    %ebx,0x90(%ecx)
+    if (b->qnext)
+8010452f:	8b 8f 90 00 00 00    	mov    0x90(%edi),%ecx
+        b->qnext->qprev = b->qprev;
+80104535:	8b 9f 94 00 00 00    	mov    0x94(%edi),%ebx
+    if (b->qnext)
+8010453b:	85 c9                	test   %ecx,%ecx
+8010453d:	0f 84 7f 00 00 00    	je     801045c2 <deadlinetake+0x152>
+        b->qnext->qprev = b->qprev;
+80104543:	89 99 94 00 00 00    	mov    %ebx,0x94(%ecx)
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+80104549:	8b 4f 04             	mov    0x4(%edi),%ecx
+        sortdel(q, x);
+        fifodel(q, x);
+        if (n == max || next == 0 || !ioqadjacent(x, next))
+8010454c:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010454f:	74 09                	je     8010455a <deadlinetake+0xea>
+80104551:	85 c0                	test   %eax,%eax
+80104553:	74 05                	je     8010455a <deadlinetake+0xea>
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+80104555:	39 48 04             	cmp    %ecx,0x4(%eax)
+80104558:	74 44                	je     8010459e <deadlinetake+0x12e>
+            break;
+        x->qnext = next;
+        x = next;
+    }
+    x->qnext = 0;
+8010455a:	8b 55 08             	mov    0x8(%ebp),%edx
+8010455d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80104560:	c7 87 90 00 00 00 00 	movl   $0x0,0x90(%edi)
+80104567:	00 00 00 
+    q->posdev = x->dev;
+8010456a:	89 4a 30             	mov    %ecx,0x30(%edx)
+    q->posblock = x->blockno + 1;
+8010456d:	8b 47 08             	mov    0x8(%edi),%eax
+80104570:	83 c0 01             	add    $0x1,%eax
+80104573:	89 42 34             	mov    %eax,0x34(%edx)
+    return b;
+}
+80104576:	83 c4 14             	add    $0x14,%esp
+80104579:	89 d8                	mov    %ebx,%eax
+8010457b:	5b                   	pop    %ebx
+8010457c:	5e                   	pop    %esi
+8010457d:	5f                   	pop    %edi
+8010457e:	5d                   	pop    %ebp
+8010457f:	c3                   	ret
+        if (fwd[i] == b)
+80104580:	39 c7                	cmp    %eax,%edi
+80104582:	75 83                	jne    80104507 <deadlinetake+0x97>
+            fwd[i] = b->qsorted[i];
+80104584:	8b 84 1f 98 00 00 00 	mov    0x98(%edi,%ebx,1),%eax
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+8010458b:	83 eb 04             	sub    $0x4,%ebx
+            fwd[i] = b->qsorted[i];
+8010458e:	89 02                	mov    %eax,(%edx)
+    for (i = NQLEVEL - 1; i >= 0; i--) {
+80104590:	83 fb fc             	cmp    $0xfffffffc,%ebx
+80104593:	0f 85 2f ff ff ff    	jne    801044c8 <deadlinetake+0x58>
+80104599:	e9 71 ff ff ff       	jmp    8010450f <deadlinetake+0x9f>
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+8010459e:	8b 5f 08             	mov    0x8(%edi),%ebx
+801045a1:	83 c3 01             	add    $0x1,%ebx
+801045a4:	39 58 08             	cmp    %ebx,0x8(%eax)
+801045a7:	75 b1                	jne    8010455a <deadlinetake+0xea>
+           (b->flags & B_DIRTY) == (a->flags & B_DIRTY);
+801045a9:	8b 18                	mov    (%eax),%ebx
+801045ab:	33 1f                	xor    (%edi),%ebx
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+801045ad:	83 e3 04             	and    $0x4,%ebx
+801045b0:	75 a8                	jne    8010455a <deadlinetake+0xea>
+        x->qnext = next;
+801045b2:	89 87 90 00 00 00    	mov    %eax,0x90(%edi)
+    for (n = 1, x = b; ; n++) {
+801045b8:	83 c6 01             	add    $0x1,%esi
+        next = x->qsorted[0];
+801045bb:	89 c7                	mov    %eax,%edi
+801045bd:	e9 ee fe ff ff       	jmp    801044b0 <deadlinetake+0x40>
+        q->tail = b->qprev;
+801045c2:	8b 55 08             	mov    0x8(%ebp),%edx
+801045c5:	89 5a 0c             	mov    %ebx,0xc(%edx)
+801045c8:	e9 7c ff ff ff       	jmp    80104549 <deadlinetake+0xd9>
+        q->head = b->qnext;
+801045cd:	8b 55 08             	mov    0x8(%ebp),%edx
+801045d0:	89 5a 08             	mov    %ebx,0x8(%edx)
+801045d3:	e9 57 ff ff ff       	jmp    8010452f <deadlinetake+0xbf>
+    fwd = q->sorted;
+801045d8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801045db:	b9 1c 00 00 00       	mov    $0x1c,%ecx
+        while (fwd[i] && (fwd[i]->dev < q->posdev ||
+801045e0:	8b 04 0b             	mov    (%ebx,%ecx,1),%eax
+801045e3:	85 c0                	test   %eax,%eax
+801045e5:	74 29                	je     80104610 <deadlinetake+0x1a0>
+801045e7:	8b 72 30             	mov    0x30(%edx),%esi
+801045ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801045f0:	39 70 04             	cmp    %esi,0x4(%eax)
+801045f3:	72 0a                	jb     801045ff <deadlinetake+0x18f>
+801045f5:	75 19                	jne    80104610 <deadlinetake+0x1a0>
+                          (fwd[i]->dev == q->posdev && fwd[i]->blockno < q->posblock)))
+801045f7:	8b 7a 34             	mov    0x34(%edx),%edi
+801045fa:	39 78 08             	cmp    %edi,0x8(%eax)
+801045fd:	73 11                	jae    80104610 <deadlinetake+0x1a0>
+            fwd = fwd[i]->qsorted;
+801045ff:	8d 98 98 00 00 00    	lea    0x98(%eax),%ebx
+        while (fwd[i] && (fwd[i]->dev < q->posdev ||
+80104605:	8b 84 08 98 00 00 00 	mov    0x98(%eax,%ecx,1),%eax
+8010460c:	85 c0                	test   %eax,%eax
+8010460e:	75 e0                	jne    801045f0 <deadlinetake+0x180>
+    for (i = NQLEVEL - 1; i >= 0; i--)
+80104610:	83 e9 04             	sub    $0x4,%ecx
+80104613:	83 f9 fc             	cmp    $0xfffffffc,%ecx
+80104616:	75 c8                	jne    801045e0 <deadlinetake+0x170>
+    return fwd[0];
+80104618:	8b 1b                	mov    (%ebx),%ebx
+    if ((int)(ticks - b->qdeadline) < 0 && (b = sortfind(q)) == 0)
+8010461a:	85 db                	test   %ebx,%ebx
+8010461c:	0f 85 7d fe ff ff    	jne    8010449f <deadlinetake+0x2f>
+        b = q->sorted[0];
+80104622:	8b 5a 10             	mov    0x10(%edx),%ebx
+80104625:	e9 75 fe ff ff       	jmp    8010449f <deadlinetake+0x2f>
+8010462a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104630 <fifotake>:
+{
+80104630:	55                   	push   %ebp
+80104631:	89 e5                	mov    %esp,%ebp
+80104633:	57                   	push   %edi
+80104634:	56                   	push   %esi
+80104635:	53                   	push   %ebx
+    if ((b = q->head) == 0)
+80104636:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80104639:	8b 75 0c             	mov    0xc(%ebp),%esi
+    if ((b = q->head) == 0)
+8010463c:	8b 78 08             	mov    0x8(%eax),%edi
+8010463f:	85 ff                	test   %edi,%edi
+80104641:	74 43                	je     80104686 <fifotake+0x56>
+    q->head = x->qnext;
+80104643:	8b 97 90 00 00 00    	mov    0x90(%edi),%edx
+    for (n = 1, x = b; n < max && x->qnext && ioqadjacent(x, x->qnext); n++)
+80104649:	89 f8                	mov    %edi,%eax
+8010464b:	83 fe 01             	cmp    $0x1,%esi
+8010464e:	7e 61                	jle    801046b1 <fifotake+0x81>
+80104650:	ba 01 00 00 00       	mov    $0x1,%edx
+80104655:	8d 76 00             	lea    0x0(%esi),%esi
+80104658:	89 c1                	mov    %eax,%ecx
+8010465a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80104660:	85 c0                	test   %eax,%eax
+80104662:	74 64                	je     801046c8 <fifotake+0x98>
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+80104664:	8b 59 04             	mov    0x4(%ecx),%ebx
+80104667:	39 58 04             	cmp    %ebx,0x4(%eax)
+8010466a:	74 24                	je     80104690 <fifotake+0x60>
+    q->head = x->qnext;
+8010466c:	8b 75 08             	mov    0x8(%ebp),%esi
+8010466f:	89 46 08             	mov    %eax,0x8(%esi)
+        q->head->qprev = 0;
+80104672:	c7 80 94 00 00 00 00 	movl   $0x0,0x94(%eax)
+80104679:	00 00 00 
+    x->qnext = 0;
+8010467c:	c7 81 90 00 00 00 00 	movl   $0x0,0x90(%ecx)
+80104683:	00 00 00 
+}
+80104686:	5b                   	pop    %ebx
+80104687:	89 f8                	mov    %edi,%eax
+80104689:	5e                   	pop    %esi
+8010468a:	5f                   	pop    %edi
+8010468b:	5d                   	pop    %ebp
+8010468c:	c3                   	ret
+8010468d:	8d 76 00             	lea    0x0(%esi),%esi
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+80104690:	8b 59 08             	mov    0x8(%ecx),%ebx
+80104693:	83 c3 01             	add    $0x1,%ebx
+80104696:	39 58 08             	cmp    %ebx,0x8(%eax)
+80104699:	75 d1                	jne    8010466c <fifotake+0x3c>
+           (b->flags & B_DIRTY) == (a->flags & B_DIRTY);
+8010469b:	8b 18                	mov    (%eax),%ebx
+8010469d:	33 19                	xor    (%ecx),%ebx
+    return b->dev == a->dev && b->blockno == a->blockno + 1 &&
+8010469f:	83 e3 04             	and    $0x4,%ebx
+801046a2:	75 c8                	jne    8010466c <fifotake+0x3c>
+    for (n = 1, x = b; n < max && x->qnext && ioqadjacent(x, x->qnext); n++)
+801046a4:	83 c2 01             	add    $0x1,%edx
+801046a7:	39 d6                	cmp    %edx,%esi
+801046a9:	75 ad                	jne    80104658 <fifotake+0x28>
+    q->head = x->qnext;
+801046ab:	8b 90 90 00 00 00    	mov    0x90(%eax),%edx
+801046b1:	8b 75 08             	mov    0x8(%ebp),%esi
+801046b4:	89 c1                	mov    %eax,%ecx
+801046b6:	89 56 08             	mov    %edx,0x8(%esi)
+    if (q->head)
+801046b9:	85 d2                	test   %edx,%edx
+801046bb:	74 15                	je     801046d2 <fifotake+0xa2>
+801046bd:	89 d0                	mov    %edx,%eax
+801046bf:	eb b1                	jmp    80104672 <fifotake+0x42>
+801046c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    q->head = x->qnext;
+801046c8:	8b 45 08             	mov    0x8(%ebp),%eax
+801046cb:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+        q->tail = 0;
+801046d2:	8b 45 08             	mov    0x8(%ebp),%eax
+801046d5:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+801046dc:	eb 9e                	jmp    8010467c <fifotake+0x4c>
+801046de:	66 90                	xchg   %ax,%ax
+
+801046e0 <ioqinit>:
+{
+801046e0:	55                   	push   %ebp
+801046e1:	89 e5                	mov    %esp,%ebp
+801046e3:	53                   	push   %ebx
+801046e4:	83 ec 08             	sub    $0x8,%esp
+801046e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    memset(q, 0, sizeof(*q));
+801046ea:	6a 3c                	push   $0x3c
+801046ec:	6a 00                	push   $0x0
+801046ee:	53                   	push   %ebx
+801046ef:	e8 4c b9 ff ff       	call   80100040 <memset>
+    q->sched = sched;
+801046f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    q->seed = 2463534242;
+801046f7:	c7 43 38 a2 8c d6 92 	movl   $0x92d68ca2,0x38(%ebx)
+}
+801046fe:	83 c4 10             	add    $0x10,%esp
+    q->sched = sched;
+80104701:	89 03                	mov    %eax,(%ebx)
+}
+80104703:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104706:	c9                   	leave
+80104707:	c3                   	ret
+80104708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010470f:	90                   	nop
+
+80104710 <ioqadd>:
+{
+80104710:	55                   	push   %ebp
+80104711:	89 e5                	mov    %esp,%ebp
+80104713:	53                   	push   %ebx
+80104714:	83 ec 0c             	sub    $0xc,%esp
+80104717:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    q->sched->add(q, b);
+8010471a:	8b 03                	mov    (%ebx),%eax
+8010471c:	ff 75 0c             	push   0xc(%ebp)
+8010471f:	53                   	push   %ebx
+80104720:	ff 50 04             	call   *0x4(%eax)
+    q->n++;
+80104723:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+80104727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010472a:	83 c4 10             	add    $0x10,%esp
+8010472d:	c9                   	leave
+8010472e:	c3                   	ret
+8010472f:	90                   	nop
+
+80104730 <ioqtake>:
+{
+80104730:	55                   	push   %ebp
+80104731:	89 e5                	mov    %esp,%ebp
+80104733:	53                   	push   %ebx
+80104734:	83 ec 0c             	sub    $0xc,%esp
+80104737:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if ((b = q->sched->take(q, max)) != 0)
+8010473a:	8b 03                	mov    (%ebx),%eax
+8010473c:	ff 75 0c             	push   0xc(%ebp)
+8010473f:	53                   	push   %ebx
+80104740:	ff 50 08             	call   *0x8(%eax)
+80104743:	83 c4 10             	add    $0x10,%esp
+80104746:	85 c0                	test   %eax,%eax
+80104748:	74 1e                	je     80104768 <ioqtake+0x38>
+        for (x = b; x; x = x->qnext)
+8010474a:	8b 53 04             	mov    0x4(%ebx),%edx
+            q->n--;
+8010474d:	89 c1                	mov    %eax,%ecx
+8010474f:	83 ea 01             	sub    $0x1,%edx
+80104752:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104758:	89 53 04             	mov    %edx,0x4(%ebx)
+        for (x = b; x; x = x->qnext)
+8010475b:	8b 89 90 00 00 00    	mov    0x90(%ecx),%ecx
+80104761:	83 ea 01             	sub    $0x1,%edx
+80104764:	85 c9                	test   %ecx,%ecx
+80104766:	75 f0                	jne    80104758 <ioqtake+0x28>
+}
+80104768:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010476b:	c9                   	leave
+8010476c:	c3                   	ret
+8010476d:	66 90                	xchg   %ax,%ax
+8010476f:	90                   	nop
+
+80104770 <blookup>:
+}
+
+// look for block blockno on dev in its bucket, taking a reference if found
+static struct buf*
+blookup(struct bucket *bk, uint dev, uint blockno)
+{
+80104770:	55                   	push   %ebp
+80104771:	89 e5                	mov    %esp,%ebp
+80104773:	57                   	push   %edi
+80104774:	89 c7                	mov    %eax,%edi
+80104776:	56                   	push   %esi
+80104777:	89 d6                	mov    %edx,%esi
+80104779:	53                   	push   %ebx
+8010477a:	83 ec 28             	sub    $0x28,%esp
+8010477d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    struct buf *b;
+
+    acquire(&bk->lock);
+80104780:	50                   	push   %eax
+80104781:	e8 2a cd ff ff       	call   801014b0 <acquire>
+    for (b = bk->head; b; b = b->hnext) {
+80104786:	8b 5f 44             	mov    0x44(%edi),%ebx
+80104789:	83 c4 10             	add    $0x10,%esp
+8010478c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010478f:	85 db                	test   %ebx,%ebx
+80104791:	75 0f                	jne    801047a2 <blookup+0x32>
+80104793:	eb 43                	jmp    801047d8 <blookup+0x68>
+80104795:	8d 76 00             	lea    0x0(%esi),%esi
+80104798:	8b 9b 8c 00 00 00    	mov    0x8c(%ebx),%ebx
+8010479e:	85 db                	test   %ebx,%ebx
+801047a0:	74 36                	je     801047d8 <blookup+0x68>
+        if (b->dev == dev && b->blockno == blockno && bgetref(b)) {
+801047a2:	39 73 04             	cmp    %esi,0x4(%ebx)
+801047a5:	75 f1                	jne    80104798 <blookup+0x28>
+801047a7:	39 53 08             	cmp    %edx,0x8(%ebx)
+801047aa:	75 ec                	jne    80104798 <blookup+0x28>
+        if ((r = b->refcnt) & BRECYCLE)
+801047ac:	8b 43 74             	mov    0x74(%ebx),%eax
+801047af:	85 c0                	test   %eax,%eax
+801047b1:	78 e5                	js     80104798 <blookup+0x28>
+    } while (!__sync_bool_compare_and_swap(&b->refcnt, r, r + 1));
+801047b3:	8d 48 01             	lea    0x1(%eax),%ecx
+801047b6:	f0 0f b1 4b 74       	lock cmpxchg %ecx,0x74(%ebx)
+801047bb:	75 ef                	jne    801047ac <blookup+0x3c>
+            release(&bk->lock);
+801047bd:	83 ec 0c             	sub    $0xc,%esp
+801047c0:	57                   	push   %edi
+801047c1:	e8 0a cb ff ff       	call   801012d0 <release>
+            return b;
+801047c6:	83 c4 10             	add    $0x10,%esp
+        }
+    }
+    release(&bk->lock);
+    return 0;
+}
+801047c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801047cc:	89 d8                	mov    %ebx,%eax
+801047ce:	5b                   	pop    %ebx
+801047cf:	5e                   	pop    %esi
+801047d0:	5f                   	pop    %edi
+801047d1:	5d                   	pop    %ebp
+801047d2:	c3                   	ret
+801047d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801047d7:	90                   	nop
+    release(&bk->lock);
+801047d8:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+801047db:	31 db                	xor    %ebx,%ebx
+    release(&bk->lock);
+801047dd:	57                   	push   %edi
+801047de:	e8 ed ca ff ff       	call   801012d0 <release>
+    return 0;
+801047e3:	83 c4 10             	add    $0x10,%esp
+}
+801047e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801047e9:	89 d8                	mov    %ebx,%eax
+801047eb:	5b                   	pop    %ebx
+801047ec:	5e                   	pop    %esi
+801047ed:	5f                   	pop    %edi
+801047ee:	5d                   	pop    %ebp
+801047ef:	c3                   	ret
+
+801047f0 <bdoneahead>:
+}
+
+// disk request done callback for breadahead()
+static void
+bdoneahead(struct buf *b)
+{
+801047f0:	55                   	push   %ebp
+801047f1:	89 e5                	mov    %esp,%ebp
+801047f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    __sync_sub_and_fetch(&b->refcnt, 1);
+801047f6:	f0 83 68 74 01       	lock subl $0x1,0x74(%eax)
+}
+801047fb:	5d                   	pop    %ebp
+801047fc:	c3                   	ret
+801047fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104800 <bgrow>:
+{
+80104800:	55                   	push   %ebp
+80104801:	89 e5                	mov    %esp,%ebp
+80104803:	57                   	push   %edi
+80104804:	56                   	push   %esi
+80104805:	53                   	push   %ebx
+80104806:	83 ec 1c             	sub    $0x1c,%esp
+    if (bcache.spare == 0) {
+80104809:	a1 4c 41 1b 80       	mov    0x801b414c,%eax
+8010480e:	85 c0                	test   %eax,%eax
+80104810:	0f 84 fa 00 00 00    	je     80104910 <bgrow+0x110>
+    if ((data = kalloc()) == 0)
+80104816:	e8 25 39 00 00       	call   80108140 <kalloc>
+8010481b:	89 c7                	mov    %eax,%edi
+8010481d:	85 c0                	test   %eax,%eax
+8010481f:	0f 84 6c 01 00 00    	je     80104991 <bgrow+0x191>
+    g = bcache.spare;
+80104825:	8b 1d 4c 41 1b 80    	mov    0x801b414c,%ebx
+    bcache.spare = g->next;
+8010482b:	8b 93 00 08 00 00    	mov    0x800(%ebx),%edx
+80104831:	89 15 4c 41 1b 80    	mov    %edx,0x801b414c
+    for (b = g->buf; b < g->buf + BPP; b++) {
+80104837:	8d 93 00 08 00 00    	lea    0x800(%ebx),%edx
+8010483d:	39 d3                	cmp    %edx,%ebx
+8010483f:	0f 83 a6 00 00 00    	jae    801048eb <bgrow+0xeb>
+80104845:	8d 80 00 10 00 00    	lea    0x1000(%eax),%eax
+8010484b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010484e:	66 90                	xchg   %ax,%ax
+        b->data = (uchar*)data;
+80104850:	89 bb cc 00 00 00    	mov    %edi,0xcc(%ebx)
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104856:	8d 53 e1             	lea    -0x1f(%ebx),%edx
+    acquire(&bk->lock);
+80104859:	83 ec 0c             	sub    $0xc,%esp
+        data += BSIZE;
+8010485c:	81 c7 00 02 00 00    	add    $0x200,%edi
+        b->dev = NODEV;
+80104862:	c7 43 04 ff ff ff ff 	movl   $0xffffffff,0x4(%ebx)
+        b->blockno = (uint)b;   // spreads idle buffers over the buckets
+80104869:	89 5b 08             	mov    %ebx,0x8(%ebx)
+        b->flags = 0;
+8010486c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+        b->refcnt = 0;
+80104872:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104879:	a1 48 3d 1b 80       	mov    0x801b3d48,%eax
+8010487e:	8d 70 ff             	lea    -0x1(%eax),%esi
+80104881:	21 d6                	and    %edx,%esi
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80104883:	89 f2                	mov    %esi,%edx
+80104885:	83 e6 1f             	and    $0x1f,%esi
+80104888:	c1 ea 05             	shr    $0x5,%edx
+8010488b:	c1 e6 07             	shl    $0x7,%esi
+8010488e:	03 34 95 4c 3d 1b 80 	add    -0x7fe4c2b4(,%edx,4),%esi
+    acquire(&bk->lock);
+80104895:	56                   	push   %esi
+80104896:	e8 15 cc ff ff       	call   801014b0 <acquire>
+    b->hnext = bk->head;
+8010489b:	8b 56 44             	mov    0x44(%esi),%edx
+8010489e:	89 93 8c 00 00 00    	mov    %edx,0x8c(%ebx)
+    bk->head = b;
+801048a4:	89 5e 44             	mov    %ebx,0x44(%esi)
+    release(&bk->lock);
+801048a7:	89 34 24             	mov    %esi,(%esp)
+801048aa:	e8 21 ca ff ff       	call   801012d0 <release>
+        b->next = &bcache.list[BQ_PROBATION];
+801048af:	c7 43 7c 80 41 1b 80 	movl   $0x801b4180,0x7c(%ebx)
+    for (b = g->buf; b < g->buf + BPP; b++) {
+801048b6:	83 c4 10             	add    $0x10,%esp
+        b->queue = BQ_PROBATION;
+801048b9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+801048c0:	00 00 00 
+        b->prev = bcache.list[BQ_PROBATION].prev;
+801048c3:	8b 15 f8 41 1b 80    	mov    0x801b41f8,%edx
+801048c9:	89 53 78             	mov    %edx,0x78(%ebx)
+        b->prev->next = b;
+801048cc:	89 5a 7c             	mov    %ebx,0x7c(%edx)
+        b->next->prev = b;
+801048cf:	8b 53 7c             	mov    0x7c(%ebx),%edx
+801048d2:	89 5a 78             	mov    %ebx,0x78(%edx)
+    for (b = g->buf; b < g->buf + BPP; b++) {
+801048d5:	81 c3 00 01 00 00    	add    $0x100,%ebx
+        bcache.nlist[BQ_PROBATION]++;
+801048db:	83 05 80 43 1b 80 01 	addl   $0x1,0x801b4380
+    for (b = g->buf; b < g->buf + BPP; b++) {
+801048e2:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+801048e5:	0f 85 65 ff ff ff    	jne    80104850 <bgrow+0x50>
+    kstatinc(KS_BCACHEGROW);
+801048eb:	83 ec 0c             	sub    $0xc,%esp
+    bcache.nbuf += BPP;
+801048ee:	83 05 40 3d 1b 80 08 	addl   $0x8,0x801b3d40
+    kstatinc(KS_BCACHEGROW);
+801048f5:	6a 06                	push   $0x6
+801048f7:	e8 d4 1b 00 00       	call   801064d0 <kstatinc>
+    return 1;
+801048fc:	83 c4 10             	add    $0x10,%esp
+}
+801048ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 1;
+80104902:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+80104907:	5b                   	pop    %ebx
+80104908:	5e                   	pop    %esi
+80104909:	5f                   	pop    %edi
+8010490a:	5d                   	pop    %ebp
+8010490b:	c3                   	ret
+8010490c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if ((meta = kalloc()) == 0)
+80104910:	e8 2b 38 00 00       	call   80108140 <kalloc>
+80104915:	89 c6                	mov    %eax,%esi
+80104917:	85 c0                	test   %eax,%eax
+80104919:	74 76                	je     80104991 <bgrow+0x191>
+        memset(meta, 0, PGSIZE);
+8010491b:	83 ec 04             	sub    $0x4,%esp
+8010491e:	68 00 10 00 00       	push   $0x1000
+80104923:	6a 00                	push   $0x0
+80104925:	50                   	push   %eax
+80104926:	e8 15 b7 ff ff       	call   80100040 <memset>
+            for (b = g->buf; b < g->buf + BPP; b++) {
+8010492b:	8d 86 00 08 00 00    	lea    0x800(%esi),%eax
+80104931:	83 c4 10             	add    $0x10,%esp
+80104934:	39 c6                	cmp    %eax,%esi
+80104936:	73 39                	jae    80104971 <bgrow+0x171>
+80104938:	8d 5e 0c             	lea    0xc(%esi),%ebx
+8010493b:	8d be 0c 08 00 00    	lea    0x80c(%esi),%edi
+80104941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                initsleeplock(&b->lock, "buffer");
+80104948:	83 ec 08             	sub    $0x8,%esp
+8010494b:	68 d7 b1 10 80       	push   $0x8010b1d7
+80104950:	53                   	push   %ebx
+80104951:	e8 1a d1 ff ff       	call   80101a70 <initsleeplock>
+                initwaitq(&b->wq);
+80104956:	8d 83 b0 00 00 00    	lea    0xb0(%ebx),%eax
+            for (b = g->buf; b < g->buf + BPP; b++) {
+8010495c:	81 c3 00 01 00 00    	add    $0x100,%ebx
+                initwaitq(&b->wq);
+80104962:	89 04 24             	mov    %eax,(%esp)
+80104965:	e8 26 cf ff ff       	call   80101890 <initwaitq>
+            for (b = g->buf; b < g->buf + BPP; b++) {
+8010496a:	83 c4 10             	add    $0x10,%esp
+8010496d:	39 df                	cmp    %ebx,%edi
+8010496f:	75 d7                	jne    80104948 <bgrow+0x148>
+            g->next = bcache.spare;
+80104971:	a1 4c 41 1b 80       	mov    0x801b414c,%eax
+            bcache.spare = g;
+80104976:	89 35 4c 41 1b 80    	mov    %esi,0x801b414c
+            g->next = bcache.spare;
+8010497c:	89 86 00 08 00 00    	mov    %eax,0x800(%esi)
+    if ((data = kalloc()) == 0)
+80104982:	e8 b9 37 00 00       	call   80108140 <kalloc>
+80104987:	89 c7                	mov    %eax,%edi
+80104989:	85 c0                	test   %eax,%eax
+8010498b:	0f 85 94 fe ff ff    	jne    80104825 <bgrow+0x25>
+}
+80104991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+            return 0;
+80104994:	31 c0                	xor    %eax,%eax
+}
+80104996:	5b                   	pop    %ebx
+80104997:	5e                   	pop    %esi
+80104998:	5f                   	pop    %edi
+80104999:	5d                   	pop    %ebp
+8010499a:	c3                   	ret
+8010499b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010499f:	90                   	nop
+
+801049a0 <bshrink.part.0>:
+bshrink(int n)
+801049a0:	55                   	push   %ebp
+801049a1:	89 e5                	mov    %esp,%ebp
+801049a3:	57                   	push   %edi
+801049a4:	56                   	push   %esi
+801049a5:	53                   	push   %ebx
+801049a6:	83 ec 34             	sub    $0x34,%esp
+801049a9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    acquiremcs(&bcache.lrulock, &me);
+801049ac:	8d 45 e0             	lea    -0x20(%ebp),%eax
+801049af:	50                   	push   %eax
+801049b0:	68 00 3d 1b 80       	push   $0x801b3d00
+801049b5:	e8 96 c9 ff ff       	call   80101350 <acquiremcs>
+    int freed = 0, q;
+801049ba:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+    acquiremcs(&bcache.lrulock, &me);
+801049c1:	83 c4 10             	add    $0x10,%esp
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+801049c4:	c7 45 d4 80 41 1b 80 	movl   $0x801b4180,-0x2c(%ebp)
+        for (b = head->prev; b != head; b = b->prev) {
+801049cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801049ce:	8b 70 78             	mov    0x78(%eax),%esi
+801049d1:	39 c6                	cmp    %eax,%esi
+801049d3:	0f 84 a9 00 00 00    	je     80104a82 <bshrink.part.0+0xe2>
+            if (freed == n || bcache.nbuf - BPP < NBUF)
+801049d9:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+801049dc:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+801049df:	0f 84 b4 00 00 00    	je     80104a99 <bshrink.part.0+0xf9>
+801049e5:	a1 40 3d 1b 80       	mov    0x801b3d40,%eax
+801049ea:	83 e8 08             	sub    $0x8,%eax
+801049ed:	83 f8 1d             	cmp    $0x1d,%eax
+801049f0:	0f 86 a3 00 00 00    	jbe    80104a99 <bshrink.part.0+0xf9>
+            if (b->refcnt != 0 || (g = bclaimgroup(b)) == 0)
+801049f6:	8b 46 74             	mov    0x74(%esi),%eax
+801049f9:	85 c0                	test   %eax,%eax
+801049fb:	75 77                	jne    80104a74 <bshrink.part.0+0xd4>
+    return (struct bgroup*)pg + ((uint)b - pg) / sizeof(struct bgroup);
+801049fd:	89 f2                	mov    %esi,%edx
+801049ff:	b8 e1 83 0f 3e       	mov    $0x3e0f83e1,%eax
+    uint pg = PGROUNDDOWN((uint)b);
+80104a04:	89 f3                	mov    %esi,%ebx
+    return (struct bgroup*)pg + ((uint)b - pg) / sizeof(struct bgroup);
+80104a06:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    uint pg = PGROUNDDOWN((uint)b);
+80104a0c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    return (struct bgroup*)pg + ((uint)b - pg) / sizeof(struct bgroup);
+80104a12:	f7 e2                	mul    %edx
+80104a14:	c1 ea 09             	shr    $0x9,%edx
+80104a17:	69 ca 40 08 00 00    	imul   $0x840,%edx,%ecx
+80104a1d:	01 d9                	add    %ebx,%ecx
+    for (x = g->buf; x < g->buf + BPP; x++) {
+80104a1f:	8d 99 00 08 00 00    	lea    0x800(%ecx),%ebx
+80104a25:	39 d9                	cmp    %ebx,%ecx
+80104a27:	0f 83 88 00 00 00    	jae    80104ab5 <bshrink.part.0+0x115>
+80104a2d:	89 ca                	mov    %ecx,%edx
+        if (!__sync_bool_compare_and_swap(&x->refcnt, 0, BRECYCLE))
+80104a2f:	bf 00 00 00 80       	mov    $0x80000000,%edi
+80104a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104a38:	31 c0                	xor    %eax,%eax
+80104a3a:	f0 0f b1 7a 74       	lock cmpxchg %edi,0x74(%edx)
+80104a3f:	75 13                	jne    80104a54 <bshrink.part.0+0xb4>
+        if (x->flags & B_DIRTY) {
+80104a41:	f6 02 04             	testb  $0x4,(%edx)
+80104a44:	0f 85 7e 01 00 00    	jne    80104bc8 <bshrink.part.0+0x228>
+    for (x = g->buf; x < g->buf + BPP; x++) {
+80104a4a:	81 c2 00 01 00 00    	add    $0x100,%edx
+80104a50:	39 da                	cmp    %ebx,%edx
+80104a52:	72 e4                	jb     80104a38 <bshrink.part.0+0x98>
+    if (x == g->buf + BPP)
+80104a54:	39 da                	cmp    %ebx,%edx
+80104a56:	75 18                	jne    80104a70 <bshrink.part.0+0xd0>
+80104a58:	eb 5d                	jmp    80104ab7 <bshrink.part.0+0x117>
+80104a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        x->refcnt = 0;
+80104a60:	c7 82 74 ff ff ff 00 	movl   $0x0,-0x8c(%edx)
+80104a67:	00 00 00 
+    while (x-- > g->buf)
+80104a6a:	81 ea 00 01 00 00    	sub    $0x100,%edx
+80104a70:	39 d1                	cmp    %edx,%ecx
+80104a72:	72 ec                	jb     80104a60 <bshrink.part.0+0xc0>
+        for (b = head->prev; b != head; b = b->prev) {
+80104a74:	8b 76 78             	mov    0x78(%esi),%esi
+80104a77:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104a7a:	39 c6                	cmp    %eax,%esi
+80104a7c:	0f 85 63 ff ff ff    	jne    801049e5 <bshrink.part.0+0x45>
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+80104a82:	81 45 d4 00 01 00 00 	addl   $0x100,-0x2c(%ebp)
+80104a89:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80104a8c:	bb 80 43 1b 80       	mov    $0x801b4380,%ebx
+80104a91:	39 c3                	cmp    %eax,%ebx
+80104a93:	0f 85 32 ff ff ff    	jne    801049cb <bshrink.part.0+0x2b>
+    releasemcs(&bcache.lrulock, &me);
+80104a99:	83 ec 08             	sub    $0x8,%esp
+80104a9c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80104a9f:	50                   	push   %eax
+80104aa0:	68 00 3d 1b 80       	push   $0x801b3d00
+80104aa5:	e8 76 c7 ff ff       	call   80101220 <releasemcs>
+}
+80104aaa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80104aad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104ab0:	5b                   	pop    %ebx
+80104ab1:	5e                   	pop    %esi
+80104ab2:	5f                   	pop    %edi
+80104ab3:	5d                   	pop    %ebp
+80104ab4:	c3                   	ret
+    if (x == g->buf + BPP)
+80104ab5:	75 bd                	jne    80104a74 <bshrink.part.0+0xd4>
+            if (b->refcnt != 0 || (g = bclaimgroup(b)) == 0)
+80104ab7:	85 c9                	test   %ecx,%ecx
+80104ab9:	74 b9                	je     80104a74 <bshrink.part.0+0xd4>
+            data = (char*)g->buf[0].data;
+80104abb:	8b 91 cc 00 00 00    	mov    0xcc(%ecx),%edx
+80104ac1:	89 c8                	mov    %ecx,%eax
+            for (x = g->buf; x < g->buf + BPP; x++) {
+80104ac3:	89 ce                	mov    %ecx,%esi
+80104ac5:	39 d9                	cmp    %ebx,%ecx
+80104ac7:	0f 83 b7 00 00 00    	jae    80104b84 <bshrink.part.0+0x1e4>
+80104acd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80104ad0:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+80104ad3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104ad7:	90                   	nop
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104ad8:	8b 46 04             	mov    0x4(%esi),%eax
+    acquire(&bk->lock);
+80104adb:	83 ec 0c             	sub    $0xc,%esp
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104ade:	89 c2                	mov    %eax,%edx
+80104ae0:	c1 e2 05             	shl    $0x5,%edx
+80104ae3:	29 c2                	sub    %eax,%edx
+80104ae5:	a1 48 3d 1b 80       	mov    0x801b3d48,%eax
+80104aea:	03 56 08             	add    0x8(%esi),%edx
+80104aed:	83 e8 01             	sub    $0x1,%eax
+80104af0:	21 c2                	and    %eax,%edx
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80104af2:	89 d0                	mov    %edx,%eax
+80104af4:	83 e2 1f             	and    $0x1f,%edx
+80104af7:	c1 e8 05             	shr    $0x5,%eax
+80104afa:	c1 e2 07             	shl    $0x7,%edx
+80104afd:	8b 3c 85 4c 3d 1b 80 	mov    -0x7fe4c2b4(,%eax,4),%edi
+80104b04:	01 d7                	add    %edx,%edi
+    acquire(&bk->lock);
+80104b06:	57                   	push   %edi
+80104b07:	e8 a4 c9 ff ff       	call   801014b0 <acquire>
+    for (pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+80104b0c:	8b 47 44             	mov    0x44(%edi),%eax
+80104b0f:	83 c4 10             	add    $0x10,%esp
+80104b12:	39 f0                	cmp    %esi,%eax
+80104b14:	0f 84 a6 00 00 00    	je     80104bc0 <bshrink.part.0+0x220>
+80104b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104b20:	89 c1                	mov    %eax,%ecx
+80104b22:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80104b28:	39 f0                	cmp    %esi,%eax
+80104b2a:	75 f4                	jne    80104b20 <bshrink.part.0+0x180>
+80104b2c:	81 c1 8c 00 00 00    	add    $0x8c,%ecx
+    *pp = b->hnext;
+80104b32:	8b 86 8c 00 00 00    	mov    0x8c(%esi),%eax
+    release(&bk->lock);
+80104b38:	83 ec 0c             	sub    $0xc,%esp
+            for (x = g->buf; x < g->buf + BPP; x++) {
+80104b3b:	81 c6 00 01 00 00    	add    $0x100,%esi
+    *pp = b->hnext;
+80104b41:	89 01                	mov    %eax,(%ecx)
+    release(&bk->lock);
+80104b43:	57                   	push   %edi
+80104b44:	e8 87 c7 ff ff       	call   801012d0 <release>
+    b->next->prev = b->prev;
+80104b49:	8b 96 7c ff ff ff    	mov    -0x84(%esi),%edx
+80104b4f:	8b 86 78 ff ff ff    	mov    -0x88(%esi),%eax
+            for (x = g->buf; x < g->buf + BPP; x++) {
+80104b55:	83 c4 10             	add    $0x10,%esp
+    b->next->prev = b->prev;
+80104b58:	89 42 78             	mov    %eax,0x78(%edx)
+    b->prev->next = b->next;
+80104b5b:	8b 96 7c ff ff ff    	mov    -0x84(%esi),%edx
+80104b61:	89 50 7c             	mov    %edx,0x7c(%eax)
+    bcache.nlist[b->queue]--;
+80104b64:	8b 46 80             	mov    -0x80(%esi),%eax
+80104b67:	83 2c 85 80 43 1b 80 	subl   $0x1,-0x7fe4bc80(,%eax,4)
+80104b6e:	01 
+                x->data = 0;
+80104b6f:	c7 46 cc 00 00 00 00 	movl   $0x0,-0x34(%esi)
+            for (x = g->buf; x < g->buf + BPP; x++) {
+80104b76:	39 de                	cmp    %ebx,%esi
+80104b78:	0f 85 5a ff ff ff    	jne    80104ad8 <bshrink.part.0+0x138>
+80104b7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80104b81:	8b 45 c8             	mov    -0x38(%ebp),%eax
+            g->next = bcache.spare;
+80104b84:	8b 0d 4c 41 1b 80    	mov    0x801b414c,%ecx
+            kfree(data);
+80104b8a:	83 ec 0c             	sub    $0xc,%esp
+            bcache.spare = g;
+80104b8d:	a3 4c 41 1b 80       	mov    %eax,0x801b414c
+            bcache.nbuf -= BPP;
+80104b92:	83 2d 40 3d 1b 80 08 	subl   $0x8,0x801b3d40
+            g->next = bcache.spare;
+80104b99:	89 88 00 08 00 00    	mov    %ecx,0x800(%eax)
+            kfree(data);
+80104b9f:	52                   	push   %edx
+80104ba0:	e8 ab 33 00 00       	call   80107f50 <kfree>
+            kstatinc(KS_BCACHESHRINK);
+80104ba5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+80104bac:	e8 1f 19 00 00       	call   801064d0 <kstatinc>
+            freed++;
+80104bb1:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+            goto again;     // b was in g
+80104bb5:	83 c4 10             	add    $0x10,%esp
+80104bb8:	e9 07 fe ff ff       	jmp    801049c4 <bshrink.part.0+0x24>
+80104bbd:	8d 76 00             	lea    0x0(%esi),%esi
+    for (pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+80104bc0:	8d 4f 44             	lea    0x44(%edi),%ecx
+80104bc3:	e9 6a ff ff ff       	jmp    80104b32 <bshrink.part.0+0x192>
+            x->refcnt = 0;
+80104bc8:	c7 42 74 00 00 00 00 	movl   $0x0,0x74(%edx)
+            break;
+80104bcf:	e9 80 fe ff ff       	jmp    80104a54 <bshrink.part.0+0xb4>
+80104bd4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104bdf:	90                   	nop
+
+80104be0 <bget>:
+{
+80104be0:	55                   	push   %ebp
+80104be1:	89 d1                	mov    %edx,%ecx
+80104be3:	89 e5                	mov    %esp,%ebp
+80104be5:	57                   	push   %edi
+80104be6:	56                   	push   %esi
+80104be7:	89 c6                	mov    %eax,%esi
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104be9:	c1 e0 05             	shl    $0x5,%eax
+{
+80104bec:	53                   	push   %ebx
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104bed:	29 f0                	sub    %esi,%eax
+80104bef:	01 d0                	add    %edx,%eax
+{
+80104bf1:	83 ec 2c             	sub    $0x2c,%esp
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104bf4:	8b 3d 48 3d 1b 80    	mov    0x801b3d48,%edi
+80104bfa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+{
+80104bfd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    if ((b = blookup(bk, dev, blockno)) != 0)
+80104c00:	89 f2                	mov    %esi,%edx
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104c02:	83 ef 01             	sub    $0x1,%edi
+80104c05:	21 c7                	and    %eax,%edi
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80104c07:	89 f8                	mov    %edi,%eax
+80104c09:	83 e7 1f             	and    $0x1f,%edi
+80104c0c:	c1 e8 05             	shr    $0x5,%eax
+80104c0f:	c1 e7 07             	shl    $0x7,%edi
+80104c12:	03 3c 85 4c 3d 1b 80 	add    -0x7fe4c2b4(,%eax,4),%edi
+    if ((b = blookup(bk, dev, blockno)) != 0)
+80104c19:	89 f8                	mov    %edi,%eax
+80104c1b:	e8 50 fb ff ff       	call   80104770 <blookup>
+80104c20:	85 c0                	test   %eax,%eax
+80104c22:	74 7c                	je     80104ca0 <bget+0xc0>
+    kstatinc(KS_BCACHEHIT);
+80104c24:	83 ec 0c             	sub    $0xc,%esp
+80104c27:	89 c3                	mov    %eax,%ebx
+80104c29:	6a 04                	push   $0x4
+80104c2b:	e8 a0 18 00 00       	call   801064d0 <kstatinc>
+    acquiresleep(&b->lock);
+80104c30:	8d 43 0c             	lea    0xc(%ebx),%eax
+80104c33:	89 04 24             	mov    %eax,(%esp)
+80104c36:	e8 85 ce ff ff       	call   80101ac0 <acquiresleep>
+    if (b->reref < 0) {
+80104c3b:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+80104c41:	83 c4 10             	add    $0x10,%esp
+80104c44:	85 c0                	test   %eax,%eax
+80104c46:	78 30                	js     80104c78 <bget+0x98>
+    } else if (b->queue == BQ_PROBATION && ticks - b->reftick >= BCORRELATE)
+80104c48:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80104c4e:	85 c0                	test   %eax,%eax
+80104c50:	75 3b                	jne    80104c8d <bget+0xad>
+80104c52:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+80104c57:	39 83 84 00 00 00    	cmp    %eax,0x84(%ebx)
+80104c5d:	74 2e                	je     80104c8d <bget+0xad>
+        b->reref = 1;
+80104c5f:	c7 83 88 00 00 00 01 	movl   $0x1,0x88(%ebx)
+80104c66:	00 00 00 
+}
+80104c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104c6c:	89 d8                	mov    %ebx,%eax
+80104c6e:	5b                   	pop    %ebx
+80104c6f:	5e                   	pop    %esi
+80104c70:	5f                   	pop    %edi
+80104c71:	5d                   	pop    %ebp
+80104c72:	c3                   	ret
+80104c73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104c77:	90                   	nop
+        b->reref = 0;
+80104c78:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80104c7f:	00 00 00 
+        b->reftick = ticks;
+80104c82:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+80104c87:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+}
+80104c8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104c90:	89 d8                	mov    %ebx,%eax
+80104c92:	5b                   	pop    %ebx
+80104c93:	5e                   	pop    %esi
+80104c94:	5f                   	pop    %edi
+80104c95:	5d                   	pop    %ebp
+80104c96:	c3                   	ret
+80104c97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104c9e:	66 90                	xchg   %ax,%ax
+    acquiremcs(&bcache.lrulock, &me);
+80104ca0:	83 ec 08             	sub    $0x8,%esp
+80104ca3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80104ca6:	50                   	push   %eax
+80104ca7:	68 00 3d 1b 80       	push   $0x801b3d00
+80104cac:	e8 9f c6 ff ff       	call   80101350 <acquiremcs>
+    if ((b = blookup(bk, dev, blockno)) != 0) {
+80104cb1:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80104cb4:	89 f2                	mov    %esi,%edx
+80104cb6:	89 f8                	mov    %edi,%eax
+80104cb8:	e8 b3 fa ff ff       	call   80104770 <blookup>
+80104cbd:	83 c4 10             	add    $0x10,%esp
+80104cc0:	89 c3                	mov    %eax,%ebx
+80104cc2:	85 c0                	test   %eax,%eax
+80104cc4:	0f 85 f6 01 00 00    	jne    80104ec0 <bget+0x2e0>
+    if (bcache.nbuf < bcache.target && kfreecount() > BGROWMIN)
+80104cca:	a1 44 3d 1b 80       	mov    0x801b3d44,%eax
+80104ccf:	39 05 40 3d 1b 80    	cmp    %eax,0x801b3d40
+80104cd5:	0f 82 c5 01 00 00    	jb     80104ea0 <bget+0x2c0>
+            if (b->refcnt != 0 || !__sync_bool_compare_and_swap(&b->refcnt, 0, BRECYCLE))
+80104cdb:	31 ff                	xor    %edi,%edi
+80104cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+80104ce0:	ba 80 41 1b 80       	mov    $0x801b4180,%edx
+        for (b = head->prev; b != head; b = b->prev) {
+80104ce5:	8b 5a 78             	mov    0x78(%edx),%ebx
+80104ce8:	39 da                	cmp    %ebx,%edx
+80104cea:	0f 84 82 01 00 00    	je     80104e72 <bget+0x292>
+            if (b->refcnt != 0 || !__sync_bool_compare_and_swap(&b->refcnt, 0, BRECYCLE))
+80104cf0:	b9 00 00 00 80       	mov    $0x80000000,%ecx
+80104cf5:	8b 43 74             	mov    0x74(%ebx),%eax
+80104cf8:	85 c0                	test   %eax,%eax
+80104cfa:	0f 85 67 01 00 00    	jne    80104e67 <bget+0x287>
+80104d00:	89 f8                	mov    %edi,%eax
+80104d02:	f0 0f b1 4b 74       	lock cmpxchg %ecx,0x74(%ebx)
+80104d07:	0f 85 5a 01 00 00    	jne    80104e67 <bget+0x287>
+            if (b->flags & B_DIRTY) {
+80104d0d:	f6 03 04             	testb  $0x4,(%ebx)
+80104d10:	0f 85 4a 01 00 00    	jne    80104e60 <bget+0x280>
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104d16:	8b 43 04             	mov    0x4(%ebx),%eax
+    acquire(&bk->lock);
+80104d19:	83 ec 0c             	sub    $0xc,%esp
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104d1c:	89 c7                	mov    %eax,%edi
+80104d1e:	c1 e7 05             	shl    $0x5,%edi
+80104d21:	29 c7                	sub    %eax,%edi
+80104d23:	a1 48 3d 1b 80       	mov    0x801b3d48,%eax
+80104d28:	03 7b 08             	add    0x8(%ebx),%edi
+80104d2b:	83 e8 01             	sub    $0x1,%eax
+80104d2e:	21 c7                	and    %eax,%edi
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80104d30:	89 f8                	mov    %edi,%eax
+80104d32:	83 e7 1f             	and    $0x1f,%edi
+80104d35:	c1 e8 05             	shr    $0x5,%eax
+80104d38:	c1 e7 07             	shl    $0x7,%edi
+80104d3b:	03 3c 85 4c 3d 1b 80 	add    -0x7fe4c2b4(,%eax,4),%edi
+    acquire(&bk->lock);
+80104d42:	57                   	push   %edi
+80104d43:	e8 68 c7 ff ff       	call   801014b0 <acquire>
+    for (pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+80104d48:	8b 47 44             	mov    0x44(%edi),%eax
+80104d4b:	83 c4 10             	add    $0x10,%esp
+80104d4e:	8d 57 44             	lea    0x44(%edi),%edx
+80104d51:	39 d8                	cmp    %ebx,%eax
+80104d53:	74 15                	je     80104d6a <bget+0x18a>
+80104d55:	8d 76 00             	lea    0x0(%esi),%esi
+80104d58:	89 c2                	mov    %eax,%edx
+80104d5a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+80104d60:	39 d8                	cmp    %ebx,%eax
+80104d62:	75 f4                	jne    80104d58 <bget+0x178>
+80104d64:	81 c2 8c 00 00 00    	add    $0x8c,%edx
+    *pp = b->hnext;
+80104d6a:	8b 83 8c 00 00 00    	mov    0x8c(%ebx),%eax
+    release(&bk->lock);
+80104d70:	83 ec 0c             	sub    $0xc,%esp
+    *pp = b->hnext;
+80104d73:	89 02                	mov    %eax,(%edx)
+    release(&bk->lock);
+80104d75:	57                   	push   %edi
+80104d76:	e8 55 c5 ff ff       	call   801012d0 <release>
+    b->blockno = blockno;
+80104d7b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    b->dev = dev;
+80104d7e:	89 73 04             	mov    %esi,0x4(%ebx)
+    b->flags = 0;
+80104d81:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    b->blockno = blockno;
+80104d87:	89 43 08             	mov    %eax,0x8(%ebx)
+    b->reftick = ticks;
+80104d8a:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+    b->reref = 0;
+80104d8f:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80104d96:	00 00 00 
+    b->reftick = ticks;
+80104d99:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104d9f:	a1 48 3d 1b 80       	mov    0x801b3d48,%eax
+    b->refcnt = 1;
+80104da4:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80104dab:	8d 70 ff             	lea    -0x1(%eax),%esi
+80104dae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80104db1:	21 c6                	and    %eax,%esi
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80104db3:	89 f0                	mov    %esi,%eax
+80104db5:	83 e6 1f             	and    $0x1f,%esi
+80104db8:	c1 e8 05             	shr    $0x5,%eax
+80104dbb:	c1 e6 07             	shl    $0x7,%esi
+80104dbe:	03 34 85 4c 3d 1b 80 	add    -0x7fe4c2b4(,%eax,4),%esi
+    acquire(&bk->lock);
+80104dc5:	89 34 24             	mov    %esi,(%esp)
+80104dc8:	e8 e3 c6 ff ff       	call   801014b0 <acquire>
+    b->hnext = bk->head;
+80104dcd:	8b 46 44             	mov    0x44(%esi),%eax
+80104dd0:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+    bk->head = b;
+80104dd6:	89 5e 44             	mov    %ebx,0x44(%esi)
+    release(&bk->lock);
+80104dd9:	89 34 24             	mov    %esi,(%esp)
+80104ddc:	e8 ef c4 ff ff       	call   801012d0 <release>
+    b->next->prev = b->prev;
+80104de1:	8b 53 7c             	mov    0x7c(%ebx),%edx
+80104de4:	8b 43 78             	mov    0x78(%ebx),%eax
+80104de7:	89 42 78             	mov    %eax,0x78(%edx)
+    b->prev->next = b->next;
+80104dea:	8b 53 7c             	mov    0x7c(%ebx),%edx
+80104ded:	89 50 7c             	mov    %edx,0x7c(%eax)
+    bcache.nlist[b->queue]--;
+80104df0:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80104df6:	83 2c 85 80 43 1b 80 	subl   $0x1,-0x7fe4bc80(,%eax,4)
+80104dfd:	01 
+    b->queue = q;
+80104dfe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80104e05:	00 00 00 
+    b->next = head->next;
+80104e08:	a1 fc 41 1b 80       	mov    0x801b41fc,%eax
+    b->prev = head;
+80104e0d:	c7 43 78 80 41 1b 80 	movl   $0x801b4180,0x78(%ebx)
+    b->next = head->next;
+80104e14:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    head->next->prev = b;
+80104e17:	a1 fc 41 1b 80       	mov    0x801b41fc,%eax
+80104e1c:	89 58 78             	mov    %ebx,0x78(%eax)
+    head->next = b;
+80104e1f:	89 1d fc 41 1b 80    	mov    %ebx,0x801b41fc
+    bcache.nlist[q]++;
+80104e25:	83 05 80 43 1b 80 01 	addl   $0x1,0x801b4380
+    releasemcs(&bcache.lrulock, &me);
+80104e2c:	58                   	pop    %eax
+80104e2d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80104e30:	5a                   	pop    %edx
+80104e31:	50                   	push   %eax
+80104e32:	68 00 3d 1b 80       	push   $0x801b3d00
+80104e37:	e8 e4 c3 ff ff       	call   80101220 <releasemcs>
+    kstatinc(KS_BCACHEMISS);
+80104e3c:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+80104e43:	e8 88 16 00 00       	call   801064d0 <kstatinc>
+    acquiresleep(&b->lock);
+80104e48:	8d 43 0c             	lea    0xc(%ebx),%eax
+80104e4b:	89 04 24             	mov    %eax,(%esp)
+80104e4e:	e8 6d cc ff ff       	call   80101ac0 <acquiresleep>
+    return b;
+80104e53:	83 c4 10             	add    $0x10,%esp
+}
+80104e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104e59:	89 d8                	mov    %ebx,%eax
+80104e5b:	5b                   	pop    %ebx
+80104e5c:	5e                   	pop    %esi
+80104e5d:	5f                   	pop    %edi
+80104e5e:	5d                   	pop    %ebp
+80104e5f:	c3                   	ret
+                b->refcnt = 0;
+80104e60:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+        for (b = head->prev; b != head; b = b->prev) {
+80104e67:	8b 5b 78             	mov    0x78(%ebx),%ebx
+80104e6a:	39 da                	cmp    %ebx,%edx
+80104e6c:	0f 85 83 fe ff ff    	jne    80104cf5 <bget+0x115>
+    for (q = BQ_PROBATION; q <= BQ_PROTECTED; q++) {
+80104e72:	81 c2 00 01 00 00    	add    $0x100,%edx
+80104e78:	81 fa 80 43 1b 80    	cmp    $0x801b4380,%edx
+80104e7e:	0f 85 61 fe ff ff    	jne    80104ce5 <bget+0x105>
+        if (!bgrow())
+80104e84:	e8 77 f9 ff ff       	call   80104800 <bgrow>
+80104e89:	85 c0                	test   %eax,%eax
+80104e8b:	0f 85 4f fe ff ff    	jne    80104ce0 <bget+0x100>
+            panic("bget: no buffers available");
+80104e91:	83 ec 0c             	sub    $0xc,%esp
+80104e94:	68 de b1 10 80       	push   $0x8010b1de
+80104e99:	e8 a2 4e 00 00       	call   80109d40 <panic>
+80104e9e:	66 90                	xchg   %ax,%ax
+    if (bcache.nbuf < bcache.target && kfreecount() > BGROWMIN)
+80104ea0:	e8 8b 33 00 00       	call   80108230 <kfreecount>
+80104ea5:	3d 00 04 00 00       	cmp    $0x400,%eax
+80104eaa:	0f 86 2b fe ff ff    	jbe    80104cdb <bget+0xfb>
+        bgrow();
+80104eb0:	e8 4b f9 ff ff       	call   80104800 <bgrow>
+80104eb5:	e9 21 fe ff ff       	jmp    80104cdb <bget+0xfb>
+80104eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        releasemcs(&bcache.lrulock, &me);
+80104ec0:	83 ec 08             	sub    $0x8,%esp
+80104ec3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80104ec6:	50                   	push   %eax
+80104ec7:	68 00 3d 1b 80       	push   $0x801b3d00
+80104ecc:	e8 4f c3 ff ff       	call   80101220 <releasemcs>
+    kstatinc(KS_BCACHEHIT);
+80104ed1:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+80104ed8:	e9 4e fd ff ff       	jmp    80104c2b <bget+0x4b>
+80104edd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104ee0 <bshrink>:
+{
+80104ee0:	55                   	push   %ebp
+80104ee1:	89 e5                	mov    %esp,%ebp
+80104ee3:	53                   	push   %ebx
+80104ee4:	83 ec 04             	sub    $0x4,%esp
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+80104ee7:	83 3d 40 3d 1b 80 1e 	cmpl   $0x1e,0x801b3d40
+{
+80104eee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+80104ef1:	77 0d                	ja     80104f00 <bshrink+0x20>
+}
+80104ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104ef6:	31 c0                	xor    %eax,%eax
+80104ef8:	c9                   	leave
+80104ef9:	c3                   	ret
+80104efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+80104f00:	83 ec 0c             	sub    $0xc,%esp
+80104f03:	68 00 3d 1b 80       	push   $0x801b3d00
+80104f08:	e8 a3 c2 ff ff       	call   801011b0 <holdingmcs>
+80104f0d:	83 c4 10             	add    $0x10,%esp
+80104f10:	85 c0                	test   %eax,%eax
+80104f12:	75 df                	jne    80104ef3 <bshrink+0x13>
+80104f14:	89 d8                	mov    %ebx,%eax
+}
+80104f16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104f19:	c9                   	leave
+80104f1a:	e9 81 fa ff ff       	jmp    801049a0 <bshrink.part.0>
+80104f1f:	90                   	nop
+
+80104f20 <binit>:
+{
+80104f20:	55                   	push   %ebp
+80104f21:	89 e5                	mov    %esp,%ebp
+80104f23:	56                   	push   %esi
+80104f24:	53                   	push   %ebx
+80104f25:	83 ec 18             	sub    $0x18,%esp
+    initmcslock(&bcache.lrulock, "bcache");
+80104f28:	68 f9 b1 10 80       	push   $0x8010b1f9
+80104f2d:	68 00 3d 1b 80       	push   $0x801b3d00
+80104f32:	e8 39 c1 ff ff       	call   80101070 <initmcslock>
+        bcache.list[i].prev = &bcache.list[i];
+80104f37:	c7 05 f8 41 1b 80 80 	movl   $0x801b4180,0x801b41f8
+80104f3e:	41 1b 80 
+        bcache.list[i].next = &bcache.list[i];
+80104f41:	c7 05 fc 41 1b 80 80 	movl   $0x801b4180,0x801b41fc
+80104f48:	41 1b 80 
+        bcache.list[i].prev = &bcache.list[i];
+80104f4b:	c7 05 f8 42 1b 80 80 	movl   $0x801b4280,0x801b42f8
+80104f52:	42 1b 80 
+        bcache.list[i].next = &bcache.list[i];
+80104f55:	c7 05 fc 42 1b 80 80 	movl   $0x801b4280,0x801b42fc
+80104f5c:	42 1b 80 
+    pages = kfreecount() / 100 * BCACHEPCT;
+80104f5f:	e8 cc 32 00 00       	call   80108230 <kfreecount>
+80104f64:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    if (groups * BPP < NBUF)
+80104f69:	83 c4 10             	add    $0x10,%esp
+    pages = kfreecount() / 100 * BCACHEPCT;
+80104f6c:	f7 e2                	mul    %edx
+    groups = pages * PGSIZE / (PGSIZE + sizeof(struct bgroup));
+80104f6e:	b8 fe a0 a3 02       	mov    $0x2a3a0fe,%eax
+    pages = kfreecount() / 100 * BCACHEPCT;
+80104f73:	c1 ea 05             	shr    $0x5,%edx
+    groups = pages * PGSIZE / (PGSIZE + sizeof(struct bgroup));
+80104f76:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104f79:	c1 e2 0d             	shl    $0xd,%edx
+80104f7c:	c1 ea 06             	shr    $0x6,%edx
+80104f7f:	f7 e2                	mul    %edx
+    if (groups * BPP < NBUF)
+80104f81:	c1 e2 03             	shl    $0x3,%edx
+80104f84:	83 fa 1d             	cmp    $0x1d,%edx
+80104f87:	0f 87 03 01 00 00    	ja     80105090 <binit+0x170>
+    bcache.target = groups * BPP;
+80104f8d:	c7 05 44 3d 1b 80 20 	movl   $0x20,0x801b3d44
+80104f94:	00 00 00 
+    for (bcache.nbucket = BKTPP; bcache.nbucket * 4 < bcache.target; bcache.nbucket *= 2)
+80104f97:	c7 05 48 3d 1b 80 20 	movl   $0x20,0x801b3d48
+80104f9e:	00 00 00 
+80104fa1:	31 f6                	xor    %esi,%esi
+80104fa3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104fa7:	90                   	nop
+        if ((p = kalloc()) == 0)
+80104fa8:	e8 93 31 00 00       	call   80108140 <kalloc>
+80104fad:	89 c3                	mov    %eax,%ebx
+80104faf:	85 c0                	test   %eax,%eax
+80104fb1:	0f 84 27 01 00 00    	je     801050de <binit+0x1be>
+        memset(p, 0, PGSIZE);
+80104fb7:	83 ec 04             	sub    $0x4,%esp
+80104fba:	68 00 10 00 00       	push   $0x1000
+80104fbf:	6a 00                	push   $0x0
+80104fc1:	50                   	push   %eax
+80104fc2:	e8 79 b0 ff ff       	call   80100040 <memset>
+        bcache.bucket[i] = (struct bucket*)p;
+80104fc7:	89 1c b5 4c 3d 1b 80 	mov    %ebx,-0x7fe4c2b4(,%esi,4)
+    for (i = 0; i < bcache.nbucket / BKTPP; i++) {
+80104fce:	83 c6 01             	add    $0x1,%esi
+80104fd1:	a1 48 3d 1b 80       	mov    0x801b3d48,%eax
+80104fd6:	83 c4 10             	add    $0x10,%esp
+80104fd9:	89 c2                	mov    %eax,%edx
+80104fdb:	c1 ea 05             	shr    $0x5,%edx
+80104fde:	39 d6                	cmp    %edx,%esi
+80104fe0:	72 c6                	jb     80104fa8 <binit+0x88>
+    for (i = 0; i < bcache.nbucket; i++)
+80104fe2:	31 db                	xor    %ebx,%ebx
+80104fe4:	85 c0                	test   %eax,%eax
+80104fe6:	74 38                	je     80105020 <binit+0x100>
+80104fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104fef:	90                   	nop
+        initlock(&bcache.bucket[i / BKTPP][i % BKTPP].lock, "bcache.bucket");
+80104ff0:	89 da                	mov    %ebx,%edx
+80104ff2:	89 d8                	mov    %ebx,%eax
+80104ff4:	83 ec 08             	sub    $0x8,%esp
+    for (i = 0; i < bcache.nbucket; i++)
+80104ff7:	83 c3 01             	add    $0x1,%ebx
+        initlock(&bcache.bucket[i / BKTPP][i % BKTPP].lock, "bcache.bucket");
+80104ffa:	c1 ea 05             	shr    $0x5,%edx
+80104ffd:	83 e0 1f             	and    $0x1f,%eax
+80105000:	68 0f b2 10 80       	push   $0x8010b20f
+80105005:	c1 e0 07             	shl    $0x7,%eax
+80105008:	03 04 95 4c 3d 1b 80 	add    -0x7fe4c2b4(,%edx,4),%eax
+8010500f:	50                   	push   %eax
+80105010:	e8 2b c0 ff ff       	call   80101040 <initlock>
+    for (i = 0; i < bcache.nbucket; i++)
+80105015:	83 c4 10             	add    $0x10,%esp
+80105018:	3b 1d 48 3d 1b 80    	cmp    0x801b3d48,%ebx
+8010501e:	72 d0                	jb     80104ff0 <binit+0xd0>
+    acquiremcs(&bcache.lrulock, &me);
+80105020:	83 ec 08             	sub    $0x8,%esp
+80105023:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+80105026:	53                   	push   %ebx
+80105027:	68 00 3d 1b 80       	push   $0x801b3d00
+8010502c:	e8 1f c3 ff ff       	call   80101350 <acquiremcs>
+    while (bcache.nbuf < bcache.target)
+80105031:	83 c4 10             	add    $0x10,%esp
+80105034:	eb 13                	jmp    80105049 <binit+0x129>
+80105036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010503d:	8d 76 00             	lea    0x0(%esi),%esi
+        if (!bgrow())
+80105040:	e8 bb f7 ff ff       	call   80104800 <bgrow>
+80105045:	85 c0                	test   %eax,%eax
+80105047:	74 0d                	je     80105056 <binit+0x136>
+    while (bcache.nbuf < bcache.target)
+80105049:	a1 44 3d 1b 80       	mov    0x801b3d44,%eax
+8010504e:	39 05 40 3d 1b 80    	cmp    %eax,0x801b3d40
+80105054:	72 ea                	jb     80105040 <binit+0x120>
+    releasemcs(&bcache.lrulock, &me);
+80105056:	83 ec 08             	sub    $0x8,%esp
+80105059:	53                   	push   %ebx
+8010505a:	68 00 3d 1b 80       	push   $0x801b3d00
+8010505f:	e8 bc c1 ff ff       	call   80101220 <releasemcs>
+    if (bcache.nbuf < NBUF)
+80105064:	a1 40 3d 1b 80       	mov    0x801b3d40,%eax
+80105069:	83 c4 10             	add    $0x10,%esp
+8010506c:	83 f8 1d             	cmp    $0x1d,%eax
+8010506f:	76 7a                	jbe    801050eb <binit+0x1cb>
+    cprintf("bcache: %d blocks available in total, %d buckets\n", bcache.nbuf, bcache.nbucket);
+80105071:	83 ec 04             	sub    $0x4,%esp
+80105074:	ff 35 48 3d 1b 80    	push   0x801b3d48
+8010507a:	50                   	push   %eax
+8010507b:	68 90 b2 10 80       	push   $0x8010b290
+80105080:	e8 3b 4d 00 00       	call   80109dc0 <cprintf>
+}
+80105085:	83 c4 10             	add    $0x10,%esp
+80105088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010508b:	5b                   	pop    %ebx
+8010508c:	5e                   	pop    %esi
+8010508d:	5d                   	pop    %ebp
+8010508e:	c3                   	ret
+8010508f:	90                   	nop
+    bcache.target = groups * BPP;
+80105090:	89 15 44 3d 1b 80    	mov    %edx,0x801b3d44
+    for (bcache.nbucket = BKTPP; bcache.nbucket * 4 < bcache.target; bcache.nbucket *= 2)
+80105096:	b8 20 00 00 00       	mov    $0x20,%eax
+        if (bcache.nbucket == NBKTPAGE * BKTPP)
+8010509b:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+801050a1:	77 0c                	ja     801050af <binit+0x18f>
+801050a3:	eb 2a                	jmp    801050cf <binit+0x1af>
+801050a5:	8d 76 00             	lea    0x0(%esi),%esi
+801050a8:	3d 00 20 00 00       	cmp    $0x2000,%eax
+801050ad:	74 0b                	je     801050ba <binit+0x19a>
+    for (bcache.nbucket = BKTPP; bcache.nbucket * 4 < bcache.target; bcache.nbucket *= 2)
+801050af:	89 c1                	mov    %eax,%ecx
+801050b1:	01 c0                	add    %eax,%eax
+801050b3:	c1 e1 03             	shl    $0x3,%ecx
+        if (bcache.nbucket == NBKTPAGE * BKTPP)
+801050b6:	39 d1                	cmp    %edx,%ecx
+801050b8:	72 ee                	jb     801050a8 <binit+0x188>
+    for (i = 0; i < bcache.nbucket / BKTPP; i++) {
+801050ba:	89 c1                	mov    %eax,%ecx
+801050bc:	a3 48 3d 1b 80       	mov    %eax,0x801b3d48
+801050c1:	c1 e9 05             	shr    $0x5,%ecx
+801050c4:	0f 85 d7 fe ff ff    	jne    80104fa1 <binit+0x81>
+801050ca:	e9 13 ff ff ff       	jmp    80104fe2 <binit+0xc2>
+    for (bcache.nbucket = BKTPP; bcache.nbucket * 4 < bcache.target; bcache.nbucket *= 2)
+801050cf:	c7 05 48 3d 1b 80 20 	movl   $0x20,0x801b3d48
+801050d6:	00 00 00 
+801050d9:	e9 c3 fe ff ff       	jmp    80104fa1 <binit+0x81>
+            panic("binit: buckets");
+801050de:	83 ec 0c             	sub    $0xc,%esp
+801050e1:	68 00 b2 10 80       	push   $0x8010b200
+801050e6:	e8 55 4c 00 00       	call   80109d40 <panic>
+        panic("binit: out of memory");
+801050eb:	83 ec 0c             	sub    $0xc,%esp
+801050ee:	68 1d b2 10 80       	push   $0x8010b21d
+801050f3:	e8 48 4c 00 00       	call   80109d40 <panic>
+801050f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801050ff:	90                   	nop
+
+80105100 <bread>:
+{
+80105100:	55                   	push   %ebp
+80105101:	89 e5                	mov    %esp,%ebp
+80105103:	83 ec 18             	sub    $0x18,%esp
+    b = bget(dev, blockno);
+80105106:	8b 55 0c             	mov    0xc(%ebp),%edx
+80105109:	8b 45 08             	mov    0x8(%ebp),%eax
+8010510c:	e8 cf fa ff ff       	call   80104be0 <bget>
+    if ((b->flags & B_VALID) == 0) {
+80105111:	f6 00 02             	testb  $0x2,(%eax)
+80105114:	74 0a                	je     80105120 <bread+0x20>
+}
+80105116:	c9                   	leave
+80105117:	c3                   	ret
+80105118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010511f:	90                   	nop
+        blkrw(b);
+80105120:	83 ec 0c             	sub    $0xc,%esp
+80105123:	50                   	push   %eax
+80105124:	89 45 f4             	mov    %eax,-0xc(%ebp)
+80105127:	e8 64 d6 ff ff       	call   80102790 <blkrw>
+8010512c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010512f:	83 c4 10             	add    $0x10,%esp
+}
+80105132:	c9                   	leave
+80105133:	c3                   	ret
+80105134:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010513b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010513f:	90                   	nop
+
+80105140 <bread_range>:
+
+// read n consecutive blocks into b[0..n), locked as by bread(),
+// those not cached in as few disk commands as possible.
+void
+bread_range(uint dev, uint blockno, int n, struct buf **b)
+{
+80105140:	55                   	push   %ebp
+80105141:	89 e5                	mov    %esp,%ebp
+80105143:	57                   	push   %edi
+80105144:	56                   	push   %esi
+80105145:	53                   	push   %ebx
+80105146:	83 ec 1c             	sub    $0x1c,%esp
+80105149:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010514c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010514f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80105152:	8b 75 14             	mov    0x14(%ebp),%esi
+    int i;
+
+    for (i = 0; i < n; i++)
+80105155:	85 db                	test   %ebx,%ebx
+80105157:	7e 77                	jle    801051d0 <bread_range+0x90>
+80105159:	8d 04 3b             	lea    (%ebx,%edi,1),%eax
+8010515c:	89 f2                	mov    %esi,%edx
+8010515e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80105161:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105164:	8d 04 bd 00 00 00 00 	lea    0x0(,%edi,4),%eax
+8010516b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+8010516e:	29 c2                	sub    %eax,%edx
+80105170:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80105173:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+80105176:	89 d3                	mov    %edx,%ebx
+80105178:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010517f:	90                   	nop
+        b[i] = bget(dev, blockno + i);
+80105180:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80105183:	89 fa                	mov    %edi,%edx
+80105185:	e8 56 fa ff ff       	call   80104be0 <bget>
+8010518a:	89 04 bb             	mov    %eax,(%ebx,%edi,4)
+    for (i = 0; i < n; i++)
+8010518d:	83 c7 01             	add    $0x1,%edi
+80105190:	39 f7                	cmp    %esi,%edi
+80105192:	75 ec                	jne    80105180 <bread_range+0x40>
+80105194:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+80105197:	8b 75 d8             	mov    -0x28(%ebp),%esi
+    blksubmitv(b, n, 0);
+8010519a:	83 ec 04             	sub    $0x4,%esp
+    for (i = 0; i < n; i++)
+8010519d:	31 ff                	xor    %edi,%edi
+    blksubmitv(b, n, 0);
+8010519f:	6a 00                	push   $0x0
+801051a1:	53                   	push   %ebx
+801051a2:	56                   	push   %esi
+801051a3:	e8 a8 d4 ff ff       	call   80102650 <blksubmitv>
+801051a8:	83 c4 10             	add    $0x10,%esp
+801051ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801051af:	90                   	nop
+        blkiowait(b[i]);
+801051b0:	83 ec 0c             	sub    $0xc,%esp
+801051b3:	ff 34 be             	push   (%esi,%edi,4)
+    for (i = 0; i < n; i++)
+801051b6:	83 c7 01             	add    $0x1,%edi
+        blkiowait(b[i]);
+801051b9:	e8 62 d5 ff ff       	call   80102720 <blkiowait>
+    for (i = 0; i < n; i++)
+801051be:	83 c4 10             	add    $0x10,%esp
+801051c1:	39 fb                	cmp    %edi,%ebx
+801051c3:	75 eb                	jne    801051b0 <bread_range+0x70>
+}
+801051c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051c8:	5b                   	pop    %ebx
+801051c9:	5e                   	pop    %esi
+801051ca:	5f                   	pop    %edi
+801051cb:	5d                   	pop    %ebp
+801051cc:	c3                   	ret
+801051cd:	8d 76 00             	lea    0x0(%esi),%esi
+    blksubmitv(b, n, 0);
+801051d0:	c7 45 10 00 00 00 00 	movl   $0x0,0x10(%ebp)
+801051d7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+801051da:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+801051dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801051e0:	5b                   	pop    %ebx
+801051e1:	5e                   	pop    %esi
+801051e2:	5f                   	pop    %edi
+801051e3:	5d                   	pop    %ebp
+    blksubmitv(b, n, 0);
+801051e4:	e9 67 d4 ff ff       	jmp    80102650 <blksubmitv>
+801051e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801051f0 <bwrite>:
+
+// write b's contents to disk, must be locked
+void
+bwrite(struct buf *b)
+{
+801051f0:	55                   	push   %ebp
+801051f1:	89 e5                	mov    %esp,%ebp
+801051f3:	53                   	push   %ebx
+801051f4:	83 ec 10             	sub    $0x10,%esp
+801051f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!holdingsleep(&b->lock))
+801051fa:	8d 43 0c             	lea    0xc(%ebx),%eax
+801051fd:	50                   	push   %eax
+801051fe:	e8 4d ca ff ff       	call   80101c50 <holdingsleep>
+80105203:	83 c4 10             	add    $0x10,%esp
+80105206:	85 c0                	test   %eax,%eax
+80105208:	74 0f                	je     80105219 <bwrite+0x29>
+        panic("bwrite");
+    b->flags |= B_DIRTY;
+8010520a:	83 0b 04             	orl    $0x4,(%ebx)
+    blkrw(b);
+8010520d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80105210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105213:	c9                   	leave
+    blkrw(b);
+80105214:	e9 77 d5 ff ff       	jmp    80102790 <blkrw>
+        panic("bwrite");
+80105219:	83 ec 0c             	sub    $0xc,%esp
+8010521c:	68 32 b2 10 80       	push   $0x8010b232
+80105221:	e8 1a 4b 00 00       	call   80109d40 <panic>
+80105226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010522d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105230 <bread_async>:
+
+// like bread(), but don't wait for the disk:
+// call biowait() before using the data.
+struct buf*
+bread_async(uint dev, uint blockno)
+{
+80105230:	55                   	push   %ebp
+80105231:	89 e5                	mov    %esp,%ebp
+80105233:	53                   	push   %ebx
+80105234:	83 ec 04             	sub    $0x4,%esp
+    struct buf *b;
+
+    b = bget(dev, blockno);
+80105237:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010523a:	8b 45 08             	mov    0x8(%ebp),%eax
+8010523d:	e8 9e f9 ff ff       	call   80104be0 <bget>
+80105242:	89 c3                	mov    %eax,%ebx
+    if ((b->flags & B_VALID) == 0)
+80105244:	f6 00 02             	testb  $0x2,(%eax)
+80105247:	74 07                	je     80105250 <bread_async+0x20>
+        blksubmit(b, 0);
+    return b;
+}
+80105249:	89 d8                	mov    %ebx,%eax
+8010524b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010524e:	c9                   	leave
+8010524f:	c3                   	ret
+        blksubmit(b, 0);
+80105250:	83 ec 08             	sub    $0x8,%esp
+80105253:	6a 00                	push   $0x0
+80105255:	50                   	push   %eax
+80105256:	e8 65 d3 ff ff       	call   801025c0 <blksubmit>
+}
+8010525b:	89 d8                	mov    %ebx,%eax
+        blksubmit(b, 0);
+8010525d:	83 c4 10             	add    $0x10,%esp
+}
+80105260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105263:	c9                   	leave
+80105264:	c3                   	ret
+80105265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010526c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80105270 <bwrite_async>:
+
+// like bwrite(), but don't wait for the disk:
+// call biowait() before changing the data again or releasing b.
+void
+bwrite_async(struct buf *b)
+{
+80105270:	55                   	push   %ebp
+80105271:	89 e5                	mov    %esp,%ebp
+80105273:	53                   	push   %ebx
+80105274:	83 ec 10             	sub    $0x10,%esp
+80105277:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!holdingsleep(&b->lock))
+8010527a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010527d:	50                   	push   %eax
+8010527e:	e8 cd c9 ff ff       	call   80101c50 <holdingsleep>
+80105283:	83 c4 10             	add    $0x10,%esp
+80105286:	85 c0                	test   %eax,%eax
+80105288:	74 16                	je     801052a0 <bwrite_async+0x30>
+        panic("bwrite_async");
+    b->flags |= B_DIRTY;
+8010528a:	83 0b 04             	orl    $0x4,(%ebx)
+    blksubmit(b, 0);
+8010528d:	83 ec 08             	sub    $0x8,%esp
+80105290:	6a 00                	push   $0x0
+80105292:	53                   	push   %ebx
+80105293:	e8 28 d3 ff ff       	call   801025c0 <blksubmit>
+}
+80105298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010529b:	83 c4 10             	add    $0x10,%esp
+8010529e:	c9                   	leave
+8010529f:	c3                   	ret
+        panic("bwrite_async");
+801052a0:	83 ec 0c             	sub    $0xc,%esp
+801052a3:	68 39 b2 10 80       	push   $0x8010b239
+801052a8:	e8 93 4a 00 00       	call   80109d40 <panic>
+801052ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801052b0 <bwritev>:
+// start writing n locked buffers, sorted by block number, like
+// bwrite_async(). the disk writes runs of them at consecutive
+// blocks in one command.
+void
+bwritev(struct buf **b, int n)
+{
+801052b0:	55                   	push   %ebp
+801052b1:	89 e5                	mov    %esp,%ebp
+801052b3:	57                   	push   %edi
+801052b4:	56                   	push   %esi
+801052b5:	53                   	push   %ebx
+801052b6:	83 ec 0c             	sub    $0xc,%esp
+801052b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+801052bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+    int i;
+
+    for (i = 0; i < n; i++) {
+801052bf:	85 f6                	test   %esi,%esi
+801052c1:	7e 28                	jle    801052eb <bwritev+0x3b>
+801052c3:	31 db                	xor    %ebx,%ebx
+801052c5:	8d 76 00             	lea    0x0(%esi),%esi
+        if (!holdingsleep(&b[i]->lock))
+801052c8:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+801052cb:	83 ec 0c             	sub    $0xc,%esp
+801052ce:	83 c0 0c             	add    $0xc,%eax
+801052d1:	50                   	push   %eax
+801052d2:	e8 79 c9 ff ff       	call   80101c50 <holdingsleep>
+801052d7:	83 c4 10             	add    $0x10,%esp
+801052da:	85 c0                	test   %eax,%eax
+801052dc:	74 24                	je     80105302 <bwritev+0x52>
+            panic("bwritev");
+        b[i]->flags |= B_DIRTY;
+801052de:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+    for (i = 0; i < n; i++) {
+801052e1:	83 c3 01             	add    $0x1,%ebx
+        b[i]->flags |= B_DIRTY;
+801052e4:	83 08 04             	orl    $0x4,(%eax)
+    for (i = 0; i < n; i++) {
+801052e7:	39 de                	cmp    %ebx,%esi
+801052e9:	75 dd                	jne    801052c8 <bwritev+0x18>
+    }
+    blksubmitv(b, n, 0);
+801052eb:	83 ec 04             	sub    $0x4,%esp
+801052ee:	6a 00                	push   $0x0
+801052f0:	56                   	push   %esi
+801052f1:	57                   	push   %edi
+801052f2:	e8 59 d3 ff ff       	call   80102650 <blksubmitv>
+}
+801052f7:	83 c4 10             	add    $0x10,%esp
+801052fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801052fd:	5b                   	pop    %ebx
+801052fe:	5e                   	pop    %esi
+801052ff:	5f                   	pop    %edi
+80105300:	5d                   	pop    %ebp
+80105301:	c3                   	ret
+            panic("bwritev");
+80105302:	83 ec 0c             	sub    $0xc,%esp
+80105305:	68 46 b2 10 80       	push   $0x8010b246
+8010530a:	e8 31 4a 00 00       	call   80109d40 <panic>
+8010530f:	90                   	nop
+
+80105310 <bwrite_range>:
+
+// write n locked buffers for consecutive blocks, like bwrite()
+void
+bwrite_range(struct buf **b, int n)
+{
+80105310:	55                   	push   %ebp
+80105311:	89 e5                	mov    %esp,%ebp
+80105313:	57                   	push   %edi
+80105314:	56                   	push   %esi
+80105315:	53                   	push   %ebx
+80105316:	83 ec 14             	sub    $0x14,%esp
+80105319:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010531c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    int i;
+
+    bwritev(b, n);
+8010531f:	56                   	push   %esi
+80105320:	57                   	push   %edi
+80105321:	e8 8a ff ff ff       	call   801052b0 <bwritev>
+    for (i = 0; i < n; i++)
+80105326:	83 c4 10             	add    $0x10,%esp
+80105329:	85 f6                	test   %esi,%esi
+8010532b:	7e 18                	jle    80105345 <bwrite_range+0x35>
+8010532d:	31 db                	xor    %ebx,%ebx
+8010532f:	90                   	nop
+        blkiowait(b[i]);
+80105330:	83 ec 0c             	sub    $0xc,%esp
+80105333:	ff 34 9f             	push   (%edi,%ebx,4)
+    for (i = 0; i < n; i++)
+80105336:	83 c3 01             	add    $0x1,%ebx
+        blkiowait(b[i]);
+80105339:	e8 e2 d3 ff ff       	call   80102720 <blkiowait>
+    for (i = 0; i < n; i++)
+8010533e:	83 c4 10             	add    $0x10,%esp
+80105341:	39 de                	cmp    %ebx,%esi
+80105343:	75 eb                	jne    80105330 <bwrite_range+0x20>
+}
+80105345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105348:	5b                   	pop    %ebx
+80105349:	5e                   	pop    %esi
+8010534a:	5f                   	pop    %edi
+8010534b:	5d                   	pop    %ebp
+8010534c:	c3                   	ret
+8010534d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105350 <biowait>:
+
+// wait for the disk request started on b, which must be locked
+void
+biowait(struct buf *b)
+{
+80105350:	55                   	push   %ebp
+80105351:	89 e5                	mov    %esp,%ebp
+80105353:	53                   	push   %ebx
+80105354:	83 ec 10             	sub    $0x10,%esp
+80105357:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!holdingsleep(&b->lock))
+8010535a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010535d:	50                   	push   %eax
+8010535e:	e8 ed c8 ff ff       	call   80101c50 <holdingsleep>
+80105363:	83 c4 10             	add    $0x10,%esp
+80105366:	85 c0                	test   %eax,%eax
+80105368:	74 0c                	je     80105376 <biowait+0x26>
+        panic("biowait");
+    blkiowait(b);
+8010536a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010536d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105370:	c9                   	leave
+    blkiowait(b);
+80105371:	e9 aa d3 ff ff       	jmp    80102720 <blkiowait>
+        panic("biowait");
+80105376:	83 ec 0c             	sub    $0xc,%esp
+80105379:	68 4e b2 10 80       	push   $0x8010b24e
+8010537e:	e8 bd 49 00 00       	call   80109d40 <panic>
+80105383:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010538a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105390 <bcachedump>:
+
+// hit ratio and size, for tuning BCACHEPCT
+void
+bcachedump(void)
+{
+80105390:	55                   	push   %ebp
+80105391:	89 e5                	mov    %esp,%ebp
+80105393:	56                   	push   %esi
+80105394:	53                   	push   %ebx
+    uint hit, miss;
+
+    hit = kstatread(KS_BCACHEHIT);
+80105395:	83 ec 0c             	sub    $0xc,%esp
+80105398:	6a 04                	push   $0x4
+8010539a:	e8 61 11 00 00       	call   80106500 <kstatread>
+    miss = kstatread(KS_BCACHEMISS);
+8010539f:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+    hit = kstatread(KS_BCACHEHIT);
+801053a6:	89 c3                	mov    %eax,%ebx
+    miss = kstatread(KS_BCACHEMISS);
+801053a8:	e8 53 11 00 00       	call   80106500 <kstatread>
+801053ad:	89 c6                	mov    %eax,%esi
+    cprintf("bcache: %d buffers (%d KB), %d hits, %d misses", bcache.nbuf, bcache.nbuf / (1024 / BSIZE), hit, miss);
+801053af:	a1 40 3d 1b 80       	mov    0x801b3d40,%eax
+801053b4:	89 34 24             	mov    %esi,(%esp)
+801053b7:	89 c2                	mov    %eax,%edx
+801053b9:	53                   	push   %ebx
+801053ba:	d1 ea                	shr    %edx
+801053bc:	52                   	push   %edx
+801053bd:	50                   	push   %eax
+801053be:	68 c4 b2 10 80       	push   $0x8010b2c4
+801053c3:	e8 f8 49 00 00       	call   80109dc0 <cprintf>
+    // keep hit * 100 in 32 bits
+    while (hit + miss > 0x1000000) {
+801053c8:	8d 0c 33             	lea    (%ebx,%esi,1),%ecx
+801053cb:	83 c4 20             	add    $0x20,%esp
+801053ce:	81 f9 00 00 00 01    	cmp    $0x1000000,%ecx
+801053d4:	76 19                	jbe    801053ef <bcachedump+0x5f>
+801053d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801053dd:	8d 76 00             	lea    0x0(%esi),%esi
+        hit >>= 1;
+801053e0:	d1 eb                	shr    %ebx
+        miss >>= 1;
+801053e2:	d1 ee                	shr    %esi
+    while (hit + miss > 0x1000000) {
+801053e4:	8d 0c 33             	lea    (%ebx,%esi,1),%ecx
+801053e7:	81 f9 00 00 00 01    	cmp    $0x1000000,%ecx
+801053ed:	77 f1                	ja     801053e0 <bcachedump+0x50>
+    }
+    if (hit + miss)
+801053ef:	85 c9                	test   %ecx,%ecx
+801053f1:	75 1d                	jne    80105410 <bcachedump+0x80>
+        cprintf(", hit ratio %d%%", hit * 100 / (hit + miss));
+    cprintf("\n");
+801053f3:	83 ec 0c             	sub    $0xc,%esp
+801053f6:	68 51 af 10 80       	push   $0x8010af51
+801053fb:	e8 c0 49 00 00       	call   80109dc0 <cprintf>
+}
+80105400:	83 c4 10             	add    $0x10,%esp
+80105403:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105406:	5b                   	pop    %ebx
+80105407:	5e                   	pop    %esi
+80105408:	5d                   	pop    %ebp
+80105409:	c3                   	ret
+8010540a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        cprintf(", hit ratio %d%%", hit * 100 / (hit + miss));
+80105410:	6b c3 64             	imul   $0x64,%ebx,%eax
+80105413:	31 d2                	xor    %edx,%edx
+80105415:	83 ec 08             	sub    $0x8,%esp
+80105418:	f7 f1                	div    %ecx
+8010541a:	50                   	push   %eax
+8010541b:	68 56 b2 10 80       	push   $0x8010b256
+80105420:	e8 9b 49 00 00       	call   80109dc0 <cprintf>
+80105425:	83 c4 10             	add    $0x10,%esp
+80105428:	eb c9                	jmp    801053f3 <bcachedump+0x63>
+8010542a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105430 <brelse>:
+
+// release a locked buffer
+// once unused, move it according to the replacement policy, see above
+void
+brelse(struct buf *b)
+{
+80105430:	55                   	push   %ebp
+80105431:	89 e5                	mov    %esp,%ebp
+80105433:	57                   	push   %edi
+80105434:	56                   	push   %esi
+80105435:	53                   	push   %ebx
+80105436:	83 ec 28             	sub    $0x28,%esp
+80105439:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    struct buf *x;
+    struct mcsnode me;
+    int reref;
+
+    if (!holdingsleep(&b->lock))
+8010543c:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010543f:	56                   	push   %esi
+80105440:	e8 0b c8 ff ff       	call   80101c50 <holdingsleep>
+80105445:	83 c4 10             	add    $0x10,%esp
+80105448:	85 c0                	test   %eax,%eax
+8010544a:	0f 84 b0 01 00 00    	je     80105600 <brelse+0x1d0>
+        panic("brelse: must hold bcache sleeplock");
+
+    reref = b->reref;
+    releasesleep(&b->lock);
+80105450:	83 ec 0c             	sub    $0xc,%esp
+    reref = b->reref;
+80105453:	8b bb 88 00 00 00    	mov    0x88(%ebx),%edi
+    releasesleep(&b->lock);
+80105459:	56                   	push   %esi
+8010545a:	e8 61 c7 ff ff       	call   80101bc0 <releasesleep>
+
+    if (__sync_sub_and_fetch(&b->refcnt, 1) == 0) {
+8010545f:	f0 83 6b 74 01       	lock subl $0x1,0x74(%ebx)
+80105464:	0f 94 c0             	sete   %al
+80105467:	83 c4 10             	add    $0x10,%esp
+8010546a:	84 c0                	test   %al,%al
+8010546c:	75 12                	jne    80105480 <brelse+0x50>
+            }
+        }
+        // probation is a fifo; a release doesn't move the buffer
+        releasemcs(&bcache.lrulock, &me);
+    }
+}
+8010546e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105471:	5b                   	pop    %ebx
+80105472:	5e                   	pop    %esi
+80105473:	5f                   	pop    %edi
+80105474:	5d                   	pop    %ebp
+80105475:	c3                   	ret
+80105476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010547d:	8d 76 00             	lea    0x0(%esi),%esi
+        acquiremcs(&bcache.lrulock, &me);
+80105480:	83 ec 08             	sub    $0x8,%esp
+80105483:	8d 75 e0             	lea    -0x20(%ebp),%esi
+80105486:	56                   	push   %esi
+80105487:	68 00 3d 1b 80       	push   $0x801b3d00
+8010548c:	e8 bf be ff ff       	call   80101350 <acquiremcs>
+        if (bcache.strictlru) {
+80105491:	a1 50 41 1b 80       	mov    0x801b4150,%eax
+80105496:	83 c4 10             	add    $0x10,%esp
+80105499:	85 c0                	test   %eax,%eax
+8010549b:	0f 85 0f 01 00 00    	jne    801055b0 <brelse+0x180>
+        } else if (b->queue == BQ_PROTECTED || reref) {
+801054a1:	83 bb 80 00 00 00 01 	cmpl   $0x1,0x80(%ebx)
+801054a8:	74 26                	je     801054d0 <brelse+0xa0>
+801054aa:	85 ff                	test   %edi,%edi
+801054ac:	75 22                	jne    801054d0 <brelse+0xa0>
+        releasemcs(&bcache.lrulock, &me);
+801054ae:	83 ec 08             	sub    $0x8,%esp
+801054b1:	56                   	push   %esi
+801054b2:	68 00 3d 1b 80       	push   $0x801b3d00
+801054b7:	e8 64 bd ff ff       	call   80101220 <releasemcs>
+801054bc:	83 c4 10             	add    $0x10,%esp
+}
+801054bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801054c2:	5b                   	pop    %ebx
+801054c3:	5e                   	pop    %esi
+801054c4:	5f                   	pop    %edi
+801054c5:	5d                   	pop    %ebp
+801054c6:	c3                   	ret
+801054c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801054ce:	66 90                	xchg   %ax,%ax
+    b->next->prev = b->prev;
+801054d0:	8b 53 7c             	mov    0x7c(%ebx),%edx
+801054d3:	8b 43 78             	mov    0x78(%ebx),%eax
+801054d6:	89 42 78             	mov    %eax,0x78(%edx)
+    b->prev->next = b->next;
+801054d9:	8b 53 7c             	mov    0x7c(%ebx),%edx
+801054dc:	89 50 7c             	mov    %edx,0x7c(%eax)
+    bcache.nlist[b->queue]--;
+801054df:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+            if (bcache.nlist[BQ_PROTECTED] > bcache.nbuf * BPROTPCT / 100) {
+801054e5:	6b 15 40 3d 1b 80 4b 	imul   $0x4b,0x801b3d40,%edx
+    bcache.nlist[b->queue]--;
+801054ec:	83 2c 85 80 43 1b 80 	subl   $0x1,-0x7fe4bc80(,%eax,4)
+801054f3:	01 
+    b->queue = q;
+801054f4:	c7 83 80 00 00 00 01 	movl   $0x1,0x80(%ebx)
+801054fb:	00 00 00 
+    b->next = head->next;
+801054fe:	a1 fc 42 1b 80       	mov    0x801b42fc,%eax
+    b->prev = head;
+80105503:	c7 43 78 80 42 1b 80 	movl   $0x801b4280,0x78(%ebx)
+    b->next = head->next;
+8010550a:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    head->next->prev = b;
+8010550d:	a1 fc 42 1b 80       	mov    0x801b42fc,%eax
+80105512:	89 58 78             	mov    %ebx,0x78(%eax)
+            if (bcache.nlist[BQ_PROTECTED] > bcache.nbuf * BPROTPCT / 100) {
+80105515:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+8010551a:	f7 e2                	mul    %edx
+    bcache.nlist[q]++;
+8010551c:	83 05 84 43 1b 80 01 	addl   $0x1,0x801b4384
+    head->next = b;
+80105523:	89 1d fc 42 1b 80    	mov    %ebx,0x801b42fc
+            b->reref = 0;
+80105529:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+80105530:	00 00 00 
+            if (bcache.nlist[BQ_PROTECTED] > bcache.nbuf * BPROTPCT / 100) {
+80105533:	c1 ea 05             	shr    $0x5,%edx
+80105536:	3b 15 84 43 1b 80    	cmp    0x801b4384,%edx
+8010553c:	0f 83 6c ff ff ff    	jae    801054ae <brelse+0x7e>
+                x = bcache.list[BQ_PROTECTED].prev;
+80105542:	a1 f8 42 1b 80       	mov    0x801b42f8,%eax
+    b->next->prev = b->prev;
+80105547:	8b 48 7c             	mov    0x7c(%eax),%ecx
+8010554a:	8b 50 78             	mov    0x78(%eax),%edx
+8010554d:	89 51 78             	mov    %edx,0x78(%ecx)
+    b->prev->next = b->next;
+80105550:	8b 48 7c             	mov    0x7c(%eax),%ecx
+80105553:	89 4a 7c             	mov    %ecx,0x7c(%edx)
+    bcache.nlist[b->queue]--;
+80105556:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+8010555c:	83 2c 95 80 43 1b 80 	subl   $0x1,-0x7fe4bc80(,%edx,4)
+80105563:	01 
+                x->reftick = ticks;
+80105564:	8b 15 20 c0 1c 80    	mov    0x801cc020,%edx
+                x->reref = 0;
+8010556a:	c7 80 88 00 00 00 00 	movl   $0x0,0x88(%eax)
+80105571:	00 00 00 
+                x->reftick = ticks;
+80105574:	89 90 84 00 00 00    	mov    %edx,0x84(%eax)
+    b->queue = q;
+8010557a:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%eax)
+80105581:	00 00 00 
+    b->next = head->next;
+80105584:	8b 15 fc 41 1b 80    	mov    0x801b41fc,%edx
+    b->prev = head;
+8010558a:	c7 40 78 80 41 1b 80 	movl   $0x801b4180,0x78(%eax)
+    b->next = head->next;
+80105591:	89 50 7c             	mov    %edx,0x7c(%eax)
+    head->next->prev = b;
+80105594:	8b 15 fc 41 1b 80    	mov    0x801b41fc,%edx
+8010559a:	89 42 78             	mov    %eax,0x78(%edx)
+    head->next = b;
+8010559d:	a3 fc 41 1b 80       	mov    %eax,0x801b41fc
+    bcache.nlist[q]++;
+801055a2:	83 05 80 43 1b 80 01 	addl   $0x1,0x801b4380
+}
+801055a9:	e9 00 ff ff ff       	jmp    801054ae <brelse+0x7e>
+801055ae:	66 90                	xchg   %ax,%ax
+    b->next->prev = b->prev;
+801055b0:	8b 53 7c             	mov    0x7c(%ebx),%edx
+801055b3:	8b 43 78             	mov    0x78(%ebx),%eax
+801055b6:	89 42 78             	mov    %eax,0x78(%edx)
+    b->prev->next = b->next;
+801055b9:	8b 53 7c             	mov    0x7c(%ebx),%edx
+801055bc:	89 50 7c             	mov    %edx,0x7c(%eax)
+    bcache.nlist[b->queue]--;
+801055bf:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+801055c5:	83 2c 85 80 43 1b 80 	subl   $0x1,-0x7fe4bc80(,%eax,4)
+801055cc:	01 
+    b->queue = q;
+801055cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+801055d4:	00 00 00 
+    b->next = head->next;
+801055d7:	a1 fc 41 1b 80       	mov    0x801b41fc,%eax
+    b->prev = head;
+801055dc:	c7 43 78 80 41 1b 80 	movl   $0x801b4180,0x78(%ebx)
+    b->next = head->next;
+801055e3:	89 43 7c             	mov    %eax,0x7c(%ebx)
+    head->next->prev = b;
+801055e6:	a1 fc 41 1b 80       	mov    0x801b41fc,%eax
+801055eb:	89 58 78             	mov    %ebx,0x78(%eax)
+    head->next = b;
+801055ee:	89 1d fc 41 1b 80    	mov    %ebx,0x801b41fc
+    bcache.nlist[q]++;
+801055f4:	83 05 80 43 1b 80 01 	addl   $0x1,0x801b4380
+}
+801055fb:	e9 ae fe ff ff       	jmp    801054ae <brelse+0x7e>
+        panic("brelse: must hold bcache sleeplock");
+80105600:	83 ec 0c             	sub    $0xc,%esp
+80105603:	68 f4 b2 10 80       	push   $0x8010b2f4
+80105608:	e8 33 47 00 00       	call   80109d40 <panic>
+8010560d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105610 <breadahead>:
+{
+80105610:	55                   	push   %ebp
+80105611:	89 e5                	mov    %esp,%ebp
+80105613:	57                   	push   %edi
+80105614:	56                   	push   %esi
+80105615:	53                   	push   %ebx
+80105616:	83 ec 5c             	sub    $0x5c,%esp
+80105619:	8b 75 10             	mov    0x10(%ebp),%esi
+8010561c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    while (n > 0) {
+8010561f:	85 f6                	test   %esi,%esi
+80105621:	0f 8e 2b 01 00 00    	jle    80105752 <breadahead+0x142>
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80105627:	8b 45 08             	mov    0x8(%ebp),%eax
+8010562a:	c1 e0 05             	shl    $0x5,%eax
+8010562d:	2b 45 08             	sub    0x8(%ebp),%eax
+80105630:	89 45 9c             	mov    %eax,-0x64(%ebp)
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+80105633:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105637:	90                   	nop
+80105638:	8b 45 9c             	mov    -0x64(%ebp),%eax
+8010563b:	31 d2                	xor    %edx,%edx
+8010563d:	01 f8                	add    %edi,%eax
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+8010563f:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+80105642:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+80105645:	89 d3                	mov    %edx,%ebx
+80105647:	eb 1b                	jmp    80105664 <breadahead+0x54>
+80105649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+                __sync_sub_and_fetch(&b->refcnt, 1);
+80105650:	f0 83 68 74 01       	lock subl $0x1,0x74(%eax)
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+80105655:	83 ee 01             	sub    $0x1,%esi
+80105658:	83 c7 01             	add    $0x1,%edi
+8010565b:	85 f6                	test   %esi,%esi
+8010565d:	7e 79                	jle    801056d8 <breadahead+0xc8>
+8010565f:	83 fb 0f             	cmp    $0xf,%ebx
+80105662:	7f 74                	jg     801056d8 <breadahead+0xc8>
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80105664:	8b 0d 48 3d 1b 80    	mov    0x801b3d48,%ecx
+8010566a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+8010566d:	8d 51 ff             	lea    -0x1(%ecx),%edx
+80105670:	29 f0                	sub    %esi,%eax
+            if ((b = blookup(bbucket(dev, blockno), dev, blockno)) != 0) {
+80105672:	89 f9                	mov    %edi,%ecx
+    uint h = (dev * 31 + blockno) & (bcache.nbucket - 1);
+80105674:	21 d0                	and    %edx,%eax
+    return &bcache.bucket[h / BKTPP][h % BKTPP];
+80105676:	89 c2                	mov    %eax,%edx
+80105678:	83 e0 1f             	and    $0x1f,%eax
+8010567b:	c1 ea 05             	shr    $0x5,%edx
+8010567e:	c1 e0 07             	shl    $0x7,%eax
+80105681:	03 04 95 4c 3d 1b 80 	add    -0x7fe4c2b4(,%edx,4),%eax
+            if ((b = blookup(bbucket(dev, blockno), dev, blockno)) != 0) {
+80105688:	8b 55 08             	mov    0x8(%ebp),%edx
+8010568b:	e8 e0 f0 ff ff       	call   80104770 <blookup>
+80105690:	85 c0                	test   %eax,%eax
+80105692:	75 bc                	jne    80105650 <breadahead+0x40>
+            b = bget(dev, blockno);
+80105694:	8b 45 08             	mov    0x8(%ebp),%eax
+80105697:	89 fa                	mov    %edi,%edx
+80105699:	e8 42 f5 ff ff       	call   80104be0 <bget>
+            if (b->flags & B_VALID) {
+8010569e:	f6 00 02             	testb  $0x2,(%eax)
+801056a1:	0f 85 b9 00 00 00    	jne    80105760 <breadahead+0x150>
+            run[m++] = b;
+801056a7:	8d 4b 01             	lea    0x1(%ebx),%ecx
+            kstatinc(KS_READAHEAD);
+801056aa:	83 ec 0c             	sub    $0xc,%esp
+            run[m++] = b;
+801056ad:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+801056b1:	83 ee 01             	sub    $0x1,%esi
+            b->reref = -1;
+801056b4:	c7 80 88 00 00 00 ff 	movl   $0xffffffff,0x88(%eax)
+801056bb:	ff ff ff 
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+801056be:	83 c7 01             	add    $0x1,%edi
+            run[m++] = b;
+801056c1:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+            kstatinc(KS_READAHEAD);
+801056c4:	6a 09                	push   $0x9
+801056c6:	e8 05 0e 00 00       	call   801064d0 <kstatinc>
+            run[m++] = b;
+801056cb:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+            kstatinc(KS_READAHEAD);
+801056ce:	83 c4 10             	add    $0x10,%esp
+        for (m = 0; n > 0 && m < BRUN; n--, blockno++) {
+801056d1:	85 f6                	test   %esi,%esi
+801056d3:	7f 8a                	jg     8010565f <breadahead+0x4f>
+801056d5:	8d 76 00             	lea    0x0(%esi),%esi
+        for (i = 0; i < m; i++)
+801056d8:	89 da                	mov    %ebx,%edx
+801056da:	85 db                	test   %ebx,%ebx
+801056dc:	0f 84 8f 00 00 00    	je     80105771 <breadahead+0x161>
+801056e2:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+801056e5:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+801056e8:	8d 4c 95 a8          	lea    -0x58(%ebp,%edx,4),%ecx
+801056ec:	89 d8                	mov    %ebx,%eax
+801056ee:	66 90                	xchg   %ax,%ax
+            __sync_add_and_fetch(&run[i]->refcnt, 1);
+801056f0:	8b 10                	mov    (%eax),%edx
+801056f2:	f0 83 42 74 01       	lock addl $0x1,0x74(%edx)
+        for (i = 0; i < m; i++)
+801056f7:	83 c0 04             	add    $0x4,%eax
+801056fa:	39 c1                	cmp    %eax,%ecx
+801056fc:	75 f2                	jne    801056f0 <breadahead+0xe0>
+801056fe:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+        blksubmitv(run, m, bdoneahead);
+80105701:	83 ec 04             	sub    $0x4,%esp
+80105704:	8d 45 a8             	lea    -0x58(%ebp),%eax
+80105707:	89 4d a4             	mov    %ecx,-0x5c(%ebp)
+8010570a:	68 f0 47 10 80       	push   $0x801047f0
+8010570f:	52                   	push   %edx
+80105710:	50                   	push   %eax
+80105711:	e8 3a cf ff ff       	call   80102650 <blksubmitv>
+80105716:	89 75 a0             	mov    %esi,-0x60(%ebp)
+80105719:	89 de                	mov    %ebx,%esi
+8010571b:	8b 5d a4             	mov    -0x5c(%ebp),%ebx
+8010571e:	83 c4 10             	add    $0x10,%esp
+80105721:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            releasesleep(&run[i]->lock);
+80105728:	8b 06                	mov    (%esi),%eax
+8010572a:	83 ec 0c             	sub    $0xc,%esp
+8010572d:	8d 50 0c             	lea    0xc(%eax),%edx
+80105730:	52                   	push   %edx
+80105731:	e8 8a c4 ff ff       	call   80101bc0 <releasesleep>
+            __sync_sub_and_fetch(&run[i]->refcnt, 1);
+80105736:	8b 16                	mov    (%esi),%edx
+80105738:	f0 83 6a 74 01       	lock subl $0x1,0x74(%edx)
+        for (i = 0; i < m; i++) {
+8010573d:	83 c6 04             	add    $0x4,%esi
+80105740:	83 c4 10             	add    $0x10,%esp
+80105743:	39 f3                	cmp    %esi,%ebx
+80105745:	75 e1                	jne    80105728 <breadahead+0x118>
+80105747:	8b 75 a0             	mov    -0x60(%ebp),%esi
+    while (n > 0) {
+8010574a:	85 f6                	test   %esi,%esi
+8010574c:	0f 8f e6 fe ff ff    	jg     80105638 <breadahead+0x28>
+}
+80105752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105755:	5b                   	pop    %ebx
+80105756:	5e                   	pop    %esi
+80105757:	5f                   	pop    %edi
+80105758:	5d                   	pop    %ebp
+80105759:	c3                   	ret
+8010575a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+                brelse(b);
+80105760:	83 ec 0c             	sub    $0xc,%esp
+80105763:	50                   	push   %eax
+80105764:	e8 c7 fc ff ff       	call   80105430 <brelse>
+                continue;
+80105769:	83 c4 10             	add    $0x10,%esp
+8010576c:	e9 e4 fe ff ff       	jmp    80105655 <breadahead+0x45>
+        blksubmitv(run, m, bdoneahead);
+80105771:	83 ec 04             	sub    $0x4,%esp
+80105774:	8d 45 a8             	lea    -0x58(%ebp),%eax
+80105777:	68 f0 47 10 80       	push   $0x801047f0
+8010577c:	6a 00                	push   $0x0
+8010577e:	50                   	push   %eax
+8010577f:	e8 cc ce ff ff       	call   80102650 <blksubmitv>
+80105784:	83 c4 10             	add    $0x10,%esp
+80105787:	eb c1                	jmp    8010574a <breadahead+0x13a>
+80105789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105790 <bcachebench>:
+#define BENCHSCAN   4096
+#define BENCHSTRIDE 64
+
+void
+bcachebench(void)
+{
+80105790:	55                   	push   %ebp
+80105791:	89 e5                	mov    %esp,%ebp
+80105793:	57                   	push   %edi
+80105794:	56                   	push   %esi
+80105795:	53                   	push   %ebx
+80105796:	83 ec 2c             	sub    $0x2c,%esp
+    static char *names[2] = { "2q", "lru" };
+    uint target, first, i, h, m, h0, m0, lh, lm;
+    struct inode *ip;
+    int lru;
+
+    if (sb.size == 0) {
+80105799:	a1 80 0c 1c 80       	mov    0x801c0c80,%eax
+8010579e:	85 c0                	test   %eax,%eax
+801057a0:	0f 84 d3 01 00 00    	je     80105979 <bcachebench+0x1e9>
+        return;
+    }
+
+    // shrink to the minimum, and keep bget() from growing back
+    target = bcache.target;
+    bshrink(bcache.nbuf);
+801057a6:	8b 35 40 3d 1b 80    	mov    0x801b3d40,%esi
+    target = bcache.target;
+801057ac:	8b 1d 44 3d 1b 80    	mov    0x801b3d44,%ebx
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+801057b2:	83 fe 1e             	cmp    $0x1e,%esi
+801057b5:	0f 87 9f 01 00 00    	ja     8010595a <bcachebench+0x1ca>
+    bcache.target = bcache.nbuf;
+
+    first = sb.bmapstart + 1;   // data blocks follow the bitmap
+801057bb:	a1 98 0c 1c 80       	mov    0x801c0c98,%eax
+801057c0:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+    bcache.target = bcache.nbuf;
+801057c3:	89 35 44 3d 1b 80    	mov    %esi,0x801b3d44
+    for (lru = 0; lru < 2; lru++) {
+801057c9:	31 f6                	xor    %esi,%esi
+    first = sb.bmapstart + 1;   // data blocks follow the bitmap
+801057cb:	8d 78 01             	lea    0x1(%eax),%edi
+        bcache.strictlru = lru;
+        h = kstatread(KS_BCACHEHIT);
+801057ce:	83 ec 0c             	sub    $0xc,%esp
+        bcache.strictlru = lru;
+801057d1:	89 35 50 41 1b 80    	mov    %esi,0x801b4150
+        m = kstatread(KS_BCACHEMISS);
+        lh = lm = 0;
+        for (i = 0; i < BENCHSCAN; i++) {
+801057d7:	31 db                	xor    %ebx,%ebx
+        h = kstatread(KS_BCACHEHIT);
+801057d9:	6a 04                	push   $0x4
+801057db:	e8 20 0d 00 00       	call   80106500 <kstatread>
+801057e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+        m = kstatread(KS_BCACHEMISS);
+801057e3:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+801057ea:	e8 11 0d 00 00       	call   80106500 <kstatread>
+        lh = lm = 0;
+801057ef:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+        m = kstatread(KS_BCACHEMISS);
+801057f6:	83 c4 10             	add    $0x10,%esp
+801057f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+        lh = lm = 0;
+801057fc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        for (i = 0; i < BENCHSCAN; i++) {
+80105803:	89 75 d0             	mov    %esi,-0x30(%ebp)
+80105806:	eb 28                	jmp    80105830 <bcachebench+0xa0>
+80105808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010580f:	90                   	nop
+            brelse(bread(ROOTDEV, first + i % (sb.size - first)));
+80105810:	83 ec 0c             	sub    $0xc,%esp
+80105813:	56                   	push   %esi
+80105814:	e8 17 fc ff ff       	call   80105430 <brelse>
+            if (i % BENCHSTRIDE == 0) {
+80105819:	83 c4 10             	add    $0x10,%esp
+8010581c:	f6 c3 3f             	test   $0x3f,%bl
+8010581f:	74 3f                	je     80105860 <bcachebench+0xd0>
+        for (i = 0; i < BENCHSCAN; i++) {
+80105821:	83 c3 01             	add    $0x1,%ebx
+80105824:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+8010582a:	0f 84 b7 00 00 00    	je     801058e7 <bcachebench+0x157>
+            brelse(bread(ROOTDEV, first + i % (sb.size - first)));
+80105830:	8b 0d 80 0c 1c 80    	mov    0x801c0c80,%ecx
+80105836:	89 d8                	mov    %ebx,%eax
+80105838:	31 d2                	xor    %edx,%edx
+8010583a:	29 f9                	sub    %edi,%ecx
+8010583c:	f7 f1                	div    %ecx
+    b = bget(dev, blockno);
+8010583e:	b8 01 00 00 00       	mov    $0x1,%eax
+            brelse(bread(ROOTDEV, first + i % (sb.size - first)));
+80105843:	01 fa                	add    %edi,%edx
+    b = bget(dev, blockno);
+80105845:	e8 96 f3 ff ff       	call   80104be0 <bget>
+8010584a:	89 c6                	mov    %eax,%esi
+    if ((b->flags & B_VALID) == 0) {
+8010584c:	f6 00 02             	testb  $0x2,(%eax)
+8010584f:	75 bf                	jne    80105810 <bcachebench+0x80>
+        blkrw(b);
+80105851:	83 ec 0c             	sub    $0xc,%esp
+80105854:	50                   	push   %eax
+80105855:	e8 36 cf ff ff       	call   80102790 <blkrw>
+8010585a:	83 c4 10             	add    $0x10,%esp
+8010585d:	eb b1                	jmp    80105810 <bcachebench+0x80>
+8010585f:	90                   	nop
+                h0 = kstatread(KS_BCACHEHIT);
+80105860:	83 ec 0c             	sub    $0xc,%esp
+80105863:	6a 04                	push   $0x4
+80105865:	e8 96 0c 00 00       	call   80106500 <kstatread>
+                m0 = kstatread(KS_BCACHEMISS);
+8010586a:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+                h0 = kstatread(KS_BCACHEHIT);
+80105871:	89 c6                	mov    %eax,%esi
+                m0 = kstatread(KS_BCACHEMISS);
+80105873:	e8 88 0c 00 00       	call   80106500 <kstatread>
+80105878:	89 45 dc             	mov    %eax,-0x24(%ebp)
+                begin_op();
+8010587b:	e8 e0 04 00 00       	call   80105d60 <begin_op>
+                if ((ip = namei("/.")) != 0)
+80105880:	c7 04 24 84 b2 10 80 	movl   $0x8010b284,(%esp)
+80105887:	e8 24 1f 00 00       	call   801077b0 <namei>
+8010588c:	83 c4 10             	add    $0x10,%esp
+8010588f:	85 c0                	test   %eax,%eax
+80105891:	74 0c                	je     8010589f <bcachebench+0x10f>
+                    iput(ip);
+80105893:	83 ec 0c             	sub    $0xc,%esp
+80105896:	50                   	push   %eax
+80105897:	e8 34 15 00 00       	call   80106dd0 <iput>
+8010589c:	83 c4 10             	add    $0x10,%esp
+                end_op();
+8010589f:	e8 3c 05 00 00       	call   80105de0 <end_op>
+                lh += kstatread(KS_BCACHEHIT) - h0;
+801058a4:	83 ec 0c             	sub    $0xc,%esp
+        for (i = 0; i < BENCHSCAN; i++) {
+801058a7:	83 c3 01             	add    $0x1,%ebx
+                lh += kstatread(KS_BCACHEHIT) - h0;
+801058aa:	6a 04                	push   $0x4
+801058ac:	e8 4f 0c 00 00       	call   80106500 <kstatread>
+801058b1:	89 c2                	mov    %eax,%edx
+801058b3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801058b6:	29 f0                	sub    %esi,%eax
+801058b8:	01 d0                	add    %edx,%eax
+801058ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+                lm += kstatread(KS_BCACHEMISS) - m0;
+801058bd:	c7 04 24 05 00 00 00 	movl   $0x5,(%esp)
+801058c4:	e8 37 0c 00 00       	call   80106500 <kstatread>
+801058c9:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801058cc:	83 c4 10             	add    $0x10,%esp
+801058cf:	89 c2                	mov    %eax,%edx
+801058d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801058d4:	29 f0                	sub    %esi,%eax
+801058d6:	01 d0                	add    %edx,%eax
+801058d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+        for (i = 0; i < BENCHSCAN; i++) {
+801058db:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+801058e1:	0f 85 49 ff ff ff    	jne    80105830 <bcachebench+0xa0>
+            }
+        }
+        cprintf("bcachebench: %s, %d buffers: lookups %d hits %d misses, all %d hits %d misses\n",
+                names[lru], bcache.nbuf, lh, lm, kstatread(KS_BCACHEHIT) - h, kstatread(KS_BCACHEMISS) - m);
+801058e7:	83 ec 0c             	sub    $0xc,%esp
+801058ea:	8b 75 d0             	mov    -0x30(%ebp),%esi
+801058ed:	6a 05                	push   $0x5
+801058ef:	e8 0c 0c 00 00       	call   80106500 <kstatread>
+        cprintf("bcachebench: %s, %d buffers: lookups %d hits %d misses, all %d hits %d misses\n",
+801058f4:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+                names[lru], bcache.nbuf, lh, lm, kstatread(KS_BCACHEHIT) - h, kstatread(KS_BCACHEMISS) - m);
+801058f7:	c7 04 24 04 00 00 00 	movl   $0x4,(%esp)
+        cprintf("bcachebench: %s, %d buffers: lookups %d hits %d misses, all %d hits %d misses\n",
+801058fe:	29 d8                	sub    %ebx,%eax
+80105900:	89 c3                	mov    %eax,%ebx
+                names[lru], bcache.nbuf, lh, lm, kstatread(KS_BCACHEHIT) - h, kstatread(KS_BCACHEMISS) - m);
+80105902:	e8 f9 0b 00 00       	call   80106500 <kstatread>
+        cprintf("bcachebench: %s, %d buffers: lookups %d hits %d misses, all %d hits %d misses\n",
+80105907:	83 c4 0c             	add    $0xc,%esp
+8010590a:	53                   	push   %ebx
+8010590b:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+8010590e:	29 d8                	sub    %ebx,%eax
+80105910:	50                   	push   %eax
+80105911:	ff 75 e0             	push   -0x20(%ebp)
+80105914:	ff 75 e4             	push   -0x1c(%ebp)
+80105917:	ff 35 40 3d 1b 80    	push   0x801b3d40
+8010591d:	ff 34 b5 68 b3 10 80 	push   -0x7fef4c98(,%esi,4)
+80105924:	68 18 b3 10 80       	push   $0x8010b318
+80105929:	e8 92 44 00 00       	call   80109dc0 <cprintf>
+    for (lru = 0; lru < 2; lru++) {
+8010592e:	83 c4 20             	add    $0x20,%esp
+80105931:	85 f6                	test   %esi,%esi
+80105933:	75 0a                	jne    8010593f <bcachebench+0x1af>
+80105935:	be 01 00 00 00       	mov    $0x1,%esi
+8010593a:	e9 8f fe ff ff       	jmp    801057ce <bcachebench+0x3e>
+    }
+    bcache.strictlru = 0;
+8010593f:	c7 05 50 41 1b 80 00 	movl   $0x0,0x801b4150
+80105946:	00 00 00 
+80105949:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+    bcache.target = target;
+8010594c:	89 1d 44 3d 1b 80    	mov    %ebx,0x801b3d44
+}
+80105952:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105955:	5b                   	pop    %ebx
+80105956:	5e                   	pop    %esi
+80105957:	5f                   	pop    %edi
+80105958:	5d                   	pop    %ebp
+80105959:	c3                   	ret
+    if (bcache.nbuf <= NBUF || holdingmcs(&bcache.lrulock))
+8010595a:	83 ec 0c             	sub    $0xc,%esp
+8010595d:	68 00 3d 1b 80       	push   $0x801b3d00
+80105962:	e8 49 b8 ff ff       	call   801011b0 <holdingmcs>
+80105967:	83 c4 10             	add    $0x10,%esp
+8010596a:	85 c0                	test   %eax,%eax
+8010596c:	74 23                	je     80105991 <bcachebench+0x201>
+    bcache.target = bcache.nbuf;
+8010596e:	8b 35 40 3d 1b 80    	mov    0x801b3d40,%esi
+80105974:	e9 42 fe ff ff       	jmp    801057bb <bcachebench+0x2b>
+        cprintf("bcachebench: no file system\n");
+80105979:	83 ec 0c             	sub    $0xc,%esp
+8010597c:	68 67 b2 10 80       	push   $0x8010b267
+80105981:	e8 3a 44 00 00       	call   80109dc0 <cprintf>
+        return;
+80105986:	83 c4 10             	add    $0x10,%esp
+}
+80105989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010598c:	5b                   	pop    %ebx
+8010598d:	5e                   	pop    %esi
+8010598e:	5f                   	pop    %edi
+8010598f:	5d                   	pop    %ebp
+80105990:	c3                   	ret
+80105991:	89 f0                	mov    %esi,%eax
+80105993:	e8 08 f0 ff ff       	call   801049a0 <bshrink.part.0>
+    bcache.target = bcache.nbuf;
+80105998:	8b 35 40 3d 1b 80    	mov    0x801b3d40,%esi
+8010599e:	e9 18 fe ff ff       	jmp    801057bb <bcachebench+0x2b>
+801059a3:	66 90                	xchg   %ax,%ax
+801059a5:	66 90                	xchg   %ax,%ax
+801059a7:	66 90                	xchg   %ax,%ax
+801059a9:	66 90                	xchg   %ax,%ax
+801059ab:	66 90                	xchg   %ax,%ax
+801059ad:	66 90                	xchg   %ax,%ax
+801059af:	90                   	nop
+
+801059b0 <write_head>:
+
+// write in-memory log header to disk.
+// this is the true point at which the current transaction commits.
+static void
+write_head(void)
+{
+801059b0:	55                   	push   %ebp
+801059b1:	89 e5                	mov    %esp,%ebp
+801059b3:	56                   	push   %esi
+801059b4:	53                   	push   %ebx
+    struct buf *buf = bread(log.dev, log.start);
+801059b5:	83 ec 08             	sub    $0x8,%esp
+801059b8:	ff 35 04 44 1b 80    	push   0x801b4404
+801059be:	ff 35 1c 44 1b 80    	push   0x801b441c
+801059c4:	e8 37 f7 ff ff       	call   80105100 <bread>
+    struct logheader *hb = (struct logheader *) (buf->data);
+    int i;
+    hb->n = log.lh.n;
+    for (i = 0; i < log.lh.n; i++) {
+801059c9:	83 c4 10             	add    $0x10,%esp
+801059cc:	31 d2                	xor    %edx,%edx
+    struct logheader *hb = (struct logheader *) (buf->data);
+801059ce:	8b 98 cc 00 00 00    	mov    0xcc(%eax),%ebx
+    struct buf *buf = bread(log.dev, log.start);
+801059d4:	89 c6                	mov    %eax,%esi
+    hb->n = log.lh.n;
+801059d6:	a1 20 44 1b 80       	mov    0x801b4420,%eax
+801059db:	89 03                	mov    %eax,(%ebx)
+    for (i = 0; i < log.lh.n; i++) {
+801059dd:	85 c0                	test   %eax,%eax
+801059df:	7e 1d                	jle    801059fe <write_head+0x4e>
+801059e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        hb->block[i] = log.lh.block[i];
+801059e8:	8b 0c 95 24 44 1b 80 	mov    -0x7fe4bbdc(,%edx,4),%ecx
+801059ef:	89 4c 93 04          	mov    %ecx,0x4(%ebx,%edx,4)
+    for (i = 0; i < log.lh.n; i++) {
+801059f3:	83 c2 01             	add    $0x1,%edx
+801059f6:	39 15 20 44 1b 80    	cmp    %edx,0x801b4420
+801059fc:	7f ea                	jg     801059e8 <write_head+0x38>
+    }
+    bwrite(buf);
+801059fe:	83 ec 0c             	sub    $0xc,%esp
+80105a01:	56                   	push   %esi
+80105a02:	e8 e9 f7 ff ff       	call   801051f0 <bwrite>
+    brelse(buf);
+80105a07:	89 34 24             	mov    %esi,(%esp)
+80105a0a:	e8 21 fa ff ff       	call   80105430 <brelse>
+}
+80105a0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105a12:	5b                   	pop    %ebx
+80105a13:	5e                   	pop    %esi
+80105a14:	5d                   	pop    %ebp
+80105a15:	c3                   	ret
+80105a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105a20 <checkpoint>:
+
+// install the committed blocks at their home locations and empty the log.
+// the caller has set log.committing, with no transaction in progress.
+static void
+checkpoint(void)
+{
+80105a20:	55                   	push   %ebp
+80105a21:	89 e5                	mov    %esp,%ebp
+80105a23:	57                   	push   %edi
+80105a24:	56                   	push   %esi
+80105a25:	53                   	push   %ebx
+80105a26:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+    uint blk[LOGSIZE], x;
+    int i, j, n;
+
+    // each block once, in block order
+    n = 0;
+    for (i = 0; i < log.ncommitted; i++) {
+80105a2c:	8b 15 9c 44 1b 80    	mov    0x801b449c,%edx
+80105a32:	85 d2                	test   %edx,%edx
+80105a34:	0f 8e 28 01 00 00    	jle    80105b62 <checkpoint+0x142>
+    n = 0;
+80105a3a:	31 ff                	xor    %edi,%edi
+    for (i = 0; i < log.ncommitted; i++) {
+80105a3c:	31 d2                	xor    %edx,%edx
+80105a3e:	66 90                	xchg   %ax,%ax
+        x = log.lh.block[i];
+80105a40:	8b 34 95 24 44 1b 80 	mov    -0x7fe4bbdc(,%edx,4),%esi
+        for (j = n; j > 0 && blk[j - 1] > x; j--)
+80105a47:	89 fb                	mov    %edi,%ebx
+80105a49:	eb 17                	jmp    80105a62 <checkpoint+0x42>
+80105a4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105a4f:	90                   	nop
+80105a50:	8d 43 ff             	lea    -0x1(%ebx),%eax
+80105a53:	3b b4 9d 6c ff ff ff 	cmp    -0x94(%ebp,%ebx,4),%esi
+80105a5a:	0f 83 f0 00 00 00    	jae    80105b50 <checkpoint+0x130>
+80105a60:	89 c3                	mov    %eax,%ebx
+80105a62:	85 db                	test   %ebx,%ebx
+80105a64:	75 ea                	jne    80105a50 <checkpoint+0x30>
+            ;
+        if (j > 0 && blk[j - 1] == x)
+            continue;
+        memmove(&blk[j + 1], &blk[j], (n - j) * sizeof(blk[0]));
+80105a66:	89 f8                	mov    %edi,%eax
+80105a68:	83 ec 04             	sub    $0x4,%esp
+80105a6b:	89 95 f4 fe ff ff    	mov    %edx,-0x10c(%ebp)
+        blk[j] = x;
+        n++;
+80105a71:	83 c7 01             	add    $0x1,%edi
+        memmove(&blk[j + 1], &blk[j], (n - j) * sizeof(blk[0]));
+80105a74:	29 d8                	sub    %ebx,%eax
+80105a76:	8d 0c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%ecx
+80105a7d:	c1 e0 02             	shl    $0x2,%eax
+80105a80:	50                   	push   %eax
+80105a81:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+80105a87:	01 c8                	add    %ecx,%eax
+80105a89:	50                   	push   %eax
+80105a8a:	8d 84 0d 74 ff ff ff 	lea    -0x8c(%ebp,%ecx,1),%eax
+80105a91:	50                   	push   %eax
+80105a92:	e8 39 a6 ff ff       	call   801000d0 <memmove>
+        blk[j] = x;
+80105a97:	89 b4 9d 70 ff ff ff 	mov    %esi,-0x90(%ebp,%ebx,4)
+        n++;
+80105a9e:	8b 95 f4 fe ff ff    	mov    -0x10c(%ebp),%edx
+80105aa4:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < log.ncommitted; i++) {
+80105aa7:	83 c2 01             	add    $0x1,%edx
+80105aaa:	39 15 9c 44 1b 80    	cmp    %edx,0x801b449c
+80105ab0:	7f 8e                	jg     80105a40 <checkpoint+0x20>
+    }
+
+    for (i = 0; i < n; i++)
+80105ab2:	85 ff                	test   %edi,%edi
+80105ab4:	0f 84 a8 00 00 00    	je     80105b62 <checkpoint+0x142>
+80105aba:	31 f6                	xor    %esi,%esi
+80105abc:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+80105ac2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        b[i] = bread(log.dev, blk[i]);  // cached: pinned by B_DIRTY
+80105ac8:	83 ec 08             	sub    $0x8,%esp
+80105acb:	ff b4 b5 70 ff ff ff 	push   -0x90(%ebp,%esi,4)
+80105ad2:	ff 35 1c 44 1b 80    	push   0x801b441c
+80105ad8:	e8 23 f6 ff ff       	call   80105100 <bread>
+    for (i = 0; i < n; i++)
+80105add:	83 c4 10             	add    $0x10,%esp
+        b[i] = bread(log.dev, blk[i]);  // cached: pinned by B_DIRTY
+80105ae0:	89 04 b3             	mov    %eax,(%ebx,%esi,4)
+    for (i = 0; i < n; i++)
+80105ae3:	83 c6 01             	add    $0x1,%esi
+80105ae6:	39 f7                	cmp    %esi,%edi
+80105ae8:	75 de                	jne    80105ac8 <checkpoint+0xa8>
+    bwritev(b, n);
+80105aea:	83 ec 08             	sub    $0x8,%esp
+80105aed:	8d 34 bb             	lea    (%ebx,%edi,4),%esi
+80105af0:	57                   	push   %edi
+80105af1:	53                   	push   %ebx
+80105af2:	e8 b9 f7 ff ff       	call   801052b0 <bwritev>
+    for (i = 0; i < n; i++) {
+80105af7:	83 c4 10             	add    $0x10,%esp
+80105afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        biowait(b[i]);
+80105b00:	83 ec 0c             	sub    $0xc,%esp
+80105b03:	ff 33                	push   (%ebx)
+    for (i = 0; i < n; i++) {
+80105b05:	83 c3 04             	add    $0x4,%ebx
+        biowait(b[i]);
+80105b08:	e8 43 f8 ff ff       	call   80105350 <biowait>
+        brelse(b[i]);
+80105b0d:	58                   	pop    %eax
+80105b0e:	ff 73 fc             	push   -0x4(%ebx)
+80105b11:	e8 1a f9 ff ff       	call   80105430 <brelse>
+    for (i = 0; i < n; i++) {
+80105b16:	83 c4 10             	add    $0x10,%esp
+80105b19:	39 f3                	cmp    %esi,%ebx
+80105b1b:	75 e3                	jne    80105b00 <checkpoint+0xe0>
+    }
+
+    log.lh.n = 0;
+80105b1d:	c7 05 20 44 1b 80 00 	movl   $0x0,0x801b4420
+80105b24:	00 00 00 
+    log.ncommitted = 0;
+80105b27:	c7 05 9c 44 1b 80 00 	movl   $0x0,0x801b449c
+80105b2e:	00 00 00 
+    log.flushnow = 0;
+80105b31:	c7 05 a4 44 1b 80 00 	movl   $0x0,0x801b44a4
+80105b38:	00 00 00 
+    write_head();   // erase the transactions from log
+80105b3b:	e8 70 fe ff ff       	call   801059b0 <write_head>
+}
+80105b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105b43:	5b                   	pop    %ebx
+80105b44:	5e                   	pop    %esi
+80105b45:	5f                   	pop    %edi
+80105b46:	5d                   	pop    %ebp
+80105b47:	c3                   	ret
+80105b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b4f:	90                   	nop
+        if (j > 0 && blk[j - 1] == x)
+80105b50:	39 b4 85 70 ff ff ff 	cmp    %esi,-0x90(%ebp,%eax,4)
+80105b57:	0f 85 09 ff ff ff    	jne    80105a66 <checkpoint+0x46>
+80105b5d:	e9 45 ff ff ff       	jmp    80105aa7 <checkpoint+0x87>
+    bwritev(b, n);
+80105b62:	83 ec 08             	sub    $0x8,%esp
+80105b65:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+80105b6b:	6a 00                	push   $0x0
+80105b6d:	50                   	push   %eax
+80105b6e:	e8 3d f7 ff ff       	call   801052b0 <bwritev>
+80105b73:	83 c4 10             	add    $0x10,%esp
+80105b76:	eb a5                	jmp    80105b1d <checkpoint+0xfd>
+80105b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b7f:	90                   	nop
+
+80105b80 <initlog>:
+{
+80105b80:	55                   	push   %ebp
+80105b81:	89 e5                	mov    %esp,%ebp
+80105b83:	57                   	push   %edi
+80105b84:	56                   	push   %esi
+80105b85:	53                   	push   %ebx
+80105b86:	81 ec 24 01 00 00    	sub    $0x124,%esp
+80105b8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    initlock(&log.lock, "log");
+80105b8f:	68 70 b3 10 80       	push   $0x8010b370
+80105b94:	68 c0 43 1b 80       	push   $0x801b43c0
+80105b99:	e8 a2 b4 ff ff       	call   80101040 <initlock>
+    initwaitq(&log.wq);
+80105b9e:	c7 04 24 14 44 1b 80 	movl   $0x801b4414,(%esp)
+80105ba5:	e8 e6 bc ff ff       	call   80101890 <initwaitq>
+    readsb(dev, &sb);
+80105baa:	58                   	pop    %eax
+80105bab:	8d 85 dc fe ff ff    	lea    -0x124(%ebp),%eax
+80105bb1:	5a                   	pop    %edx
+80105bb2:	50                   	push   %eax
+80105bb3:	53                   	push   %ebx
+80105bb4:	e8 87 0e 00 00       	call   80106a40 <readsb>
+    log.size = sb.nlog;
+80105bb9:	8b 95 e8 fe ff ff    	mov    -0x118(%ebp),%edx
+    log.start = sb.logstart;
+80105bbf:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+    log.dev = dev;
+80105bc5:	89 1d 1c 44 1b 80    	mov    %ebx,0x801b441c
+    log.size = sb.nlog;
+80105bcb:	89 15 08 44 1b 80    	mov    %edx,0x801b4408
+    log.start = sb.logstart;
+80105bd1:	a3 04 44 1b 80       	mov    %eax,0x801b4404
+    struct buf *buf = bread(log.dev, log.start);
+80105bd6:	59                   	pop    %ecx
+80105bd7:	5e                   	pop    %esi
+80105bd8:	50                   	push   %eax
+80105bd9:	53                   	push   %ebx
+80105bda:	e8 21 f5 ff ff       	call   80105100 <bread>
+    for (i = 0; i < log.lh.n; i++) {
+80105bdf:	83 c4 10             	add    $0x10,%esp
+80105be2:	31 d2                	xor    %edx,%edx
+    struct logheader *lh = (struct logheader *) (buf->data);
+80105be4:	8b b0 cc 00 00 00    	mov    0xcc(%eax),%esi
+    log.lh.n = lh->n;
+80105bea:	8b 1e                	mov    (%esi),%ebx
+80105bec:	89 1d 20 44 1b 80    	mov    %ebx,0x801b4420
+    for (i = 0; i < log.lh.n; i++) {
+80105bf2:	85 db                	test   %ebx,%ebx
+80105bf4:	7e 1c                	jle    80105c12 <initlog+0x92>
+80105bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105bfd:	8d 76 00             	lea    0x0(%esi),%esi
+        log.lh.block[i] = lh->block[i];
+80105c00:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80105c04:	89 0c 95 24 44 1b 80 	mov    %ecx,-0x7fe4bbdc(,%edx,4)
+    for (i = 0; i < log.lh.n; i++) {
+80105c0b:	83 c2 01             	add    $0x1,%edx
+80105c0e:	39 d3                	cmp    %edx,%ebx
+80105c10:	75 ee                	jne    80105c00 <initlog+0x80>
+    brelse(buf);
+80105c12:	83 ec 0c             	sub    $0xc,%esp
+    bread_range(log.dev, log.start + 1, log.lh.n, lbuf);
+80105c15:	8d 9d f8 fe ff ff    	lea    -0x108(%ebp),%ebx
+    for (tail = 0; tail < log.lh.n; tail++) {
+80105c1b:	31 f6                	xor    %esi,%esi
+    brelse(buf);
+80105c1d:	50                   	push   %eax
+80105c1e:	e8 0d f8 ff ff       	call   80105430 <brelse>
+    bread_range(log.dev, log.start + 1, log.lh.n, lbuf);
+80105c23:	53                   	push   %ebx
+80105c24:	ff 35 20 44 1b 80    	push   0x801b4420
+80105c2a:	a1 04 44 1b 80       	mov    0x801b4404,%eax
+80105c2f:	83 c0 01             	add    $0x1,%eax
+80105c32:	50                   	push   %eax
+80105c33:	ff 35 1c 44 1b 80    	push   0x801b441c
+80105c39:	e8 02 f5 ff ff       	call   80105140 <bread_range>
+    for (tail = 0; tail < log.lh.n; tail++) {
+80105c3e:	8b 15 20 44 1b 80    	mov    0x801b4420,%edx
+80105c44:	83 c4 20             	add    $0x20,%esp
+80105c47:	85 d2                	test   %edx,%edx
+80105c49:	0f 8e 8b 00 00 00    	jle    80105cda <initlog+0x15a>
+80105c4f:	90                   	nop
+        dbuf[tail] = 0;
+80105c50:	c7 84 b5 70 ff ff ff 	movl   $0x0,-0x90(%ebp,%esi,4)
+80105c57:	00 00 00 00 
+        for (i = tail + 1; i < log.lh.n; i++)
+80105c5b:	83 c6 01             	add    $0x1,%esi
+80105c5e:	39 d6                	cmp    %edx,%esi
+80105c60:	0f 8d e5 00 00 00    	jge    80105d4b <initlog+0x1cb>
+            if (log.lh.block[i] == log.lh.block[tail])
+80105c66:	8b 0c b5 20 44 1b 80 	mov    -0x7fe4bbe0(,%esi,4),%ecx
+        for (i = tail + 1; i < log.lh.n; i++)
+80105c6d:	89 f0                	mov    %esi,%eax
+80105c6f:	eb 12                	jmp    80105c83 <initlog+0x103>
+80105c71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c78:	83 c0 01             	add    $0x1,%eax
+80105c7b:	39 d0                	cmp    %edx,%eax
+80105c7d:	0f 84 7d 00 00 00    	je     80105d00 <initlog+0x180>
+            if (log.lh.block[i] == log.lh.block[tail])
+80105c83:	39 0c 85 24 44 1b 80 	cmp    %ecx,-0x7fe4bbdc(,%eax,4)
+80105c8a:	75 ec                	jne    80105c78 <initlog+0xf8>
+        if (i == log.lh.n) {
+80105c8c:	39 c2                	cmp    %eax,%edx
+80105c8e:	74 70                	je     80105d00 <initlog+0x180>
+        brelse(lbuf[tail]);
+80105c90:	83 ec 0c             	sub    $0xc,%esp
+80105c93:	ff 74 b3 fc          	push   -0x4(%ebx,%esi,4)
+80105c97:	e8 94 f7 ff ff       	call   80105430 <brelse>
+    for (tail = 0; tail < log.lh.n; tail++) {
+80105c9c:	8b 15 20 44 1b 80    	mov    0x801b4420,%edx
+80105ca2:	83 c4 10             	add    $0x10,%esp
+80105ca5:	39 d6                	cmp    %edx,%esi
+80105ca7:	7c a7                	jl     80105c50 <initlog+0xd0>
+    for (tail = 0; tail < log.lh.n; tail++) {
+80105ca9:	85 d2                	test   %edx,%edx
+80105cab:	7e 2d                	jle    80105cda <initlog+0x15a>
+80105cad:	31 db                	xor    %ebx,%ebx
+80105caf:	90                   	nop
+        if (dbuf[tail]) {
+80105cb0:	8b b4 9d 70 ff ff ff 	mov    -0x90(%ebp,%ebx,4),%esi
+80105cb7:	85 f6                	test   %esi,%esi
+80105cb9:	74 14                	je     80105ccf <initlog+0x14f>
+            biowait(dbuf[tail]);
+80105cbb:	83 ec 0c             	sub    $0xc,%esp
+80105cbe:	56                   	push   %esi
+80105cbf:	e8 8c f6 ff ff       	call   80105350 <biowait>
+            brelse(dbuf[tail]);
+80105cc4:	89 34 24             	mov    %esi,(%esp)
+80105cc7:	e8 64 f7 ff ff       	call   80105430 <brelse>
+80105ccc:	83 c4 10             	add    $0x10,%esp
+    for (tail = 0; tail < log.lh.n; tail++) {
+80105ccf:	83 c3 01             	add    $0x1,%ebx
+80105cd2:	3b 1d 20 44 1b 80    	cmp    0x801b4420,%ebx
+80105cd8:	7c d6                	jl     80105cb0 <initlog+0x130>
+    log.lh.n = 0;
+80105cda:	c7 05 20 44 1b 80 00 	movl   $0x0,0x801b4420
+80105ce1:	00 00 00 
+    log.ncommitted = 0;
+80105ce4:	c7 05 9c 44 1b 80 00 	movl   $0x0,0x801b449c
+80105ceb:	00 00 00 
+    write_head();   // clear the log
+80105cee:	e8 bd fc ff ff       	call   801059b0 <write_head>
+}
+80105cf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cf6:	5b                   	pop    %ebx
+80105cf7:	5e                   	pop    %esi
+80105cf8:	5f                   	pop    %edi
+80105cf9:	5d                   	pop    %ebp
+80105cfa:	c3                   	ret
+80105cfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105cff:	90                   	nop
+            dbuf[tail] = bread(log.dev, log.lh.block[tail]);    // read dst
+80105d00:	83 ec 08             	sub    $0x8,%esp
+80105d03:	ff 34 b5 20 44 1b 80 	push   -0x7fe4bbe0(,%esi,4)
+80105d0a:	ff 35 1c 44 1b 80    	push   0x801b441c
+80105d10:	e8 eb f3 ff ff       	call   80105100 <bread>
+            ssememmove(dbuf[tail]->data, lbuf[tail]->data, BSIZE);
+80105d15:	83 c4 0c             	add    $0xc,%esp
+            dbuf[tail] = bread(log.dev, log.lh.block[tail]);    // read dst
+80105d18:	89 84 b5 6c ff ff ff 	mov    %eax,-0x94(%ebp,%esi,4)
+80105d1f:	89 c7                	mov    %eax,%edi
+            ssememmove(dbuf[tail]->data, lbuf[tail]->data, BSIZE);
+80105d21:	68 00 02 00 00       	push   $0x200
+80105d26:	8b 44 b3 fc          	mov    -0x4(%ebx,%esi,4),%eax
+80105d2a:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+80105d30:	ff b7 cc 00 00 00    	push   0xcc(%edi)
+80105d36:	e8 65 20 00 00       	call   80107da0 <ssememmove>
+            bwrite_async(dbuf[tail]);
+80105d3b:	89 3c 24             	mov    %edi,(%esp)
+80105d3e:	e8 2d f5 ff ff       	call   80105270 <bwrite_async>
+80105d43:	83 c4 10             	add    $0x10,%esp
+80105d46:	e9 45 ff ff ff       	jmp    80105c90 <initlog+0x110>
+        for (i = tail + 1; i < log.lh.n; i++)
+80105d4b:	89 f0                	mov    %esi,%eax
+80105d4d:	e9 3a ff ff ff       	jmp    80105c8c <initlog+0x10c>
+80105d52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105d60 <begin_op>:
+{
+80105d60:	55                   	push   %ebp
+80105d61:	89 e5                	mov    %esp,%ebp
+80105d63:	83 ec 14             	sub    $0x14,%esp
+    acquire(&log.lock);
+80105d66:	68 c0 43 1b 80       	push   $0x801b43c0
+80105d6b:	e8 40 b7 ff ff       	call   801014b0 <acquire>
+80105d70:	83 c4 10             	add    $0x10,%esp
+80105d73:	eb 24                	jmp    80105d99 <begin_op+0x39>
+80105d75:	8d 76 00             	lea    0x0(%esi),%esi
+            log.flushnow = 1;
+80105d78:	c7 05 a4 44 1b 80 01 	movl   $0x1,0x801b44a4
+80105d7f:	00 00 00 
+            waitsleep(&log.wq, &log.lock, 1);
+80105d82:	83 ec 04             	sub    $0x4,%esp
+80105d85:	6a 01                	push   $0x1
+80105d87:	68 c0 43 1b 80       	push   $0x801b43c0
+80105d8c:	68 14 44 1b 80       	push   $0x801b4414
+80105d91:	e8 1a bb ff ff       	call   801018b0 <waitsleep>
+80105d96:	83 c4 10             	add    $0x10,%esp
+        if (log.committing) {
+80105d99:	a1 10 44 1b 80       	mov    0x801b4410,%eax
+80105d9e:	85 c0                	test   %eax,%eax
+80105da0:	75 e0                	jne    80105d82 <begin_op+0x22>
+        } else if (log.lh.n + (log.outstanding + 1) * MAXOPBLOCKS > LOGSIZE) {
+80105da2:	a1 0c 44 1b 80       	mov    0x801b440c,%eax
+80105da7:	8b 15 20 44 1b 80    	mov    0x801b4420,%edx
+80105dad:	83 c0 01             	add    $0x1,%eax
+80105db0:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80105db3:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80105db6:	83 fa 1e             	cmp    $0x1e,%edx
+80105db9:	7f bd                	jg     80105d78 <begin_op+0x18>
+            release(&log.lock);
+80105dbb:	83 ec 0c             	sub    $0xc,%esp
+            log.outstanding += 1;
+80105dbe:	a3 0c 44 1b 80       	mov    %eax,0x801b440c
+            release(&log.lock);
+80105dc3:	68 c0 43 1b 80       	push   $0x801b43c0
+80105dc8:	e8 03 b5 ff ff       	call   801012d0 <release>
+}
+80105dcd:	83 c4 10             	add    $0x10,%esp
+80105dd0:	c9                   	leave
+80105dd1:	c3                   	ret
+80105dd2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105de0 <end_op>:
+{
+80105de0:	55                   	push   %ebp
+80105de1:	89 e5                	mov    %esp,%ebp
+80105de3:	57                   	push   %edi
+80105de4:	56                   	push   %esi
+80105de5:	53                   	push   %ebx
+80105de6:	81 ec a8 00 00 00    	sub    $0xa8,%esp
+    acquire(&log.lock);
+80105dec:	68 c0 43 1b 80       	push   $0x801b43c0
+80105df1:	e8 ba b6 ff ff       	call   801014b0 <acquire>
+    log.outstanding -= 1;
+80105df6:	a1 0c 44 1b 80       	mov    0x801b440c,%eax
+    if (log.committing)
+80105dfb:	8b 35 10 44 1b 80    	mov    0x801b4410,%esi
+80105e01:	83 c4 10             	add    $0x10,%esp
+    log.outstanding -= 1;
+80105e04:	8d 58 ff             	lea    -0x1(%eax),%ebx
+80105e07:	89 1d 0c 44 1b 80    	mov    %ebx,0x801b440c
+    if (log.committing)
+80105e0d:	85 f6                	test   %esi,%esi
+80105e0f:	0f 85 b7 01 00 00    	jne    80105fcc <end_op+0x1ec>
+    if (log.outstanding == 0) {
+80105e15:	85 db                	test   %ebx,%ebx
+80105e17:	75 67                	jne    80105e80 <end_op+0xa0>
+        log.committing = 1;
+80105e19:	c7 05 10 44 1b 80 01 	movl   $0x1,0x801b4410
+80105e20:	00 00 00 
+    release(&log.lock);
+80105e23:	83 ec 0c             	sub    $0xc,%esp
+80105e26:	68 c0 43 1b 80       	push   $0x801b43c0
+80105e2b:	e8 a0 b4 ff ff       	call   801012d0 <release>
+    if (log.lh.n > log.ncommitted) {
+80105e30:	a1 9c 44 1b 80       	mov    0x801b449c,%eax
+80105e35:	83 c4 10             	add    $0x10,%esp
+80105e38:	39 05 20 44 1b 80    	cmp    %eax,0x801b4420
+80105e3e:	7f 68                	jg     80105ea8 <end_op+0xc8>
+        acquire(&log.lock);
+80105e40:	83 ec 0c             	sub    $0xc,%esp
+80105e43:	68 c0 43 1b 80       	push   $0x801b43c0
+80105e48:	e8 63 b6 ff ff       	call   801014b0 <acquire>
+        log.committing = 0;
+80105e4d:	c7 05 10 44 1b 80 00 	movl   $0x0,0x801b4410
+80105e54:	00 00 00 
+        wake_all(&log.wq);
+80105e57:	c7 04 24 14 44 1b 80 	movl   $0x801b4414,(%esp)
+80105e5e:	e8 ed bb ff ff       	call   80101a50 <wake_all>
+        release(&log.lock);
+80105e63:	c7 04 24 c0 43 1b 80 	movl   $0x801b43c0,(%esp)
+80105e6a:	e8 61 b4 ff ff       	call   801012d0 <release>
+80105e6f:	83 c4 10             	add    $0x10,%esp
+}
+80105e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105e75:	5b                   	pop    %ebx
+80105e76:	5e                   	pop    %esi
+80105e77:	5f                   	pop    %edi
+80105e78:	5d                   	pop    %ebp
+80105e79:	c3                   	ret
+80105e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        wake_one(&log.wq);
+80105e80:	83 ec 0c             	sub    $0xc,%esp
+80105e83:	68 14 44 1b 80       	push   $0x801b4414
+80105e88:	e8 a3 bb ff ff       	call   80101a30 <wake_one>
+    release(&log.lock);
+80105e8d:	c7 04 24 c0 43 1b 80 	movl   $0x801b43c0,(%esp)
+80105e94:	e8 37 b4 ff ff       	call   801012d0 <release>
+80105e99:	83 c4 10             	add    $0x10,%esp
+}
+80105e9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105e9f:	5b                   	pop    %ebx
+80105ea0:	5e                   	pop    %esi
+80105ea1:	5f                   	pop    %edi
+80105ea2:	5d                   	pop    %ebp
+80105ea3:	c3                   	ret
+80105ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        kstatinc(KS_LOGCOMMIT);
+80105ea8:	83 ec 0c             	sub    $0xc,%esp
+    bread_range(log.dev, log.start + log.ncommitted + 1, n, to);
+80105eab:	8d bd 70 ff ff ff    	lea    -0x90(%ebp),%edi
+        kstatinc(KS_LOGCOMMIT);
+80105eb1:	6a 08                	push   $0x8
+80105eb3:	e8 18 06 00 00       	call   801064d0 <kstatinc>
+    n = log.lh.n - log.ncommitted;
+80105eb8:	a1 9c 44 1b 80       	mov    0x801b449c,%eax
+80105ebd:	8b 35 20 44 1b 80    	mov    0x801b4420,%esi
+80105ec3:	29 c6                	sub    %eax,%esi
+80105ec5:	89 b5 64 ff ff ff    	mov    %esi,-0x9c(%ebp)
+    bread_range(log.dev, log.start + log.ncommitted + 1, n, to);
+80105ecb:	57                   	push   %edi
+80105ecc:	56                   	push   %esi
+80105ecd:	03 05 04 44 1b 80    	add    0x801b4404,%eax
+80105ed3:	83 c0 01             	add    $0x1,%eax
+80105ed6:	50                   	push   %eax
+80105ed7:	ff 35 1c 44 1b 80    	push   0x801b441c
+80105edd:	e8 5e f2 ff ff       	call   80105140 <bread_range>
+    for (tail = 0; tail < n; tail++) {
+80105ee2:	83 c4 20             	add    $0x20,%esp
+80105ee5:	85 f6                	test   %esi,%esi
+80105ee7:	0f 8e cb 00 00 00    	jle    80105fb8 <end_op+0x1d8>
+80105eed:	8d 76 00             	lea    0x0(%esi),%esi
+        from = bread(log.dev, log.lh.block[log.ncommitted + tail]);  // cache block
+80105ef0:	a1 9c 44 1b 80       	mov    0x801b449c,%eax
+80105ef5:	83 ec 08             	sub    $0x8,%esp
+80105ef8:	01 d8                	add    %ebx,%eax
+80105efa:	ff 34 85 24 44 1b 80 	push   -0x7fe4bbdc(,%eax,4)
+80105f01:	ff 35 1c 44 1b 80    	push   0x801b441c
+80105f07:	e8 f4 f1 ff ff       	call   80105100 <bread>
+        ssememmove(to[tail]->data, from->data, BSIZE);
+80105f0c:	83 c4 0c             	add    $0xc,%esp
+80105f0f:	68 00 02 00 00       	push   $0x200
+        from = bread(log.dev, log.lh.block[log.ncommitted + tail]);  // cache block
+80105f14:	89 c6                	mov    %eax,%esi
+        ssememmove(to[tail]->data, from->data, BSIZE);
+80105f16:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+80105f1c:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+    for (tail = 0; tail < n; tail++) {
+80105f1f:	83 c3 01             	add    $0x1,%ebx
+        ssememmove(to[tail]->data, from->data, BSIZE);
+80105f22:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+80105f28:	e8 73 1e 00 00       	call   80107da0 <ssememmove>
+        brelse(from);
+80105f2d:	89 34 24             	mov    %esi,(%esp)
+80105f30:	e8 fb f4 ff ff       	call   80105430 <brelse>
+    for (tail = 0; tail < n; tail++) {
+80105f35:	83 c4 10             	add    $0x10,%esp
+80105f38:	39 9d 64 ff ff ff    	cmp    %ebx,-0x9c(%ebp)
+80105f3e:	75 b0                	jne    80105ef0 <end_op+0x110>
+    bwrite_range(to, n);    // write the log
+80105f40:	8b b5 64 ff ff ff    	mov    -0x9c(%ebp),%esi
+80105f46:	83 ec 08             	sub    $0x8,%esp
+80105f49:	56                   	push   %esi
+80105f4a:	8d 34 b7             	lea    (%edi,%esi,4),%esi
+80105f4d:	57                   	push   %edi
+80105f4e:	e8 bd f3 ff ff       	call   80105310 <bwrite_range>
+    for (tail = 0; tail < n; tail++)
+80105f53:	83 c4 10             	add    $0x10,%esp
+80105f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105f5d:	8d 76 00             	lea    0x0(%esi),%esi
+        brelse(to[tail]);
+80105f60:	83 ec 0c             	sub    $0xc,%esp
+80105f63:	ff 37                	push   (%edi)
+    for (tail = 0; tail < n; tail++)
+80105f65:	83 c7 04             	add    $0x4,%edi
+        brelse(to[tail]);
+80105f68:	e8 c3 f4 ff ff       	call   80105430 <brelse>
+    for (tail = 0; tail < n; tail++)
+80105f6d:	83 c4 10             	add    $0x10,%esp
+80105f70:	39 fe                	cmp    %edi,%esi
+80105f72:	75 ec                	jne    80105f60 <end_op+0x180>
+        write_head();   // write header to disk -- the read commit
+80105f74:	e8 37 fa ff ff       	call   801059b0 <write_head>
+        if (log.ncommitted == 0)
+80105f79:	8b 0d 9c 44 1b 80    	mov    0x801b449c,%ecx
+80105f7f:	85 c9                	test   %ecx,%ecx
+80105f81:	75 0a                	jne    80105f8d <end_op+0x1ad>
+            log.committick = ticks;
+80105f83:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+80105f88:	a3 a0 44 1b 80       	mov    %eax,0x801b44a0
+        log.ncommitted = log.lh.n;
+80105f8d:	a1 20 44 1b 80       	mov    0x801b4420,%eax
+        if (log.flushnow || log.lh.n + 2 * MAXOPBLOCKS > LOGSIZE)
+80105f92:	8b 15 a4 44 1b 80    	mov    0x801b44a4,%edx
+        log.ncommitted = log.lh.n;
+80105f98:	a3 9c 44 1b 80       	mov    %eax,0x801b449c
+        if (log.flushnow || log.lh.n + 2 * MAXOPBLOCKS > LOGSIZE)
+80105f9d:	85 d2                	test   %edx,%edx
+80105f9f:	75 09                	jne    80105faa <end_op+0x1ca>
+80105fa1:	83 f8 0a             	cmp    $0xa,%eax
+80105fa4:	0f 8e 96 fe ff ff    	jle    80105e40 <end_op+0x60>
+            checkpoint();
+80105faa:	e8 71 fa ff ff       	call   80105a20 <checkpoint>
+80105faf:	e9 8c fe ff ff       	jmp    80105e40 <end_op+0x60>
+80105fb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    bwrite_range(to, n);    // write the log
+80105fb8:	83 ec 08             	sub    $0x8,%esp
+80105fbb:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+80105fc1:	57                   	push   %edi
+80105fc2:	e8 49 f3 ff ff       	call   80105310 <bwrite_range>
+80105fc7:	83 c4 10             	add    $0x10,%esp
+80105fca:	eb a8                	jmp    80105f74 <end_op+0x194>
+        panic("end_op: log is committing");
+80105fcc:	83 ec 0c             	sub    $0xc,%esp
+80105fcf:	68 74 b3 10 80       	push   $0x8010b374
+80105fd4:	e8 67 3d 00 00       	call   80109d40 <panic>
+80105fd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105fe0 <logflushsoon>:
+// ask logflusher() to install committed blocks now, to let the
+// buffer cache give back their pages. called from kalloc().
+void
+logflushsoon(void)
+{
+    log.flushnow = 1;
+80105fe0:	c7 05 a4 44 1b 80 01 	movl   $0x1,0x801b44a4
+80105fe7:	00 00 00 
+}
+80105fea:	c3                   	ret
+80105feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105fef:	90                   	nop
+
+80105ff0 <logflusher>:
+
+// the log flusher, a kernel thread: installs committed blocks FLUSHAGE
+// ticks after the first of them was committed, or sooner if asked.
+void
+logflusher(void)
+{
+80105ff0:	55                   	push   %ebp
+80105ff1:	89 e5                	mov    %esp,%ebp
+80105ff3:	83 ec 08             	sub    $0x8,%esp
+80105ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ffd:	8d 76 00             	lea    0x0(%esi),%esi
+    int doflush;
+
+    for (;;) {
+        acquire(&tickslock);
+80106000:	83 ec 0c             	sub    $0xc,%esp
+80106003:	68 40 c0 1c 80       	push   $0x801cc040
+80106008:	e8 a3 b4 ff ff       	call   801014b0 <acquire>
+        sleep(&ticks, &tickslock);
+8010600d:	5a                   	pop    %edx
+8010600e:	59                   	pop    %ecx
+8010600f:	68 40 c0 1c 80       	push   $0x801cc040
+80106014:	68 20 c0 1c 80       	push   $0x801cc020
+80106019:	e8 f2 28 00 00       	call   80108910 <sleep>
+        release(&tickslock);
+8010601e:	c7 04 24 40 c0 1c 80 	movl   $0x801cc040,(%esp)
+80106025:	e8 a6 b2 ff ff       	call   801012d0 <release>
+
+        acquire(&log.lock);
+8010602a:	c7 04 24 c0 43 1b 80 	movl   $0x801b43c0,(%esp)
+80106031:	e8 7a b4 ff ff       	call   801014b0 <acquire>
+        doflush = log.ncommitted > 0 && log.outstanding == 0 && !log.committing &&
+80106036:	a1 9c 44 1b 80       	mov    0x801b449c,%eax
+8010603b:	83 c4 10             	add    $0x10,%esp
+8010603e:	85 c0                	test   %eax,%eax
+80106040:	7e 7e                	jle    801060c0 <logflusher+0xd0>
+80106042:	a1 0c 44 1b 80       	mov    0x801b440c,%eax
+80106047:	0b 05 10 44 1b 80    	or     0x801b4410,%eax
+8010604d:	75 71                	jne    801060c0 <logflusher+0xd0>
+8010604f:	a1 a4 44 1b 80       	mov    0x801b44a4,%eax
+80106054:	85 c0                	test   %eax,%eax
+80106056:	75 10                	jne    80106068 <logflusher+0x78>
+                  (log.flushnow || ticks - log.committick >= FLUSHAGE);
+80106058:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+8010605d:	2b 05 a0 44 1b 80    	sub    0x801b44a0,%eax
+80106063:	83 f8 63             	cmp    $0x63,%eax
+80106066:	76 58                	jbe    801060c0 <logflusher+0xd0>
+        if (doflush)
+            log.committing = 1;
+80106068:	c7 05 10 44 1b 80 01 	movl   $0x1,0x801b4410
+8010606f:	00 00 00 
+        release(&log.lock);
+80106072:	83 ec 0c             	sub    $0xc,%esp
+80106075:	68 c0 43 1b 80       	push   $0x801b43c0
+8010607a:	e8 51 b2 ff ff       	call   801012d0 <release>
+
+        if (doflush) {
+            checkpoint();
+8010607f:	e8 9c f9 ff ff       	call   80105a20 <checkpoint>
+            acquire(&log.lock);
+80106084:	c7 04 24 c0 43 1b 80 	movl   $0x801b43c0,(%esp)
+8010608b:	e8 20 b4 ff ff       	call   801014b0 <acquire>
+            log.committing = 0;
+            wake_all(&log.wq);
+80106090:	c7 04 24 14 44 1b 80 	movl   $0x801b4414,(%esp)
+            log.committing = 0;
+80106097:	c7 05 10 44 1b 80 00 	movl   $0x0,0x801b4410
+8010609e:	00 00 00 
+            wake_all(&log.wq);
+801060a1:	e8 aa b9 ff ff       	call   80101a50 <wake_all>
+            release(&log.lock);
+801060a6:	c7 04 24 c0 43 1b 80 	movl   $0x801b43c0,(%esp)
+801060ad:	e8 1e b2 ff ff       	call   801012d0 <release>
+801060b2:	83 c4 10             	add    $0x10,%esp
+801060b5:	e9 46 ff ff ff       	jmp    80106000 <logflusher+0x10>
+801060ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        release(&log.lock);
+801060c0:	83 ec 0c             	sub    $0xc,%esp
+801060c3:	68 c0 43 1b 80       	push   $0x801b43c0
+801060c8:	e8 03 b2 ff ff       	call   801012d0 <release>
+801060cd:	83 c4 10             	add    $0x10,%esp
+801060d0:	e9 2b ff ff ff       	jmp    80106000 <logflusher+0x10>
+801060d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801060dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801060e0 <log_write>:
+//      modify bp->data[]
+//      log_write(bp)
+//      brelse(bp)
+void
+log_write(struct buf *b)
+{
+801060e0:	55                   	push   %ebp
+801060e1:	89 e5                	mov    %esp,%ebp
+801060e3:	53                   	push   %ebx
+801060e4:	83 ec 04             	sub    $0x4,%esp
+    int i;
+
+    if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+801060e7:	8b 15 20 44 1b 80    	mov    0x801b4420,%edx
+{
+801060ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+801060f0:	83 fa 1d             	cmp    $0x1d,%edx
+801060f3:	7f 7d                	jg     80106172 <log_write+0x92>
+801060f5:	a1 08 44 1b 80       	mov    0x801b4408,%eax
+801060fa:	83 e8 01             	sub    $0x1,%eax
+801060fd:	39 c2                	cmp    %eax,%edx
+801060ff:	7d 71                	jge    80106172 <log_write+0x92>
+        panic("log_write: too big transaction");
+    if (log.outstanding < 1)
+80106101:	a1 0c 44 1b 80       	mov    0x801b440c,%eax
+80106106:	85 c0                	test   %eax,%eax
+80106108:	7e 75                	jle    8010617f <log_write+0x9f>
+        panic("log_write: outside of trans, please wrap in begin_op()/end_op()");
+
+    acquire(&log.lock);
+8010610a:	83 ec 0c             	sub    $0xc,%esp
+8010610d:	68 c0 43 1b 80       	push   $0x801b43c0
+80106112:	e8 99 b3 ff ff       	call   801014b0 <acquire>
+    // committed blocks can't be absorbed: their log copy must stay as it is
+    for (i = log.ncommitted; i < log.lh.n; i++) {
+80106117:	a1 9c 44 1b 80       	mov    0x801b449c,%eax
+        if (log.lh.block[i] == b->blockno)  // log absorb
+8010611c:	8b 4b 08             	mov    0x8(%ebx),%ecx
+    for (i = log.ncommitted; i < log.lh.n; i++) {
+8010611f:	83 c4 10             	add    $0x10,%esp
+80106122:	8b 15 20 44 1b 80    	mov    0x801b4420,%edx
+80106128:	39 c2                	cmp    %eax,%edx
+8010612a:	7f 0b                	jg     80106137 <log_write+0x57>
+8010612c:	eb 12                	jmp    80106140 <log_write+0x60>
+8010612e:	66 90                	xchg   %ax,%ax
+80106130:	83 c0 01             	add    $0x1,%eax
+80106133:	39 c2                	cmp    %eax,%edx
+80106135:	74 29                	je     80106160 <log_write+0x80>
+        if (log.lh.block[i] == b->blockno)  // log absorb
+80106137:	39 0c 85 24 44 1b 80 	cmp    %ecx,-0x7fe4bbdc(,%eax,4)
+8010613e:	75 f0                	jne    80106130 <log_write+0x50>
+            break;
+    }
+    log.lh.block[i] = b->blockno;
+80106140:	89 0c 85 24 44 1b 80 	mov    %ecx,-0x7fe4bbdc(,%eax,4)
+    if (i == log.lh.n)
+80106147:	39 c2                	cmp    %eax,%edx
+80106149:	74 1c                	je     80106167 <log_write+0x87>
+        log.lh.n ++;
+    b->flags |= B_DIRTY;    // prevent eviction
+8010614b:	83 0b 04             	orl    $0x4,(%ebx)
+    release(&log.lock);
+8010614e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    release(&log.lock);
+80106151:	c7 45 08 c0 43 1b 80 	movl   $0x801b43c0,0x8(%ebp)
+80106158:	c9                   	leave
+    release(&log.lock);
+80106159:	e9 72 b1 ff ff       	jmp    801012d0 <release>
+8010615e:	66 90                	xchg   %ax,%ax
+    log.lh.block[i] = b->blockno;
+80106160:	89 0c 95 24 44 1b 80 	mov    %ecx,-0x7fe4bbdc(,%edx,4)
+        log.lh.n ++;
+80106167:	83 c2 01             	add    $0x1,%edx
+8010616a:	89 15 20 44 1b 80    	mov    %edx,0x801b4420
+80106170:	eb d9                	jmp    8010614b <log_write+0x6b>
+        panic("log_write: too big transaction");
+80106172:	83 ec 0c             	sub    $0xc,%esp
+80106175:	68 90 b3 10 80       	push   $0x8010b390
+8010617a:	e8 c1 3b 00 00       	call   80109d40 <panic>
+        panic("log_write: outside of trans, please wrap in begin_op()/end_op()");
+8010617f:	83 ec 0c             	sub    $0xc,%esp
+80106182:	68 b0 b3 10 80       	push   $0x8010b3b0
+80106187:	e8 b4 3b 00 00       	call   80109d40 <panic>
+8010618c:	66 90                	xchg   %ax,%ax
+8010618e:	66 90                	xchg   %ax,%ax
+
+80106190 <lockstatget>:
+static struct lockstat lockstat[NCPU][NLOCKSTAT + 1];
+
+// this cpu's entry for lock name taken at pc. interrupts must be off.
+struct lockstat*
+lockstatget(char *name, uint pc)
+{
+80106190:	55                   	push   %ebp
+80106191:	89 e5                	mov    %esp,%ebp
+80106193:	57                   	push   %edi
+80106194:	56                   	push   %esi
+80106195:	53                   	push   %ebx
+80106196:	83 ec 1c             	sub    $0x1c,%esp
+80106199:	8b 75 08             	mov    0x8(%ebp),%esi
+    struct lockstat *tab, *s;
+    uint h, i;
+
+    tab = lockstat[cpuid()];
+8010619c:	e8 9f 22 00 00       	call   80108440 <cpuid>
+    h = ((uint)name ^ pc) % NLOCKSTAT;
+801061a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+    tab = lockstat[cpuid()];
+801061a4:	69 d8 30 0c 00 00    	imul   $0xc30,%eax,%ebx
+    h = ((uint)name ^ pc) % NLOCKSTAT;
+801061aa:	31 f2                	xor    %esi,%edx
+801061ac:	8d 7a 40             	lea    0x40(%edx),%edi
+801061af:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+    tab = lockstat[cpuid()];
+801061b2:	81 c3 c0 44 1b 80    	add    $0x801b44c0,%ebx
+    for (i = 0; i < NLOCKSTAT; i++) {
+801061b8:	eb 12                	jmp    801061cc <lockstatget+0x3c>
+801061ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        s = &tab[(h + i) % NLOCKSTAT];
+        if (s->name == name && s->pc == pc)
+            return s;
+        if (s->name == 0) {
+801061c0:	85 c9                	test   %ecx,%ecx
+801061c2:	74 2c                	je     801061f0 <lockstatget+0x60>
+    for (i = 0; i < NLOCKSTAT; i++) {
+801061c4:	83 c2 01             	add    $0x1,%edx
+801061c7:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+801061ca:	74 34                	je     80106200 <lockstatget+0x70>
+        s = &tab[(h + i) % NLOCKSTAT];
+801061cc:	89 d0                	mov    %edx,%eax
+801061ce:	83 e0 3f             	and    $0x3f,%eax
+801061d1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+801061d4:	c1 e0 04             	shl    $0x4,%eax
+801061d7:	01 d8                	add    %ebx,%eax
+        if (s->name == name && s->pc == pc)
+801061d9:	8b 08                	mov    (%eax),%ecx
+801061db:	39 f1                	cmp    %esi,%ecx
+801061dd:	75 e1                	jne    801061c0 <lockstatget+0x30>
+801061df:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801061e2:	39 78 04             	cmp    %edi,0x4(%eax)
+801061e5:	75 d9                	jne    801061c0 <lockstatget+0x30>
+        }
+    }
+    s = &tab[NLOCKSTAT];
+    s->name = "(other)";
+    return s;
+}
+801061e7:	83 c4 1c             	add    $0x1c,%esp
+801061ea:	5b                   	pop    %ebx
+801061eb:	5e                   	pop    %esi
+801061ec:	5f                   	pop    %edi
+801061ed:	5d                   	pop    %ebp
+801061ee:	c3                   	ret
+801061ef:	90                   	nop
+            s->pc = pc;
+801061f0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+            s->name = name;
+801061f3:	89 30                	mov    %esi,(%eax)
+            s->pc = pc;
+801061f5:	89 78 04             	mov    %edi,0x4(%eax)
+}
+801061f8:	83 c4 1c             	add    $0x1c,%esp
+801061fb:	5b                   	pop    %ebx
+801061fc:	5e                   	pop    %esi
+801061fd:	5f                   	pop    %edi
+801061fe:	5d                   	pop    %ebp
+801061ff:	c3                   	ret
+    s->name = "(other)";
+80106200:	c7 83 00 0c 00 00 f0 	movl   $0x8010b3f0,0xc00(%ebx)
+80106207:	b3 10 80 
+}
+8010620a:	83 c4 1c             	add    $0x1c,%esp
+    s = &tab[NLOCKSTAT];
+8010620d:	8d 83 00 0c 00 00    	lea    0xc00(%ebx),%eax
+}
+80106213:	5b                   	pop    %ebx
+80106214:	5e                   	pop    %esi
+80106215:	5f                   	pop    %edi
+80106216:	5d                   	pop    %ebp
+80106217:	c3                   	ret
+80106218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010621f:	90                   	nop
+
+80106220 <lockstatacquired>:
+
+void
+lockstatacquired(struct lockstat *s, int contended, uint64 wait)
+{
+80106220:	55                   	push   %ebp
+80106221:	89 e5                	mov    %esp,%ebp
+80106223:	53                   	push   %ebx
+80106224:	8b 45 08             	mov    0x8(%ebp),%eax
+    s->nacquire++;
+    if (contended) {
+80106227:	8b 55 0c             	mov    0xc(%ebp),%edx
+{
+8010622a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010622d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+    s->nacquire++;
+80106230:	83 40 08 01          	addl   $0x1,0x8(%eax)
+    if (contended) {
+80106234:	85 d2                	test   %edx,%edx
+80106236:	74 1a                	je     80106252 <lockstatacquired+0x32>
+        s->ncontend++;
+        s->wait += wait;
+        if (wait > s->maxwait)
+80106238:	8b 50 1c             	mov    0x1c(%eax),%edx
+        s->ncontend++;
+8010623b:	83 40 0c 01          	addl   $0x1,0xc(%eax)
+        s->wait += wait;
+8010623f:	01 48 10             	add    %ecx,0x10(%eax)
+80106242:	11 58 14             	adc    %ebx,0x14(%eax)
+        if (wait > s->maxwait)
+80106245:	39 48 18             	cmp    %ecx,0x18(%eax)
+80106248:	19 da                	sbb    %ebx,%edx
+8010624a:	73 06                	jae    80106252 <lockstatacquired+0x32>
+            s->maxwait = wait;
+8010624c:	89 48 18             	mov    %ecx,0x18(%eax)
+8010624f:	89 58 1c             	mov    %ebx,0x1c(%eax)
+    }
+}
+80106252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106255:	c9                   	leave
+80106256:	c3                   	ret
+80106257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010625e:	66 90                	xchg   %ax,%ax
+
+80106260 <lockstatreleased>:
+
+// the lock counted in s, taken at tsc since, is being released
+void
+lockstatreleased(struct lockstat *s, uint64 since)
+{
+80106260:	55                   	push   %ebp
+80106261:	89 e5                	mov    %esp,%ebp
+80106263:	53                   	push   %ebx
+80106264:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    asm volatile("rdtsc" : "=A" (tsc));
+80106267:	0f 31                	rdtsc
+    uint64 hold = rdtsc() - since;
+
+    s->hold += hold;
+    if (hold > s->maxhold)
+80106269:	8b 59 2c             	mov    0x2c(%ecx),%ebx
+    uint64 hold = rdtsc() - since;
+8010626c:	2b 45 0c             	sub    0xc(%ebp),%eax
+8010626f:	1b 55 10             	sbb    0x10(%ebp),%edx
+    s->hold += hold;
+80106272:	01 41 20             	add    %eax,0x20(%ecx)
+80106275:	11 51 24             	adc    %edx,0x24(%ecx)
+    if (hold > s->maxhold)
+80106278:	39 41 28             	cmp    %eax,0x28(%ecx)
+8010627b:	19 d3                	sbb    %edx,%ebx
+8010627d:	73 06                	jae    80106285 <lockstatreleased+0x25>
+        s->maxhold = hold;
+8010627f:	89 41 28             	mov    %eax,0x28(%ecx)
+80106282:	89 51 2c             	mov    %edx,0x2c(%ecx)
+}
+80106285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106288:	c9                   	leave
+80106289:	c3                   	ret
+8010628a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106290 <lockstatdump>:
+
+// print the per-cpu tables added up by (name, call site).
+// totals are in units of 1024 cycles.
+void
+lockstatdump(void)
+{
+80106290:	55                   	push   %ebp
+80106291:	89 e5                	mov    %esp,%ebp
+80106293:	57                   	push   %edi
+80106294:	56                   	push   %esi
+80106295:	53                   	push   %ebx
+80106296:	83 ec 68             	sub    $0x68,%esp
+    struct lockstat sum, *s, *t;
+    int c, d, i, j;
+
+    cprintf("\nname pc acquire contended wait(kc) maxwait hold(kc) maxhold\n");
+80106299:	68 14 b4 10 80       	push   $0x8010b414
+8010629e:	e8 1d 3b 00 00       	call   80109dc0 <cprintf>
+    for (c = 0; c < ncpu; c++) {
+801062a3:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+801062a8:	83 c4 10             	add    $0x10,%esp
+801062ab:	85 c0                	test   %eax,%eax
+801062ad:	0f 8e 96 00 00 00    	jle    80106349 <lockstatdump+0xb9>
+801062b3:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+801062ba:	be c0 44 1b 80       	mov    $0x801b44c0,%esi
+        for (i = 0; i <= NLOCKSTAT; i++) {
+801062bf:	8b 5d b0             	mov    -0x50(%ebp),%ebx
+801062c2:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+801062c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801062c8:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+            }
+            if (d < c)
+                continue;
+
+            sum = *s;
+            for (d = c + 1; d < ncpu; d++) {
+801062cb:	83 c3 01             	add    $0x1,%ebx
+801062ce:	69 d3 30 0c 00 00    	imul   $0xc30,%ebx,%edx
+801062d4:	89 5d b0             	mov    %ebx,-0x50(%ebp)
+801062d7:	8d 9a f0 50 1b 80    	lea    -0x7fe4af10(%edx),%ebx
+801062dd:	89 5d ac             	mov    %ebx,-0x54(%ebp)
+801062e0:	8d 9a c0 44 1b 80    	lea    -0x7fe4bb40(%edx),%ebx
+801062e6:	89 5d b4             	mov    %ebx,-0x4c(%ebp)
+            if (s->name == 0)
+801062e9:	8b 16                	mov    (%esi),%edx
+801062eb:	85 d2                	test   %edx,%edx
+801062ed:	74 3d                	je     8010632c <lockstatdump+0x9c>
+            for (d = 0; d < c; d++) {
+801062ef:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801062f2:	bf c0 44 1b 80       	mov    $0x801b44c0,%edi
+801062f7:	31 db                	xor    %ebx,%ebx
+801062f9:	85 c0                	test   %eax,%eax
+801062fb:	74 6e                	je     8010636b <lockstatdump+0xdb>
+801062fd:	8d 76 00             	lea    0x0(%esi),%esi
+                for (j = 0; j <= NLOCKSTAT; j++) {
+80106300:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+            for (d = c + 1; d < ncpu; d++) {
+80106303:	89 f8                	mov    %edi,%eax
+                for (j = 0; j <= NLOCKSTAT; j++) {
+80106305:	31 c9                	xor    %ecx,%ecx
+80106307:	eb 12                	jmp    8010631b <lockstatdump+0x8b>
+80106309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106310:	83 c1 01             	add    $0x1,%ecx
+80106313:	83 c0 30             	add    $0x30,%eax
+80106316:	83 f9 41             	cmp    $0x41,%ecx
+80106319:	74 3d                	je     80106358 <lockstatdump+0xc8>
+                    if (t->name == s->name && t->pc == s->pc)
+8010631b:	3b 10                	cmp    (%eax),%edx
+8010631d:	75 f1                	jne    80106310 <lockstatdump+0x80>
+8010631f:	8b 7e 04             	mov    0x4(%esi),%edi
+80106322:	39 78 04             	cmp    %edi,0x4(%eax)
+80106325:	75 e9                	jne    80106310 <lockstatdump+0x80>
+            if (d < c)
+80106327:	39 5d bc             	cmp    %ebx,-0x44(%ebp)
+8010632a:	7e 3f                	jle    8010636b <lockstatdump+0xdb>
+        for (i = 0; i <= NLOCKSTAT; i++) {
+8010632c:	83 c6 30             	add    $0x30,%esi
+8010632f:	39 75 b4             	cmp    %esi,-0x4c(%ebp)
+80106332:	75 b5                	jne    801062e9 <lockstatdump+0x59>
+    for (c = 0; c < ncpu; c++) {
+80106334:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+80106337:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010633a:	81 c6 30 0c 00 00    	add    $0xc30,%esi
+80106340:	39 45 b0             	cmp    %eax,-0x50(%ebp)
+80106343:	0f 8c 76 ff ff ff    	jl     801062bf <lockstatdump+0x2f>
+            }
+            cprintf("%s %p %d %d %d %d %d %d\n", sum.name, sum.pc, sum.nacquire, sum.ncontend,
+                    (uint)(sum.wait >> 10), (uint)sum.maxwait, (uint)(sum.hold >> 10), (uint)sum.maxhold);
+        }
+    }
+}
+80106349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010634c:	5b                   	pop    %ebx
+8010634d:	5e                   	pop    %esi
+8010634e:	5f                   	pop    %edi
+8010634f:	5d                   	pop    %ebp
+80106350:	c3                   	ret
+80106351:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106358:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+            for (d = 0; d < c; d++) {
+8010635b:	8b 45 bc             	mov    -0x44(%ebp),%eax
+8010635e:	83 c3 01             	add    $0x1,%ebx
+80106361:	81 c7 30 0c 00 00    	add    $0xc30,%edi
+80106367:	39 c3                	cmp    %eax,%ebx
+80106369:	75 95                	jne    80106300 <lockstatdump+0x70>
+            sum = *s;
+8010636b:	8b 46 04             	mov    0x4(%esi),%eax
+8010636e:	8b 4e 10             	mov    0x10(%esi),%ecx
+80106371:	8b 5e 14             	mov    0x14(%esi),%ebx
+80106374:	8b 7e 2c             	mov    0x2c(%esi),%edi
+80106377:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010637a:	8b 46 08             	mov    0x8(%esi),%eax
+8010637d:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+80106380:	8b 4e 20             	mov    0x20(%esi),%ecx
+80106383:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80106386:	8b 46 0c             	mov    0xc(%esi),%eax
+80106389:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+8010638c:	8b 5e 24             	mov    0x24(%esi),%ebx
+8010638f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80106392:	8b 46 18             	mov    0x18(%esi),%eax
+80106395:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+            for (d = c + 1; d < ncpu; d++) {
+80106398:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+            sum = *s;
+8010639b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010639e:	8b 46 1c             	mov    0x1c(%esi),%eax
+801063a1:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+801063a4:	89 45 a8             	mov    %eax,-0x58(%ebp)
+801063a7:	8b 46 28             	mov    0x28(%esi),%eax
+801063aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            for (d = c + 1; d < ncpu; d++) {
+801063ad:	39 5d b0             	cmp    %ebx,-0x50(%ebp)
+801063b0:	0f 8d c8 00 00 00    	jge    8010647e <lockstatdump+0x1ee>
+801063b6:	69 c3 30 0c 00 00    	imul   $0xc30,%ebx,%eax
+801063bc:	89 75 a0             	mov    %esi,-0x60(%ebp)
+801063bf:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+801063c2:	8b 75 a8             	mov    -0x58(%ebp),%esi
+801063c5:	8d 98 f0 50 1b 80    	lea    -0x7fe4af10(%eax),%ebx
+801063cb:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+801063ce:	89 fb                	mov    %edi,%ebx
+801063d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801063d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801063d7:	90                   	nop
+                for (j = 0; j <= NLOCKSTAT; j++) {
+801063d8:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801063db:	8d 81 d0 f3 ff ff    	lea    -0xc30(%ecx),%eax
+801063e1:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801063e4:	eb 11                	jmp    801063f7 <lockstatdump+0x167>
+801063e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063ed:	8d 76 00             	lea    0x0(%esi),%esi
+801063f0:	83 c0 30             	add    $0x30,%eax
+801063f3:	39 c1                	cmp    %eax,%ecx
+801063f5:	74 6a                	je     80106461 <lockstatdump+0x1d1>
+                    if (t->name != s->name || t->pc != s->pc)
+801063f7:	3b 10                	cmp    (%eax),%edx
+801063f9:	75 f5                	jne    801063f0 <lockstatdump+0x160>
+801063fb:	8b 7d d8             	mov    -0x28(%ebp),%edi
+801063fe:	3b 78 04             	cmp    0x4(%eax),%edi
+80106401:	75 ed                	jne    801063f0 <lockstatdump+0x160>
+                    sum.nacquire += t->nacquire;
+80106403:	8b 70 08             	mov    0x8(%eax),%esi
+                    sum.ncontend += t->ncontend;
+80106406:	8b 78 0c             	mov    0xc(%eax),%edi
+                    sum.nacquire += t->nacquire;
+80106409:	01 75 d0             	add    %esi,-0x30(%ebp)
+                    sum.wait += t->wait;
+8010640c:	8b 70 10             	mov    0x10(%eax),%esi
+                    sum.ncontend += t->ncontend;
+8010640f:	01 7d d4             	add    %edi,-0x2c(%ebp)
+                    sum.wait += t->wait;
+80106412:	8b 78 14             	mov    0x14(%eax),%edi
+80106415:	01 75 c8             	add    %esi,-0x38(%ebp)
+                    sum.hold += t->hold;
+80106418:	8b 70 20             	mov    0x20(%eax),%esi
+                    sum.wait += t->wait;
+8010641b:	11 7d cc             	adc    %edi,-0x34(%ebp)
+                    sum.hold += t->hold;
+8010641e:	8b 78 24             	mov    0x24(%eax),%edi
+80106421:	01 75 c0             	add    %esi,-0x40(%ebp)
+80106424:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80106427:	11 7d c4             	adc    %edi,-0x3c(%ebp)
+8010642a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+8010642d:	3b 70 18             	cmp    0x18(%eax),%esi
+80106430:	1b 78 1c             	sbb    0x1c(%eax),%edi
+80106433:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106436:	0f 42 70 18          	cmovb  0x18(%eax),%esi
+8010643a:	0f 42 78 1c          	cmovb  0x1c(%eax),%edi
+8010643e:	89 75 dc             	mov    %esi,-0x24(%ebp)
+80106441:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80106444:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+                    if (t->maxhold > sum.maxhold)
+80106447:	3b 70 28             	cmp    0x28(%eax),%esi
+8010644a:	89 df                	mov    %ebx,%edi
+8010644c:	1b 78 2c             	sbb    0x2c(%eax),%edi
+8010644f:	0f 42 70 28          	cmovb  0x28(%eax),%esi
+80106453:	0f 42 58 2c          	cmovb  0x2c(%eax),%ebx
+                for (j = 0; j <= NLOCKSTAT; j++) {
+80106457:	83 c0 30             	add    $0x30,%eax
+8010645a:	89 75 e0             	mov    %esi,-0x20(%ebp)
+8010645d:	39 c1                	cmp    %eax,%ecx
+8010645f:	75 96                	jne    801063f7 <lockstatdump+0x167>
+            for (d = c + 1; d < ncpu; d++) {
+80106461:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80106464:	81 c1 30 0c 00 00    	add    $0xc30,%ecx
+8010646a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010646d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106470:	39 c1                	cmp    %eax,%ecx
+80106472:	0f 85 60 ff ff ff    	jne    801063d8 <lockstatdump+0x148>
+80106478:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+8010647b:	8b 75 a0             	mov    -0x60(%ebp),%esi
+            cprintf("%s %p %d %d %d %d %d %d\n", sum.name, sum.pc, sum.nacquire, sum.ncontend,
+8010647e:	83 ec 0c             	sub    $0xc,%esp
+80106481:	ff 75 e4             	push   -0x1c(%ebp)
+                    (uint)(sum.wait >> 10), (uint)sum.maxwait, (uint)(sum.hold >> 10), (uint)sum.maxhold);
+80106484:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+80106487:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+8010648a:	0f ac d9 0a          	shrd   $0xa,%ebx,%ecx
+            cprintf("%s %p %d %d %d %d %d %d\n", sum.name, sum.pc, sum.nacquire, sum.ncontend,
+8010648e:	51                   	push   %ecx
+8010648f:	ff 75 dc             	push   -0x24(%ebp)
+                    (uint)(sum.wait >> 10), (uint)sum.maxwait, (uint)(sum.hold >> 10), (uint)sum.maxhold);
+80106492:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+80106495:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+80106498:	0f ac d9 0a          	shrd   $0xa,%ebx,%ecx
+            cprintf("%s %p %d %d %d %d %d %d\n", sum.name, sum.pc, sum.nacquire, sum.ncontend,
+8010649c:	51                   	push   %ecx
+8010649d:	ff 75 d4             	push   -0x2c(%ebp)
+801064a0:	ff 75 d0             	push   -0x30(%ebp)
+801064a3:	ff 75 d8             	push   -0x28(%ebp)
+801064a6:	52                   	push   %edx
+801064a7:	68 f8 b3 10 80       	push   $0x8010b3f8
+801064ac:	e8 0f 39 00 00       	call   80109dc0 <cprintf>
+    for (c = 0; c < ncpu; c++) {
+801064b1:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+801064b6:	83 c4 30             	add    $0x30,%esp
+801064b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801064bc:	e9 6b fe ff ff       	jmp    8010632c <lockstatdump+0x9c>
+801064c1:	66 90                	xchg   %ax,%ax
+801064c3:	66 90                	xchg   %ax,%ax
+801064c5:	66 90                	xchg   %ax,%ax
+801064c7:	66 90                	xchg   %ax,%ax
+801064c9:	66 90                	xchg   %ax,%ax
+801064cb:	66 90                	xchg   %ax,%ax
+801064cd:	66 90                	xchg   %ax,%ax
+801064cf:	90                   	nop
+
+801064d0 <kstatinc>:
+        [KS_READAHEAD]  "readahead",
+};
+
+void
+kstatinc(int i)
+{
+801064d0:	55                   	push   %ebp
+801064d1:	89 e5                	mov    %esp,%ebp
+801064d3:	53                   	push   %ebx
+801064d4:	83 ec 04             	sub    $0x4,%esp
+801064d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    pushcli();
+801064da:	e8 21 ac ff ff       	call   80101100 <pushcli>
+    kstat[cpuid()].n[i]++;
+801064df:	e8 5c 1f 00 00       	call   80108440 <cpuid>
+801064e4:	c1 e0 04             	shl    $0x4,%eax
+801064e7:	01 d8                	add    %ebx,%eax
+801064e9:	83 04 85 00 d7 1b 80 	addl   $0x1,-0x7fe42900(,%eax,4)
+801064f0:	01 
+    popcli();
+}
+801064f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801064f4:	c9                   	leave
+    popcli();
+801064f5:	e9 56 ac ff ff       	jmp    80101150 <popcli>
+801064fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106500 <kstatread>:
+
+uint
+kstatread(int i)
+{
+80106500:	55                   	push   %ebp
+    uint sum = 0;
+    int c;
+
+    for (c = 0; c < ncpu; c++)
+80106501:	8b 15 48 c6 18 80    	mov    0x8018c648,%edx
+{
+80106507:	89 e5                	mov    %esp,%ebp
+80106509:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    for (c = 0; c < ncpu; c++)
+8010650c:	85 d2                	test   %edx,%edx
+8010650e:	7e 28                	jle    80106538 <kstatread+0x38>
+80106510:	c1 e2 04             	shl    $0x4,%edx
+80106513:	8d 04 8d 00 d7 1b 80 	lea    -0x7fe42900(,%ecx,4),%eax
+8010651a:	01 ca                	add    %ecx,%edx
+8010651c:	8d 0c 95 00 d7 1b 80 	lea    -0x7fe42900(,%edx,4),%ecx
+    uint sum = 0;
+80106523:	31 d2                	xor    %edx,%edx
+80106525:	8d 76 00             	lea    0x0(%esi),%esi
+        sum += kstat[c].n[i];
+80106528:	03 10                	add    (%eax),%edx
+    for (c = 0; c < ncpu; c++)
+8010652a:	83 c0 40             	add    $0x40,%eax
+8010652d:	39 c8                	cmp    %ecx,%eax
+8010652f:	75 f7                	jne    80106528 <kstatread+0x28>
+    return sum;
+}
+80106531:	89 d0                	mov    %edx,%eax
+80106533:	5d                   	pop    %ebp
+80106534:	c3                   	ret
+80106535:	8d 76 00             	lea    0x0(%esi),%esi
+    uint sum = 0;
+80106538:	31 d2                	xor    %edx,%edx
+}
+8010653a:	5d                   	pop    %ebp
+8010653b:	89 d0                	mov    %edx,%eax
+8010653d:	c3                   	ret
+8010653e:	66 90                	xchg   %ax,%ax
+
+80106540 <kstatdump>:
+
+void
+kstatdump(void)
+{
+80106540:	55                   	push   %ebp
+80106541:	89 e5                	mov    %esp,%ebp
+80106543:	57                   	push   %edi
+80106544:	56                   	push   %esi
+80106545:	53                   	push   %ebx
+80106546:	83 ec 28             	sub    $0x28,%esp
+    int i, c;
+
+    cprintf("counter:");
+80106549:	68 52 b4 10 80       	push   $0x8010b452
+8010654e:	e8 6d 38 00 00       	call   80109dc0 <cprintf>
+    for (c = 0; c < ncpu; c++)
+80106553:	8b 15 48 c6 18 80    	mov    0x8018c648,%edx
+80106559:	83 c4 10             	add    $0x10,%esp
+8010655c:	85 d2                	test   %edx,%edx
+8010655e:	7e 24                	jle    80106584 <kstatdump+0x44>
+80106560:	31 db                	xor    %ebx,%ebx
+80106562:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        cprintf(" cpu%d", c);
+80106568:	83 ec 08             	sub    $0x8,%esp
+8010656b:	53                   	push   %ebx
+    for (c = 0; c < ncpu; c++)
+8010656c:	83 c3 01             	add    $0x1,%ebx
+        cprintf(" cpu%d", c);
+8010656f:	68 5b b4 10 80       	push   $0x8010b45b
+80106574:	e8 47 38 00 00       	call   80109dc0 <cprintf>
+    for (c = 0; c < ncpu; c++)
+80106579:	83 c4 10             	add    $0x10,%esp
+8010657c:	39 1d 48 c6 18 80    	cmp    %ebx,0x8018c648
+80106582:	7f e4                	jg     80106568 <kstatdump+0x28>
+    cprintf(" total\n");
+80106584:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < NKSTAT; i++) {
+80106587:	31 db                	xor    %ebx,%ebx
+    cprintf(" total\n");
+80106589:	68 62 b4 10 80       	push   $0x8010b462
+8010658e:	e8 2d 38 00 00       	call   80109dc0 <cprintf>
+80106593:	c7 45 e4 00 d7 1b 80 	movl   $0x801bd700,-0x1c(%ebp)
+8010659a:	83 c4 10             	add    $0x10,%esp
+8010659d:	8d 76 00             	lea    0x0(%esi),%esi
+        cprintf("%s:", kstatnames[i]);
+801065a0:	83 ec 08             	sub    $0x8,%esp
+801065a3:	ff 34 9d c0 b4 10 80 	push   -0x7fef4b40(,%ebx,4)
+801065aa:	68 53 af 10 80       	push   $0x8010af53
+801065af:	e8 0c 38 00 00       	call   80109dc0 <cprintf>
+        for (c = 0; c < ncpu; c++)
+801065b4:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+801065b9:	83 c4 10             	add    $0x10,%esp
+801065bc:	85 c0                	test   %eax,%eax
+801065be:	0f 8e 8c 00 00 00    	jle    80106650 <kstatdump+0x110>
+801065c4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801065c7:	31 ff                	xor    %edi,%edi
+801065c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            cprintf(" %d", kstat[c].n[i]);
+801065d0:	83 ec 08             	sub    $0x8,%esp
+801065d3:	ff 36                	push   (%esi)
+        for (c = 0; c < ncpu; c++)
+801065d5:	83 c7 01             	add    $0x1,%edi
+801065d8:	83 c6 40             	add    $0x40,%esi
+            cprintf(" %d", kstat[c].n[i]);
+801065db:	68 4c af 10 80       	push   $0x8010af4c
+801065e0:	e8 db 37 00 00       	call   80109dc0 <cprintf>
+        for (c = 0; c < ncpu; c++)
+801065e5:	8b 15 48 c6 18 80    	mov    0x8018c648,%edx
+801065eb:	83 c4 10             	add    $0x10,%esp
+801065ee:	39 fa                	cmp    %edi,%edx
+801065f0:	7f de                	jg     801065d0 <kstatdump+0x90>
+    for (c = 0; c < ncpu; c++)
+801065f2:	85 d2                	test   %edx,%edx
+801065f4:	7e 5a                	jle    80106650 <kstatdump+0x110>
+801065f6:	c1 e2 04             	shl    $0x4,%edx
+801065f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801065fc:	01 da                	add    %ebx,%edx
+801065fe:	8d 0c 95 00 d7 1b 80 	lea    -0x7fe42900(,%edx,4),%ecx
+    uint sum = 0;
+80106605:	31 d2                	xor    %edx,%edx
+80106607:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010660e:	66 90                	xchg   %ax,%ax
+        sum += kstat[c].n[i];
+80106610:	03 10                	add    (%eax),%edx
+    for (c = 0; c < ncpu; c++)
+80106612:	83 c0 40             	add    $0x40,%eax
+80106615:	39 c8                	cmp    %ecx,%eax
+80106617:	75 f7                	jne    80106610 <kstatdump+0xd0>
+        cprintf(" %d\n", kstatread(i));
+80106619:	83 ec 08             	sub    $0x8,%esp
+    for (i = 0; i < NKSTAT; i++) {
+8010661c:	83 c3 01             	add    $0x1,%ebx
+        cprintf(" %d\n", kstatread(i));
+8010661f:	52                   	push   %edx
+80106620:	68 28 b9 10 80       	push   $0x8010b928
+80106625:	e8 96 37 00 00       	call   80109dc0 <cprintf>
+    for (i = 0; i < NKSTAT; i++) {
+8010662a:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+8010662e:	83 c4 10             	add    $0x10,%esp
+80106631:	83 fb 0a             	cmp    $0xa,%ebx
+80106634:	0f 85 66 ff ff ff    	jne    801065a0 <kstatdump+0x60>
+    }
+    bcachedump();
+8010663a:	e8 51 ed ff ff       	call   80105390 <bcachedump>
+    blkstatdump();
+}
+8010663f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106642:	5b                   	pop    %ebx
+80106643:	5e                   	pop    %esi
+80106644:	5f                   	pop    %edi
+80106645:	5d                   	pop    %ebp
+    blkstatdump();
+80106646:	e9 55 c2 ff ff       	jmp    801028a0 <blkstatdump>
+8010664b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010664f:	90                   	nop
+    uint sum = 0;
+80106650:	31 d2                	xor    %edx,%edx
+80106652:	eb c5                	jmp    80106619 <kstatdump+0xd9>
+80106654:	66 90                	xchg   %ax,%ax
+80106656:	66 90                	xchg   %ax,%ax
+80106658:	66 90                	xchg   %ax,%ax
+8010665a:	66 90                	xchg   %ax,%ax
+8010665c:	66 90                	xchg   %ax,%ax
+8010665e:	66 90                	xchg   %ax,%ax
+
+80106660 <bfree>:
+}
+
+// free a disk block
+static void
+bfree(int dev, uint b)
+{
+80106660:	55                   	push   %ebp
+80106661:	89 c1                	mov    %eax,%ecx
+    struct buf *bp;
+    int bi, m;
+
+    bp = bread(dev, BBLOCK(b, sb));
+80106663:	89 d0                	mov    %edx,%eax
+80106665:	c1 e8 0c             	shr    $0xc,%eax
+{
+80106668:	89 e5                	mov    %esp,%ebp
+8010666a:	56                   	push   %esi
+8010666b:	53                   	push   %ebx
+    bp = bread(dev, BBLOCK(b, sb));
+8010666c:	03 05 98 0c 1c 80    	add    0x801c0c98,%eax
+{
+80106672:	89 d3                	mov    %edx,%ebx
+    bp = bread(dev, BBLOCK(b, sb));
+80106674:	83 ec 08             	sub    $0x8,%esp
+80106677:	50                   	push   %eax
+80106678:	51                   	push   %ecx
+80106679:	e8 82 ea ff ff       	call   80105100 <bread>
+    bi = b % BPB;
+    m = 1 << (bi % 8);
+8010667e:	89 d9                	mov    %ebx,%ecx
+    if ((bp->data[bi / 8] & m) == 0)
+80106680:	c1 fb 03             	sar    $0x3,%ebx
+80106683:	83 c4 10             	add    $0x10,%esp
+    bp = bread(dev, BBLOCK(b, sb));
+80106686:	89 c6                	mov    %eax,%esi
+    m = 1 << (bi % 8);
+80106688:	83 e1 07             	and    $0x7,%ecx
+8010668b:	b8 01 00 00 00       	mov    $0x1,%eax
+    if ((bp->data[bi / 8] & m) == 0)
+80106690:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+80106696:	03 9e cc 00 00 00    	add    0xcc(%esi),%ebx
+    m = 1 << (bi % 8);
+8010669c:	d3 e0                	shl    %cl,%eax
+    if ((bp->data[bi / 8] & m) == 0)
+8010669e:	0f b6 0b             	movzbl (%ebx),%ecx
+801066a1:	85 c1                	test   %eax,%ecx
+801066a3:	74 21                	je     801066c6 <bfree+0x66>
+        panic("bfree: freeing free block");
+    bp->data[bi/8] &= ~m;
+801066a5:	f7 d0                	not    %eax
+    log_write(bp);
+801066a7:	83 ec 0c             	sub    $0xc,%esp
+    bp->data[bi/8] &= ~m;
+801066aa:	21 c8                	and    %ecx,%eax
+801066ac:	88 03                	mov    %al,(%ebx)
+    log_write(bp);
+801066ae:	56                   	push   %esi
+801066af:	e8 2c fa ff ff       	call   801060e0 <log_write>
+    brelse(bp);
+801066b4:	89 34 24             	mov    %esi,(%esp)
+801066b7:	e8 74 ed ff ff       	call   80105430 <brelse>
+}
+801066bc:	83 c4 10             	add    $0x10,%esp
+801066bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801066c2:	5b                   	pop    %ebx
+801066c3:	5e                   	pop    %esi
+801066c4:	5d                   	pop    %ebp
+801066c5:	c3                   	ret
+        panic("bfree: freeing free block");
+801066c6:	83 ec 0c             	sub    $0xc,%esp
+801066c9:	68 e8 b4 10 80       	push   $0x8010b4e8
+801066ce:	e8 6d 36 00 00       	call   80109d40 <panic>
+801066d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801066e0 <balloc>:
+{
+801066e0:	55                   	push   %ebp
+801066e1:	89 e5                	mov    %esp,%ebp
+801066e3:	57                   	push   %edi
+801066e4:	56                   	push   %esi
+801066e5:	53                   	push   %ebx
+801066e6:	83 ec 1c             	sub    $0x1c,%esp
+    for (b = 0; b < sb.size; b += BPB) {
+801066e9:	8b 0d 80 0c 1c 80    	mov    0x801c0c80,%ecx
+{
+801066ef:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for (b = 0; b < sb.size; b += BPB) {
+801066f2:	85 c9                	test   %ecx,%ecx
+801066f4:	0f 84 90 00 00 00    	je     8010678a <balloc+0xaa>
+801066fa:	31 ff                	xor    %edi,%edi
+        bp = bread(dev, BBLOCK(b, sb));
+801066fc:	89 f8                	mov    %edi,%eax
+801066fe:	83 ec 08             	sub    $0x8,%esp
+80106701:	89 fe                	mov    %edi,%esi
+80106703:	c1 f8 0c             	sar    $0xc,%eax
+80106706:	03 05 98 0c 1c 80    	add    0x801c0c98,%eax
+8010670c:	50                   	push   %eax
+8010670d:	ff 75 dc             	push   -0x24(%ebp)
+80106710:	e8 eb e9 ff ff       	call   80105100 <bread>
+80106715:	89 7d d8             	mov    %edi,-0x28(%ebp)
+80106718:	83 c4 10             	add    $0x10,%esp
+8010671b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        for (bi = 0; bi < BPB && b + bi < sb.size; bi++) {
+8010671e:	a1 80 0c 1c 80       	mov    0x801c0c80,%eax
+80106723:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106726:	31 c0                	xor    %eax,%eax
+80106728:	eb 36                	jmp    80106760 <balloc+0x80>
+8010672a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            if ((bp->data[bi/8] & m) == 0) {    // is block free?
+80106730:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106733:	89 c2                	mov    %eax,%edx
+            m = 1 << (bi % 8);
+80106735:	89 c1                	mov    %eax,%ecx
+80106737:	bb 01 00 00 00       	mov    $0x1,%ebx
+            if ((bp->data[bi/8] & m) == 0) {    // is block free?
+8010673c:	c1 fa 03             	sar    $0x3,%edx
+            m = 1 << (bi % 8);
+8010673f:	83 e1 07             	and    $0x7,%ecx
+            if ((bp->data[bi/8] & m) == 0) {    // is block free?
+80106742:	03 97 cc 00 00 00    	add    0xcc(%edi),%edx
+            m = 1 << (bi % 8);
+80106748:	d3 e3                	shl    %cl,%ebx
+            if ((bp->data[bi/8] & m) == 0) {    // is block free?
+8010674a:	0f b6 3a             	movzbl (%edx),%edi
+8010674d:	89 f9                	mov    %edi,%ecx
+8010674f:	85 df                	test   %ebx,%edi
+80106751:	74 4d                	je     801067a0 <balloc+0xc0>
+        for (bi = 0; bi < BPB && b + bi < sb.size; bi++) {
+80106753:	83 c0 01             	add    $0x1,%eax
+80106756:	83 c6 01             	add    $0x1,%esi
+80106759:	3d 00 10 00 00       	cmp    $0x1000,%eax
+8010675e:	74 07                	je     80106767 <balloc+0x87>
+80106760:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80106763:	39 fe                	cmp    %edi,%esi
+80106765:	72 c9                	jb     80106730 <balloc+0x50>
+        brelse(bp);
+80106767:	8b 7d d8             	mov    -0x28(%ebp),%edi
+8010676a:	83 ec 0c             	sub    $0xc,%esp
+8010676d:	ff 75 e4             	push   -0x1c(%ebp)
+    for (b = 0; b < sb.size; b += BPB) {
+80106770:	81 c7 00 10 00 00    	add    $0x1000,%edi
+        brelse(bp);
+80106776:	e8 b5 ec ff ff       	call   80105430 <brelse>
+    for (b = 0; b < sb.size; b += BPB) {
+8010677b:	83 c4 10             	add    $0x10,%esp
+8010677e:	3b 3d 80 0c 1c 80    	cmp    0x801c0c80,%edi
+80106784:	0f 82 72 ff ff ff    	jb     801066fc <balloc+0x1c>
+    panic("balloc: out of blocks");
+8010678a:	83 ec 0c             	sub    $0xc,%esp
+8010678d:	68 02 b5 10 80       	push   $0x8010b502
+80106792:	e8 a9 35 00 00       	call   80109d40 <panic>
+80106797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010679e:	66 90                	xchg   %ax,%ax
+                bp->data[bi/8] |= m;    // mark block in use
+801067a0:	09 d9                	or     %ebx,%ecx
+                log_write(bp);
+801067a2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801067a5:	83 ec 0c             	sub    $0xc,%esp
+                bp->data[bi/8] |= m;    // mark block in use
+801067a8:	88 0a                	mov    %cl,(%edx)
+                log_write(bp);
+801067aa:	53                   	push   %ebx
+801067ab:	e8 30 f9 ff ff       	call   801060e0 <log_write>
+                brelse(bp);
+801067b0:	89 1c 24             	mov    %ebx,(%esp)
+801067b3:	e8 78 ec ff ff       	call   80105430 <brelse>
+    bp = bread(dev, bno);
+801067b8:	58                   	pop    %eax
+801067b9:	5a                   	pop    %edx
+801067ba:	56                   	push   %esi
+801067bb:	ff 75 dc             	push   -0x24(%ebp)
+801067be:	e8 3d e9 ff ff       	call   80105100 <bread>
+    memset(bp->data, 0, BSIZE);
+801067c3:	83 c4 0c             	add    $0xc,%esp
+801067c6:	68 00 02 00 00       	push   $0x200
+    bp = bread(dev, bno);
+801067cb:	89 c3                	mov    %eax,%ebx
+    memset(bp->data, 0, BSIZE);
+801067cd:	6a 00                	push   $0x0
+801067cf:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+801067d5:	e8 66 98 ff ff       	call   80100040 <memset>
+    log_write(bp);
+801067da:	89 1c 24             	mov    %ebx,(%esp)
+801067dd:	e8 fe f8 ff ff       	call   801060e0 <log_write>
+    brelse(bp);
+801067e2:	89 1c 24             	mov    %ebx,(%esp)
+801067e5:	e8 46 ec ff ff       	call   80105430 <brelse>
+}
+801067ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801067ed:	89 f0                	mov    %esi,%eax
+801067ef:	5b                   	pop    %ebx
+801067f0:	5e                   	pop    %esi
+801067f1:	5f                   	pop    %edi
+801067f2:	5d                   	pop    %ebp
+801067f3:	c3                   	ret
+801067f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801067fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801067ff:	90                   	nop
+
+80106800 <iget>:
+
+// find the inode with number inum on device dev and return the in-memory copy.
+// does not lock the inode and does not read it from disk.
+static struct inode*
+iget(uint dev, uint inum)
+{
+80106800:	55                   	push   %ebp
+80106801:	89 e5                	mov    %esp,%ebp
+80106803:	57                   	push   %edi
+80106804:	89 c7                	mov    %eax,%edi
+80106806:	56                   	push   %esi
+80106807:	53                   	push   %ebx
+    struct inode *ip, *empty;
+
+    // is the inode already cached?
+    rcureadlock();
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+80106808:	bb 80 da 1b 80       	mov    $0x801bda80,%ebx
+{
+8010680d:	83 ec 1c             	sub    $0x1c,%esp
+80106810:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    rcureadlock();
+80106813:	e8 28 b5 ff ff       	call   80101d40 <rcureadlock>
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+80106818:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010681b:	eb 11                	jmp    8010682e <iget+0x2e>
+8010681d:	8d 76 00             	lea    0x0(%esi),%esi
+80106820:	81 c3 00 01 00 00    	add    $0x100,%ebx
+80106826:	81 fb 80 0c 1c 80    	cmp    $0x801c0c80,%ebx
+8010682c:	74 42                	je     80106870 <iget+0x70>
+        if (ip->dev == dev && ip->inum == inum && igetref(ip, dev, inum)) {
+8010682e:	39 3b                	cmp    %edi,(%ebx)
+80106830:	75 ee                	jne    80106820 <iget+0x20>
+80106832:	39 53 04             	cmp    %edx,0x4(%ebx)
+80106835:	75 e9                	jne    80106820 <iget+0x20>
+        if ((r = ip->ref) == 0)
+80106837:	8b 43 08             	mov    0x8(%ebx),%eax
+8010683a:	85 c0                	test   %eax,%eax
+8010683c:	74 e2                	je     80106820 <iget+0x20>
+    } while (!__sync_bool_compare_and_swap(&ip->ref, r, r + 1));
+8010683e:	8d 4b 08             	lea    0x8(%ebx),%ecx
+80106841:	8d 70 01             	lea    0x1(%eax),%esi
+80106844:	f0 0f b1 31          	lock cmpxchg %esi,(%ecx)
+80106848:	75 ed                	jne    80106837 <iget+0x37>
+    if (ip->dev == dev && ip->inum == inum)
+8010684a:	3b 3b                	cmp    (%ebx),%edi
+8010684c:	75 09                	jne    80106857 <iget+0x57>
+8010684e:	3b 53 04             	cmp    0x4(%ebx),%edx
+80106851:	0f 84 fd 00 00 00    	je     80106954 <iget+0x154>
+    __sync_fetch_and_sub(&ip->ref, 1);
+80106857:	f0 83 29 01          	lock subl $0x1,(%ecx)
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+8010685b:	81 c3 00 01 00 00    	add    $0x100,%ebx
+80106861:	81 fb 80 0c 1c 80    	cmp    $0x801c0c80,%ebx
+80106867:	75 c5                	jne    8010682e <iget+0x2e>
+80106869:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106870:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    rcureadunlock();
+
+    // look again with the lock held,
+    // someone may have cached it in between.
+    acquire(&icache.lock);
+    empty = 0;
+80106873:	31 db                	xor    %ebx,%ebx
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+80106875:	be 80 da 1b 80       	mov    $0x801bda80,%esi
+    rcureadunlock();
+8010687a:	e8 d1 b4 ff ff       	call   80101d50 <rcureadunlock>
+    acquire(&icache.lock);
+8010687f:	83 ec 0c             	sub    $0xc,%esp
+80106882:	68 00 da 1b 80       	push   $0x801bda00
+80106887:	e8 24 ac ff ff       	call   801014b0 <acquire>
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+8010688c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    acquire(&icache.lock);
+8010688f:	83 c4 10             	add    $0x10,%esp
+80106892:	eb 16                	jmp    801068aa <iget+0xaa>
+80106894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
+80106898:	39 3e                	cmp    %edi,(%esi)
+8010689a:	74 74                	je     80106910 <iget+0x110>
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+8010689c:	81 c6 00 01 00 00    	add    $0x100,%esi
+801068a2:	81 fe 80 0c 1c 80    	cmp    $0x801c0c80,%esi
+801068a8:	74 26                	je     801068d0 <iget+0xd0>
+        if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
+801068aa:	8b 46 08             	mov    0x8(%esi),%eax
+801068ad:	85 c0                	test   %eax,%eax
+801068af:	7f e7                	jg     80106898 <iget+0x98>
+            __sync_fetch_and_add(&ip->ref, 1);
+            release(&icache.lock);
+            return ip;
+        }
+        if (empty == 0 && ip->ref == 0) // remember empty slot
+801068b1:	85 db                	test   %ebx,%ebx
+801068b3:	75 e7                	jne    8010689c <iget+0x9c>
+801068b5:	85 c0                	test   %eax,%eax
+801068b7:	75 7d                	jne    80106936 <iget+0x136>
+801068b9:	89 f3                	mov    %esi,%ebx
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+801068bb:	81 c6 00 01 00 00    	add    $0x100,%esi
+801068c1:	81 fe 80 0c 1c 80    	cmp    $0x801c0c80,%esi
+801068c7:	75 e1                	jne    801068aa <iget+0xaa>
+801068c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+            empty = ip;
+    }
+
+    // recycle an inode cache entry
+    if (empty == 0)
+801068d0:	85 db                	test   %ebx,%ebx
+801068d2:	0f 84 8b 00 00 00    	je     80106963 <iget+0x163>
+        panic("iget: no inodes");
+
+    ip = empty;
+    ip->dev = dev;
+801068d8:	89 3b                	mov    %edi,(%ebx)
+    ip->inum = inum;
+    ip->valid = 0;
+    __sync_synchronize();
+    ip->ref = 1;    // lockless lookups may take references from here on
+    release(&icache.lock);
+801068da:	83 ec 0c             	sub    $0xc,%esp
+    ip->inum = inum;
+801068dd:	89 53 04             	mov    %edx,0x4(%ebx)
+    ip->valid = 0;
+801068e0:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+    __sync_synchronize();
+801068e7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    ip->ref = 1;    // lockless lookups may take references from here on
+801068ec:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+    release(&icache.lock);
+801068f3:	68 00 da 1b 80       	push   $0x801bda00
+801068f8:	e8 d3 a9 ff ff       	call   801012d0 <release>
+
+    return ip;
+801068fd:	83 c4 10             	add    $0x10,%esp
+}
+80106900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106903:	89 d8                	mov    %ebx,%eax
+80106905:	5b                   	pop    %ebx
+80106906:	5e                   	pop    %esi
+80106907:	5f                   	pop    %edi
+80106908:	5d                   	pop    %ebp
+80106909:	c3                   	ret
+8010690a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
+80106910:	39 56 04             	cmp    %edx,0x4(%esi)
+80106913:	75 87                	jne    8010689c <iget+0x9c>
+            __sync_fetch_and_add(&ip->ref, 1);
+80106915:	f0 83 46 08 01       	lock addl $0x1,0x8(%esi)
+            release(&icache.lock);
+8010691a:	83 ec 0c             	sub    $0xc,%esp
+            return ip;
+8010691d:	89 f3                	mov    %esi,%ebx
+            release(&icache.lock);
+8010691f:	68 00 da 1b 80       	push   $0x801bda00
+80106924:	e8 a7 a9 ff ff       	call   801012d0 <release>
+            return ip;
+80106929:	83 c4 10             	add    $0x10,%esp
+}
+8010692c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010692f:	89 d8                	mov    %ebx,%eax
+80106931:	5b                   	pop    %ebx
+80106932:	5e                   	pop    %esi
+80106933:	5f                   	pop    %edi
+80106934:	5d                   	pop    %ebp
+80106935:	c3                   	ret
+    for (ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++) {
+80106936:	81 c6 00 01 00 00    	add    $0x100,%esi
+8010693c:	81 fe 80 0c 1c 80    	cmp    $0x801c0c80,%esi
+80106942:	74 1f                	je     80106963 <iget+0x163>
+        if (ip->ref > 0 && ip->dev == dev && ip->inum == inum) {
+80106944:	8b 46 08             	mov    0x8(%esi),%eax
+80106947:	85 c0                	test   %eax,%eax
+80106949:	0f 8f 49 ff ff ff    	jg     80106898 <iget+0x98>
+8010694f:	e9 61 ff ff ff       	jmp    801068b5 <iget+0xb5>
+            rcureadunlock();
+80106954:	e8 f7 b3 ff ff       	call   80101d50 <rcureadunlock>
+}
+80106959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010695c:	89 d8                	mov    %ebx,%eax
+8010695e:	5b                   	pop    %ebx
+8010695f:	5e                   	pop    %esi
+80106960:	5f                   	pop    %edi
+80106961:	5d                   	pop    %ebp
+80106962:	c3                   	ret
+        panic("iget: no inodes");
+80106963:	83 ec 0c             	sub    $0xc,%esp
+80106966:	68 18 b5 10 80       	push   $0x8010b518
+8010696b:	e8 d0 33 00 00       	call   80109d40 <panic>
+
+80106970 <bmap>:
+
+// return the disk block address of the nth block in inode ip.
+// if there is no such block, bmap allocates one.
+static uint
+bmap(struct inode *ip, uint bn)
+{
+80106970:	55                   	push   %ebp
+80106971:	89 e5                	mov    %esp,%ebp
+80106973:	57                   	push   %edi
+80106974:	56                   	push   %esi
+80106975:	89 c6                	mov    %eax,%esi
+80106977:	53                   	push   %ebx
+80106978:	83 ec 1c             	sub    $0x1c,%esp
+    uint addr, *a;
+    struct buf *bp;
+
+    if (bn < NDIRECT) {
+8010697b:	83 fa 0b             	cmp    $0xb,%edx
+8010697e:	0f 86 8c 00 00 00    	jbe    80106a10 <bmap+0xa0>
+        if ((addr = ip->addrs[bn]) == 0)
+            ip->addrs[bn] = addr = balloc(ip->dev);
+        return addr;
+    }
+    bn -= NDIRECT;
+80106984:	8d 5a f4             	lea    -0xc(%edx),%ebx
+
+    if (bn < NINDIRECT) {
+80106987:	83 fb 7f             	cmp    $0x7f,%ebx
+8010698a:	0f 87 a2 00 00 00    	ja     80106a32 <bmap+0xc2>
+        // load indirect block, allocating if necessary.
+        if ((addr = ip->addrs[NDIRECT]) == 0)
+80106990:	8b 80 b4 00 00 00    	mov    0xb4(%eax),%eax
+80106996:	85 c0                	test   %eax,%eax
+80106998:	74 5e                	je     801069f8 <bmap+0x88>
+            ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+        bp = bread(ip->dev, addr);
+8010699a:	83 ec 08             	sub    $0x8,%esp
+8010699d:	50                   	push   %eax
+8010699e:	ff 36                	push   (%esi)
+801069a0:	e8 5b e7 ff ff       	call   80105100 <bread>
+        a = (uint*)bp->data;
+        if ((addr = a[bn]) == 0) {
+801069a5:	83 c4 10             	add    $0x10,%esp
+        bp = bread(ip->dev, addr);
+801069a8:	89 c2                	mov    %eax,%edx
+        if ((addr = a[bn]) == 0) {
+801069aa:	8b 80 cc 00 00 00    	mov    0xcc(%eax),%eax
+801069b0:	8d 1c 98             	lea    (%eax,%ebx,4),%ebx
+801069b3:	8b 3b                	mov    (%ebx),%edi
+801069b5:	85 ff                	test   %edi,%edi
+801069b7:	74 17                	je     801069d0 <bmap+0x60>
+            a[bn] = addr = balloc(ip->dev);
+            log_write(bp);
+        }
+        brelse(bp);
+801069b9:	83 ec 0c             	sub    $0xc,%esp
+801069bc:	52                   	push   %edx
+801069bd:	e8 6e ea ff ff       	call   80105430 <brelse>
+801069c2:	83 c4 10             	add    $0x10,%esp
+        return addr;
+    }
+
+    panic("bmap: out of range");
+}
+801069c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801069c8:	89 f8                	mov    %edi,%eax
+801069ca:	5b                   	pop    %ebx
+801069cb:	5e                   	pop    %esi
+801069cc:	5f                   	pop    %edi
+801069cd:	5d                   	pop    %ebp
+801069ce:	c3                   	ret
+801069cf:	90                   	nop
+            a[bn] = addr = balloc(ip->dev);
+801069d0:	8b 06                	mov    (%esi),%eax
+801069d2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801069d5:	e8 06 fd ff ff       	call   801066e0 <balloc>
+            log_write(bp);
+801069da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801069dd:	83 ec 0c             	sub    $0xc,%esp
+            a[bn] = addr = balloc(ip->dev);
+801069e0:	89 03                	mov    %eax,(%ebx)
+801069e2:	89 c7                	mov    %eax,%edi
+            log_write(bp);
+801069e4:	52                   	push   %edx
+801069e5:	e8 f6 f6 ff ff       	call   801060e0 <log_write>
+801069ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801069ed:	83 c4 10             	add    $0x10,%esp
+801069f0:	eb c7                	jmp    801069b9 <bmap+0x49>
+801069f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+801069f8:	8b 06                	mov    (%esi),%eax
+801069fa:	e8 e1 fc ff ff       	call   801066e0 <balloc>
+801069ff:	89 86 b4 00 00 00    	mov    %eax,0xb4(%esi)
+80106a05:	eb 93                	jmp    8010699a <bmap+0x2a>
+80106a07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106a0e:	66 90                	xchg   %ax,%ax
+        if ((addr = ip->addrs[bn]) == 0)
+80106a10:	8d 5a 20             	lea    0x20(%edx),%ebx
+80106a13:	8b 7c 98 04          	mov    0x4(%eax,%ebx,4),%edi
+80106a17:	85 ff                	test   %edi,%edi
+80106a19:	75 aa                	jne    801069c5 <bmap+0x55>
+            ip->addrs[bn] = addr = balloc(ip->dev);
+80106a1b:	8b 00                	mov    (%eax),%eax
+80106a1d:	e8 be fc ff ff       	call   801066e0 <balloc>
+80106a22:	89 44 9e 04          	mov    %eax,0x4(%esi,%ebx,4)
+80106a26:	89 c7                	mov    %eax,%edi
+}
+80106a28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a2b:	5b                   	pop    %ebx
+80106a2c:	89 f8                	mov    %edi,%eax
+80106a2e:	5e                   	pop    %esi
+80106a2f:	5f                   	pop    %edi
+80106a30:	5d                   	pop    %ebp
+80106a31:	c3                   	ret
+    panic("bmap: out of range");
+80106a32:	83 ec 0c             	sub    $0xc,%esp
+80106a35:	68 28 b5 10 80       	push   $0x8010b528
+80106a3a:	e8 01 33 00 00       	call   80109d40 <panic>
+80106a3f:	90                   	nop
+
+80106a40 <readsb>:
+{
+80106a40:	55                   	push   %ebp
+80106a41:	89 e5                	mov    %esp,%ebp
+80106a43:	56                   	push   %esi
+80106a44:	53                   	push   %ebx
+80106a45:	8b 75 0c             	mov    0xc(%ebp),%esi
+    bp = bread(dev, 1);
+80106a48:	83 ec 08             	sub    $0x8,%esp
+80106a4b:	6a 01                	push   $0x1
+80106a4d:	ff 75 08             	push   0x8(%ebp)
+80106a50:	e8 ab e6 ff ff       	call   80105100 <bread>
+    memmove(superblock, bp->data, sizeof(*superblock));
+80106a55:	83 c4 0c             	add    $0xc,%esp
+80106a58:	6a 1c                	push   $0x1c
+    bp = bread(dev, 1);
+80106a5a:	89 c3                	mov    %eax,%ebx
+    memmove(superblock, bp->data, sizeof(*superblock));
+80106a5c:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+80106a62:	56                   	push   %esi
+80106a63:	e8 68 96 ff ff       	call   801000d0 <memmove>
+    brelse(bp);
+80106a68:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106a6b:	83 c4 10             	add    $0x10,%esp
+}
+80106a6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106a71:	5b                   	pop    %ebx
+80106a72:	5e                   	pop    %esi
+80106a73:	5d                   	pop    %ebp
+    brelse(bp);
+80106a74:	e9 b7 e9 ff ff       	jmp    80105430 <brelse>
+80106a79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106a80 <iinit>:
+{
+80106a80:	55                   	push   %ebp
+80106a81:	89 e5                	mov    %esp,%ebp
+80106a83:	53                   	push   %ebx
+80106a84:	bb 8c da 1b 80       	mov    $0x801bda8c,%ebx
+80106a89:	83 ec 0c             	sub    $0xc,%esp
+    initlock(&icache.lock, "icache");
+80106a8c:	68 3b b5 10 80       	push   $0x8010b53b
+80106a91:	68 00 da 1b 80       	push   $0x801bda00
+80106a96:	e8 a5 a5 ff ff       	call   80101040 <initlock>
+    for (i = 0; i < NINODE; i++) {
+80106a9b:	83 c4 10             	add    $0x10,%esp
+80106a9e:	66 90                	xchg   %ax,%ax
+        initsleeplock(&icache.inode[i].lock, "inode");
+80106aa0:	83 ec 08             	sub    $0x8,%esp
+80106aa3:	68 42 b5 10 80       	push   $0x8010b542
+80106aa8:	53                   	push   %ebx
+    for (i = 0; i < NINODE; i++) {
+80106aa9:	81 c3 00 01 00 00    	add    $0x100,%ebx
+        initsleeplock(&icache.inode[i].lock, "inode");
+80106aaf:	e8 bc af ff ff       	call   80101a70 <initsleeplock>
+    for (i = 0; i < NINODE; i++) {
+80106ab4:	83 c4 10             	add    $0x10,%esp
+80106ab7:	81 fb 8c 0c 1c 80    	cmp    $0x801c0c8c,%ebx
+80106abd:	75 e1                	jne    80106aa0 <iinit+0x20>
+    bp = bread(dev, 1);
+80106abf:	83 ec 08             	sub    $0x8,%esp
+80106ac2:	6a 01                	push   $0x1
+80106ac4:	ff 75 08             	push   0x8(%ebp)
+80106ac7:	e8 34 e6 ff ff       	call   80105100 <bread>
+    memmove(superblock, bp->data, sizeof(*superblock));
+80106acc:	83 c4 0c             	add    $0xc,%esp
+80106acf:	6a 1c                	push   $0x1c
+    bp = bread(dev, 1);
+80106ad1:	89 c3                	mov    %eax,%ebx
+    memmove(superblock, bp->data, sizeof(*superblock));
+80106ad3:	ff b0 cc 00 00 00    	push   0xcc(%eax)
+80106ad9:	68 80 0c 1c 80       	push   $0x801c0c80
+80106ade:	e8 ed 95 ff ff       	call   801000d0 <memmove>
+    brelse(bp);
+80106ae3:	89 1c 24             	mov    %ebx,(%esp)
+80106ae6:	e8 45 e9 ff ff       	call   80105430 <brelse>
+    cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d inodestrt %d bmap start %d\n",
+80106aeb:	ff 35 98 0c 1c 80    	push   0x801c0c98
+80106af1:	ff 35 94 0c 1c 80    	push   0x801c0c94
+80106af7:	ff 35 90 0c 1c 80    	push   0x801c0c90
+80106afd:	ff 35 8c 0c 1c 80    	push   0x801c0c8c
+80106b03:	ff 35 88 0c 1c 80    	push   0x801c0c88
+80106b09:	ff 35 84 0c 1c 80    	push   0x801c0c84
+80106b0f:	ff 35 80 0c 1c 80    	push   0x801c0c80
+80106b15:	68 bc b5 10 80       	push   $0x8010b5bc
+80106b1a:	e8 a1 32 00 00       	call   80109dc0 <cprintf>
+}
+80106b1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106b22:	83 c4 30             	add    $0x30,%esp
+80106b25:	c9                   	leave
+80106b26:	c3                   	ret
+80106b27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b2e:	66 90                	xchg   %ax,%ax
+
+80106b30 <ialloc>:
+{
+80106b30:	55                   	push   %ebp
+80106b31:	89 e5                	mov    %esp,%ebp
+80106b33:	57                   	push   %edi
+80106b34:	56                   	push   %esi
+80106b35:	53                   	push   %ebx
+80106b36:	83 ec 1c             	sub    $0x1c,%esp
+80106b39:	8b 45 0c             	mov    0xc(%ebp),%eax
+    for (inum = 1; inum < sb.ninodes; inum++) {
+80106b3c:	83 3d 88 0c 1c 80 01 	cmpl   $0x1,0x801c0c88
+{
+80106b43:	8b 75 08             	mov    0x8(%ebp),%esi
+80106b46:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for (inum = 1; inum < sb.ninodes; inum++) {
+80106b49:	0f 86 89 00 00 00    	jbe    80106bd8 <ialloc+0xa8>
+80106b4f:	bf 01 00 00 00       	mov    $0x1,%edi
+80106b54:	eb 21                	jmp    80106b77 <ialloc+0x47>
+80106b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        brelse(bp);
+80106b60:	83 ec 0c             	sub    $0xc,%esp
+    for (inum = 1; inum < sb.ninodes; inum++) {
+80106b63:	83 c7 01             	add    $0x1,%edi
+        brelse(bp);
+80106b66:	50                   	push   %eax
+80106b67:	e8 c4 e8 ff ff       	call   80105430 <brelse>
+    for (inum = 1; inum < sb.ninodes; inum++) {
+80106b6c:	83 c4 10             	add    $0x10,%esp
+80106b6f:	3b 3d 88 0c 1c 80    	cmp    0x801c0c88,%edi
+80106b75:	73 61                	jae    80106bd8 <ialloc+0xa8>
+        bp = bread(dev, IBLOCK(inum, sb));
+80106b77:	89 f8                	mov    %edi,%eax
+80106b79:	83 ec 08             	sub    $0x8,%esp
+        dip = (struct dinode*)bp->data + inum % IPB;
+80106b7c:	89 fb                	mov    %edi,%ebx
+        bp = bread(dev, IBLOCK(inum, sb));
+80106b7e:	c1 e8 03             	shr    $0x3,%eax
+80106b81:	03 05 94 0c 1c 80    	add    0x801c0c94,%eax
+        dip = (struct dinode*)bp->data + inum % IPB;
+80106b87:	83 e3 07             	and    $0x7,%ebx
+        bp = bread(dev, IBLOCK(inum, sb));
+80106b8a:	50                   	push   %eax
+        dip = (struct dinode*)bp->data + inum % IPB;
+80106b8b:	c1 e3 06             	shl    $0x6,%ebx
+        bp = bread(dev, IBLOCK(inum, sb));
+80106b8e:	56                   	push   %esi
+80106b8f:	e8 6c e5 ff ff       	call   80105100 <bread>
+        if (dip->type == 0) {   // a free inode
+80106b94:	83 c4 10             	add    $0x10,%esp
+        dip = (struct dinode*)bp->data + inum % IPB;
+80106b97:	03 98 cc 00 00 00    	add    0xcc(%eax),%ebx
+        if (dip->type == 0) {   // a free inode
+80106b9d:	66 83 3b 00          	cmpw   $0x0,(%ebx)
+80106ba1:	75 bd                	jne    80106b60 <ialloc+0x30>
+            memset(dip, 0, sizeof(*dip));
+80106ba3:	83 ec 04             	sub    $0x4,%esp
+80106ba6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106ba9:	6a 40                	push   $0x40
+80106bab:	6a 00                	push   $0x0
+80106bad:	53                   	push   %ebx
+80106bae:	e8 8d 94 ff ff       	call   80100040 <memset>
+            dip->type = type;
+80106bb3:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+            log_write(bp);  // mark it allocated on disk
+80106bb7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+            dip->type = type;
+80106bba:	66 89 03             	mov    %ax,(%ebx)
+            log_write(bp);  // mark it allocated on disk
+80106bbd:	89 14 24             	mov    %edx,(%esp)
+80106bc0:	e8 1b f5 ff ff       	call   801060e0 <log_write>
+            return iget(dev, inum);
+80106bc5:	83 c4 10             	add    $0x10,%esp
+}
+80106bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+            return iget(dev, inum);
+80106bcb:	89 fa                	mov    %edi,%edx
+}
+80106bcd:	5b                   	pop    %ebx
+            return iget(dev, inum);
+80106bce:	89 f0                	mov    %esi,%eax
+}
+80106bd0:	5e                   	pop    %esi
+80106bd1:	5f                   	pop    %edi
+80106bd2:	5d                   	pop    %ebp
+            return iget(dev, inum);
+80106bd3:	e9 28 fc ff ff       	jmp    80106800 <iget>
+    panic("ialloc: no inodes");
+80106bd8:	83 ec 0c             	sub    $0xc,%esp
+80106bdb:	68 48 b5 10 80       	push   $0x8010b548
+80106be0:	e8 5b 31 00 00       	call   80109d40 <panic>
+80106be5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106bf0 <iupdate>:
+{
+80106bf0:	55                   	push   %ebp
+80106bf1:	89 e5                	mov    %esp,%ebp
+80106bf3:	56                   	push   %esi
+80106bf4:	53                   	push   %ebx
+80106bf5:	8b 75 08             	mov    0x8(%ebp),%esi
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80106bf8:	8b 46 04             	mov    0x4(%esi),%eax
+80106bfb:	83 ec 08             	sub    $0x8,%esp
+80106bfe:	c1 e8 03             	shr    $0x3,%eax
+80106c01:	03 05 94 0c 1c 80    	add    0x801c0c94,%eax
+80106c07:	50                   	push   %eax
+80106c08:	ff 36                	push   (%esi)
+80106c0a:	e8 f1 e4 ff ff       	call   80105100 <bread>
+    dip->type = ip->type;
+80106c0f:	0f b7 56 78          	movzwl 0x78(%esi),%edx
+    memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80106c13:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80106c16:	89 c3                	mov    %eax,%ebx
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+80106c18:	8b 46 04             	mov    0x4(%esi),%eax
+80106c1b:	83 e0 07             	and    $0x7,%eax
+80106c1e:	c1 e0 06             	shl    $0x6,%eax
+80106c21:	03 83 cc 00 00 00    	add    0xcc(%ebx),%eax
+    dip->type = ip->type;
+80106c27:	66 89 10             	mov    %dx,(%eax)
+    dip->major = ip->major;
+80106c2a:	0f b7 56 7a          	movzwl 0x7a(%esi),%edx
+    memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80106c2e:	83 c0 0c             	add    $0xc,%eax
+    dip->major = ip->major;
+80106c31:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+    dip->minor = ip->minor;
+80106c35:	0f b7 56 7c          	movzwl 0x7c(%esi),%edx
+80106c39:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+    dip->nlink = ip->nlink;
+80106c3d:	0f b7 56 7e          	movzwl 0x7e(%esi),%edx
+80106c41:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+    dip->size = ip->size;
+80106c45:	8b 96 80 00 00 00    	mov    0x80(%esi),%edx
+80106c4b:	89 50 fc             	mov    %edx,-0x4(%eax)
+    memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80106c4e:	8d 96 84 00 00 00    	lea    0x84(%esi),%edx
+80106c54:	6a 34                	push   $0x34
+80106c56:	52                   	push   %edx
+80106c57:	50                   	push   %eax
+80106c58:	e8 73 94 ff ff       	call   801000d0 <memmove>
+    log_write(bp);
+80106c5d:	89 1c 24             	mov    %ebx,(%esp)
+80106c60:	e8 7b f4 ff ff       	call   801060e0 <log_write>
+    brelse(bp);
+80106c65:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106c68:	83 c4 10             	add    $0x10,%esp
+}
+80106c6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106c6e:	5b                   	pop    %ebx
+80106c6f:	5e                   	pop    %esi
+80106c70:	5d                   	pop    %ebp
+    brelse(bp);
+80106c71:	e9 ba e7 ff ff       	jmp    80105430 <brelse>
+80106c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106c7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106c80 <idup>:
+{
+80106c80:	55                   	push   %ebp
+80106c81:	89 e5                	mov    %esp,%ebp
+80106c83:	8b 45 08             	mov    0x8(%ebp),%eax
+    __sync_fetch_and_add(&ip->ref, 1);
+80106c86:	f0 83 40 08 01       	lock addl $0x1,0x8(%eax)
+}
+80106c8b:	5d                   	pop    %ebp
+80106c8c:	c3                   	ret
+80106c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106c90 <ilock>:
+{
+80106c90:	55                   	push   %ebp
+80106c91:	89 e5                	mov    %esp,%ebp
+80106c93:	56                   	push   %esi
+80106c94:	53                   	push   %ebx
+80106c95:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (ip == 0 || ip->ref < 1)
+80106c98:	85 db                	test   %ebx,%ebx
+80106c9a:	0f 84 d3 00 00 00    	je     80106d73 <ilock+0xe3>
+80106ca0:	8b 53 08             	mov    0x8(%ebx),%edx
+80106ca3:	85 d2                	test   %edx,%edx
+80106ca5:	0f 8e c8 00 00 00    	jle    80106d73 <ilock+0xe3>
+    acquiresleep(&ip->lock);
+80106cab:	83 ec 0c             	sub    $0xc,%esp
+80106cae:	8d 43 0c             	lea    0xc(%ebx),%eax
+80106cb1:	50                   	push   %eax
+80106cb2:	e8 09 ae ff ff       	call   80101ac0 <acquiresleep>
+    if (ip->valid == 0) {
+80106cb7:	8b 43 74             	mov    0x74(%ebx),%eax
+80106cba:	83 c4 10             	add    $0x10,%esp
+80106cbd:	85 c0                	test   %eax,%eax
+80106cbf:	74 0f                	je     80106cd0 <ilock+0x40>
+}
+80106cc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106cc4:	5b                   	pop    %ebx
+80106cc5:	5e                   	pop    %esi
+80106cc6:	5d                   	pop    %ebp
+80106cc7:	c3                   	ret
+80106cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106ccf:	90                   	nop
+        bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80106cd0:	8b 43 04             	mov    0x4(%ebx),%eax
+80106cd3:	83 ec 08             	sub    $0x8,%esp
+80106cd6:	c1 e8 03             	shr    $0x3,%eax
+80106cd9:	03 05 94 0c 1c 80    	add    0x801c0c94,%eax
+80106cdf:	50                   	push   %eax
+80106ce0:	ff 33                	push   (%ebx)
+80106ce2:	e8 19 e4 ff ff       	call   80105100 <bread>
+        memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80106ce7:	83 c4 0c             	add    $0xc,%esp
+        bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80106cea:	89 c6                	mov    %eax,%esi
+        dip = (struct dinode*)bp->data + ip->inum%IPB;
+80106cec:	8b 43 04             	mov    0x4(%ebx),%eax
+80106cef:	83 e0 07             	and    $0x7,%eax
+80106cf2:	c1 e0 06             	shl    $0x6,%eax
+80106cf5:	03 86 cc 00 00 00    	add    0xcc(%esi),%eax
+        ip->type = dip->type;
+80106cfb:	0f b7 10             	movzwl (%eax),%edx
+        memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80106cfe:	83 c0 0c             	add    $0xc,%eax
+        ip->type = dip->type;
+80106d01:	66 89 53 78          	mov    %dx,0x78(%ebx)
+        ip->major = dip->major;
+80106d05:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+80106d09:	66 89 53 7a          	mov    %dx,0x7a(%ebx)
+        ip->minor = dip->minor;
+80106d0d:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+80106d11:	66 89 53 7c          	mov    %dx,0x7c(%ebx)
+        ip->nlink = dip->nlink;
+80106d15:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+80106d19:	66 89 53 7e          	mov    %dx,0x7e(%ebx)
+        ip->size = dip->size;
+80106d1d:	8b 50 fc             	mov    -0x4(%eax),%edx
+        ip->ranext = 0;
+80106d20:	c7 83 b8 00 00 00 00 	movl   $0x0,0xb8(%ebx)
+80106d27:	00 00 00 
+        ip->size = dip->size;
+80106d2a:	89 93 80 00 00 00    	mov    %edx,0x80(%ebx)
+        ip->rawin = 0;
+80106d30:	c7 83 c0 00 00 00 00 	movl   $0x0,0xc0(%ebx)
+80106d37:	00 00 00 
+        memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+80106d3a:	6a 34                	push   $0x34
+80106d3c:	50                   	push   %eax
+80106d3d:	8d 83 84 00 00 00    	lea    0x84(%ebx),%eax
+80106d43:	50                   	push   %eax
+80106d44:	e8 87 93 ff ff       	call   801000d0 <memmove>
+        brelse(bp);
+80106d49:	89 34 24             	mov    %esi,(%esp)
+80106d4c:	e8 df e6 ff ff       	call   80105430 <brelse>
+        if (ip->type == 0)
+80106d51:	83 c4 10             	add    $0x10,%esp
+80106d54:	66 83 7b 78 00       	cmpw   $0x0,0x78(%ebx)
+        ip->valid = 1;
+80106d59:	c7 43 74 01 00 00 00 	movl   $0x1,0x74(%ebx)
+        if (ip->type == 0)
+80106d60:	0f 85 5b ff ff ff    	jne    80106cc1 <ilock+0x31>
+            panic("ilock: no type");
+80106d66:	83 ec 0c             	sub    $0xc,%esp
+80106d69:	68 69 b5 10 80       	push   $0x8010b569
+80106d6e:	e8 cd 2f 00 00       	call   80109d40 <panic>
+        panic("ilock: ref < 1");
+80106d73:	83 ec 0c             	sub    $0xc,%esp
+80106d76:	68 5a b5 10 80       	push   $0x8010b55a
+80106d7b:	e8 c0 2f 00 00       	call   80109d40 <panic>
+
+80106d80 <iunlock>:
+{
+80106d80:	55                   	push   %ebp
+80106d81:	89 e5                	mov    %esp,%ebp
+80106d83:	56                   	push   %esi
+80106d84:	53                   	push   %ebx
+80106d85:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+80106d88:	85 db                	test   %ebx,%ebx
+80106d8a:	74 28                	je     80106db4 <iunlock+0x34>
+80106d8c:	83 ec 0c             	sub    $0xc,%esp
+80106d8f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80106d92:	56                   	push   %esi
+80106d93:	e8 b8 ae ff ff       	call   80101c50 <holdingsleep>
+80106d98:	83 c4 10             	add    $0x10,%esp
+80106d9b:	85 c0                	test   %eax,%eax
+80106d9d:	74 15                	je     80106db4 <iunlock+0x34>
+80106d9f:	8b 43 08             	mov    0x8(%ebx),%eax
+80106da2:	85 c0                	test   %eax,%eax
+80106da4:	7e 0e                	jle    80106db4 <iunlock+0x34>
+    releasesleep(&ip->lock);
+80106da6:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80106da9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106dac:	5b                   	pop    %ebx
+80106dad:	5e                   	pop    %esi
+80106dae:	5d                   	pop    %ebp
+    releasesleep(&ip->lock);
+80106daf:	e9 0c ae ff ff       	jmp    80101bc0 <releasesleep>
+        panic("iunlock");
+80106db4:	83 ec 0c             	sub    $0xc,%esp
+80106db7:	68 78 b5 10 80       	push   $0x8010b578
+80106dbc:	e8 7f 2f 00 00       	call   80109d40 <panic>
+80106dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dcf:	90                   	nop
+
+80106dd0 <iput>:
+{
+80106dd0:	55                   	push   %ebp
+80106dd1:	89 e5                	mov    %esp,%ebp
+80106dd3:	57                   	push   %edi
+80106dd4:	56                   	push   %esi
+80106dd5:	53                   	push   %ebx
+80106dd6:	83 ec 28             	sub    $0x28,%esp
+80106dd9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    acquiresleep(&ip->lock);
+80106ddc:	8d 7b 0c             	lea    0xc(%ebx),%edi
+80106ddf:	57                   	push   %edi
+80106de0:	e8 db ac ff ff       	call   80101ac0 <acquiresleep>
+    if (ip->valid && ip->nlink == 0) {
+80106de5:	8b 53 74             	mov    0x74(%ebx),%edx
+80106de8:	83 c4 10             	add    $0x10,%esp
+80106deb:	85 d2                	test   %edx,%edx
+80106ded:	74 07                	je     80106df6 <iput+0x26>
+80106def:	66 83 7b 7e 00       	cmpw   $0x0,0x7e(%ebx)
+80106df4:	74 12                	je     80106e08 <iput+0x38>
+    releasesleep(&ip->lock);
+80106df6:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+80106df9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106dfc:	5b                   	pop    %ebx
+80106dfd:	5e                   	pop    %esi
+80106dfe:	5f                   	pop    %edi
+80106dff:	5d                   	pop    %ebp
+    releasesleep(&ip->lock);
+80106e00:	e9 bb ad ff ff       	jmp    80101bc0 <releasesleep>
+80106e05:	8d 76 00             	lea    0x0(%esi),%esi
+        acquire(&icache.lock);
+80106e08:	83 ec 0c             	sub    $0xc,%esp
+80106e0b:	68 00 da 1b 80       	push   $0x801bda00
+80106e10:	e8 9b a6 ff ff       	call   801014b0 <acquire>
+        int r = ip->ref;
+80106e15:	8b 73 08             	mov    0x8(%ebx),%esi
+        release(&icache.lock);
+80106e18:	c7 04 24 00 da 1b 80 	movl   $0x801bda00,(%esp)
+80106e1f:	e8 ac a4 ff ff       	call   801012d0 <release>
+        if (r == 1) {
+80106e24:	83 c4 10             	add    $0x10,%esp
+80106e27:	83 fe 01             	cmp    $0x1,%esi
+80106e2a:	75 ca                	jne    80106df6 <iput+0x26>
+80106e2c:	8d 8b b4 00 00 00    	lea    0xb4(%ebx),%ecx
+80106e32:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106e35:	8d b3 84 00 00 00    	lea    0x84(%ebx),%esi
+80106e3b:	89 df                	mov    %ebx,%edi
+80106e3d:	89 cb                	mov    %ecx,%ebx
+80106e3f:	eb 0e                	jmp    80106e4f <iput+0x7f>
+80106e41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+{
+    int i, j;
+    struct buf *bp;
+    uint *a;
+
+    for (i = 0; i < NDIRECT; i++) {
+80106e48:	83 c6 04             	add    $0x4,%esi
+80106e4b:	39 de                	cmp    %ebx,%esi
+80106e4d:	74 19                	je     80106e68 <iput+0x98>
+        if (ip->addrs[i]) {
+80106e4f:	8b 16                	mov    (%esi),%edx
+80106e51:	85 d2                	test   %edx,%edx
+80106e53:	74 f3                	je     80106e48 <iput+0x78>
+            bfree(ip->dev, ip->addrs[i]);
+80106e55:	8b 07                	mov    (%edi),%eax
+80106e57:	e8 04 f8 ff ff       	call   80106660 <bfree>
+            ip->addrs[i] = 0;
+80106e5c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80106e62:	eb e4                	jmp    80106e48 <iput+0x78>
+80106e64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        }
+    }
+
+    if (ip->addrs[NDIRECT]) {
+80106e68:	89 fb                	mov    %edi,%ebx
+80106e6a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106e6d:	8b 83 b4 00 00 00    	mov    0xb4(%ebx),%eax
+80106e73:	85 c0                	test   %eax,%eax
+80106e75:	75 30                	jne    80106ea7 <iput+0xd7>
+        brelse(bp);
+        bfree(ip->dev, ip->addrs[NDIRECT]);
+        ip->addrs[NDIRECT] = 0;
+    }
+
+    ip->size = 0;
+80106e77:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+80106e7e:	00 00 00 
+    iupdate(ip);
+80106e81:	83 ec 0c             	sub    $0xc,%esp
+80106e84:	53                   	push   %ebx
+80106e85:	e8 66 fd ff ff       	call   80106bf0 <iupdate>
+            ip->type = 0;
+80106e8a:	31 c0                	xor    %eax,%eax
+80106e8c:	66 89 43 78          	mov    %ax,0x78(%ebx)
+            iupdate(ip);
+80106e90:	89 1c 24             	mov    %ebx,(%esp)
+80106e93:	e8 58 fd ff ff       	call   80106bf0 <iupdate>
+            ip->valid = 0;
+80106e98:	c7 43 74 00 00 00 00 	movl   $0x0,0x74(%ebx)
+80106e9f:	83 c4 10             	add    $0x10,%esp
+80106ea2:	e9 4f ff ff ff       	jmp    80106df6 <iput+0x26>
+        bp = bread(ip->dev, ip->addrs[NDIRECT]);
+80106ea7:	83 ec 08             	sub    $0x8,%esp
+80106eaa:	50                   	push   %eax
+80106eab:	ff 33                	push   (%ebx)
+80106ead:	e8 4e e2 ff ff       	call   80105100 <bread>
+        for (j = 0; j < NINDIRECT; j++) {
+80106eb2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106eb5:	83 c4 10             	add    $0x10,%esp
+80106eb8:	8b b0 cc 00 00 00    	mov    0xcc(%eax),%esi
+80106ebe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106ec1:	8d 8e 00 02 00 00    	lea    0x200(%esi),%ecx
+80106ec7:	89 cf                	mov    %ecx,%edi
+80106ec9:	eb 0c                	jmp    80106ed7 <iput+0x107>
+80106ecb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ecf:	90                   	nop
+80106ed0:	83 c6 04             	add    $0x4,%esi
+80106ed3:	39 fe                	cmp    %edi,%esi
+80106ed5:	74 0f                	je     80106ee6 <iput+0x116>
+            if (a[j])
+80106ed7:	8b 16                	mov    (%esi),%edx
+80106ed9:	85 d2                	test   %edx,%edx
+80106edb:	74 f3                	je     80106ed0 <iput+0x100>
+                bfree(ip->dev, a[j]);
+80106edd:	8b 03                	mov    (%ebx),%eax
+80106edf:	e8 7c f7 ff ff       	call   80106660 <bfree>
+80106ee4:	eb ea                	jmp    80106ed0 <iput+0x100>
+        brelse(bp);
+80106ee6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106ee9:	83 ec 0c             	sub    $0xc,%esp
+80106eec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106eef:	50                   	push   %eax
+80106ef0:	e8 3b e5 ff ff       	call   80105430 <brelse>
+        bfree(ip->dev, ip->addrs[NDIRECT]);
+80106ef5:	8b 93 b4 00 00 00    	mov    0xb4(%ebx),%edx
+80106efb:	8b 03                	mov    (%ebx),%eax
+80106efd:	e8 5e f7 ff ff       	call   80106660 <bfree>
+        ip->addrs[NDIRECT] = 0;
+80106f02:	83 c4 10             	add    $0x10,%esp
+80106f05:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80106f0c:	00 00 00 
+80106f0f:	e9 63 ff ff ff       	jmp    80106e77 <iput+0xa7>
+80106f14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106f1f:	90                   	nop
+
+80106f20 <iunlockput>:
+{
+80106f20:	55                   	push   %ebp
+80106f21:	89 e5                	mov    %esp,%ebp
+80106f23:	56                   	push   %esi
+80106f24:	53                   	push   %ebx
+80106f25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+80106f28:	85 db                	test   %ebx,%ebx
+80106f2a:	74 34                	je     80106f60 <iunlockput+0x40>
+80106f2c:	83 ec 0c             	sub    $0xc,%esp
+80106f2f:	8d 73 0c             	lea    0xc(%ebx),%esi
+80106f32:	56                   	push   %esi
+80106f33:	e8 18 ad ff ff       	call   80101c50 <holdingsleep>
+80106f38:	83 c4 10             	add    $0x10,%esp
+80106f3b:	85 c0                	test   %eax,%eax
+80106f3d:	74 21                	je     80106f60 <iunlockput+0x40>
+80106f3f:	8b 43 08             	mov    0x8(%ebx),%eax
+80106f42:	85 c0                	test   %eax,%eax
+80106f44:	7e 1a                	jle    80106f60 <iunlockput+0x40>
+    releasesleep(&ip->lock);
+80106f46:	83 ec 0c             	sub    $0xc,%esp
+80106f49:	56                   	push   %esi
+80106f4a:	e8 71 ac ff ff       	call   80101bc0 <releasesleep>
+    iput(ip);
+80106f4f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80106f52:	83 c4 10             	add    $0x10,%esp
+}
+80106f55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106f58:	5b                   	pop    %ebx
+80106f59:	5e                   	pop    %esi
+80106f5a:	5d                   	pop    %ebp
+    iput(ip);
+80106f5b:	e9 70 fe ff ff       	jmp    80106dd0 <iput>
+        panic("iunlock");
+80106f60:	83 ec 0c             	sub    $0xc,%esp
+80106f63:	68 78 b5 10 80       	push   $0x8010b578
+80106f68:	e8 d3 2d 00 00       	call   80109d40 <panic>
+80106f6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106f70 <readi>:
+
+// read data from inode
+// caller mst hold ip->lock
+int
+readi(struct inode *ip, char *dst, uint off, uint n)
+{
+80106f70:	55                   	push   %ebp
+80106f71:	89 e5                	mov    %esp,%ebp
+80106f73:	57                   	push   %edi
+80106f74:	56                   	push   %esi
+80106f75:	53                   	push   %ebx
+80106f76:	83 ec 2c             	sub    $0x2c,%esp
+80106f79:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106f7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80106f7f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80106f82:	8b 45 10             	mov    0x10(%ebp),%eax
+    uint tot, m;
+    struct buf *bp;
+
+    if (ip->type == T_DEV) {
+80106f85:	66 83 7b 78 03       	cmpw   $0x3,0x78(%ebx)
+{
+80106f8a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80106f8d:	8b 45 14             	mov    0x14(%ebp),%eax
+80106f90:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if (ip->type == T_DEV) {
+80106f93:	0f 84 e3 02 00 00    	je     8010727c <readi+0x30c>
+        if (ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+            return -1;
+        return devsw[ip->major].read(ip, dst, n);
+    }
+
+    if (off > ip->size || off + n < off)
+80106f99:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+80106f9f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80106fa2:	39 f8                	cmp    %edi,%eax
+80106fa4:	0f 82 05 03 00 00    	jb     801072af <readi+0x33f>
+80106faa:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80106fad:	89 f9                	mov    %edi,%ecx
+80106faf:	31 d2                	xor    %edx,%edx
+80106fb1:	01 f1                	add    %esi,%ecx
+80106fb3:	0f 92 c2             	setb   %dl
+80106fb6:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80106fb9:	0f 82 f0 02 00 00    	jb     801072af <readi+0x33f>
+        return -1;
+    if (off + n > ip->size)
+        n = ip->size - off;
+80106fbf:	89 c2                	mov    %eax,%edx
+80106fc1:	29 fa                	sub    %edi,%edx
+80106fc3:	39 c8                	cmp    %ecx,%eax
+80106fc5:	89 df                	mov    %ebx,%edi
+80106fc7:	0f 43 d6             	cmovae %esi,%edx
+80106fca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+
+    for (tot = 0; tot < n; tot += m, off += m, dst += m) {
+80106fcd:	85 d2                	test   %edx,%edx
+80106fcf:	75 23                	jne    80106ff4 <readi+0x84>
+80106fd1:	e9 ca 00 00 00       	jmp    801070a0 <readi+0x130>
+80106fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106fdd:	8d 76 00             	lea    0x0(%esi),%esi
+80106fe0:	01 5d d4             	add    %ebx,-0x2c(%ebp)
+80106fe3:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80106fe6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80106fe9:	01 5d cc             	add    %ebx,-0x34(%ebp)
+80106fec:	39 c8                	cmp    %ecx,%eax
+80106fee:	0f 83 ac 00 00 00    	jae    801070a0 <readi+0x130>
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80106ff4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80106ff7:	89 f8                	mov    %edi,%eax
+80106ff9:	89 de                	mov    %ebx,%esi
+80106ffb:	c1 ee 09             	shr    $0x9,%esi
+80106ffe:	89 f2                	mov    %esi,%edx
+80107000:	89 75 dc             	mov    %esi,-0x24(%ebp)
+80107003:	e8 68 f9 ff ff       	call   80106970 <bmap>
+80107008:	83 ec 08             	sub    $0x8,%esp
+8010700b:	50                   	push   %eax
+8010700c:	ff 37                	push   (%edi)
+8010700e:	e8 ed e0 ff ff       	call   80105100 <bread>
+        m = min(n - tot, BSIZE - off%BSIZE);
+80107013:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80107016:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+80107019:	ba 00 02 00 00       	mov    $0x200,%edx
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+8010701e:	89 c1                	mov    %eax,%ecx
+        m = min(n - tot, BSIZE - off%BSIZE);
+80107020:	89 d8                	mov    %ebx,%eax
+80107022:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+80107025:	25 ff 01 00 00       	and    $0x1ff,%eax
+8010702a:	29 c2                	sub    %eax,%edx
+8010702c:	29 f3                	sub    %esi,%ebx
+8010702e:	39 da                	cmp    %ebx,%edx
+80107030:	0f 46 da             	cmovbe %edx,%ebx
+        memmove(dst, bp->data + off%BSIZE, m);
+80107033:	83 c4 0c             	add    $0xc,%esp
+80107036:	53                   	push   %ebx
+80107037:	03 81 cc 00 00 00    	add    0xcc(%ecx),%eax
+8010703d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80107040:	50                   	push   %eax
+80107041:	ff 75 cc             	push   -0x34(%ebp)
+80107044:	e8 87 90 ff ff       	call   801000d0 <memmove>
+        brelse(bp);
+80107049:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010704c:	89 0c 24             	mov    %ecx,(%esp)
+8010704f:	e8 dc e3 ff ff       	call   80105430 <brelse>
+        // a block is done with once read to its end
+        if ((off + m) % BSIZE == 0)
+80107054:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80107057:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010705a:	83 c4 10             	add    $0x10,%esp
+8010705d:	a9 ff 01 00 00       	test   $0x1ff,%eax
+80107062:	0f 85 78 ff ff ff    	jne    80106fe0 <readi+0x70>
+        ip->ranext = bn + 1;
+80107068:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+8010706b:	8d 41 01             	lea    0x1(%ecx),%eax
+    if (bn != ip->ranext) {
+8010706e:	3b 8f b8 00 00 00    	cmp    0xb8(%edi),%ecx
+80107074:	74 3a                	je     801070b0 <readi+0x140>
+    for (tot = 0; tot < n; tot += m, off += m, dst += m) {
+80107076:	01 5d d4             	add    %ebx,-0x2c(%ebp)
+80107079:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+        ip->ranext = bn + 1;
+8010707c:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    for (tot = 0; tot < n; tot += m, off += m, dst += m) {
+80107082:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80107085:	01 5d cc             	add    %ebx,-0x34(%ebp)
+        ip->rawin = 0;
+80107088:	c7 87 c0 00 00 00 00 	movl   $0x0,0xc0(%edi)
+8010708f:	00 00 00 
+    for (tot = 0; tot < n; tot += m, off += m, dst += m) {
+80107092:	39 c8                	cmp    %ecx,%eax
+80107094:	0f 82 5a ff ff ff    	jb     80106ff4 <readi+0x84>
+8010709a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            readahead(ip, off/BSIZE);
+    }
+    return n;
+801070a0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+}
+801070a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801070a6:	5b                   	pop    %ebx
+801070a7:	5e                   	pop    %esi
+801070a8:	5f                   	pop    %edi
+801070a9:	5d                   	pop    %ebp
+801070aa:	c3                   	ret
+801070ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801070af:	90                   	nop
+    if (ip->rawin == 0) {
+801070b0:	8b 97 c0 00 00 00    	mov    0xc0(%edi),%edx
+    ip->ranext = bn + 1;
+801070b6:	89 87 b8 00 00 00    	mov    %eax,0xb8(%edi)
+    if (ip->rawin == 0) {
+801070bc:	85 d2                	test   %edx,%edx
+801070be:	0f 85 66 01 00 00    	jne    8010722a <readi+0x2ba>
+        ip->rawin = RAMIN;
+801070c4:	c7 87 c0 00 00 00 04 	movl   $0x4,0xc0(%edi)
+801070cb:	00 00 00 
+        ip->raend = bn + 1;
+801070ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+801070d3:	89 87 bc 00 00 00    	mov    %eax,0xbc(%edi)
+    end = (ip->size + BSIZE - 1) / BSIZE;
+801070d9:	8b 97 80 00 00 00    	mov    0x80(%edi),%edx
+    if (bn + 1 + ip->rawin < end)
+801070df:	8b 75 dc             	mov    -0x24(%ebp),%esi
+    end = (ip->size + BSIZE - 1) / BSIZE;
+801070e2:	81 c2 ff 01 00 00    	add    $0x1ff,%edx
+    if (bn + 1 + ip->rawin < end)
+801070e8:	01 f1                	add    %esi,%ecx
+    end = (ip->size + BSIZE - 1) / BSIZE;
+801070ea:	c1 ea 09             	shr    $0x9,%edx
+801070ed:	39 ca                	cmp    %ecx,%edx
+801070ef:	0f 46 ca             	cmovbe %edx,%ecx
+    for (; ip->raend < end; ip->raend += n) {
+801070f2:	39 c8                	cmp    %ecx,%eax
+801070f4:	0f 83 e6 fe ff ff    	jae    80106fe0 <readi+0x70>
+801070fa:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+801070fd:	89 c6                	mov    %eax,%esi
+801070ff:	89 fa                	mov    %edi,%edx
+80107101:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80107104:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if (bn < NDIRECT)
+80107108:	83 fe 0b             	cmp    $0xb,%esi
+8010710b:	0f 86 5f 01 00 00    	jbe    80107270 <readi+0x300>
+    bn -= NDIRECT;
+80107111:	83 ee 0c             	sub    $0xc,%esi
+    if (bn >= NINDIRECT || (addr = ip->addrs[NDIRECT]) == 0)
+80107114:	83 fe 7f             	cmp    $0x7f,%esi
+80107117:	0f 87 43 01 00 00    	ja     80107260 <readi+0x2f0>
+8010711d:	8b 82 b4 00 00 00    	mov    0xb4(%edx),%eax
+80107123:	85 c0                	test   %eax,%eax
+80107125:	0f 84 35 01 00 00    	je     80107260 <readi+0x2f0>
+    bp = bread(ip->dev, addr);
+8010712b:	83 ec 08             	sub    $0x8,%esp
+8010712e:	50                   	push   %eax
+8010712f:	ff 32                	push   (%edx)
+80107131:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80107134:	e8 c7 df ff ff       	call   80105100 <bread>
+    addr = ((uint*)bp->data)[bn];
+80107139:	8b 88 cc 00 00 00    	mov    0xcc(%eax),%ecx
+8010713f:	8b 0c b1             	mov    (%ecx,%esi,4),%ecx
+80107142:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+    brelse(bp);
+80107145:	89 04 24             	mov    %eax,(%esp)
+80107148:	e8 e3 e2 ff ff       	call   80105430 <brelse>
+    return addr;
+8010714d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80107150:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80107153:	83 c4 10             	add    $0x10,%esp
+        for (n = 1; addr && ip->raend + n < end; n++)
+80107156:	8b 82 bc 00 00 00    	mov    0xbc(%edx),%eax
+8010715c:	8d 58 01             	lea    0x1(%eax),%ebx
+8010715f:	85 c9                	test   %ecx,%ecx
+80107161:	0f 84 ff 00 00 00    	je     80107266 <readi+0x2f6>
+80107167:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010716a:	39 c3                	cmp    %eax,%ebx
+8010716c:	0f 83 2e 01 00 00    	jae    801072a0 <readi+0x330>
+80107172:	be 01 00 00 00       	mov    $0x1,%esi
+80107177:	eb 5f                	jmp    801071d8 <readi+0x268>
+80107179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bn -= NDIRECT;
+80107180:	83 eb 0c             	sub    $0xc,%ebx
+        return 0;
+80107183:	31 ff                	xor    %edi,%edi
+    if (bn >= NINDIRECT || (addr = ip->addrs[NDIRECT]) == 0)
+80107185:	83 fb 7f             	cmp    $0x7f,%ebx
+80107188:	77 35                	ja     801071bf <readi+0x24f>
+8010718a:	8b ba b4 00 00 00    	mov    0xb4(%edx),%edi
+80107190:	85 ff                	test   %edi,%edi
+80107192:	74 2b                	je     801071bf <readi+0x24f>
+    bp = bread(ip->dev, addr);
+80107194:	83 ec 08             	sub    $0x8,%esp
+80107197:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+8010719a:	57                   	push   %edi
+8010719b:	ff 32                	push   (%edx)
+8010719d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801071a0:	e8 5b df ff ff       	call   80105100 <bread>
+    addr = ((uint*)bp->data)[bn];
+801071a5:	8b b8 cc 00 00 00    	mov    0xcc(%eax),%edi
+801071ab:	8b 3c 9f             	mov    (%edi,%ebx,4),%edi
+    brelse(bp);
+801071ae:	89 04 24             	mov    %eax,(%esp)
+801071b1:	e8 7a e2 ff ff       	call   80105430 <brelse>
+    return addr;
+801071b6:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801071b9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801071bc:	83 c4 10             	add    $0x10,%esp
+            if (bmapnoalloc(ip, ip->raend + n) != addr + n)
+801071bf:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+801071c2:	39 c7                	cmp    %eax,%edi
+801071c4:	75 2a                	jne    801071f0 <readi+0x280>
+        for (n = 1; addr && ip->raend + n < end; n++)
+801071c6:	8b 9a bc 00 00 00    	mov    0xbc(%edx),%ebx
+801071cc:	83 c6 01             	add    $0x1,%esi
+801071cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801071d2:	01 f3                	add    %esi,%ebx
+801071d4:	39 c3                	cmp    %eax,%ebx
+801071d6:	73 18                	jae    801071f0 <readi+0x280>
+    if (bn < NDIRECT)
+801071d8:	83 fb 0b             	cmp    $0xb,%ebx
+801071db:	77 a3                	ja     80107180 <readi+0x210>
+        return ip->addrs[bn];
+801071dd:	8b bc 9a 84 00 00 00 	mov    0x84(%edx,%ebx,4),%edi
+            if (bmapnoalloc(ip, ip->raend + n) != addr + n)
+801071e4:	8d 04 31             	lea    (%ecx,%esi,1),%eax
+801071e7:	39 c7                	cmp    %eax,%edi
+801071e9:	74 db                	je     801071c6 <readi+0x256>
+801071eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801071ef:	90                   	nop
+            breadahead(ip->dev, addr, n);
+801071f0:	89 f0                	mov    %esi,%eax
+801071f2:	83 ec 04             	sub    $0x4,%esp
+801071f5:	50                   	push   %eax
+801071f6:	51                   	push   %ecx
+801071f7:	ff 32                	push   (%edx)
+801071f9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+801071fc:	e8 0f e4 ff ff       	call   80105610 <breadahead>
+80107201:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80107204:	83 c4 10             	add    $0x10,%esp
+80107207:	8b 82 bc 00 00 00    	mov    0xbc(%edx),%eax
+    for (; ip->raend < end; ip->raend += n) {
+8010720d:	01 c6                	add    %eax,%esi
+8010720f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107212:	89 b2 bc 00 00 00    	mov    %esi,0xbc(%edx)
+80107218:	39 c6                	cmp    %eax,%esi
+8010721a:	0f 82 e8 fe ff ff    	jb     80107108 <readi+0x198>
+80107220:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+80107223:	89 d7                	mov    %edx,%edi
+80107225:	e9 b6 fd ff ff       	jmp    80106fe0 <readi+0x70>
+    } else if (ip->raend > bn + ip->rawin / 2) {
+8010722a:	8b 75 dc             	mov    -0x24(%ebp),%esi
+8010722d:	89 d1                	mov    %edx,%ecx
+8010722f:	8b 87 bc 00 00 00    	mov    0xbc(%edi),%eax
+80107235:	d1 e9                	shr    %ecx
+80107237:	01 f1                	add    %esi,%ecx
+80107239:	39 c1                	cmp    %eax,%ecx
+8010723b:	0f 82 9f fd ff ff    	jb     80106fe0 <readi+0x70>
+    } else if (ip->rawin < RAMAX) {
+80107241:	83 fa 3f             	cmp    $0x3f,%edx
+80107244:	77 08                	ja     8010724e <readi+0x2de>
+        ip->rawin *= 2;
+80107246:	01 d2                	add    %edx,%edx
+80107248:	89 97 c0 00 00 00    	mov    %edx,0xc0(%edi)
+8010724e:	8d 4a 01             	lea    0x1(%edx),%ecx
+80107251:	e9 83 fe ff ff       	jmp    801070d9 <readi+0x169>
+80107256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010725d:	8d 76 00             	lea    0x0(%esi),%esi
+80107260:	8b 82 bc 00 00 00    	mov    0xbc(%edx),%eax
+        for (n = 1; addr && ip->raend + n < end; n++)
+80107266:	be 01 00 00 00       	mov    $0x1,%esi
+8010726b:	eb a0                	jmp    8010720d <readi+0x29d>
+8010726d:	8d 76 00             	lea    0x0(%esi),%esi
+        return ip->addrs[bn];
+80107270:	8b 8c b2 84 00 00 00 	mov    0x84(%edx,%esi,4),%ecx
+80107277:	e9 da fe ff ff       	jmp    80107156 <readi+0x1e6>
+        if (ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+8010727c:	0f bf 43 7a          	movswl 0x7a(%ebx),%eax
+80107280:	66 83 f8 09          	cmp    $0x9,%ax
+80107284:	77 29                	ja     801072af <readi+0x33f>
+80107286:	8b 04 c5 60 16 1c 80 	mov    -0x7fe3e9a0(,%eax,8),%eax
+8010728d:	85 c0                	test   %eax,%eax
+8010728f:	74 1e                	je     801072af <readi+0x33f>
+        return devsw[ip->major].read(ip, dst, n);
+80107291:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80107294:	89 4d 10             	mov    %ecx,0x10(%ebp)
+}
+80107297:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010729a:	5b                   	pop    %ebx
+8010729b:	5e                   	pop    %esi
+8010729c:	5f                   	pop    %edi
+8010729d:	5d                   	pop    %ebp
+        return devsw[ip->major].read(ip, dst, n);
+8010729e:	ff e0                	jmp    *%eax
+        for (n = 1; addr && ip->raend + n < end; n++)
+801072a0:	b8 01 00 00 00       	mov    $0x1,%eax
+801072a5:	be 01 00 00 00       	mov    $0x1,%esi
+801072aa:	e9 43 ff ff ff       	jmp    801071f2 <readi+0x282>
+            return -1;
+801072af:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801072b4:	e9 ea fd ff ff       	jmp    801070a3 <readi+0x133>
+801072b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801072c0 <writei>:
+
+// write data to inode
+// caller must hold ip->lock
+int
+writei(struct inode *ip, char *src, uint off, uint n)
+{
+801072c0:	55                   	push   %ebp
+801072c1:	89 e5                	mov    %esp,%ebp
+801072c3:	57                   	push   %edi
+801072c4:	56                   	push   %esi
+801072c5:	53                   	push   %ebx
+801072c6:	83 ec 1c             	sub    $0x1c,%esp
+801072c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801072cc:	8b 55 08             	mov    0x8(%ebp),%edx
+801072cf:	8b 7d 10             	mov    0x10(%ebp),%edi
+801072d2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801072d5:	8b 45 14             	mov    0x14(%ebp),%eax
+    uint tot, m;
+    struct buf *bp;
+
+    if (ip->type == T_DEV) {
+801072d8:	66 83 7a 78 03       	cmpw   $0x3,0x78(%edx)
+{
+801072dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if (ip->type == T_DEV) {
+801072e0:	0f 84 ca 00 00 00    	je     801073b0 <writei+0xf0>
+        if (ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+            return -1;
+        return devsw[ip->major].write(ip, src, n);
+    }
+
+    if (off > ip->size || off + n < off)
+801072e6:	39 ba 80 00 00 00    	cmp    %edi,0x80(%edx)
+801072ec:	0f 82 fa 00 00 00    	jb     801073ec <writei+0x12c>
+801072f2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801072f5:	31 c9                	xor    %ecx,%ecx
+801072f7:	89 f0                	mov    %esi,%eax
+801072f9:	01 f8                	add    %edi,%eax
+801072fb:	0f 92 c1             	setb   %cl
+        return -1;
+    if (off + n > MAXFILE * BSIZE)
+801072fe:	3d 00 18 01 00       	cmp    $0x11800,%eax
+80107303:	0f 87 e3 00 00 00    	ja     801073ec <writei+0x12c>
+80107309:	85 c9                	test   %ecx,%ecx
+8010730b:	0f 85 db 00 00 00    	jne    801073ec <writei+0x12c>
+        return -1;
+
+    for (tot = 0; tot < n; tot += m, off += m, src += m) {
+80107311:	85 f6                	test   %esi,%esi
+80107313:	0f 84 89 00 00 00    	je     801073a2 <writei+0xe2>
+80107319:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+        m = min(n - tot, BSIZE - off%BSIZE);
+80107320:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80107323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107327:	90                   	nop
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80107328:	8b 75 d8             	mov    -0x28(%ebp),%esi
+8010732b:	89 fa                	mov    %edi,%edx
+8010732d:	c1 ea 09             	shr    $0x9,%edx
+80107330:	89 f0                	mov    %esi,%eax
+80107332:	e8 39 f6 ff ff       	call   80106970 <bmap>
+80107337:	83 ec 08             	sub    $0x8,%esp
+8010733a:	50                   	push   %eax
+8010733b:	ff 36                	push   (%esi)
+8010733d:	e8 be dd ff ff       	call   80105100 <bread>
+        m = min(n - tot, BSIZE - off%BSIZE);
+80107342:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107345:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80107348:	b9 00 02 00 00       	mov    $0x200,%ecx
+        bp = bread(ip->dev, bmap(ip, off/BSIZE));
+8010734d:	89 c6                	mov    %eax,%esi
+        m = min(n - tot, BSIZE - off%BSIZE);
+8010734f:	89 f8                	mov    %edi,%eax
+80107351:	25 ff 01 00 00       	and    $0x1ff,%eax
+80107356:	29 d3                	sub    %edx,%ebx
+80107358:	29 c1                	sub    %eax,%ecx
+8010735a:	39 d9                	cmp    %ebx,%ecx
+8010735c:	0f 46 d9             	cmovbe %ecx,%ebx
+        memmove(bp->data + off%BSIZE, src, m);
+8010735f:	83 c4 0c             	add    $0xc,%esp
+80107362:	53                   	push   %ebx
+    for (tot = 0; tot < n; tot += m, off += m, src += m) {
+80107363:	01 df                	add    %ebx,%edi
+        memmove(bp->data + off%BSIZE, src, m);
+80107365:	ff 75 dc             	push   -0x24(%ebp)
+80107368:	03 86 cc 00 00 00    	add    0xcc(%esi),%eax
+8010736e:	50                   	push   %eax
+8010736f:	e8 5c 8d ff ff       	call   801000d0 <memmove>
+        log_write(bp);
+80107374:	89 34 24             	mov    %esi,(%esp)
+80107377:	e8 64 ed ff ff       	call   801060e0 <log_write>
+        brelse(bp);
+8010737c:	89 34 24             	mov    %esi,(%esp)
+8010737f:	e8 ac e0 ff ff       	call   80105430 <brelse>
+    for (tot = 0; tot < n; tot += m, off += m, src += m) {
+80107384:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+80107387:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010738a:	83 c4 10             	add    $0x10,%esp
+8010738d:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80107390:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80107393:	39 d8                	cmp    %ebx,%eax
+80107395:	72 91                	jb     80107328 <writei+0x68>
+    }
+
+    if (n > 0 && off > ip->size) {
+80107397:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010739a:	39 ba 80 00 00 00    	cmp    %edi,0x80(%edx)
+801073a0:	72 36                	jb     801073d8 <writei+0x118>
+        ip->size = off;
+        iupdate(ip);
+    }
+    return n;
+801073a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+801073a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801073a8:	5b                   	pop    %ebx
+801073a9:	5e                   	pop    %esi
+801073aa:	5f                   	pop    %edi
+801073ab:	5d                   	pop    %ebp
+801073ac:	c3                   	ret
+801073ad:	8d 76 00             	lea    0x0(%esi),%esi
+        if (ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+801073b0:	0f bf 42 7a          	movswl 0x7a(%edx),%eax
+801073b4:	66 83 f8 09          	cmp    $0x9,%ax
+801073b8:	77 32                	ja     801073ec <writei+0x12c>
+801073ba:	8b 04 c5 64 16 1c 80 	mov    -0x7fe3e99c(,%eax,8),%eax
+801073c1:	85 c0                	test   %eax,%eax
+801073c3:	74 27                	je     801073ec <writei+0x12c>
+        return devsw[ip->major].write(ip, src, n);
+801073c5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801073c8:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+801073cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801073ce:	5b                   	pop    %ebx
+801073cf:	5e                   	pop    %esi
+801073d0:	5f                   	pop    %edi
+801073d1:	5d                   	pop    %ebp
+        return devsw[ip->major].write(ip, src, n);
+801073d2:	ff e0                	jmp    *%eax
+801073d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        iupdate(ip);
+801073d8:	83 ec 0c             	sub    $0xc,%esp
+        ip->size = off;
+801073db:	89 ba 80 00 00 00    	mov    %edi,0x80(%edx)
+        iupdate(ip);
+801073e1:	52                   	push   %edx
+801073e2:	e8 09 f8 ff ff       	call   80106bf0 <iupdate>
+801073e7:	83 c4 10             	add    $0x10,%esp
+801073ea:	eb b6                	jmp    801073a2 <writei+0xe2>
+            return -1;
+801073ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801073f1:	eb b2                	jmp    801073a5 <writei+0xe5>
+801073f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107400 <stati>:
+
+// copy stat information from inode
+// caller must hold ip->lock
+void
+stati(struct inode *ip, struct stat *st)
+{
+80107400:	55                   	push   %ebp
+80107401:	89 e5                	mov    %esp,%ebp
+80107403:	8b 55 08             	mov    0x8(%ebp),%edx
+80107406:	8b 45 0c             	mov    0xc(%ebp),%eax
+    st->dev = ip->dev;
+80107409:	8b 0a                	mov    (%edx),%ecx
+8010740b:	89 48 04             	mov    %ecx,0x4(%eax)
+    st->ino = ip->inum;
+8010740e:	8b 4a 04             	mov    0x4(%edx),%ecx
+80107411:	89 48 08             	mov    %ecx,0x8(%eax)
+    st->type = ip->type;
+80107414:	0f b7 4a 78          	movzwl 0x78(%edx),%ecx
+80107418:	66 89 08             	mov    %cx,(%eax)
+    st->nlink = ip->nlink;
+8010741b:	0f b7 4a 7e          	movzwl 0x7e(%edx),%ecx
+8010741f:	66 89 48 0c          	mov    %cx,0xc(%eax)
+    st->size = ip->size;
+80107423:	8b 92 80 00 00 00    	mov    0x80(%edx),%edx
+80107429:	89 50 10             	mov    %edx,0x10(%eax)
+}
+8010742c:	5d                   	pop    %ebp
+8010742d:	c3                   	ret
+8010742e:	66 90                	xchg   %ax,%ax
+
+80107430 <namecmp>:
+
+// directories
+
+int
+namecmp(const char *s, const char *t)
+{
+80107430:	55                   	push   %ebp
+80107431:	89 e5                	mov    %esp,%ebp
+80107433:	83 ec 0c             	sub    $0xc,%esp
+    return strncmp(s, t, DIRSIZ);
+80107436:	6a 0e                	push   $0xe
+80107438:	ff 75 0c             	push   0xc(%ebp)
+8010743b:	ff 75 08             	push   0x8(%ebp)
+8010743e:	e8 fd 8c ff ff       	call   80100140 <strncmp>
+}
+80107443:	c9                   	leave
+80107444:	c3                   	ret
+80107445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010744c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107450 <dirlookup>:
+
+// look for a directory entry in a directory
+// if found, set *poff to byte offset of entry
+struct inode*
+dirlookup(struct inode *dp, char *name, uint *poff)
+{
+80107450:	55                   	push   %ebp
+80107451:	89 e5                	mov    %esp,%ebp
+80107453:	57                   	push   %edi
+80107454:	56                   	push   %esi
+80107455:	53                   	push   %ebx
+80107456:	83 ec 1c             	sub    $0x1c,%esp
+80107459:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    uint off, inum;
+    struct dirent de;
+
+    if (dp->type != T_DIR)
+8010745c:	66 83 7b 78 01       	cmpw   $0x1,0x78(%ebx)
+80107461:	0f 85 95 00 00 00    	jne    801074fc <dirlookup+0xac>
+        panic("dirlookup: not dir");
+
+    for (off = 0; off < dp->size; off += sizeof(de)) {
+80107467:	8b 93 80 00 00 00    	mov    0x80(%ebx),%edx
+8010746d:	31 ff                	xor    %edi,%edi
+8010746f:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80107472:	85 d2                	test   %edx,%edx
+80107474:	74 46                	je     801074bc <dirlookup+0x6c>
+80107476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010747d:	8d 76 00             	lea    0x0(%esi),%esi
+        if (readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80107480:	6a 10                	push   $0x10
+80107482:	57                   	push   %edi
+80107483:	56                   	push   %esi
+80107484:	53                   	push   %ebx
+80107485:	e8 e6 fa ff ff       	call   80106f70 <readi>
+8010748a:	83 c4 10             	add    $0x10,%esp
+8010748d:	83 f8 10             	cmp    $0x10,%eax
+80107490:	75 5d                	jne    801074ef <dirlookup+0x9f>
+            panic("dirlookup: read");
+        if (de.inum == 0)
+80107492:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80107497:	74 18                	je     801074b1 <dirlookup+0x61>
+    return strncmp(s, t, DIRSIZ);
+80107499:	83 ec 04             	sub    $0x4,%esp
+8010749c:	8d 45 da             	lea    -0x26(%ebp),%eax
+8010749f:	6a 0e                	push   $0xe
+801074a1:	50                   	push   %eax
+801074a2:	ff 75 0c             	push   0xc(%ebp)
+801074a5:	e8 96 8c ff ff       	call   80100140 <strncmp>
+            continue;
+        if (namecmp(name, de.name) == 0) {
+801074aa:	83 c4 10             	add    $0x10,%esp
+801074ad:	85 c0                	test   %eax,%eax
+801074af:	74 1f                	je     801074d0 <dirlookup+0x80>
+    for (off = 0; off < dp->size; off += sizeof(de)) {
+801074b1:	83 c7 10             	add    $0x10,%edi
+801074b4:	3b bb 80 00 00 00    	cmp    0x80(%ebx),%edi
+801074ba:	72 c4                	jb     80107480 <dirlookup+0x30>
+            inum = de.inum;
+            return iget(dp->dev, inum);
+        }
+    }
+    return 0;
+}
+801074bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+801074bf:	31 c0                	xor    %eax,%eax
+}
+801074c1:	5b                   	pop    %ebx
+801074c2:	5e                   	pop    %esi
+801074c3:	5f                   	pop    %edi
+801074c4:	5d                   	pop    %ebp
+801074c5:	c3                   	ret
+801074c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801074cd:	8d 76 00             	lea    0x0(%esi),%esi
+            if (poff)
+801074d0:	8b 45 10             	mov    0x10(%ebp),%eax
+801074d3:	85 c0                	test   %eax,%eax
+801074d5:	74 05                	je     801074dc <dirlookup+0x8c>
+                *poff = off;
+801074d7:	8b 45 10             	mov    0x10(%ebp),%eax
+801074da:	89 38                	mov    %edi,(%eax)
+            inum = de.inum;
+801074dc:	0f b7 55 d8          	movzwl -0x28(%ebp),%edx
+            return iget(dp->dev, inum);
+801074e0:	8b 03                	mov    (%ebx),%eax
+801074e2:	e8 19 f3 ff ff       	call   80106800 <iget>
+}
+801074e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801074ea:	5b                   	pop    %ebx
+801074eb:	5e                   	pop    %esi
+801074ec:	5f                   	pop    %edi
+801074ed:	5d                   	pop    %ebp
+801074ee:	c3                   	ret
+            panic("dirlookup: read");
+801074ef:	83 ec 0c             	sub    $0xc,%esp
+801074f2:	68 93 b5 10 80       	push   $0x8010b593
+801074f7:	e8 44 28 00 00       	call   80109d40 <panic>
+        panic("dirlookup: not dir");
+801074fc:	83 ec 0c             	sub    $0xc,%esp
+801074ff:	68 80 b5 10 80       	push   $0x8010b580
+80107504:	e8 37 28 00 00       	call   80109d40 <panic>
+80107509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107510 <namex>:
+// if parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSZ bytes.
+// must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80107510:	55                   	push   %ebp
+80107511:	89 e5                	mov    %esp,%ebp
+80107513:	57                   	push   %edi
+80107514:	56                   	push   %esi
+80107515:	53                   	push   %ebx
+80107516:	89 c3                	mov    %eax,%ebx
+80107518:	83 ec 1c             	sub    $0x1c,%esp
+    struct inode *ip, *next;
+
+    if (*path == '/')
+8010751b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+8010751e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80107521:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    if (*path == '/')
+80107524:	0f 84 eb 00 00 00    	je     80107615 <namex+0x105>
+        ip = iget(ROOTDEV, ROOTINO);
+    else
+        ip = idup(myproc()->cwd);
+8010752a:	e8 31 0f 00 00       	call   80108460 <myproc>
+8010752f:	8b 70 2c             	mov    0x2c(%eax),%esi
+    __sync_fetch_and_add(&ip->ref, 1);
+80107532:	f0 83 46 08 01       	lock addl $0x1,0x8(%esi)
+    return ip;
+80107537:	eb 0a                	jmp    80107543 <namex+0x33>
+80107539:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        path++;
+80107540:	83 c3 01             	add    $0x1,%ebx
+    while (*path == '/')
+80107543:	0f b6 03             	movzbl (%ebx),%eax
+80107546:	3c 2f                	cmp    $0x2f,%al
+80107548:	74 f6                	je     80107540 <namex+0x30>
+    if (*path == 0)
+8010754a:	84 c0                	test   %al,%al
+8010754c:	0f 84 ae 00 00 00    	je     80107600 <namex+0xf0>
+        memmove(name, s, len);
+80107552:	83 ec 04             	sub    $0x4,%esp
+80107555:	6a 00                	push   $0x0
+80107557:	53                   	push   %ebx
+80107558:	8b 7d e0             	mov    -0x20(%ebp),%edi
+8010755b:	57                   	push   %edi
+8010755c:	e8 6f 8b ff ff       	call   801000d0 <memmove>
+        name[len] = 0;
+80107561:	c6 07 00             	movb   $0x0,(%edi)
+    while (*path == '/')
+80107564:	83 c4 10             	add    $0x10,%esp
+80107567:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+8010756a:	75 0c                	jne    80107578 <namex+0x68>
+8010756c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        path++;
+80107570:	83 c3 01             	add    $0x1,%ebx
+    while (*path == '/')
+80107573:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+80107576:	74 f8                	je     80107570 <namex+0x60>
+
+    while ((path = skipelem(path, name)) != 0) {
+        ilock(ip);
+80107578:	83 ec 0c             	sub    $0xc,%esp
+8010757b:	56                   	push   %esi
+8010757c:	e8 0f f7 ff ff       	call   80106c90 <ilock>
+        if ((ip->type != T_DIR)) {
+80107581:	83 c4 10             	add    $0x10,%esp
+80107584:	66 83 7e 78 01       	cmpw   $0x1,0x78(%esi)
+80107589:	0f 85 9c 00 00 00    	jne    8010762b <namex+0x11b>
+            iunlockput(ip);
+            return 0;
+        }
+        if (nameiparent && *path == '\0') {
+8010758f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80107592:	85 c0                	test   %eax,%eax
+80107594:	74 09                	je     8010759f <namex+0x8f>
+80107596:	80 3b 00             	cmpb   $0x0,(%ebx)
+80107599:	0f 84 03 01 00 00    	je     801076a2 <namex+0x192>
+            // stop one level early
+            iunlock(ip);
+            return ip;
+        }
+        if ((next = dirlookup(ip, name, 0)) == 0) {
+8010759f:	83 ec 04             	sub    $0x4,%esp
+801075a2:	6a 00                	push   $0x0
+801075a4:	ff 75 e0             	push   -0x20(%ebp)
+801075a7:	56                   	push   %esi
+801075a8:	e8 a3 fe ff ff       	call   80107450 <dirlookup>
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+801075ad:	8d 56 0c             	lea    0xc(%esi),%edx
+        if ((next = dirlookup(ip, name, 0)) == 0) {
+801075b0:	83 c4 10             	add    $0x10,%esp
+801075b3:	89 c7                	mov    %eax,%edi
+801075b5:	85 c0                	test   %eax,%eax
+801075b7:	0f 84 b0 00 00 00    	je     8010766d <namex+0x15d>
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+801075bd:	83 ec 0c             	sub    $0xc,%esp
+801075c0:	52                   	push   %edx
+801075c1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801075c4:	e8 87 a6 ff ff       	call   80101c50 <holdingsleep>
+801075c9:	83 c4 10             	add    $0x10,%esp
+801075cc:	85 c0                	test   %eax,%eax
+801075ce:	0f 84 0e 01 00 00    	je     801076e2 <namex+0x1d2>
+801075d4:	8b 56 08             	mov    0x8(%esi),%edx
+801075d7:	85 d2                	test   %edx,%edx
+801075d9:	0f 8e 03 01 00 00    	jle    801076e2 <namex+0x1d2>
+    releasesleep(&ip->lock);
+801075df:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801075e2:	83 ec 0c             	sub    $0xc,%esp
+801075e5:	52                   	push   %edx
+801075e6:	e8 d5 a5 ff ff       	call   80101bc0 <releasesleep>
+    iput(ip);
+801075eb:	89 34 24             	mov    %esi,(%esp)
+801075ee:	89 fe                	mov    %edi,%esi
+801075f0:	e8 db f7 ff ff       	call   80106dd0 <iput>
+801075f5:	83 c4 10             	add    $0x10,%esp
+    while (*path == '/')
+801075f8:	e9 46 ff ff ff       	jmp    80107543 <namex+0x33>
+801075fd:	8d 76 00             	lea    0x0(%esi),%esi
+            return 0;
+        }
+        iunlockput(ip);
+        ip = next;
+    }
+    if (nameiparent) {
+80107600:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80107603:	85 c0                	test   %eax,%eax
+80107605:	0f 85 c7 00 00 00    	jne    801076d2 <namex+0x1c2>
+        iput(ip);
+        return 0;
+    }
+    return ip;
+}
+8010760b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010760e:	89 f0                	mov    %esi,%eax
+80107610:	5b                   	pop    %ebx
+80107611:	5e                   	pop    %esi
+80107612:	5f                   	pop    %edi
+80107613:	5d                   	pop    %ebp
+80107614:	c3                   	ret
+        ip = iget(ROOTDEV, ROOTINO);
+80107615:	ba 01 00 00 00       	mov    $0x1,%edx
+8010761a:	b8 01 00 00 00       	mov    $0x1,%eax
+8010761f:	e8 dc f1 ff ff       	call   80106800 <iget>
+80107624:	89 c6                	mov    %eax,%esi
+80107626:	e9 18 ff ff ff       	jmp    80107543 <namex+0x33>
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+8010762b:	83 ec 0c             	sub    $0xc,%esp
+8010762e:	8d 5e 0c             	lea    0xc(%esi),%ebx
+80107631:	53                   	push   %ebx
+80107632:	e8 19 a6 ff ff       	call   80101c50 <holdingsleep>
+80107637:	83 c4 10             	add    $0x10,%esp
+8010763a:	85 c0                	test   %eax,%eax
+8010763c:	0f 84 a0 00 00 00    	je     801076e2 <namex+0x1d2>
+80107642:	8b 46 08             	mov    0x8(%esi),%eax
+80107645:	85 c0                	test   %eax,%eax
+80107647:	0f 8e 95 00 00 00    	jle    801076e2 <namex+0x1d2>
+    releasesleep(&ip->lock);
+8010764d:	83 ec 0c             	sub    $0xc,%esp
+80107650:	53                   	push   %ebx
+80107651:	e8 6a a5 ff ff       	call   80101bc0 <releasesleep>
+    iput(ip);
+80107656:	89 34 24             	mov    %esi,(%esp)
+            return 0;
+80107659:	31 f6                	xor    %esi,%esi
+    iput(ip);
+8010765b:	e8 70 f7 ff ff       	call   80106dd0 <iput>
+            return 0;
+80107660:	83 c4 10             	add    $0x10,%esp
+}
+80107663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107666:	89 f0                	mov    %esi,%eax
+80107668:	5b                   	pop    %ebx
+80107669:	5e                   	pop    %esi
+8010766a:	5f                   	pop    %edi
+8010766b:	5d                   	pop    %ebp
+8010766c:	c3                   	ret
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+8010766d:	83 ec 0c             	sub    $0xc,%esp
+80107670:	52                   	push   %edx
+80107671:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107674:	e8 d7 a5 ff ff       	call   80101c50 <holdingsleep>
+80107679:	83 c4 10             	add    $0x10,%esp
+8010767c:	85 c0                	test   %eax,%eax
+8010767e:	74 62                	je     801076e2 <namex+0x1d2>
+80107680:	8b 4e 08             	mov    0x8(%esi),%ecx
+80107683:	85 c9                	test   %ecx,%ecx
+80107685:	7e 5b                	jle    801076e2 <namex+0x1d2>
+    releasesleep(&ip->lock);
+80107687:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010768a:	83 ec 0c             	sub    $0xc,%esp
+8010768d:	52                   	push   %edx
+8010768e:	e8 2d a5 ff ff       	call   80101bc0 <releasesleep>
+    iput(ip);
+80107693:	89 34 24             	mov    %esi,(%esp)
+            return 0;
+80107696:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80107698:	e8 33 f7 ff ff       	call   80106dd0 <iput>
+            return 0;
+8010769d:	83 c4 10             	add    $0x10,%esp
+801076a0:	eb c1                	jmp    80107663 <namex+0x153>
+    if (ip == 0 || !(holdingsleep(&ip->lock)) || ip->ref < 1)
+801076a2:	83 ec 0c             	sub    $0xc,%esp
+801076a5:	8d 5e 0c             	lea    0xc(%esi),%ebx
+801076a8:	53                   	push   %ebx
+801076a9:	e8 a2 a5 ff ff       	call   80101c50 <holdingsleep>
+801076ae:	83 c4 10             	add    $0x10,%esp
+801076b1:	85 c0                	test   %eax,%eax
+801076b3:	74 2d                	je     801076e2 <namex+0x1d2>
+801076b5:	8b 7e 08             	mov    0x8(%esi),%edi
+801076b8:	85 ff                	test   %edi,%edi
+801076ba:	7e 26                	jle    801076e2 <namex+0x1d2>
+    releasesleep(&ip->lock);
+801076bc:	83 ec 0c             	sub    $0xc,%esp
+801076bf:	53                   	push   %ebx
+801076c0:	e8 fb a4 ff ff       	call   80101bc0 <releasesleep>
+}
+801076c5:	83 c4 10             	add    $0x10,%esp
+}
+801076c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801076cb:	89 f0                	mov    %esi,%eax
+801076cd:	5b                   	pop    %ebx
+801076ce:	5e                   	pop    %esi
+801076cf:	5f                   	pop    %edi
+801076d0:	5d                   	pop    %ebp
+801076d1:	c3                   	ret
+        iput(ip);
+801076d2:	83 ec 0c             	sub    $0xc,%esp
+801076d5:	56                   	push   %esi
+            return 0;
+801076d6:	31 f6                	xor    %esi,%esi
+        iput(ip);
+801076d8:	e8 f3 f6 ff ff       	call   80106dd0 <iput>
+        return 0;
+801076dd:	83 c4 10             	add    $0x10,%esp
+801076e0:	eb 81                	jmp    80107663 <namex+0x153>
+        panic("iunlock");
+801076e2:	83 ec 0c             	sub    $0xc,%esp
+801076e5:	68 78 b5 10 80       	push   $0x8010b578
+801076ea:	e8 51 26 00 00       	call   80109d40 <panic>
+801076ef:	90                   	nop
+
+801076f0 <dirlink>:
+{
+801076f0:	55                   	push   %ebp
+801076f1:	89 e5                	mov    %esp,%ebp
+801076f3:	57                   	push   %edi
+801076f4:	56                   	push   %esi
+801076f5:	53                   	push   %ebx
+801076f6:	83 ec 20             	sub    $0x20,%esp
+801076f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if ((ip = dirlookup(dp, name, 0)) != 0) {
+801076fc:	6a 00                	push   $0x0
+801076fe:	ff 75 0c             	push   0xc(%ebp)
+80107701:	53                   	push   %ebx
+80107702:	e8 49 fd ff ff       	call   80107450 <dirlookup>
+80107707:	83 c4 10             	add    $0x10,%esp
+8010770a:	85 c0                	test   %eax,%eax
+8010770c:	75 72                	jne    80107780 <dirlink+0x90>
+    for (off = 0; off < dp->size; off += sizeof(de)) {
+8010770e:	8b bb 80 00 00 00    	mov    0x80(%ebx),%edi
+80107714:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80107717:	85 ff                	test   %edi,%edi
+80107719:	74 31                	je     8010774c <dirlink+0x5c>
+8010771b:	31 ff                	xor    %edi,%edi
+8010771d:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80107720:	eb 11                	jmp    80107733 <dirlink+0x43>
+80107722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107728:	83 c7 10             	add    $0x10,%edi
+8010772b:	3b bb 80 00 00 00    	cmp    0x80(%ebx),%edi
+80107731:	73 19                	jae    8010774c <dirlink+0x5c>
+        if (readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80107733:	6a 10                	push   $0x10
+80107735:	57                   	push   %edi
+80107736:	56                   	push   %esi
+80107737:	53                   	push   %ebx
+80107738:	e8 33 f8 ff ff       	call   80106f70 <readi>
+8010773d:	83 c4 10             	add    $0x10,%esp
+80107740:	83 f8 10             	cmp    $0x10,%eax
+80107743:	75 4e                	jne    80107793 <dirlink+0xa3>
+        if (de.inum == 0)
+80107745:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+8010774a:	75 dc                	jne    80107728 <dirlink+0x38>
+    strncpy(de.name, name, DIRSIZ);
+8010774c:	83 ec 04             	sub    $0x4,%esp
+8010774f:	8d 45 da             	lea    -0x26(%ebp),%eax
+80107752:	6a 0e                	push   $0xe
+80107754:	ff 75 0c             	push   0xc(%ebp)
+80107757:	50                   	push   %eax
+80107758:	e8 33 8a ff ff       	call   80100190 <strncpy>
+    de.inum = inum;
+8010775d:	8b 45 10             	mov    0x10(%ebp),%eax
+80107760:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+    if (writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80107764:	6a 10                	push   $0x10
+80107766:	57                   	push   %edi
+80107767:	56                   	push   %esi
+80107768:	53                   	push   %ebx
+80107769:	e8 52 fb ff ff       	call   801072c0 <writei>
+8010776e:	83 c4 20             	add    $0x20,%esp
+80107771:	83 f8 10             	cmp    $0x10,%eax
+80107774:	75 2a                	jne    801077a0 <dirlink+0xb0>
+    return 0;
+80107776:	31 c0                	xor    %eax,%eax
+}
+80107778:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010777b:	5b                   	pop    %ebx
+8010777c:	5e                   	pop    %esi
+8010777d:	5f                   	pop    %edi
+8010777e:	5d                   	pop    %ebp
+8010777f:	c3                   	ret
+        iput(ip);
+80107780:	83 ec 0c             	sub    $0xc,%esp
+80107783:	50                   	push   %eax
+80107784:	e8 47 f6 ff ff       	call   80106dd0 <iput>
+        return -1;
+80107789:	83 c4 10             	add    $0x10,%esp
+8010778c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107791:	eb e5                	jmp    80107778 <dirlink+0x88>
+            panic("dirlink: read");
+80107793:	83 ec 0c             	sub    $0xc,%esp
+80107796:	68 a3 b5 10 80       	push   $0x8010b5a3
+8010779b:	e8 a0 25 00 00       	call   80109d40 <panic>
+        panic("dirlink");
+801077a0:	83 ec 0c             	sub    $0xc,%esp
+801077a3:	68 b1 b5 10 80       	push   $0x8010b5b1
+801077a8:	e8 93 25 00 00       	call   80109d40 <panic>
+801077ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801077b0 <namei>:
+
+struct inode*
+namei(char *path)
+{
+801077b0:	55                   	push   %ebp
+    char name[DIRSIZ];
+    return namex(path, 0, name);
+801077b1:	31 d2                	xor    %edx,%edx
+{
+801077b3:	89 e5                	mov    %esp,%ebp
+801077b5:	83 ec 18             	sub    $0x18,%esp
+    return namex(path, 0, name);
+801077b8:	8b 45 08             	mov    0x8(%ebp),%eax
+801077bb:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+801077be:	e8 4d fd ff ff       	call   80107510 <namex>
+}
+801077c3:	c9                   	leave
+801077c4:	c3                   	ret
+801077c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801077cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801077d0 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+801077d0:	55                   	push   %ebp
+    return namex(path, 1, name);
+801077d1:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+801077d6:	89 e5                	mov    %esp,%ebp
+    return namex(path, 1, name);
+801077d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+801077db:	8b 45 08             	mov    0x8(%ebp),%eax
+801077de:	5d                   	pop    %ebp
+    return namex(path, 1, name);
+801077df:	e9 2c fd ff ff       	jmp    80107510 <namex>
+801077e4:	66 90                	xchg   %ax,%ax
+801077e6:	66 90                	xchg   %ax,%ax
+801077e8:	66 90                	xchg   %ax,%ax
+801077ea:	66 90                	xchg   %ax,%ax
+801077ec:	66 90                	xchg   %ax,%ax
+801077ee:	66 90                	xchg   %ax,%ax
+
+801077f0 <fileinit>:
+    struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+801077f0:	55                   	push   %ebp
+801077f1:	89 e5                	mov    %esp,%ebp
+801077f3:	83 ec 10             	sub    $0x10,%esp
+    initlock(&ftable.lock, "ftable");
+801077f6:	68 0e b6 10 80       	push   $0x8010b60e
+801077fb:	68 a0 0c 1c 80       	push   $0x801c0ca0
+80107800:	e8 3b 98 ff ff       	call   80101040 <initlock>
+}
+80107805:	83 c4 10             	add    $0x10,%esp
+80107808:	c9                   	leave
+80107809:	c3                   	ret
+8010780a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107810 <filealloc>:
+
+// allocate a file structure
+struct file*
+filealloc(void)
+{
+80107810:	55                   	push   %ebp
+80107811:	89 e5                	mov    %esp,%ebp
+80107813:	53                   	push   %ebx
+    struct file *f;
+
+    acquire(&ftable.lock);
+    for (f = ftable.file; f < ftable.file + NFILE; f++) {
+80107814:	bb e4 0c 1c 80       	mov    $0x801c0ce4,%ebx
+{
+80107819:	83 ec 10             	sub    $0x10,%esp
+    acquire(&ftable.lock);
+8010781c:	68 a0 0c 1c 80       	push   $0x801c0ca0
+80107821:	e8 8a 9c ff ff       	call   801014b0 <acquire>
+80107826:	83 c4 10             	add    $0x10,%esp
+80107829:	eb 10                	jmp    8010783b <filealloc+0x2b>
+8010782b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010782f:	90                   	nop
+    for (f = ftable.file; f < ftable.file + NFILE; f++) {
+80107830:	83 c3 18             	add    $0x18,%ebx
+80107833:	81 fb 44 16 1c 80    	cmp    $0x801c1644,%ebx
+80107839:	74 25                	je     80107860 <filealloc+0x50>
+        if (f->ref == 0) {
+8010783b:	8b 43 04             	mov    0x4(%ebx),%eax
+8010783e:	85 c0                	test   %eax,%eax
+80107840:	75 ee                	jne    80107830 <filealloc+0x20>
+            f->ref = 1;
+            release(&ftable.lock);
+80107842:	83 ec 0c             	sub    $0xc,%esp
+            f->ref = 1;
+80107845:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+            release(&ftable.lock);
+8010784c:	68 a0 0c 1c 80       	push   $0x801c0ca0
+80107851:	e8 7a 9a ff ff       	call   801012d0 <release>
+            return f;
+        }
+    }
+    release(&ftable.lock);
+    return 0;
+}
+80107856:	89 d8                	mov    %ebx,%eax
+            return f;
+80107858:	83 c4 10             	add    $0x10,%esp
+}
+8010785b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010785e:	c9                   	leave
+8010785f:	c3                   	ret
+    release(&ftable.lock);
+80107860:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+80107863:	31 db                	xor    %ebx,%ebx
+    release(&ftable.lock);
+80107865:	68 a0 0c 1c 80       	push   $0x801c0ca0
+8010786a:	e8 61 9a ff ff       	call   801012d0 <release>
+}
+8010786f:	89 d8                	mov    %ebx,%eax
+    return 0;
+80107871:	83 c4 10             	add    $0x10,%esp
+}
+80107874:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107877:	c9                   	leave
+80107878:	c3                   	ret
+80107879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107880 <fileup>:
+
+// increment ref count for file f
+struct file*
+fileup(struct file *f)
+{
+80107880:	55                   	push   %ebp
+80107881:	89 e5                	mov    %esp,%ebp
+80107883:	53                   	push   %ebx
+80107884:	83 ec 10             	sub    $0x10,%esp
+80107887:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    acquire(&ftable.lock);
+8010788a:	68 a0 0c 1c 80       	push   $0x801c0ca0
+8010788f:	e8 1c 9c ff ff       	call   801014b0 <acquire>
+    if (f->ref < 1)
+80107894:	8b 43 04             	mov    0x4(%ebx),%eax
+80107897:	83 c4 10             	add    $0x10,%esp
+8010789a:	85 c0                	test   %eax,%eax
+8010789c:	7e 1a                	jle    801078b8 <fileup+0x38>
+        panic("fileup: file.ref<1");
+    f->ref++;
+8010789e:	83 c0 01             	add    $0x1,%eax
+    release(&ftable.lock);
+801078a1:	83 ec 0c             	sub    $0xc,%esp
+    f->ref++;
+801078a4:	89 43 04             	mov    %eax,0x4(%ebx)
+    release(&ftable.lock);
+801078a7:	68 a0 0c 1c 80       	push   $0x801c0ca0
+801078ac:	e8 1f 9a ff ff       	call   801012d0 <release>
+    return f;
+}
+801078b1:	89 d8                	mov    %ebx,%eax
+801078b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801078b6:	c9                   	leave
+801078b7:	c3                   	ret
+        panic("fileup: file.ref<1");
+801078b8:	83 ec 0c             	sub    $0xc,%esp
+801078bb:	68 15 b6 10 80       	push   $0x8010b615
+801078c0:	e8 7b 24 00 00       	call   80109d40 <panic>
+801078c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801078cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801078d0 <fileclose>:
+
+// close file f (decrement ref count, close when reaches 0)
+void
+fileclose(struct file *f)
+{
+801078d0:	55                   	push   %ebp
+801078d1:	89 e5                	mov    %esp,%ebp
+801078d3:	57                   	push   %edi
+801078d4:	56                   	push   %esi
+801078d5:	53                   	push   %ebx
+801078d6:	83 ec 18             	sub    $0x18,%esp
+801078d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    struct file ff;
+
+    acquire(&ftable.lock);
+801078dc:	68 a0 0c 1c 80       	push   $0x801c0ca0
+801078e1:	e8 ca 9b ff ff       	call   801014b0 <acquire>
+    if (f->ref < 1)
+801078e6:	8b 43 04             	mov    0x4(%ebx),%eax
+801078e9:	83 c4 10             	add    $0x10,%esp
+801078ec:	85 c0                	test   %eax,%eax
+801078ee:	7e 65                	jle    80107955 <fileclose+0x85>
+        panic("fileclose: file.ref<1");
+    if (--f->ref > 0) {
+801078f0:	83 e8 01             	sub    $0x1,%eax
+801078f3:	89 43 04             	mov    %eax,0x4(%ebx)
+801078f6:	75 28                	jne    80107920 <fileclose+0x50>
+        return;
+    }
+    ff = *f;
+    f->ref = 0;
+    f->type = FD_NONE;
+    release(&ftable.lock);
+801078f8:	83 ec 0c             	sub    $0xc,%esp
+    ff = *f;
+801078fb:	8b 33                	mov    (%ebx),%esi
+801078fd:	8b 7b 10             	mov    0x10(%ebx),%edi
+    f->type = FD_NONE;
+80107900:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    release(&ftable.lock);
+80107906:	68 a0 0c 1c 80       	push   $0x801c0ca0
+8010790b:	e8 c0 99 ff ff       	call   801012d0 <release>
+
+    // todo: need pipe
+//    if (ff.type == FD_PIPE)
+//        pipeclose(ff.pipe, ff.writeable);
+
+    if (ff.type == FD_INODE) {
+80107910:	83 c4 10             	add    $0x10,%esp
+80107913:	83 fe 02             	cmp    $0x2,%esi
+80107916:	74 20                	je     80107938 <fileclose+0x68>
+        begin_op();
+        iput(ff.ip);
+        end_op();
+    }
+}
+80107918:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010791b:	5b                   	pop    %ebx
+8010791c:	5e                   	pop    %esi
+8010791d:	5f                   	pop    %edi
+8010791e:	5d                   	pop    %ebp
+8010791f:	c3                   	ret
+        release(&ftable.lock);
+80107920:	c7 45 08 a0 0c 1c 80 	movl   $0x801c0ca0,0x8(%ebp)
+}
+80107927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010792a:	5b                   	pop    %ebx
+8010792b:	5e                   	pop    %esi
+8010792c:	5f                   	pop    %edi
+8010792d:	5d                   	pop    %ebp
+        release(&ftable.lock);
+8010792e:	e9 9d 99 ff ff       	jmp    801012d0 <release>
+80107933:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107937:	90                   	nop
+        begin_op();
+80107938:	e8 23 e4 ff ff       	call   80105d60 <begin_op>
+        iput(ff.ip);
+8010793d:	83 ec 0c             	sub    $0xc,%esp
+80107940:	57                   	push   %edi
+80107941:	e8 8a f4 ff ff       	call   80106dd0 <iput>
+        end_op();
+80107946:	83 c4 10             	add    $0x10,%esp
+}
+80107949:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010794c:	5b                   	pop    %ebx
+8010794d:	5e                   	pop    %esi
+8010794e:	5f                   	pop    %edi
+8010794f:	5d                   	pop    %ebp
+        end_op();
+80107950:	e9 8b e4 ff ff       	jmp    80105de0 <end_op>
+        panic("fileclose: file.ref<1");
+80107955:	83 ec 0c             	sub    $0xc,%esp
+80107958:	68 28 b6 10 80       	push   $0x8010b628
+8010795d:	e8 de 23 00 00       	call   80109d40 <panic>
+80107962:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107969:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107970 <fileread>:
+
+// read from file f
+int
+fileread(struct file *f, char *addr, int n)
+{
+80107970:	55                   	push   %ebp
+80107971:	89 e5                	mov    %esp,%ebp
+80107973:	56                   	push   %esi
+80107974:	53                   	push   %ebx
+80107975:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    int r;
+
+    if (f->readable == 0)
+80107978:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+8010797c:	74 4a                	je     801079c8 <fileread+0x58>
+        return -1;
+    // todo: need pipe
+//    if (f->type == FD_PIPE)
+//        return piperead(f->pipe, addr, n);
+    if (f->type == FD_INODE) {
+8010797e:	83 3b 02             	cmpl   $0x2,(%ebx)
+80107981:	75 4c                	jne    801079cf <fileread+0x5f>
+        ilock(f->ip);
+80107983:	83 ec 0c             	sub    $0xc,%esp
+80107986:	ff 73 10             	push   0x10(%ebx)
+80107989:	e8 02 f3 ff ff       	call   80106c90 <ilock>
+        if ((r = readi(f->ip, addr, f->off, n)) > 0)
+8010798e:	ff 75 10             	push   0x10(%ebp)
+80107991:	ff 73 14             	push   0x14(%ebx)
+80107994:	ff 75 0c             	push   0xc(%ebp)
+80107997:	ff 73 10             	push   0x10(%ebx)
+8010799a:	e8 d1 f5 ff ff       	call   80106f70 <readi>
+8010799f:	83 c4 20             	add    $0x20,%esp
+801079a2:	89 c6                	mov    %eax,%esi
+801079a4:	85 c0                	test   %eax,%eax
+801079a6:	7e 03                	jle    801079ab <fileread+0x3b>
+            f->off += r;
+801079a8:	01 43 14             	add    %eax,0x14(%ebx)
+        iunlock(f->ip);
+801079ab:	83 ec 0c             	sub    $0xc,%esp
+801079ae:	ff 73 10             	push   0x10(%ebx)
+801079b1:	e8 ca f3 ff ff       	call   80106d80 <iunlock>
+        return r;
+801079b6:	83 c4 10             	add    $0x10,%esp
+    }
+    panic("fileread: unknown file type");
+}
+801079b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801079bc:	89 f0                	mov    %esi,%eax
+801079be:	5b                   	pop    %ebx
+801079bf:	5e                   	pop    %esi
+801079c0:	5d                   	pop    %ebp
+801079c1:	c3                   	ret
+801079c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        return -1;
+801079c8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801079cd:	eb ea                	jmp    801079b9 <fileread+0x49>
+    panic("fileread: unknown file type");
+801079cf:	83 ec 0c             	sub    $0xc,%esp
+801079d2:	68 3e b6 10 80       	push   $0x8010b63e
+801079d7:	e8 64 23 00 00       	call   80109d40 <panic>
+801079dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801079e0 <filewrite>:
+
+// write to file f
+int
+filewrite(struct file *f, char *addr, int n)
+{
+801079e0:	55                   	push   %ebp
+801079e1:	89 e5                	mov    %esp,%ebp
+801079e3:	57                   	push   %edi
+801079e4:	56                   	push   %esi
+801079e5:	53                   	push   %ebx
+801079e6:	83 ec 1c             	sub    $0x1c,%esp
+801079e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    int r;
+
+    if (f->writeable == 0)
+801079ec:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+801079f0:	0f 84 9f 00 00 00    	je     80107a95 <filewrite+0xb5>
+
+    // todo: need pipe
+//    if (f->type == FD_PIPE)
+//        return pipewrite(f->pipe, addr, n);
+
+    if (f->type == FD_INODE) {
+801079f6:	83 3b 02             	cmpl   $0x2,(%ebx)
+801079f9:	0f 85 a5 00 00 00    	jne    80107aa4 <filewrite+0xc4>
+        // size, including i-node, indirect block, allocation blocks, and 2 blocks of slop
+        // for non-aligned writes. this really belongs lower down, since writei() might be
+        // writing a device like the console
+        int max = ((MAXOPBLOCKS - 1 - 1 - 2) / 2) * 512;
+        int i = 0;
+        while (i < n) {
+801079ff:	8b 45 10             	mov    0x10(%ebp),%eax
+        int i = 0;
+80107a02:	31 ff                	xor    %edi,%edi
+        while (i < n) {
+80107a04:	85 c0                	test   %eax,%eax
+80107a06:	7f 2f                	jg     80107a37 <filewrite+0x57>
+80107a08:	e9 83 00 00 00       	jmp    80107a90 <filewrite+0xb0>
+80107a0d:	8d 76 00             	lea    0x0(%esi),%esi
+                n1 = max;
+
+            begin_op();
+            ilock(f->ip);
+            if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+                f->off += r;
+80107a10:	01 43 14             	add    %eax,0x14(%ebx)
+            iunlock(f->ip);
+80107a13:	83 ec 0c             	sub    $0xc,%esp
+                f->off += r;
+80107a16:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            iunlock(f->ip);
+80107a19:	ff 73 10             	push   0x10(%ebx)
+80107a1c:	e8 5f f3 ff ff       	call   80106d80 <iunlock>
+            end_op();
+80107a21:	e8 ba e3 ff ff       	call   80105de0 <end_op>
+
+            if (f < 0)
+                break;
+            if (r != n1)
+80107a26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107a29:	83 c4 10             	add    $0x10,%esp
+80107a2c:	39 c6                	cmp    %eax,%esi
+80107a2e:	75 52                	jne    80107a82 <filewrite+0xa2>
+                panic("filewrite: short filewrite");
+            i += r;
+80107a30:	01 f7                	add    %esi,%edi
+        while (i < n) {
+80107a32:	39 7d 10             	cmp    %edi,0x10(%ebp)
+80107a35:	7e 59                	jle    80107a90 <filewrite+0xb0>
+            int n1 = n - i;
+80107a37:	8b 75 10             	mov    0x10(%ebp),%esi
+            if (n1 > max)
+80107a3a:	b8 00 06 00 00       	mov    $0x600,%eax
+            int n1 = n - i;
+80107a3f:	29 fe                	sub    %edi,%esi
+            if (n1 > max)
+80107a41:	39 c6                	cmp    %eax,%esi
+80107a43:	0f 4f f0             	cmovg  %eax,%esi
+            begin_op();
+80107a46:	e8 15 e3 ff ff       	call   80105d60 <begin_op>
+            ilock(f->ip);
+80107a4b:	83 ec 0c             	sub    $0xc,%esp
+80107a4e:	ff 73 10             	push   0x10(%ebx)
+80107a51:	e8 3a f2 ff ff       	call   80106c90 <ilock>
+            if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+80107a56:	56                   	push   %esi
+80107a57:	ff 73 14             	push   0x14(%ebx)
+80107a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107a5d:	01 f8                	add    %edi,%eax
+80107a5f:	50                   	push   %eax
+80107a60:	ff 73 10             	push   0x10(%ebx)
+80107a63:	e8 58 f8 ff ff       	call   801072c0 <writei>
+80107a68:	83 c4 20             	add    $0x20,%esp
+80107a6b:	85 c0                	test   %eax,%eax
+80107a6d:	7f a1                	jg     80107a10 <filewrite+0x30>
+            iunlock(f->ip);
+80107a6f:	83 ec 0c             	sub    $0xc,%esp
+80107a72:	ff 73 10             	push   0x10(%ebx)
+80107a75:	e8 06 f3 ff ff       	call   80106d80 <iunlock>
+            end_op();
+80107a7a:	e8 61 e3 ff ff       	call   80105de0 <end_op>
+80107a7f:	83 c4 10             	add    $0x10,%esp
+                panic("filewrite: short filewrite");
+80107a82:	83 ec 0c             	sub    $0xc,%esp
+80107a85:	68 5a b6 10 80       	push   $0x8010b65a
+80107a8a:	e8 b1 22 00 00       	call   80109d40 <panic>
+80107a8f:	90                   	nop
+        }
+        return i == n ? n : -1;
+80107a90:	39 7d 10             	cmp    %edi,0x10(%ebp)
+80107a93:	74 05                	je     80107a9a <filewrite+0xba>
+        return -1;
+80107a95:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+    }
+    panic("filewrite: unknown file type");
+}
+80107a9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107a9d:	89 f8                	mov    %edi,%eax
+80107a9f:	5b                   	pop    %ebx
+80107aa0:	5e                   	pop    %esi
+80107aa1:	5f                   	pop    %edi
+80107aa2:	5d                   	pop    %ebp
+80107aa3:	c3                   	ret
+    panic("filewrite: unknown file type");
+80107aa4:	83 ec 0c             	sub    $0xc,%esp
+80107aa7:	68 75 b6 10 80       	push   $0x8010b675
+80107aac:	e8 8f 22 00 00       	call   80109d40 <panic>
+80107ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107abf:	90                   	nop
+
+80107ac0 <filestat>:
+
+// get metadata about file f
+int
+filestat(struct file *f, struct stat *st)
+{
+80107ac0:	55                   	push   %ebp
+80107ac1:	89 e5                	mov    %esp,%ebp
+80107ac3:	53                   	push   %ebx
+80107ac4:	83 ec 04             	sub    $0x4,%esp
+80107ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (f->type == FD_INODE) {
+80107aca:	83 3b 02             	cmpl   $0x2,(%ebx)
+80107acd:	75 31                	jne    80107b00 <filestat+0x40>
+        ilock(f->ip);
+80107acf:	83 ec 0c             	sub    $0xc,%esp
+80107ad2:	ff 73 10             	push   0x10(%ebx)
+80107ad5:	e8 b6 f1 ff ff       	call   80106c90 <ilock>
+        stati(f->ip, st);
+80107ada:	58                   	pop    %eax
+80107adb:	5a                   	pop    %edx
+80107adc:	ff 75 0c             	push   0xc(%ebp)
+80107adf:	ff 73 10             	push   0x10(%ebx)
+80107ae2:	e8 19 f9 ff ff       	call   80107400 <stati>
+        iunlock(f->ip);
+80107ae7:	59                   	pop    %ecx
+80107ae8:	ff 73 10             	push   0x10(%ebx)
+80107aeb:	e8 90 f2 ff ff       	call   80106d80 <iunlock>
+        return 0;
+    }
+    return -1;
+80107af0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        return 0;
+80107af3:	83 c4 10             	add    $0x10,%esp
+80107af6:	31 c0                	xor    %eax,%eax
+80107af8:	c9                   	leave
+80107af9:	c3                   	ret
+80107afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+80107b03:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107b08:	c9                   	leave
+80107b09:	c3                   	ret
+80107b0a:	66 90                	xchg   %ax,%ax
+80107b0c:	66 90                	xchg   %ax,%ax
+80107b0e:	66 90                	xchg   %ax,%ax
+
+80107b10 <kernel_fpu_begin.part.0>:
+}
+
+// allow kernel code to use fpu/sse registers until kernel_fpu_end().
+// returns 0, with nothing to undo, if the cpu has no sse2.
+int
+kernel_fpu_begin(void)
+80107b10:	55                   	push   %ebp
+80107b11:	89 e5                	mov    %esp,%ebp
+80107b13:	83 ec 08             	sub    $0x8,%esp
+    struct cpu *c;
+
+    if (!havesse2)
+        return 0;
+
+    pushcli();
+80107b16:	e8 e5 95 ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+80107b1b:	e8 c0 08 00 00       	call   801083e0 <mycpu>
+    if (c->kfpu)
+80107b20:	8b 88 b4 00 00 00    	mov    0xb4(%eax),%ecx
+80107b26:	85 c9                	test   %ecx,%ecx
+80107b28:	75 3d                	jne    80107b67 <kernel_fpu_begin.part.0+0x57>
+        panic("kernel_fpu_begin: nested");
+    c->kfpu = 1;
+80107b2a:	c7 80 b4 00 00 00 01 	movl   $0x1,0xb4(%eax)
+80107b31:	00 00 00 
+    if (c->fpuowner && (rcr0() & CR0_TS) == 0) {
+80107b34:	8b 90 b0 00 00 00    	mov    0xb0(%eax),%edx
+80107b3a:	85 d2                	test   %edx,%edx
+80107b3c:	74 16                	je     80107b54 <kernel_fpu_begin.part.0+0x44>
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107b3e:	0f 20 c2             	mov    %cr0,%edx
+80107b41:	83 e2 08             	and    $0x8,%edx
+80107b44:	75 0e                	jne    80107b54 <kernel_fpu_begin.part.0+0x44>
+    asm volatile("clts");
+80107b46:	0f 06                	clts
+        // the owner is running and may have changed the registers
+        clts();
+        fxsave(&c->fpuowner->fpu);
+80107b48:	8b 88 b0 00 00 00    	mov    0xb0(%eax),%ecx
+80107b4e:	8d 51 40             	lea    0x40(%ecx),%edx
+    asm volatile("fxsave (%0)" : : "r" (area) : "memory");
+80107b51:	0f ae 02             	fxsave (%edx)
+    }
+    c->fpuowner = 0;    // about to be clobbered
+80107b54:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80107b5b:	00 00 00 
+    asm volatile("clts");
+80107b5e:	0f 06                	clts
+    clts();
+    return 1;
+}
+80107b60:	c9                   	leave
+80107b61:	b8 01 00 00 00       	mov    $0x1,%eax
+80107b66:	c3                   	ret
+        panic("kernel_fpu_begin: nested");
+80107b67:	83 ec 0c             	sub    $0xc,%esp
+80107b6a:	68 92 b6 10 80       	push   $0x8010b692
+80107b6f:	e8 cc 21 00 00       	call   80109d40 <panic>
+80107b74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b7f:	90                   	nop
+
+80107b80 <fpuinit>:
+{
+80107b80:	55                   	push   %ebp
+static inline void
+cpuinfo(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+    uint eax, ebx, ecx, edx;
+
+    asm volatile("cpuid" :
+80107b81:	b8 01 00 00 00       	mov    $0x1,%eax
+80107b86:	31 c9                	xor    %ecx,%ecx
+80107b88:	89 e5                	mov    %esp,%ebp
+80107b8a:	53                   	push   %ebx
+80107b8b:	83 ec 04             	sub    $0x4,%esp
+80107b8e:	0f a2                	cpuid
+    havefxsr = (edx & CPUID_FXSR) != 0;
+80107b90:	31 c0                	xor    %eax,%eax
+80107b92:	f7 c2 00 00 00 01    	test   $0x1000000,%edx
+80107b98:	0f 95 c0             	setne  %al
+80107b9b:	a3 b4 16 1c 80       	mov    %eax,0x801c16b4
+    havesse2 = havefxsr && (edx & CPUID_SSE2) != 0;
+80107ba0:	74 46                	je     80107be8 <fpuinit+0x68>
+80107ba2:	c1 ea 1a             	shr    $0x1a,%edx
+80107ba5:	83 e2 01             	and    $0x1,%edx
+80107ba8:	89 15 b0 16 1c 80    	mov    %edx,0x801c16b0
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107bae:	0f 20 c0             	mov    %cr0,%eax
+    lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE);
+80107bb1:	83 e0 d9             	and    $0xffffffd9,%eax
+80107bb4:	83 c8 22             	or     $0x22,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107bb7:	0f 22 c0             	mov    %eax,%cr0
+    asm volatile("movl %%cr4,%0" : "=r" (val));
+80107bba:	0f 20 e0             	mov    %cr4,%eax
+    lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+80107bbd:	80 cc 06             	or     $0x6,%ah
+    asm volatile("movl %0,%%cr4" : : "r" (val));
+80107bc0:	0f 22 e0             	mov    %eax,%cr4
+    asm volatile("fninit");
+80107bc3:	db e3                	fninit
+    mycpu()->fpuowner = 0;
+80107bc5:	e8 16 08 00 00       	call   801083e0 <mycpu>
+80107bca:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80107bd1:	00 00 00 
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107bd4:	0f 20 c0             	mov    %cr0,%eax
+    lcr0(rcr0() | CR0_TS);
+80107bd7:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107bda:	0f 22 c0             	mov    %eax,%cr0
+}
+80107bdd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107be0:	c9                   	leave
+80107be1:	c3                   	ret
+80107be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    havesse2 = havefxsr && (edx & CPUID_SSE2) != 0;
+80107be8:	c7 05 b0 16 1c 80 00 	movl   $0x0,0x801c16b0
+80107bef:	00 00 00 
+}
+80107bf2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107bf5:	c9                   	leave
+80107bf6:	c3                   	ret
+80107bf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bfe:	66 90                	xchg   %ax,%ax
+
+80107c00 <fpuinitstate>:
+{
+80107c00:	55                   	push   %ebp
+80107c01:	89 e5                	mov    %esp,%ebp
+80107c03:	53                   	push   %ebx
+80107c04:	83 ec 08             	sub    $0x8,%esp
+80107c07:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    memset(&p->fpu, 0, sizeof(p->fpu));
+80107c0a:	68 00 02 00 00       	push   $0x200
+80107c0f:	8d 43 40             	lea    0x40(%ebx),%eax
+80107c12:	6a 00                	push   $0x0
+80107c14:	50                   	push   %eax
+80107c15:	e8 26 84 ff ff       	call   80100040 <memset>
+    *(ushort*)&p->fpu.fxsave[0] = 0x37F;    // fcw
+80107c1a:	b8 7f 03 00 00       	mov    $0x37f,%eax
+    *(uint*)&p->fpu.fxsave[24] = 0x1F80;    // mxcsr
+80107c1f:	c7 43 58 80 1f 00 00 	movl   $0x1f80,0x58(%ebx)
+}
+80107c26:	83 c4 10             	add    $0x10,%esp
+    *(ushort*)&p->fpu.fxsave[0] = 0x37F;    // fcw
+80107c29:	66 89 43 40          	mov    %ax,0x40(%ebx)
+    p->fpucpu = 0;
+80107c2d:	c7 83 40 02 00 00 00 	movl   $0x0,0x240(%ebx)
+80107c34:	00 00 00 
+}
+80107c37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107c3a:	c9                   	leave
+80107c3b:	c3                   	ret
+80107c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107c40 <fpuenter>:
+{
+80107c40:	55                   	push   %ebp
+80107c41:	89 e5                	mov    %esp,%ebp
+80107c43:	83 ec 08             	sub    $0x8,%esp
+    struct cpu *c = mycpu();
+80107c46:	e8 95 07 00 00       	call   801083e0 <mycpu>
+    if (!havefxsr)
+80107c4b:	8b 15 b4 16 1c 80    	mov    0x801c16b4,%edx
+80107c51:	85 d2                	test   %edx,%edx
+80107c53:	74 14                	je     80107c69 <fpuenter+0x29>
+    if (c->fpuowner == p && p->fpucpu == c)
+80107c55:	8b 55 08             	mov    0x8(%ebp),%edx
+80107c58:	39 90 b0 00 00 00    	cmp    %edx,0xb0(%eax)
+80107c5e:	74 10                	je     80107c70 <fpuenter+0x30>
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107c60:	0f 20 c0             	mov    %cr0,%eax
+        lcr0(rcr0() | CR0_TS);
+80107c63:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107c66:	0f 22 c0             	mov    %eax,%cr0
+}
+80107c69:	c9                   	leave
+80107c6a:	c3                   	ret
+80107c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107c6f:	90                   	nop
+    if (c->fpuowner == p && p->fpucpu == c)
+80107c70:	39 82 40 02 00 00    	cmp    %eax,0x240(%edx)
+80107c76:	75 e8                	jne    80107c60 <fpuenter+0x20>
+    asm volatile("clts");
+80107c78:	0f 06                	clts
+}
+80107c7a:	c9                   	leave
+80107c7b:	c3                   	ret
+80107c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107c80 <fpuleave>:
+{
+80107c80:	55                   	push   %ebp
+80107c81:	89 e5                	mov    %esp,%ebp
+80107c83:	83 ec 08             	sub    $0x8,%esp
+    struct cpu *c = mycpu();
+80107c86:	e8 55 07 00 00       	call   801083e0 <mycpu>
+    if (!havefxsr)
+80107c8b:	8b 15 b4 16 1c 80    	mov    0x801c16b4,%edx
+80107c91:	85 d2                	test   %edx,%edx
+80107c93:	74 14                	je     80107ca9 <fpuleave+0x29>
+    if (c->fpuowner == p && (rcr0() & CR0_TS) == 0) {
+80107c95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107c98:	39 88 b0 00 00 00    	cmp    %ecx,0xb0(%eax)
+80107c9e:	74 10                	je     80107cb0 <fpuleave+0x30>
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107ca0:	0f 20 c0             	mov    %cr0,%eax
+    lcr0(rcr0() | CR0_TS);
+80107ca3:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107ca6:	0f 22 c0             	mov    %eax,%cr0
+}
+80107ca9:	c9                   	leave
+80107caa:	c3                   	ret
+80107cab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107caf:	90                   	nop
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107cb0:	0f 20 c2             	mov    %cr0,%edx
+    if (c->fpuowner == p && (rcr0() & CR0_TS) == 0) {
+80107cb3:	83 e2 08             	and    $0x8,%edx
+80107cb6:	75 e8                	jne    80107ca0 <fpuleave+0x20>
+        fxsave(&p->fpu);
+80107cb8:	89 ca                	mov    %ecx,%edx
+80107cba:	83 c2 40             	add    $0x40,%edx
+    asm volatile("fxsave (%0)" : : "r" (area) : "memory");
+80107cbd:	0f ae 02             	fxsave (%edx)
+        p->fpucpu = c;
+80107cc0:	8b 55 08             	mov    0x8(%ebp),%edx
+80107cc3:	89 82 40 02 00 00    	mov    %eax,0x240(%edx)
+80107cc9:	eb d5                	jmp    80107ca0 <fpuleave+0x20>
+80107ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ccf:	90                   	nop
+
+80107cd0 <fputrap>:
+{
+80107cd0:	55                   	push   %ebp
+80107cd1:	89 e5                	mov    %esp,%ebp
+80107cd3:	83 ec 08             	sub    $0x8,%esp
+    if ((tf->cs & 3) != DPL_USER)
+80107cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+80107cd9:	0f b7 40 3c          	movzwl 0x3c(%eax),%eax
+80107cdd:	83 e0 03             	and    $0x3,%eax
+80107ce0:	66 83 f8 03          	cmp    $0x3,%ax
+80107ce4:	75 44                	jne    80107d2a <fputrap+0x5a>
+    pushcli();
+80107ce6:	e8 15 94 ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+80107ceb:	e8 f0 06 00 00       	call   801083e0 <mycpu>
+    p = c->proc;
+80107cf0:	8b 90 ac 00 00 00    	mov    0xac(%eax),%edx
+    asm volatile("clts");
+80107cf6:	0f 06                	clts
+    if (c->fpuowner != p || p->fpucpu != c) {
+80107cf8:	39 90 b0 00 00 00    	cmp    %edx,0xb0(%eax)
+80107cfe:	74 20                	je     80107d20 <fputrap+0x50>
+        fxrstor(&p->fpu);
+80107d00:	8d 4a 40             	lea    0x40(%edx),%ecx
+    asm volatile("fxrstor (%0)" : : "r" (area) : "memory");
+80107d03:	0f ae 09             	fxrstor (%ecx)
+        c->fpuowner = p;
+80107d06:	89 90 b0 00 00 00    	mov    %edx,0xb0(%eax)
+        p->fpucpu = c;
+80107d0c:	89 82 40 02 00 00    	mov    %eax,0x240(%edx)
+}
+80107d12:	c9                   	leave
+    popcli();
+80107d13:	e9 38 94 ff ff       	jmp    80101150 <popcli>
+80107d18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d1f:	90                   	nop
+    if (c->fpuowner != p || p->fpucpu != c) {
+80107d20:	39 82 40 02 00 00    	cmp    %eax,0x240(%edx)
+80107d26:	75 d8                	jne    80107d00 <fputrap+0x30>
+80107d28:	eb e8                	jmp    80107d12 <fputrap+0x42>
+        panic("fputrap: fpu used in kernel outside kernel_fpu_begin");
+80107d2a:	83 ec 0c             	sub    $0xc,%esp
+80107d2d:	68 bc b6 10 80       	push   $0x8010b6bc
+80107d32:	e8 09 20 00 00       	call   80109d40 <panic>
+80107d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d3e:	66 90                	xchg   %ax,%ax
+
+80107d40 <kernel_fpu_begin>:
+    if (!havesse2)
+80107d40:	a1 b0 16 1c 80       	mov    0x801c16b0,%eax
+80107d45:	85 c0                	test   %eax,%eax
+80107d47:	75 07                	jne    80107d50 <kernel_fpu_begin+0x10>
+}
+80107d49:	31 c0                	xor    %eax,%eax
+80107d4b:	c3                   	ret
+80107d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d50:	e9 bb fd ff ff       	jmp    80107b10 <kernel_fpu_begin.part.0>
+80107d55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107d60 <kernel_fpu_end>:
+
+void
+kernel_fpu_end(void)
+{
+80107d60:	55                   	push   %ebp
+80107d61:	89 e5                	mov    %esp,%ebp
+80107d63:	83 ec 08             	sub    $0x8,%esp
+    struct cpu *c = mycpu();
+80107d66:	e8 75 06 00 00       	call   801083e0 <mycpu>
+
+    if (!c->kfpu)
+80107d6b:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+80107d71:	85 d2                	test   %edx,%edx
+80107d73:	74 19                	je     80107d8e <kernel_fpu_end+0x2e>
+        panic("kernel_fpu_end");
+    c->kfpu = 0;
+80107d75:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+80107d7c:	00 00 00 
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107d7f:	0f 20 c0             	mov    %cr0,%eax
+    lcr0(rcr0() | CR0_TS);
+80107d82:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107d85:	0f 22 c0             	mov    %eax,%cr0
+    popcli();
+}
+80107d88:	c9                   	leave
+    popcli();
+80107d89:	e9 c2 93 ff ff       	jmp    80101150 <popcli>
+        panic("kernel_fpu_end");
+80107d8e:	83 ec 0c             	sub    $0xc,%esp
+80107d91:	68 ab b6 10 80       	push   $0x8010b6ab
+80107d96:	e8 a5 1f 00 00       	call   80109d40 <panic>
+80107d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107d9f:	90                   	nop
+
+80107da0 <ssememmove>:
+
+// copy n bytes, 64 at a time through the sse registers where that pays off.
+// the regions must not overlap.
+void*
+ssememmove(void *dst, const void *src, uint n)
+{
+80107da0:	55                   	push   %ebp
+80107da1:	89 e5                	mov    %esp,%ebp
+80107da3:	57                   	push   %edi
+80107da4:	56                   	push   %esi
+80107da5:	53                   	push   %ebx
+80107da6:	83 ec 1c             	sub    $0x1c,%esp
+80107da9:	8b 75 10             	mov    0x10(%ebp),%esi
+80107dac:	8b 7d 08             	mov    0x8(%ebp),%edi
+80107daf:	8b 55 0c             	mov    0xc(%ebp),%edx
+    char *d = dst;
+    const char *s = src;
+
+    if (n < 256 || !kernel_fpu_begin())
+80107db2:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+80107db8:	76 0a                	jbe    80107dc4 <ssememmove+0x24>
+    if (!havesse2)
+80107dba:	8b 0d b0 16 1c 80    	mov    0x801c16b0,%ecx
+80107dc0:	85 c9                	test   %ecx,%ecx
+80107dc2:	75 1c                	jne    80107de0 <ssememmove+0x40>
+        return memmove(dst, src, n);
+80107dc4:	89 75 10             	mov    %esi,0x10(%ebp)
+80107dc7:	89 55 0c             	mov    %edx,0xc(%ebp)
+80107dca:	89 7d 08             	mov    %edi,0x8(%ebp)
+    }
+    kernel_fpu_end();
+    if (n > 0)
+        memmove(d, s, n);
+    return dst;
+}
+80107dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107dd0:	5b                   	pop    %ebx
+80107dd1:	5e                   	pop    %esi
+80107dd2:	5f                   	pop    %edi
+80107dd3:	5d                   	pop    %ebp
+        return memmove(dst, src, n);
+80107dd4:	e9 f7 82 ff ff       	jmp    801000d0 <memmove>
+80107dd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107de0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107de3:	e8 28 fd ff ff       	call   80107b10 <kernel_fpu_begin.part.0>
+    if (n < 256 || !kernel_fpu_begin())
+80107de8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107deb:	85 c0                	test   %eax,%eax
+80107ded:	74 d5                	je     80107dc4 <ssememmove+0x24>
+80107def:	8d 46 c0             	lea    -0x40(%esi),%eax
+    char *d = dst;
+80107df2:	89 fb                	mov    %edi,%ebx
+80107df4:	83 e0 c0             	and    $0xffffffc0,%eax
+80107df7:	83 c0 40             	add    $0x40,%eax
+80107dfa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107dfd:	8d 0c 07             	lea    (%edi,%eax,1),%ecx
+    const char *s = src;
+80107e00:	89 d0                	mov    %edx,%eax
+80107e02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        asm volatile(
+80107e08:	f3 0f 6f 00          	movdqu (%eax),%xmm0
+80107e0c:	f3 0f 6f 48 10       	movdqu 0x10(%eax),%xmm1
+80107e11:	f3 0f 6f 50 20       	movdqu 0x20(%eax),%xmm2
+80107e16:	f3 0f 6f 58 30       	movdqu 0x30(%eax),%xmm3
+80107e1b:	f3 0f 7f 03          	movdqu %xmm0,(%ebx)
+80107e1f:	f3 0f 7f 4b 10       	movdqu %xmm1,0x10(%ebx)
+80107e24:	f3 0f 7f 53 20       	movdqu %xmm2,0x20(%ebx)
+80107e29:	f3 0f 7f 5b 30       	movdqu %xmm3,0x30(%ebx)
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+80107e2e:	83 c3 40             	add    $0x40,%ebx
+80107e31:	83 c0 40             	add    $0x40,%eax
+80107e34:	39 cb                	cmp    %ecx,%ebx
+80107e36:	75 d0                	jne    80107e08 <ssememmove+0x68>
+80107e38:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80107e3b:	83 e6 3f             	and    $0x3f,%esi
+    struct cpu *c = mycpu();
+80107e3e:	e8 9d 05 00 00       	call   801083e0 <mycpu>
+    if (!c->kfpu)
+80107e43:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+80107e49:	85 d2                	test   %edx,%edx
+80107e4b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107e4e:	74 45                	je     80107e95 <ssememmove+0xf5>
+80107e50:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    c->kfpu = 0;
+80107e53:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+80107e5a:	00 00 00 
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107e5d:	0f 20 c0             	mov    %cr0,%eax
+    lcr0(rcr0() | CR0_TS);
+80107e60:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107e63:	0f 22 c0             	mov    %eax,%cr0
+    popcli();
+80107e66:	e8 e5 92 ff ff       	call   80101150 <popcli>
+    if (n > 0)
+80107e6b:	85 f6                	test   %esi,%esi
+80107e6d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80107e70:	75 0e                	jne    80107e80 <ssememmove+0xe0>
+}
+80107e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107e75:	89 f8                	mov    %edi,%eax
+80107e77:	5b                   	pop    %ebx
+80107e78:	5e                   	pop    %esi
+80107e79:	5f                   	pop    %edi
+80107e7a:	5d                   	pop    %ebp
+80107e7b:	c3                   	ret
+80107e7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        memmove(d, s, n);
+80107e80:	83 ec 04             	sub    $0x4,%esp
+80107e83:	56                   	push   %esi
+    for (; n >= 64; n -= 64, d += 64, s += 64) {
+80107e84:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80107e87:	01 c2                	add    %eax,%edx
+        memmove(d, s, n);
+80107e89:	52                   	push   %edx
+80107e8a:	53                   	push   %ebx
+80107e8b:	e8 40 82 ff ff       	call   801000d0 <memmove>
+80107e90:	83 c4 10             	add    $0x10,%esp
+80107e93:	eb dd                	jmp    80107e72 <ssememmove+0xd2>
+        panic("kernel_fpu_end");
+80107e95:	83 ec 0c             	sub    $0xc,%esp
+80107e98:	68 ab b6 10 80       	push   $0x8010b6ab
+80107e9d:	e8 9e 1e 00 00       	call   80109d40 <panic>
+80107ea2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ea9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107eb0 <pagezero>:
+
+// zero a page with non-temporal stores, which keep
+// a page nobody has touched yet out of the cache.
+void
+pagezero(void *pg)
+{
+80107eb0:	55                   	push   %ebp
+80107eb1:	89 e5                	mov    %esp,%ebp
+80107eb3:	53                   	push   %ebx
+80107eb4:	83 ec 04             	sub    $0x4,%esp
+    if (!havesse2)
+80107eb7:	8b 0d b0 16 1c 80    	mov    0x801c16b0,%ecx
+{
+80107ebd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (!havesse2)
+80107ec0:	85 c9                	test   %ecx,%ecx
+80107ec2:	75 1c                	jne    80107ee0 <pagezero+0x30>
+    char *p = pg, *e = p + PGSIZE;
+
+    if (!kernel_fpu_begin()) {
+        memset(pg, 0, PGSIZE);
+80107ec4:	83 ec 04             	sub    $0x4,%esp
+80107ec7:	68 00 10 00 00       	push   $0x1000
+80107ecc:	6a 00                	push   $0x0
+80107ece:	53                   	push   %ebx
+80107ecf:	e8 6c 81 ff ff       	call   80100040 <memset>
+                "movntdq %%xmm0, 48(%0)\n"
+                : : "r" (p) : "memory");
+    }
+    asm volatile("sfence" ::: "memory");
+    kernel_fpu_end();
+}
+80107ed4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        return;
+80107ed7:	83 c4 10             	add    $0x10,%esp
+}
+80107eda:	c9                   	leave
+80107edb:	c3                   	ret
+80107edc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ee0:	e8 2b fc ff ff       	call   80107b10 <kernel_fpu_begin.part.0>
+    if (!kernel_fpu_begin()) {
+80107ee5:	85 c0                	test   %eax,%eax
+80107ee7:	74 db                	je     80107ec4 <pagezero+0x14>
+    asm volatile("pxor %%xmm0, %%xmm0" : : );
+80107ee9:	66 0f ef c0          	pxor   %xmm0,%xmm0
+    for (; p < e; p += 64) {
+80107eed:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+80107ef3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ef7:	90                   	nop
+        asm volatile(
+80107ef8:	66 0f e7 03          	movntdq %xmm0,(%ebx)
+80107efc:	66 0f e7 43 10       	movntdq %xmm0,0x10(%ebx)
+80107f01:	66 0f e7 43 20       	movntdq %xmm0,0x20(%ebx)
+80107f06:	66 0f e7 43 30       	movntdq %xmm0,0x30(%ebx)
+    for (; p < e; p += 64) {
+80107f0b:	83 c3 40             	add    $0x40,%ebx
+80107f0e:	39 d8                	cmp    %ebx,%eax
+80107f10:	75 e6                	jne    80107ef8 <pagezero+0x48>
+    asm volatile("sfence" ::: "memory");
+80107f12:	0f ae f8             	sfence
+    struct cpu *c = mycpu();
+80107f15:	e8 c6 04 00 00       	call   801083e0 <mycpu>
+    if (!c->kfpu)
+80107f1a:	8b 90 b4 00 00 00    	mov    0xb4(%eax),%edx
+80107f20:	85 d2                	test   %edx,%edx
+80107f22:	74 1c                	je     80107f40 <pagezero+0x90>
+    c->kfpu = 0;
+80107f24:	c7 80 b4 00 00 00 00 	movl   $0x0,0xb4(%eax)
+80107f2b:	00 00 00 
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+80107f2e:	0f 20 c0             	mov    %cr0,%eax
+    lcr0(rcr0() | CR0_TS);
+80107f31:	83 c8 08             	or     $0x8,%eax
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+80107f34:	0f 22 c0             	mov    %eax,%cr0
+}
+80107f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f3a:	c9                   	leave
+    popcli();
+80107f3b:	e9 10 92 ff ff       	jmp    80101150 <popcli>
+        panic("kernel_fpu_end");
+80107f40:	83 ec 0c             	sub    $0xc,%esp
+80107f43:	68 ab b6 10 80       	push   $0x8010b6ab
+80107f48:	e8 f3 1d 00 00       	call   80109d40 <panic>
+80107f4d:	66 90                	xchg   %ax,%ax
+80107f4f:	90                   	nop
+
+80107f50 <kfree>:
+}
+
+// free a whole page
+void
+kfree(char *v)
+{
+80107f50:	55                   	push   %ebp
+80107f51:	89 e5                	mov    %esp,%ebp
+80107f53:	53                   	push   %ebx
+80107f54:	83 ec 14             	sub    $0x14,%esp
+80107f57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    struct run *r;
+    struct mcsnode me;
+
+    // v should be the start address f a page
+    if ((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80107f5a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80107f60:	0f 85 9f 00 00 00    	jne    80108005 <kfree+0xb5>
+80107f66:	81 fb 90 e9 1c 80    	cmp    $0x801ce990,%ebx
+80107f6c:	0f 82 93 00 00 00    	jb     80108005 <kfree+0xb5>
+80107f72:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80107f78:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80107f7d:	0f 87 82 00 00 00    	ja     80108005 <kfree+0xb5>
+        panic("kfree");
+
+    memset(v, 5, PGSIZE);   // fill with junk
+80107f83:	83 ec 04             	sub    $0x4,%esp
+80107f86:	68 00 10 00 00       	push   $0x1000
+80107f8b:	6a 05                	push   $0x5
+80107f8d:	53                   	push   %ebx
+80107f8e:	e8 ad 80 ff ff       	call   80100040 <memset>
+
+    if(kmem.use_lock)
+80107f93:	8b 15 00 17 1c 80    	mov    0x801c1700,%edx
+80107f99:	83 c4 10             	add    $0x10,%esp
+80107f9c:	85 d2                	test   %edx,%edx
+80107f9e:	75 28                	jne    80107fc8 <kfree+0x78>
+        acquiremcs(&kmem.lock, &me);
+
+    r = (struct run*)v;
+    r->next = kmem.freelist;
+80107fa0:	a1 04 17 1c 80       	mov    0x801c1704,%eax
+80107fa5:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = r;
+    kmem.nfree++;
+
+    // not counted before kinit2(): mpinit() hasn't run, so cpuid() can't work yet.
+    if(kmem.use_lock) {
+80107fa7:	a1 00 17 1c 80       	mov    0x801c1700,%eax
+    kmem.nfree++;
+80107fac:	83 05 08 17 1c 80 01 	addl   $0x1,0x801c1708
+    kmem.freelist = r;
+80107fb3:	89 1d 04 17 1c 80    	mov    %ebx,0x801c1704
+    if(kmem.use_lock) {
+80107fb9:	85 c0                	test   %eax,%eax
+80107fbb:	75 23                	jne    80107fe0 <kfree+0x90>
+        releasemcs(&kmem.lock, &me);
+        kstatinc(KS_KFREE);
+    }
+}
+80107fbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107fc0:	c9                   	leave
+80107fc1:	c3                   	ret
+80107fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        acquiremcs(&kmem.lock, &me);
+80107fc8:	83 ec 08             	sub    $0x8,%esp
+80107fcb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107fce:	50                   	push   %eax
+80107fcf:	68 c0 16 1c 80       	push   $0x801c16c0
+80107fd4:	e8 77 93 ff ff       	call   80101350 <acquiremcs>
+80107fd9:	83 c4 10             	add    $0x10,%esp
+80107fdc:	eb c2                	jmp    80107fa0 <kfree+0x50>
+80107fde:	66 90                	xchg   %ax,%ax
+        releasemcs(&kmem.lock, &me);
+80107fe0:	83 ec 08             	sub    $0x8,%esp
+80107fe3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107fe6:	50                   	push   %eax
+80107fe7:	68 c0 16 1c 80       	push   $0x801c16c0
+80107fec:	e8 2f 92 ff ff       	call   80101220 <releasemcs>
+        kstatinc(KS_KFREE);
+80107ff1:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+80107ff8:	e8 d3 e4 ff ff       	call   801064d0 <kstatinc>
+}
+80107ffd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+        kstatinc(KS_KFREE);
+80108000:	83 c4 10             	add    $0x10,%esp
+}
+80108003:	c9                   	leave
+80108004:	c3                   	ret
+        panic("kfree");
+80108005:	83 ec 0c             	sub    $0xc,%esp
+80108008:	68 72 b8 10 80       	push   $0x8010b872
+8010800d:	e8 2e 1d 00 00       	call   80109d40 <panic>
+80108012:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108020 <freerange>:
+{
+80108020:	55                   	push   %ebp
+80108021:	89 e5                	mov    %esp,%ebp
+80108023:	56                   	push   %esi
+80108024:	53                   	push   %ebx
+    p = (char*)PGROUNDUP((uint)vstart);
+80108025:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80108028:	8b 75 0c             	mov    0xc(%ebp),%esi
+    p = (char*)PGROUNDUP((uint)vstart);
+8010802b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80108031:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108037:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010803d:	39 de                	cmp    %ebx,%esi
+8010803f:	72 23                	jb     80108064 <freerange+0x44>
+80108041:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        kfree(p);
+80108048:	83 ec 0c             	sub    $0xc,%esp
+8010804b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108051:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+        kfree(p);
+80108057:	50                   	push   %eax
+80108058:	e8 f3 fe ff ff       	call   80107f50 <kfree>
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+8010805d:	83 c4 10             	add    $0x10,%esp
+80108060:	39 de                	cmp    %ebx,%esi
+80108062:	73 e4                	jae    80108048 <freerange+0x28>
+}
+80108064:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108067:	5b                   	pop    %ebx
+80108068:	5e                   	pop    %esi
+80108069:	5d                   	pop    %ebp
+8010806a:	c3                   	ret
+8010806b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010806f:	90                   	nop
+
+80108070 <kinit2>:
+{
+80108070:	55                   	push   %ebp
+80108071:	89 e5                	mov    %esp,%ebp
+80108073:	56                   	push   %esi
+80108074:	53                   	push   %ebx
+    p = (char*)PGROUNDUP((uint)vstart);
+80108075:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80108078:	8b 75 0c             	mov    0xc(%ebp),%esi
+    p = (char*)PGROUNDUP((uint)vstart);
+8010807b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80108081:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108087:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010808d:	39 de                	cmp    %ebx,%esi
+8010808f:	72 23                	jb     801080b4 <kinit2+0x44>
+80108091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        kfree(p);
+80108098:	83 ec 0c             	sub    $0xc,%esp
+8010809b:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+801080a1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+        kfree(p);
+801080a7:	50                   	push   %eax
+801080a8:	e8 a3 fe ff ff       	call   80107f50 <kfree>
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+801080ad:	83 c4 10             	add    $0x10,%esp
+801080b0:	39 de                	cmp    %ebx,%esi
+801080b2:	73 e4                	jae    80108098 <kinit2+0x28>
+    kmem.use_lock = 1;
+801080b4:	c7 05 00 17 1c 80 01 	movl   $0x1,0x801c1700
+801080bb:	00 00 00 
+}
+801080be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801080c1:	5b                   	pop    %ebx
+801080c2:	5e                   	pop    %esi
+801080c3:	5d                   	pop    %ebp
+801080c4:	c3                   	ret
+801080c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801080cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801080d0 <kinit1>:
+{
+801080d0:	55                   	push   %ebp
+801080d1:	89 e5                	mov    %esp,%ebp
+801080d3:	56                   	push   %esi
+801080d4:	53                   	push   %ebx
+801080d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+    initmcslock(&kmem.lock, "kmem");
+801080d8:	83 ec 08             	sub    $0x8,%esp
+801080db:	68 f1 b6 10 80       	push   $0x8010b6f1
+801080e0:	68 c0 16 1c 80       	push   $0x801c16c0
+801080e5:	e8 86 8f ff ff       	call   80101070 <initmcslock>
+    p = (char*)PGROUNDUP((uint)vstart);
+801080ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+801080ed:	83 c4 10             	add    $0x10,%esp
+    kmem.use_lock = 0;
+801080f0:	c7 05 00 17 1c 80 00 	movl   $0x0,0x801c1700
+801080f7:	00 00 00 
+    p = (char*)PGROUNDUP((uint)vstart);
+801080fa:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80108100:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108106:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010810c:	39 de                	cmp    %ebx,%esi
+8010810e:	72 1c                	jb     8010812c <kinit1+0x5c>
+        kfree(p);
+80108110:	83 ec 0c             	sub    $0xc,%esp
+80108113:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108119:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+        kfree(p);
+8010811f:	50                   	push   %eax
+80108120:	e8 2b fe ff ff       	call   80107f50 <kfree>
+    for (; p + PGSIZE <= (char *)vend; p += PGSIZE) {
+80108125:	83 c4 10             	add    $0x10,%esp
+80108128:	39 de                	cmp    %ebx,%esi
+8010812a:	73 e4                	jae    80108110 <kinit1+0x40>
+}
+8010812c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010812f:	5b                   	pop    %ebx
+80108130:	5e                   	pop    %esi
+80108131:	5d                   	pop    %ebp
+80108132:	c3                   	ret
+80108133:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010813a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108140 <kalloc>:
+
+// allocate one page of physical memory
+char *
+kalloc(void)
+{
+80108140:	55                   	push   %ebp
+80108141:	89 e5                	mov    %esp,%ebp
+80108143:	56                   	push   %esi
+80108144:	53                   	push   %ebx
+    struct run *r;
+    struct mcsnode me;
+
+again:
+    if(kmem.use_lock)
+        acquiremcs(&kmem.lock, &me);
+80108145:	8d 75 f0             	lea    -0x10(%ebp),%esi
+{
+80108148:	83 ec 10             	sub    $0x10,%esp
+8010814b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010814f:	90                   	nop
+    if(kmem.use_lock)
+80108150:	8b 0d 00 17 1c 80    	mov    0x801c1700,%ecx
+80108156:	85 c9                	test   %ecx,%ecx
+80108158:	75 26                	jne    80108180 <kalloc+0x40>
+
+    r = kmem.freelist;
+8010815a:	8b 1d 04 17 1c 80    	mov    0x801c1704,%ebx
+    if (r) {
+80108160:	85 db                	test   %ebx,%ebx
+80108162:	74 67                	je     801081cb <kalloc+0x8b>
+        kmem.freelist = r->next;
+80108164:	8b 03                	mov    (%ebx),%eax
+        kmem.nfree--;
+80108166:	83 2d 08 17 1c 80 01 	subl   $0x1,0x801c1708
+        kmem.freelist = r->next;
+8010816d:	a3 04 17 1c 80       	mov    %eax,0x801c1704
+            if (bshrink(BSHRINK))
+                goto again;
+        }
+    }
+    return (char*)r;
+}
+80108172:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108175:	89 d8                	mov    %ebx,%eax
+80108177:	5b                   	pop    %ebx
+80108178:	5e                   	pop    %esi
+80108179:	5d                   	pop    %ebp
+8010817a:	c3                   	ret
+8010817b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010817f:	90                   	nop
+        acquiremcs(&kmem.lock, &me);
+80108180:	83 ec 08             	sub    $0x8,%esp
+80108183:	56                   	push   %esi
+80108184:	68 c0 16 1c 80       	push   $0x801c16c0
+80108189:	e8 c2 91 ff ff       	call   80101350 <acquiremcs>
+    r = kmem.freelist;
+8010818e:	8b 1d 04 17 1c 80    	mov    0x801c1704,%ebx
+    if (r) {
+80108194:	83 c4 10             	add    $0x10,%esp
+80108197:	85 db                	test   %ebx,%ebx
+80108199:	75 45                	jne    801081e0 <kalloc+0xa0>
+    if (kmem.use_lock) {
+8010819b:	8b 15 00 17 1c 80    	mov    0x801c1700,%edx
+801081a1:	85 d2                	test   %edx,%edx
+801081a3:	74 26                	je     801081cb <kalloc+0x8b>
+        releasemcs(&kmem.lock, &me);
+801081a5:	83 ec 08             	sub    $0x8,%esp
+801081a8:	56                   	push   %esi
+801081a9:	68 c0 16 1c 80       	push   $0x801c16c0
+801081ae:	e8 6d 90 ff ff       	call   80101220 <releasemcs>
+            logflushsoon();
+801081b3:	e8 28 de ff ff       	call   80105fe0 <logflushsoon>
+            if (bshrink(BSHRINK))
+801081b8:	c7 04 24 10 00 00 00 	movl   $0x10,(%esp)
+801081bf:	e8 1c cd ff ff       	call   80104ee0 <bshrink>
+801081c4:	83 c4 10             	add    $0x10,%esp
+801081c7:	85 c0                	test   %eax,%eax
+801081c9:	75 85                	jne    80108150 <kalloc+0x10>
+}
+801081cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+{
+801081ce:	31 db                	xor    %ebx,%ebx
+}
+801081d0:	89 d8                	mov    %ebx,%eax
+801081d2:	5b                   	pop    %ebx
+801081d3:	5e                   	pop    %esi
+801081d4:	5d                   	pop    %ebp
+801081d5:	c3                   	ret
+801081d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801081dd:	8d 76 00             	lea    0x0(%esi),%esi
+        kmem.freelist = r->next;
+801081e0:	8b 03                	mov    (%ebx),%eax
+        kmem.nfree--;
+801081e2:	83 2d 08 17 1c 80 01 	subl   $0x1,0x801c1708
+        kmem.freelist = r->next;
+801081e9:	a3 04 17 1c 80       	mov    %eax,0x801c1704
+    if (kmem.use_lock) {
+801081ee:	a1 00 17 1c 80       	mov    0x801c1700,%eax
+801081f3:	85 c0                	test   %eax,%eax
+801081f5:	0f 84 77 ff ff ff    	je     80108172 <kalloc+0x32>
+        releasemcs(&kmem.lock, &me);
+801081fb:	83 ec 08             	sub    $0x8,%esp
+801081fe:	56                   	push   %esi
+801081ff:	68 c0 16 1c 80       	push   $0x801c16c0
+80108204:	e8 17 90 ff ff       	call   80101220 <releasemcs>
+            kstatinc(KS_KALLOC);
+80108209:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+80108210:	e8 bb e2 ff ff       	call   801064d0 <kstatinc>
+80108215:	83 c4 10             	add    $0x10,%esp
+}
+80108218:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010821b:	89 d8                	mov    %ebx,%eax
+8010821d:	5b                   	pop    %ebx
+8010821e:	5e                   	pop    %esi
+8010821f:	5d                   	pop    %ebp
+80108220:	c3                   	ret
+80108221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108228:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010822f:	90                   	nop
+
+80108230 <kfreecount>:
+// number of free pages, for sizing caches; may be stale by the time it returns
+uint
+kfreecount(void)
+{
+    return kmem.nfree;
+80108230:	a1 08 17 1c 80       	mov    0x801c1708,%eax
+80108235:	c3                   	ret
+
+80108236 <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+80108236:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+8010823a:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+8010823e:	55                   	push   %ebp
+  pushl %ebx
+8010823f:	53                   	push   %ebx
+  pushl %esi
+80108240:	56                   	push   %esi
+  pushl %edi
+80108241:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80108242:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80108244:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+80108246:	5f                   	pop    %edi
+  popl %esi
+80108247:	5e                   	pop    %esi
+  popl %ebx
+80108248:	5b                   	pop    %ebx
+  popl %ebp
+80108249:	5d                   	pop    %ebp
+  ret
+8010824a:	c3                   	ret
+8010824b:	66 90                	xchg   %ax,%ax
+8010824d:	66 90                	xchg   %ax,%ax
+8010824f:	90                   	nop
+
+80108250 <runinitret>:
+
+// first scheduling of a runinit() process; skips forkret's
+// file system setup, which needs the real scheduler running.
+static void
+runinitret(void)
+{
+80108250:	55                   	push   %ebp
+80108251:	89 e5                	mov    %esp,%ebp
+80108253:	83 ec 14             	sub    $0x14,%esp
+    // still holding ptable.lock from runinit
+    release(&ptable.lock);
+80108256:	68 40 17 1c 80       	push   $0x801c1740
+8010825b:	e8 70 90 ff ff       	call   801012d0 <release>
+}
+80108260:	83 c4 10             	add    $0x10,%esp
+80108263:	c9                   	leave
+80108264:	c3                   	ret
+80108265:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010826c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108270 <allocproc>:
+{
+80108270:	55                   	push   %ebp
+80108271:	89 e5                	mov    %esp,%ebp
+80108273:	53                   	push   %ebx
+    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108274:	bb 40 18 1c 80       	mov    $0x801c1840,%ebx
+{
+80108279:	83 ec 10             	sub    $0x10,%esp
+    acquire(&ptable.lock);
+8010827c:	68 40 17 1c 80       	push   $0x801c1740
+80108281:	e8 2a 92 ff ff       	call   801014b0 <acquire>
+80108286:	83 c4 10             	add    $0x10,%esp
+80108289:	eb 17                	jmp    801082a2 <allocproc+0x32>
+8010828b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010828f:	90                   	nop
+    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108290:	81 c3 50 02 00 00    	add    $0x250,%ebx
+80108296:	81 fb 40 ac 1c 80    	cmp    $0x801cac40,%ebx
+8010829c:	0f 84 9e 00 00 00    	je     80108340 <allocproc+0xd0>
+        if (p->state == UNUSED)
+801082a2:	8b 43 0c             	mov    0xc(%ebx),%eax
+801082a5:	85 c0                	test   %eax,%eax
+801082a7:	75 e7                	jne    80108290 <allocproc+0x20>
+    acquireseq(&ptable.pidseq);
+801082a9:	83 ec 0c             	sub    $0xc,%esp
+    p->state = EMBRTO;
+801082ac:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+    acquireseq(&ptable.pidseq);
+801082b3:	68 c0 17 1c 80       	push   $0x801c17c0
+801082b8:	e8 93 9e ff ff       	call   80102150 <acquireseq>
+    p->pid = nextpid++;
+801082bd:	a1 24 c0 10 80       	mov    0x8010c024,%eax
+801082c2:	8d 50 01             	lea    0x1(%eax),%edx
+801082c5:	89 43 10             	mov    %eax,0x10(%ebx)
+801082c8:	89 15 24 c0 10 80    	mov    %edx,0x8010c024
+    releaseseq(&ptable.pidseq);
+801082ce:	c7 04 24 c0 17 1c 80 	movl   $0x801c17c0,(%esp)
+801082d5:	e8 a6 9e ff ff       	call   80102180 <releaseseq>
+    release(&ptable.lock);
+801082da:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+801082e1:	e8 ea 8f ff ff       	call   801012d0 <release>
+    if ((p->kstack = kalloc()) == 0) {
+801082e6:	e8 55 fe ff ff       	call   80108140 <kalloc>
+801082eb:	83 c4 10             	add    $0x10,%esp
+801082ee:	89 43 08             	mov    %eax,0x8(%ebx)
+801082f1:	85 c0                	test   %eax,%eax
+801082f3:	74 64                	je     80108359 <allocproc+0xe9>
+    sp -= sizeof *p->tf;
+801082f5:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+    memset(p->context, 0, sizeof *p->context);
+801082fb:	83 ec 04             	sub    $0x4,%esp
+    sp -= sizeof *p->context;
+801082fe:	05 9c 0f 00 00       	add    $0xf9c,%eax
+    sp -= sizeof *p->tf;
+80108303:	89 53 18             	mov    %edx,0x18(%ebx)
+    *(uint*)sp = (uint)trapret;
+80108306:	c7 40 14 dd 94 10 80 	movl   $0x801094dd,0x14(%eax)
+    p->context = (struct context*)sp;
+8010830d:	89 43 1c             	mov    %eax,0x1c(%ebx)
+    memset(p->context, 0, sizeof *p->context);
+80108310:	6a 14                	push   $0x14
+80108312:	6a 00                	push   $0x0
+80108314:	50                   	push   %eax
+80108315:	e8 26 7d ff ff       	call   80100040 <memset>
+    p->context->eip = (uint)forkret;
+8010831a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+8010831d:	c7 40 10 70 83 10 80 	movl   $0x80108370,0x10(%eax)
+    fpuinitstate(p);
+80108324:	89 1c 24             	mov    %ebx,(%esp)
+80108327:	e8 d4 f8 ff ff       	call   80107c00 <fpuinitstate>
+}
+8010832c:	89 d8                	mov    %ebx,%eax
+    return p;
+8010832e:	83 c4 10             	add    $0x10,%esp
+}
+80108331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108334:	c9                   	leave
+80108335:	c3                   	ret
+80108336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010833d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ptable.lock);
+80108340:	83 ec 0c             	sub    $0xc,%esp
+    return 0;
+80108343:	31 db                	xor    %ebx,%ebx
+    release(&ptable.lock);
+80108345:	68 40 17 1c 80       	push   $0x801c1740
+8010834a:	e8 81 8f ff ff       	call   801012d0 <release>
+    return 0;
+8010834f:	83 c4 10             	add    $0x10,%esp
+}
+80108352:	89 d8                	mov    %ebx,%eax
+80108354:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108357:	c9                   	leave
+80108358:	c3                   	ret
+        p->state = UNUSED;
+80108359:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    return 0;
+80108360:	31 db                	xor    %ebx,%ebx
+80108362:	eb ee                	jmp    80108352 <allocproc+0xe2>
+80108364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010836b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010836f:	90                   	nop
+
+80108370 <forkret>:
+
+// a fork child's very first scheduling by scheduler()
+// will swtch() here. "return" to user space
+void
+forkret(void)
+{
+80108370:	55                   	push   %ebp
+80108371:	89 e5                	mov    %esp,%ebp
+80108373:	83 ec 14             	sub    $0x14,%esp
+    static int first = 1;
+    // still holding ptable.lock from scheduler
+    release(&ptable.lock);
+80108376:	68 40 17 1c 80       	push   $0x801c1740
+8010837b:	e8 50 8f ff ff       	call   801012d0 <release>
+
+    if (first) {
+80108380:	a1 20 c0 10 80       	mov    0x8010c020,%eax
+80108385:	83 c4 10             	add    $0x10,%esp
+80108388:	85 c0                	test   %eax,%eax
+8010838a:	75 04                	jne    80108390 <forkret+0x20>
+//        bcachebench();  // scan resistance, 2Q vs strict lru
+//        blkpollbench(); // read latency, polled vs interrupt completion
+    }
+
+    // return to "caller", actually trapret (see allocproc)
+}
+8010838c:	c9                   	leave
+8010838d:	c3                   	ret
+8010838e:	66 90                	xchg   %ax,%ax
+        first = 0;
+80108390:	c7 05 20 c0 10 80 00 	movl   $0x0,0x8010c020
+80108397:	00 00 00 
+        initlog(ROOTDEV);
+8010839a:	83 ec 0c             	sub    $0xc,%esp
+8010839d:	6a 01                	push   $0x1
+8010839f:	e8 dc d7 ff ff       	call   80105b80 <initlog>
+}
+801083a4:	83 c4 10             	add    $0x10,%esp
+801083a7:	c9                   	leave
+801083a8:	c3                   	ret
+801083a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801083b0 <pinit>:
+{
+801083b0:	55                   	push   %ebp
+801083b1:	89 e5                	mov    %esp,%ebp
+801083b3:	83 ec 10             	sub    $0x10,%esp
+    initlock(&ptable.lock, "ptable");
+801083b6:	68 f6 b6 10 80       	push   $0x8010b6f6
+801083bb:	68 40 17 1c 80       	push   $0x801c1740
+801083c0:	e8 7b 8c ff ff       	call   80101040 <initlock>
+    initseqlock(&ptable.pidseq, "pidseq");
+801083c5:	58                   	pop    %eax
+801083c6:	5a                   	pop    %edx
+801083c7:	68 fd b6 10 80       	push   $0x8010b6fd
+801083cc:	68 c0 17 1c 80       	push   $0x801c17c0
+801083d1:	e8 4a 9d ff ff       	call   80102120 <initseqlock>
+}
+801083d6:	83 c4 10             	add    $0x10,%esp
+801083d9:	c9                   	leave
+801083da:	c3                   	ret
+801083db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801083df:	90                   	nop
+
+801083e0 <mycpu>:
+{
+801083e0:	55                   	push   %ebp
+801083e1:	89 e5                	mov    %esp,%ebp
+801083e3:	56                   	push   %esi
+801083e4:	53                   	push   %ebx
+    asm volatile("pushfl; popl %0" : "=r" (eflags));
+801083e5:	9c                   	pushf
+801083e6:	58                   	pop    %eax
+    if(readeflags() & FL_IF)
+801083e7:	f6 c4 02             	test   $0x2,%ah
+801083ea:	75 46                	jne    80108432 <mycpu+0x52>
+    apicid = lapicid();
+801083ec:	e8 cf 80 ff ff       	call   801004c0 <lapicid>
+    for (i = 0; i < ncpu; ++i) {
+801083f1:	8b 35 48 c6 18 80    	mov    0x8018c648,%esi
+801083f7:	85 f6                	test   %esi,%esi
+801083f9:	7e 2a                	jle    80108425 <mycpu+0x45>
+801083fb:	31 d2                	xor    %edx,%edx
+801083fd:	eb 08                	jmp    80108407 <mycpu+0x27>
+801083ff:	90                   	nop
+80108400:	83 c2 01             	add    $0x1,%edx
+80108403:	39 f2                	cmp    %esi,%edx
+80108405:	74 1e                	je     80108425 <mycpu+0x45>
+        if (cpus[i].apicid == apicid)
+80108407:	8d 0c 52             	lea    (%edx,%edx,2),%ecx
+8010840a:	c1 e1 06             	shl    $0x6,%ecx
+8010840d:	0f b6 99 80 c6 18 80 	movzbl -0x7fe73980(%ecx),%ebx
+80108414:	39 c3                	cmp    %eax,%ebx
+80108416:	75 e8                	jne    80108400 <mycpu+0x20>
+}
+80108418:	8d 65 f8             	lea    -0x8(%ebp),%esp
+            return &cpus[i];
+8010841b:	8d 81 80 c6 18 80    	lea    -0x7fe73980(%ecx),%eax
+}
+80108421:	5b                   	pop    %ebx
+80108422:	5e                   	pop    %esi
+80108423:	5d                   	pop    %ebp
+80108424:	c3                   	ret
+    panic("mycpu: unknown apicid\n");
+80108425:	83 ec 0c             	sub    $0xc,%esp
+80108428:	68 04 b7 10 80       	push   $0x8010b704
+8010842d:	e8 0e 19 00 00       	call   80109d40 <panic>
+        panic("mycpu: mycpu called with interrupts enabled\n");
+80108432:	83 ec 0c             	sub    $0xc,%esp
+80108435:	68 10 b8 10 80       	push   $0x8010b810
+8010843a:	e8 01 19 00 00       	call   80109d40 <panic>
+8010843f:	90                   	nop
+
+80108440 <cpuid>:
+cpuid() {
+80108440:	55                   	push   %ebp
+80108441:	89 e5                	mov    %esp,%ebp
+80108443:	83 ec 08             	sub    $0x8,%esp
+    return mycpu()-cpus;
+80108446:	e8 95 ff ff ff       	call   801083e0 <mycpu>
+}
+8010844b:	c9                   	leave
+    return mycpu()-cpus;
+8010844c:	2d 80 c6 18 80       	sub    $0x8018c680,%eax
+80108451:	c1 f8 06             	sar    $0x6,%eax
+80108454:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+}
+8010845a:	c3                   	ret
+8010845b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010845f:	90                   	nop
+
+80108460 <myproc>:
+{
+80108460:	55                   	push   %ebp
+80108461:	89 e5                	mov    %esp,%ebp
+80108463:	53                   	push   %ebx
+80108464:	83 ec 04             	sub    $0x4,%esp
+    pushcli();
+80108467:	e8 94 8c ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+8010846c:	e8 6f ff ff ff       	call   801083e0 <mycpu>
+    p = c->proc;
+80108471:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+    popcli();
+80108477:	e8 d4 8c ff ff       	call   80101150 <popcli>
+}
+8010847c:	89 d8                	mov    %ebx,%eax
+8010847e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108481:	c9                   	leave
+80108482:	c3                   	ret
+80108483:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010848a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108490 <scheduler>:
+{
+80108490:	55                   	push   %ebp
+80108491:	89 e5                	mov    %esp,%ebp
+80108493:	57                   	push   %edi
+80108494:	56                   	push   %esi
+80108495:	53                   	push   %ebx
+80108496:	83 ec 0c             	sub    $0xc,%esp
+    struct cpu *c = mycpu();
+80108499:	e8 42 ff ff ff       	call   801083e0 <mycpu>
+    c->proc = 0;
+8010849e:	c7 80 ac 00 00 00 00 	movl   $0x0,0xac(%eax)
+801084a5:	00 00 00 
+    struct cpu *c = mycpu();
+801084a8:	89 c6                	mov    %eax,%esi
+    c->proc = 0;
+801084aa:	8d 78 04             	lea    0x4(%eax),%edi
+801084ad:	8d 76 00             	lea    0x0(%esi),%esi
+    asm volatile("sti");
+801084b0:	fb                   	sti
+        rcuquiesce();
+801084b1:	e8 aa 98 ff ff       	call   80101d60 <rcuquiesce>
+        acquire(&ptable.lock);
+801084b6:	83 ec 0c             	sub    $0xc,%esp
+        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+801084b9:	bb 40 18 1c 80       	mov    $0x801c1840,%ebx
+        acquire(&ptable.lock);
+801084be:	68 40 17 1c 80       	push   $0x801c1740
+801084c3:	e8 e8 8f ff ff       	call   801014b0 <acquire>
+801084c8:	83 c4 10             	add    $0x10,%esp
+801084cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801084cf:	90                   	nop
+            if (p->state != RUNNABLE)
+801084d0:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+801084d4:	75 43                	jne    80108519 <scheduler+0x89>
+            switchuvm(p);
+801084d6:	83 ec 0c             	sub    $0xc,%esp
+            c->proc = p;
+801084d9:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+            switchuvm(p);
+801084df:	53                   	push   %ebx
+801084e0:	e8 db 08 00 00       	call   80108dc0 <switchuvm>
+            fpuenter(p);
+801084e5:	89 1c 24             	mov    %ebx,(%esp)
+801084e8:	e8 53 f7 ff ff       	call   80107c40 <fpuenter>
+            swtch(&(c->scheduler), p->context);
+801084ed:	58                   	pop    %eax
+801084ee:	5a                   	pop    %edx
+801084ef:	ff 73 1c             	push   0x1c(%ebx)
+801084f2:	57                   	push   %edi
+            p->state = RUNNING;
+801084f3:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+            swtch(&(c->scheduler), p->context);
+801084fa:	e8 37 fd ff ff       	call   80108236 <swtch>
+            fpuleave(p);
+801084ff:	89 1c 24             	mov    %ebx,(%esp)
+80108502:	e8 79 f7 ff ff       	call   80107c80 <fpuleave>
+            switchkvm();
+80108507:	e8 a4 08 00 00       	call   80108db0 <switchkvm>
+            c->proc = 0;
+8010850c:	83 c4 10             	add    $0x10,%esp
+8010850f:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+80108516:	00 00 00 
+        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
+80108519:	81 c3 50 02 00 00    	add    $0x250,%ebx
+8010851f:	81 fb 40 ac 1c 80    	cmp    $0x801cac40,%ebx
+80108525:	75 a9                	jne    801084d0 <scheduler+0x40>
+        cprintf("no proc runnable\n");
+80108527:	83 ec 0c             	sub    $0xc,%esp
+8010852a:	68 1b b7 10 80       	push   $0x8010b71b
+8010852f:	e8 8c 18 00 00       	call   80109dc0 <cprintf>
+        release(&ptable.lock);
+80108534:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+8010853b:	e8 90 8d ff ff       	call   801012d0 <release>
+        sti();
+80108540:	83 c4 10             	add    $0x10,%esp
+80108543:	e9 68 ff ff ff       	jmp    801084b0 <scheduler+0x20>
+80108548:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010854f:	90                   	nop
+
+80108550 <sched>:
+{
+80108550:	55                   	push   %ebp
+80108551:	89 e5                	mov    %esp,%ebp
+80108553:	56                   	push   %esi
+80108554:	53                   	push   %ebx
+    pushcli();
+80108555:	e8 a6 8b ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+8010855a:	e8 81 fe ff ff       	call   801083e0 <mycpu>
+    p = c->proc;
+8010855f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+    popcli();
+80108565:	e8 e6 8b ff ff       	call   80101150 <popcli>
+    if (!holding(&ptable.lock))
+8010856a:	83 ec 0c             	sub    $0xc,%esp
+8010856d:	68 40 17 1c 80       	push   $0x801c1740
+80108572:	e8 69 8c ff ff       	call   801011e0 <holding>
+80108577:	83 c4 10             	add    $0x10,%esp
+8010857a:	85 c0                	test   %eax,%eax
+8010857c:	74 4f                	je     801085cd <sched+0x7d>
+    if (mycpu()->ncli != 1)
+8010857e:	e8 5d fe ff ff       	call   801083e0 <mycpu>
+80108583:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+8010858a:	75 68                	jne    801085f4 <sched+0xa4>
+    if (p->state == RUNNING)
+8010858c:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80108590:	74 55                	je     801085e7 <sched+0x97>
+    asm volatile("pushfl; popl %0" : "=r" (eflags));
+80108592:	9c                   	pushf
+80108593:	58                   	pop    %eax
+    if (readeflags() & FL_IF)
+80108594:	f6 c4 02             	test   $0x2,%ah
+80108597:	75 41                	jne    801085da <sched+0x8a>
+    intena = mycpu()->intena;
+80108599:	e8 42 fe ff ff       	call   801083e0 <mycpu>
+    swtch(&p->context, mycpu()->scheduler);
+8010859e:	83 c3 1c             	add    $0x1c,%ebx
+    intena = mycpu()->intena;
+801085a1:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+    swtch(&p->context, mycpu()->scheduler);
+801085a7:	e8 34 fe ff ff       	call   801083e0 <mycpu>
+801085ac:	83 ec 08             	sub    $0x8,%esp
+801085af:	ff 70 04             	push   0x4(%eax)
+801085b2:	53                   	push   %ebx
+801085b3:	e8 7e fc ff ff       	call   80108236 <swtch>
+    mycpu()->intena = intena;
+801085b8:	e8 23 fe ff ff       	call   801083e0 <mycpu>
+}
+801085bd:	83 c4 10             	add    $0x10,%esp
+    mycpu()->intena = intena;
+801085c0:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+801085c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801085c9:	5b                   	pop    %ebx
+801085ca:	5e                   	pop    %esi
+801085cb:	5d                   	pop    %ebp
+801085cc:	c3                   	ret
+        panic("sched: ptable.lock should have held\n");
+801085cd:	83 ec 0c             	sub    $0xc,%esp
+801085d0:	68 40 b8 10 80       	push   $0x8010b840
+801085d5:	e8 66 17 00 00       	call   80109d40 <panic>
+        panic("sched: interrupt is enable");
+801085da:	83 ec 0c             	sub    $0xc,%esp
+801085dd:	68 51 b7 10 80       	push   $0x8010b751
+801085e2:	e8 59 17 00 00       	call   80109d40 <panic>
+        panic("sched: proc is running");
+801085e7:	83 ec 0c             	sub    $0xc,%esp
+801085ea:	68 3a b7 10 80       	push   $0x8010b73a
+801085ef:	e8 4c 17 00 00       	call   80109d40 <panic>
+        panic("sched: locks");
+801085f4:	83 ec 0c             	sub    $0xc,%esp
+801085f7:	68 2d b7 10 80       	push   $0x8010b72d
+801085fc:	e8 3f 17 00 00       	call   80109d40 <panic>
+80108601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010860f:	90                   	nop
+
+80108610 <yield>:
+{
+80108610:	55                   	push   %ebp
+80108611:	89 e5                	mov    %esp,%ebp
+80108613:	53                   	push   %ebx
+80108614:	83 ec 10             	sub    $0x10,%esp
+    acquire(&ptable.lock);
+80108617:	68 40 17 1c 80       	push   $0x801c1740
+8010861c:	e8 8f 8e ff ff       	call   801014b0 <acquire>
+    pushcli();
+80108621:	e8 da 8a ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+80108626:	e8 b5 fd ff ff       	call   801083e0 <mycpu>
+    p = c->proc;
+8010862b:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+    popcli();
+80108631:	e8 1a 8b ff ff       	call   80101150 <popcli>
+    myproc()->state = RUNNABLE;
+80108636:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    sched();
+8010863d:	e8 0e ff ff ff       	call   80108550 <sched>
+    release(&ptable.lock);
+80108642:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+80108649:	e8 82 8c ff ff       	call   801012d0 <release>
+}
+8010864e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108651:	83 c4 10             	add    $0x10,%esp
+80108654:	c9                   	leave
+80108655:	c3                   	ret
+80108656:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010865d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108660 <exit>:
+{
+80108660:	55                   	push   %ebp
+80108661:	89 e5                	mov    %esp,%ebp
+80108663:	53                   	push   %ebx
+80108664:	83 ec 04             	sub    $0x4,%esp
+    struct proc *curproc = myproc();
+80108667:	e8 f4 fd ff ff       	call   80108460 <myproc>
+    acquire(&ptable.lock);
+8010866c:	83 ec 0c             	sub    $0xc,%esp
+8010866f:	68 40 17 1c 80       	push   $0x801c1740
+    struct proc *curproc = myproc();
+80108674:	89 c3                	mov    %eax,%ebx
+    acquire(&ptable.lock);
+80108676:	e8 35 8e ff ff       	call   801014b0 <acquire>
+    curproc->state = ZOMBIE;
+8010867b:	c7 43 0c 05 00 00 00 	movl   $0x5,0xc(%ebx)
+    sched();
+80108682:	e8 c9 fe ff ff       	call   80108550 <sched>
+    panic("zombie exit");
+80108687:	c7 04 24 6c b7 10 80 	movl   $0x8010b76c,(%esp)
+8010868e:	e8 ad 16 00 00       	call   80109d40 <panic>
+80108693:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010869a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801086a0 <runinit>:
+{
+801086a0:	55                   	push   %ebp
+801086a1:	89 e5                	mov    %esp,%ebp
+801086a3:	57                   	push   %edi
+801086a4:	56                   	push   %esi
+801086a5:	53                   	push   %ebx
+801086a6:	83 ec 1c             	sub    $0x1c,%esp
+801086a9:	8b 45 08             	mov    0x8(%ebp),%eax
+801086ac:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801086af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if ((p = allocproc()) == 0)
+801086b2:	e8 b9 fb ff ff       	call   80108270 <allocproc>
+801086b7:	85 c0                	test   %eax,%eax
+801086b9:	0f 84 a1 01 00 00    	je     80108860 <runinit+0x1c0>
+801086bf:	89 c3                	mov    %eax,%ebx
+    if ((p->pgdir = setupkvm()) == 0)
+801086c1:	e8 ca 09 00 00       	call   80109090 <setupkvm>
+801086c6:	89 43 04             	mov    %eax,0x4(%ebx)
+801086c9:	85 c0                	test   %eax,%eax
+801086cb:	0f 84 a9 01 00 00    	je     8010887a <runinit+0x1da>
+    inituvm(p->pgdir, init, sz);
+801086d1:	83 ec 04             	sub    $0x4,%esp
+    p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+801086d4:	be 23 00 00 00       	mov    $0x23,%esi
+    inituvm(p->pgdir, init, sz);
+801086d9:	57                   	push   %edi
+801086da:	ff 75 e4             	push   -0x1c(%ebp)
+801086dd:	50                   	push   %eax
+801086de:	e8 0d 08 00 00       	call   80108ef0 <inituvm>
+    memset(p->tf, 0, sizeof(*p->tf));
+801086e3:	83 c4 0c             	add    $0xc,%esp
+    p->sz = PGSIZE;
+801086e6:	c7 03 00 10 00 00    	movl   $0x1000,(%ebx)
+    memset(p->tf, 0, sizeof(*p->tf));
+801086ec:	6a 4c                	push   $0x4c
+801086ee:	6a 00                	push   $0x0
+801086f0:	ff 73 18             	push   0x18(%ebx)
+801086f3:	e8 48 79 ff ff       	call   80100040 <memset>
+    p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+801086f8:	8b 43 18             	mov    0x18(%ebx),%eax
+801086fb:	b9 1b 00 00 00       	mov    $0x1b,%ecx
+    safestrcpy(p->name, "runinit", sizeof(p->name));
+80108700:	83 c4 0c             	add    $0xc,%esp
+    p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80108703:	66 89 48 3c          	mov    %cx,0x3c(%eax)
+    p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80108707:	8b 43 18             	mov    0x18(%ebx),%eax
+8010870a:	66 89 70 2c          	mov    %si,0x2c(%eax)
+    p->tf->es = p->tf->ds;
+8010870e:	8b 43 18             	mov    0x18(%ebx),%eax
+80108711:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80108715:	66 89 50 28          	mov    %dx,0x28(%eax)
+    p->tf->ss = p->tf->ds;
+80108719:	8b 43 18             	mov    0x18(%ebx),%eax
+8010871c:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80108720:	66 89 50 48          	mov    %dx,0x48(%eax)
+    p->tf->eflags = FL_IF;
+80108724:	8b 43 18             	mov    0x18(%ebx),%eax
+80108727:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+    p->tf->esp = PGSIZE;
+8010872e:	8b 43 18             	mov    0x18(%ebx),%eax
+80108731:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+    p->tf->eip = 0;     // beginning of init
+80108738:	8b 43 18             	mov    0x18(%ebx),%eax
+8010873b:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+    p->context->eip = (uint)runinitret;
+80108742:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80108745:	c7 40 10 50 82 10 80 	movl   $0x80108250,0x10(%eax)
+    safestrcpy(p->name, "runinit", sizeof(p->name));
+8010874c:	8d 43 30             	lea    0x30(%ebx),%eax
+8010874f:	6a 10                	push   $0x10
+80108751:	68 a3 b7 10 80       	push   $0x8010b7a3
+80108756:	50                   	push   %eax
+80108757:	e8 94 7a ff ff       	call   801001f0 <safestrcpy>
+    vdsosetproc(p);
+8010875c:	89 1c 24             	mov    %ebx,(%esp)
+8010875f:	e8 bc 0a 00 00       	call   80109220 <vdsosetproc>
+    acquire(&ptable.lock);
+80108764:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+8010876b:	e8 40 8d ff ff       	call   801014b0 <acquire>
+    c = mycpu();
+80108770:	e8 6b fc ff ff       	call   801083e0 <mycpu>
+    intena = c->intena;
+80108775:	8b 90 a8 00 00 00    	mov    0xa8(%eax),%edx
+    c->proc = p;
+8010877b:	89 98 ac 00 00 00    	mov    %ebx,0xac(%eax)
+    c = mycpu();
+80108781:	89 c6                	mov    %eax,%esi
+    intena = c->intena;
+80108783:	89 55 e0             	mov    %edx,-0x20(%ebp)
+    switchuvm(p);
+80108786:	89 1c 24             	mov    %ebx,(%esp)
+80108789:	e8 32 06 00 00       	call   80108dc0 <switchuvm>
+    fpuenter(p);
+8010878e:	89 1c 24             	mov    %ebx,(%esp)
+80108791:	e8 aa f4 ff ff       	call   80107c40 <fpuenter>
+    swtch(&c->scheduler, p->context);
+80108796:	8d 4e 04             	lea    0x4(%esi),%ecx
+    p->state = RUNNING;
+80108799:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+    swtch(&c->scheduler, p->context);
+801087a0:	58                   	pop    %eax
+801087a1:	5a                   	pop    %edx
+801087a2:	ff 73 1c             	push   0x1c(%ebx)
+801087a5:	51                   	push   %ecx
+801087a6:	e8 8b fa ff ff       	call   80108236 <swtch>
+    fpuleave(p);
+801087ab:	89 1c 24             	mov    %ebx,(%esp)
+801087ae:	e8 cd f4 ff ff       	call   80107c80 <fpuleave>
+    switchkvm();
+801087b3:	e8 f8 05 00 00       	call   80108db0 <switchkvm>
+    c->intena = intena;
+801087b8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    if (p->state != ZOMBIE)
+801087bb:	83 c4 10             	add    $0x10,%esp
+    c->proc = 0;
+801087be:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+801087c5:	00 00 00 
+    c->intena = intena;
+801087c8:	89 96 a8 00 00 00    	mov    %edx,0xa8(%esi)
+    if (p->state != ZOMBIE)
+801087ce:	83 7b 0c 05          	cmpl   $0x5,0xc(%ebx)
+801087d2:	0f 85 95 00 00 00    	jne    8010886d <runinit+0x1cd>
+    memmove(init, uva2ka(p->pgdir, 0), sz);
+801087d8:	83 ec 08             	sub    $0x8,%esp
+801087db:	6a 00                	push   $0x0
+801087dd:	ff 73 04             	push   0x4(%ebx)
+801087e0:	e8 ab 07 00 00       	call   80108f90 <uva2ka>
+801087e5:	83 c4 0c             	add    $0xc,%esp
+801087e8:	57                   	push   %edi
+801087e9:	50                   	push   %eax
+801087ea:	ff 75 e4             	push   -0x1c(%ebp)
+801087ed:	e8 de 78 ff ff       	call   801000d0 <memmove>
+    kfree(p->kstack);
+801087f2:	58                   	pop    %eax
+801087f3:	ff 73 08             	push   0x8(%ebx)
+801087f6:	e8 55 f7 ff ff       	call   80107f50 <kfree>
+    p->kstack = 0;
+801087fb:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+    freevm(p->pgdir);
+80108802:	5a                   	pop    %edx
+80108803:	ff 73 04             	push   0x4(%ebx)
+80108806:	e8 05 08 00 00       	call   80109010 <freevm>
+    p->pgdir = 0;
+8010880b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    acquireseq(&ptable.pidseq);
+80108812:	c7 04 24 c0 17 1c 80 	movl   $0x801c17c0,(%esp)
+80108819:	e8 32 99 ff ff       	call   80102150 <acquireseq>
+    p->pid = 0;
+8010881e:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+    releaseseq(&ptable.pidseq);
+80108825:	c7 04 24 c0 17 1c 80 	movl   $0x801c17c0,(%esp)
+8010882c:	e8 4f 99 ff ff       	call   80102180 <releaseseq>
+    p->parent = 0;
+80108831:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+    release(&ptable.lock);
+80108838:	83 c4 10             	add    $0x10,%esp
+    p->name[0] = 0;
+8010883b:	c6 43 30 00          	movb   $0x0,0x30(%ebx)
+    p->killed = 0;
+8010883f:	c7 43 24 00 00 00 00 	movl   $0x0,0x24(%ebx)
+    p->state = UNUSED;
+80108846:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    release(&ptable.lock);
+8010884d:	c7 45 08 40 17 1c 80 	movl   $0x801c1740,0x8(%ebp)
+}
+80108854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108857:	5b                   	pop    %ebx
+80108858:	5e                   	pop    %esi
+80108859:	5f                   	pop    %edi
+8010885a:	5d                   	pop    %ebp
+    release(&ptable.lock);
+8010885b:	e9 70 8a ff ff       	jmp    801012d0 <release>
+        panic("runinit: no process");
+80108860:	83 ec 0c             	sub    $0xc,%esp
+80108863:	68 78 b7 10 80       	push   $0x8010b778
+80108868:	e8 d3 14 00 00       	call   80109d40 <panic>
+        panic("runinit: process did not exit");
+8010886d:	83 ec 0c             	sub    $0xc,%esp
+80108870:	68 ab b7 10 80       	push   $0x8010b7ab
+80108875:	e8 c6 14 00 00       	call   80109d40 <panic>
+        panic("runinit: out of memory");
+8010887a:	83 ec 0c             	sub    $0xc,%esp
+8010887d:	68 8c b7 10 80       	push   $0x8010b78c
+80108882:	e8 b9 14 00 00       	call   80109d40 <panic>
+80108887:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010888e:	66 90                	xchg   %ax,%ax
+
+80108890 <kthread>:
+{
+80108890:	55                   	push   %ebp
+80108891:	89 e5                	mov    %esp,%ebp
+80108893:	53                   	push   %ebx
+80108894:	83 ec 04             	sub    $0x4,%esp
+    if ((p = allocproc()) == 0)
+80108897:	e8 d4 f9 ff ff       	call   80108270 <allocproc>
+8010889c:	85 c0                	test   %eax,%eax
+8010889e:	74 4e                	je     801088ee <kthread+0x5e>
+801088a0:	89 c3                	mov    %eax,%ebx
+    if ((p->pgdir = setupkvm()) == 0)
+801088a2:	e8 e9 07 00 00       	call   80109090 <setupkvm>
+801088a7:	89 43 04             	mov    %eax,0x4(%ebx)
+801088aa:	85 c0                	test   %eax,%eax
+801088ac:	74 4d                	je     801088fb <kthread+0x6b>
+    *(uint*)(p->context + 1) = (uint)fn;    // see allocproc()
+801088ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+801088b1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+    safestrcpy(p->name, name, sizeof(p->name));
+801088b4:	83 ec 04             	sub    $0x4,%esp
+    *(uint*)(p->context + 1) = (uint)fn;    // see allocproc()
+801088b7:	89 50 14             	mov    %edx,0x14(%eax)
+    safestrcpy(p->name, name, sizeof(p->name));
+801088ba:	8d 43 30             	lea    0x30(%ebx),%eax
+801088bd:	6a 10                	push   $0x10
+801088bf:	ff 75 08             	push   0x8(%ebp)
+801088c2:	50                   	push   %eax
+801088c3:	e8 28 79 ff ff       	call   801001f0 <safestrcpy>
+    acquire(&ptable.lock);
+801088c8:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+801088cf:	e8 dc 8b ff ff       	call   801014b0 <acquire>
+    p->state = RUNNABLE;
+801088d4:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    release(&ptable.lock);
+801088db:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+801088e2:	e8 e9 89 ff ff       	call   801012d0 <release>
+}
+801088e7:	89 d8                	mov    %ebx,%eax
+801088e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801088ec:	c9                   	leave
+801088ed:	c3                   	ret
+        panic("kthread: no process");
+801088ee:	83 ec 0c             	sub    $0xc,%esp
+801088f1:	68 c9 b7 10 80       	push   $0x8010b7c9
+801088f6:	e8 45 14 00 00       	call   80109d40 <panic>
+        panic("kthread: out of memory");
+801088fb:	83 ec 0c             	sub    $0xc,%esp
+801088fe:	68 dd b7 10 80       	push   $0x8010b7dd
+80108903:	e8 38 14 00 00       	call   80109d40 <panic>
+80108908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010890f:	90                   	nop
+
+80108910 <sleep>:
+
+// atomically release lock and sleep on chan.
+// reacquires lock when awakened.
+void
+sleep(void *chan, struct spinlock *lk)
+{
+80108910:	55                   	push   %ebp
+80108911:	89 e5                	mov    %esp,%ebp
+80108913:	57                   	push   %edi
+80108914:	56                   	push   %esi
+80108915:	53                   	push   %ebx
+80108916:	83 ec 0c             	sub    $0xc,%esp
+80108919:	8b 7d 08             	mov    0x8(%ebp),%edi
+8010891c:	8b 75 0c             	mov    0xc(%ebp),%esi
+    pushcli();
+8010891f:	e8 dc 87 ff ff       	call   80101100 <pushcli>
+    c = mycpu();
+80108924:	e8 b7 fa ff ff       	call   801083e0 <mycpu>
+    p = c->proc;
+80108929:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+    popcli();
+8010892f:	e8 1c 88 ff ff       	call   80101150 <popcli>
+    struct proc *p = myproc();
+
+    if (p == 0)
+80108934:	85 db                	test   %ebx,%ebx
+80108936:	0f 84 87 00 00 00    	je     801089c3 <sleep+0xb3>
+        panic("sleep:");
+    if (lk == 0)
+8010893c:	85 f6                	test   %esi,%esi
+8010893e:	74 76                	je     801089b6 <sleep+0xa6>
+
+    // must acquire ptable.lock in orde rto change p->state
+    // and then call sched. once we hold ptable.lock, we can be guaranteed
+    // that we won't miss any wakeup (wake up runs with ptable locked),
+    // so it's ok to release lk
+    if (lk != &ptable.lock) {
+80108940:	81 fe 40 17 1c 80    	cmp    $0x801c1740,%esi
+80108946:	74 50                	je     80108998 <sleep+0x88>
+        acquire(&ptable.lock);
+80108948:	83 ec 0c             	sub    $0xc,%esp
+8010894b:	68 40 17 1c 80       	push   $0x801c1740
+80108950:	e8 5b 8b ff ff       	call   801014b0 <acquire>
+        release(lk);
+80108955:	89 34 24             	mov    %esi,(%esp)
+80108958:	e8 73 89 ff ff       	call   801012d0 <release>
+    }
+
+    // go to sleep
+    p->chan = chan;
+8010895d:	89 7b 20             	mov    %edi,0x20(%ebx)
+    p->state = SLEEPING;
+80108960:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+
+    sched();
+80108967:	e8 e4 fb ff ff       	call   80108550 <sched>
+
+    // tidy up;
+    p->chan = 0;
+8010896c:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+
+    // reacquire original lock
+    if (lk != &ptable.lock) {
+        release(&ptable.lock);
+80108973:	c7 04 24 40 17 1c 80 	movl   $0x801c1740,(%esp)
+8010897a:	e8 51 89 ff ff       	call   801012d0 <release>
+        acquire(lk);
+8010897f:	89 75 08             	mov    %esi,0x8(%ebp)
+80108982:	83 c4 10             	add    $0x10,%esp
+    }
+}
+80108985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108988:	5b                   	pop    %ebx
+80108989:	5e                   	pop    %esi
+8010898a:	5f                   	pop    %edi
+8010898b:	5d                   	pop    %ebp
+        acquire(lk);
+8010898c:	e9 1f 8b ff ff       	jmp    801014b0 <acquire>
+80108991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    p->chan = chan;
+80108998:	89 7b 20             	mov    %edi,0x20(%ebx)
+    p->state = SLEEPING;
+8010899b:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+    sched();
+801089a2:	e8 a9 fb ff ff       	call   80108550 <sched>
+    p->chan = 0;
+801089a7:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+}
+801089ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801089b1:	5b                   	pop    %ebx
+801089b2:	5e                   	pop    %esi
+801089b3:	5f                   	pop    %edi
+801089b4:	5d                   	pop    %ebp
+801089b5:	c3                   	ret
+        panic("sleep: without lk");
+801089b6:	83 ec 0c             	sub    $0xc,%esp
+801089b9:	68 fb b7 10 80       	push   $0x8010b7fb
+801089be:	e8 7d 13 00 00       	call   80109d40 <panic>
+        panic("sleep:");
+801089c3:	83 ec 0c             	sub    $0xc,%esp
+801089c6:	68 f4 b7 10 80       	push   $0x8010b7f4
+801089cb:	e8 70 13 00 00       	call   80109d40 <panic>
+
+801089d0 <wakeproc>:
+
+// wake p alone, if it is sleeping on chan.
+// unlike wakeup(), doesn't scan the process table.
+void
+wakeproc(struct proc *p, void *chan)
+{
+801089d0:	55                   	push   %ebp
+801089d1:	89 e5                	mov    %esp,%ebp
+801089d3:	56                   	push   %esi
+801089d4:	53                   	push   %ebx
+801089d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801089d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+    acquire(&ptable.lock);
+801089db:	83 ec 0c             	sub    $0xc,%esp
+801089de:	68 40 17 1c 80       	push   $0x801c1740
+801089e3:	e8 c8 8a ff ff       	call   801014b0 <acquire>
+    if (p->state == SLEEPING && p->chan == chan)
+801089e8:	83 c4 10             	add    $0x10,%esp
+801089eb:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+801089ef:	74 17                	je     80108a08 <wakeproc+0x38>
+        p->state = RUNNABLE;
+    release(&ptable.lock);
+801089f1:	c7 45 08 40 17 1c 80 	movl   $0x801c1740,0x8(%ebp)
+}
+801089f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801089fb:	5b                   	pop    %ebx
+801089fc:	5e                   	pop    %esi
+801089fd:	5d                   	pop    %ebp
+    release(&ptable.lock);
+801089fe:	e9 cd 88 ff ff       	jmp    801012d0 <release>
+80108a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108a07:	90                   	nop
+    if (p->state == SLEEPING && p->chan == chan)
+80108a08:	39 73 20             	cmp    %esi,0x20(%ebx)
+80108a0b:	75 e4                	jne    801089f1 <wakeproc+0x21>
+        p->state = RUNNABLE;
+80108a0d:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+80108a14:	eb db                	jmp    801089f1 <wakeproc+0x21>
+80108a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108a20 <wakeup>:
+
+// wake up all process sleeping on chan
+void
+wakeup(void *chan)
+{
+80108a20:	55                   	push   %ebp
+80108a21:	89 e5                	mov    %esp,%ebp
+80108a23:	53                   	push   %ebx
+80108a24:	83 ec 10             	sub    $0x10,%esp
+80108a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    acquire(&ptable.lock);
+80108a2a:	68 40 17 1c 80       	push   $0x801c1740
+80108a2f:	e8 7c 8a ff ff       	call   801014b0 <acquire>
+80108a34:	83 c4 10             	add    $0x10,%esp
+    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108a37:	b8 40 18 1c 80       	mov    $0x801c1840,%eax
+80108a3c:	eb 0e                	jmp    80108a4c <wakeup+0x2c>
+80108a3e:	66 90                	xchg   %ax,%ax
+80108a40:	05 50 02 00 00       	add    $0x250,%eax
+80108a45:	3d 40 ac 1c 80       	cmp    $0x801cac40,%eax
+80108a4a:	74 1e                	je     80108a6a <wakeup+0x4a>
+        if (p->state == SLEEPING && p->chan == chan)
+80108a4c:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+80108a50:	75 ee                	jne    80108a40 <wakeup+0x20>
+80108a52:	3b 58 20             	cmp    0x20(%eax),%ebx
+80108a55:	75 e9                	jne    80108a40 <wakeup+0x20>
+            p->state = RUNNABLE;
+80108a57:	c7 40 0c 03 00 00 00 	movl   $0x3,0xc(%eax)
+    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108a5e:	05 50 02 00 00       	add    $0x250,%eax
+80108a63:	3d 40 ac 1c 80       	cmp    $0x801cac40,%eax
+80108a68:	75 e2                	jne    80108a4c <wakeup+0x2c>
+    wakeup1(chan);
+    release(&ptable.lock);
+80108a6a:	c7 45 08 40 17 1c 80 	movl   $0x801c1740,0x8(%ebp)
+}
+80108a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108a74:	c9                   	leave
+    release(&ptable.lock);
+80108a75:	e9 56 88 ff ff       	jmp    801012d0 <release>
+80108a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108a80 <kill>:
+
+// kill the process with the given pid
+// process won't exit until it returns to user space (see trap in trap.c)
+int
+kill(int pid)
+{
+80108a80:	55                   	push   %ebp
+80108a81:	89 e5                	mov    %esp,%ebp
+80108a83:	57                   	push   %edi
+80108a84:	56                   	push   %esi
+80108a85:	53                   	push   %ebx
+80108a86:	83 ec 0c             	sub    $0xc,%esp
+80108a89:	8b 75 08             	mov    0x8(%ebp),%esi
+80108a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    uint s;
+
+    // find the slot without holding ptable.lock,
+    // so the scan doesn't hold up the scheduler on other cpus.
+    do {
+        s = readseqbegin(&ptable.pidseq);
+80108a90:	83 ec 0c             	sub    $0xc,%esp
+        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108a93:	bb 40 18 1c 80       	mov    $0x801c1840,%ebx
+        s = readseqbegin(&ptable.pidseq);
+80108a98:	68 c0 17 1c 80       	push   $0x801c17c0
+80108a9d:	e8 fe 96 ff ff       	call   801021a0 <readseqbegin>
+80108aa2:	83 c4 10             	add    $0x10,%esp
+80108aa5:	eb 17                	jmp    80108abe <kill+0x3e>
+80108aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aae:	66 90                	xchg   %ax,%ax
+        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80108ab0:	81 c3 50 02 00 00    	add    $0x250,%ebx
+80108ab6:	81 fb 40 ac 1c 80    	cmp    $0x801cac40,%ebx
+80108abc:	74 05                	je     80108ac3 <kill+0x43>
+            if (p->pid == pid)
+80108abe:	39 73 10             	cmp    %esi,0x10(%ebx)
+80108ac1:	75 ed                	jne    80108ab0 <kill+0x30>
+                break;
+    } while (readseqretry(&ptable.pidseq, s));
+80108ac3:	83 ec 08             	sub    $0x8,%esp
+80108ac6:	50                   	push   %eax
+80108ac7:	68 c0 17 1c 80       	push   $0x801c17c0
+80108acc:	e8 ef 96 ff ff       	call   801021c0 <readseqretry>
+80108ad1:	83 c4 10             	add    $0x10,%esp
+80108ad4:	89 c7                	mov    %eax,%edi
+80108ad6:	85 c0                	test   %eax,%eax
+80108ad8:	75 b6                	jne    80108a90 <kill+0x10>
+    if (p == &ptable.proc[NPROC])
+80108ada:	81 fb 40 ac 1c 80    	cmp    $0x801cac40,%ebx
+80108ae0:	74 53                	je     80108b35 <kill+0xb5>
+        return -1;
+
+    acquire(&ptable.lock);
+80108ae2:	83 ec 0c             	sub    $0xc,%esp
+80108ae5:	68 40 17 1c 80       	push   $0x801c1740
+80108aea:	e8 c1 89 ff ff       	call   801014b0 <acquire>
+    if (p->pid != pid) {
+80108aef:	83 c4 10             	add    $0x10,%esp
+80108af2:	39 73 10             	cmp    %esi,0x10(%ebx)
+80108af5:	75 2e                	jne    80108b25 <kill+0xa5>
+    }
+    p->killed = 1;
+    // wake process from sleep if necessary
+    // sleep on sleeplock is fine, because it won't run any more,
+    // it will be killed in trap.c when scheduled
+    if (p->state == SLEEPING) {
+80108af7:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+    p->killed = 1;
+80108afb:	c7 43 24 01 00 00 00 	movl   $0x1,0x24(%ebx)
+    if (p->state == SLEEPING) {
+80108b02:	75 07                	jne    80108b0b <kill+0x8b>
+        p->state = RUNNABLE;
+80108b04:	c7 43 0c 03 00 00 00 	movl   $0x3,0xc(%ebx)
+    }
+    release(&ptable.lock);
+80108b0b:	83 ec 0c             	sub    $0xc,%esp
+80108b0e:	68 40 17 1c 80       	push   $0x801c1740
+80108b13:	e8 b8 87 ff ff       	call   801012d0 <release>
+    return 0;
+80108b18:	83 c4 10             	add    $0x10,%esp
+}
+80108b1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108b1e:	89 f8                	mov    %edi,%eax
+80108b20:	5b                   	pop    %ebx
+80108b21:	5e                   	pop    %esi
+80108b22:	5f                   	pop    %edi
+80108b23:	5d                   	pop    %ebp
+80108b24:	c3                   	ret
+        release(&ptable.lock);
+80108b25:	83 ec 0c             	sub    $0xc,%esp
+80108b28:	68 40 17 1c 80       	push   $0x801c1740
+80108b2d:	e8 9e 87 ff ff       	call   801012d0 <release>
+        return -1;
+80108b32:	83 c4 10             	add    $0x10,%esp
+        return -1;
+80108b35:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+80108b3a:	eb df                	jmp    80108b1b <kill+0x9b>
+80108b3c:	66 90                	xchg   %ax,%ax
+80108b3e:	66 90                	xchg   %ax,%ax
+
+80108b40 <deallocuvm.part.0>:
+
+// deallocate user pages to bring the process size from oldsz to newsz.
+// oldsz and newsz need not e page-aligned, nor does newsz need to be less than oldsz.
+// oldsz can be larger than the actual process size. return the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80108b40:	55                   	push   %ebp
+80108b41:	89 e5                	mov    %esp,%ebp
+80108b43:	57                   	push   %edi
+80108b44:	56                   	push   %esi
+80108b45:	53                   	push   %ebx
+80108b46:	89 cb                	mov    %ecx,%ebx
+    uint a, pa;
+
+    if (newsz >= oldsz)
+        return oldsz;
+
+    a = PGROUNDDOWN(newsz);
+80108b48:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80108b4e:	83 ec 1c             	sub    $0x1c,%esp
+80108b51:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    for (; a < oldsz; a += PGSIZE) {
+80108b54:	39 d3                	cmp    %edx,%ebx
+80108b56:	73 48                	jae    80108ba0 <deallocuvm.part.0+0x60>
+80108b58:	89 c7                	mov    %eax,%edi
+80108b5a:	89 d6                	mov    %edx,%esi
+80108b5c:	eb 2d                	jmp    80108b8b <deallocuvm.part.0+0x4b>
+80108b5e:	66 90                	xchg   %ax,%ax
+    return &pgtab[PTX(va)];
+80108b60:	89 d9                	mov    %ebx,%ecx
+        pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108b62:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    return &pgtab[PTX(va)];
+80108b67:	c1 e9 0a             	shr    $0xa,%ecx
+80108b6a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+80108b70:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+        pte = walkpgdir(pgdir, (char *)a, 0);
+        if (!pte)
+80108b77:	85 c9                	test   %ecx,%ecx
+80108b79:	74 1c                	je     80108b97 <deallocuvm.part.0+0x57>
+            a = PGADDR((a) + 1, 0, 0) - PGSIZE;
+        else if ((*pte & PTE_P) != 0) {
+80108b7b:	8b 01                	mov    (%ecx),%eax
+80108b7d:	a8 01                	test   $0x1,%al
+80108b7f:	75 2f                	jne    80108bb0 <deallocuvm.part.0+0x70>
+    for (; a < oldsz; a += PGSIZE) {
+80108b81:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80108b87:	39 f3                	cmp    %esi,%ebx
+80108b89:	73 15                	jae    80108ba0 <deallocuvm.part.0+0x60>
+    pde = &pgdir[PDX(va)];
+80108b8b:	89 d8                	mov    %ebx,%eax
+80108b8d:	c1 e8 16             	shr    $0x16,%eax
+    if(*pde & PTE_P){
+80108b90:	8b 04 87             	mov    (%edi,%eax,4),%eax
+80108b93:	a8 01                	test   $0x1,%al
+80108b95:	75 c9                	jne    80108b60 <deallocuvm.part.0+0x20>
+80108b97:	bb 00 00 40 00       	mov    $0x400000,%ebx
+    for (; a < oldsz; a += PGSIZE) {
+80108b9c:	39 f3                	cmp    %esi,%ebx
+80108b9e:	72 eb                	jb     80108b8b <deallocuvm.part.0+0x4b>
+            kfree(V);
+            *pte = 0;
+        }
+    }
+    return newsz;
+}
+80108ba0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108ba6:	5b                   	pop    %ebx
+80108ba7:	5e                   	pop    %esi
+80108ba8:	5f                   	pop    %edi
+80108ba9:	5d                   	pop    %ebp
+80108baa:	c3                   	ret
+80108bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108baf:	90                   	nop
+            if (pa == 0)
+80108bb0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80108bb5:	74 25                	je     80108bdc <deallocuvm.part.0+0x9c>
+            kfree(V);
+80108bb7:	83 ec 0c             	sub    $0xc,%esp
+            char *V = P2V(pa);
+80108bba:	05 00 00 00 80       	add    $0x80000000,%eax
+80108bbf:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    for (; a < oldsz; a += PGSIZE) {
+80108bc2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+            kfree(V);
+80108bc8:	50                   	push   %eax
+80108bc9:	e8 82 f3 ff ff       	call   80107f50 <kfree>
+            *pte = 0;
+80108bce:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    for (; a < oldsz; a += PGSIZE) {
+80108bd1:	83 c4 10             	add    $0x10,%esp
+            *pte = 0;
+80108bd4:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+80108bda:	eb ab                	jmp    80108b87 <deallocuvm.part.0+0x47>
+                panic("dealloctuvm: kfree");
+80108bdc:	83 ec 0c             	sub    $0xc,%esp
+80108bdf:	68 65 b8 10 80       	push   $0x8010b865
+80108be4:	e8 57 11 00 00       	call   80109d40 <panic>
+80108be9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108bf0 <mappages>:
+{
+80108bf0:	55                   	push   %ebp
+80108bf1:	89 e5                	mov    %esp,%ebp
+80108bf3:	57                   	push   %edi
+80108bf4:	56                   	push   %esi
+80108bf5:	53                   	push   %ebx
+    a = (char *) PGROUNDDOWN((uint)va);
+80108bf6:	89 d3                	mov    %edx,%ebx
+80108bf8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+80108bfe:	83 ec 1c             	sub    $0x1c,%esp
+80108c01:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    last = (char *) PGROUNDDOWN(((uint)va) + size - 1);
+80108c04:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+80108c08:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80108c0d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80108c10:	8b 45 08             	mov    0x8(%ebp),%eax
+80108c13:	29 d8                	sub    %ebx,%eax
+80108c15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108c18:	eb 3f                	jmp    80108c59 <mappages+0x69>
+80108c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return &pgtab[PTX(va)];
+80108c20:	89 da                	mov    %ebx,%edx
+        pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108c22:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    return &pgtab[PTX(va)];
+80108c27:	c1 ea 0a             	shr    $0xa,%edx
+80108c2a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+80108c30:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+        if ((pte = walkpgdir(pgdir, a, 1)) == 0)
+80108c37:	85 c0                	test   %eax,%eax
+80108c39:	74 6d                	je     80108ca8 <mappages+0xb8>
+        if (*pte & PTE_P)
+80108c3b:	f6 00 01             	testb  $0x1,(%eax)
+80108c3e:	0f 85 7e 00 00 00    	jne    80108cc2 <mappages+0xd2>
+        *pte = pa | perm | PTE_P;
+80108c44:	0b 75 0c             	or     0xc(%ebp),%esi
+80108c47:	83 ce 01             	or     $0x1,%esi
+80108c4a:	89 30                	mov    %esi,(%eax)
+        if (a == last)
+80108c4c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108c4f:	39 c3                	cmp    %eax,%ebx
+80108c51:	74 65                	je     80108cb8 <mappages+0xc8>
+        a += PGSIZE;
+80108c53:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    for (;;) {
+80108c59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    pde = &pgdir[PDX(va)];
+80108c5c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80108c5f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+80108c62:	89 d8                	mov    %ebx,%eax
+80108c64:	c1 e8 16             	shr    $0x16,%eax
+80108c67:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+    if(*pde & PTE_P){
+80108c6a:	8b 07                	mov    (%edi),%eax
+80108c6c:	a8 01                	test   $0x1,%al
+80108c6e:	75 b0                	jne    80108c20 <mappages+0x30>
+        if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+80108c70:	e8 cb f4 ff ff       	call   80108140 <kalloc>
+80108c75:	85 c0                	test   %eax,%eax
+80108c77:	74 2f                	je     80108ca8 <mappages+0xb8>
+        pagezero(pgtab);
+80108c79:	83 ec 0c             	sub    $0xc,%esp
+80108c7c:	50                   	push   %eax
+80108c7d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80108c80:	e8 2b f2 ff ff       	call   80107eb0 <pagezero>
+        *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80108c85:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    return &pgtab[PTX(va)];
+80108c88:	89 da                	mov    %ebx,%edx
+80108c8a:	83 c4 10             	add    $0x10,%esp
+80108c8d:	c1 ea 0a             	shr    $0xa,%edx
+        *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80108c90:	8d 88 00 00 00 80    	lea    -0x80000000(%eax),%ecx
+    return &pgtab[PTX(va)];
+80108c96:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+        *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80108c9c:	83 c9 07             	or     $0x7,%ecx
+    return &pgtab[PTX(va)];
+80108c9f:	01 d0                	add    %edx,%eax
+        *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+80108ca1:	89 0f                	mov    %ecx,(%edi)
+    return &pgtab[PTX(va)];
+80108ca3:	eb 96                	jmp    80108c3b <mappages+0x4b>
+80108ca5:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80108ca8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+            return -1;
+80108cab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108cb0:	5b                   	pop    %ebx
+80108cb1:	5e                   	pop    %esi
+80108cb2:	5f                   	pop    %edi
+80108cb3:	5d                   	pop    %ebp
+80108cb4:	c3                   	ret
+80108cb5:	8d 76 00             	lea    0x0(%esi),%esi
+80108cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return 0;
+80108cbb:	31 c0                	xor    %eax,%eax
+}
+80108cbd:	5b                   	pop    %ebx
+80108cbe:	5e                   	pop    %esi
+80108cbf:	5f                   	pop    %edi
+80108cc0:	5d                   	pop    %ebp
+80108cc1:	c3                   	ret
+            panic("mappages: remap");
+80108cc2:	83 ec 0c             	sub    $0xc,%esp
+80108cc5:	68 78 b8 10 80       	push   $0x8010b878
+80108cca:	e8 71 10 00 00       	call   80109d40 <panic>
+80108ccf:	90                   	nop
+
+80108cd0 <seginit>:
+{
+80108cd0:	55                   	push   %ebp
+80108cd1:	89 e5                	mov    %esp,%ebp
+80108cd3:	56                   	push   %esi
+80108cd4:	53                   	push   %ebx
+80108cd5:	83 ec 10             	sub    $0x10,%esp
+    c = &cpus[cpuid()];
+80108cd8:	e8 63 f7 ff ff       	call   80108440 <cpuid>
+    pd[0] = size-1;
+80108cdd:	ba 2f 00 00 00       	mov    $0x2f,%edx
+    c->gdt[SEG_ZERO]  = SEG(0, 0, 0, 0);
+80108ce2:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80108ce5:	c1 e0 06             	shl    $0x6,%eax
+80108ce8:	c7 80 f0 c6 18 80 00 	movl   $0x0,-0x7fe73910(%eax)
+80108cef:	00 00 00 
+    c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_KERN);
+80108cf2:	c7 80 f8 c6 18 80 ff 	movl   $0xffff,-0x7fe73908(%eax)
+80108cf9:	ff 00 00 
+    c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, DPL_KERN);
+80108cfc:	c7 80 00 c7 18 80 ff 	movl   $0xffff,-0x7fe73900(%eax)
+80108d03:	ff 00 00 
+    c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80108d06:	c7 80 08 c7 18 80 ff 	movl   $0xffff,-0x7fe738f8(%eax)
+80108d0d:	ff 00 00 
+    c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80108d10:	c7 80 10 c7 18 80 ff 	movl   $0xffff,-0x7fe738f0(%eax)
+80108d17:	ff 00 00 
+    c->gdt[SEG_ZERO]  = SEG(0, 0, 0, 0);
+80108d1a:	c7 80 f4 c6 18 80 00 	movl   $0xc09000,-0x7fe7390c(%eax)
+80108d21:	90 c0 00 
+    c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_KERN);
+80108d24:	c7 80 fc c6 18 80 00 	movl   $0xcf9a00,-0x7fe73904(%eax)
+80108d2b:	9a cf 00 
+    c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, DPL_KERN);
+80108d2e:	c7 80 04 c7 18 80 00 	movl   $0xcf9200,-0x7fe738fc(%eax)
+80108d35:	92 cf 00 
+    c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+80108d38:	c7 80 0c c7 18 80 00 	movl   $0xcffa00,-0x7fe738f4(%eax)
+80108d3f:	fa cf 00 
+    c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+80108d42:	c7 80 14 c7 18 80 00 	movl   $0xcff200,-0x7fe738ec(%eax)
+80108d49:	f2 cf 00 
+    lgdt(c->gdt, sizeof(c->gdt));
+80108d4c:	05 f0 c6 18 80       	add    $0x8018c6f0,%eax
+80108d51:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+    pd[1] = (uint)p;
+80108d55:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+    pd[2] = (uint)p >> 16;
+80108d59:	c1 e8 10             	shr    $0x10,%eax
+80108d5c:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+    asm volatile("lgdt (%0)" : : "r" (pd));
+80108d60:	8d 45 f2             	lea    -0xe(%ebp),%eax
+80108d63:	0f 01 10             	lgdtl  (%eax)
+    asm volatile("cpuid" :
+80108d66:	31 f6                	xor    %esi,%esi
+80108d68:	b8 01 00 00 00       	mov    $0x1,%eax
+80108d6d:	89 f1                	mov    %esi,%ecx
+80108d6f:	0f a2                	cpuid
+    sysenter = (edx & CPUID_SEP) != 0;
+80108d71:	31 c0                	xor    %eax,%eax
+80108d73:	80 e6 08             	and    $0x8,%dh
+80108d76:	0f 95 c0             	setne  %al
+80108d79:	a3 44 ac 1c 80       	mov    %eax,0x801cac44
+    if (sysenter) {
+80108d7e:	74 23                	je     80108da3 <seginit+0xd3>
+    asm volatile("wrmsr" : : "c" (msr), "a" (lo), "d" (hi));
+80108d80:	b9 74 01 00 00       	mov    $0x174,%ecx
+80108d85:	b8 08 00 00 00       	mov    $0x8,%eax
+80108d8a:	89 f2                	mov    %esi,%edx
+80108d8c:	0f 30                	wrmsr
+80108d8e:	b9 76 01 00 00       	mov    $0x176,%ecx
+80108d93:	b8 e8 94 10 80       	mov    $0x801094e8,%eax
+80108d98:	0f 30                	wrmsr
+80108d9a:	b9 75 01 00 00       	mov    $0x175,%ecx
+80108d9f:	89 f0                	mov    %esi,%eax
+80108da1:	0f 30                	wrmsr
+}
+80108da3:	83 c4 10             	add    $0x10,%esp
+80108da6:	5b                   	pop    %ebx
+80108da7:	5e                   	pop    %esi
+80108da8:	5d                   	pop    %ebp
+80108da9:	c3                   	ret
+80108daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108db0 <switchkvm>:
+    lcr3(V2P(kpgdir));
+80108db0:	a1 40 ac 1c 80       	mov    0x801cac40,%eax
+80108db5:	05 00 00 00 80       	add    $0x80000000,%eax
+    asm volatile("movl %0,%%cr3" : : "r" (val));
+80108dba:	0f 22 d8             	mov    %eax,%cr3
+}
+80108dbd:	c3                   	ret
+80108dbe:	66 90                	xchg   %ax,%ax
+
+80108dc0 <switchuvm>:
+{
+80108dc0:	55                   	push   %ebp
+80108dc1:	89 e5                	mov    %esp,%ebp
+80108dc3:	57                   	push   %edi
+80108dc4:	56                   	push   %esi
+80108dc5:	53                   	push   %ebx
+80108dc6:	83 ec 1c             	sub    $0x1c,%esp
+80108dc9:	8b 75 08             	mov    0x8(%ebp),%esi
+    if (p == 0)
+80108dcc:	85 f6                	test   %esi,%esi
+80108dce:	0f 84 00 01 00 00    	je     80108ed4 <switchuvm+0x114>
+    if (p->kstack == 0)
+80108dd4:	8b 7e 08             	mov    0x8(%esi),%edi
+80108dd7:	85 ff                	test   %edi,%edi
+80108dd9:	0f 84 e8 00 00 00    	je     80108ec7 <switchuvm+0x107>
+    if (p->pgdir == 0)
+80108ddf:	8b 5e 04             	mov    0x4(%esi),%ebx
+80108de2:	85 db                	test   %ebx,%ebx
+80108de4:	0f 84 d0 00 00 00    	je     80108eba <switchuvm+0xfa>
+    pushcli();
+80108dea:	e8 11 83 ff ff       	call   80101100 <pushcli>
+    mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts, sizeof(mycpu()->ts)-1, 0);
+80108def:	e8 ec f5 ff ff       	call   801083e0 <mycpu>
+80108df4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80108df7:	e8 e4 f5 ff ff       	call   801083e0 <mycpu>
+80108dfc:	89 c7                	mov    %eax,%edi
+80108dfe:	e8 dd f5 ff ff       	call   801083e0 <mycpu>
+80108e03:	83 c7 08             	add    $0x8,%edi
+80108e06:	89 c3                	mov    %eax,%ebx
+80108e08:	e8 d3 f5 ff ff       	call   801083e0 <mycpu>
+80108e0d:	83 c3 08             	add    $0x8,%ebx
+80108e10:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80108e13:	b9 67 00 00 00       	mov    $0x67,%ecx
+80108e18:	c1 eb 10             	shr    $0x10,%ebx
+80108e1b:	83 c0 08             	add    $0x8,%eax
+80108e1e:	88 9a 9c 00 00 00    	mov    %bl,0x9c(%edx)
+80108e24:	c1 e8 18             	shr    $0x18,%eax
+80108e27:	bb 99 40 00 00       	mov    $0x4099,%ebx
+80108e2c:	66 89 8a 98 00 00 00 	mov    %cx,0x98(%edx)
+80108e33:	66 89 ba 9a 00 00 00 	mov    %di,0x9a(%edx)
+    mycpu()->ts.ss0 = SEG_KDATA << 3;
+80108e3a:	bf 10 00 00 00       	mov    $0x10,%edi
+    mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts, sizeof(mycpu()->ts)-1, 0);
+80108e3f:	66 89 9a 9d 00 00 00 	mov    %bx,0x9d(%edx)
+80108e46:	88 82 9f 00 00 00    	mov    %al,0x9f(%edx)
+    mycpu()->gdt[SEG_TSS].s = 0;
+80108e4c:	e8 8f f5 ff ff       	call   801083e0 <mycpu>
+80108e51:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+    mycpu()->ts.ss0 = SEG_KDATA << 3;
+80108e58:	e8 83 f5 ff ff       	call   801083e0 <mycpu>
+80108e5d:	66 89 78 10          	mov    %di,0x10(%eax)
+    mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+80108e61:	8b 5e 08             	mov    0x8(%esi),%ebx
+80108e64:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80108e6a:	e8 71 f5 ff ff       	call   801083e0 <mycpu>
+80108e6f:	89 58 0c             	mov    %ebx,0xc(%eax)
+    mycpu()->ts.iomb = (ushort) 0xFFFF;
+80108e72:	e8 69 f5 ff ff       	call   801083e0 <mycpu>
+80108e77:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+80108e7c:	66 89 50 6e          	mov    %dx,0x6e(%eax)
+    asm volatile("ltr %0" : : "r" (sel));
+80108e80:	b8 28 00 00 00       	mov    $0x28,%eax
+80108e85:	0f 00 d8             	ltr    %ax
+    if (sysenter)
+80108e88:	8b 0d 44 ac 1c 80    	mov    0x801cac44,%ecx
+80108e8e:	85 c9                	test   %ecx,%ecx
+80108e90:	74 11                	je     80108ea3 <switchuvm+0xe3>
+        wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE, 0);
+80108e92:	8b 46 08             	mov    0x8(%esi),%eax
+    asm volatile("wrmsr" : : "c" (msr), "a" (lo), "d" (hi));
+80108e95:	b9 75 01 00 00       	mov    $0x175,%ecx
+80108e9a:	31 d2                	xor    %edx,%edx
+80108e9c:	05 00 10 00 00       	add    $0x1000,%eax
+80108ea1:	0f 30                	wrmsr
+    lcr3(V2P(p->pgdir));    // switch to process's address space
+80108ea3:	8b 46 04             	mov    0x4(%esi),%eax
+80108ea6:	05 00 00 00 80       	add    $0x80000000,%eax
+    asm volatile("movl %0,%%cr3" : : "r" (val));
+80108eab:	0f 22 d8             	mov    %eax,%cr3
+}
+80108eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108eb1:	5b                   	pop    %ebx
+80108eb2:	5e                   	pop    %esi
+80108eb3:	5f                   	pop    %edi
+80108eb4:	5d                   	pop    %ebp
+    popcli();
+80108eb5:	e9 96 82 ff ff       	jmp    80101150 <popcli>
+        panic("switchuvm: no pgdir");
+80108eba:	83 ec 0c             	sub    $0xc,%esp
+80108ebd:	68 b3 b8 10 80       	push   $0x8010b8b3
+80108ec2:	e8 79 0e 00 00       	call   80109d40 <panic>
+        panic("switchuvm: no kstack");
+80108ec7:	83 ec 0c             	sub    $0xc,%esp
+80108eca:	68 9e b8 10 80       	push   $0x8010b89e
+80108ecf:	e8 6c 0e 00 00       	call   80109d40 <panic>
+        panic("switchuvm: no process");
+80108ed4:	83 ec 0c             	sub    $0xc,%esp
+80108ed7:	68 88 b8 10 80       	push   $0x8010b888
+80108edc:	e8 5f 0e 00 00       	call   80109d40 <panic>
+80108ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ee8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108eef:	90                   	nop
+
+80108ef0 <inituvm>:
+{
+80108ef0:	55                   	push   %ebp
+80108ef1:	89 e5                	mov    %esp,%ebp
+80108ef3:	57                   	push   %edi
+80108ef4:	56                   	push   %esi
+80108ef5:	53                   	push   %ebx
+80108ef6:	83 ec 1c             	sub    $0x1c,%esp
+80108ef9:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108efc:	8b 75 10             	mov    0x10(%ebp),%esi
+80108eff:	8b 7d 08             	mov    0x8(%ebp),%edi
+80108f02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if (sz >= PGSIZE)
+80108f05:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+80108f0b:	77 70                	ja     80108f7d <inituvm+0x8d>
+    mem = kalloc();
+80108f0d:	e8 2e f2 ff ff       	call   80108140 <kalloc>
+    pagezero(mem);
+80108f12:	83 ec 0c             	sub    $0xc,%esp
+80108f15:	50                   	push   %eax
+    mem = kalloc();
+80108f16:	89 c3                	mov    %eax,%ebx
+    pagezero(mem);
+80108f18:	e8 93 ef ff ff       	call   80107eb0 <pagezero>
+    mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W | PTE_U);
+80108f1d:	58                   	pop    %eax
+80108f1e:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80108f24:	5a                   	pop    %edx
+80108f25:	6a 06                	push   $0x6
+80108f27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80108f2c:	31 d2                	xor    %edx,%edx
+80108f2e:	50                   	push   %eax
+80108f2f:	89 f8                	mov    %edi,%eax
+80108f31:	e8 ba fc ff ff       	call   80108bf0 <mappages>
+    memmove(mem, init, sz);
+80108f36:	83 c4 0c             	add    $0xc,%esp
+80108f39:	56                   	push   %esi
+80108f3a:	ff 75 e4             	push   -0x1c(%ebp)
+80108f3d:	53                   	push   %ebx
+80108f3e:	e8 8d 71 ff ff       	call   801000d0 <memmove>
+    mem = kalloc();
+80108f43:	e8 f8 f1 ff ff       	call   80108140 <kalloc>
+    pagezero(mem);
+80108f48:	89 04 24             	mov    %eax,(%esp)
+    mem = kalloc();
+80108f4b:	89 c3                	mov    %eax,%ebx
+    mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U);
+80108f4d:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+    pagezero(mem);
+80108f53:	e8 58 ef ff ff       	call   80107eb0 <pagezero>
+    mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U);
+80108f58:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80108f5b:	83 c4 10             	add    $0x10,%esp
+80108f5e:	89 f8                	mov    %edi,%eax
+80108f60:	c7 45 0c 04 00 00 00 	movl   $0x4,0xc(%ebp)
+}
+80108f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U);
+80108f6a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80108f6f:	ba 00 e0 ff 7f       	mov    $0x7fffe000,%edx
+}
+80108f74:	5b                   	pop    %ebx
+80108f75:	5e                   	pop    %esi
+80108f76:	5f                   	pop    %edi
+80108f77:	5d                   	pop    %ebp
+    mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U);
+80108f78:	e9 73 fc ff ff       	jmp    80108bf0 <mappages>
+        panic("inituvm: initcode more than a page");
+80108f7d:	83 ec 0c             	sub    $0xc,%esp
+80108f80:	68 d8 b8 10 80       	push   $0x8010b8d8
+80108f85:	e8 b6 0d 00 00       	call   80109d40 <panic>
+80108f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108f90 <uva2ka>:
+{
+80108f90:	55                   	push   %ebp
+80108f91:	89 e5                	mov    %esp,%ebp
+80108f93:	8b 55 0c             	mov    0xc(%ebp),%edx
+    if(*pde & PTE_P){
+80108f96:	8b 45 08             	mov    0x8(%ebp),%eax
+    pde = &pgdir[PDX(va)];
+80108f99:	89 d1                	mov    %edx,%ecx
+80108f9b:	c1 e9 16             	shr    $0x16,%ecx
+    if(*pde & PTE_P){
+80108f9e:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+        return 0;
+80108fa1:	31 c0                	xor    %eax,%eax
+    if(*pde & PTE_P){
+80108fa3:	f6 c1 01             	test   $0x1,%cl
+80108fa6:	74 36                	je     80108fde <uva2ka+0x4e>
+    return &pgtab[PTX(va)];
+80108fa8:	c1 ea 0a             	shr    $0xa,%edx
+        pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80108fab:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+    return &pgtab[PTX(va)];
+80108fb1:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+80108fb7:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+    if (pte == 0 || (*pte & PTE_P) == 0)
+80108fbe:	85 c0                	test   %eax,%eax
+80108fc0:	74 1c                	je     80108fde <uva2ka+0x4e>
+80108fc2:	8b 00                	mov    (%eax),%eax
+    if ((*pte & PTE_U) == 0)
+80108fc4:	89 c2                	mov    %eax,%edx
+    return (char*)P2V(PTE_ADDR(*pte));
+80108fc6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if ((*pte & PTE_U) == 0)
+80108fcb:	83 e2 05             	and    $0x5,%edx
+    return (char*)P2V(PTE_ADDR(*pte));
+80108fce:	05 00 00 00 80       	add    $0x80000000,%eax
+80108fd3:	83 fa 05             	cmp    $0x5,%edx
+80108fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+80108fdb:	0f 45 c2             	cmovne %edx,%eax
+}
+80108fde:	5d                   	pop    %ebp
+80108fdf:	c3                   	ret
+
+80108fe0 <deallocuvm>:
+{
+80108fe0:	55                   	push   %ebp
+80108fe1:	89 e5                	mov    %esp,%ebp
+80108fe3:	8b 55 0c             	mov    0xc(%ebp),%edx
+80108fe6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+80108fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+    if (newsz >= oldsz)
+80108fec:	39 d1                	cmp    %edx,%ecx
+80108fee:	73 10                	jae    80109000 <deallocuvm+0x20>
+}
+80108ff0:	5d                   	pop    %ebp
+80108ff1:	e9 4a fb ff ff       	jmp    80108b40 <deallocuvm.part.0>
+80108ff6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ffd:	8d 76 00             	lea    0x0(%esi),%esi
+80109000:	89 d0                	mov    %edx,%eax
+80109002:	5d                   	pop    %ebp
+80109003:	c3                   	ret
+80109004:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010900b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010900f:	90                   	nop
+
+80109010 <freevm>:
+
+// free a page table and all the physical memory pages in user part.
+void
+freevm(pde_t *pgdir)
+{
+80109010:	55                   	push   %ebp
+80109011:	89 e5                	mov    %esp,%ebp
+80109013:	57                   	push   %edi
+80109014:	56                   	push   %esi
+80109015:	53                   	push   %ebx
+80109016:	83 ec 0c             	sub    $0xc,%esp
+80109019:	8b 75 08             	mov    0x8(%ebp),%esi
+    uint i;
+
+    if (pgdir == 0)
+8010901c:	85 f6                	test   %esi,%esi
+8010901e:	74 59                	je     80109079 <freevm+0x69>
+    if (newsz >= oldsz)
+80109020:	31 c9                	xor    %ecx,%ecx
+80109022:	ba 00 f0 ff 7f       	mov    $0x7ffff000,%edx
+80109027:	89 f0                	mov    %esi,%eax
+80109029:	89 f3                	mov    %esi,%ebx
+8010902b:	e8 10 fb ff ff       	call   80108b40 <deallocuvm.part.0>
+        panic("freevm: no pgdir");
+    // free pa, including the VDSOPROC page but not the shared VDSO page
+    deallocuvm(pgdir, VDSO, 0);
+    // free pte
+    for (i = 0; i < NPDENTRIES; i++) {
+80109030:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+80109036:	eb 0f                	jmp    80109047 <freevm+0x37>
+80109038:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010903f:	90                   	nop
+80109040:	83 c3 04             	add    $0x4,%ebx
+80109043:	39 fb                	cmp    %edi,%ebx
+80109045:	74 23                	je     8010906a <freevm+0x5a>
+        if (pgdir[i] & PTE_P) {
+80109047:	8b 03                	mov    (%ebx),%eax
+80109049:	a8 01                	test   $0x1,%al
+8010904b:	74 f3                	je     80109040 <freevm+0x30>
+            char *v = P2V(PTE_ADDR(pgdir[i]));
+8010904d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+            kfree(v);
+80109052:	83 ec 0c             	sub    $0xc,%esp
+    for (i = 0; i < NPDENTRIES; i++) {
+80109055:	83 c3 04             	add    $0x4,%ebx
+            char *v = P2V(PTE_ADDR(pgdir[i]));
+80109058:	05 00 00 00 80       	add    $0x80000000,%eax
+            kfree(v);
+8010905d:	50                   	push   %eax
+8010905e:	e8 ed ee ff ff       	call   80107f50 <kfree>
+80109063:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < NPDENTRIES; i++) {
+80109066:	39 fb                	cmp    %edi,%ebx
+80109068:	75 dd                	jne    80109047 <freevm+0x37>
+        }
+    }
+    // free pde
+    kfree((char*)pgdir);
+8010906a:	89 75 08             	mov    %esi,0x8(%ebp)
+8010906d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109070:	5b                   	pop    %ebx
+80109071:	5e                   	pop    %esi
+80109072:	5f                   	pop    %edi
+80109073:	5d                   	pop    %ebp
+    kfree((char*)pgdir);
+80109074:	e9 d7 ee ff ff       	jmp    80107f50 <kfree>
+        panic("freevm: no pgdir");
+80109079:	83 ec 0c             	sub    $0xc,%esp
+8010907c:	68 c7 b8 10 80       	push   $0x8010b8c7
+80109081:	e8 ba 0c 00 00       	call   80109d40 <panic>
+80109086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010908d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109090 <setupkvm>:
+{
+80109090:	55                   	push   %ebp
+80109091:	89 e5                	mov    %esp,%ebp
+80109093:	56                   	push   %esi
+80109094:	53                   	push   %ebx
+    if ((pgdir = (pde_t*)kalloc()) == 0)
+80109095:	e8 a6 f0 ff ff       	call   80108140 <kalloc>
+8010909a:	85 c0                	test   %eax,%eax
+8010909c:	74 56                	je     801090f4 <setupkvm+0x64>
+    pagezero(pgdir);
+8010909e:	83 ec 0c             	sub    $0xc,%esp
+801090a1:	89 c6                	mov    %eax,%esi
+    for (k = kmap; k < &kmap[NELEM(kmap)]; k++) {
+801090a3:	bb 40 c0 10 80       	mov    $0x8010c040,%ebx
+    pagezero(pgdir);
+801090a8:	50                   	push   %eax
+801090a9:	e8 02 ee ff ff       	call   80107eb0 <pagezero>
+801090ae:	83 c4 10             	add    $0x10,%esp
+        if (mappages(pgdir, k->virt, k->phys_end - k->phys_start, (uint) k->phys_start, k->perm) < 0) {
+801090b1:	8b 43 04             	mov    0x4(%ebx),%eax
+801090b4:	83 ec 08             	sub    $0x8,%esp
+801090b7:	8b 4b 08             	mov    0x8(%ebx),%ecx
+801090ba:	8b 13                	mov    (%ebx),%edx
+801090bc:	ff 73 0c             	push   0xc(%ebx)
+801090bf:	50                   	push   %eax
+801090c0:	29 c1                	sub    %eax,%ecx
+801090c2:	89 f0                	mov    %esi,%eax
+801090c4:	e8 27 fb ff ff       	call   80108bf0 <mappages>
+801090c9:	83 c4 10             	add    $0x10,%esp
+801090cc:	85 c0                	test   %eax,%eax
+801090ce:	78 18                	js     801090e8 <setupkvm+0x58>
+    for (k = kmap; k < &kmap[NELEM(kmap)]; k++) {
+801090d0:	83 c3 10             	add    $0x10,%ebx
+801090d3:	81 fb 90 c0 10 80    	cmp    $0x8010c090,%ebx
+801090d9:	75 d6                	jne    801090b1 <setupkvm+0x21>
+}
+801090db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801090de:	89 f0                	mov    %esi,%eax
+801090e0:	5b                   	pop    %ebx
+801090e1:	5e                   	pop    %esi
+801090e2:	5d                   	pop    %ebp
+801090e3:	c3                   	ret
+801090e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            freevm(pgdir);
+801090e8:	83 ec 0c             	sub    $0xc,%esp
+801090eb:	56                   	push   %esi
+801090ec:	e8 1f ff ff ff       	call   80109010 <freevm>
+            return 0;
+801090f1:	83 c4 10             	add    $0x10,%esp
+}
+801090f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+        return 0;
+801090f7:	31 f6                	xor    %esi,%esi
+}
+801090f9:	89 f0                	mov    %esi,%eax
+801090fb:	5b                   	pop    %ebx
+801090fc:	5e                   	pop    %esi
+801090fd:	5d                   	pop    %ebp
+801090fe:	c3                   	ret
+801090ff:	90                   	nop
+
+80109100 <kvmalloc>:
+{
+80109100:	55                   	push   %ebp
+80109101:	89 e5                	mov    %esp,%ebp
+80109103:	83 ec 08             	sub    $0x8,%esp
+    kpgdir = setupkvm();
+80109106:	e8 85 ff ff ff       	call   80109090 <setupkvm>
+8010910b:	a3 40 ac 1c 80       	mov    %eax,0x801cac40
+    lcr3(V2P(kpgdir));
+80109110:	05 00 00 00 80       	add    $0x80000000,%eax
+80109115:	0f 22 d8             	mov    %eax,%cr3
+}
+80109118:	c9                   	leave
+80109119:	c3                   	ret
+8010911a:	66 90                	xchg   %ax,%ax
+8010911c:	66 90                	xchg   %ax,%ax
+8010911e:	66 90                	xchg   %ax,%ax
+
+80109120 <vdsoinit>:
+    return (uint)(rdtsc() - t0) / CALMS;
+}
+
+void
+vdsoinit(void)
+{
+80109120:	55                   	push   %ebp
+80109121:	89 e5                	mov    %esp,%ebp
+80109123:	53                   	push   %ebx
+80109124:	83 ec 04             	sub    $0x4,%esp
+    int i;
+
+    if (sizeof(struct vdso) > PGSIZE || sizeof(struct vdsoproc) > PGSIZE)
+        panic("vdsoinit: too big");
+
+    vdso->ncpu = ncpu;
+80109127:	8b 1d 48 c6 18 80    	mov    0x8018c648,%ebx
+8010912d:	89 1d 14 b0 1c 80    	mov    %ebx,0x801cb014
+    for (i = 0; i < ncpu; i++)
+80109133:	85 db                	test   %ebx,%ebx
+80109135:	7e 1f                	jle    80109156 <vdsoinit+0x36>
+80109137:	ba 80 c6 18 80       	mov    $0x8018c680,%edx
+8010913c:	31 c0                	xor    %eax,%eax
+8010913e:	66 90                	xchg   %ax,%ax
+        vdso->apiccpu[cpus[i].apicid] = i;
+80109140:	0f b6 0a             	movzbl (%edx),%ecx
+    for (i = 0; i < ncpu; i++)
+80109143:	81 c2 c0 00 00 00    	add    $0xc0,%edx
+        vdso->apiccpu[cpus[i].apicid] = i;
+80109149:	88 81 18 b0 1c 80    	mov    %al,-0x7fe34fe8(%ecx)
+    for (i = 0; i < ncpu; i++)
+8010914f:	83 c0 01             	add    $0x1,%eax
+80109152:	39 c3                	cmp    %eax,%ebx
+80109154:	75 ea                	jne    80109140 <vdsoinit+0x20>
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109156:	ba 61 00 00 00       	mov    $0x61,%edx
+8010915b:	ec                   	in     (%dx),%al
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010915c:	83 e0 fc             	and    $0xfffffffc,%eax
+8010915f:	83 c8 01             	or     $0x1,%eax
+80109162:	ee                   	out    %al,(%dx)
+80109163:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+80109168:	ba 43 00 00 00       	mov    $0x43,%edx
+8010916d:	ee                   	out    %al,(%dx)
+8010916e:	ba 42 00 00 00       	mov    $0x42,%edx
+80109173:	b8 9a ff ff ff       	mov    $0xffffff9a,%eax
+80109178:	ee                   	out    %al,(%dx)
+80109179:	b8 2e 00 00 00       	mov    $0x2e,%eax
+8010917e:	ee                   	out    %al,(%dx)
+    asm volatile("rdtsc" : "=A" (tsc));
+8010917f:	0f 31                	rdtsc
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109181:	ba 61 00 00 00       	mov    $0x61,%edx
+    asm volatile("rdtsc" : "=A" (tsc));
+80109186:	89 c1                	mov    %eax,%ecx
+    while ((inb(PIT_GATE) & 0x20) == 0)
+80109188:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010918f:	90                   	nop
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109190:	ec                   	in     (%dx),%al
+80109191:	a8 20                	test   $0x20,%al
+80109193:	74 fb                	je     80109190 <vdsoinit+0x70>
+    asm volatile("rdtsc" : "=A" (tsc));
+80109195:	0f 31                	rdtsc
+    return (uint)(rdtsc() - t0) / CALMS;
+80109197:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+8010919c:	29 c8                	sub    %ecx,%eax
+    vdso->tsc_khz = tsccalibrate();
+    cprintf("vdso: tsc %d kHz\n", vdso->tsc_khz);
+8010919e:	83 ec 08             	sub    $0x8,%esp
+    return (uint)(rdtsc() - t0) / CALMS;
+801091a1:	f7 e2                	mul    %edx
+801091a3:	c1 ea 03             	shr    $0x3,%edx
+    vdso->tsc_khz = tsccalibrate();
+801091a6:	89 15 10 b0 1c 80    	mov    %edx,0x801cb010
+    cprintf("vdso: tsc %d kHz\n", vdso->tsc_khz);
+801091ac:	52                   	push   %edx
+801091ad:	68 fb b8 10 80       	push   $0x8010b8fb
+801091b2:	e8 09 0c 00 00       	call   80109dc0 <cprintf>
+}
+801091b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801091ba:	83 c4 10             	add    $0x10,%esp
+801091bd:	c9                   	leave
+801091be:	c3                   	ret
+801091bf:	90                   	nop
+
+801091c0 <tsckhz>:
+// tsc cycles per millisecond, 0 if unknown
+uint
+tsckhz(void)
+{
+    return vdso->tsc_khz;
+}
+801091c0:	a1 10 b0 1c 80       	mov    0x801cb010,%eax
+801091c5:	c3                   	ret
+801091c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801091cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801091d0 <vdsotick>:
+
+// called from the timer interrupt with tickslock held,
+// which makes it the only writer.
+void
+vdsotick(uint t)
+{
+801091d0:	55                   	push   %ebp
+801091d1:	89 e5                	mov    %esp,%ebp
+801091d3:	53                   	push   %ebx
+801091d4:	0f 31                	rdtsc
+801091d6:	89 d3                	mov    %edx,%ebx
+    uint64 tsc = rdtsc();
+
+    vdso->seq++;
+801091d8:	8b 15 00 b0 1c 80    	mov    0x801cb000,%edx
+801091de:	89 c1                	mov    %eax,%ecx
+801091e0:	83 c2 01             	add    $0x1,%edx
+801091e3:	89 15 00 b0 1c 80    	mov    %edx,0x801cb000
+    __sync_synchronize();
+801091e9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    vdso->ticks = t;
+    vdso->tsc_lo = (uint)tsc;
+801091ee:	89 0d 08 b0 1c 80    	mov    %ecx,0x801cb008
+801091f4:	89 1d 0c b0 1c 80    	mov    %ebx,0x801cb00c
+    vdso->ticks = t;
+801091fa:	8b 45 08             	mov    0x8(%ebp),%eax
+801091fd:	a3 04 b0 1c 80       	mov    %eax,0x801cb004
+    vdso->tsc_hi = (uint)(tsc >> 32);
+    __sync_synchronize();
+80109202:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    vdso->seq++;
+80109207:	a1 00 b0 1c 80       	mov    0x801cb000,%eax
+8010920c:	83 c0 01             	add    $0x1,%eax
+8010920f:	a3 00 b0 1c 80       	mov    %eax,0x801cb000
+}
+80109214:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109217:	c9                   	leave
+80109218:	c3                   	ret
+80109219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109220 <vdsosetproc>:
+
+// fill in p's page at VDSOPROC, once p->pgdir has been set up by inituvm().
+void
+vdsosetproc(struct proc *p)
+{
+80109220:	55                   	push   %ebp
+80109221:	89 e5                	mov    %esp,%ebp
+80109223:	53                   	push   %ebx
+80109224:	83 ec 0c             	sub    $0xc,%esp
+80109227:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    struct vdsoproc *vp;
+
+    if ((vp = (struct vdsoproc*)uva2ka(p->pgdir, (char*)VDSOPROC)) == 0)
+8010922a:	68 00 e0 ff 7f       	push   $0x7fffe000
+8010922f:	ff 73 04             	push   0x4(%ebx)
+80109232:	e8 59 fd ff ff       	call   80108f90 <uva2ka>
+80109237:	83 c4 10             	add    $0x10,%esp
+8010923a:	85 c0                	test   %eax,%eax
+8010923c:	74 2e                	je     8010926c <vdsosetproc+0x4c>
+        panic("vdsosetproc");
+    vp->pid = p->pid;
+8010923e:	8b 53 10             	mov    0x10(%ebx),%edx
+80109241:	89 10                	mov    %edx,(%eax)
+    vp->ppid = p->parent ? p->parent->pid : 0;
+80109243:	8b 4b 14             	mov    0x14(%ebx),%ecx
+80109246:	31 d2                	xor    %edx,%edx
+80109248:	85 c9                	test   %ecx,%ecx
+8010924a:	74 03                	je     8010924f <vdsosetproc+0x2f>
+8010924c:	8b 51 10             	mov    0x10(%ecx),%edx
+8010924f:	89 50 04             	mov    %edx,0x4(%eax)
+    safestrcpy(vp->name, p->name, sizeof(vp->name));
+80109252:	83 ec 04             	sub    $0x4,%esp
+80109255:	83 c3 30             	add    $0x30,%ebx
+80109258:	83 c0 08             	add    $0x8,%eax
+8010925b:	6a 10                	push   $0x10
+8010925d:	53                   	push   %ebx
+8010925e:	50                   	push   %eax
+8010925f:	e8 8c 6f ff ff       	call   801001f0 <safestrcpy>
+}
+80109264:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109267:	83 c4 10             	add    $0x10,%esp
+8010926a:	c9                   	leave
+8010926b:	c3                   	ret
+        panic("vdsosetproc");
+8010926c:	83 ec 0c             	sub    $0xc,%esp
+8010926f:	68 0d b9 10 80       	push   $0x8010b90d
+80109274:	e8 c7 0a 00 00       	call   80109d40 <panic>
+80109279:	66 90                	xchg   %ax,%ax
+8010927b:	66 90                	xchg   %ax,%ax
+8010927d:	66 90                	xchg   %ax,%ax
+8010927f:	90                   	nop
+
+80109280 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+    if(!uart)
+80109280:	a1 00 c0 1c 80       	mov    0x801cc000,%eax
+80109285:	85 c0                	test   %eax,%eax
+80109287:	74 17                	je     801092a0 <uartgetc+0x20>
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109289:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010928e:	ec                   	in     (%dx),%al
+        return -1;
+    if(!(inb(COM1+5) & 0x01))
+8010928f:	a8 01                	test   $0x1,%al
+80109291:	74 0d                	je     801092a0 <uartgetc+0x20>
+80109293:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109298:	ec                   	in     (%dx),%al
+        return -1;
+    return inb(COM1+0);
+80109299:	0f b6 c0             	movzbl %al,%eax
+8010929c:	c3                   	ret
+8010929d:	8d 76 00             	lea    0x0(%esi),%esi
+        return -1;
+801092a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801092a5:	c3                   	ret
+801092a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801092ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801092b0 <uartinit>:
+{
+801092b0:	55                   	push   %ebp
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801092b1:	31 c9                	xor    %ecx,%ecx
+801092b3:	89 c8                	mov    %ecx,%eax
+801092b5:	89 e5                	mov    %esp,%ebp
+801092b7:	57                   	push   %edi
+801092b8:	bf fa 03 00 00       	mov    $0x3fa,%edi
+801092bd:	56                   	push   %esi
+801092be:	89 fa                	mov    %edi,%edx
+801092c0:	53                   	push   %ebx
+801092c1:	83 ec 0c             	sub    $0xc,%esp
+801092c4:	ee                   	out    %al,(%dx)
+801092c5:	be fb 03 00 00       	mov    $0x3fb,%esi
+801092ca:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+801092cf:	89 f2                	mov    %esi,%edx
+801092d1:	ee                   	out    %al,(%dx)
+801092d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+801092d7:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801092dc:	ee                   	out    %al,(%dx)
+801092dd:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+801092e2:	89 c8                	mov    %ecx,%eax
+801092e4:	89 da                	mov    %ebx,%edx
+801092e6:	ee                   	out    %al,(%dx)
+801092e7:	b8 03 00 00 00       	mov    $0x3,%eax
+801092ec:	89 f2                	mov    %esi,%edx
+801092ee:	ee                   	out    %al,(%dx)
+801092ef:	ba fc 03 00 00       	mov    $0x3fc,%edx
+801092f4:	89 c8                	mov    %ecx,%eax
+801092f6:	ee                   	out    %al,(%dx)
+801092f7:	b8 01 00 00 00       	mov    $0x1,%eax
+801092fc:	89 da                	mov    %ebx,%edx
+801092fe:	ee                   	out    %al,(%dx)
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801092ff:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109304:	ec                   	in     (%dx),%al
+    if(inb(COM1+5) == 0xFF)
+80109305:	3c ff                	cmp    $0xff,%al
+80109307:	74 22                	je     8010932b <uartinit+0x7b>
+    uart = 1;
+80109309:	c7 05 00 c0 1c 80 01 	movl   $0x1,0x801cc000
+80109310:	00 00 00 
+80109313:	89 fa                	mov    %edi,%edx
+80109315:	ec                   	in     (%dx),%al
+80109316:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010931b:	ec                   	in     (%dx),%al
+    ioapicenable(IRQ_COM1, 0);
+8010931c:	83 ec 08             	sub    $0x8,%esp
+8010931f:	6a 00                	push   $0x0
+80109321:	6a 04                	push   $0x4
+80109323:	e8 f8 74 ff ff       	call   80100820 <ioapicenable>
+80109328:	83 c4 10             	add    $0x10,%esp
+}
+8010932b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010932e:	5b                   	pop    %ebx
+8010932f:	5e                   	pop    %esi
+80109330:	5f                   	pop    %edi
+80109331:	5d                   	pop    %ebp
+80109332:	c3                   	ret
+80109333:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010933a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80109340 <uartputc>:
+    if(!uart)
+80109340:	a1 00 c0 1c 80       	mov    0x801cc000,%eax
+80109345:	85 c0                	test   %eax,%eax
+80109347:	74 4f                	je     80109398 <uartputc+0x58>
+{
+80109349:	55                   	push   %ebp
+8010934a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010934f:	89 e5                	mov    %esp,%ebp
+80109351:	56                   	push   %esi
+80109352:	53                   	push   %ebx
+80109353:	ec                   	in     (%dx),%al
+    for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109354:	a8 20                	test   $0x20,%al
+80109356:	75 29                	jne    80109381 <uartputc+0x41>
+80109358:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010935d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109362:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        microdelay(10);
+80109368:	83 ec 0c             	sub    $0xc,%esp
+8010936b:	6a 0a                	push   $0xa
+8010936d:	e8 8e 71 ff ff       	call   80100500 <microdelay>
+    for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109372:	83 c4 10             	add    $0x10,%esp
+80109375:	83 eb 01             	sub    $0x1,%ebx
+80109378:	74 07                	je     80109381 <uartputc+0x41>
+8010937a:	89 f2                	mov    %esi,%edx
+8010937c:	ec                   	in     (%dx),%al
+8010937d:	a8 20                	test   $0x20,%al
+8010937f:	74 e7                	je     80109368 <uartputc+0x28>
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109381:	8b 45 08             	mov    0x8(%ebp),%eax
+80109384:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109389:	ee                   	out    %al,(%dx)
+}
+8010938a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010938d:	5b                   	pop    %ebx
+8010938e:	5e                   	pop    %esi
+8010938f:	5d                   	pop    %ebp
+80109390:	c3                   	ret
+80109391:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109398:	c3                   	ret
+80109399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801093a0 <uartintr>:
+
+void
+uartintr(void)
+{
+801093a0:	55                   	push   %ebp
+801093a1:	89 e5                	mov    %esp,%ebp
+801093a3:	83 ec 14             	sub    $0x14,%esp
+    consoleintr(uartgetc);
+801093a6:	68 80 92 10 80       	push   $0x80109280
+801093ab:	e8 b0 06 00 00       	call   80109a60 <consoleintr>
+}
+801093b0:	83 c4 10             	add    $0x10,%esp
+801093b3:	c9                   	leave
+801093b4:	c3                   	ret
+801093b5:	66 90                	xchg   %ax,%ax
+801093b7:	66 90                	xchg   %ax,%ax
+801093b9:	66 90                	xchg   %ax,%ax
+801093bb:	66 90                	xchg   %ax,%ax
+801093bd:	66 90                	xchg   %ax,%ax
+801093bf:	90                   	nop
+
+801093c0 <kbdgetc>:
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801093c0:	ba 64 00 00 00       	mov    $0x64,%edx
+801093c5:	ec                   	in     (%dx),%al
+            ctlmap,
+    };
+    uint st, data, c;
+
+    st = inb(KBSTATP);
+    if ((st & KBS_DIB) == 0)
+801093c6:	a8 01                	test   $0x1,%al
+801093c8:	0f 84 d2 00 00 00    	je     801094a0 <kbdgetc+0xe0>
+801093ce:	ba 60 00 00 00       	mov    $0x60,%edx
+801093d3:	ec                   	in     (%dx),%al
+        return -1;
+    data = inb(KBDATAP);
+
+    if (data == 0xE0) {
+        shift |= E0ESC;
+801093d4:	8b 0d 04 c0 1c 80    	mov    0x801cc004,%ecx
+    data = inb(KBDATAP);
+801093da:	0f b6 d0             	movzbl %al,%edx
+    if (data == 0xE0) {
+801093dd:	3c e0                	cmp    $0xe0,%al
+801093df:	74 77                	je     80109458 <kbdgetc+0x98>
+{
+801093e1:	55                   	push   %ebp
+801093e2:	89 e5                	mov    %esp,%ebp
+801093e4:	53                   	push   %ebx
+        return 0;
+    } else if (data & 0x80) {
+        // key released
+        data = (shift & E0ESC ? data : data &0x7F);
+801093e5:	89 cb                	mov    %ecx,%ebx
+801093e7:	83 e3 40             	and    $0x40,%ebx
+{
+801093ea:	83 ec 04             	sub    $0x4,%esp
+    } else if (data & 0x80) {
+801093ed:	84 c0                	test   %al,%al
+801093ef:	78 77                	js     80109468 <kbdgetc+0xa8>
+        shift &= ~(shiftcode[data] | E0ESC);
+        return 0;
+    } else if (shift & E0ESC) {
+801093f1:	85 db                	test   %ebx,%ebx
+801093f3:	74 09                	je     801093fe <kbdgetc+0x3e>
+        // last character was an E0 escape; or with 0x80
+        data |= 0x80;
+801093f5:	83 c8 80             	or     $0xffffff80,%eax
+        shift &= ~E0ESC;
+801093f8:	83 e1 bf             	and    $0xffffffbf,%ecx
+        data |= 0x80;
+801093fb:	0f b6 d0             	movzbl %al,%edx
+    }
+
+    shift |= shiftcode[data];
+801093fe:	0f b6 82 60 ba 10 80 	movzbl -0x7fef45a0(%edx),%eax
+80109405:	09 c8                	or     %ecx,%eax
+    shift ^= togglecode[data];
+80109407:	0f b6 8a 60 b9 10 80 	movzbl -0x7fef46a0(%edx),%ecx
+8010940e:	31 c8                	xor    %ecx,%eax
+    c = charcode[shift & (CTL | SHIFT)][data];
+80109410:	89 c1                	mov    %eax,%ecx
+    shift ^= togglecode[data];
+80109412:	a3 04 c0 1c 80       	mov    %eax,0x801cc004
+    c = charcode[shift & (CTL | SHIFT)][data];
+80109417:	83 e1 03             	and    $0x3,%ecx
+8010941a:	8b 0c 8d 40 b9 10 80 	mov    -0x7fef46c0(,%ecx,4),%ecx
+80109421:	0f b6 1c 11          	movzbl (%ecx,%edx,1),%ebx
+    if (shift & CAPSLOCK) {
+80109425:	a8 08                	test   $0x8,%al
+80109427:	75 1f                	jne    80109448 <kbdgetc+0x88>
+        if ('a' <= c && c <= 'z')
+            c += 'A' - 'a';
+        else if ('A' <= c && c <= 'Z')
+            c += 'a' - 'A';
+    }
+    cprintf("KBD got a char: %d\n", c);
+80109429:	83 ec 08             	sub    $0x8,%esp
+8010942c:	53                   	push   %ebx
+8010942d:	68 19 b9 10 80       	push   $0x8010b919
+80109432:	e8 89 09 00 00       	call   80109dc0 <cprintf>
+    return c;
+80109437:	89 d8                	mov    %ebx,%eax
+80109439:	83 c4 10             	add    $0x10,%esp
+}
+8010943c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010943f:	c9                   	leave
+80109440:	c3                   	ret
+80109441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if ('a' <= c && c <= 'z')
+80109448:	8d 43 9f             	lea    -0x61(%ebx),%eax
+8010944b:	83 f8 19             	cmp    $0x19,%eax
+8010944e:	77 40                	ja     80109490 <kbdgetc+0xd0>
+            c += 'A' - 'a';
+80109450:	83 eb 20             	sub    $0x20,%ebx
+80109453:	eb d4                	jmp    80109429 <kbdgetc+0x69>
+80109455:	8d 76 00             	lea    0x0(%esi),%esi
+        shift |= E0ESC;
+80109458:	89 c8                	mov    %ecx,%eax
+8010945a:	83 c8 40             	or     $0x40,%eax
+        shift &= ~(shiftcode[data] | E0ESC);
+8010945d:	a3 04 c0 1c 80       	mov    %eax,0x801cc004
+        return 0;
+80109462:	31 c0                	xor    %eax,%eax
+}
+80109464:	c3                   	ret
+80109465:	8d 76 00             	lea    0x0(%esi),%esi
+        data = (shift & E0ESC ? data : data &0x7F);
+80109468:	83 e0 7f             	and    $0x7f,%eax
+8010946b:	85 db                	test   %ebx,%ebx
+8010946d:	0f 44 d0             	cmove  %eax,%edx
+        shift &= ~(shiftcode[data] | E0ESC);
+80109470:	0f b6 82 60 ba 10 80 	movzbl -0x7fef45a0(%edx),%eax
+80109477:	83 c8 40             	or     $0x40,%eax
+8010947a:	0f b6 c0             	movzbl %al,%eax
+8010947d:	f7 d0                	not    %eax
+8010947f:	21 c8                	and    %ecx,%eax
+80109481:	a3 04 c0 1c 80       	mov    %eax,0x801cc004
+        return 0;
+80109486:	31 c0                	xor    %eax,%eax
+}
+80109488:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010948b:	c9                   	leave
+8010948c:	c3                   	ret
+8010948d:	8d 76 00             	lea    0x0(%esi),%esi
+        else if ('A' <= c && c <= 'Z')
+80109490:	8d 53 bf             	lea    -0x41(%ebx),%edx
+            c += 'a' - 'A';
+80109493:	8d 43 20             	lea    0x20(%ebx),%eax
+80109496:	83 fa 1a             	cmp    $0x1a,%edx
+80109499:	0f 42 d8             	cmovb  %eax,%ebx
+8010949c:	eb 8b                	jmp    80109429 <kbdgetc+0x69>
+8010949e:	66 90                	xchg   %ax,%ax
+        return -1;
+801094a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801094a5:	c3                   	ret
+801094a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801094ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801094b0 <kbdintr>:
+
+void
+kbdintr(void)
+{
+801094b0:	55                   	push   %ebp
+801094b1:	89 e5                	mov    %esp,%ebp
+801094b3:	83 ec 14             	sub    $0x14,%esp
+    consoleintr(kbdgetc);
+801094b6:	68 c0 93 10 80       	push   $0x801093c0
+801094bb:	e8 a0 05 00 00       	call   80109a60 <consoleintr>
+801094c0:	83 c4 10             	add    $0x10,%esp
+801094c3:	c9                   	leave
+801094c4:	c3                   	ret
+
+801094c5 <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+801094c5:	1e                   	push   %ds
+  pushl %es
+801094c6:	06                   	push   %es
+  pushl %fs
+801094c7:	0f a0                	push   %fs
+  pushl %gs
+801094c9:	0f a8                	push   %gs
+  pushal
+801094cb:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+801094cc:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801094d0:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+801094d2:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+801094d4:	54                   	push   %esp
+  call trap
+801094d5:	e8 06 01 00 00       	call   801095e0 <trap>
+  addl $4, %esp
+801094da:	83 c4 04             	add    $0x4,%esp
+
+801094dd <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+801094dd:	61                   	popa
+  popl %gs
+801094de:	0f a9                	pop    %gs
+  popl %fs
+801094e0:	0f a1                	pop    %fs
+  popl %es
+801094e2:	07                   	pop    %es
+  popl %ds
+801094e3:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801094e4:	83 c4 08             	add    $0x8,%esp
+  iret
+801094e7:	cf                   	iret
+
+801094e8 <sysenter_entry>:
+  # in %edx and user %esp in %ecx. Build the same trap frame that
+  # int $T_SYSCALL would have, so trap() and syscall() can't tell
+  # the difference.
+.globl sysenter_entry
+sysenter_entry:
+  pushl $(SEG_UDATA<<3|DPL_USER)  # ss
+801094e8:	6a 23                	push   $0x23
+  pushl %ecx                      # esp
+801094ea:	51                   	push   %ecx
+  pushfl                          # eflags
+801094eb:	9c                   	pushf
+  pushl $(SEG_UCODE<<3|DPL_USER)  # cs
+801094ec:	6a 1b                	push   $0x1b
+  pushl %edx                      # eip
+801094ee:	52                   	push   %edx
+  pushl $0                        # errcode
+801094ef:	6a 00                	push   $0x0
+  pushl $T_SYSCALL                # trapno
+801094f1:	6a 40                	push   $0x40
+  pushl %ds
+801094f3:	1e                   	push   %ds
+  pushl %es
+801094f4:	06                   	push   %es
+  pushl %fs
+801094f5:	0f a0                	push   %fs
+  pushl %gs
+801094f7:	0f a8                	push   %gs
+  pushal
+801094f9:	60                   	pusha
+
+  movw $(SEG_KDATA<<3), %ax
+801094fa:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801094fe:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80109500:	8e c0                	mov    %eax,%es
+
+  # int $T_SYSCALL goes through a trap gate, which leaves
+  # interrupts on; do the same now that the frame is complete.
+  sti
+80109502:	fb                   	sti
+
+  pushl %esp
+80109503:	54                   	push   %esp
+  call trap
+80109504:	e8 d7 00 00 00       	call   801095e0 <trap>
+  addl $4, %esp
+80109509:	83 c4 04             	add    $0x4,%esp
+
+  # Return with sysexit, which takes %eip from %edx and %esp from %ecx.
+  cli
+8010950c:	fa                   	cli
+  popal
+8010950d:	61                   	popa
+  popl %gs
+8010950e:	0f a9                	pop    %gs
+  popl %fs
+80109510:	0f a1                	pop    %fs
+  popl %es
+80109512:	07                   	pop    %es
+  popl %ds
+80109513:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80109514:	83 c4 08             	add    $0x8,%esp
+  popl %edx        # eip
+80109517:	5a                   	pop    %edx
+  addl $0x4, %esp  # cs
+80109518:	83 c4 04             	add    $0x4,%esp
+  popfl            # eflags, with interrupts still off
+8010951b:	9d                   	popf
+  popl %ecx        # esp
+8010951c:	59                   	pop    %ecx
+  addl $0x4, %esp  # ss
+8010951d:	83 c4 04             	add    $0x4,%esp
+  # user code always runs with interrupts on; sti holds them off
+  # until after the next instruction, so none can arrive on the
+  # kernel stack once it has been given back.
+  sti
+80109520:	fb                   	sti
+  sysexit
+80109521:	0f 35                	sysexit
+80109523:	66 90                	xchg   %ax,%ax
+80109525:	66 90                	xchg   %ax,%ax
+80109527:	66 90                	xchg   %ax,%ax
+80109529:	66 90                	xchg   %ax,%ax
+8010952b:	66 90                	xchg   %ax,%ax
+8010952d:	66 90                	xchg   %ax,%ax
+8010952f:	90                   	nop
+
+80109530 <tvinit>:
+struct spinlock tickslock;
+uint ticks;
+
+void
+tvinit(void)
+{
+80109530:	55                   	push   %ebp
+    int i;
+
+    for (i = 0; i < 25; i++)
+80109531:	31 c0                	xor    %eax,%eax
+{
+80109533:	89 e5                	mov    %esp,%ebp
+80109535:	83 ec 08             	sub    $0x8,%esp
+80109538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010953f:	90                   	nop
+        SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80109540:	8b 14 85 a0 c3 10 80 	mov    -0x7fef3c60(,%eax,4),%edx
+80109547:	c7 04 c5 a2 c0 1c 80 	movl   $0x8e000008,-0x7fe33f5e(,%eax,8)
+8010954e:	08 00 00 8e 
+80109552:	66 89 14 c5 a0 c0 1c 	mov    %dx,-0x7fe33f60(,%eax,8)
+80109559:	80 
+8010955a:	c1 ea 10             	shr    $0x10,%edx
+8010955d:	66 89 14 c5 a6 c0 1c 	mov    %dx,-0x7fe33f5a(,%eax,8)
+80109564:	80 
+    for (i = 0; i < 25; i++)
+80109565:	83 c0 01             	add    $0x1,%eax
+80109568:	83 f8 19             	cmp    $0x19,%eax
+8010956b:	75 d3                	jne    80109540 <tvinit+0x10>
+    SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+8010956d:	a1 a0 c4 10 80       	mov    0x8010c4a0,%eax
+
+    initlock(&tickslock, "time");
+80109572:	83 ec 08             	sub    $0x8,%esp
+    SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80109575:	c7 05 a2 c2 1c 80 08 	movl   $0xef000008,0x801cc2a2
+8010957c:	00 00 ef 
+8010957f:	66 a3 a0 c2 1c 80    	mov    %ax,0x801cc2a0
+80109585:	c1 e8 10             	shr    $0x10,%eax
+80109588:	66 a3 a6 c2 1c 80    	mov    %ax,0x801cc2a6
+    initlock(&tickslock, "time");
+8010958e:	68 60 bb 10 80       	push   $0x8010bb60
+80109593:	68 40 c0 1c 80       	push   $0x801cc040
+80109598:	e8 a3 7a ff ff       	call   80101040 <initlock>
+}
+8010959d:	83 c4 10             	add    $0x10,%esp
+801095a0:	c9                   	leave
+801095a1:	c3                   	ret
+801095a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801095b0 <idtinit>:
+
+void
+idtinit(void)
+{
+801095b0:	55                   	push   %ebp
+    pd[0] = size-1;
+801095b1:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+801095b6:	89 e5                	mov    %esp,%ebp
+801095b8:	83 ec 10             	sub    $0x10,%esp
+801095bb:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+    pd[1] = (uint)p;
+801095bf:	b8 a0 c0 1c 80       	mov    $0x801cc0a0,%eax
+801095c4:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+    pd[2] = (uint)p >> 16;
+801095c8:	c1 e8 10             	shr    $0x10,%eax
+801095cb:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+    asm volatile("lidt (%0)" : : "r" (pd));
+801095cf:	8d 45 fa             	lea    -0x6(%ebp),%eax
+801095d2:	0f 01 18             	lidtl  (%eax)
+    lidt(idt, sizeof(idt));
+}
+801095d5:	c9                   	leave
+801095d6:	c3                   	ret
+801095d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095de:	66 90                	xchg   %ax,%ax
+
+801095e0 <trap>:
+
+void
+trap(struct trapframe *tf)
+{
+801095e0:	55                   	push   %ebp
+801095e1:	89 e5                	mov    %esp,%ebp
+801095e3:	56                   	push   %esi
+801095e4:	53                   	push   %ebx
+801095e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    if (tf->trapno == T_SYSCALL) {
+801095e8:	8b 43 30             	mov    0x30(%ebx),%eax
+801095eb:	83 f8 40             	cmp    $0x40,%eax
+801095ee:	0f 84 1c 01 00 00    	je     80109710 <trap+0x130>
+        syscall();
+        if (myproc()->killed)
+            exit();
+        return;
+    }
+    if (tf->trapno >= T_IRQ0)
+801095f4:	83 f8 1f             	cmp    $0x1f,%eax
+801095f7:	77 27                	ja     80109620 <trap+0x40>
+        kstatinc(KS_INTR);
+    switch (tf->trapno) {
+801095f9:	83 f8 07             	cmp    $0x7,%eax
+801095fc:	0f 84 46 01 00 00    	je     80109748 <trap+0x168>
+            if (tf->trapno >= T_IRQ0 && pciintr(tf->trapno - T_IRQ0)) {
+                lapiceoi();
+                break;
+            }
+            // todo: unknown interrupt, print error information here
+            cprintf("trap: unknown interrupt number: 0x%x\n", tf->trapno);
+80109602:	83 ec 08             	sub    $0x8,%esp
+80109605:	50                   	push   %eax
+80109606:	68 cc bb 10 80       	push   $0x8010bbcc
+8010960b:	e8 b0 07 00 00       	call   80109dc0 <cprintf>
+80109610:	83 c4 10             	add    $0x10,%esp
+    }
+
+    // todo: deal with proc relevant operation
+80109613:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109616:	5b                   	pop    %ebx
+80109617:	5e                   	pop    %esi
+80109618:	5d                   	pop    %ebp
+80109619:	c3                   	ret
+8010961a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        kstatinc(KS_INTR);
+80109620:	83 ec 0c             	sub    $0xc,%esp
+80109623:	6a 01                	push   $0x1
+80109625:	e8 a6 ce ff ff       	call   801064d0 <kstatinc>
+    switch (tf->trapno) {
+8010962a:	8b 43 30             	mov    0x30(%ebx),%eax
+8010962d:	83 c4 10             	add    $0x10,%esp
+80109630:	83 f8 07             	cmp    $0x7,%eax
+80109633:	0f 84 0f 01 00 00    	je     80109748 <trap+0x168>
+80109639:	8d 50 e0             	lea    -0x20(%eax),%edx
+8010963c:	83 fa 1f             	cmp    $0x1f,%edx
+8010963f:	77 0f                	ja     80109650 <trap+0x70>
+80109641:	ff 24 95 f4 bb 10 80 	jmp    *-0x7fef440c(,%edx,4)
+80109648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010964f:	90                   	nop
+            if (tf->trapno >= T_IRQ0 && pciintr(tf->trapno - T_IRQ0)) {
+80109650:	83 f8 1f             	cmp    $0x1f,%eax
+80109653:	76 ad                	jbe    80109602 <trap+0x22>
+80109655:	83 ec 0c             	sub    $0xc,%esp
+80109658:	52                   	push   %edx
+80109659:	e8 62 76 ff ff       	call   80100cc0 <pciintr>
+8010965e:	83 c4 10             	add    $0x10,%esp
+80109661:	85 c0                	test   %eax,%eax
+80109663:	75 28                	jne    8010968d <trap+0xad>
+            cprintf("trap: unknown interrupt number: 0x%x\n", tf->trapno);
+80109665:	8b 43 30             	mov    0x30(%ebx),%eax
+80109668:	eb 98                	jmp    80109602 <trap+0x22>
+8010966a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+            if(cpuid() == 0){
+80109670:	e8 cb ed ff ff       	call   80108440 <cpuid>
+80109675:	85 c0                	test   %eax,%eax
+80109677:	0f 84 f3 00 00 00    	je     80109770 <trap+0x190>
+            cprintf("trap: this is a tick interrupt\n");
+8010967d:	83 ec 0c             	sub    $0xc,%esp
+80109680:	68 68 bb 10 80       	push   $0x8010bb68
+80109685:	e8 36 07 00 00       	call   80109dc0 <cprintf>
+            lapiceoi();
+8010968a:	83 c4 10             	add    $0x10,%esp
+8010968d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109690:	5b                   	pop    %ebx
+80109691:	5e                   	pop    %esi
+80109692:	5d                   	pop    %ebp
+                lapiceoi();
+80109693:	e9 48 6e ff ff       	jmp    801004e0 <lapiceoi>
+80109698:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010969f:	90                   	nop
+            cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801096a0:	8b 73 38             	mov    0x38(%ebx),%esi
+801096a3:	0f b7 5b 3c          	movzwl 0x3c(%ebx),%ebx
+801096a7:	e8 94 ed ff ff       	call   80108440 <cpuid>
+801096ac:	56                   	push   %esi
+801096ad:	53                   	push   %ebx
+801096ae:	50                   	push   %eax
+801096af:	68 a8 bb 10 80       	push   $0x8010bba8
+801096b4:	e8 07 07 00 00       	call   80109dc0 <cprintf>
+            lapiceoi();
+801096b9:	83 c4 10             	add    $0x10,%esp
+801096bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801096bf:	5b                   	pop    %ebx
+801096c0:	5e                   	pop    %esi
+801096c1:	5d                   	pop    %ebp
+                lapiceoi();
+801096c2:	e9 19 6e ff ff       	jmp    801004e0 <lapiceoi>
+801096c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801096ce:	66 90                	xchg   %ax,%ax
+            ideintr();
+801096d0:	e8 8b 9a ff ff       	call   80103160 <ideintr>
+801096d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801096d8:	5b                   	pop    %ebx
+801096d9:	5e                   	pop    %esi
+801096da:	5d                   	pop    %ebp
+                lapiceoi();
+801096db:	e9 00 6e ff ff       	jmp    801004e0 <lapiceoi>
+            cprintf("trap: this is a uart interrupt\n");
+801096e0:	83 ec 0c             	sub    $0xc,%esp
+801096e3:	68 88 bb 10 80       	push   $0x8010bb88
+801096e8:	e8 d3 06 00 00       	call   80109dc0 <cprintf>
+            uartintr();
+801096ed:	e8 ae fc ff ff       	call   801093a0 <uartintr>
+            lapiceoi();
+801096f2:	83 c4 10             	add    $0x10,%esp
+801096f5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801096f8:	5b                   	pop    %ebx
+801096f9:	5e                   	pop    %esi
+801096fa:	5d                   	pop    %ebp
+                lapiceoi();
+801096fb:	e9 e0 6d ff ff       	jmp    801004e0 <lapiceoi>
+            kbdintr();
+80109700:	e8 ab fd ff ff       	call   801094b0 <kbdintr>
+80109705:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109708:	5b                   	pop    %ebx
+80109709:	5e                   	pop    %esi
+8010970a:	5d                   	pop    %ebp
+                lapiceoi();
+8010970b:	e9 d0 6d ff ff       	jmp    801004e0 <lapiceoi>
+        if (myproc()->killed)
+80109710:	e8 4b ed ff ff       	call   80108460 <myproc>
+80109715:	8b 50 24             	mov    0x24(%eax),%edx
+80109718:	85 d2                	test   %edx,%edx
+8010971a:	75 44                	jne    80109760 <trap+0x180>
+        myproc()->tf = tf;
+8010971c:	e8 3f ed ff ff       	call   80108460 <myproc>
+80109721:	89 58 18             	mov    %ebx,0x18(%eax)
+        syscall();
+80109724:	e8 97 00 00 00       	call   801097c0 <syscall>
+        if (myproc()->killed)
+80109729:	e8 32 ed ff ff       	call   80108460 <myproc>
+8010972e:	8b 40 24             	mov    0x24(%eax),%eax
+80109731:	85 c0                	test   %eax,%eax
+80109733:	0f 84 da fe ff ff    	je     80109613 <trap+0x33>
+80109739:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010973c:	5b                   	pop    %ebx
+8010973d:	5e                   	pop    %esi
+8010973e:	5d                   	pop    %ebp
+            exit();
+8010973f:	e9 1c ef ff ff       	jmp    80108660 <exit>
+80109744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+            fputrap(tf);
+80109748:	89 5d 08             	mov    %ebx,0x8(%ebp)
+8010974b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010974e:	5b                   	pop    %ebx
+8010974f:	5e                   	pop    %esi
+80109750:	5d                   	pop    %ebp
+            fputrap(tf);
+80109751:	e9 7a e5 ff ff       	jmp    80107cd0 <fputrap>
+80109756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010975d:	8d 76 00             	lea    0x0(%esi),%esi
+            exit();
+80109760:	e8 fb ee ff ff       	call   80108660 <exit>
+80109765:	eb b5                	jmp    8010971c <trap+0x13c>
+80109767:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010976e:	66 90                	xchg   %ax,%ax
+                acquire(&tickslock);
+80109770:	83 ec 0c             	sub    $0xc,%esp
+80109773:	68 40 c0 1c 80       	push   $0x801cc040
+80109778:	e8 33 7d ff ff       	call   801014b0 <acquire>
+                ticks++;
+8010977d:	a1 20 c0 1c 80       	mov    0x801cc020,%eax
+80109782:	83 c0 01             	add    $0x1,%eax
+80109785:	a3 20 c0 1c 80       	mov    %eax,0x801cc020
+                vdsotick(ticks);
+8010978a:	89 04 24             	mov    %eax,(%esp)
+8010978d:	e8 3e fa ff ff       	call   801091d0 <vdsotick>
+                wakeup(&ticks);
+80109792:	c7 04 24 20 c0 1c 80 	movl   $0x801cc020,(%esp)
+80109799:	e8 82 f2 ff ff       	call   80108a20 <wakeup>
+                release(&tickslock);
+8010979e:	c7 04 24 40 c0 1c 80 	movl   $0x801cc040,(%esp)
+801097a5:	e8 26 7b ff ff       	call   801012d0 <release>
+801097aa:	83 c4 10             	add    $0x10,%esp
+801097ad:	e9 cb fe ff ff       	jmp    8010967d <trap+0x9d>
+801097b2:	66 90                	xchg   %ax,%ax
+801097b4:	66 90                	xchg   %ax,%ax
+801097b6:	66 90                	xchg   %ax,%ax
+801097b8:	66 90                	xchg   %ax,%ax
+801097ba:	66 90                	xchg   %ax,%ax
+801097bc:	66 90                	xchg   %ax,%ax
+801097be:	66 90                	xchg   %ax,%ax
+
+801097c0 <syscall>:
+        [SYS_uptime]    sys_uptime,
+};
+
+void
+syscall(void)
+{
+801097c0:	55                   	push   %ebp
+801097c1:	89 e5                	mov    %esp,%ebp
+801097c3:	53                   	push   %ebx
+801097c4:	83 ec 04             	sub    $0x4,%esp
+    int num;
+    struct proc *curproc = myproc();
+801097c7:	e8 94 ec ff ff       	call   80108460 <myproc>
+
+    kstatinc(KS_SYSCALL);
+801097cc:	83 ec 0c             	sub    $0xc,%esp
+801097cf:	6a 00                	push   $0x0
+    struct proc *curproc = myproc();
+801097d1:	89 c3                	mov    %eax,%ebx
+    kstatinc(KS_SYSCALL);
+801097d3:	e8 f8 cc ff ff       	call   801064d0 <kstatinc>
+    num = curproc->tf->eax;
+801097d8:	8b 43 18             	mov    0x18(%ebx),%eax
+    if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801097db:	83 c4 10             	add    $0x10,%esp
+    num = curproc->tf->eax;
+801097de:	8b 40 1c             	mov    0x1c(%eax),%eax
+    if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+801097e1:	8d 50 ff             	lea    -0x1(%eax),%edx
+801097e4:	83 fa 0d             	cmp    $0xd,%edx
+801097e7:	77 1f                	ja     80109808 <syscall+0x48>
+801097e9:	8b 14 85 20 bd 10 80 	mov    -0x7fef42e0(,%eax,4),%edx
+801097f0:	85 d2                	test   %edx,%edx
+801097f2:	74 14                	je     80109808 <syscall+0x48>
+        curproc->tf->eax = syscalls[num]();
+801097f4:	ff d2                	call   *%edx
+801097f6:	89 c2                	mov    %eax,%edx
+801097f8:	8b 43 18             	mov    0x18(%ebx),%eax
+801097fb:	89 50 1c             	mov    %edx,0x1c(%eax)
+    } else {
+        cprintf("%d %s: unknown sys call %d\n", curproc->pid, curproc->name, num);
+        curproc->tf->eax = -1;
+    }
+}
+801097fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109801:	c9                   	leave
+80109802:	c3                   	ret
+80109803:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109807:	90                   	nop
+        cprintf("%d %s: unknown sys call %d\n", curproc->pid, curproc->name, num);
+80109808:	50                   	push   %eax
+80109809:	8d 43 30             	lea    0x30(%ebx),%eax
+8010980c:	50                   	push   %eax
+8010980d:	ff 73 10             	push   0x10(%ebx)
+80109810:	68 74 bc 10 80       	push   $0x8010bc74
+80109815:	e8 a6 05 00 00       	call   80109dc0 <cprintf>
+        curproc->tf->eax = -1;
+8010981a:	8b 43 18             	mov    0x18(%ebx),%eax
+8010981d:	83 c4 10             	add    $0x10,%esp
+80109820:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+80109827:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010982a:	c9                   	leave
+8010982b:	c3                   	ret
+8010982c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109830 <syscallbench>:
+// runs the user loop in sysbench.S, which calls getpid() NSYSBENCH times
+// through int $T_SYSCALL and then NSYSBENCH times through sysenter,
+// and prints the average cost of a round trip for both paths.
+void
+syscallbench(void)
+{
+80109830:	55                   	push   %ebp
+80109831:	89 e5                	mov    %esp,%ebp
+80109833:	56                   	push   %esi
+80109834:	53                   	push   %ebx
+    extern char sysbench_start[], sysbench_end[], sysbench_result[];
+    static char image[PGSIZE];
+    uint sz, *result;
+
+    sz = sysbench_end - sysbench_start;
+80109835:	bb 8c 99 10 80       	mov    $0x8010998c,%ebx
+8010983a:	81 eb 2c 99 10 80    	sub    $0x8010992c,%ebx
+    memmove(image, sysbench_start, sz);
+80109840:	83 ec 04             	sub    $0x4,%esp
+80109843:	53                   	push   %ebx
+80109844:	68 2c 99 10 80       	push   $0x8010992c
+80109849:	68 a0 c8 1c 80       	push   $0x801cc8a0
+8010984e:	e8 7d 68 ff ff       	call   801000d0 <memmove>
+    runinit(image, sz);
+80109853:	58                   	pop    %eax
+80109854:	5a                   	pop    %edx
+80109855:	53                   	push   %ebx
+80109856:	68 a0 c8 1c 80       	push   $0x801cc8a0
+8010985b:	e8 40 ee ff ff       	call   801086a0 <runinit>
+
+    result = (uint*)(image + (sysbench_result - sysbench_start));
+80109860:	b8 84 99 10 80       	mov    $0x80109984,%eax
+    cprintf("syscallbench: int $T_SYSCALL %d cycles/call\n", result[0] / NSYSBENCH);
+80109865:	59                   	pop    %ecx
+80109866:	5b                   	pop    %ebx
+    result = (uint*)(image + (sysbench_result - sysbench_start));
+80109867:	2d 2c 99 10 80       	sub    $0x8010992c,%eax
+    cprintf("syscallbench: int $T_SYSCALL %d cycles/call\n", result[0] / NSYSBENCH);
+8010986c:	bb 59 17 b7 d1       	mov    $0xd1b71759,%ebx
+80109871:	8b 90 a0 c8 1c 80    	mov    -0x7fe33760(%eax),%edx
+    result = (uint*)(image + (sysbench_result - sysbench_start));
+80109877:	8d b0 a0 c8 1c 80    	lea    -0x7fe33760(%eax),%esi
+    cprintf("syscallbench: int $T_SYSCALL %d cycles/call\n", result[0] / NSYSBENCH);
+8010987d:	89 d0                	mov    %edx,%eax
+8010987f:	f7 e3                	mul    %ebx
+80109881:	c1 ea 0d             	shr    $0xd,%edx
+80109884:	52                   	push   %edx
+80109885:	68 90 bc 10 80       	push   $0x8010bc90
+8010988a:	e8 31 05 00 00       	call   80109dc0 <cprintf>
+    if (result[1])
+8010988f:	8b 56 04             	mov    0x4(%esi),%edx
+80109892:	83 c4 10             	add    $0x10,%esp
+80109895:	85 d2                	test   %edx,%edx
+80109897:	74 27                	je     801098c0 <syscallbench+0x90>
+        cprintf("syscallbench: sysenter %d cycles/call\n", result[1] / NSYSBENCH);
+80109899:	89 d0                	mov    %edx,%eax
+8010989b:	83 ec 08             	sub    $0x8,%esp
+8010989e:	f7 e3                	mul    %ebx
+801098a0:	c1 ea 0d             	shr    $0xd,%edx
+801098a3:	52                   	push   %edx
+801098a4:	68 c0 bc 10 80       	push   $0x8010bcc0
+801098a9:	e8 12 05 00 00       	call   80109dc0 <cprintf>
+801098ae:	83 c4 10             	add    $0x10,%esp
+    else
+        cprintf("syscallbench: sysenter not supported\n");
+}
+801098b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801098b4:	5b                   	pop    %ebx
+801098b5:	5e                   	pop    %esi
+801098b6:	5d                   	pop    %ebp
+801098b7:	c3                   	ret
+801098b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801098bf:	90                   	nop
+        cprintf("syscallbench: sysenter not supported\n");
+801098c0:	83 ec 0c             	sub    $0xc,%esp
+801098c3:	68 e8 bc 10 80       	push   $0x8010bce8
+801098c8:	e8 f3 04 00 00       	call   80109dc0 <cprintf>
+801098cd:	83 c4 10             	add    $0x10,%esp
+}
+801098d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801098d3:	5b                   	pop    %ebx
+801098d4:	5e                   	pop    %esi
+801098d5:	5d                   	pop    %ebp
+801098d6:	c3                   	ret
+801098d7:	66 90                	xchg   %ax,%ax
+801098d9:	66 90                	xchg   %ax,%ax
+801098db:	66 90                	xchg   %ax,%ax
+801098dd:	66 90                	xchg   %ax,%ax
+801098df:	90                   	nop
+
+801098e0 <sys_exit>:
+#include "proc.h"
+#include "spinlock.h"
+
+int
+sys_exit(void)
+{
+801098e0:	55                   	push   %ebp
+801098e1:	89 e5                	mov    %esp,%ebp
+801098e3:	83 ec 08             	sub    $0x8,%esp
+    exit();
+801098e6:	e8 75 ed ff ff       	call   80108660 <exit>
+    return 0;   // not reached
+}
+801098eb:	31 c0                	xor    %eax,%eax
+801098ed:	c9                   	leave
+801098ee:	c3                   	ret
+801098ef:	90                   	nop
+
+801098f0 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+801098f0:	55                   	push   %ebp
+801098f1:	89 e5                	mov    %esp,%ebp
+801098f3:	83 ec 08             	sub    $0x8,%esp
+    return myproc()->pid;
+801098f6:	e8 65 eb ff ff       	call   80108460 <myproc>
+801098fb:	8b 40 10             	mov    0x10(%eax),%eax
+}
+801098fe:	c9                   	leave
+801098ff:	c3                   	ret
+
+80109900 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred
+// since start.
+int
+sys_uptime(void)
+{
+80109900:	55                   	push   %ebp
+80109901:	89 e5                	mov    %esp,%ebp
+80109903:	53                   	push   %ebx
+80109904:	83 ec 10             	sub    $0x10,%esp
+    uint xticks;
+
+    acquire(&tickslock);
+80109907:	68 40 c0 1c 80       	push   $0x801cc040
+8010990c:	e8 9f 7b ff ff       	call   801014b0 <acquire>
+    xticks = ticks;
+80109911:	8b 1d 20 c0 1c 80    	mov    0x801cc020,%ebx
+    release(&tickslock);
+80109917:	c7 04 24 40 c0 1c 80 	movl   $0x801cc040,(%esp)
+8010991e:	e8 ad 79 ff ff       	call   801012d0 <release>
+    return xticks;
+}
+80109923:	89 d8                	mov    %ebx,%eax
+80109925:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109928:	c9                   	leave
+80109929:	c3                   	ret
+8010992a:	66 90                	xchg   %ax,%ax
+
+8010992c <sysbench_start>:
+#define UADDR(x) ((x) - sysbench_start)
+
+.globl sysbench_start
+sysbench_start:
+  # int $T_SYSCALL
+  movl $NSYSBENCH, %ebx
+8010992c:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  rdtsc
+80109931:	0f 31                	rdtsc
+  movl %eax, %esi
+80109933:	89 c6                	mov    %eax,%esi
+1:
+  movl $SYS_getpid, %eax
+80109935:	b8 0b 00 00 00       	mov    $0xb,%eax
+  int $T_SYSCALL
+8010993a:	cd 40                	int    $0x40
+  decl %ebx
+8010993c:	4b                   	dec    %ebx
+  jnz 1b
+8010993d:	75 f6                	jne    80109935 <sysbench_start+0x9>
+  rdtsc
+8010993f:	0f 31                	rdtsc
+  subl %esi, %eax
+80109941:	29 f0                	sub    %esi,%eax
+  movl %eax, UADDR(sysbench_result)
+80109943:	a3 58 00 00 00       	mov    %eax,0x58
+
+  # sysenter, if the cpu has it
+  movl $1, %eax
+80109948:	b8 01 00 00 00       	mov    $0x1,%eax
+  cpuid
+8010994d:	0f a2                	cpuid
+  testl $CPUID_SEP, %edx
+8010994f:	f7 c2 00 08 00 00    	test   $0x800,%edx
+  jz 4f
+80109955:	74 23                	je     8010997a <sysbench_start+0x4e>
+  movl $NSYSBENCH, %ebx
+80109957:	bb 10 27 00 00       	mov    $0x2710,%ebx
+  rdtsc
+8010995c:	0f 31                	rdtsc
+  movl %eax, %esi
+8010995e:	89 c6                	mov    %eax,%esi
+2:
+  movl $SYS_getpid, %eax
+80109960:	b8 0b 00 00 00       	mov    $0xb,%eax
+  movl %esp, %ecx
+80109965:	89 e1                	mov    %esp,%ecx
+  movl $UADDR(3f), %edx
+80109967:	ba 42 00 00 00       	mov    $0x42,%edx
+  sysenter
+8010996c:	0f 34                	sysenter
+3:
+  decl %ebx
+8010996e:	4b                   	dec    %ebx
+  jnz 2b
+8010996f:	75 ef                	jne    80109960 <sysbench_start+0x34>
+  rdtsc
+80109971:	0f 31                	rdtsc
+  subl %esi, %eax
+80109973:	29 f0                	sub    %esi,%eax
+  movl %eax, UADDR(sysbench_result) + 4
+80109975:	a3 5c 00 00 00       	mov    %eax,0x5c
+
+4:
+  movl $SYS_exit, %eax
+8010997a:	b8 02 00 00 00       	mov    $0x2,%eax
+  int $T_SYSCALL
+8010997f:	cd 40                	int    $0x40
+  jmp 4b
+80109981:	eb f7                	jmp    8010997a <sysbench_start+0x4e>
+80109983:	90                   	nop
+
+80109984 <sysbench_result>:
+	...
+
+8010998c <sysbench_end>:
+8010998c:	66 90                	xchg   %ax,%ax
+8010998e:	66 90                	xchg   %ax,%ax
+
+80109990 <printint>:
+    ioapicenable(IRQ_KBD, 0);
+}
+
+static void
+printint(int xx, int base, int sign)
+{
+80109990:	55                   	push   %ebp
+80109991:	89 e5                	mov    %esp,%ebp
+80109993:	57                   	push   %edi
+80109994:	56                   	push   %esi
+80109995:	89 c6                	mov    %eax,%esi
+80109997:	53                   	push   %ebx
+80109998:	89 d3                	mov    %edx,%ebx
+8010999a:	83 ec 2c             	sub    $0x2c,%esp
+    static char digits[] = "0123456789abcdef";
+    char buf[16];
+    int i;
+    uint x;
+
+    if (sign && (sign = (xx < 0))) {
+8010999d:	85 c9                	test   %ecx,%ecx
+8010999f:	74 04                	je     801099a5 <printint+0x15>
+801099a1:	85 c0                	test   %eax,%eax
+801099a3:	78 79                	js     80109a1e <printint+0x8e>
+        x = -xx;
+    }
+    else {
+        x = xx;
+801099a5:	89 f1                	mov    %esi,%ecx
+801099a7:	31 c0                	xor    %eax,%eax
+    }
+
+    i = 0;
+801099a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801099ac:	31 f6                	xor    %esi,%esi
+801099ae:	66 90                	xchg   %ax,%ax
+    do {
+        buf[i++] = digits[x % base];
+801099b0:	89 c8                	mov    %ecx,%eax
+801099b2:	31 d2                	xor    %edx,%edx
+801099b4:	89 f7                	mov    %esi,%edi
+801099b6:	f7 f3                	div    %ebx
+801099b8:	8d 76 01             	lea    0x1(%esi),%esi
+801099bb:	0f b6 92 cc bd 10 80 	movzbl -0x7fef4234(%edx),%edx
+801099c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+    } while ((x /= base) != 0);
+801099c6:	89 ca                	mov    %ecx,%edx
+801099c8:	89 c1                	mov    %eax,%ecx
+801099ca:	39 da                	cmp    %ebx,%edx
+801099cc:	73 e2                	jae    801099b0 <printint+0x20>
+
+    if (sign)
+801099ce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801099d1:	85 c0                	test   %eax,%eax
+801099d3:	74 07                	je     801099dc <printint+0x4c>
+        buf[i++] = '-';
+801099d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+        buf[i++] = digits[x % base];
+801099da:	89 f7                	mov    %esi,%edi
+801099dc:	8d 5c 3d d8          	lea    -0x28(%ebp,%edi,1),%ebx
+801099e0:	8d 7d d6             	lea    -0x2a(%ebp),%edi
+}
+
+void
+consputc(int c)
+{
+    if(panicked){
+801099e3:	8b 15 88 d9 1c 80    	mov    0x801cd988,%edx
+        consputc(buf[i]);
+801099e9:	0f b6 03             	movzbl (%ebx),%eax
+    if(panicked){
+801099ec:	85 d2                	test   %edx,%edx
+801099ee:	74 08                	je     801099f8 <printint+0x68>
+    asm volatile("cli");
+801099f0:	fa                   	cli
+        cli();
+        for(;;)
+801099f1:	eb fe                	jmp    801099f1 <printint+0x61>
+801099f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801099f7:	90                   	nop
+    }
+
+    if(c == BACKSPACE){
+        uartputc('\b'); uartputc(' '); uartputc('\b');
+    } else
+        uartputc(c);
+801099f8:	83 ec 0c             	sub    $0xc,%esp
+        consputc(buf[i]);
+801099fb:	0f be f0             	movsbl %al,%esi
+    while (i-- >= 0) {
+801099fe:	83 eb 01             	sub    $0x1,%ebx
+        uartputc(c);
+80109a01:	56                   	push   %esi
+80109a02:	e8 39 f9 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109a07:	89 34 24             	mov    %esi,(%esp)
+80109a0a:	e8 51 68 ff ff       	call   80100260 <cgaputc>
+    while (i-- >= 0) {
+80109a0f:	83 c4 10             	add    $0x10,%esp
+80109a12:	39 fb                	cmp    %edi,%ebx
+80109a14:	75 cd                	jne    801099e3 <printint+0x53>
+}
+80109a16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109a19:	5b                   	pop    %ebx
+80109a1a:	5e                   	pop    %esi
+80109a1b:	5f                   	pop    %edi
+80109a1c:	5d                   	pop    %ebp
+80109a1d:	c3                   	ret
+80109a1e:	89 c8                	mov    %ecx,%eax
+        x = -xx;
+80109a20:	89 f1                	mov    %esi,%ecx
+80109a22:	f7 d9                	neg    %ecx
+80109a24:	eb 83                	jmp    801099a9 <printint+0x19>
+80109a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109a30 <consoleinit>:
+{
+80109a30:	55                   	push   %ebp
+80109a31:	89 e5                	mov    %esp,%ebp
+80109a33:	83 ec 10             	sub    $0x10,%esp
+    initlock(&cons.lock, "console");
+80109a36:	68 5c bd 10 80       	push   $0x8010bd5c
+80109a3b:	68 40 d9 1c 80       	push   $0x801cd940
+80109a40:	e8 fb 75 ff ff       	call   80101040 <initlock>
+    cons.locking = 1;
+80109a45:	c7 05 84 d9 1c 80 01 	movl   $0x1,0x801cd984
+80109a4c:	00 00 00 
+    ioapicenable(IRQ_KBD, 0);
+80109a4f:	58                   	pop    %eax
+80109a50:	5a                   	pop    %edx
+80109a51:	6a 00                	push   $0x0
+80109a53:	6a 01                	push   $0x1
+80109a55:	e8 c6 6d ff ff       	call   80100820 <ioapicenable>
+}
+80109a5a:	83 c4 10             	add    $0x10,%esp
+80109a5d:	c9                   	leave
+80109a5e:	c3                   	ret
+80109a5f:	90                   	nop
+
+80109a60 <consoleintr>:
+// Control-x
+#define C(x) ((x) - '@')
+
+void
+consoleintr(int (*getc)(void))
+{
+80109a60:	55                   	push   %ebp
+80109a61:	89 e5                	mov    %esp,%ebp
+80109a63:	57                   	push   %edi
+    int c, doprocdump = 0, dolockstat = 0, dokstat = 0;
+80109a64:	31 ff                	xor    %edi,%edi
+{
+80109a66:	56                   	push   %esi
+    int c, doprocdump = 0, dolockstat = 0, dokstat = 0;
+80109a67:	31 f6                	xor    %esi,%esi
+{
+80109a69:	53                   	push   %ebx
+80109a6a:	83 ec 28             	sub    $0x28,%esp
+80109a6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+
+    acquire(&cons.lock);
+80109a70:	68 40 d9 1c 80       	push   $0x801cd940
+80109a75:	e8 36 7a ff ff       	call   801014b0 <acquire>
+    while ((c = getc()) >= 0) {
+80109a7a:	83 c4 10             	add    $0x10,%esp
+80109a7d:	ff d3                	call   *%ebx
+80109a7f:	85 c0                	test   %eax,%eax
+80109a81:	0f 88 f0 01 00 00    	js     80109c77 <consoleintr+0x217>
+        switch (c) {
+80109a87:	83 f8 15             	cmp    $0x15,%eax
+80109a8a:	7f 44                	jg     80109ad0 <consoleintr+0x70>
+80109a8c:	83 f8 07             	cmp    $0x7,%eax
+80109a8f:	7e 6f                	jle    80109b00 <consoleintr+0xa0>
+80109a91:	8d 50 f8             	lea    -0x8(%eax),%edx
+80109a94:	83 fa 0d             	cmp    $0xd,%edx
+80109a97:	77 67                	ja     80109b00 <consoleintr+0xa0>
+80109a99:	ff 24 95 94 bd 10 80 	jmp    *-0x7fef426c(,%edx,4)
+            case C('T'):
+                dokstat = 1;
+                break;
+            // kill line
+            case C('U'):
+                while (input.buf[(input.e - 1) % INPUT_BUF] != '\n') {
+80109aa0:	a1 28 d9 1c 80       	mov    0x801cd928,%eax
+80109aa5:	83 e8 01             	sub    $0x1,%eax
+80109aa8:	89 c2                	mov    %eax,%edx
+80109aaa:	83 e2 7f             	and    $0x7f,%edx
+80109aad:	80 ba a0 d8 1c 80 0a 	cmpb   $0xa,-0x7fe32760(%edx)
+80109ab4:	74 c7                	je     80109a7d <consoleintr+0x1d>
+                    input.e--;
+80109ab6:	a3 28 d9 1c 80       	mov    %eax,0x801cd928
+    if(panicked){
+80109abb:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109ac0:	85 c0                	test   %eax,%eax
+80109ac2:	0f 84 af 00 00 00    	je     80109b77 <consoleintr+0x117>
+80109ac8:	fa                   	cli
+        for(;;)
+80109ac9:	eb fe                	jmp    80109ac9 <consoleintr+0x69>
+80109acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109acf:	90                   	nop
+        switch (c) {
+80109ad0:	83 f8 3f             	cmp    $0x3f,%eax
+80109ad3:	0f 85 fc 00 00 00    	jne    80109bd5 <consoleintr+0x175>
+                    consputc(BACKSPACE);
+                }
+                break;
+            case C('H'):
+            case C('\x7f'): // backspace
+                if (input.e != input.w) {
+80109ad9:	a1 28 d9 1c 80       	mov    0x801cd928,%eax
+80109ade:	3b 05 24 d9 1c 80    	cmp    0x801cd924,%eax
+80109ae4:	74 97                	je     80109a7d <consoleintr+0x1d>
+    if(panicked){
+80109ae6:	8b 0d 88 d9 1c 80    	mov    0x801cd988,%ecx
+                    input.e--;
+80109aec:	83 e8 01             	sub    $0x1,%eax
+80109aef:	a3 28 d9 1c 80       	mov    %eax,0x801cd928
+    if(panicked){
+80109af4:	85 c9                	test   %ecx,%ecx
+80109af6:	0f 84 a5 01 00 00    	je     80109ca1 <consoleintr+0x241>
+80109afc:	fa                   	cli
+        for(;;)
+80109afd:	eb fe                	jmp    80109afd <consoleintr+0x9d>
+80109aff:	90                   	nop
+                    consputc(BACKSPACE);
+                }
+                break;
+            default:
+                if (c != 0 && input.e - input.r < INPUT_BUF) {
+80109b00:	85 c0                	test   %eax,%eax
+80109b02:	0f 84 75 ff ff ff    	je     80109a7d <consoleintr+0x1d>
+80109b08:	8b 15 28 d9 1c 80    	mov    0x801cd928,%edx
+80109b0e:	89 d1                	mov    %edx,%ecx
+80109b10:	2b 0d 20 d9 1c 80    	sub    0x801cd920,%ecx
+80109b16:	83 f9 7f             	cmp    $0x7f,%ecx
+80109b19:	0f 87 5e ff ff ff    	ja     80109a7d <consoleintr+0x1d>
+                    c = (c == '\r') ? '\n' : c;
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109b1f:	8d 4a 01             	lea    0x1(%edx),%ecx
+80109b22:	83 e2 7f             	and    $0x7f,%edx
+80109b25:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    if(panicked){
+80109b28:	8b 15 88 d9 1c 80    	mov    0x801cd988,%edx
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109b2e:	89 0d 28 d9 1c 80    	mov    %ecx,0x801cd928
+                    c = (c == '\r') ? '\n' : c;
+80109b34:	83 f8 0d             	cmp    $0xd,%eax
+80109b37:	0f 85 9a 01 00 00    	jne    80109cd7 <consoleintr+0x277>
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109b3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109b40:	c6 80 a0 d8 1c 80 0a 	movb   $0xa,-0x7fe32760(%eax)
+    if(panicked){
+80109b47:	85 d2                	test   %edx,%edx
+80109b49:	0f 85 95 01 00 00    	jne    80109ce4 <consoleintr+0x284>
+        uartputc(c);
+80109b4f:	83 ec 0c             	sub    $0xc,%esp
+80109b52:	6a 0a                	push   $0xa
+80109b54:	e8 e7 f7 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109b59:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+80109b60:	e8 fb 66 ff ff       	call   80100260 <cgaputc>
+                    consputc(c);
+                    if (c == '\n' || c == C('D') || input.e == input.r + INPUT_BUF) {
+                        input.w = input.e;
+80109b65:	a1 28 d9 1c 80       	mov    0x801cd928,%eax
+80109b6a:	83 c4 10             	add    $0x10,%esp
+80109b6d:	a3 24 d9 1c 80       	mov    %eax,0x801cd924
+80109b72:	e9 06 ff ff ff       	jmp    80109a7d <consoleintr+0x1d>
+        uartputc('\b'); uartputc(' '); uartputc('\b');
+80109b77:	83 ec 0c             	sub    $0xc,%esp
+80109b7a:	6a 08                	push   $0x8
+80109b7c:	e8 bf f7 ff ff       	call   80109340 <uartputc>
+80109b81:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80109b88:	e8 b3 f7 ff ff       	call   80109340 <uartputc>
+80109b8d:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80109b94:	e8 a7 f7 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109b99:	c7 04 24 00 01 00 00 	movl   $0x100,(%esp)
+80109ba0:	e8 bb 66 ff ff       	call   80100260 <cgaputc>
+                while (input.buf[(input.e - 1) % INPUT_BUF] != '\n') {
+80109ba5:	a1 28 d9 1c 80       	mov    0x801cd928,%eax
+80109baa:	83 c4 10             	add    $0x10,%esp
+80109bad:	83 e8 01             	sub    $0x1,%eax
+80109bb0:	89 c2                	mov    %eax,%edx
+80109bb2:	83 e2 7f             	and    $0x7f,%edx
+80109bb5:	80 ba a0 d8 1c 80 0a 	cmpb   $0xa,-0x7fe32760(%edx)
+80109bbc:	0f 84 bb fe ff ff    	je     80109a7d <consoleintr+0x1d>
+                    input.e--;
+80109bc2:	a3 28 d9 1c 80       	mov    %eax,0x801cd928
+    if(panicked){
+80109bc7:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109bcc:	85 c0                	test   %eax,%eax
+80109bce:	74 a7                	je     80109b77 <consoleintr+0x117>
+80109bd0:	e9 f3 fe ff ff       	jmp    80109ac8 <consoleintr+0x68>
+                if (c != 0 && input.e - input.r < INPUT_BUF) {
+80109bd5:	8b 15 28 d9 1c 80    	mov    0x801cd928,%edx
+80109bdb:	89 d1                	mov    %edx,%ecx
+80109bdd:	2b 0d 20 d9 1c 80    	sub    0x801cd920,%ecx
+80109be3:	83 f9 7f             	cmp    $0x7f,%ecx
+80109be6:	0f 87 91 fe ff ff    	ja     80109a7d <consoleintr+0x1d>
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109bec:	8d 4a 01             	lea    0x1(%edx),%ecx
+80109bef:	83 e2 7f             	and    $0x7f,%edx
+80109bf2:	88 82 a0 d8 1c 80    	mov    %al,-0x7fe32760(%edx)
+    if(panicked){
+80109bf8:	8b 15 88 d9 1c 80    	mov    0x801cd988,%edx
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109bfe:	89 0d 28 d9 1c 80    	mov    %ecx,0x801cd928
+    if(panicked){
+80109c04:	85 d2                	test   %edx,%edx
+80109c06:	0f 85 d8 00 00 00    	jne    80109ce4 <consoleintr+0x284>
+    if(c == BACKSPACE){
+80109c0c:	3d 00 01 00 00       	cmp    $0x100,%eax
+80109c11:	0f 85 ec 00 00 00    	jne    80109d03 <consoleintr+0x2a3>
+        uartputc('\b'); uartputc(' '); uartputc('\b');
+80109c17:	83 ec 0c             	sub    $0xc,%esp
+80109c1a:	6a 08                	push   $0x8
+80109c1c:	e8 1f f7 ff ff       	call   80109340 <uartputc>
+80109c21:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80109c28:	e8 13 f7 ff ff       	call   80109340 <uartputc>
+80109c2d:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80109c34:	e8 07 f7 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109c39:	c7 04 24 00 01 00 00 	movl   $0x100,(%esp)
+80109c40:	e8 1b 66 ff ff       	call   80100260 <cgaputc>
+80109c45:	83 c4 10             	add    $0x10,%esp
+                    if (c == '\n' || c == C('D') || input.e == input.r + INPUT_BUF) {
+80109c48:	a1 20 d9 1c 80       	mov    0x801cd920,%eax
+80109c4d:	83 e8 80             	sub    $0xffffff80,%eax
+80109c50:	39 05 28 d9 1c 80    	cmp    %eax,0x801cd928
+80109c56:	0f 85 21 fe ff ff    	jne    80109a7d <consoleintr+0x1d>
+80109c5c:	e9 0c ff ff ff       	jmp    80109b6d <consoleintr+0x10d>
+80109c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        switch (c) {
+80109c68:	be 01 00 00 00       	mov    $0x1,%esi
+    while ((c = getc()) >= 0) {
+80109c6d:	ff d3                	call   *%ebx
+80109c6f:	85 c0                	test   %eax,%eax
+80109c71:	0f 89 10 fe ff ff    	jns    80109a87 <consoleintr+0x27>
+                    }
+                }
+                break;
+        }
+    }
+    release(&cons.lock);
+80109c77:	83 ec 0c             	sub    $0xc,%esp
+80109c7a:	68 40 d9 1c 80       	push   $0x801cd940
+80109c7f:	e8 4c 76 ff ff       	call   801012d0 <release>
+    if(doprocdump) {
+//        procdump();  // now call procdump() wo. cons.lock held
+    }
+    if (dolockstat)
+80109c84:	83 c4 10             	add    $0x10,%esp
+80109c87:	85 ff                	test   %edi,%edi
+80109c89:	75 71                	jne    80109cfc <consoleintr+0x29c>
+        lockstatdump();
+    if (dokstat)
+80109c8b:	85 f6                	test   %esi,%esi
+80109c8d:	75 61                	jne    80109cf0 <consoleintr+0x290>
+        kstatdump();
+}
+80109c8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109c92:	5b                   	pop    %ebx
+80109c93:	5e                   	pop    %esi
+80109c94:	5f                   	pop    %edi
+80109c95:	5d                   	pop    %ebp
+80109c96:	c3                   	ret
+                dolockstat = 1;
+80109c97:	bf 01 00 00 00       	mov    $0x1,%edi
+80109c9c:	e9 dc fd ff ff       	jmp    80109a7d <consoleintr+0x1d>
+        uartputc('\b'); uartputc(' '); uartputc('\b');
+80109ca1:	83 ec 0c             	sub    $0xc,%esp
+80109ca4:	6a 08                	push   $0x8
+80109ca6:	e8 95 f6 ff ff       	call   80109340 <uartputc>
+80109cab:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+80109cb2:	e8 89 f6 ff ff       	call   80109340 <uartputc>
+80109cb7:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80109cbe:	e8 7d f6 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109cc3:	c7 04 24 00 01 00 00 	movl   $0x100,(%esp)
+80109cca:	e8 91 65 ff ff       	call   80100260 <cgaputc>
+}
+80109ccf:	83 c4 10             	add    $0x10,%esp
+80109cd2:	e9 a6 fd ff ff       	jmp    80109a7d <consoleintr+0x1d>
+                    input.buf[input.e++ % INPUT_BUF] = c;
+80109cd7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80109cda:	88 81 a0 d8 1c 80    	mov    %al,-0x7fe32760(%ecx)
+    if(panicked){
+80109ce0:	85 d2                	test   %edx,%edx
+80109ce2:	74 1f                	je     80109d03 <consoleintr+0x2a3>
+80109ce4:	fa                   	cli
+        for(;;)
+80109ce5:	eb fe                	jmp    80109ce5 <consoleintr+0x285>
+80109ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109cee:	66 90                	xchg   %ax,%ax
+}
+80109cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109cf3:	5b                   	pop    %ebx
+80109cf4:	5e                   	pop    %esi
+80109cf5:	5f                   	pop    %edi
+80109cf6:	5d                   	pop    %ebp
+        kstatdump();
+80109cf7:	e9 44 c8 ff ff       	jmp    80106540 <kstatdump>
+        lockstatdump();
+80109cfc:	e8 8f c5 ff ff       	call   80106290 <lockstatdump>
+80109d01:	eb 88                	jmp    80109c8b <consoleintr+0x22b>
+        uartputc(c);
+80109d03:	83 ec 0c             	sub    $0xc,%esp
+80109d06:	50                   	push   %eax
+80109d07:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80109d0a:	e8 31 f6 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109d0f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109d12:	89 04 24             	mov    %eax,(%esp)
+80109d15:	e8 46 65 ff ff       	call   80100260 <cgaputc>
+                    if (c == '\n' || c == C('D') || input.e == input.r + INPUT_BUF) {
+80109d1a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80109d1d:	83 c4 10             	add    $0x10,%esp
+80109d20:	83 f8 0a             	cmp    $0xa,%eax
+80109d23:	74 09                	je     80109d2e <consoleintr+0x2ce>
+80109d25:	83 f8 04             	cmp    $0x4,%eax
+80109d28:	0f 85 1a ff ff ff    	jne    80109c48 <consoleintr+0x1e8>
+80109d2e:	a1 28 d9 1c 80       	mov    0x801cd928,%eax
+80109d33:	e9 35 fe ff ff       	jmp    80109b6d <consoleintr+0x10d>
+80109d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109d3f:	90                   	nop
+
+80109d40 <panic>:
+        release(&cons.lock);
+}
+
+void
+panic(char *s)
+{
+80109d40:	55                   	push   %ebp
+80109d41:	89 e5                	mov    %esp,%ebp
+80109d43:	56                   	push   %esi
+80109d44:	53                   	push   %ebx
+80109d45:	83 ec 30             	sub    $0x30,%esp
+80109d48:	fa                   	cli
+    int i;
+    uint pcs[10];
+
+    cli();
+    cons.locking = 0;
+80109d49:	c7 05 84 d9 1c 80 00 	movl   $0x0,0x801cd984
+80109d50:	00 00 00 
+    cprintf("lapicid %d: panic: ", lapicid());
+    cprintf(s);
+    cprintf("\n");
+    getcallerpcs(&s, pcs);
+80109d53:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80109d56:	8d 75 f8             	lea    -0x8(%ebp),%esi
+    cprintf("lapicid %d: panic: ", lapicid());
+80109d59:	e8 62 67 ff ff       	call   801004c0 <lapicid>
+80109d5e:	83 ec 08             	sub    $0x8,%esp
+80109d61:	50                   	push   %eax
+80109d62:	68 64 bd 10 80       	push   $0x8010bd64
+80109d67:	e8 54 00 00 00       	call   80109dc0 <cprintf>
+    cprintf(s);
+80109d6c:	58                   	pop    %eax
+80109d6d:	ff 75 08             	push   0x8(%ebp)
+80109d70:	e8 4b 00 00 00       	call   80109dc0 <cprintf>
+    cprintf("\n");
+80109d75:	c7 04 24 51 af 10 80 	movl   $0x8010af51,(%esp)
+80109d7c:	e8 3f 00 00 00       	call   80109dc0 <cprintf>
+    getcallerpcs(&s, pcs);
+80109d81:	8d 45 08             	lea    0x8(%ebp),%eax
+80109d84:	5a                   	pop    %edx
+80109d85:	59                   	pop    %ecx
+80109d86:	53                   	push   %ebx
+80109d87:	50                   	push   %eax
+80109d88:	e8 03 73 ff ff       	call   80101090 <getcallerpcs>
+    for(i=0; i<10; i++)
+80109d8d:	83 c4 10             	add    $0x10,%esp
+        cprintf(" %p", pcs[i]);
+80109d90:	83 ec 08             	sub    $0x8,%esp
+80109d93:	ff 33                	push   (%ebx)
+    for(i=0; i<10; i++)
+80109d95:	83 c3 04             	add    $0x4,%ebx
+        cprintf(" %p", pcs[i]);
+80109d98:	68 78 bd 10 80       	push   $0x8010bd78
+80109d9d:	e8 1e 00 00 00       	call   80109dc0 <cprintf>
+    for(i=0; i<10; i++)
+80109da2:	83 c4 10             	add    $0x10,%esp
+80109da5:	39 f3                	cmp    %esi,%ebx
+80109da7:	75 e7                	jne    80109d90 <panic+0x50>
+    panicked = 1; // freeze other CPU
+80109da9:	c7 05 88 d9 1c 80 01 	movl   $0x1,0x801cd988
+80109db0:	00 00 00 
+    for(;;)
+80109db3:	eb fe                	jmp    80109db3 <panic+0x73>
+80109db5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109dbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109dc0 <cprintf>:
+{
+80109dc0:	55                   	push   %ebp
+80109dc1:	89 e5                	mov    %esp,%ebp
+80109dc3:	57                   	push   %edi
+80109dc4:	56                   	push   %esi
+80109dc5:	53                   	push   %ebx
+80109dc6:	83 ec 1c             	sub    $0x1c,%esp
+    locking = cons.locking;
+80109dc9:	8b 1d 84 d9 1c 80    	mov    0x801cd984,%ebx
+    if (fmt == 0)
+80109dcf:	8b 7d 08             	mov    0x8(%ebp),%edi
+    if (locking)
+80109dd2:	85 db                	test   %ebx,%ebx
+80109dd4:	0f 85 46 01 00 00    	jne    80109f20 <cprintf+0x160>
+    if (fmt == 0)
+80109dda:	85 ff                	test   %edi,%edi
+80109ddc:	0f 84 4b 02 00 00    	je     8010a02d <cprintf+0x26d>
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109de2:	0f b6 17             	movzbl (%edi),%edx
+80109de5:	85 d2                	test   %edx,%edx
+80109de7:	74 6b                	je     80109e54 <cprintf+0x94>
+    argp = (uint*)(void*)(&fmt + 1);
+80109de9:	8d 45 0c             	lea    0xc(%ebp),%eax
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109dec:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80109def:	31 f6                	xor    %esi,%esi
+80109df1:	89 c3                	mov    %eax,%ebx
+        if(c != '%'){
+80109df3:	83 fa 25             	cmp    $0x25,%edx
+80109df6:	0f 85 dc 00 00 00    	jne    80109ed8 <cprintf+0x118>
+        c = fmt[++i] & 0xff;
+80109dfc:	83 c6 01             	add    $0x1,%esi
+80109dff:	0f b6 14 37          	movzbl (%edi,%esi,1),%edx
+        if(c == 0)
+80109e03:	85 d2                	test   %edx,%edx
+80109e05:	74 42                	je     80109e49 <cprintf+0x89>
+        switch(c){
+80109e07:	83 fa 70             	cmp    $0x70,%edx
+80109e0a:	0f 84 99 00 00 00    	je     80109ea9 <cprintf+0xe9>
+80109e10:	7f 4e                	jg     80109e60 <cprintf+0xa0>
+80109e12:	83 fa 25             	cmp    $0x25,%edx
+80109e15:	0f 84 7d 01 00 00    	je     80109f98 <cprintf+0x1d8>
+80109e1b:	83 fa 64             	cmp    $0x64,%edx
+80109e1e:	0f 85 34 01 00 00    	jne    80109f58 <cprintf+0x198>
+                printint(*argp++, 10, 1);
+80109e24:	8d 43 04             	lea    0x4(%ebx),%eax
+80109e27:	b9 01 00 00 00       	mov    $0x1,%ecx
+80109e2c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80109e31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109e34:	8b 03                	mov    (%ebx),%eax
+80109e36:	e8 55 fb ff ff       	call   80109990 <printint>
+80109e3b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109e3e:	83 c6 01             	add    $0x1,%esi
+80109e41:	0f b6 14 37          	movzbl (%edi,%esi,1),%edx
+80109e45:	85 d2                	test   %edx,%edx
+80109e47:	75 aa                	jne    80109df3 <cprintf+0x33>
+80109e49:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+    if(locking)
+80109e4c:	85 db                	test   %ebx,%ebx
+80109e4e:	0f 85 ef 00 00 00    	jne    80109f43 <cprintf+0x183>
+}
+80109e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109e57:	5b                   	pop    %ebx
+80109e58:	5e                   	pop    %esi
+80109e59:	5f                   	pop    %edi
+80109e5a:	5d                   	pop    %ebp
+80109e5b:	c3                   	ret
+80109e5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        switch(c){
+80109e60:	83 fa 73             	cmp    $0x73,%edx
+80109e63:	75 3b                	jne    80109ea0 <cprintf+0xe0>
+                if((s = (char*)*argp++) == 0)
+80109e65:	8b 03                	mov    (%ebx),%eax
+80109e67:	8d 53 04             	lea    0x4(%ebx),%edx
+80109e6a:	85 c0                	test   %eax,%eax
+80109e6c:	0f 85 6e 01 00 00    	jne    80109fe0 <cprintf+0x220>
+                    s = "(null)";
+80109e72:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80109e75:	bb 28 00 00 00       	mov    $0x28,%ebx
+80109e7a:	b8 7c bd 10 80       	mov    $0x8010bd7c,%eax
+80109e7f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80109e82:	89 da                	mov    %ebx,%edx
+80109e84:	89 c3                	mov    %eax,%ebx
+    if(panicked){
+80109e86:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109e8b:	85 c0                	test   %eax,%eax
+80109e8d:	0f 84 63 01 00 00    	je     80109ff6 <cprintf+0x236>
+80109e93:	fa                   	cli
+        for(;;)
+80109e94:	eb fe                	jmp    80109e94 <cprintf+0xd4>
+80109e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109e9d:	8d 76 00             	lea    0x0(%esi),%esi
+        switch(c){
+80109ea0:	83 fa 78             	cmp    $0x78,%edx
+80109ea3:	0f 85 af 00 00 00    	jne    80109f58 <cprintf+0x198>
+                printint(*argp++, 16, 0);
+80109ea9:	8d 43 04             	lea    0x4(%ebx),%eax
+80109eac:	ba 10 00 00 00       	mov    $0x10,%edx
+80109eb1:	31 c9                	xor    %ecx,%ecx
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109eb3:	83 c6 01             	add    $0x1,%esi
+                printint(*argp++, 16, 0);
+80109eb6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109eb9:	8b 03                	mov    (%ebx),%eax
+80109ebb:	e8 d0 fa ff ff       	call   80109990 <printint>
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109ec0:	0f b6 14 37          	movzbl (%edi,%esi,1),%edx
+                printint(*argp++, 16, 0);
+80109ec4:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109ec7:	85 d2                	test   %edx,%edx
+80109ec9:	0f 85 24 ff ff ff    	jne    80109df3 <cprintf+0x33>
+80109ecf:	e9 75 ff ff ff       	jmp    80109e49 <cprintf+0x89>
+80109ed4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(panicked){
+80109ed8:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109edd:	85 c0                	test   %eax,%eax
+80109edf:	74 07                	je     80109ee8 <cprintf+0x128>
+80109ee1:	fa                   	cli
+        for(;;)
+80109ee2:	eb fe                	jmp    80109ee2 <cprintf+0x122>
+80109ee4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        uartputc(c);
+80109ee8:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109eeb:	83 c6 01             	add    $0x1,%esi
+        uartputc(c);
+80109eee:	52                   	push   %edx
+80109eef:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80109ef2:	e8 49 f4 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109ef7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80109efa:	89 14 24             	mov    %edx,(%esp)
+80109efd:	e8 5e 63 ff ff       	call   80100260 <cgaputc>
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109f02:	0f b6 14 37          	movzbl (%edi,%esi,1),%edx
+}
+80109f06:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109f09:	85 d2                	test   %edx,%edx
+80109f0b:	0f 85 e2 fe ff ff    	jne    80109df3 <cprintf+0x33>
+80109f11:	e9 33 ff ff ff       	jmp    80109e49 <cprintf+0x89>
+80109f16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109f1d:	8d 76 00             	lea    0x0(%esi),%esi
+        acquire(&cons.lock);
+80109f20:	83 ec 0c             	sub    $0xc,%esp
+80109f23:	68 40 d9 1c 80       	push   $0x801cd940
+80109f28:	e8 83 75 ff ff       	call   801014b0 <acquire>
+    if (fmt == 0)
+80109f2d:	83 c4 10             	add    $0x10,%esp
+80109f30:	85 ff                	test   %edi,%edi
+80109f32:	0f 84 f5 00 00 00    	je     8010a02d <cprintf+0x26d>
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109f38:	0f b6 17             	movzbl (%edi),%edx
+80109f3b:	85 d2                	test   %edx,%edx
+80109f3d:	0f 85 a6 fe ff ff    	jne    80109de9 <cprintf+0x29>
+        release(&cons.lock);
+80109f43:	83 ec 0c             	sub    $0xc,%esp
+80109f46:	68 40 d9 1c 80       	push   $0x801cd940
+80109f4b:	e8 80 73 ff ff       	call   801012d0 <release>
+80109f50:	83 c4 10             	add    $0x10,%esp
+80109f53:	e9 fc fe ff ff       	jmp    80109e54 <cprintf+0x94>
+    if(panicked){
+80109f58:	8b 0d 88 d9 1c 80    	mov    0x801cd988,%ecx
+80109f5e:	85 c9                	test   %ecx,%ecx
+80109f60:	75 76                	jne    80109fd8 <cprintf+0x218>
+        uartputc(c);
+80109f62:	83 ec 0c             	sub    $0xc,%esp
+80109f65:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80109f68:	6a 25                	push   $0x25
+80109f6a:	e8 d1 f3 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109f6f:	c7 04 24 25 00 00 00 	movl   $0x25,(%esp)
+80109f76:	e8 e5 62 ff ff       	call   80100260 <cgaputc>
+    if(panicked){
+80109f7b:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109f80:	83 c4 10             	add    $0x10,%esp
+80109f83:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80109f86:	85 c0                	test   %eax,%eax
+80109f88:	0f 84 5a ff ff ff    	je     80109ee8 <cprintf+0x128>
+80109f8e:	fa                   	cli
+        for(;;)
+80109f8f:	eb fe                	jmp    80109f8f <cprintf+0x1cf>
+80109f91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(panicked){
+80109f98:	a1 88 d9 1c 80       	mov    0x801cd988,%eax
+80109f9d:	85 c0                	test   %eax,%eax
+80109f9f:	74 07                	je     80109fa8 <cprintf+0x1e8>
+80109fa1:	fa                   	cli
+        for(;;)
+80109fa2:	eb fe                	jmp    80109fa2 <cprintf+0x1e2>
+80109fa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        uartputc(c);
+80109fa8:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109fab:	83 c6 01             	add    $0x1,%esi
+        uartputc(c);
+80109fae:	6a 25                	push   $0x25
+80109fb0:	e8 8b f3 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+80109fb5:	c7 04 24 25 00 00 00 	movl   $0x25,(%esp)
+80109fbc:	e8 9f 62 ff ff       	call   80100260 <cgaputc>
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109fc1:	0f b6 14 37          	movzbl (%edi,%esi,1),%edx
+}
+80109fc5:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80109fc8:	85 d2                	test   %edx,%edx
+80109fca:	0f 85 23 fe ff ff    	jne    80109df3 <cprintf+0x33>
+80109fd0:	e9 74 fe ff ff       	jmp    80109e49 <cprintf+0x89>
+80109fd5:	8d 76 00             	lea    0x0(%esi),%esi
+80109fd8:	fa                   	cli
+        for(;;)
+80109fd9:	eb fe                	jmp    80109fd9 <cprintf+0x219>
+80109fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109fdf:	90                   	nop
+                for(; *s; s++)
+80109fe0:	0f b6 18             	movzbl (%eax),%ebx
+80109fe3:	84 db                	test   %bl,%bl
+80109fe5:	74 3f                	je     8010a026 <cprintf+0x266>
+80109fe7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80109fea:	89 da                	mov    %ebx,%edx
+80109fec:	89 c3                	mov    %eax,%ebx
+80109fee:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80109ff1:	e9 90 fe ff ff       	jmp    80109e86 <cprintf+0xc6>
+                    consputc(*s);
+80109ff6:	0f be f2             	movsbl %dl,%esi
+        uartputc(c);
+80109ff9:	83 ec 0c             	sub    $0xc,%esp
+                for(; *s; s++)
+80109ffc:	83 c3 01             	add    $0x1,%ebx
+        uartputc(c);
+80109fff:	56                   	push   %esi
+8010a000:	e8 3b f3 ff ff       	call   80109340 <uartputc>
+    cgaputc(c);
+8010a005:	89 34 24             	mov    %esi,(%esp)
+8010a008:	e8 53 62 ff ff       	call   80100260 <cgaputc>
+                for(; *s; s++)
+8010a00d:	0f b6 13             	movzbl (%ebx),%edx
+8010a010:	83 c4 10             	add    $0x10,%esp
+8010a013:	84 d2                	test   %dl,%dl
+8010a015:	0f 85 6b fe ff ff    	jne    80109e86 <cprintf+0xc6>
+                if((s = (char*)*argp++) == 0)
+8010a01b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010a01e:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+8010a021:	e9 18 fe ff ff       	jmp    80109e3e <cprintf+0x7e>
+8010a026:	89 d3                	mov    %edx,%ebx
+8010a028:	e9 11 fe ff ff       	jmp    80109e3e <cprintf+0x7e>
+        panic("cprinf: null fmt");
+8010a02d:	83 ec 0c             	sub    $0xc,%esp
+8010a030:	68 83 bd 10 80       	push   $0x8010bd83
+8010a035:	e8 06 fd ff ff       	call   80109d40 <panic>
+
+8010a03a <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+8010a03a:	6a 00                	push   $0x0
+  pushl $0
+8010a03c:	6a 00                	push   $0x0
+  jmp alltraps
+8010a03e:	e9 82 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a043 <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+8010a043:	6a 00                	push   $0x0
+  pushl $1
+8010a045:	6a 01                	push   $0x1
+  jmp alltraps
+8010a047:	e9 79 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a04c <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+8010a04c:	6a 00                	push   $0x0
+  pushl $2
+8010a04e:	6a 02                	push   $0x2
+  jmp alltraps
+8010a050:	e9 70 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a055 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+8010a055:	6a 00                	push   $0x0
+  pushl $3
+8010a057:	6a 03                	push   $0x3
+  jmp alltraps
+8010a059:	e9 67 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a05e <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+8010a05e:	6a 00                	push   $0x0
+  pushl $4
+8010a060:	6a 04                	push   $0x4
+  jmp alltraps
+8010a062:	e9 5e f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a067 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+8010a067:	6a 00                	push   $0x0
+  pushl $5
+8010a069:	6a 05                	push   $0x5
+  jmp alltraps
+8010a06b:	e9 55 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a070 <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+8010a070:	6a 00                	push   $0x0
+  pushl $6
+8010a072:	6a 06                	push   $0x6
+  jmp alltraps
+8010a074:	e9 4c f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a079 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+8010a079:	6a 00                	push   $0x0
+  pushl $7
+8010a07b:	6a 07                	push   $0x7
+  jmp alltraps
+8010a07d:	e9 43 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a082 <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+8010a082:	6a 08                	push   $0x8
+  jmp alltraps
+8010a084:	e9 3c f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a089 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+8010a089:	6a 00                	push   $0x0
+  pushl $9
+8010a08b:	6a 09                	push   $0x9
+  jmp alltraps
+8010a08d:	e9 33 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a092 <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010a092:	6a 0a                	push   $0xa
+  jmp alltraps
+8010a094:	e9 2c f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a099 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+8010a099:	6a 0b                	push   $0xb
+  jmp alltraps
+8010a09b:	e9 25 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0a0 <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010a0a0:	6a 0c                	push   $0xc
+  jmp alltraps
+8010a0a2:	e9 1e f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0a7 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+8010a0a7:	6a 0d                	push   $0xd
+  jmp alltraps
+8010a0a9:	e9 17 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0ae <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+8010a0ae:	6a 0e                	push   $0xe
+  jmp alltraps
+8010a0b0:	e9 10 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0b5 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+8010a0b5:	6a 00                	push   $0x0
+  pushl $15
+8010a0b7:	6a 0f                	push   $0xf
+  jmp alltraps
+8010a0b9:	e9 07 f4 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0be <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+8010a0be:	6a 00                	push   $0x0
+  pushl $16
+8010a0c0:	6a 10                	push   $0x10
+  jmp alltraps
+8010a0c2:	e9 fe f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0c7 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+8010a0c7:	6a 11                	push   $0x11
+  jmp alltraps
+8010a0c9:	e9 f7 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0ce <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+8010a0ce:	6a 00                	push   $0x0
+  pushl $18
+8010a0d0:	6a 12                	push   $0x12
+  jmp alltraps
+8010a0d2:	e9 ee f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0d7 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+8010a0d7:	6a 00                	push   $0x0
+  pushl $19
+8010a0d9:	6a 13                	push   $0x13
+  jmp alltraps
+8010a0db:	e9 e5 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0e0 <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010a0e0:	6a 00                	push   $0x0
+  pushl $20
+8010a0e2:	6a 14                	push   $0x14
+  jmp alltraps
+8010a0e4:	e9 dc f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0e9 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+8010a0e9:	6a 00                	push   $0x0
+  pushl $21
+8010a0eb:	6a 15                	push   $0x15
+  jmp alltraps
+8010a0ed:	e9 d3 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0f2 <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010a0f2:	6a 00                	push   $0x0
+  pushl $22
+8010a0f4:	6a 16                	push   $0x16
+  jmp alltraps
+8010a0f6:	e9 ca f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a0fb <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+8010a0fb:	6a 00                	push   $0x0
+  pushl $23
+8010a0fd:	6a 17                	push   $0x17
+  jmp alltraps
+8010a0ff:	e9 c1 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a104 <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+8010a104:	6a 00                	push   $0x0
+  pushl $24
+8010a106:	6a 18                	push   $0x18
+  jmp alltraps
+8010a108:	e9 b8 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a10d <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+8010a10d:	6a 00                	push   $0x0
+  pushl $25
+8010a10f:	6a 19                	push   $0x19
+  jmp alltraps
+8010a111:	e9 af f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a116 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+8010a116:	6a 00                	push   $0x0
+  pushl $26
+8010a118:	6a 1a                	push   $0x1a
+  jmp alltraps
+8010a11a:	e9 a6 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a11f <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+8010a11f:	6a 00                	push   $0x0
+  pushl $27
+8010a121:	6a 1b                	push   $0x1b
+  jmp alltraps
+8010a123:	e9 9d f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a128 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+8010a128:	6a 00                	push   $0x0
+  pushl $28
+8010a12a:	6a 1c                	push   $0x1c
+  jmp alltraps
+8010a12c:	e9 94 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a131 <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+8010a131:	6a 00                	push   $0x0
+  pushl $29
+8010a133:	6a 1d                	push   $0x1d
+  jmp alltraps
+8010a135:	e9 8b f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a13a <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+8010a13a:	6a 00                	push   $0x0
+  pushl $30
+8010a13c:	6a 1e                	push   $0x1e
+  jmp alltraps
+8010a13e:	e9 82 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a143 <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+8010a143:	6a 00                	push   $0x0
+  pushl $31
+8010a145:	6a 1f                	push   $0x1f
+  jmp alltraps
+8010a147:	e9 79 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a14c <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+8010a14c:	6a 00                	push   $0x0
+  pushl $32
+8010a14e:	6a 20                	push   $0x20
+  jmp alltraps
+8010a150:	e9 70 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a155 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+8010a155:	6a 00                	push   $0x0
+  pushl $33
+8010a157:	6a 21                	push   $0x21
+  jmp alltraps
+8010a159:	e9 67 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a15e <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+8010a15e:	6a 00                	push   $0x0
+  pushl $34
+8010a160:	6a 22                	push   $0x22
+  jmp alltraps
+8010a162:	e9 5e f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a167 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+8010a167:	6a 00                	push   $0x0
+  pushl $35
+8010a169:	6a 23                	push   $0x23
+  jmp alltraps
+8010a16b:	e9 55 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a170 <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+8010a170:	6a 00                	push   $0x0
+  pushl $36
+8010a172:	6a 24                	push   $0x24
+  jmp alltraps
+8010a174:	e9 4c f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a179 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+8010a179:	6a 00                	push   $0x0
+  pushl $37
+8010a17b:	6a 25                	push   $0x25
+  jmp alltraps
+8010a17d:	e9 43 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a182 <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+8010a182:	6a 00                	push   $0x0
+  pushl $38
+8010a184:	6a 26                	push   $0x26
+  jmp alltraps
+8010a186:	e9 3a f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a18b <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+8010a18b:	6a 00                	push   $0x0
+  pushl $39
+8010a18d:	6a 27                	push   $0x27
+  jmp alltraps
+8010a18f:	e9 31 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a194 <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010a194:	6a 00                	push   $0x0
+  pushl $40
+8010a196:	6a 28                	push   $0x28
+  jmp alltraps
+8010a198:	e9 28 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a19d <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+8010a19d:	6a 00                	push   $0x0
+  pushl $41
+8010a19f:	6a 29                	push   $0x29
+  jmp alltraps
+8010a1a1:	e9 1f f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1a6 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+8010a1a6:	6a 00                	push   $0x0
+  pushl $42
+8010a1a8:	6a 2a                	push   $0x2a
+  jmp alltraps
+8010a1aa:	e9 16 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1af <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010a1af:	6a 00                	push   $0x0
+  pushl $43
+8010a1b1:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010a1b3:	e9 0d f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1b8 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+8010a1b8:	6a 00                	push   $0x0
+  pushl $44
+8010a1ba:	6a 2c                	push   $0x2c
+  jmp alltraps
+8010a1bc:	e9 04 f3 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1c1 <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010a1c1:	6a 00                	push   $0x0
+  pushl $45
+8010a1c3:	6a 2d                	push   $0x2d
+  jmp alltraps
+8010a1c5:	e9 fb f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1ca <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+8010a1ca:	6a 00                	push   $0x0
+  pushl $46
+8010a1cc:	6a 2e                	push   $0x2e
+  jmp alltraps
+8010a1ce:	e9 f2 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1d3 <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010a1d3:	6a 00                	push   $0x0
+  pushl $47
+8010a1d5:	6a 2f                	push   $0x2f
+  jmp alltraps
+8010a1d7:	e9 e9 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1dc <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+8010a1dc:	6a 00                	push   $0x0
+  pushl $48
+8010a1de:	6a 30                	push   $0x30
+  jmp alltraps
+8010a1e0:	e9 e0 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1e5 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+8010a1e5:	6a 00                	push   $0x0
+  pushl $49
+8010a1e7:	6a 31                	push   $0x31
+  jmp alltraps
+8010a1e9:	e9 d7 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1ee <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+8010a1ee:	6a 00                	push   $0x0
+  pushl $50
+8010a1f0:	6a 32                	push   $0x32
+  jmp alltraps
+8010a1f2:	e9 ce f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a1f7 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+8010a1f7:	6a 00                	push   $0x0
+  pushl $51
+8010a1f9:	6a 33                	push   $0x33
+  jmp alltraps
+8010a1fb:	e9 c5 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a200 <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010a200:	6a 00                	push   $0x0
+  pushl $52
+8010a202:	6a 34                	push   $0x34
+  jmp alltraps
+8010a204:	e9 bc f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a209 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+8010a209:	6a 00                	push   $0x0
+  pushl $53
+8010a20b:	6a 35                	push   $0x35
+  jmp alltraps
+8010a20d:	e9 b3 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a212 <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010a212:	6a 00                	push   $0x0
+  pushl $54
+8010a214:	6a 36                	push   $0x36
+  jmp alltraps
+8010a216:	e9 aa f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a21b <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+8010a21b:	6a 00                	push   $0x0
+  pushl $55
+8010a21d:	6a 37                	push   $0x37
+  jmp alltraps
+8010a21f:	e9 a1 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a224 <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010a224:	6a 00                	push   $0x0
+  pushl $56
+8010a226:	6a 38                	push   $0x38
+  jmp alltraps
+8010a228:	e9 98 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a22d <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+8010a22d:	6a 00                	push   $0x0
+  pushl $57
+8010a22f:	6a 39                	push   $0x39
+  jmp alltraps
+8010a231:	e9 8f f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a236 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+8010a236:	6a 00                	push   $0x0
+  pushl $58
+8010a238:	6a 3a                	push   $0x3a
+  jmp alltraps
+8010a23a:	e9 86 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a23f <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+8010a23f:	6a 00                	push   $0x0
+  pushl $59
+8010a241:	6a 3b                	push   $0x3b
+  jmp alltraps
+8010a243:	e9 7d f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a248 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+8010a248:	6a 00                	push   $0x0
+  pushl $60
+8010a24a:	6a 3c                	push   $0x3c
+  jmp alltraps
+8010a24c:	e9 74 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a251 <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+8010a251:	6a 00                	push   $0x0
+  pushl $61
+8010a253:	6a 3d                	push   $0x3d
+  jmp alltraps
+8010a255:	e9 6b f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a25a <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+8010a25a:	6a 00                	push   $0x0
+  pushl $62
+8010a25c:	6a 3e                	push   $0x3e
+  jmp alltraps
+8010a25e:	e9 62 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a263 <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+8010a263:	6a 00                	push   $0x0
+  pushl $63
+8010a265:	6a 3f                	push   $0x3f
+  jmp alltraps
+8010a267:	e9 59 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a26c <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+8010a26c:	6a 00                	push   $0x0
+  pushl $64
+8010a26e:	6a 40                	push   $0x40
+  jmp alltraps
+8010a270:	e9 50 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a275 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+8010a275:	6a 00                	push   $0x0
+  pushl $65
+8010a277:	6a 41                	push   $0x41
+  jmp alltraps
+8010a279:	e9 47 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a27e <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+8010a27e:	6a 00                	push   $0x0
+  pushl $66
+8010a280:	6a 42                	push   $0x42
+  jmp alltraps
+8010a282:	e9 3e f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a287 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+8010a287:	6a 00                	push   $0x0
+  pushl $67
+8010a289:	6a 43                	push   $0x43
+  jmp alltraps
+8010a28b:	e9 35 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a290 <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010a290:	6a 00                	push   $0x0
+  pushl $68
+8010a292:	6a 44                	push   $0x44
+  jmp alltraps
+8010a294:	e9 2c f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a299 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+8010a299:	6a 00                	push   $0x0
+  pushl $69
+8010a29b:	6a 45                	push   $0x45
+  jmp alltraps
+8010a29d:	e9 23 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2a2 <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010a2a2:	6a 00                	push   $0x0
+  pushl $70
+8010a2a4:	6a 46                	push   $0x46
+  jmp alltraps
+8010a2a6:	e9 1a f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2ab <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+8010a2ab:	6a 00                	push   $0x0
+  pushl $71
+8010a2ad:	6a 47                	push   $0x47
+  jmp alltraps
+8010a2af:	e9 11 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2b4 <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010a2b4:	6a 00                	push   $0x0
+  pushl $72
+8010a2b6:	6a 48                	push   $0x48
+  jmp alltraps
+8010a2b8:	e9 08 f2 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2bd <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+8010a2bd:	6a 00                	push   $0x0
+  pushl $73
+8010a2bf:	6a 49                	push   $0x49
+  jmp alltraps
+8010a2c1:	e9 ff f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2c6 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+8010a2c6:	6a 00                	push   $0x0
+  pushl $74
+8010a2c8:	6a 4a                	push   $0x4a
+  jmp alltraps
+8010a2ca:	e9 f6 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2cf <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010a2cf:	6a 00                	push   $0x0
+  pushl $75
+8010a2d1:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010a2d3:	e9 ed f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2d8 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+8010a2d8:	6a 00                	push   $0x0
+  pushl $76
+8010a2da:	6a 4c                	push   $0x4c
+  jmp alltraps
+8010a2dc:	e9 e4 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2e1 <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010a2e1:	6a 00                	push   $0x0
+  pushl $77
+8010a2e3:	6a 4d                	push   $0x4d
+  jmp alltraps
+8010a2e5:	e9 db f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2ea <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+8010a2ea:	6a 00                	push   $0x0
+  pushl $78
+8010a2ec:	6a 4e                	push   $0x4e
+  jmp alltraps
+8010a2ee:	e9 d2 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2f3 <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010a2f3:	6a 00                	push   $0x0
+  pushl $79
+8010a2f5:	6a 4f                	push   $0x4f
+  jmp alltraps
+8010a2f7:	e9 c9 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a2fc <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+8010a2fc:	6a 00                	push   $0x0
+  pushl $80
+8010a2fe:	6a 50                	push   $0x50
+  jmp alltraps
+8010a300:	e9 c0 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a305 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+8010a305:	6a 00                	push   $0x0
+  pushl $81
+8010a307:	6a 51                	push   $0x51
+  jmp alltraps
+8010a309:	e9 b7 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a30e <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+8010a30e:	6a 00                	push   $0x0
+  pushl $82
+8010a310:	6a 52                	push   $0x52
+  jmp alltraps
+8010a312:	e9 ae f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a317 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+8010a317:	6a 00                	push   $0x0
+  pushl $83
+8010a319:	6a 53                	push   $0x53
+  jmp alltraps
+8010a31b:	e9 a5 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a320 <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010a320:	6a 00                	push   $0x0
+  pushl $84
+8010a322:	6a 54                	push   $0x54
+  jmp alltraps
+8010a324:	e9 9c f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a329 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+8010a329:	6a 00                	push   $0x0
+  pushl $85
+8010a32b:	6a 55                	push   $0x55
+  jmp alltraps
+8010a32d:	e9 93 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a332 <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+8010a332:	6a 00                	push   $0x0
+  pushl $86
+8010a334:	6a 56                	push   $0x56
+  jmp alltraps
+8010a336:	e9 8a f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a33b <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+8010a33b:	6a 00                	push   $0x0
+  pushl $87
+8010a33d:	6a 57                	push   $0x57
+  jmp alltraps
+8010a33f:	e9 81 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a344 <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+8010a344:	6a 00                	push   $0x0
+  pushl $88
+8010a346:	6a 58                	push   $0x58
+  jmp alltraps
+8010a348:	e9 78 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a34d <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+8010a34d:	6a 00                	push   $0x0
+  pushl $89
+8010a34f:	6a 59                	push   $0x59
+  jmp alltraps
+8010a351:	e9 6f f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a356 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+8010a356:	6a 00                	push   $0x0
+  pushl $90
+8010a358:	6a 5a                	push   $0x5a
+  jmp alltraps
+8010a35a:	e9 66 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a35f <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+8010a35f:	6a 00                	push   $0x0
+  pushl $91
+8010a361:	6a 5b                	push   $0x5b
+  jmp alltraps
+8010a363:	e9 5d f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a368 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+8010a368:	6a 00                	push   $0x0
+  pushl $92
+8010a36a:	6a 5c                	push   $0x5c
+  jmp alltraps
+8010a36c:	e9 54 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a371 <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+8010a371:	6a 00                	push   $0x0
+  pushl $93
+8010a373:	6a 5d                	push   $0x5d
+  jmp alltraps
+8010a375:	e9 4b f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a37a <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+8010a37a:	6a 00                	push   $0x0
+  pushl $94
+8010a37c:	6a 5e                	push   $0x5e
+  jmp alltraps
+8010a37e:	e9 42 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a383 <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+8010a383:	6a 00                	push   $0x0
+  pushl $95
+8010a385:	6a 5f                	push   $0x5f
+  jmp alltraps
+8010a387:	e9 39 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a38c <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+8010a38c:	6a 00                	push   $0x0
+  pushl $96
+8010a38e:	6a 60                	push   $0x60
+  jmp alltraps
+8010a390:	e9 30 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a395 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+8010a395:	6a 00                	push   $0x0
+  pushl $97
+8010a397:	6a 61                	push   $0x61
+  jmp alltraps
+8010a399:	e9 27 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a39e <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+8010a39e:	6a 00                	push   $0x0
+  pushl $98
+8010a3a0:	6a 62                	push   $0x62
+  jmp alltraps
+8010a3a2:	e9 1e f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3a7 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+8010a3a7:	6a 00                	push   $0x0
+  pushl $99
+8010a3a9:	6a 63                	push   $0x63
+  jmp alltraps
+8010a3ab:	e9 15 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3b0 <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010a3b0:	6a 00                	push   $0x0
+  pushl $100
+8010a3b2:	6a 64                	push   $0x64
+  jmp alltraps
+8010a3b4:	e9 0c f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3b9 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a3b9:	6a 00                	push   $0x0
+  pushl $101
+8010a3bb:	6a 65                	push   $0x65
+  jmp alltraps
+8010a3bd:	e9 03 f1 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3c2 <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a3c2:	6a 00                	push   $0x0
+  pushl $102
+8010a3c4:	6a 66                	push   $0x66
+  jmp alltraps
+8010a3c6:	e9 fa f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3cb <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a3cb:	6a 00                	push   $0x0
+  pushl $103
+8010a3cd:	6a 67                	push   $0x67
+  jmp alltraps
+8010a3cf:	e9 f1 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3d4 <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a3d4:	6a 00                	push   $0x0
+  pushl $104
+8010a3d6:	6a 68                	push   $0x68
+  jmp alltraps
+8010a3d8:	e9 e8 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3dd <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a3dd:	6a 00                	push   $0x0
+  pushl $105
+8010a3df:	6a 69                	push   $0x69
+  jmp alltraps
+8010a3e1:	e9 df f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3e6 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a3e6:	6a 00                	push   $0x0
+  pushl $106
+8010a3e8:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a3ea:	e9 d6 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3ef <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a3ef:	6a 00                	push   $0x0
+  pushl $107
+8010a3f1:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a3f3:	e9 cd f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a3f8 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a3f8:	6a 00                	push   $0x0
+  pushl $108
+8010a3fa:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a3fc:	e9 c4 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a401 <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a401:	6a 00                	push   $0x0
+  pushl $109
+8010a403:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a405:	e9 bb f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a40a <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a40a:	6a 00                	push   $0x0
+  pushl $110
+8010a40c:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a40e:	e9 b2 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a413 <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a413:	6a 00                	push   $0x0
+  pushl $111
+8010a415:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a417:	e9 a9 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a41c <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a41c:	6a 00                	push   $0x0
+  pushl $112
+8010a41e:	6a 70                	push   $0x70
+  jmp alltraps
+8010a420:	e9 a0 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a425 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a425:	6a 00                	push   $0x0
+  pushl $113
+8010a427:	6a 71                	push   $0x71
+  jmp alltraps
+8010a429:	e9 97 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a42e <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a42e:	6a 00                	push   $0x0
+  pushl $114
+8010a430:	6a 72                	push   $0x72
+  jmp alltraps
+8010a432:	e9 8e f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a437 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a437:	6a 00                	push   $0x0
+  pushl $115
+8010a439:	6a 73                	push   $0x73
+  jmp alltraps
+8010a43b:	e9 85 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a440 <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a440:	6a 00                	push   $0x0
+  pushl $116
+8010a442:	6a 74                	push   $0x74
+  jmp alltraps
+8010a444:	e9 7c f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a449 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a449:	6a 00                	push   $0x0
+  pushl $117
+8010a44b:	6a 75                	push   $0x75
+  jmp alltraps
+8010a44d:	e9 73 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a452 <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a452:	6a 00                	push   $0x0
+  pushl $118
+8010a454:	6a 76                	push   $0x76
+  jmp alltraps
+8010a456:	e9 6a f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a45b <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a45b:	6a 00                	push   $0x0
+  pushl $119
+8010a45d:	6a 77                	push   $0x77
+  jmp alltraps
+8010a45f:	e9 61 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a464 <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a464:	6a 00                	push   $0x0
+  pushl $120
+8010a466:	6a 78                	push   $0x78
+  jmp alltraps
+8010a468:	e9 58 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a46d <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a46d:	6a 00                	push   $0x0
+  pushl $121
+8010a46f:	6a 79                	push   $0x79
+  jmp alltraps
+8010a471:	e9 4f f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a476 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a476:	6a 00                	push   $0x0
+  pushl $122
+8010a478:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a47a:	e9 46 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a47f <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a47f:	6a 00                	push   $0x0
+  pushl $123
+8010a481:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a483:	e9 3d f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a488 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a488:	6a 00                	push   $0x0
+  pushl $124
+8010a48a:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a48c:	e9 34 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a491 <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a491:	6a 00                	push   $0x0
+  pushl $125
+8010a493:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a495:	e9 2b f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a49a <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a49a:	6a 00                	push   $0x0
+  pushl $126
+8010a49c:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a49e:	e9 22 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a4a3 <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a4a3:	6a 00                	push   $0x0
+  pushl $127
+8010a4a5:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a4a7:	e9 19 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a4ac <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a4ac:	6a 00                	push   $0x0
+  pushl $128
+8010a4ae:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a4b3:	e9 0d f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a4b8 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a4b8:	6a 00                	push   $0x0
+  pushl $129
+8010a4ba:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a4bf:	e9 01 f0 ff ff       	jmp    801094c5 <alltraps>
+
+8010a4c4 <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a4c4:	6a 00                	push   $0x0
+  pushl $130
+8010a4c6:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a4cb:	e9 f5 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a4d0 <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a4d0:	6a 00                	push   $0x0
+  pushl $131
+8010a4d2:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a4d7:	e9 e9 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a4dc <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a4dc:	6a 00                	push   $0x0
+  pushl $132
+8010a4de:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a4e3:	e9 dd ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a4e8 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a4e8:	6a 00                	push   $0x0
+  pushl $133
+8010a4ea:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a4ef:	e9 d1 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a4f4 <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a4f4:	6a 00                	push   $0x0
+  pushl $134
+8010a4f6:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a4fb:	e9 c5 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a500 <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a500:	6a 00                	push   $0x0
+  pushl $135
+8010a502:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a507:	e9 b9 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a50c <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a50c:	6a 00                	push   $0x0
+  pushl $136
+8010a50e:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a513:	e9 ad ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a518 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a518:	6a 00                	push   $0x0
+  pushl $137
+8010a51a:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a51f:	e9 a1 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a524 <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a524:	6a 00                	push   $0x0
+  pushl $138
+8010a526:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a52b:	e9 95 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a530 <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a530:	6a 00                	push   $0x0
+  pushl $139
+8010a532:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a537:	e9 89 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a53c <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a53c:	6a 00                	push   $0x0
+  pushl $140
+8010a53e:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a543:	e9 7d ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a548 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a548:	6a 00                	push   $0x0
+  pushl $141
+8010a54a:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a54f:	e9 71 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a554 <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a554:	6a 00                	push   $0x0
+  pushl $142
+8010a556:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a55b:	e9 65 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a560 <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a560:	6a 00                	push   $0x0
+  pushl $143
+8010a562:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a567:	e9 59 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a56c <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a56c:	6a 00                	push   $0x0
+  pushl $144
+8010a56e:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a573:	e9 4d ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a578 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a578:	6a 00                	push   $0x0
+  pushl $145
+8010a57a:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a57f:	e9 41 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a584 <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a584:	6a 00                	push   $0x0
+  pushl $146
+8010a586:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a58b:	e9 35 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a590 <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a590:	6a 00                	push   $0x0
+  pushl $147
+8010a592:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a597:	e9 29 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a59c <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a59c:	6a 00                	push   $0x0
+  pushl $148
+8010a59e:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a5a3:	e9 1d ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a5a8 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a5a8:	6a 00                	push   $0x0
+  pushl $149
+8010a5aa:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a5af:	e9 11 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a5b4 <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a5b4:	6a 00                	push   $0x0
+  pushl $150
+8010a5b6:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a5bb:	e9 05 ef ff ff       	jmp    801094c5 <alltraps>
+
+8010a5c0 <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a5c0:	6a 00                	push   $0x0
+  pushl $151
+8010a5c2:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a5c7:	e9 f9 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a5cc <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a5cc:	6a 00                	push   $0x0
+  pushl $152
+8010a5ce:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a5d3:	e9 ed ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a5d8 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a5d8:	6a 00                	push   $0x0
+  pushl $153
+8010a5da:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a5df:	e9 e1 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a5e4 <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a5e4:	6a 00                	push   $0x0
+  pushl $154
+8010a5e6:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a5eb:	e9 d5 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a5f0 <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a5f0:	6a 00                	push   $0x0
+  pushl $155
+8010a5f2:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a5f7:	e9 c9 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a5fc <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a5fc:	6a 00                	push   $0x0
+  pushl $156
+8010a5fe:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a603:	e9 bd ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a608 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a608:	6a 00                	push   $0x0
+  pushl $157
+8010a60a:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a60f:	e9 b1 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a614 <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a614:	6a 00                	push   $0x0
+  pushl $158
+8010a616:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a61b:	e9 a5 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a620 <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a620:	6a 00                	push   $0x0
+  pushl $159
+8010a622:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a627:	e9 99 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a62c <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a62c:	6a 00                	push   $0x0
+  pushl $160
+8010a62e:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a633:	e9 8d ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a638 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a638:	6a 00                	push   $0x0
+  pushl $161
+8010a63a:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a63f:	e9 81 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a644 <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a644:	6a 00                	push   $0x0
+  pushl $162
+8010a646:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a64b:	e9 75 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a650 <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a650:	6a 00                	push   $0x0
+  pushl $163
+8010a652:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a657:	e9 69 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a65c <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a65c:	6a 00                	push   $0x0
+  pushl $164
+8010a65e:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a663:	e9 5d ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a668 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a668:	6a 00                	push   $0x0
+  pushl $165
+8010a66a:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a66f:	e9 51 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a674 <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a674:	6a 00                	push   $0x0
+  pushl $166
+8010a676:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a67b:	e9 45 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a680 <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a680:	6a 00                	push   $0x0
+  pushl $167
+8010a682:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a687:	e9 39 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a68c <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a68c:	6a 00                	push   $0x0
+  pushl $168
+8010a68e:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a693:	e9 2d ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a698 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a698:	6a 00                	push   $0x0
+  pushl $169
+8010a69a:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a69f:	e9 21 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a6a4 <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a6a4:	6a 00                	push   $0x0
+  pushl $170
+8010a6a6:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a6ab:	e9 15 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a6b0 <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a6b0:	6a 00                	push   $0x0
+  pushl $171
+8010a6b2:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a6b7:	e9 09 ee ff ff       	jmp    801094c5 <alltraps>
+
+8010a6bc <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a6bc:	6a 00                	push   $0x0
+  pushl $172
+8010a6be:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a6c3:	e9 fd ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a6c8 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a6c8:	6a 00                	push   $0x0
+  pushl $173
+8010a6ca:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a6cf:	e9 f1 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a6d4 <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a6d4:	6a 00                	push   $0x0
+  pushl $174
+8010a6d6:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a6db:	e9 e5 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a6e0 <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a6e0:	6a 00                	push   $0x0
+  pushl $175
+8010a6e2:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a6e7:	e9 d9 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a6ec <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a6ec:	6a 00                	push   $0x0
+  pushl $176
+8010a6ee:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a6f3:	e9 cd ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a6f8 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a6f8:	6a 00                	push   $0x0
+  pushl $177
+8010a6fa:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a6ff:	e9 c1 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a704 <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a704:	6a 00                	push   $0x0
+  pushl $178
+8010a706:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a70b:	e9 b5 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a710 <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a710:	6a 00                	push   $0x0
+  pushl $179
+8010a712:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a717:	e9 a9 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a71c <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a71c:	6a 00                	push   $0x0
+  pushl $180
+8010a71e:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a723:	e9 9d ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a728 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a728:	6a 00                	push   $0x0
+  pushl $181
+8010a72a:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a72f:	e9 91 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a734 <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a734:	6a 00                	push   $0x0
+  pushl $182
+8010a736:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a73b:	e9 85 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a740 <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a740:	6a 00                	push   $0x0
+  pushl $183
+8010a742:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a747:	e9 79 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a74c <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a74c:	6a 00                	push   $0x0
+  pushl $184
+8010a74e:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a753:	e9 6d ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a758 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a758:	6a 00                	push   $0x0
+  pushl $185
+8010a75a:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a75f:	e9 61 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a764 <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a764:	6a 00                	push   $0x0
+  pushl $186
+8010a766:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a76b:	e9 55 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a770 <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a770:	6a 00                	push   $0x0
+  pushl $187
+8010a772:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a777:	e9 49 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a77c <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a77c:	6a 00                	push   $0x0
+  pushl $188
+8010a77e:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a783:	e9 3d ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a788 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a788:	6a 00                	push   $0x0
+  pushl $189
+8010a78a:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a78f:	e9 31 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a794 <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a794:	6a 00                	push   $0x0
+  pushl $190
+8010a796:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a79b:	e9 25 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a7a0 <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a7a0:	6a 00                	push   $0x0
+  pushl $191
+8010a7a2:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a7a7:	e9 19 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a7ac <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a7ac:	6a 00                	push   $0x0
+  pushl $192
+8010a7ae:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a7b3:	e9 0d ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a7b8 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a7b8:	6a 00                	push   $0x0
+  pushl $193
+8010a7ba:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a7bf:	e9 01 ed ff ff       	jmp    801094c5 <alltraps>
+
+8010a7c4 <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a7c4:	6a 00                	push   $0x0
+  pushl $194
+8010a7c6:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a7cb:	e9 f5 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a7d0 <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a7d0:	6a 00                	push   $0x0
+  pushl $195
+8010a7d2:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a7d7:	e9 e9 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a7dc <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a7dc:	6a 00                	push   $0x0
+  pushl $196
+8010a7de:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a7e3:	e9 dd ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a7e8 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a7e8:	6a 00                	push   $0x0
+  pushl $197
+8010a7ea:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a7ef:	e9 d1 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a7f4 <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a7f4:	6a 00                	push   $0x0
+  pushl $198
+8010a7f6:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a7fb:	e9 c5 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a800 <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a800:	6a 00                	push   $0x0
+  pushl $199
+8010a802:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a807:	e9 b9 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a80c <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a80c:	6a 00                	push   $0x0
+  pushl $200
+8010a80e:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a813:	e9 ad ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a818 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a818:	6a 00                	push   $0x0
+  pushl $201
+8010a81a:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a81f:	e9 a1 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a824 <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a824:	6a 00                	push   $0x0
+  pushl $202
+8010a826:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a82b:	e9 95 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a830 <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a830:	6a 00                	push   $0x0
+  pushl $203
+8010a832:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a837:	e9 89 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a83c <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a83c:	6a 00                	push   $0x0
+  pushl $204
+8010a83e:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a843:	e9 7d ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a848 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a848:	6a 00                	push   $0x0
+  pushl $205
+8010a84a:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a84f:	e9 71 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a854 <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a854:	6a 00                	push   $0x0
+  pushl $206
+8010a856:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a85b:	e9 65 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a860 <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a860:	6a 00                	push   $0x0
+  pushl $207
+8010a862:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a867:	e9 59 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a86c <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a86c:	6a 00                	push   $0x0
+  pushl $208
+8010a86e:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a873:	e9 4d ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a878 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a878:	6a 00                	push   $0x0
+  pushl $209
+8010a87a:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a87f:	e9 41 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a884 <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a884:	6a 00                	push   $0x0
+  pushl $210
+8010a886:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a88b:	e9 35 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a890 <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a890:	6a 00                	push   $0x0
+  pushl $211
+8010a892:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a897:	e9 29 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a89c <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a89c:	6a 00                	push   $0x0
+  pushl $212
+8010a89e:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a8a3:	e9 1d ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a8a8 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a8a8:	6a 00                	push   $0x0
+  pushl $213
+8010a8aa:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a8af:	e9 11 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a8b4 <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a8b4:	6a 00                	push   $0x0
+  pushl $214
+8010a8b6:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a8bb:	e9 05 ec ff ff       	jmp    801094c5 <alltraps>
+
+8010a8c0 <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a8c0:	6a 00                	push   $0x0
+  pushl $215
+8010a8c2:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a8c7:	e9 f9 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a8cc <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a8cc:	6a 00                	push   $0x0
+  pushl $216
+8010a8ce:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a8d3:	e9 ed eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a8d8 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a8d8:	6a 00                	push   $0x0
+  pushl $217
+8010a8da:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a8df:	e9 e1 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a8e4 <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a8e4:	6a 00                	push   $0x0
+  pushl $218
+8010a8e6:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a8eb:	e9 d5 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a8f0 <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a8f0:	6a 00                	push   $0x0
+  pushl $219
+8010a8f2:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a8f7:	e9 c9 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a8fc <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a8fc:	6a 00                	push   $0x0
+  pushl $220
+8010a8fe:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a903:	e9 bd eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a908 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a908:	6a 00                	push   $0x0
+  pushl $221
+8010a90a:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a90f:	e9 b1 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a914 <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a914:	6a 00                	push   $0x0
+  pushl $222
+8010a916:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a91b:	e9 a5 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a920 <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a920:	6a 00                	push   $0x0
+  pushl $223
+8010a922:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a927:	e9 99 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a92c <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a92c:	6a 00                	push   $0x0
+  pushl $224
+8010a92e:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a933:	e9 8d eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a938 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a938:	6a 00                	push   $0x0
+  pushl $225
+8010a93a:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a93f:	e9 81 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a944 <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a944:	6a 00                	push   $0x0
+  pushl $226
+8010a946:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a94b:	e9 75 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a950 <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a950:	6a 00                	push   $0x0
+  pushl $227
+8010a952:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a957:	e9 69 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a95c <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a95c:	6a 00                	push   $0x0
+  pushl $228
+8010a95e:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a963:	e9 5d eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a968 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a968:	6a 00                	push   $0x0
+  pushl $229
+8010a96a:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a96f:	e9 51 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a974 <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a974:	6a 00                	push   $0x0
+  pushl $230
+8010a976:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a97b:	e9 45 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a980 <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a980:	6a 00                	push   $0x0
+  pushl $231
+8010a982:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a987:	e9 39 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a98c <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a98c:	6a 00                	push   $0x0
+  pushl $232
+8010a98e:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a993:	e9 2d eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a998 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a998:	6a 00                	push   $0x0
+  pushl $233
+8010a99a:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a99f:	e9 21 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a9a4 <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a9a4:	6a 00                	push   $0x0
+  pushl $234
+8010a9a6:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a9ab:	e9 15 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a9b0 <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a9b0:	6a 00                	push   $0x0
+  pushl $235
+8010a9b2:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a9b7:	e9 09 eb ff ff       	jmp    801094c5 <alltraps>
+
+8010a9bc <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a9bc:	6a 00                	push   $0x0
+  pushl $236
+8010a9be:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a9c3:	e9 fd ea ff ff       	jmp    801094c5 <alltraps>
+
+8010a9c8 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a9c8:	6a 00                	push   $0x0
+  pushl $237
+8010a9ca:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a9cf:	e9 f1 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010a9d4 <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a9d4:	6a 00                	push   $0x0
+  pushl $238
+8010a9d6:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a9db:	e9 e5 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010a9e0 <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a9e0:	6a 00                	push   $0x0
+  pushl $239
+8010a9e2:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a9e7:	e9 d9 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010a9ec <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a9ec:	6a 00                	push   $0x0
+  pushl $240
+8010a9ee:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a9f3:	e9 cd ea ff ff       	jmp    801094c5 <alltraps>
+
+8010a9f8 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a9f8:	6a 00                	push   $0x0
+  pushl $241
+8010a9fa:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a9ff:	e9 c1 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa04 <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010aa04:	6a 00                	push   $0x0
+  pushl $242
+8010aa06:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010aa0b:	e9 b5 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa10 <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010aa10:	6a 00                	push   $0x0
+  pushl $243
+8010aa12:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010aa17:	e9 a9 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa1c <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010aa1c:	6a 00                	push   $0x0
+  pushl $244
+8010aa1e:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010aa23:	e9 9d ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa28 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010aa28:	6a 00                	push   $0x0
+  pushl $245
+8010aa2a:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010aa2f:	e9 91 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa34 <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010aa34:	6a 00                	push   $0x0
+  pushl $246
+8010aa36:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010aa3b:	e9 85 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa40 <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010aa40:	6a 00                	push   $0x0
+  pushl $247
+8010aa42:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010aa47:	e9 79 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa4c <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010aa4c:	6a 00                	push   $0x0
+  pushl $248
+8010aa4e:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010aa53:	e9 6d ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa58 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010aa58:	6a 00                	push   $0x0
+  pushl $249
+8010aa5a:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010aa5f:	e9 61 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa64 <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010aa64:	6a 00                	push   $0x0
+  pushl $250
+8010aa66:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010aa6b:	e9 55 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa70 <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010aa70:	6a 00                	push   $0x0
+  pushl $251
+8010aa72:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010aa77:	e9 49 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa7c <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010aa7c:	6a 00                	push   $0x0
+  pushl $252
+8010aa7e:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010aa83:	e9 3d ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa88 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010aa88:	6a 00                	push   $0x0
+  pushl $253
+8010aa8a:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010aa8f:	e9 31 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aa94 <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010aa94:	6a 00                	push   $0x0
+  pushl $254
+8010aa96:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010aa9b:	e9 25 ea ff ff       	jmp    801094c5 <alltraps>
+
+8010aaa0 <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010aaa0:	6a 00                	push   $0x0
+  pushl $255
+8010aaa2:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010aaa7:	e9 19 ea ff ff       	jmp    801094c5 <alltraps>
+8010aaac:	66 90                	xchg   %ax,%ax
+8010aaae:	66 90                	xchg   %ax,%ax
+
+8010aab0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(int bsp)
+{
+8010aab0:	55                   	push   %ebp
+8010aab1:	89 e5                	mov    %esp,%ebp
+8010aab3:	53                   	push   %ebx
+8010aab4:	89 c3                	mov    %eax,%ebx
+8010aab6:	83 ec 04             	sub    $0x4,%esp
+    idtinit();       // load idt register
+8010aab9:	e8 f2 ea ff ff       	call   801095b0 <idtinit>
+    xchg(&(mycpu()->started), 1); // tell startothers() we're up
+8010aabe:	e8 1d d9 ff ff       	call   801083e0 <mycpu>
+8010aac3:	89 c2                	mov    %eax,%edx
+    asm volatile("lock; xchgl %0, %1" :
+8010aac5:	b8 01 00 00 00       	mov    $0x1,%eax
+8010aaca:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+    cprintf("cpu%d: starting as %s\n", cpuid(), bsp ? "BSP" : "AP");
+8010aad1:	b8 dd bd 10 80       	mov    $0x8010bddd,%eax
+8010aad6:	85 db                	test   %ebx,%ebx
+8010aad8:	bb e1 bd 10 80       	mov    $0x8010bde1,%ebx
+8010aadd:	0f 45 d8             	cmovne %eax,%ebx
+8010aae0:	e8 5b d9 ff ff       	call   80108440 <cpuid>
+8010aae5:	83 ec 04             	sub    $0x4,%esp
+8010aae8:	53                   	push   %ebx
+8010aae9:	50                   	push   %eax
+8010aaea:	68 e4 bd 10 80       	push   $0x8010bde4
+8010aaef:	e8 cc f2 ff ff       	call   80109dc0 <cprintf>
+//    lockbench();     // lock cost with and without false sharing, every cpu
+
+    // interrupts are off: this cpu halts for good
+    rcuoffline();
+8010aaf4:	e8 67 73 ff ff       	call   80101e60 <rcuoffline>
+8010aaf9:	83 c4 10             	add    $0x10,%esp
+8010aafc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    while (1)
+        asm volatile("hlt");
+8010ab00:	f4                   	hlt
+    while (1)
+8010ab01:	eb fd                	jmp    8010ab00 <mpmain+0x50>
+8010ab03:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ab0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ab10 <mpenter>:
+{
+8010ab10:	55                   	push   %ebp
+8010ab11:	89 e5                	mov    %esp,%ebp
+8010ab13:	83 ec 08             	sub    $0x8,%esp
+    switchkvm();
+8010ab16:	e8 95 e2 ff ff       	call   80108db0 <switchkvm>
+    seginit();
+8010ab1b:	e8 b0 e1 ff ff       	call   80108cd0 <seginit>
+    fpuinit();
+8010ab20:	e8 5b d0 ff ff       	call   80107b80 <fpuinit>
+    lapicinit();
+8010ab25:	e8 96 58 ff ff       	call   801003c0 <lapicinit>
+    mpmain(0);
+8010ab2a:	31 c0                	xor    %eax,%eax
+8010ab2c:	e8 7f ff ff ff       	call   8010aab0 <mpmain>
+8010ab31:	66 90                	xchg   %ax,%ax
+8010ab33:	66 90                	xchg   %ax,%ax
+8010ab35:	66 90                	xchg   %ax,%ax
+8010ab37:	66 90                	xchg   %ax,%ax
+8010ab39:	66 90                	xchg   %ax,%ax
+8010ab3b:	66 90                	xchg   %ax,%ax
+8010ab3d:	66 90                	xchg   %ax,%ax
+8010ab3f:	90                   	nop
+
+8010ab40 <main>:
+{
+8010ab40:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+8010ab44:	83 e4 f0             	and    $0xfffffff0,%esp
+8010ab47:	ff 71 fc             	push   -0x4(%ecx)
+8010ab4a:	55                   	push   %ebp
+8010ab4b:	89 e5                	mov    %esp,%ebp
+8010ab4d:	53                   	push   %ebx
+8010ab4e:	51                   	push   %ecx
+    kinit1(end,P2V(4 * 1024 * 1024));
+8010ab4f:	83 ec 08             	sub    $0x8,%esp
+8010ab52:	68 00 00 40 80       	push   $0x80400000
+8010ab57:	68 90 e9 1c 80       	push   $0x801ce990
+8010ab5c:	e8 6f d5 ff ff       	call   801080d0 <kinit1>
+    kvmalloc();     // kernel page table
+8010ab61:	e8 9a e5 ff ff       	call   80109100 <kvmalloc>
+    mpinit();       // detect other processors
+8010ab66:	e8 45 62 ff ff       	call   80100db0 <mpinit>
+    lapicinit();    // interrupt controller
+8010ab6b:	e8 50 58 ff ff       	call   801003c0 <lapicinit>
+    seginit();      // segment descriptors
+8010ab70:	e8 5b e1 ff ff       	call   80108cd0 <seginit>
+    fpuinit();      // lazy fpu/sse switching
+8010ab75:	e8 06 d0 ff ff       	call   80107b80 <fpuinit>
+    picinit();      // disable legacy pic
+8010ab7a:	e8 91 61 ff ff       	call   80100d10 <picinit>
+    ioapicinit();   // another interrupt controller
+8010ab7f:	e8 fc 5b ff ff       	call   80100780 <ioapicinit>
+    uartinit();     // serial port
+8010ab84:	e8 27 e7 ff ff       	call   801092b0 <uartinit>
+    cgainit();      // CGA
+8010ab89:	e8 c2 56 ff ff       	call   80100250 <cgainit>
+    consoleinit();  // console hardware
+8010ab8e:	e8 9d ee ff ff       	call   80109a30 <consoleinit>
+    pinit();         // process table
+8010ab93:	e8 18 d8 ff ff       	call   801083b0 <pinit>
+    rcuinit();       // read-copy-update
+8010ab98:	e8 63 71 ff ff       	call   80101d00 <rcuinit>
+    tvinit();       // trap vectors
+8010ab9d:	e8 8e e9 ff ff       	call   80109530 <tvinit>
+    vdsoinit();     // user-readable time and cpu page
+8010aba2:	e8 79 e5 ff ff       	call   80109120 <vdsoinit>
+    fileinit();      // file table
+8010aba7:	e8 44 cc ff ff       	call   801077f0 <fileinit>
+    pciinit();       // pci devices
+8010abac:	e8 ef 5d ff ff       	call   801009a0 <pciinit>
+    ideinit();       // disk
+8010abb1:	e8 ca 82 ff ff       	call   80102e80 <ideinit>
+    ahciinit();      // sata disks
+8010abb6:	e8 f5 89 ff ff       	call   801035b0 <ahciinit>
+    virtioinit();    // virtio disk
+8010abbb:	e8 f0 92 ff ff       	call   80103eb0 <virtioinit>
+    memdiskinit();   // fs.img linked in, for kernelmemfs
+8010abc0:	e8 8b 96 ff ff       	call   80104250 <memdiskinit>
+    char *stack;
+
+    // write entry code to unused memory at 0x7000
+    // the linker has placed the image of entryother.S in _binary_entryother_start
+    code = P2V(0x7000);
+    memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+8010abc5:	83 c4 0c             	add    $0xc,%esp
+8010abc8:	68 8a 00 00 00       	push   $0x8a
+8010abcd:	68 00 e0 10 80       	push   $0x8010e000
+8010abd2:	68 00 70 00 80       	push   $0x80007000
+8010abd7:	e8 f4 54 ff ff       	call   801000d0 <memmove>
+
+    for (c = cpus; c < cpus + ncpu; c++) {
+8010abdc:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+8010abe1:	83 c4 10             	add    $0x10,%esp
+8010abe4:	8d 04 40             	lea    (%eax,%eax,2),%eax
+8010abe7:	c1 e0 06             	shl    $0x6,%eax
+8010abea:	05 80 c6 18 80       	add    $0x8018c680,%eax
+8010abef:	3d 80 c6 18 80       	cmp    $0x8018c680,%eax
+8010abf4:	76 7a                	jbe    8010ac70 <main+0x130>
+8010abf6:	bb 80 c6 18 80       	mov    $0x8018c680,%ebx
+8010abfb:	eb 1d                	jmp    8010ac1a <main+0xda>
+8010abfd:	8d 76 00             	lea    0x0(%esi),%esi
+8010ac00:	a1 48 c6 18 80       	mov    0x8018c648,%eax
+8010ac05:	81 c3 c0 00 00 00    	add    $0xc0,%ebx
+8010ac0b:	8d 04 40             	lea    (%eax,%eax,2),%eax
+8010ac0e:	c1 e0 06             	shl    $0x6,%eax
+8010ac11:	05 80 c6 18 80       	add    $0x8018c680,%eax
+8010ac16:	39 c3                	cmp    %eax,%ebx
+8010ac18:	73 56                	jae    8010ac70 <main+0x130>
+        if (c == mycpu())   // we're stared already
+8010ac1a:	e8 c1 d7 ff ff       	call   801083e0 <mycpu>
+8010ac1f:	39 c3                	cmp    %eax,%ebx
+8010ac21:	74 dd                	je     8010ac00 <main+0xc0>
+            continue;
+
+        // tell entryother.S what stack to use, where to enter, and what pgdir
+        // tp use. We cannot use kpgdir yet, because the AP processors is running in low memory,
+        // so we use entrypgdir for the APs too.
+        stack = kalloc();
+8010ac23:	e8 18 d5 ff ff       	call   80108140 <kalloc>
+        *(void**)(code - 4) = stack + KSTACKSIZE;
+        *(void(**)(void))(code -8) = mpenter;
+        *(int**)(code-12) = (void *)V2P(entrypgdir);
+
+        lapicstartap(c->apicid, V2P(code));
+8010ac28:	83 ec 08             	sub    $0x8,%esp
+        *(void(**)(void))(code -8) = mpenter;
+8010ac2b:	c7 05 f8 6f 00 80 10 	movl   $0x8010ab10,0x80006ff8
+8010ac32:	ab 10 80 
+        *(int**)(code-12) = (void *)V2P(entrypgdir);
+8010ac35:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+8010ac3c:	d0 10 00 
+        *(void**)(code - 4) = stack + KSTACKSIZE;
+8010ac3f:	05 00 10 00 00       	add    $0x1000,%eax
+8010ac44:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+        lapicstartap(c->apicid, V2P(code));
+8010ac49:	0f b6 03             	movzbl (%ebx),%eax
+8010ac4c:	68 00 70 00 00       	push   $0x7000
+8010ac51:	50                   	push   %eax
+8010ac52:	e8 b9 58 ff ff       	call   80100510 <lapicstartap>
+
+        // wait for cpu to finish mpmain()
+        while (c->started == 0)
+8010ac57:	83 c4 10             	add    $0x10,%esp
+8010ac5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010ac60:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+8010ac66:	85 c0                	test   %eax,%eax
+8010ac68:	74 f6                	je     8010ac60 <main+0x120>
+8010ac6a:	eb 94                	jmp    8010ac00 <main+0xc0>
+8010ac6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kinit2(P2V(4 * 1024 * 1024), P2V(PHYSTOP)); // init after SMP init
+8010ac70:	83 ec 08             	sub    $0x8,%esp
+8010ac73:	68 00 00 00 8e       	push   $0x8e000000
+8010ac78:	68 00 00 40 80       	push   $0x80400000
+8010ac7d:	e8 ee d3 ff ff       	call   80108070 <kinit2>
+    binit();         // buffer cache, sized from free memory
+8010ac82:	e8 99 a2 ff ff       	call   80104f20 <binit>
+    kthread("logflush", logflusher);    // write-back of committed log blocks
+8010ac87:	58                   	pop    %eax
+8010ac88:	5a                   	pop    %edx
+8010ac89:	68 f0 5f 10 80       	push   $0x80105ff0
+8010ac8e:	68 fb bd 10 80       	push   $0x8010bdfb
+8010ac93:	e8 f8 db ff ff       	call   80108890 <kthread>
+    mpmain(1);
+8010ac98:	b8 01 00 00 00       	mov    $0x1,%eax
+8010ac9d:	e8 0e fe ff ff       	call   8010aab0 <mpmain>
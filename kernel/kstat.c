@@ -0,0 +1,73 @@
+// Per-cpu event counters.
+//
+// each cpu counts into its own cache line, with interrupts off,
+// so kstatinc() needs neither a lock nor an atomic instruction and
+// cpus never write to each other's lines. kstatread() adds the cpus'
+// counts up, which may be a few events behind. like the per-cpu counts,
+// the sums wrap around at 2^32. ctrl-T on the console
+// prints all of them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "kstat.h"
+
+struct kstatcpu {
+    uint n[NKSTAT];     // 32 bits, so a reader never sees half an update
+} __attribute__((__aligned__(CACHELINE)));
+
+static struct kstatcpu kstat[NCPU];
+
+static char *kstatnames[NKSTAT] = {
+        [KS_SYSCALL]    "syscall",
+        [KS_INTR]       "intr",
+        [KS_KALLOC]     "kalloc",
+        [KS_KFREE]      "kfree",
+        [KS_BCACHEHIT]  "bcache hit",
+        [KS_BCACHEMISS] "bcache miss",
+        [KS_BCACHEGROW] "bcache grow",
+        [KS_BCACHESHRINK] "bcache shrink",
+        [KS_LOGCOMMIT]  "log commit",
+        [KS_READAHEAD]  "readahead",
+};
+
+void
+kstatinc(int i)
+{
+    pushcli();
+    kstat[cpuid()].n[i]++;
+    popcli();
+}
+
+uint
+kstatread(int i)
+{
+    uint sum = 0;
+    int c;
+
+    for (c = 0; c < ncpu; c++)
+        sum += kstat[c].n[i];
+    return sum;
+}
+
+void
+kstatdump(void)
+{
+    int i, c;
+
+    cprintf("counter:");
+    for (c = 0; c < ncpu; c++)
+        cprintf(" cpu%d", c);
+    cprintf(" total\n");
+    for (i = 0; i < NKSTAT; i++) {
+        cprintf("%s:", kstatnames[i]);
+        for (c = 0; c < ncpu; c++)
+            cprintf(" %d", kstat[c].n[i]);
+        cprintf(" %d\n", kstatread(i));
+    }
+    bcachedump();
+    blkstatdump();
+}
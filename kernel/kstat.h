@@ -0,0 +1,20 @@
+#ifndef AOS_KSTAT_H
+#define AOS_KSTAT_H
+
+// per-cpu event counters, see kstat.c.
+// add a counter here and its name to kstatnames[] in kstat.c.
+enum {
+    KS_SYSCALL,         // system calls
+    KS_INTR,            // device interrupts
+    KS_KALLOC,          // pages allocated
+    KS_KFREE,           // pages freed
+    KS_BCACHEHIT,       // bget() found the block cached
+    KS_BCACHEMISS,      // bget() recycled a buffer
+    KS_BCACHEGROW,      // data pages added to the buffer cache
+    KS_BCACHESHRINK,    // data pages given back by bshrink()
+    KS_LOGCOMMIT,       // log transactions committed
+    KS_READAHEAD,       // blocks breadahead() started reading
+    NKSTAT
+};
+
+#endif //AOS_KSTAT_H
@@ -0,0 +1,131 @@
+// Lock contention statistics, compiled in with make LOCKSTAT=1.
+//
+// acquire()/release() and their mcs and sleep lock counterparts count, per
+// lock name and call site, how often the lock was taken, how often the
+// taker had to wait, and the tsc cycles spent waiting and holding it.
+// each cpu keeps its own table, updated with interrupts off, so counting
+// needs no lock of its own; lockstatdump() adds the tables up.
+// ctrl-L on the console prints them.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+
+#ifdef LOCKSTAT
+
+#define NLOCKSTAT   64      // (name, call site) pairs tracked per cpu
+
+// the last entry collects whatever does not fit
+static struct lockstat lockstat[NCPU][NLOCKSTAT + 1];
+
+// this cpu's entry for lock name taken at pc. interrupts must be off.
+struct lockstat*
+lockstatget(char *name, uint pc)
+{
+    struct lockstat *tab, *s;
+    uint h, i;
+
+    tab = lockstat[cpuid()];
+    h = ((uint)name ^ pc) % NLOCKSTAT;
+    for (i = 0; i < NLOCKSTAT; i++) {
+        s = &tab[(h + i) % NLOCKSTAT];
+        if (s->name == name && s->pc == pc)
+            return s;
+        if (s->name == 0) {
+            s->name = name;
+            s->pc = pc;
+            return s;
+        }
+    }
+    s = &tab[NLOCKSTAT];
+    s->name = "(other)";
+    return s;
+}
+
+void
+lockstatacquired(struct lockstat *s, int contended, uint64 wait)
+{
+    s->nacquire++;
+    if (contended) {
+        s->ncontend++;
+        s->wait += wait;
+        if (wait > s->maxwait)
+            s->maxwait = wait;
+    }
+}
+
+// the lock counted in s, taken at tsc since, is being released
+void
+lockstatreleased(struct lockstat *s, uint64 since)
+{
+    uint64 hold = rdtsc() - since;
+
+    s->hold += hold;
+    if (hold > s->maxhold)
+        s->maxhold = hold;
+}
+
+// print the per-cpu tables added up by (name, call site).
+// totals are in units of 1024 cycles.
+void
+lockstatdump(void)
+{
+    struct lockstat sum, *s, *t;
+    int c, d, i, j;
+
+    cprintf("\nname pc acquire contended wait(kc) maxwait hold(kc) maxhold\n");
+    for (c = 0; c < ncpu; c++) {
+        for (i = 0; i <= NLOCKSTAT; i++) {
+            s = &lockstat[c][i];
+            if (s->name == 0)
+                continue;
+
+            // skip pairs an earlier cpu already printed
+            for (d = 0; d < c; d++) {
+                for (j = 0; j <= NLOCKSTAT; j++) {
+                    t = &lockstat[d][j];
+                    if (t->name == s->name && t->pc == s->pc)
+                        break;
+                }
+                if (j <= NLOCKSTAT)
+                    break;
+            }
+            if (d < c)
+                continue;
+
+            sum = *s;
+            for (d = c + 1; d < ncpu; d++) {
+                for (j = 0; j <= NLOCKSTAT; j++) {
+                    t = &lockstat[d][j];
+                    if (t->name != s->name || t->pc != s->pc)
+                        continue;
+                    sum.nacquire += t->nacquire;
+                    sum.ncontend += t->ncontend;
+                    sum.wait += t->wait;
+                    sum.hold += t->hold;
+                    if (t->maxwait > sum.maxwait)
+                        sum.maxwait = t->maxwait;
+                    if (t->maxhold > sum.maxhold)
+                        sum.maxhold = t->maxhold;
+                }
+            }
+            cprintf("%s %p %d %d %d %d %d %d\n", sum.name, sum.pc, sum.nacquire, sum.ncontend,
+                    (uint)(sum.wait >> 10), (uint)sum.maxwait, (uint)(sum.hold >> 10), (uint)sum.maxhold);
+        }
+    }
+}
+
+#else
+
+void
+lockstatdump(void)
+{
+    cprintf("\nlockstat: not compiled in, build with make LOCKSTAT=1\n");
+}
+
+#endif
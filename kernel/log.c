@@ -17,21 +17,39 @@
 //      block B
 //      block C
 //      ...
-// log appends are synchronous.
+// log appends are synchronous: commit() waits for each stage's writes,
+// which it issues together, before starting the next.
+//
+// installing committed blocks at their home locations is write-back:
+// commit() leaves them dirty in the cache, and the log keeps them, so
+// a later transaction's blocks go to the log after them. logflusher()
+// installs them once the oldest is FLUSHAGE ticks old, or on memory
+// pressure; commit() does when they would leave room for fewer than two
+// ops, or when begin_op() is already waiting for room, so they never
+// keep more ops out than a log without them would. installing waits for a moment with no transaction in
+// progress, when the cached blocks are exactly as committed, writes each
+// block once, in block order, and then empties the log.
+// a block committed again while waiting is logged again, and appears
+// twice in the header; recovery installs the copies in log order.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "log.h"
+#include "kstat.h"
 
 struct log log;
 
+#define FLUSHAGE    100     // ticks a committed block may wait to be installed
+
 static void recover_from_log(void);
 static void commit();
+static void checkpoint(void);
 
 void
 initlog(int dev)
@@ -41,6 +59,7 @@ initlog(int dev)
 
     struct superblock sb;
     initlock(&log.lock, "log");
+    initwaitq(&log.wq);
     readsb(dev, &sb);
     log.start = sb.logstart;
     log.size = sb.nlog;
@@ -52,15 +71,30 @@ initlog(int dev)
 static void
 install_trans(void)
 {
-    int tail;
+    struct buf *lbuf[LOGSIZE], *dbuf[LOGSIZE];
+    int tail, i;
 
+    // read the whole log in a command or two, write each block home,
+    // and only wait for the writes at the end
+    bread_range(log.dev, log.start + 1, log.lh.n, lbuf);
     for (tail = 0; tail < log.lh.n; tail++) {
-        struct buf *lbuf = bread(log.dev, log.start + tail + 1);    // read log block
-        struct buf *dbuf = bread(log.dev, log.lh.block[tail]);      // read dst
-        memmove(dbuf->data, lbuf->data, BSIZE);
-        bwrite(dbuf);
-        brelse(lbuf);
-        brelse(dbuf);
+        dbuf[tail] = 0;
+        // a block logged twice only needs its last copy
+        for (i = tail + 1; i < log.lh.n; i++)
+            if (log.lh.block[i] == log.lh.block[tail])
+                break;
+        if (i == log.lh.n) {
+            dbuf[tail] = bread(log.dev, log.lh.block[tail]);    // read dst
+            ssememmove(dbuf[tail]->data, lbuf[tail]->data, BSIZE);
+            bwrite_async(dbuf[tail]);
+        }
+        brelse(lbuf[tail]);
+    }
+    for (tail = 0; tail < log.lh.n; tail++) {
+        if (dbuf[tail]) {
+            biowait(dbuf[tail]);
+            brelse(dbuf[tail]);
+        }
     }
 }
 
@@ -101,6 +135,7 @@ recover_from_log(void)
     read_head();
     install_trans();    // if committed, copy from log to disk
     log.lh.n = 0;
+    log.ncommitted = 0;
     write_head();   // clear the log
 }
 
@@ -111,10 +146,12 @@ begin_op()
     acquire(&log.lock);
     while (1) {
         if (log.committing) {
-            sleep(&log, &log.lock);
+            waitsleep(&log.wq, &log.lock, 1);
         } else if (log.lh.n + (log.outstanding + 1) * MAXOPBLOCKS > LOGSIZE) {
-            // this op might exhaust log space; wait for commit;
-            sleep(&log, &log.lock);
+            // this op might exhaust log space; wait for commit,
+            // and have it install the committed blocks too
+            log.flushnow = 1;
+            waitsleep(&log.wq, &log.lock, 1);
         } else {
             log.outstanding += 1;
             release(&log.lock);
@@ -140,8 +177,9 @@ end_op(void)
     } else {
         // begin_op() may be waiting for log space,
         // and decrementing log.outstanding has decreased
-        // the amount of reserved space.
-        wakeup(&log);
+        // the amount of reserved space by one op's worth,
+        // which is room for one more waiter.
+        wake_one(&log.wq);
     }
     release(&log.lock);
 
@@ -150,7 +188,7 @@ end_op(void)
         commit();
         acquire(&log.lock);
         log.committing = 0;
-        wakeup(&log);
+        wake_all(&log.wq);
         release(&log.lock);
     }
 }
@@ -159,27 +197,111 @@ end_op(void)
 static void
 write_log(void)
 {
-    int tail;
+    struct buf *to[LOGSIZE], *from;
+    int tail, n;
 
-    for (tail = 0; tail < log.lh.n; tail++) {
-        struct buf *to = bread(log.dev, log.start + tail + 1);  // log block
-        struct buf *from = bread(log.dev, log.lh.block[tail]);  // cache block
-        memmove(to->data, from->data, BSIZE);
-        bwrite(to);     // write the log
+    // the log blocks of the transaction are consecutive: read and write
+    // them in a command or two each. blocks before ncommitted are in the
+    // log already.
+    n = log.lh.n - log.ncommitted;
+    bread_range(log.dev, log.start + log.ncommitted + 1, n, to);
+    for (tail = 0; tail < n; tail++) {
+        from = bread(log.dev, log.lh.block[log.ncommitted + tail]);  // cache block
+        ssememmove(to[tail]->data, from->data, BSIZE);
         brelse(from);
-        brelse(to);
     }
+    bwrite_range(to, n);    // write the log
+    for (tail = 0; tail < n; tail++)
+        brelse(to[tail]);
 }
 
 static void
 commit()
 {
-    if (log.lh.n > 0) {
+    if (log.lh.n > log.ncommitted) {
+        kstatinc(KS_LOGCOMMIT);
         write_log();    // write modified blocks from cache to log
         write_head();   // write header to disk -- the read commit
-        install_trans();    // now install writes to home location
-        log.lh.n = 0;
-        write_head();   // erase the transaction from log
+        if (log.ncommitted == 0)
+            log.committick = ticks;
+        log.ncommitted = log.lh.n;
+        // leave installing to logflusher(), unless begin_op() is
+        // waiting for room or would find it for fewer than two ops
+        if (log.flushnow || log.lh.n + 2 * MAXOPBLOCKS > LOGSIZE)
+            checkpoint();
+    }
+}
+
+// install the committed blocks at their home locations and empty the log.
+// the caller has set log.committing, with no transaction in progress.
+static void
+checkpoint(void)
+{
+    struct buf *b[LOGSIZE];
+    uint blk[LOGSIZE], x;
+    int i, j, n;
+
+    // each block once, in block order
+    n = 0;
+    for (i = 0; i < log.ncommitted; i++) {
+        x = log.lh.block[i];
+        for (j = n; j > 0 && blk[j - 1] > x; j--)
+            ;
+        if (j > 0 && blk[j - 1] == x)
+            continue;
+        memmove(&blk[j + 1], &blk[j], (n - j) * sizeof(blk[0]));
+        blk[j] = x;
+        n++;
+    }
+
+    for (i = 0; i < n; i++)
+        b[i] = bread(log.dev, blk[i]);  // cached: pinned by B_DIRTY
+    bwritev(b, n);
+    for (i = 0; i < n; i++) {
+        biowait(b[i]);
+        brelse(b[i]);
+    }
+
+    log.lh.n = 0;
+    log.ncommitted = 0;
+    log.flushnow = 0;
+    write_head();   // erase the transactions from log
+}
+
+// ask logflusher() to install committed blocks now, to let the
+// buffer cache give back their pages. called from kalloc().
+void
+logflushsoon(void)
+{
+    log.flushnow = 1;
+}
+
+// the log flusher, a kernel thread: installs committed blocks FLUSHAGE
+// ticks after the first of them was committed, or sooner if asked.
+void
+logflusher(void)
+{
+    int doflush;
+
+    for (;;) {
+        acquire(&tickslock);
+        sleep(&ticks, &tickslock);
+        release(&tickslock);
+
+        acquire(&log.lock);
+        doflush = log.ncommitted > 0 && log.outstanding == 0 && !log.committing &&
+                  (log.flushnow || ticks - log.committick >= FLUSHAGE);
+        if (doflush)
+            log.committing = 1;
+        release(&log.lock);
+
+        if (doflush) {
+            checkpoint();
+            acquire(&log.lock);
+            log.committing = 0;
+            wake_all(&log.wq);
+            release(&log.lock);
+        }
     }
 }
 
@@ -203,7 +325,8 @@ log_write(struct buf *b)
         panic("log_write: outside of trans, please wrap in begin_op()/end_op()");
 
     acquire(&log.lock);
-    for (i = 0; i < log.lh.n; i++) {
+    // committed blocks can't be absorbed: their log copy must stay as it is
+    for (i = log.ncommitted; i < log.lh.n; i++) {
         if (log.lh.block[i] == b->blockno)  // log absorb
             break;
     }
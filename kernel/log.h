@@ -14,8 +14,12 @@ struct log {
     int size;
     int outstanding;    // how man FS sys calls are executing
     int committing;     // in commit(), please wait
+    struct waitq wq;    // begin_op() callers waiting for a commit or log space
     int dev;
     struct logheader lh;
+    int ncommitted;     // lh.block[0..ncommitted) are committed, not installed yet
+    uint committick;    // ticks when the first of those was committed
+    int flushnow;       // memory or log space is short: install them now
 };
 
 #endif //AOS_LOG_H
@@ -19,19 +19,28 @@ int main(void)
     mpinit();       // detect other processors
     lapicinit();    // interrupt controller
     seginit();      // segment descriptors
+    fpuinit();      // lazy fpu/sse switching
     picinit();      // disable legacy pic
     ioapicinit();   // another interrupt controller
     uartinit();     // serial port
     cgainit();      // CGA
     consoleinit();  // console hardware
     pinit();         // process table
+    rcuinit();       // read-copy-update
     tvinit();       // trap vectors
-    binit();         // buffer cache
+    vdsoinit();     // user-readable time and cpu page
     fileinit();      // file table
+    pciinit();       // pci devices
     ideinit();       // disk
+    ahciinit();      // sata disks
+    virtioinit();    // virtio disk
+    memdiskinit();   // fs.img linked in, for kernelmemfs
     startothers();   // start other processors
     kinit2(P2V(4 * 1024 * 1024), P2V(PHYSTOP)); // init after SMP init
+    binit();         // buffer cache, sized from free memory
+    kthread("logflush", logflusher);    // write-back of committed log blocks
 //    userinit();      // first user
+//    syscallbench();  // null system call cost, int $T_SYSCALL vs sysenter
 
 
 
@@ -43,6 +52,7 @@ mpenter(void)
 {
     switchkvm();
     seginit();
+    fpuinit();
     lapicinit();
     mpmain(0);
 }
@@ -54,10 +64,12 @@ mpmain(int bsp)
     idtinit();       // load idt register
     xchg(&(mycpu()->started), 1); // tell startothers() we're up
     cprintf("cpu%d: starting as %s\n", cpuid(), bsp ? "BSP" : "AP");
+//    lockbench();     // lock cost with and without false sharing, every cpu
 
-    while (1) {
+    // interrupts are off: this cpu halts for good
+    rcuoffline();
+    while (1)
         asm volatile("hlt");
-    }
 
     // todo: need user space support
 //    scheduler();     // start running processes
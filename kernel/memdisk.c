@@ -0,0 +1,68 @@
+// memory disk: a copy of fs.img linked into the kernel serves ROOTDEV,
+// for measuring the file system and log without the disk in the way.
+//
+// make kernelmemfs links fs.img in after entryother, as _binary_fs_img_*;
+// the plain kernel has no image, and memdiskinit() leaves ROOTDEV to the
+// real disks. when there is an image, memdiskinit() registers it as
+// ROOTDEV in place of whatever disk had that number, see blkdev.c.
+//
+// a request is a memmove, done by the time blkstart() hands it over
+// returns, so submitting is all there is to it and a blkiowait() never
+// sleeps. the layers above run the same code as for a disk.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+#include "blkdev.h"
+
+#define MEMRUN  16      // most buffers per request
+
+// weak: 0 unless the image was linked in
+extern uchar _binary_fs_img_start[] __attribute__((weak));
+extern uchar _binary_fs_img_size[] __attribute__((weak));
+
+static uchar *memdisk;
+static uint nblock;
+static struct blkqueue memq;
+static struct blkdev memdev;
+
+// called by blkstart() with memq.lock held
+static void
+memdiskstart(struct blkqueue *bq, struct buf *b)
+{
+    struct buf *x;
+    uchar *p;
+
+    for (x = b; x; x = x->qnext) {
+        if (x->blockno >= nblock)
+            panic("memdiskstart: block out of range");
+        p = memdisk + x->blockno * BSIZE;
+        if (x->flags & B_DIRTY)
+            memmove(p, x->data, BSIZE);
+        else
+            memmove(x->data, p, BSIZE);
+    }
+    blkdone(bq, b);
+}
+
+void
+memdiskinit(void)
+{
+    if (_binary_fs_img_start == 0)
+        return;
+    memdisk = _binary_fs_img_start;
+    nblock = (uint)_binary_fs_img_size / BSIZE;
+    // in arrival order: with no seeks, sorting buys nothing
+    blkqinit(&memq, "memdisk", &fifosched, MEMRUN, 1, memdiskstart, 0);
+    memdev.name = "memdisk";
+    memdev.nq = 1;
+    memdev.qs = &memq;
+    blkregister(ROOTDEV, &memdev);
+    cprintf("memdisk: dev %d, %d blocks\n", ROOTDEV, nblock);
+}
@@ -11,6 +11,10 @@
 #define KERNBASE    0x80000000         // First kernel virtual address
 #define KERNLINK (KERNBASE+EXTMEM)  // Address where kernel is linked
 
+// Read-only pages at the top of every user address space (see vdso.h)
+#define VDSO        (KERNBASE-PGSIZE)   // kernel-wide time and cpu information
+#define VDSOPROC    (KERNBASE-2*PGSIZE) // per-process constants
+
 #define V2P(a) (((uint) (a)) - KERNBASE)
 #define P2V(a) ((void *)(((char *) (a)) + KERNBASE))
 
@@ -13,10 +13,29 @@
 
 // Control Register flags
 #define CR0_PE          0x00000001      // Protection Enable
+#define CR0_MP          0x00000002      // Monitor coProcessor
+#define CR0_EM          0x00000004      // Emulation
+#define CR0_TS          0x00000008      // Task Switched
+#define CR0_NE          0x00000020      // Numeric Error
 #define CR0_WP          0x00010000      // Write Protect
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_OSFXSR      0x00000200      // fxsave/fxrstor and SSE enabled
+#define CR4_OSXMMEXCPT  0x00000400      // unmasked SSE exceptions raise T_SIMDERR
+
+// Model specific registers for the sysenter/sysexit fast system call path.
+// sysenter loads %cs from MSR_SYSENTER_CS and %ss from the next descriptor;
+// sysexit uses the two descriptors after those for user %cs and %ss,
+// which is why SEG_KCODE, SEG_KDATA, SEG_UCODE, SEG_UDATA are consecutive.
+#define MSR_SYSENTER_CS     0x174
+#define MSR_SYSENTER_ESP    0x175
+#define MSR_SYSENTER_EIP    0x176
+
+// cpuid(1) %edx feature flags
+#define CPUID_SEP       0x00000800      // sysenter/sysexit supported
+#define CPUID_FXSR      0x01000000      // fxsave/fxrstor supported
+#define CPUID_SSE2      0x04000000      // SSE2 supported
 
 // various segment selectors.
 #define SEG_ZERO  0  // always zero
@@ -90,6 +109,14 @@ struct segdesc {
 
 // Page directory and page table constants.
 #define PGSIZE          4096    // bytes mapped by a page
+#define CACHELINE       64      // bytes per cache line, the unit cpus contend on
+
+// give a type or variable cache lines of its own, so that cpus writing it
+// don't slow down cpus using whatever would otherwise share its lines
+#define CACHEALIGNED    __attribute__((__aligned__(CACHELINE)))
+// fields a and b of t start in different cache lines
+#define APARTLINES(t, a, b) (__alignof__(t) >= CACHELINE && \
+        __builtin_offsetof(t, a) / CACHELINE != __builtin_offsetof(t, b) / CACHELINE)
 #define NPDENTRIES      (PGSIZE/sizeof(pde_t))    // # directory entries per page directory
 #define NPTENTRIES      (PGSIZE/sizeof(pte_t))    // # PTEs per page table
 
@@ -9,8 +9,10 @@
 #include "x86.h"
 
 struct cpu cpus[NCPU];
+_Static_assert(__alignof__(struct cpu) == CACHELINE, "struct cpu shares cache lines");
 int ncpu;
 uchar ioapicid;
+uint ioapiclow;     // I/O APIC inputs the table has active low
 
 static uchar
 sum(uchar *addr, int len)
@@ -94,10 +96,15 @@ mpinit(void)
     struct mpconf *conf;
     struct mpproc *proc;
     struct mpioapic *ioapic;
+    struct mpbus *bus;
+    struct mpiointr *intr;
+    uint pcibus;
+    int pol;
 
     if ((conf = mpconfig(&mp)) == 0)
         panic("mpinit: expect ro run on a SMP");
     ismp = 1;
+    pcibus = 0;
     lapic = (uint*)conf->lapicaddr;
     for (p = (uchar *)(conf + 1), e = (uchar *)conf + conf->length; p < e; ) {
         switch (*p) {
@@ -115,7 +122,21 @@ mpinit(void)
                 p += sizeof(struct mpioapic);
                 continue;;
             case MPBUS:
+                bus = (struct mpbus*)p;
+                if (memcmp(bus->bustype, "PCI", 3) == 0 && bus->busno < 32)
+                    pcibus |= 1U << bus->busno;
+                p += sizeof(struct mpbus);
+                continue;
             case MPIOINTR:
+                // bus entries come first, so pcibus is complete.
+                // a pci line conforming to its bus is active low
+                intr = (struct mpiointr*)p;
+                pol = intr->flags & MPPOLARITY;
+                if (intr->intin < 32 && (pol == MPPOL_LOW ||
+                    (pol == MPPOL_BUS && intr->busno < 32 && (pcibus & (1U << intr->busno)))))
+                    ioapiclow |= 1U << intr->intin;
+                p += sizeof(struct mpiointr);
+                continue;
             case MPLINTR:
                 p += 8;
                 continue;
@@ -51,6 +51,27 @@ struct mpioapic {
     uchar *addr;                // I/O APIC address
 };
 
+// bus table entry
+struct mpbus {
+    uchar type;                 // entry type (1)
+    uchar busno;                // bus id
+    uchar bustype[6];           // "PCI   ", "ISA   ", ...
+};
+
+// I/O interrupt table entry
+struct mpiointr {
+    uchar type;                 // entry type (3)
+    uchar irqtype;              // 0 for a vectored interrupt
+    ushort flags;
+#define MPPOLARITY  0x03        // polarity, in flags
+#define MPPOL_BUS   0x00        //   that of the source bus
+#define MPPOL_LOW   0x03        //   active low
+    uchar busno;                // source bus id
+    uchar busirq;               // source bus irq
+    uchar apicno;               // destination I/O APIC id
+    uchar intin;                // destination I/O APIC input
+};
+
 // table entry types
 #define MPPROC      0x00    // one per processor
 #define MPBUS       0x01    // one per bus
@@ -12,7 +12,8 @@
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define BCACHEPCT    10  // percent of free memory at boot for the disk block cache
 #define FSSIZE       1000  // size of file system in blocks
 
 
@@ -0,0 +1,172 @@
+// pci bus enumeration through configuration mechanism #1.
+//
+// pciinit() walks bus 0, the only one of the machines we run on
+// (qemu's i440fx has no bridges), and records every function it finds.
+// drivers then look their controller up by class or id.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_ADDR    0xCF8
+#define PCI_DATA    0xCFC
+#define NPCIDEV     32
+#define NPCIINTR    8
+
+static struct pcidev pcidevs[NPCIDEV];
+static int npcidev;
+
+// interrupt handlers by legacy irq line. lines are level-triggered
+// and may be shared, so each handler checks whether its device
+// interrupted and acks it, and trap() sends the eoi after them all.
+static struct {
+    int irq;
+    void (*fn)(void);
+} pciintrs[NPCIINTR];
+static int npciintr;
+
+static uint
+pciconfread(uint bus, uint dev, uint func, uint off)
+{
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+    return inl(PCI_DATA);
+}
+
+static void
+pciconfwrite(uint bus, uint dev, uint func, uint off, uint v)
+{
+    outl(PCI_ADDR, 0x80000000 | bus << 16 | dev << 11 | func << 8 | (off & 0xFC));
+    outl(PCI_DATA, v);
+}
+
+uint
+pciread(struct pcidev *d, uint off)
+{
+    return pciconfread(d->bus, d->dev, d->func, off);
+}
+
+void
+pciwrite(struct pcidev *d, uint off, uint v)
+{
+    pciconfwrite(d->bus, d->dev, d->func, off, v);
+}
+
+// let d decode its i/o and memory bars and, if bm, master the bus
+void
+pcienable(struct pcidev *d, int bm)
+{
+    uint cmd;
+
+    cmd = pciread(d, PCI_CMD) & 0xFFFF;
+    cmd |= PCI_CMD_IO | PCI_CMD_MEM;
+    if (bm)
+        cmd |= PCI_CMD_BM;
+    pciwrite(d, PCI_CMD, cmd);
+}
+
+static void
+pciadd(uint bus, uint dev, uint func, uint id)
+{
+    struct pcidev *d;
+    uint class;
+    int i;
+
+    if (npcidev == NPCIDEV) {
+        cprintf("pci: too many functions\n");
+        return;
+    }
+    d = &pcidevs[npcidev++];
+    d->bus = bus;
+    d->dev = dev;
+    d->func = func;
+    d->vendor = id & 0xFFFF;
+    d->device = id >> 16;
+    class = pciconfread(bus, dev, func, PCI_CLASS);
+    d->class = class >> 24;
+    d->subclass = class >> 16;
+    d->progif = class >> 8;
+    d->irq = pciconfread(bus, dev, func, PCI_IRQ);
+    for (i = 0; i < 6; i++)
+        d->bar[i] = pciconfread(bus, dev, func, PCI_BAR0 + 4 * i);
+    cprintf("pci: %d.%d.%d %x:%x class %x.%x irq %d\n",
+            bus, dev, func, d->vendor, d->device, d->class, d->subclass, d->irq);
+}
+
+void
+pciinit(void)
+{
+    uint dev, func, nfunc, id;
+
+    for (dev = 0; dev < 32; dev++) {
+        nfunc = 1;
+        for (func = 0; func < nfunc; func++) {
+            if ((id = pciconfread(0, dev, func, PCI_ID)) == 0xFFFFFFFF)
+                continue;
+            if (func == 0 && (pciconfread(0, dev, 0, PCI_HDR) & 0x800000))
+                nfunc = 8;      // multi-function device
+            pciadd(0, dev, func, id);
+        }
+    }
+}
+
+// the first function of class, as PCI_IDE etc.
+struct pcidev*
+pcifindclass(uint class)
+{
+    struct pcidev *d;
+
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+        if ((d->subclass << 8 | d->class) == class)
+            return d;
+    return 0;
+}
+
+// the first function with the given vendor and device ids
+struct pcidev*
+pcifindid(ushort vendor, ushort device)
+{
+    struct pcidev *d;
+
+    for (d = pcidevs; d < &pcidevs[npcidev]; d++)
+        if (d->vendor == vendor && d->device == device)
+            return d;
+    return 0;
+}
+
+// have trap() call fn for d's interrupts
+void
+pcisetintr(struct pcidev *d, void (*fn)(void))
+{
+    int i;
+
+    if (npciintr == NPCIINTR)
+        panic("pcisetintr");
+    for (i = 0; i < npciintr; i++)
+        if (pciintrs[i].irq == d->irq)
+            break;
+    pciintrs[npciintr].irq = d->irq;
+    pciintrs[npciintr].fn = fn;
+    npciintr++;
+    if (i == npciintr - 1)  // first handler on the line
+        ioapicenablelevel(d->irq, ncpu - 1);
+}
+
+// run the handlers for irq. returns 0 if there are none.
+int
+pciintr(int irq)
+{
+    int i, n;
+
+    for (i = n = 0; i < npciintr; i++) {
+        if (pciintrs[i].irq == irq) {
+            pciintrs[i].fn();
+            n++;
+        }
+    }
+    return n;
+}
@@ -0,0 +1,38 @@
+#ifndef AOS_PCI_H
+#define AOS_PCI_H
+
+// a pci function found by pciinit()
+struct pcidev {
+    uint bus;
+    uint dev;
+    uint func;
+    ushort vendor;
+    ushort device;
+    uchar class;
+    uchar subclass;
+    uchar progif;
+    uchar irq;          // legacy interrupt line
+    uint bar[6];        // base address registers, as read
+};
+
+// configuration space offsets
+#define PCI_ID          0x00    // device id << 16 | vendor id
+#define PCI_CMD         0x04    // status << 16 | command
+#define PCI_CLASS       0x08    // class, subclass, prog if, revision
+#define PCI_HDR         0x0C    // bist, header type, latency, line size
+#define PCI_BAR0        0x10
+#define PCI_IRQ         0x3C    // ..., interrupt pin, interrupt line
+
+#define PCI_CMD_IO      0x1     // respond to i/o space
+#define PCI_CMD_MEM     0x2     // respond to memory space
+#define PCI_CMD_BM      0x4     // bus master
+
+#define PCI_BAR_IO      0x1     // bar is in i/o space
+#define PCI_BAR_IOADDR(b)   ((b) & ~0x3)
+#define PCI_BAR_MEMADDR(b)  ((b) & ~0xF)
+
+// classes, subclass << 8 | class
+#define PCI_IDE         0x0101  // ide storage controller
+#define PCI_SATA        0x0601  // sata storage controller
+
+#endif //AOS_PCI_H
@@ -6,11 +6,18 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "seqlock.h"
 
+// pidseq lets kill() look up a pid without ptable.lock;
+// p->pid is only written with both held.
 struct {
-    struct spinlock lock;
-    struct proc proc[NPROC];
+    struct spinlock lock CACHEALIGNED;
+    struct seqlock pidseq CACHEALIGNED;
+    struct proc proc[NPROC] CACHEALIGNED;
 } ptable;
+_Static_assert(APARTLINES(__typeof__(ptable), lock, pidseq), "ptable.pidseq shares the lock's line");
+_Static_assert(APARTLINES(__typeof__(ptable), lock, proc), "ptable.proc shares the lock's line");
+_Static_assert(APARTLINES(__typeof__(ptable), pidseq, proc), "ptable.proc shares pidseq's line");
 
 //static struct proc *initproc;
 
@@ -24,6 +31,7 @@ void
 pinit(void)
 {
     initlock(&ptable.lock, "ptable");
+    initseqlock(&ptable.pidseq, "pidseq");
 }
 
 // Must be called with interrupts disabled
@@ -99,7 +107,9 @@ allocproc(void)
 
 found:
     p->state = EMBRTO;
+    acquireseq(&ptable.pidseq);
     p->pid = nextpid++;
+    releaseseq(&ptable.pidseq);
 
     release(&ptable.lock);
 
@@ -125,6 +135,8 @@ found:
     memset(p->context, 0, sizeof *p->context);
     p->context->eip = (uint)forkret;
 
+    fpuinitstate(p);
+
     return p;
 }
 
@@ -145,6 +157,9 @@ scheduler(void)
         // enable interrupts on this process
         sti();
 
+        // between processes this cpu holds no rcu references
+        rcuquiesce();
+
         // loop over process table looking for process to run.
         acquire(&ptable.lock);
         for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
@@ -155,9 +170,11 @@ scheduler(void)
             // release ptable.lock and then to reacquire it defore jumping back to us.
             c->proc = p;
             switchuvm(p);
+            fpuenter(p);
             p->state = RUNNING;
 
             swtch(&(c->scheduler), p->context);
+            fpuleave(p);
             switchkvm();
 
             // process is done running for now
@@ -202,6 +219,111 @@ yield(void)
     release(&ptable.lock);
 }
 
+// exit the current process. does not return.
+// the process is left a zombie for runinit(), which switched to it and
+// frees it; there are no open files, cwd or children to give up yet.
+void
+exit(void)
+{
+    struct proc *curproc = myproc();
+
+    acquire(&ptable.lock);
+
+    // jump into the scheduler, never to return.
+    curproc->state = ZOMBIE;
+    sched();
+    panic("zombie exit");
+}
+
+// first scheduling of a runinit() process; skips forkret's
+// file system setup, which needs the real scheduler running.
+static void
+runinitret(void)
+{
+    // still holding ptable.lock from runinit
+    release(&ptable.lock);
+}
+
+// load the user image init (less than a page) at address 0 of a new process
+// and run it on this cpu until it exits, standing in for scheduler() and wait().
+// the process's page is copied back over init afterwards, so that the caller
+// can collect results the process left there (see syscallbench()).
+void
+runinit(char *init, uint sz)
+{
+    struct proc *p;
+    struct cpu *c;
+    int intena;
+
+    if ((p = allocproc()) == 0)
+        panic("runinit: no process");
+    if ((p->pgdir = setupkvm()) == 0)
+        panic("runinit: out of memory");
+    inituvm(p->pgdir, init, sz);
+    p->sz = PGSIZE;
+    memset(p->tf, 0, sizeof(*p->tf));
+    p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+    p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+    p->tf->es = p->tf->ds;
+    p->tf->ss = p->tf->ds;
+    p->tf->eflags = FL_IF;
+    p->tf->esp = PGSIZE;
+    p->tf->eip = 0;     // beginning of init
+    p->context->eip = (uint)runinitret;
+    safestrcpy(p->name, "runinit", sizeof(p->name));
+    vdsosetproc(p);
+
+    acquire(&ptable.lock);
+    c = mycpu();
+    intena = c->intena;
+    c->proc = p;
+    switchuvm(p);
+    fpuenter(p);
+    p->state = RUNNING;
+    swtch(&c->scheduler, p->context);
+    fpuleave(p);
+    switchkvm();
+    c->proc = 0;
+    c->intena = intena;
+
+    if (p->state != ZOMBIE)
+        panic("runinit: process did not exit");
+    memmove(init, uva2ka(p->pgdir, 0), sz);
+    kfree(p->kstack);
+    p->kstack = 0;
+    freevm(p->pgdir);
+    p->pgdir = 0;
+    acquireseq(&ptable.pidseq);
+    p->pid = 0;
+    releaseseq(&ptable.pidseq);
+    p->parent = 0;
+    p->name[0] = 0;
+    p->killed = 0;
+    p->state = UNUSED;
+    release(&ptable.lock);
+}
+
+// create a kernel thread running fn(), which must not return.
+// its first scheduling goes through forkret() like a fork child's,
+// which then returns to fn() instead of trapret.
+struct proc*
+kthread(char *name, void (*fn)(void))
+{
+    struct proc *p;
+
+    if ((p = allocproc()) == 0)
+        panic("kthread: no process");
+    if ((p->pgdir = setupkvm()) == 0)
+        panic("kthread: out of memory");
+    *(uint*)(p->context + 1) = (uint)fn;    // see allocproc()
+    safestrcpy(p->name, name, sizeof(p->name));
+
+    acquire(&ptable.lock);
+    p->state = RUNNABLE;
+    release(&ptable.lock);
+    return p;
+}
+
 // a fork child's very first scheduling by scheduler()
 // will swtch() here. "return" to user space
 void
@@ -218,6 +340,8 @@ forkret(void)
         first = 0;
 //        iinit(ROOTDEV);
         initlog(ROOTDEV);
+//        bcachebench();  // scan resistance, 2Q vs strict lru
+//        blkpollbench(); // read latency, polled vs interrupt completion
     }
 
     // return to "caller", actually trapret (see allocproc)
@@ -272,6 +396,17 @@ wakeup1(void *chan)
             p->state = RUNNABLE;
 }
 
+// wake p alone, if it is sleeping on chan.
+// unlike wakeup(), doesn't scan the process table.
+void
+wakeproc(struct proc *p, void *chan)
+{
+    acquire(&ptable.lock);
+    if (p->state == SLEEPING && p->chan == chan)
+        p->state = RUNNABLE;
+    release(&ptable.lock);
+}
+
 // wake up all process sleeping on chan
 void
 wakeup(void *chan)
@@ -287,23 +422,34 @@ int
 kill(int pid)
 {
     struct proc *p;
+    uint s;
+
+    // find the slot without holding ptable.lock,
+    // so the scan doesn't hold up the scheduler on other cpus.
+    do {
+        s = readseqbegin(&ptable.pidseq);
+        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+            if (p->pid == pid)
+                break;
+    } while (readseqretry(&ptable.pidseq, s));
+    if (p == &ptable.proc[NPROC])
+        return -1;
 
     acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-        if (p->pid == pid) {
-            p->killed = 1;
-            // wake process from sleep if necessary
-            // sleep on sleeplock is fine, because it won't run any more,
-            // it will be killed in trap.c when scheduled
-            if (p->state == SLEEPING) {
-                p->state = RUNNABLE;
-            }
-            release(&ptable.lock);
-            return 0;
-        }
+    if (p->pid != pid) {
+        // exited since the lookup
+        release(&ptable.lock);
+        return -1;
+    }
+    p->killed = 1;
+    // wake process from sleep if necessary
+    // sleep on sleeplock is fine, because it won't run any more,
+    // it will be killed in trap.c when scheduled
+    if (p->state == SLEEPING) {
+        p->state = RUNNABLE;
     }
     release(&ptable.lock);
-    return -1;
+    return 0;
 }
 
 //
\ No newline at end of file
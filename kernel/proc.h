@@ -11,7 +11,11 @@ struct cpu {
     int ncli;                   // depth of pushcli nesting
     int intena;                 // ware interrupt enabled before pushcli?
     struct proc *proc;          // the process running on this cpu or null
-};
+    struct proc *fpuowner;      // whose saved fpu state the fpu registers hold, see fpu.c
+    int kfpu;                   // inside kernel_fpu_begin()?
+    volatile uint rcuepoch;     // rcu epoch of this cpu's last quiescent state, see rcu.c
+    volatile int rcuoff;        // halted for good, rcu doesn't wait for it
+} CACHEALIGNED;                 // ncli and intena change on every pushcli()/popcli()
 
 extern struct cpu cpus[NCPU];
 extern int ncpu;
@@ -34,6 +38,11 @@ struct context {
     uint eip;
 };
 
+// x87/MMX/SSE register state, in fxsave format
+struct fpu {
+    uchar fxsave[512];
+} __attribute__((__aligned__(16)));
+
 enum procstate {
     UNUSED,
     EMBRTO,
@@ -57,6 +66,11 @@ struct proc {
     struct file *ofile;         // open files
     struct inode *cwd;          // current directory
     char name[16];              // process name (debugging)
+    struct fpu fpu;             // fpu state while not in the fpu registers
+    struct cpu *fpucpu;         // cpu whose fpu registers last matched fpu, or null
+    struct waitq *wq;           // if non-zero, waiting in this queue
+    struct proc *wqnext;        // next waiter in wq
+    int wqexcl;                 // exclusive waiter in wq?
 };
 
 // process memory is laid out contiguously, low addresses first:
@@ -0,0 +1,144 @@
+// Read-copy-update, epoch based.
+//
+// readers bracket a lockless lookup with rcureadlock()/rcureadunlock(),
+// which only turn interrupts off: a cpu inside a read section can't
+// be switched away. a cpu passing through scheduler() therefore holds
+// no references from earlier read sections, and reports a quiescent
+// state with rcuquiesce(). a cpu that halts for good, as the idle loop
+// in mpmain() does while there is no scheduler, calls rcuoffline() first.
+//
+// rcu.epoch advances once every started cpu that isn't offline has
+// reported a quiescent state in the current epoch. an object unlinked during epoch e may still be seen
+// by readers that quiesce in e, but not by any reader after e+1 ends, so
+// callbacks queued by callrcu() in epoch e run once the epoch reaches e+2.
+//
+// updaters still serialize among themselves with their own locks.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "rcu.h"
+
+static struct {
+    struct spinlock lock;       // protects the callback list
+    volatile uint epoch;
+    struct rcuhead *head;       // pending callbacks, oldest first
+    struct rcuhead **tail;
+} rcu;
+
+void
+rcuinit(void)
+{
+    initlock(&rcu.lock, "rcu");
+    rcu.epoch = 0;
+    rcu.head = 0;
+    rcu.tail = &rcu.head;
+}
+
+void
+rcureadlock(void)
+{
+    pushcli();
+}
+
+void
+rcureadunlock(void)
+{
+    popcli();
+}
+
+// advance the epoch if every started, online cpu has seen the current one
+static void
+rcuadvance(uint e)
+{
+    struct cpu *c;
+
+    for (c = cpus; c < cpus + ncpu; c++)
+        if (c->started && !c->rcuoff && c->rcuepoch != e)
+            return;
+    __sync_bool_compare_and_swap(&rcu.epoch, e, e + 1);
+}
+
+// the calling cpu holds no rcu references.
+// called from scheduler(), with no locks held.
+void
+rcuquiesce(void)
+{
+    struct rcuhead *done, *r;
+    uint e;
+
+    pushcli();
+    e = rcu.epoch;
+    mycpu()->rcuepoch = e;
+    mycpu()->rcuoff = 0;
+    rcuadvance(e);
+    popcli();
+
+    if (rcu.head == 0)
+        return;
+
+    // take the callbacks whose grace period has ended
+    acquire(&rcu.lock);
+    e = rcu.epoch;
+    done = rcu.head;
+    for (r = 0; rcu.head && e - rcu.head->epoch >= 2; rcu.head = rcu.head->next)
+        r = rcu.head;
+    if (r == 0) {
+        release(&rcu.lock);
+        return;
+    }
+    r->next = 0;
+    if (rcu.head == 0)
+        rcu.tail = &rcu.head;
+    release(&rcu.lock);
+
+    while (done) {
+        r = done;
+        done = done->next;
+        r->func(r);
+    }
+}
+
+// the calling cpu won't read again until its next rcuquiesce():
+// stop waiting for it, or the epoch could never advance.
+void
+rcuoffline(void)
+{
+    pushcli();
+    mycpu()->rcuoff = 1;
+    rcuadvance(rcu.epoch);
+    popcli();
+}
+
+// call func(r) once every reader that might hold a reference
+// to the object r belongs to has left its read section.
+// the caller must already have unlinked the object.
+void
+callrcu(struct rcuhead *r, void (*func)(struct rcuhead*))
+{
+    r->func = func;
+    r->next = 0;
+    acquire(&rcu.lock);
+    r->epoch = rcu.epoch;
+    *rcu.tail = r;
+    rcu.tail = &r->next;
+    release(&rcu.lock);
+}
+
+// wait for a full grace period. must not be called
+// from a read section or with locks held.
+void
+rcusync(void)
+{
+    uint e = rcu.epoch;
+
+    while (rcu.epoch - e < 2) {
+        rcuquiesce();
+        pause();
+    }
+}
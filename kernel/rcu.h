@@ -0,0 +1,12 @@
+#ifndef AOS_RCU_H
+#define AOS_RCU_H
+
+// a deferred callback, usually embedded in the object it frees;
+// func gets the rcuhead back and finds the object from it.
+struct rcuhead {
+    struct rcuhead *next;
+    void (*func)(struct rcuhead*);
+    uint epoch;         // rcu epoch when queued by callrcu()
+};
+
+#endif //AOS_RCU_H
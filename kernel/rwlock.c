@@ -0,0 +1,99 @@
+// reader-writer spin locks.
+//
+// like spinlocks, both kinds of holder keep interrupts off, must not
+// sleep, and should hold the lock briefly. readers may only change
+// shared data they could also change without the lock, such as a
+// reference count updated with an atomic instruction; everything else
+// needs the write lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "rwlock.h"
+
+void
+initrwlock(struct rwlock *lk, char *name)
+{
+    lk->name = name;
+    lk->cnt = 0;
+    lk->cpu = 0;
+}
+
+void
+acquireread(struct rwlock *lk)
+{
+    uint c;
+
+    pushcli();  // disable interrupt to avoid deadlock
+    if (holdingwrite(lk))
+        panic("acquireread");
+
+    for (;;) {
+        c = lk->cnt;
+        if ((c & RW_WRITER) == 0 && __sync_bool_compare_and_swap(&lk->cnt, c, c + 1))
+            break;
+        pause();
+    }
+    // the locked cmpxchg keeps the critical section's references after it
+}
+
+void
+releaseread(struct rwlock *lk)
+{
+    if ((lk->cnt & ~RW_WRITER) == 0)
+        panic("releaseread");
+    __sync_fetch_and_sub(&lk->cnt, 1);
+    popcli();
+}
+
+void
+acquirewrite(struct rwlock *lk)
+{
+    uint c;
+
+    pushcli();  // disable interrupt to avoid deadlock
+    if (holdingwrite(lk))
+        panic("acquirewrite");
+
+    // claim the writer bit, which keeps new readers out,
+    // then wait for the readers already inside to leave.
+    for (;;) {
+        c = lk->cnt;
+        if ((c & RW_WRITER) == 0 && __sync_bool_compare_and_swap(&lk->cnt, c, c | RW_WRITER))
+            break;
+        pause();
+    }
+    while (lk->cnt != RW_WRITER)
+        pause();
+    __sync_synchronize();
+
+    lk->cpu = mycpu();
+}
+
+void
+releasewrite(struct rwlock *lk)
+{
+    if (!holdingwrite(lk))
+        panic("releasewrite");
+    lk->cpu = 0;
+    __sync_synchronize();
+    // no reader can have changed cnt while the writer bit is set
+    asm volatile("movl $0, %0" : "+m" (lk->cnt) : );
+    popcli();
+}
+
+// check whether this cpu is holding the lock for writing
+int
+holdingwrite(struct rwlock *lk)
+{
+    int r;
+
+    pushcli();
+    r = lk->cnt == RW_WRITER && lk->cpu == mycpu();
+    popcli();
+    return r;
+}
@@ -0,0 +1,18 @@
+#ifndef AOS_RWLOCK_H
+#define AOS_RWLOCK_H
+
+// reader-writer spin lock, for read-mostly data.
+// any number of readers may hold it at once, or one writer.
+// a waiting writer keeps new readers out, so writers don't starve.
+// icache and bcache lookups moved on to rcu, see rcu.c; the lock is
+// left for tables whose readers may sleep or take long.
+struct rwlock {
+    volatile uint cnt;  // RW_WRITER bit, plus number of readers holding it
+
+    char *name;         // name of lock (for debug)
+    struct cpu *cpu;    // the cpu holding it for writing
+};
+
+#define RW_WRITER   0x80000000
+
+#endif //AOS_RWLOCK_H
@@ -0,0 +1,49 @@
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "seqlock.h"
+
+void
+initseqlock(struct seqlock *sl, char *name)
+{
+    initlock(&sl->lk, name);
+    sl->seq = 0;
+}
+
+void
+acquireseq(struct seqlock *sl)
+{
+    acquire(&sl->lk);
+    sl->seq++;
+    __sync_synchronize();
+}
+
+void
+releaseseq(struct seqlock *sl)
+{
+    __sync_synchronize();
+    sl->seq++;
+    release(&sl->lk);
+}
+
+// start a read; waits out a write in progress
+uint
+readseqbegin(struct seqlock *sl)
+{
+    uint s;
+
+    while ((s = sl->seq) & 1)
+        pause();
+    __sync_synchronize();
+    return s;
+}
+
+// did a write happen since readseqbegin() returned s?
+int
+readseqretry(struct seqlock *sl, uint s)
+{
+    __sync_synchronize();
+    return sl->seq != s;
+}
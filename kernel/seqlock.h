@@ -0,0 +1,17 @@
+#ifndef AOS_SEQLOCK_H
+#define AOS_SEQLOCK_H
+
+// sequence lock, for small read-mostly data whose readers can retry.
+// writers serialize on lk and make seq odd while they update;
+// readers take no lock at all:
+//
+//      do {
+//          s = readseqbegin(&sl);
+//          ... copy the data ...
+//      } while (readseqretry(&sl, s));
+struct seqlock {
+    volatile uint seq;  // even when no write is in progress
+    struct spinlock lk; // serializes writers
+};
+
+#endif //AOS_SEQLOCK_H
@@ -8,33 +8,182 @@
 #include "spinlock.h"
 #include "sleeplock.h"
 
+// wait queues.
+// the caller of each function below holds the spinlock that guards both
+// the queue and the condition waited for, as it would for sleep().
+
+void
+initwaitq(struct waitq *wq)
+{
+    wq->head = 0;
+    wq->tail = 0;
+}
+
+// remove p from wq, if it's still there
+static void
+waitqremove(struct waitq *wq, struct proc *p)
+{
+    struct proc *q, *prev;
+
+    prev = 0;
+    for (q = wq->head; q; prev = q, q = q->wqnext) {
+        if (q == p) {
+            if (prev)
+                prev->wqnext = p->wqnext;
+            else
+                wq->head = p->wqnext;
+            if (wq->tail == p)
+                wq->tail = prev;
+            break;
+        }
+    }
+    p->wqnext = 0;
+    p->wq = 0;
+}
+
+// join wq and sleep, releasing lk while asleep.
+// an exclusive waiter is woken by wake_one()/wake_n() only when its turn comes;
+// a non-exclusive one whenever any waiter is. like sleep(), returns with lk
+// held, and the caller should recheck its condition.
+void
+waitsleep(struct waitq *wq, struct spinlock *lk, int excl)
+{
+    struct proc *p = myproc();
+
+    p->wq = wq;
+    p->wqexcl = excl;
+    if (excl) {
+        p->wqnext = 0;
+        if (wq->tail)
+            wq->tail->wqnext = p;
+        else
+            wq->head = p;
+        wq->tail = p;
+    } else {
+        p->wqnext = wq->head;
+        wq->head = p;
+        if (wq->tail == 0)
+            wq->tail = p;
+    }
+
+    sleep(wq, lk);
+
+    // woken by someone else, e.g. kill()
+    if (p->wq)
+        waitqremove(wq, p);
+}
+
+// wake the non-exclusive waiters in wq and the first n exclusive ones.
+// returns the number of processes woken.
+int
+wake_n(struct waitq *wq, int n)
+{
+    struct proc *p;
+    int woken = 0;
+
+    while ((p = wq->head) != 0 && (!p->wqexcl || n > 0)) {
+        wq->head = p->wqnext;
+        if (wq->head == 0)
+            wq->tail = 0;
+        if (p->wqexcl)
+            n--;
+        p->wqnext = 0;
+        p->wq = 0;
+        wakeproc(p, wq);
+        woken++;
+    }
+    return woken;
+}
+
+int
+wake_one(struct waitq *wq)
+{
+    return wake_n(wq, 1);
+}
+
+int
+wake_all(struct waitq *wq)
+{
+    return wake_n(wq, NPROC);
+}
+
+#define SPINMAX     1000    // pause()s to wait for a running holder before sleeping
+
 void
 initsleeplock(struct sleeplock *lk, char *name)
 {
     initlock(&lk->lk, "sleep lock");
     lk->name = name;
     lk->locked = 0;
+    lk->owner = 0;
+    initwaitq(&lk->wq);
     lk->pid = 0;
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+    struct proc *p = myproc();
+    struct proc *owner;
+    int n;
+#ifdef LOCKSTAT
+    uint64 t0 = rdtsc();
+    uint pcs[10];
+    int contended;
+#endif
+
+    // a holder running on another cpu will likely release soon;
+    // waiting for it is cheaper than sleeping and being woken.
+    // a holder that is not running could take arbitrarily long.
+    for (n = 0; n < SPINMAX && lk->locked; n++) {
+        owner = lk->owner;
+        if (owner == 0 || owner->state != RUNNING)
+            break;
+        pause();
+    }
+
     acquire(&lk->lk);
-    while (lk->locked) {
-        sleep(lk, &lk->lk);
+#ifdef LOCKSTAT
+    contended = lk->locked;
+#endif
+    if (lk->locked) {
+        // wait in line; releasesleep() makes us the owner before waking us.
+        while (lk->owner != p)
+            waitsleep(&lk->wq, &lk->lk, 1);
+    } else {
+        lk->locked = 1;
+        lk->owner = p;
+        lk->pid = p->pid;
     }
-    lk->locked = 1;
-    lk->pid = myproc()->pid;
+#ifdef LOCKSTAT
+    getcallerpcs(&lk, pcs);
+    lk->pc = pcs[0];
+    lk->tsc = rdtsc();
+    lockstatacquired(lockstatget(lk->name, lk->pc), contended, lk->tsc - t0);
+#endif
     release(&lk->lk);
 }
 
 void
 releasesleep(struct sleeplock *lk)
 {
+    struct proc *p;
+
     acquire(&lk->lk);
-    lk->locked = 0;
-    lk->pid = 0;
+#ifdef LOCKSTAT
+    lockstatreleased(lockstatget(lk->name, lk->pc), lk->tsc);
+#endif
+    if ((p = lk->wq.head) != 0) {
+        // hand the lock to the first waiter, which keeps it locked
+        // and lets nobody else slip in before the waiter runs.
+        lk->owner = p;
+        lk->pid = p->pid;
+        wake_one(&lk->wq);
+    } else {
+        lk->locked = 0;
+        lk->owner = 0;
+        lk->pid = 0;
+    }
     release(&lk->lk);
 }
 
@@ -44,7 +193,7 @@ holdingsleep(struct sleeplock *lk)
     int r;
 
     acquire(&lk->lk);
-    r = lk->locked && (lk->pid == myproc()->pid);
+    r = lk->locked && lk->owner == myproc();
     release(&lk->lk);
     return r;
-}
\ No newline at end of file
+}
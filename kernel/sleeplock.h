@@ -1,14 +1,31 @@
 #ifndef AOS_SLEEPLOCK_H
 #define AOS_SLEEPLOCK_H
 
+// queue of processes sleeping until some condition holds, see sleeplock.c.
+// unlike sleep()/wakeup() on a channel, a waker can wake just one
+// or a few exclusive waiters instead of every process waiting.
+struct waitq {
+    struct proc *head;  // non-exclusive waiters first, then exclusive ones in FIFO order
+    struct proc *tail;
+};
+
 // long-term locks for processes
+// an acquirer spins for a while if the holder is running on another cpu,
+// then queues up and sleeps; releasesleep() hands the lock straight to
+// the first process in line and wakes only that one.
 struct sleeplock {
     uint locked;        // is the lock held?
     struct spinlock lk; // spinlock protecting this sleep lock
+    struct proc *owner; // process holding lock
+    struct waitq wq;    // processes waiting for it, all exclusive
 
     // for debugging
     char *name;         // name of lock
     int pid;            // process holding lock
+#ifdef LOCKSTAT
+    uint pc;            // where the holder acquired it
+    uint64 tsc;         // when the holder acquired it
+#endif
 };
 
 #endif //AOS_SLEEPLOCK_H
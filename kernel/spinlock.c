@@ -7,11 +7,19 @@
 #include "proc.h"
 #include "spinlock.h"
 
+// a lock taken on its own should cost one cache line
+// (lockstat's extra fields don't fit)
+#ifndef LOCKSTAT
+_Static_assert(sizeof(struct spinlock) <= CACHELINE, "struct spinlock spans cache lines");
+_Static_assert(sizeof(struct mcslock) <= CACHELINE, "struct mcslock spans cache lines");
+#endif
+
 void
 initlock(struct spinlock *lk, char *name)
 {
     lk->name = name;
-    lk->locked = 0;
+    lk->next = 0;
+    lk->owner = 0;
     lk->cpu = 0;
 }
 
@@ -22,13 +30,25 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+    uint ticket;
+#ifdef LOCKSTAT
+    uint64 t0 = rdtsc(), now;
+    int contended;
+#endif
+
     pushcli();  // disable interrupt to avoid deadlock
     if (holding(lk))
         panic("acquire");
 
-    // the xchg instruct is atomic
-    while (xchg(&lk->locked, 1) != 0)
-        ;
+    // the xadd instruction is atomic; waiters then only read owner,
+    // which changes once per release, instead of bouncing the line
+    // with a locked write per spin.
+    ticket = xadd(&lk->next, 1);
+#ifdef LOCKSTAT
+    contended = lk->owner != ticket;
+#endif
+    while (lk->owner != ticket)
+        pause();
 
     // tell the C compiler and the processor not to move loads or stores
     // past this point, to ensure that the critical section's memory
@@ -38,6 +58,12 @@ acquire(struct spinlock *lk)
     // record info about lock acquisition for debugging
     lk->cpu = mycpu();
     getcallerpcs(&lk, lk->pcs);
+#ifdef LOCKSTAT
+    now = rdtsc();
+    lk->stat = lockstatget(lk->name, lk->pcs[0]);
+    lockstatacquired(lk->stat, contended, now - t0);
+    lk->tsc = now;
+#endif
 }
 
 void
@@ -46,6 +72,9 @@ release(struct spinlock *lk)
     if (!holding(lk))
         panic("release: didn't hold the lock\n");
 
+#ifdef LOCKSTAT
+    lockstatreleased(lk->stat, lk->tsc);
+#endif
     lk->pcs[0] = 0;
     lk->cpu = 0;
 
@@ -56,14 +85,99 @@ release(struct spinlock *lk)
     // stores; __sync_synchronize() tells them both not to.
     __sync_synchronize();
 
-    // release the lock, equivalent lock->locked = 0
-    // this code can't use a C assignment, since it might not be atomic
+    // release the lock by serving the next ticket. only the holder writes owner,
+    // so one plain store is enough, but it must be a single store:
     // a real OS would use C atomics here
-    asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+    asm volatile("movl %1, %0" : "+m" (lk->owner) : "r" (lk->owner + 1));
+
+    popcli();
+}
+
+void
+initmcslock(struct mcslock *lk, char *name)
+{
+    lk->name = name;
+    lk->tail = 0;
+    lk->cpu = 0;
+}
+
+// acquire an mcs lock, queueing node me behind the current tail.
+// each waiter spins on its own me->wait, which only its predecessor writes.
+void
+acquiremcs(struct mcslock *lk, struct mcsnode *me)
+{
+    struct mcsnode *prev;
+#ifdef LOCKSTAT
+    uint64 t0 = rdtsc(), now;
+#endif
+
+    pushcli();  // disable interrupt to avoid deadlock
+    if (holdingmcs(lk))
+        panic("acquiremcs");
+
+    me->next = 0;
+    me->wait = 1;
+    prev = (struct mcsnode*)xchg((volatile uint*)&lk->tail, (uint)me);
+    if (prev) {
+        prev->next = me;
+        while (me->wait)
+            pause();
+    }
+
+    __sync_synchronize();
+
+    lk->cpu = mycpu();
+    getcallerpcs(&lk, lk->pcs);
+#ifdef LOCKSTAT
+    now = rdtsc();
+    lk->stat = lockstatget(lk->name, lk->pcs[0]);
+    lockstatacquired(lk->stat, prev != 0, now - t0);
+    lk->tsc = now;
+#endif
+}
+
+// release an mcs lock, handing it directly to the next waiter if there is one.
+// me must be the node passed to acquiremcs().
+void
+releasemcs(struct mcslock *lk, struct mcsnode *me)
+{
+    if (!holdingmcs(lk))
+        panic("releasemcs: didn't hold the lock\n");
+
+#ifdef LOCKSTAT
+    lockstatreleased(lk->stat, lk->tsc);
+#endif
+    lk->pcs[0] = 0;
+    lk->cpu = 0;
+
+    __sync_synchronize();
+
+    if (me->next == 0) {
+        // nobody queued: swing tail back to null
+        if (__sync_bool_compare_and_swap(&lk->tail, me, 0)) {
+            popcli();
+            return;
+        }
+        // a waiter has swapped itself in but not linked to us yet
+        while (me->next == 0)
+            pause();
+    }
+    me->next->wait = 0;
 
     popcli();
 }
 
+int
+holdingmcs(struct mcslock *lk)
+{
+    int r;
+
+    pushcli();
+    r = lk->tail != 0 && lk->cpu == mycpu();
+    popcli();
+    return r;
+}
+
 // record the current call stack in pcs[] by following the %ebp chain
 // still don't know how does it operate
 // Record the current call stack in pcs[] by following the %ebp chain.
@@ -91,7 +205,7 @@ holding(struct spinlock *lock)
     int r;
 
     pushcli();
-    r = lock->locked && lock->cpu == mycpu();
+    r = lock->next != lock->owner && lock->cpu == mycpu();
     popcli();
     return r;
 }
@@ -120,4 +234,87 @@ popcli(void)
         panic("popcli: pushcli operation not matched");
     if (mycpu()->ncli == 0 && mycpu()->intena)
         sti();
-}
\ No newline at end of file
+}
+
+// multi-core lock microbenchmark.
+//
+// every cpu calls lockbench() from mpmain(), and each takes and releases
+// a lock NLOCKBENCH times in three rounds:
+// * packed: a lock of its own, in an array that puts neighbouring cpus'
+//   locks in the same cache lines, as unpadded per-cpu data would.
+// * padded: a lock of its own, on cache lines of its own.
+// * shared: one lock for all cpus.
+// cpu 0 prints the average cost of an acquire/release pair for each round.
+#define NLOCKBENCH  100000
+
+struct benchlock {
+    struct spinlock lk;
+    uint n;             // changed under lk
+};
+
+static struct benchlock packed[NCPU];
+static struct {
+    struct benchlock b;
+} CACHEALIGNED padded[NCPU];
+static struct benchlock shared CACHEALIGNED;
+
+static volatile uint benchdone;     // barrier arrivals so far
+static uint benchcycles[3][NCPU];
+
+// wait until every cpu has arrived at the n'th barrier
+static void
+benchbarrier(uint n)
+{
+    xadd(&benchdone, 1);
+    while (benchdone < n * ncpu)
+        pause();
+}
+
+static uint
+benchround(struct benchlock *b)
+{
+    uint64 t0;
+    int i;
+
+    t0 = rdtsc();
+    for (i = 0; i < NLOCKBENCH; i++) {
+        acquire(&b->lk);
+        b->n++;
+        release(&b->lk);
+    }
+    return (uint)(rdtsc() - t0);
+}
+
+void
+lockbench(void)
+{
+    static char *names[3] = { "packed", "padded", "shared" };
+    int id, r, c;
+    uint sum;
+
+    pushcli();
+    id = cpuid();
+    popcli();
+
+    initlock(&packed[id].lk, "bench packed");
+    initlock(&padded[id].b.lk, "bench padded");
+    if (id == 0)
+        initlock(&shared.lk, "bench shared");
+
+    benchbarrier(1);
+    benchcycles[0][id] = benchround(&packed[id]);
+    benchbarrier(2);
+    benchcycles[1][id] = benchround(&padded[id].b);
+    benchbarrier(3);
+    benchcycles[2][id] = benchround(&shared);
+    benchbarrier(4);
+
+    if (id != 0)
+        return;
+    for (r = 0; r < 3; r++) {
+        sum = 0;
+        for (c = 0; c < ncpu; c++)
+            sum += benchcycles[r][c] / NLOCKBENCH;
+        cprintf("lockbench: %s %d cycles/acquire, %d cpus\n", names[r], sum / ncpu, ncpu);
+    }
+}
@@ -1,13 +1,54 @@
 #ifndef AOS_SPINLOCK_H
 #define AOS_SPINLOCK_H
 
-// mutual exclusion lock, reentrant lock
+// contention counters for one lock name and call site, see lockstat.c
+struct lockstat {
+    char *name;         // name of lock
+    uint pc;            // where it was acquired
+    uint nacquire;      // times acquired
+    uint ncontend;      // times the acquirer had to wait
+    uint64 wait;        // tsc cycles spent waiting
+    uint64 maxwait;
+    uint64 hold;        // tsc cycles held
+    uint64 maxhold;
+};
+
+// mutual exclusion lock, ticket lock
+// acquire() takes the next ticket and spins until owner reaches it,
+// so waiting cpus are served in FIFO order.
 struct spinlock {
-    uint locked;        // is the lock held;
+    volatile uint next;     // next ticket to hand out
+    volatile uint owner;    // ticket being served; the lock is held while next != owner
+
+    char *name;         // name of lock (for debug)
+    struct cpu *cpu;    // the cpu holding the lock
+    uint pcs[10];       // the call stack (an array of program counters) that locked the lock;
+#ifdef LOCKSTAT
+    struct lockstat *stat;  // counters for the current holder's call site
+    uint64 tsc;             // when the current holder took the lock
+#endif
+};
+
+// queue node for an mcs lock, one per waiting or holding cpu.
+// each waiter spins on its own node instead of the lock.
+struct mcsnode {
+    struct mcsnode *volatile next;  // next waiter in line
+    volatile uint wait;             // set until the previous holder hands over the lock
+};
+
+// mutual exclusion lock, MCS queued lock, for heavily contended locks.
+// the caller supplies a struct mcsnode, usually on its stack, which must
+// stay in place from acquiremcs() until the matching releasemcs().
+struct mcslock {
+    struct mcsnode *volatile tail;  // last cpu in line, null if free
 
     char *name;         // name of lock (for debug)
     struct cpu *cpu;    // the cpu holding the lock
     uint pcs[10];       // the call stack (an array of program counters) that locked the lock;
+#ifdef LOCKSTAT
+    struct lockstat *stat;  // counters for the current holder's call site
+    uint64 tsc;             // when the current holder took the lock
+#endif
 };
 
 #endif //AOS_SPINLOCK_H
@@ -0,0 +1,68 @@
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "syscall.h"
+#include "kstat.h"
+
+// system calls enter the kernel in one of two ways, both of which end up in trap()
+// with a T_SYSCALL trap frame of the same layout:
+// * int $T_SYSCALL, through vectors.S and alltraps, returning with iret.
+// * sysenter, through sysenter_entry in trapasm.S, returning with sysexit.
+//   the caller passes its return %eip in %edx and its %esp in %ecx, and
+//   must assume both are clobbered. seginit() sets the sysenter MSRs up,
+//   switchuvm() points MSR_SYSENTER_ESP at the process's kernel stack.
+// the system call number is in %eax, the return value comes back in %eax.
+
+extern int sys_exit(void);
+extern int sys_getpid(void);
+extern int sys_uptime(void);
+
+static int (*syscalls[])(void) = {
+        [SYS_exit]      sys_exit,
+        [SYS_getpid]    sys_getpid,
+        [SYS_uptime]    sys_uptime,
+};
+
+void
+syscall(void)
+{
+    int num;
+    struct proc *curproc = myproc();
+
+    kstatinc(KS_SYSCALL);
+    num = curproc->tf->eax;
+    if (num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+        curproc->tf->eax = syscalls[num]();
+    } else {
+        cprintf("%d %s: unknown sys call %d\n", curproc->pid, curproc->name, num);
+        curproc->tf->eax = -1;
+    }
+}
+
+// null system call benchmark
+//
+// runs the user loop in sysbench.S, which calls getpid() NSYSBENCH times
+// through int $T_SYSCALL and then NSYSBENCH times through sysenter,
+// and prints the average cost of a round trip for both paths.
+void
+syscallbench(void)
+{
+    extern char sysbench_start[], sysbench_end[], sysbench_result[];
+    static char image[PGSIZE];
+    uint sz, *result;
+
+    sz = sysbench_end - sysbench_start;
+    memmove(image, sysbench_start, sz);
+    runinit(image, sz);
+
+    result = (uint*)(image + (sysbench_result - sysbench_start));
+    cprintf("syscallbench: int $T_SYSCALL %d cycles/call\n", result[0] / NSYSBENCH);
+    if (result[1])
+        cprintf("syscallbench: sysenter %d cycles/call\n", result[1] / NSYSBENCH);
+    else
+        cprintf("syscallbench: sysenter not supported\n");
+}
@@ -0,0 +1,11 @@
+#ifndef AOS_SYSCALL_H
+#define AOS_SYSCALL_H
+
+// system call numbers, kept in step with xv6 so user programs port unchanged
+#define SYS_exit    2
+#define SYS_getpid 11
+#define SYS_uptime 14
+
+#define NSYSBENCH  10000   // calls per entry path in syscallbench()
+
+#endif //AOS_SYSCALL_H
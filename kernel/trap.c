@@ -3,7 +3,11 @@
 #include "traps.h"
 #include "x86.h"
 #include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "proc.h"
 #include "spinlock.h"
+#include "kstat.h"
 
 //interrupt descriptor table (shared by all CPUs)
 struct gatedesc idt[256];
@@ -33,13 +37,22 @@ void
 trap(struct trapframe *tf)
 {
     if (tf->trapno == T_SYSCALL) {
-        cprintf("trap: this is a syscall: %d\n, this will be implement before user space support\n", tf->trapno);
+        if (myproc()->killed)
+            exit();
+        myproc()->tf = tf;
+        syscall();
+        if (myproc()->killed)
+            exit();
+        return;
     }
+    if (tf->trapno >= T_IRQ0)
+        kstatinc(KS_INTR);
     switch (tf->trapno) {
         case T_IRQ0 + IRQ_TIMER:
             if(cpuid() == 0){
                 acquire(&tickslock);
                 ticks++;
+                vdsotick(ticks);
                 wakeup(&ticks);
                 release(&tickslock);
             }
@@ -62,12 +75,21 @@ trap(struct trapframe *tf)
             uartintr();
             lapiceoi();
             break;
+        case T_DEVICE:
+            fputrap(tf);
+            break;
         case T_IRQ0 + IRQ_SPURIOUS:
             cprintf("cpu%d: spurious interrupt at %x:%x\n",
                     cpuid(), tf->cs, tf->eip);
             lapiceoi();
             break;
         default:
+            // a pci device's. its handlers have acked it, so the
+            // level-triggered line is down by the eoi
+            if (tf->trapno >= T_IRQ0 && pciintr(tf->trapno - T_IRQ0)) {
+                lapiceoi();
+                break;
+            }
             // todo: unknown interrupt, print error information here
             cprintf("trap: unknown interrupt number: 0x%x\n", tf->trapno);
     }
@@ -8,6 +8,7 @@ typedef unsigned char  uchar;
 typedef unsigned int   uint32;
 typedef unsigned short uint16;
 typedef unsigned char  uint8;
+typedef unsigned long long uint64;
 
 typedef int     int32;
 typedef short   int16;
@@ -0,0 +1,92 @@
+// Kernel side of the read-only pages described in vdso.h.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "vdso.h"
+
+#define PIT_CH2     0x42    // 8254 counter 2 data
+#define PIT_MODE    0x43    // 8254 mode/command
+#define PIT_GATE    0x61    // port B: counter 2 gate (bit 0), output (bit 5)
+#define PIT_HZ      1193182 // 8254 input clock
+#define CALMS       10      // milliseconds to calibrate the tsc over
+
+// mapped at VDSO in every page table, see kmap in vm.c
+__attribute__((__aligned__(PGSIZE)))
+char vdsopage[PGSIZE];
+
+static struct vdso *vdso = (struct vdso*)vdsopage;
+
+// count tsc cycles while the 8254 counts down CALMS milliseconds
+static uint
+tsccalibrate(void)
+{
+    uint latch = PIT_HZ / 1000 * CALMS;
+    uint64 t0;
+
+    // gate counter 2 on, speaker off; mode 0 (interrupt on terminal count)
+    outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+    outb(PIT_MODE, 0xB0);
+    outb(PIT_CH2, latch & 0xFF);
+    outb(PIT_CH2, latch >> 8);
+
+    t0 = rdtsc();
+    while ((inb(PIT_GATE) & 0x20) == 0)
+        ;
+    return (uint)(rdtsc() - t0) / CALMS;
+}
+
+void
+vdsoinit(void)
+{
+    int i;
+
+    if (sizeof(struct vdso) > PGSIZE || sizeof(struct vdsoproc) > PGSIZE)
+        panic("vdsoinit: too big");
+
+    vdso->ncpu = ncpu;
+    for (i = 0; i < ncpu; i++)
+        vdso->apiccpu[cpus[i].apicid] = i;
+    vdso->tsc_khz = tsccalibrate();
+    cprintf("vdso: tsc %d kHz\n", vdso->tsc_khz);
+}
+
+// tsc cycles per millisecond, 0 if unknown
+uint
+tsckhz(void)
+{
+    return vdso->tsc_khz;
+}
+
+// called from the timer interrupt with tickslock held,
+// which makes it the only writer.
+void
+vdsotick(uint t)
+{
+    uint64 tsc = rdtsc();
+
+    vdso->seq++;
+    __sync_synchronize();
+    vdso->ticks = t;
+    vdso->tsc_lo = (uint)tsc;
+    vdso->tsc_hi = (uint)(tsc >> 32);
+    __sync_synchronize();
+    vdso->seq++;
+}
+
+// fill in p's page at VDSOPROC, once p->pgdir has been set up by inituvm().
+void
+vdsosetproc(struct proc *p)
+{
+    struct vdsoproc *vp;
+
+    if ((vp = (struct vdsoproc*)uva2ka(p->pgdir, (char*)VDSOPROC)) == 0)
+        panic("vdsosetproc");
+    vp->pid = p->pid;
+    vp->ppid = p->parent ? p->parent->pid : 0;
+    safestrcpy(vp->name, p->name, sizeof(vp->name));
+}
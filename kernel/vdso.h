@@ -0,0 +1,54 @@
+#ifndef AOS_VDSO_H
+#define AOS_VDSO_H
+
+// Pages the kernel maintains for user code to read without a system call.
+//
+// struct vdso is a single kernel page mapped read-only at VDSO in every
+// address space by setupkvm(). The timer interrupt updates it under a
+// sequence count: seq is odd while an update is in progress, so a reader
+// copies the fields between two reads of seq and retries if seq was odd
+// or changed (see vdsoclock()).
+//
+// struct vdsoproc is a page of its own per process, mapped read-only at
+// VDSOPROC by inituvm() and filled in once by vdsosetproc().
+//
+// The current cpu is apiccpu[] indexed by the local APIC ID, which user
+// code gets from cpuid(1) %ebx[31:24].
+
+struct vdso {
+    volatile uint seq;  // sequence count for the fields up to tsc_hi
+    uint ticks;         // timer interrupts since boot
+    uint tsc_lo;        // time-stamp counter at the last tick
+    uint tsc_hi;
+
+    // constant after boot
+    uint tsc_khz;       // time-stamp counter frequency, 0 if unknown
+    uint ncpu;
+    uchar apiccpu[256]; // cpu number for each local APIC ID
+};
+
+struct vdsoproc {
+    int pid;
+    int ppid;           // parent's pid, 0 if none
+    char name[16];
+};
+
+// consistent snapshot of ticks and the tsc at that tick.
+static inline uint
+vdsoclock(volatile struct vdso *v, uint64 *tsc)
+{
+    uint seq, t;
+
+    for (;;) {
+        while ((seq = v->seq) & 1)
+            ;
+        __sync_synchronize();
+        t = v->ticks;
+        *tsc = ((uint64)v->tsc_hi << 32) | v->tsc_lo;
+        __sync_synchronize();
+        if (v->seq == seq)
+            return t;
+    }
+}
+
+#endif //AOS_VDSO_H
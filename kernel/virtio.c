@@ -0,0 +1,326 @@
+// virtio block driver, for the legacy pci interface.
+//
+// virtioinit() registers the first virtio-blk pci function as a block
+// device, after the ide and ahci disks, see blkdev.c.
+//
+// requests go through split virtqueues. a device that offers several
+// (VIRTIO_BLK_F_MQ) gets one per cpu, up to NVQ, each with its own
+// blkqueue, so cpus submitting at once don't meet; the others all share
+// queue 0. each request is one descriptor in the ring, pointing to an
+// indirect table of header, data buffers and status byte, so a queue
+// carries as many requests as it has slots, however long their runs.
+// without indirect descriptors the table goes in the ring itself, and a
+// queue carries fewer.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "iosched.h"
+#include "pci.h"
+#include "blkdev.h"
+
+#define NVQ         NCPU    // most queues
+#define NVREQ       16      // request slots per queue
+#define VRUN        8       // most buffers per request
+#define VQMAX       256     // largest ring there is memory for
+#define VQPAGES     3       //   which takes this many pages
+#define SECTOR_SIZE 512
+
+#define VIRTIO_VENDOR   0x1AF4
+#define VIRTIO_BLK      0x1001  // transitional virtio-blk
+
+// legacy registers, in bar 0's i/o space
+#define VIO_DEVFEAT     0x00    // features the device offers
+#define VIO_DRVFEAT     0x04    // features the driver takes
+#define VIO_QPFN        0x08    // ring address of the selected queue, in pages
+#define VIO_QSIZE       0x0C    // its size
+#define VIO_QSEL        0x0E
+#define VIO_QNOTIFY     0x10    // write a queue number to kick it
+#define VIO_STATUS      0x12
+#define VIO_ISR         0x13    // reading acknowledges the interrupt
+#define VIO_CONFIG      0x14    // device config, without msi-x
+
+#define VS_ACK          0x01
+#define VS_DRIVER       0x02
+#define VS_DRIVER_OK    0x04
+#define VS_FAILED       0x80
+#define VISR_QUEUE      0x01
+
+#define VBLK_F_MQ       (1U << 12)
+#define VRING_F_INDIRECT (1U << 28)
+#define VBLK_CFG_NUMQ   34      // config offset of the number of queues
+
+#define VD_NEXT         1
+#define VD_WRITE        2       // device writes the buffer
+#define VD_INDIRECT     4
+
+#define VBLK_T_IN       0
+#define VBLK_T_OUT      1
+
+struct vdesc {
+    uint addr;
+    uint addrhi;
+    uint len;
+    ushort flags;
+    ushort next;
+};
+
+struct vavail {
+    ushort flags;
+    ushort idx;
+    ushort ring[];
+};
+
+struct vusedelem {
+    uint id;            // head descriptor of the request
+    uint len;
+};
+
+struct vused {
+    ushort flags;
+    volatile ushort idx;
+    struct vusedelem ring[];
+};
+
+struct vblkhdr {
+    uint type;
+    uint ioprio;
+    uint sector;
+    uint sectorhi;
+};
+
+// a request slot
+struct vreq {
+    struct vblkhdr hdr;
+    struct vdesc ind[VRUN + 2];     // indirect table
+    struct buf *b;      // first buffer of the run
+    volatile uchar status;
+};
+
+// its blkqueue's lock protects it
+struct virtq {
+    int qn;             // queue number
+    uint num;           // ring size
+    struct vdesc *desc;
+    struct vavail *avail;
+    struct vused *used;
+    ushort lastused;    // used entries up to here have been seen to
+    uint busy;          // slots in use
+    int nslot;
+    struct vreq *req;   // nslot of them
+};
+
+static ushort vbase;    // i/o registers
+static int indirect;
+static int nq;
+static struct virtq vqs[NVQ];
+static struct blkqueue vbqs[NVQ];
+static struct blkdev vdisk;
+
+static int virtiofinish(struct blkqueue*);
+
+__attribute__((__aligned__(PGSIZE)))
+static char vqmem[NVQ][VQPAGES * PGSIZE];
+
+// put the run starting at b in a free slot; blkstart() keeps
+// no more than nslot in flight, so there is one.
+// called with the queue's blkqueue lock held
+static void
+virtiostart(struct blkqueue *bq, struct buf *b)
+{
+    struct virtq *vq = bq->priv;
+    struct vreq *r;
+    struct vdesc *t;
+    struct buf *x;
+    int s, n, nd, head, write;
+
+    for (s = 0; s < vq->nslot && (vq->busy & (1U << s)); s++)
+        ;
+    if (s == vq->nslot)
+        panic("virtiostart: no slot");
+    r = &vq->req[s];
+    write = (b->flags & B_DIRTY) != 0;
+    r->hdr.type = write ? VBLK_T_OUT : VBLK_T_IN;
+    r->hdr.ioprio = 0;
+    r->hdr.sector = b->blockno * (BSIZE / SECTOR_SIZE);
+    r->hdr.sectorhi = 0;
+    r->status = 0xFF;
+    r->b = b;
+
+    // header, the buffers, the status byte, chained by index in t
+    if (indirect) {
+        t = r->ind;
+        head = s;
+    } else {
+        head = s * (VRUN + 2);
+        t = &vq->desc[head];
+    }
+    t[0].addr = V2P(&r->hdr);
+    t[0].len = sizeof(r->hdr);
+    t[0].flags = VD_NEXT;
+    for (n = 1, x = b; x; n++, x = x->qnext) {
+        t[n].addr = V2P(x->data);
+        t[n].len = BSIZE;
+        t[n].flags = VD_NEXT | (write ? 0 : VD_WRITE);
+    }
+    t[n].addr = V2P(&r->status);
+    t[n].len = 1;
+    t[n].flags = VD_WRITE;
+    nd = n + 1;
+    for (n = 0; n < nd; n++) {
+        t[n].addrhi = 0;
+        t[n].next = (indirect ? 0 : head) + n + 1;
+    }
+    if (indirect) {
+        vq->desc[head].addr = V2P(t);
+        vq->desc[head].addrhi = 0;
+        vq->desc[head].len = nd * sizeof(struct vdesc);
+        vq->desc[head].flags = VD_INDIRECT;
+        vq->desc[head].next = 0;
+    }
+
+    vq->busy |= 1U << s;
+    vq->avail->ring[vq->avail->idx % vq->num] = head;
+    __sync_synchronize();
+    vq->avail->idx++;
+}
+
+// tell the device about the requests virtiostart() added
+static void
+virtiokick(struct blkqueue *bq)
+{
+    struct virtq *vq = bq->priv;
+
+    __sync_synchronize();
+    outw(vbase + VIO_QNOTIFY, vq->qn);
+}
+
+// set up queue qn's ring in vqmem[qn], and tell the device where it is.
+// returns 0 if the ring is too big for it.
+static int
+virtqinit(struct virtq *vq, int qn)
+{
+    char *mem = vqmem[qn];
+    uint num;
+
+    outw(vbase + VIO_QSEL, qn);
+    num = inw(vbase + VIO_QSIZE);
+    if (num == 0 || num > VQMAX)
+        return 0;
+    memset(mem, 0, sizeof(vqmem[qn]));
+    vq->qn = qn;
+    vq->num = num;
+    vq->desc = (struct vdesc*)mem;
+    vq->avail = (struct vavail*)(mem + num * sizeof(struct vdesc));
+    vq->used = (struct vused*)(mem + PGROUNDUP(num * sizeof(struct vdesc) + 6 + 2 * num));
+    outl(vbase + VIO_QPFN, V2P(mem) >> PTXSHIFT);
+
+    vq->nslot = indirect ? num : num / (VRUN + 2);
+    if (vq->nslot > NVREQ)
+        vq->nslot = NVREQ;
+    if ((vq->req = (struct vreq*)kalloc()) == 0)
+        panic("virtqinit");
+    memset(vq->req, 0, PGSIZE);
+    blkqinit(&vbqs[qn], "virtq", &deadlinesched, VRUN, vq->nslot, virtiostart, vq);
+    vbqs[qn].kick = virtiokick;
+    vbqs[qn].poll = virtiofinish;
+    return 1;
+}
+
+void
+virtioinit(void)
+{
+    struct pcidev *d;
+    uint feat;
+    int i, dev;
+
+    if ((d = pcifindid(VIRTIO_VENDOR, VIRTIO_BLK)) == 0 || !(d->bar[0] & PCI_BAR_IO))
+        return;
+    if (sizeof(struct vreq) * NVREQ > PGSIZE)
+        panic("virtioinit: vreq too big");
+    pcienable(d, 1);
+    vbase = PCI_BAR_IOADDR(d->bar[0]);
+    outb(vbase + VIO_STATUS, 0);    // reset
+    outb(vbase + VIO_STATUS, VS_ACK);
+    outb(vbase + VIO_STATUS, VS_ACK | VS_DRIVER);
+
+    feat = inl(vbase + VIO_DEVFEAT) & (VBLK_F_MQ | VRING_F_INDIRECT);
+    outl(vbase + VIO_DRVFEAT, feat);
+    indirect = (feat & VRING_F_INDIRECT) != 0;
+    nq = 1;
+    if (feat & VBLK_F_MQ)
+        nq = inw(vbase + VIO_CONFIG + VBLK_CFG_NUMQ);
+    if (nq > ncpu)
+        nq = ncpu;
+    if (nq > NVQ)
+        nq = NVQ;
+    if (nq < 1)     // a device claiming none still has queue 0
+        nq = 1;
+    for (i = 0; i < nq; i++) {
+        if (!virtqinit(&vqs[i], i)) {
+            cprintf("virtio: queue %d too big\n", i);
+            outb(vbase + VIO_STATUS, VS_FAILED);
+            return;
+        }
+    }
+
+    vdisk.name = "virtio";
+    vdisk.nq = nq;
+    vdisk.qs = vbqs;
+    if ((dev = blkalloc(&vdisk)) < 0) {
+        outb(vbase + VIO_STATUS, VS_FAILED);
+        return;
+    }
+    pcisetintr(d, virtiointr);
+    outb(vbase + VIO_STATUS, VS_ACK | VS_DRIVER | VS_DRIVER_OK);
+    cprintf("virtio: dev %d, %d queues, %s descriptors\n", dev, nq, indirect ? "indirect" : "direct");
+}
+
+// finish the requests the device has put in bq's used ring, and start
+// more. returns how many. caller holds bq->lock
+static int
+virtiofinish(struct blkqueue *bq)
+{
+    struct virtq *vq = bq->priv;
+    struct vusedelem *e;
+    struct vreq *r;
+    int s, n;
+
+    for (n = 0; vq->lastused != vq->used->idx; n++) {
+        __sync_synchronize();
+        e = &vq->used->ring[vq->lastused % vq->num];
+        s = indirect ? e->id : e->id / (VRUN + 2);
+        r = &vq->req[s];
+        if (r->status != 0)
+            panic("virtiointr: i/o error");
+        blkdone(bq, r->b);
+        r->b = 0;
+        vq->busy &= ~(1U << s);
+        vq->lastused++;
+    }
+    blkstart(bq);
+    return n;
+}
+
+void
+virtiointr(void)
+{
+    int i;
+
+    // the register is shared by all the queues
+    if (!(inb(vbase + VIO_ISR) & VISR_QUEUE))
+        return;
+    for (i = 0; i < nq; i++) {
+        acquire(&vbqs[i].lock);
+        virtiofinish(&vbqs[i]);
+        release(&vbqs[i].lock);
+    }
+}
@@ -8,7 +8,10 @@
 #include "elf.h"
 
 extern char data[]; // provided by kernel.ld
+extern char vdsopage[]; // in vdso.c
+extern void sysenter_entry(void);   // in trapasm.S
 pde_t *kpgdir;      // used for scheduler;
+static int sysenter;    // cpus support sysenter/sysexit, set by seginit()
 
 
 // set up CPU's kernel segment descriptors
@@ -17,6 +20,7 @@ void
 seginit(void)
 {
     struct cpu *c;
+    uint edx;
 
     // Map "logical" addresses to virtual addresses using identity map.
     // Cannot share a CODE descriptor for both kernel and user
@@ -29,6 +33,16 @@ seginit(void)
     c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
     c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
     lgdt(c->gdt, sizeof(c->gdt));
+
+    // fast system call entry; int $T_SYSCALL keeps working without it.
+    // the stack is per process, see switchuvm().
+    cpuinfo(1, 0, 0, 0, &edx);
+    sysenter = (edx & CPUID_SEP) != 0;
+    if (sysenter) {
+        wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3, 0);
+        wrmsr(MSR_SYSENTER_EIP, (uint)sysenter_entry, 0);
+        wrmsr(MSR_SYSENTER_ESP, 0, 0);
+    }
 }
 
 // return the address of the PTE in page table pgdir that corresponds to virtual address va
@@ -46,7 +60,7 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
         if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
             return 0;
         // Make sure all those PTE_P bits are zero.
-        memset(pgtab, 0, PGSIZE);
+        pagezero(pgtab);
         // The permissions here are overly generous, but they can
         // be further restricted by the permissions in the page table
         // entries, if necessary.
@@ -89,8 +103,10 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //
 // setupkvm() and exec() set up every page table like this:
 //
-//   0..KERNBASE: user memory (text+data+stack+heap), mapped to
+//   0..VDSOPROC: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
+//   VDSOPROC..VDSO: read-only per-process page (see inituvm)
+//   VDSO..KERNBASE: read-only kernel page shared by all processes
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
@@ -106,6 +122,7 @@ static struct kmap {
     uint phys_end;
     int perm;
 } kmap[] = {
+        {(void*)VDSO, V2P(vdsopage), V2P(vdsopage) + PGSIZE, PTE_U},    // vdso.h, user read-only
         {(void*)KERNBASE, 0, EXTMEM, PTE_W},    // IO space, 0 ~ 1mb
         {(void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kernel test+rodata
         {(void*)data, V2P(data), PHYSTOP, PTE_W},    // kernel data + memory
@@ -121,7 +138,7 @@ setupkvm(void)
 
     if ((pgdir = (pde_t*)kalloc()) == 0)
         return 0;
-    memset(pgdir, 0, PGSIZE);
+    pagezero(pgdir);
     if (P2V(PHYSTOP) > (void*)DEVSPACE)
         panic("PHYSTOP to high");
     for (k = kmap; k < &kmap[NELEM(kmap)]; k++) {
@@ -168,11 +185,14 @@ switchuvm(struct proc *p)
     // forbids I/O instructions (e.g., inb and outb) from user space
     mycpu()->ts.iomb = (ushort) 0xFFFF;
     ltr(SEG_TSS << 3);
+    if (sysenter)
+        wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE, 0);
     lcr3(V2P(p->pgdir));    // switch to process's address space
     popcli();
 }
 
 // load the initcode into address 0 of pgdir, sz must be less than a page.
+// also maps the per-process read-only page at VDSOPROC; vdsosetproc() fills it.
 void
 inituvm(pde_t *pgdir, char *init, uint sz)
 {
@@ -181,9 +201,27 @@ inituvm(pde_t *pgdir, char *init, uint sz)
     if (sz >= PGSIZE)
         panic("inituvm: initcode more than a page");
     mem = kalloc();
-    memset(mem, 0, PGSIZE);
+    pagezero(mem);
     mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W | PTE_U);
     memmove(mem, init, sz);
+
+    mem = kalloc();
+    pagezero(mem);
+    mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U);
+}
+
+// map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+    pte_t *pte;
+
+    pte = walkpgdir(pgdir, uva, 0);
+    if (pte == 0 || (*pte & PTE_P) == 0)
+        return 0;
+    if ((*pte & PTE_U) == 0)
+        return 0;
+    return (char*)P2V(PTE_ADDR(*pte));
 }
 
 // load a program segment into pgdir. addr must be page-aligned and
@@ -236,8 +274,8 @@ freevm(pde_t *pgdir)
 
     if (pgdir == 0)
         panic("freevm: no pgdir");
-    // free pa
-    deallocuvm(pgdir, KERNBASE, 0);
+    // free pa, including the VDSOPROC page but not the shared VDSO page
+    deallocuvm(pgdir, VDSO, 0);
     // free pte
     for (i = 0; i < NPDENTRIES; i++) {
         if (pgdir[i] & PTE_P) {
@@ -27,12 +27,36 @@ outb(ushort port, uchar data)
     asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline ushort
+inw(ushort port)
+{
+    ushort data;
+
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+    return data;
+}
+
 static inline void
 outw(ushort port, ushort data)
 {
     asm volatile("out %0,%1" : : "a" (data), "d" (port));
 }
 
+static inline uint
+inl(ushort port)
+{
+    uint data;
+
+    asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+    return data;
+}
+
+static inline void
+outl(ushort port, uint data)
+{
+    asm volatile("out %0,%1" : : "a" (data), "d" (port));
+}
+
 static inline void
 outsl(int port, const void *addr, int cnt)
 {
@@ -133,6 +157,25 @@ xchg(volatile uint *addr, uint newval)
     return result;
 }
 
+// atomically add v to *addr, returning the old value
+static inline uint
+xadd(volatile uint *addr, uint v)
+{
+    asm volatile("lock; xaddl %0, %1" :
+    "+r" (v), "+m" (*addr) :
+    :
+    "memory", "cc");
+    return v;
+}
+
+// spin-wait hint: saves power and avoids the memory order
+// mis-speculation penalty when the loop exits
+static inline void
+pause(void)
+{
+    asm volatile("pause" ::: "memory");
+}
+
 static inline uint
 rcr2(void)
 {
@@ -147,6 +190,88 @@ lcr3(uint val)
     asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr0(void)
+{
+    uint val;
+    asm volatile("movl %%cr0,%0" : "=r" (val));
+    return val;
+}
+
+static inline void
+lcr0(uint val)
+{
+    asm volatile("movl %0,%%cr0" : : "r" (val));
+}
+
+static inline uint
+rcr4(void)
+{
+    uint val;
+    asm volatile("movl %%cr4,%0" : "=r" (val));
+    return val;
+}
+
+static inline void
+lcr4(uint val)
+{
+    asm volatile("movl %0,%%cr4" : : "r" (val));
+}
+
+// clear CR0_TS, so fpu/sse instructions no longer trap
+static inline void
+clts(void)
+{
+    asm volatile("clts");
+}
+
+// fxsave/fxrstor need a 512-byte area aligned to 16 bytes
+static inline void
+fxsave(void *area)
+{
+    asm volatile("fxsave (%0)" : : "r" (area) : "memory");
+}
+
+static inline void
+fxrstor(void *area)
+{
+    asm volatile("fxrstor (%0)" : : "r" (area) : "memory");
+}
+
+static inline void
+wrmsr(uint msr, uint lo, uint hi)
+{
+    asm volatile("wrmsr" : : "c" (msr), "a" (lo), "d" (hi));
+}
+
+// read the time-stamp counter
+static inline uint64
+rdtsc(void)
+{
+    uint64 tsc;
+
+    asm volatile("rdtsc" : "=A" (tsc));
+    return tsc;
+}
+
+static inline void
+cpuinfo(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+    uint eax, ebx, ecx, edx;
+
+    asm volatile("cpuid" :
+    "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+    "a" (info), "c" (0));
+    if (eaxp)
+        *eaxp = eax;
+    if (ebxp)
+        *ebxp = ebx;
+    if (ecxp)
+        *ecxp = ecx;
+    if (edxp)
+        *edxp = edx;
+}
+
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
 struct trapframe {